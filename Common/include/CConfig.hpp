@@ -41,6 +41,7 @@
 #include <stdlib.h>
 #include <cmath>
 #include <map>
+#include <unordered_map>
 #include <assert.h>
 
 #include "option_structure.hpp"
@@ -131,6 +132,9 @@ private:
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,      /*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
   Inconsistent_Disc,        /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
+  Combined_Recording_Disc,  /*!< \brief Record the solution and mesh coordinates on one tape (multizone disc. adjoint). */
+  Adjoint_Flux_Kernel_Disc, /*!< \brief Use the hand-differentiated JST flux instead of recording it (disc. adjoint). */
+  Batch_Objectives_Disc,    /*!< \brief Solve one adjoint per objective function with one recording (disc. adjoint). */
   Sens_Remove_Sharp,        /*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,           /*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric,             /*!< \brief Flag for axisymmetric calculations */
@@ -141,6 +145,7 @@ private:
   su2double Damp_Engine_Exhaust;  /*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,     /*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong;            /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_GalerkinJacobian;       /*!< \brief Coarse Jacobians are the Galerkin product of the fine Jacobian. */
   su2double Position_Plane;    /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd;          /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL;           /*!< \brief Fixed Cl mode derivate . */
@@ -402,22 +407,41 @@ private:
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
+  unsigned short Unst_Adjoint_Checkpoints; /*!< \brief Number of primal states kept in memory to recompute missing restarts (unsteady adjoint). */
+  unsigned long Unst_Adjoint_PrimalIter;   /*!< \brief Number of inner iterations of the recomputed primal time steps. */
+  su2double Unst_Adjoint_Checkpoint_Tol;   /*!< \brief Relative error tolerance of the (compressed) primal states kept in memory. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
   unsigned short nLevels_TimeAccurateLTS;   /*!< \brief Number of time levels for time accurate local time stepping. */
   unsigned short nTimeDOFsADER_DG;          /*!< \brief Number of time DOFs used in the predictor step of ADER-DG. */
+  unsigned short nOrderBDF_DG;              /*!< \brief Order of the BDF scheme of the implicit DG-FEM time integration. */
+  unsigned short nNewtonIter_DG;            /*!< \brief Maximum number of Newton iterations per time step of the implicit DG-FEM scheme. */
+  su2double NewtonTol_DG;                   /*!< \brief Residual reduction that ends the Newton iterations of the implicit DG-FEM scheme. */
+  unsigned short nPMGLevels_DG;             /*!< \brief Number of coarse polynomial levels of the DG-FEM p-multigrid cycle. */
+  unsigned short nPMGPreSmooth_DG;          /*!< \brief Number of pre-smoothing iterations of the DG-FEM p-multigrid cycle. */
+  unsigned short nPMGPostSmooth_DG;         /*!< \brief Number of post-smoothing iterations of the DG-FEM p-multigrid cycle. */
   su2double *TimeDOFsADER_DG;               /*!< \brief The location of the ADER-DG time DOFs on the interval [-1,1]. */
   unsigned short nTimeIntegrationADER_DG;   /*!< \brief Number of time integration points ADER-DG. */
   su2double *TimeIntegrationADER_DG;        /*!< \brief The location of the ADER-DG time integration points on the interval [-1,1]. */
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
+  ROSENBROCK_SCHEME Kind_Rosenbrock;        /*!< \brief Linearly implicit variant of the implicit flow time integration. */
+  unsigned short Jacobian_Lag;              /*!< \brief Iterations between assemblies of the edge Jacobian of the flow. */
+  su2double Jacobian_Lag_CFL_Factor;        /*!< \brief Change of the CFL that triggers an assembly of the lagged Jacobian. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
+  unsigned short Residual_Smoothing_Iter;   /*!< \brief Jacobi iterations of the implicit residual smoothing. */
+  su2double Residual_Smoothing_Coeff;       /*!< \brief Coefficient of the implicit residual smoothing. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
+  su2double QuasiNewtonFilterTol;      /*!< \brief Tolerance to filter the samples of quasi-Newton methods. */
+  bool QuasiNewtonPrimal;              /*!< \brief Quasi-Newton acceleration of the steady primal iterations. */
+  array<su2double,2> QuasiNewtonPrimalParam{{100, 1}}; /*!< \brief Start iteration and residual increase for a reset. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NK_ForwardAD;           /*!< \brief Use forward AD instead of finite differences for the NK matrix-free products. */
+  bool NK_CoupledTurb;         /*!< \brief Include the turbulence variables in the NK system (monolithic RANS). */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -445,10 +469,13 @@ private:
   unsigned long Grad_Linear_Solver_Iter; /*!< \brief Max iterations of the linear solver for the gradient smoothing. */
 
   bool ReorientElements;       /*!< \brief Flag for enabling element reorientation. */
+  POINT_ORDERING Kind_Point_Ordering; /*!< \brief Renumbering of the points of each rank. */
+  bool Distributed_WallDistance;       /*!< \brief Compute the wall distance without gathering the walls on all ranks. */
   string CustomObjFunc;        /*!< \brief User-defined objective function. */
   string CustomOutputs;        /*!< \brief User-defined functions for outputs. */
   unsigned short nDV,                  /*!< \brief Number of design variables. */
   nObj, nObjW;                         /*! \brief Number of objective functions. */
+  short Batch_ObjFunc = -1;            /*!< \brief Objective solved for in a batched adjoint, -1 for the combination. */
   unsigned short* nDV_Value;           /*!< \brief Number of values for each design variable (might be different than 1 if we allow arbitrary movement). */
   unsigned short nFFDBox;              /*!< \brief Number of ffd boxes. */
   unsigned short nTurboMachineryKind;  /*!< \brief Number turbomachinery types specified. */
@@ -485,6 +512,7 @@ private:
   MIXINGVISCOSITYMODEL Kind_MixingViscosityModel; /*!< \brief Kind of the mixing Viscosity Model*/
   CONDUCTIVITYMODEL Kind_ConductivityModel; /*!< \brief Kind of the Thermal Conductivity Model */
   CONDUCTIVITYMODEL_TURB Kind_ConductivityModel_Turb; /*!< \brief Kind of the Turbulent Thermal Conductivity Model */
+  su2double Transport_Properties_Tol; /*!< \brief Relative change of T and rho below which the transport properties are reused. */
   DIFFUSIVITYMODEL Kind_Diffusivity_Model; /*!< \brief Kind of the mass diffusivity Model */
   FREESTREAM_OPTION Kind_FreeStreamOption; /*!< \brief Kind of free stream option to choose if initializing with density or temperature  */
   MAIN_SOLVER Kind_Solver;         /*!< \brief Kind of solver: Euler, NS, Continuous adjoint, etc.  */
@@ -524,9 +552,16 @@ private:
   ENUM_DATADRIVEN_METHOD Kind_DataDriven_Method;       /*!< \brief Method used for datset regression in data-driven fluid models. */
 
   su2double DataDriven_Relaxation_Factor; /*!< \brief Relaxation factor for Newton solvers in data-driven fluid models. */
+  bool Write_Binary_LUT;                  /*!< \brief Write the look-up table in binary format after loading it. */
 
   STRUCT_TIME_INT Kind_TimeIntScheme_FEA;    /*!< \brief Time integration for the FEA equations. */
   STRUCT_SPACE_ITE Kind_SpaceIteScheme_FEA;  /*!< \brief Iterative scheme for nonlinear structural analysis. */
+  unsigned long FEA_Tangent_Reuse;           /*!< \brief Max iterations for which the tangent of nonlinear structural analysis is kept. */
+  su2double FEA_Tangent_Refresh;             /*!< \brief Residual reduction ratio above which the structural tangent is updated. */
+  bool Modal_Superposition;                  /*!< \brief Solve linear structures by superposition of their modes. */
+  unsigned short nModes_FEA;                 /*!< \brief Number of structural modes. */
+  su2double Modal_Damping;                   /*!< \brief Damping ratio of the structural modes. */
+  string Modal_FileName;                     /*!< \brief File with the structural modes. */
   unsigned short
   Kind_TimeIntScheme_Radiation, /*!< \brief Time integration for the Radiation equations. */
   Kind_ConvNumScheme,           /*!< \brief Global definition of the convective term. */
@@ -571,6 +606,8 @@ private:
 
   bool MUSCL,              /*!< \brief MUSCL scheme .*/
   MUSCL_Flow,              /*!< \brief MUSCL scheme for the flow equations.*/
+  MUSCL_Flow_Single_Prec,  /*!< \brief Single precision copy of the flow gradients and limiters for the MUSCL scheme.*/
+  Edge_Geometry_Cache,     /*!< \brief Store the geometry of the edges in the order of the vectorized edge loop.*/
   MUSCL_Turb,              /*!< \brief MUSCL scheme for the turbulence equations.*/
   MUSCL_Heat,              /*!< \brief MUSCL scheme for the (fvm) heat equation.*/
   MUSCL_AdjFlow,           /*!< \brief MUSCL scheme for the adj flow equations.*/
@@ -615,7 +652,23 @@ private:
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  unsigned long Linear_Solver_Prec_Reuse;        /*!< \brief Max number of linear solves for which the preconditioner is reused. */
+  su2double Linear_Solver_Prec_Reuse_Growth;     /*!< \brief Growth of linear iterations (w.r.t. last build) that forces a rebuild. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Number of directions recycled between linear solves (RECYCLED_FGMRES). */
+  LINEAR_SOLVER_FORCING Kind_Linear_Solver_Forcing; /*!< \brief How the tolerance of the linear solver is chosen for each solve. */
+  array<su2double,3> Linear_Solver_Forcing_Param{{0.9, 2.0, 0.1}}; /*!< \brief Gamma, alpha, and max tolerance of the Eisenstat-Walker forcing. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Level_Scheduling;      /*!< \brief Thread-parallel ILU via level scheduling instead of partitions. */
+  unsigned short Linear_Solver_Schwarz_Overlap; /*!< \brief Layers of halo points in the ILU preconditioner (restricted additive Schwarz). */
+  bool Linear_Solver_Schwarz_Coarse;            /*!< \brief Coarse correction (one aggregate per rank) of the ILU preconditioner. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Smooth;       /*!< \brief Pre and post smoothing sweeps of the AMG preconditioner. */
+  bool Linear_Solver_AMG_RigidBodyModes;         /*!< \brief Use the rigid body modes in the AMG of elasticity systems. */
+  MATRIX_FORMAT Kind_Matrix_Format;              /*!< \brief Storage format of the matrix in the linear solver products. */
+  LINEAR_SYSTEM* Linear_Solver_Single_Prec;      /*!< \brief Linear systems solved in single precision. */
+  unsigned short nLinear_Solver_Single_Prec;     /*!< \brief Number of linear systems solved in single precision. */
+  LINEAR_SYSTEM* Linear_Solver_GPU;              /*!< \brief Linear systems whose products are offloaded to the GPU. */
+  unsigned short nLinear_Solver_GPU;             /*!< \brief Number of linear systems offloaded to the GPU. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -639,6 +692,14 @@ private:
   su2double Min_Beta_RoeTurkel,     /*!< \brief Minimum value of Beta for the Roe-Turkel low Mach preconditioner. */
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
+  unsigned long Deform_Stiffness_Reuse;  /*!< \brief Number of deformation solves that reuse the stiffness matrix. */
+  su2double DualGrid_UpdateTol;          /*!< \brief Displacement below which the dual grid of a point is not updated. */
+  unsigned short Deform_Warm_Start;      /*!< \brief Number of previous deformations used to predict the initial guess. */
+  DEFORM_METHOD Deform_Method;           /*!< \brief Method of volumetric mesh deformation. */
+  RADIAL_BASIS Deform_RBF_Function;      /*!< \brief Radial basis function of the RBF mesh deformation. */
+  su2double Deform_RBF_Radius;           /*!< \brief Support radius of the RBF mesh deformation (0 is automatic). */
+  su2double Deform_RBF_Tolerance;        /*!< \brief Relative tolerance of the greedy point selection. */
+  unsigned long Deform_RBF_Max_Points;   /*!< \brief Maximum number of points selected for the RBF mesh deformation. */
   unsigned short Deform_StiffnessType;   /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
@@ -685,10 +746,14 @@ private:
   unsigned short Residual_Func_Flow;  /*!< \brief Equation to apply residual convergence to. */
   unsigned short Res_FEM_CRIT;        /*!< \brief Criteria to apply to the FEM convergence (absolute/relative). */
   unsigned long StartConv_Iter;       /*!< \brief Start convergence criteria at iteration. */
+  unsigned long Restart_KeyFrame_Interval; /*!< \brief Steps between full frames of restart time series. */
   su2double Cauchy_Eps;               /*!< \brief Epsilon used for the convergence. */
   bool Restart,                       /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,                /*!< \brief Read binary SU2 native restart files.*/
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
+  Restart_Time_Series,                /*!< \brief Write/read the unsteady binary restarts as steps of a single file.*/
+  Read_Restart_MMap,                  /*!< \brief Read binary restart files by mapping them into memory.*/
+  Prefetch_Input_Files,               /*!< \brief Read the mesh and restart files in the background during preprocessing.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
@@ -765,6 +830,8 @@ private:
   su2double *nBlades;                 /*!< \brief number of blades for turbomachinery computation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format. */
+  bool CGNS_ParallelRead;             /*!< \brief Read CGNS meshes with collective parallel I/O. */
   TAB_OUTPUT Tab_FileFormat;          /*!< \brief Format of the output files. */
   unsigned short output_precision;    /*!< \brief <ofstream>.precision(value) for SU2_DOT and HISTORY output */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
@@ -789,6 +856,10 @@ private:
   nRefOriginMoment_Z;      /*!< \brief Number of Z-coordinate moment computation origins. */
   unsigned short nMesh_Box_Size;
   short *Mesh_Box_Size;          /*!< \brief Array containing the number of grid points in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
+  SYNTHETIC_MESH_ELEM SyntheticMesh_Elements; /*!< \brief Elements of the SYNTHETIC grid. */
+  SYNTHETIC_MESH_GEOM SyntheticMesh_Geometry; /*!< \brief Shape of the SYNTHETIC grid. */
+  unsigned short SyntheticMesh_Layers;        /*!< \brief Cell layers of prisms of the HYBRID SYNTHETIC grid. */
+  su2double SyntheticMesh_Growth;             /*!< \brief Growth of the spacing in y of the SYNTHETIC grid. */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
@@ -806,10 +877,14 @@ private:
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
   ObjFunc_Hess_FileName,         /*!< \brief Hessian approximation obtained by the Sobolev smoothing solver. */
-  *DataDriven_Method_FileNames;    /*!< \brief Dataset information for data-driven fluid models. */
+  Phase_Timers_FileName,         /*!< \brief Output file of the phase timers (Chrome trace format). */
+  *DataDriven_Method_FileNames,    /*!< \brief Dataset information for data-driven fluid models. */
+  *Sol_Batch_FileNames;            /*!< \brief Solution files converted one after the other by SU2_SOL. */
+  unsigned short nSol_Batch_Files; /*!< \brief Number of solution files converted by SU2_SOL. */
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_Phase_Timers,          /*!< \brief Time the main phases of the solution process.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
@@ -853,6 +928,11 @@ private:
   nPrandtl_Lam,                  /*!< \brief Number of species laminar Prandtl number. */
   nPrandtl_Turb,                 /*!< \brief Number of species turbulent Prandtl number. */
   nConstant_Lewis_Number;       /*!< \brief Number of species Lewis Number. */
+  bool Tabulate_FluidModel;                                  /*!< \brief Evaluate the fluid model from a table. */
+  array<su2double,2> Tabulation_Density_Range{{0.01, 100.0}};       /*!< \brief Density range of the fluid table. */
+  array<su2double,2> Tabulation_Temperature_Range{{200.0, 600.0}};  /*!< \brief Temperature range of the fluid table. */
+  array<unsigned short,2> Tabulation_Size{{200, 200}};       /*!< \brief Number of nodes of the fluid table (density, energy). */
+  string Tabulation_FileName;                                /*!< \brief File where the fluid table is cached. */
   su2double Diffusivity_Constant;   /*!< \brief Constant mass diffusivity for scalar transport.  */
   su2double Diffusivity_ConstantND; /*!< \brief Non-dim. constant mass diffusivity for scalar transport.  */
   su2double Schmidt_Number_Laminar;   /*!< \brief Laminar Schmidt number for mass diffusion.  */
@@ -940,6 +1020,7 @@ private:
   Pitching_Phase[3] = {0.0},          /*!< \brief Pitching phase offset. */
   Plunging_Omega[3] = {0.0},          /*!< \brief Angular frequency of the mesh plunging. */
   Plunging_Ampl[3] = {0.0};           /*!< \brief Plunging amplitude. */
+  bool RigidMotion_TransformMetrics;  /*!< \brief Transform the dual grid metrics under rigid motion instead of recomputing them. */
   su2double *MarkerMotion_Origin, /*!< \brief Mesh motion origin of marker. */
   *MarkerTranslation_Rate,        /*!< \brief Translational velocity of marker. */
   *MarkerRotation_Rate,           /*!< \brief Angular velocity of marker. */
@@ -1023,6 +1104,9 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned short RadialBasisFunction_LocalPoints; /*!< \brief Size of the local RBF patches, 0 for a global RBF. */
+  unsigned long SlidingInterface_PeriodSteps; /*!< \brief Time steps after which sliding interfaces repeat, 0 for no cache. */
+  string Interpolation_Cache_FileName;       /*!< \brief Prefix of the interpolation cache files, empty for no cache. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1033,9 +1117,25 @@ private:
   array<su2double,2> StressPenaltyParam = {{1.0, 20.0}}; /*!< \brief Allowed stress and KS aggregation exponent. */
   unsigned long Nonphys_Points,     /*!< \brief Current number of non-physical points in the solution. */
   Nonphys_Reconstr;                 /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
+  bool Lagged_Jacobian_Iter = false; /*!< \brief The current flow iteration does not assemble the edge Jacobian. */
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  PARMETIS_CONSTRAINT* ParMETIS_Constraints;  /*!< \brief Additional ParMETIS balance constraints. */
+  unsigned short nParMETIS_Constraints;       /*!< \brief Number of additional ParMETIS balance constraints. */
+  su2double ParMETIS_Constraint_Tolerance;    /*!< \brief Load balancing tolerance of the additional constraints. */
+  bool ParMETIS_Copartition;                  /*!< \brief Co-partition the interfaces of the zones. */
+  PARTITIONER Kind_Partitioner;               /*!< \brief Partitioner of the initial grid. */
+  bool Partitioner_Refinement;                /*!< \brief Refine the geometric partitioning with ParMETIS. */
+  bool Partition_Cache;             /*!< \brief Store and reuse the ParMETIS partitioning. */
+  string Partition_Cache_FileName;  /*!< \brief Prefix of the partition cache files. */
+  bool Load_Balance_Measure;        /*!< \brief Write ParMETIS weights based on the measured cost of the ranks. */
+  bool Load_Balance_Weights;        /*!< \brief Partition with the measured weights of a previous run. */
+  string Load_Balance_FileName;     /*!< \brief Prefix of the measured weights files. */
+  ADAPT_INDICATOR Kind_Adapt_Indicator; /*!< \brief Error indicator of the mesh adaptation. */
+  ADAPT_VARIABLE Kind_Adapt_Variable;   /*!< \brief Flow variable of the error indicator. */
+  su2double Adapt_Refine_Fraction;      /*!< \brief Fraction of the points marked for refinement. */
+  su2double Adapt_Coarsen_Fraction;     /*!< \brief Fraction of the points marked for coarsening. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1093,6 +1193,7 @@ private:
   su2double *Wall_Emissivity;          /*!< \brief Emissivity of the wall. */
   bool Radiation;                      /*!< \brief Determines if a radiation model is incorporated. */
   su2double CFL_Rad;                   /*!< \brief CFL Number for the radiation solver. */
+  unsigned long Rad_Freq;              /*!< \brief Number of flow iterations between radiation solves. */
 
   array<su2double,5> default_cfl_adapt;  /*!< \brief Default CFL adapt param array for the COption class. */
   su2double vel_init[3], /*!< \brief initial velocity array for the COption class. */
@@ -1128,11 +1229,20 @@ private:
   su2double Theta_Interior_Penalty_DGFEM;    /*!< \brief Factor for the symmetrizing terms in the DG discretization of the viscous fluxes. */
   unsigned short byteAlignmentMatMul;        /*!< \brief Number of bytes in the vectorization direction for the matrix multiplication. Multipe of 64. */
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
+  bool FEM_DG_GPU;                           /*!< \brief Whether or not to compute the DG-FEM volume residual on the GPU. */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
+  bool Comm_Overlap;                         /*!< \brief Overlap halo exchanges with interior computations. */
+  bool Comm_Progress_Thread;                 /*!< \brief Progress the overlapped halo exchanges with a dedicated thread. */
+  bool Persistent_MPI_Comms;                 /*!< \brief Use persistent requests for the halo exchanges. */
+  bool Shared_Memory_Comms;                  /*!< \brief Halo exchanges through shared memory between ranks of a node. */
+  bool Deferred_Res_Reduction;               /*!< \brief Reduce the residuals of all solvers of a zone with one collective. */
+  bool Halo_Single_Precision;                /*!< \brief Send the reconstruction-only halo data in single precision. */
+  bool Memory_Pool;                          /*!< \brief Keep released large buffers for reuse. */
+  bool Transparent_Huge_Pages;               /*!< \brief Back large buffers with transparent huge pages. */
   VERIFICATION_SOLUTION Kind_Verification_Solution; /*!< \brief Verification solution for accuracy assessment. */
 
   bool Time_Domain;              /*!< \brief Determines if the multizone problem is solved in time-domain */
@@ -1140,14 +1250,54 @@ private:
   nInnerIter,                    /*!< \brief Determines the number of inner iterations in each multizone block */
   nTimeIter,                     /*!< \brief Determines the number of time iterations in the multizone problem */
   nIter,                         /*!< \brief Determines the number of pseudo-time iterations in a single-zone problem */
-  Restart_Iter;                  /*!< \brief Determines the restart iteration in the multizone problem */
+  Restart_Iter,                  /*!< \brief Determines the restart iteration in the multizone problem */
+  ZoneUpdateFreq,                /*!< \brief Number of outer iterations between iterations of a zone */
+  Buddy_Checkpoint_Freq;         /*!< \brief Number of time iterations between in-memory (buddy) checkpoints */
+  string Buddy_Checkpoint_Dir;   /*!< \brief Node-local directory (e.g. tmpfs) where the buddy checkpoints are kept */
+  unsigned long Parareal_Slices,  /*!< \brief Number of time slices solved concurrently by the Parareal driver */
+  Parareal_Coarse_Factor,        /*!< \brief Ratio of the time steps of the coarse and fine Parareal propagators */
+  Parareal_Iter;                 /*!< \brief Maximum number of Parareal iterations */
+  su2double Parareal_Tol;        /*!< \brief Relative change of the start states of the slices that stops Parareal */
+  PRECICE_COUPLING Precice_Coupling; /*!< \brief Kind of coupling with other codes through preCICE. */
+  string Precice_Config_File,    /*!< \brief preCICE configuration file. */
+  Precice_Participant,           /*!< \brief Name of the preCICE participant. */
+  Precice_Mesh_Prefix;           /*!< \brief Prefix of the names of the preCICE meshes, one mesh per coupled marker. */
+  unsigned short nMarker_Precice = 0; /*!< \brief Number of markers coupled through preCICE. */
+  string* Marker_Precice = nullptr;   /*!< \brief Markers coupled through preCICE. */
   su2double Time_Step;           /*!< \brief Determines the time step for the multizone problem */
+  bool Time_Step_Extrapolation;  /*!< \brief Extrapolate the initial guess of each time step from the previous ones. */
   su2double Max_Time;            /*!< \brief Determines the maximum time for the time-domain problems */
 
   unsigned long HistoryWrtFreq[3],    /*!< \brief Array containing history writing frequencies for timer iter, outer iter, inner iter */
                 ScreenWrtFreq[3];     /*!< \brief Array containing screen writing frequencies for timer iter, outer iter, inner iter */
   OUTPUT_TYPE* VolumeOutputFiles;     /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles=0;/*!< \brief Number of File formats to output */
+  bool Async_Output;                  /*!< \brief Write the volume files in a background thread. */
+  bool Multiblock_Rank_Pieces;        /*!< \brief Write the volume data of multiblock files as one piece per rank. */
+  unsigned long MPIIO_CbNodes,        /*!< \brief Number of collective buffering aggregators of the MPI-IO (0 is the MPI default). */
+  MPIIO_StripeCount,                  /*!< \brief Number of stripes of the files written with MPI-IO (0 is the file system default). */
+  MPIIO_StripeSize,                   /*!< \brief Stripe size in bytes of the files written with MPI-IO (0 is the file system default). */
+  MPIIO_Subfiles;                     /*!< \brief Number of subfiles of the files written with MPI-IO (0 or 1 is one file). */
+  unsigned short XDMF_Compression;    /*!< \brief Deflate level of the HDF5 data of XDMF files (0 is uncompressed). */
+  int XDMF_Lossy_Digits;              /*!< \brief Decimal digits kept by the lossy compression of XDMF files (-1 is lossless). */
+  string ADIOS2_Engine;               /*!< \brief Engine of the ADIOS2 output stream. */
+  string ADIOS2_Config_File;          /*!< \brief ADIOS2 XML configuration file. */
+  unsigned short nSample_Probes = 0,  /*!< \brief Number of values of SAMPLE_PROBES. */
+  nSample_Lines = 0,                  /*!< \brief Number of values of SAMPLE_LINES. */
+  nSample_Planes = 0,                 /*!< \brief Number of values of SAMPLE_PLANES. */
+  nSample_Markers = 0,                /*!< \brief Number of sampled markers. */
+  nSample_Fields = 0;                 /*!< \brief Number of sampled fields. */
+  su2double *Sample_Probes = nullptr, /*!< \brief Coordinates of the sampled probes. */
+  *Sample_Lines = nullptr,            /*!< \brief End points and number of samples of the sampled lines. */
+  *Sample_Planes = nullptr;           /*!< \brief Origin, edges, and number of samples of the sampled planes. */
+  string *Sample_Markers = nullptr,   /*!< \brief Sampled markers. */
+  *Sample_Fields = nullptr;           /*!< \brief Sampled volume output fields. */
+  unsigned long Sample_Frequency;     /*!< \brief Iterations between samples. */
+  string Sample_FileName;             /*!< \brief Output file of the samples. */
+  unsigned short TimeStatistics_Phases;          /*!< \brief Number of phase bins of the phase averages. */
+  unsigned long TimeStatistics_Period;           /*!< \brief Period of the phase averages in time iterations. */
+  unsigned short nTimeStatistics_Frequencies = 0;  /*!< \brief Number of frequencies of the spectra. */
+  su2double *TimeStatistics_Frequencies = nullptr; /*!< \brief Frequencies of the spectra. */
   unsigned short nVolumeOutputFrequencies; /*!< \brief Number of frequencies for the volume outputs */
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
 
@@ -1172,10 +1322,13 @@ private:
   unsigned long pastix_fact_freq;  /*!< \brief (Re-)Factorization frequency for PaStiX */
   unsigned short pastix_verb_lvl;  /*!< \brief Verbosity level for PaStiX */
   unsigned short pastix_fill_lvl;  /*!< \brief Fill level for PaStiX ILU */
+  PASTIX_BLOCKS pastix_blocks;     /*!< \brief Parts of the matrix factorized by PaStiX. */
 
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  EDGE_COLORING Kind_EdgeColoring; /*!< \brief How the edges are grouped before they are colored. */
+  EDGE_FALLBACK Kind_EdgeFallback; /*!< \brief Strategy of the edge loops when the coloring efficiency is low. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1187,6 +1340,7 @@ private:
   POD_KIND POD_Basis_Gen;                   /*!< \brief Type of POD basis generation (static or incremental). */
   unsigned short maxBasisDim,               /*!< \brief Maximum number of POD basis dimensions. */
   rom_save_freq;                            /*!< \brief Frequency of unsteady time steps to save. */
+  ROM_ONLINE Kind_ROM_Online;               /*!< \brief Online use of the POD basis. */
 
   unsigned short nSpecies = 0;              /*!< \brief Number of transported species equations (for NEMO and species transport)*/
 
@@ -1199,6 +1353,7 @@ private:
   *Supercatalytic_Wall_Composition,         /*!< \brief Supercatalytic wall mass fractions [dimensionless]. */
   pnorm_heat;                               /*!< \brief pnorm for heat-flux. */
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
+  point_implicit_sources,                   /*!< \brief Flag for point-implicit NEMO sources with explicit schemes. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
   monoatomic,                               /*!< \brief Flag for monoatomic mixture. */
@@ -1212,6 +1367,7 @@ private:
 
   /*--- Additional species solver options ---*/
   bool Species_Clipping;           /*!< \brief Boolean that activates solution clipping for scalar transport. */
+  bool Species_Segregated_Solve;   /*!< \brief Solve the species one at a time with a shared scalar Jacobian. */
   su2double* Species_Clipping_Max; /*!< \brief Maximum value of clipping for scalar transport. */
   su2double* Species_Clipping_Min; /*!< \brief Minimum value of clipping for scalar transport. */
   unsigned short nSpecies_Clipping_Max, nSpecies_Clipping_Min; /*!< \brief Number of entries of SPECIES_CLIPPING_MIN/MAX */
@@ -1252,12 +1408,13 @@ private:
    to track the options which have not been set (so the default values can be used). Without this map
    there would be no list of all the config file options. ---*/
 
-  map<string, bool> all_options;
+  unordered_map<string, bool> all_options;
 
   /*--- brief param is a map from the option name (config file string) to its decoder (the specific child
-   class of COptionBase that turns the string into a value) ---*/
+   class of COptionBase that turns the string into a value). Both maps are hashed, they are built and
+   searched for every option of every zone, and the order of the options does not matter. ---*/
 
-  map<string, COptionBase*> option_map;
+  unordered_map<string, COptionBase*> option_map;
 
 
   // All of the addXxxOptions take in the name of the option, and a reference to the field of that option
@@ -2104,6 +2261,12 @@ public:
    */
   bool GetSpecies_Clipping() const { return Species_Clipping; }
 
+  /*!
+   * \brief Get the flag for solving the species one at a time, with one scalar Jacobian shared by all species.
+   * \return Flag for the segregated species solve.
+   */
+  bool GetSpecies_Segregated_Solve() const { return Species_Segregated_Solve; }
+
   /*!
    * \brief Get the maximum bound for scalar transport clipping
    * \return Maximum value for scalar clipping
@@ -2842,6 +3005,17 @@ public:
    */
   bool GetReorientElements(void) const { return ReorientElements; }
 
+  /*!
+   * \brief Get the kind of renumbering applied to the points of each rank.
+   */
+  POINT_ORDERING GetKind_Point_Ordering(void) const { return Kind_Point_Ordering; }
+
+  /*!
+   * \brief Get whether the wall distance is computed with the wall elements distributed over the ranks.
+   * \return <code>TRUE</code> if each rank only builds the ADT of its own wall elements.
+   */
+  bool GetDistributed_WallDistance(void) const { return Distributed_WallDistance; }
+
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
    * \return CFL number for unsteady simulations.
@@ -2964,6 +3138,43 @@ public:
    */
   unsigned short GetnTimeDOFsADER_DG(void) const { return nTimeDOFsADER_DG; }
 
+  /*!
+   * \brief Get the order of the BDF scheme of the implicit DG-FEM time integration.
+   * \return Order of the BDF scheme (1 or 2).
+   */
+  unsigned short GetnOrderBDF_DG(void) const { return nOrderBDF_DG; }
+
+  /*!
+   * \brief Get the maximum number of Newton iterations per time step of the implicit DG-FEM time integration.
+   * \return Maximum number of Newton iterations.
+   */
+  unsigned short GetnNewtonIter_DG(void) const { return nNewtonIter_DG; }
+
+  /*!
+   * \brief Get the relative reduction of the unsteady residual that ends the Newton iterations
+   *        of the implicit DG-FEM time integration.
+   * \return Relative tolerance of the Newton iterations.
+   */
+  su2double GetNewtonTol_DG(void) const { return NewtonTol_DG; }
+
+  /*!
+   * \brief Get the number of coarse polynomial levels of the p-multigrid cycle for steady DG-FEM computations.
+   * \return Number of coarse levels, 0 if the p-multigrid cycle is not used.
+   */
+  unsigned short GetnPMGLevels_DG(void) const { return nPMGLevels_DG; }
+
+  /*!
+   * \brief Get the number of pre-smoothing iterations on each level of the DG-FEM p-multigrid cycle.
+   * \return Number of pre-smoothing iterations.
+   */
+  unsigned short GetnPMGPreSmooth_DG(void) const { return nPMGPreSmooth_DG; }
+
+  /*!
+   * \brief Get the number of post-smoothing iterations on each level of the DG-FEM p-multigrid cycle.
+   * \return Number of post-smoothing iterations.
+   */
+  unsigned short GetnPMGPostSmooth_DG(void) const { return nPMGPostSmooth_DG; }
+
   /*!
    * \brief Get the location of the time DOFs for ADER-DG on the interval [-1..1].
    * \return The location of the time DOFs used in ADER-DG.
@@ -3150,6 +3361,23 @@ public:
    */
   unsigned long GetIter_Avg_Objective(void) const { return Iter_Avg_Objective ; }
 
+  /*!
+   * \brief Number of primal states the unsteady discrete adjoint keeps in memory, to recompute the
+   *        time steps for which there is no restart file. 0 means all restart files must exist.
+   */
+  unsigned short GetUnst_Adjoint_Checkpoints(void) const { return Unst_Adjoint_Checkpoints; }
+
+  /*!
+   * \brief Number of inner iterations used to recompute a primal time step in the unsteady adjoint.
+   */
+  unsigned long GetUnst_Adjoint_PrimalIter(void) const { return Unst_Adjoint_PrimalIter; }
+
+  /*!
+   * \brief Max error of the primal states kept in memory by the unsteady adjoint, relative to the
+   *        range of each variable. 0 means they are stored exactly.
+   */
+  su2double GetUnst_Adjoint_Checkpoint_Tol(void) const { return Unst_Adjoint_Checkpoint_Tol; }
+
   /*!
    * \brief Retrieves the number of periodic time instances for Harmonic Balance.
    * \return Number of periodic time instances for Harmonic Balance.
@@ -3228,6 +3456,18 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get information about timing the main phases of the solution process.
+   * \return <code>TRUE</code> means that the phase timers are recorded and reported at the end of a calculation.
+   */
+  bool GetWrt_Phase_Timers(void) const { return Wrt_Phase_Timers; }
+
+  /*!
+   * \brief Get the name of the file for the phase timers (Chrome trace format).
+   * \return Name of the file.
+   */
+  const string& GetPhase_Timers_FileName(void) const { return Phase_Timers_FileName; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3270,6 +3510,16 @@ public:
    */
   su2double Get_Alpha_RKStep(unsigned short val_step) const { return RK_Alpha_Step[val_step]; }
 
+  /*!
+   * \brief Get the number of Jacobi iterations of the implicit residual smoothing of explicit schemes (0 = off).
+   */
+  unsigned short GetResidual_Smoothing_Iter(void) const { return Residual_Smoothing_Iter; }
+
+  /*!
+   * \brief Get the coefficient (epsilon) of the implicit residual smoothing, (1 - epsilon Laplacian) R_smooth = R.
+   */
+  su2double GetResidual_Smoothing_Coeff(void) const { return Residual_Smoothing_Coeff; }
+
   /*!
    * \brief Get the index of the surface defined in the geometry file.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -3876,6 +4126,11 @@ public:
    */
   unsigned short GetNDataDriven_Files(void) const { return n_Datadriven_files; }
 
+  /*!
+   * \brief Get whether the look-up table is written in binary format (to <file>.bin) after loading it.
+   */
+  bool GetWrite_Binary_LUT(void) const { return Write_Binary_LUT; }
+
   /*!
    * \brief Get Newton solver relaxation factor for data-driven fluid models.
    * \return Newton solver relaxation factor.
@@ -3934,6 +4189,31 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Get whether the fluid model is evaluated by interpolation on a table built at startup.
+   */
+  bool GetTabulate_FluidModel(void) const { return Tabulate_FluidModel; }
+
+  /*!
+   * \brief Get the (dimensional) density range of the fluid table {min, max}.
+   */
+  const array<su2double,2>& GetTabulation_Density_Range(void) const { return Tabulation_Density_Range; }
+
+  /*!
+   * \brief Get the (dimensional) temperature range of the fluid table {min, max}.
+   */
+  const array<su2double,2>& GetTabulation_Temperature_Range(void) const { return Tabulation_Temperature_Range; }
+
+  /*!
+   * \brief Get the number of nodes of the fluid table in the density and energy directions.
+   */
+  const array<unsigned short,2>& GetTabulation_Size(void) const { return Tabulation_Size; }
+
+  /*!
+   * \brief Get the name of the file where the fluid table is cached (empty if it is not cached).
+   */
+  const string& GetTabulation_FileName(void) const { return Tabulation_FileName; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3952,6 +4232,13 @@ public:
    */
   CONDUCTIVITYMODEL GetKind_ConductivityModel() const { return Kind_ConductivityModel; }
 
+  /*!
+   * \brief Get the relative change of temperature and density below which the laminar viscosity and thermal
+   *        conductivity of a point are not evaluated again (compressible flow).
+   * \return Tolerance, 0 to evaluate the transport properties on every update.
+   */
+  su2double GetTransport_Properties_Tol() const { return Transport_Properties_Tol; }
+
   /*!
    * \brief Get the value of the turbulent thermal conductivity model.
    * \return Turbulent conductivity model.
@@ -4219,6 +4506,68 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get whether the thread-parallel ILU uses level scheduling (equivalent to single-thread ILU).
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Level_Scheduling; }
+
+  /*!
+   * \brief Get the number of layers of halo points included in the ILU preconditioner (restricted additive Schwarz).
+   * \return Overlap, 0 for no overlap (block-Jacobi across ranks).
+   */
+  unsigned short GetLinear_Solver_Schwarz_Overlap(void) const { return Linear_Solver_Schwarz_Overlap; }
+
+  /*!
+   * \brief Get whether the ILU preconditioner is combined with a coarse correction (one aggregate per rank).
+   */
+  bool GetLinear_Solver_Schwarz_Coarse(void) const { return Linear_Solver_Schwarz_Coarse; }
+
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Number of levels, including the fine one.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of smoothing sweeps of the AMG preconditioner.
+   * \return Number of pre and post smoothing sweeps on each level.
+   */
+  unsigned short GetLinear_Solver_AMG_Smooth(void) const { return Linear_Solver_AMG_Smooth; }
+
+  /*!
+   * \brief Get whether the AMG preconditioner of elasticity (structural and mesh deformation) systems is built
+   *        with the rigid body modes as near null space.
+   */
+  bool GetLinear_Solver_AMG_RigidBodyModes(void) const { return Linear_Solver_AMG_RigidBodyModes; }
+
+  /*!
+   * \brief Get the storage format used in the matrix-vector products of the linear solver.
+   * \return Format of the matrix.
+   */
+  MATRIX_FORMAT GetKind_Matrix_Format(void) const { return Kind_Matrix_Format; }
+
+  /*!
+   * \brief Check if a linear system (i.e. the system of a type of solver) should be solved in single precision.
+   * \param[in] system - Type of linear system.
+   * \return True if the Jacobian is copied to single precision to solve the system.
+   */
+  bool GetLinear_Solver_Single_Prec(LINEAR_SYSTEM system) const {
+    for (auto i = 0u; i < nLinear_Solver_Single_Prec; ++i)
+      if (Linear_Solver_Single_Prec[i] == system) return true;
+    return false;
+  }
+
+  /*!
+   * \brief Check if the matrix-vector products (and Jacobi preconditioner) of a type of linear system run on the GPU.
+   * \param[in] system - Type of linear system.
+   * \return True if the linear system is offloaded to the GPU.
+   */
+  bool GetLinear_Solver_GPU(LINEAR_SYSTEM system) const {
+    for (auto i = 0u; i < nLinear_Solver_GPU; ++i)
+      if (Linear_Solver_GPU[i] == system) return true;
+    return false;
+  }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -4247,6 +4596,23 @@ public:
    */
   unsigned short GetnQuasiNewtonSamples(void) const { return nQuasiNewtonSamples; }
 
+  /*!
+   * \brief Get the relative tolerance used to discard (almost) linearly dependent quasi-Newton samples.
+   * \return 0 if all samples are kept.
+   */
+  su2double GetQuasiNewtonFilterTol(void) const { return QuasiNewtonFilterTol; }
+
+  /*!
+   * \brief Get whether the steady primal fixed-point iterations are accelerated by the quasi-Newton method.
+   */
+  bool GetQuasiNewtonPrimal(void) const { return QuasiNewtonPrimal; }
+
+  /*!
+   * \brief Get the parameters of the primal quasi-Newton acceleration.
+   * \return {first accelerated iteration, increase of the residual (orders of magnitude) that resets the history}.
+   */
+  const array<su2double,2>& GetQuasiNewtonPrimalParam(void) const { return QuasiNewtonPrimalParam; }
+
   /*!
    * \brief Get whether to use vectorized numerics (if available).
    */
@@ -4267,6 +4633,16 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether the matrix-free products of the NK method use forward AD.
+   */
+  bool GetNewtonKrylovForwardAD(void) const { return NK_ForwardAD; }
+
+  /*!
+   * \brief Get whether the turbulence variables are solved together with the flow by the NK method.
+   */
+  bool GetNewtonKrylovCoupledTurb(void) const { return NK_CoupledTurb; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4345,6 +4721,49 @@ public:
    */
   unsigned long GetGridDef_Nonlinear_Iter(void) const { return GridDef_Nonlinear_Iter; }
 
+  /*!
+   * \brief Get the number of mesh deformation solves for which the stiffness matrix (and preconditioner) is reused.
+   * \return 0 means the stiffness matrix is assembled for every solve.
+   */
+  unsigned long GetDeform_Stiffness_Reuse(void) const { return Deform_Stiffness_Reuse; }
+
+  /*!
+   * \brief Get the displacement below which points are considered fixed when the dual grid is updated.
+   * \return 0 means all the metrics are recomputed after each deformation.
+   */
+  su2double GetDualGrid_UpdateTol(void) const { return DualGrid_UpdateTol; }
+
+  /*!
+   * \brief Get the number of previous mesh deformations used to predict the initial guess of the next one.
+   * \return 0 means cold starts, i.e. zero displacement away from the boundaries.
+   */
+  unsigned short GetDeform_Warm_Start(void) const { return Deform_Warm_Start; }
+
+  /*!
+   * \brief Get the method of volumetric mesh deformation.
+   */
+  DEFORM_METHOD GetDeform_Method(void) const { return Deform_Method; }
+
+  /*!
+   * \brief Get the radial basis function used by the RBF mesh deformation.
+   */
+  RADIAL_BASIS GetDeform_RBF_Function(void) const { return Deform_RBF_Function; }
+
+  /*!
+   * \brief Get the support radius of the RBF mesh deformation (0 means the size of the deforming region).
+   */
+  su2double GetDeform_RBF_Radius(void) const { return Deform_RBF_Radius; }
+
+  /*!
+   * \brief Get the tolerance (relative to the max. displacement) of the greedy selection of RBF points.
+   */
+  su2double GetDeform_RBF_Tolerance(void) const { return Deform_RBF_Tolerance; }
+
+  /*!
+   * \brief Get the maximum number of points selected for the RBF mesh deformation.
+   */
+  unsigned long GetDeform_RBF_Max_Points(void) const { return Deform_RBF_Max_Points; }
+
   /*!
    * \brief Get information about whether the mesh will be deformed using pseudo linear elasticity.
    * \return <code>TRUE</code> means that grid deformation is active.
@@ -4517,6 +4936,20 @@ public:
    */
   bool GetMUSCL_Flow(void) const { return MUSCL_Flow; }
 
+  /*!
+   * \brief Get if the vectorized edge loop of the flow solvers reads the reconstruction gradients and
+   *        limiters from a single precision copy (they are still computed in double precision).
+   * \return YES if the single precision copy is used.
+   */
+  bool GetMUSCL_Flow_Single_Prec(void) const { return MUSCL_Flow_Single_Prec; }
+
+  /*!
+   * \brief Get if the vectorized edge loop of the flow solvers reads the node indices, normals, and i-j vectors
+   *        of the edges from a copy stored in loop order.
+   * \return YES if the edge geometry cache is used.
+   */
+  bool GetEdgeGeometryCache(void) const { return Edge_Geometry_Cache; }
+
   /*!
    * \brief Get if the upwind scheme used MUSCL or not.
    * \note This is the information that the code will use, the method will
@@ -4574,6 +5007,23 @@ public:
    */
   unsigned short GetKind_TimeIntScheme_Flow(void) const { return Kind_TimeIntScheme_Flow; }
 
+  /*!
+   * \brief Get the linearly implicit (Rosenbrock) variant of the implicit time integration of time-accurate flows.
+   */
+  ROSENBROCK_SCHEME GetKind_Rosenbrock(void) const { return Kind_Rosenbrock; }
+
+  /*!
+   * \brief Get the number of iterations between assemblies of the Jacobian of the (vectorized) edge loop of the
+   *        compressible flow solvers, the edge loop only computes residuals in between.
+   * \return 1 if the Jacobian is assembled every iteration.
+   */
+  unsigned short GetJacobian_Lag(void) const { return Jacobian_Lag; }
+
+  /*!
+   * \brief Get the factor by which the average CFL can change before the lagged Jacobian is assembled again.
+   */
+  su2double GetJacobian_Lag_CFL_Factor(void) const { return Jacobian_Lag_CFL_Factor; }
+
   /*!
    * \brief Get the kind of scheme (aliased or non-aliased) to be used in the
    *        predictor step of ADER-DG.
@@ -4635,6 +5085,38 @@ public:
    */
   STRUCT_SPACE_ITE GetKind_SpaceIteScheme_FEA(void) const { return Kind_SpaceIteScheme_FEA; }
 
+  /*!
+   * \brief Get the maximum number of iterations for which the tangent stiffness matrix of the modified
+   *        Newton-Raphson and BFGS methods is kept (also across time steps), 0 to update it every time step.
+   */
+  unsigned long GetFEA_Tangent_Reuse(void) const { return FEA_Tangent_Reuse; }
+
+  /*!
+   * \brief Get the ratio between consecutive residual norms above which the tangent stiffness matrix
+   *        of the modified Newton-Raphson and BFGS methods is updated.
+   */
+  su2double GetFEA_Tangent_Refresh(void) const { return FEA_Tangent_Refresh; }
+
+  /*!
+   * \brief Check if linear structures are solved by superposition of their modes (reduced order model).
+   */
+  bool GetModal_Superposition(void) const { return Modal_Superposition; }
+
+  /*!
+   * \brief Get the number of structural modes used by the modal superposition.
+   */
+  unsigned short GetnModes_FEA(void) const { return nModes_FEA; }
+
+  /*!
+   * \brief Get the damping ratio (w.r.t. critical damping) of the structural modes.
+   */
+  su2double GetModal_Damping(void) const { return Modal_Damping; }
+
+  /*!
+   * \brief Get the name of the file with the structural modes, read if it exists, otherwise written.
+   */
+  const string& GetModal_FileName(void) const { return Modal_FileName; }
+
   /*!
    * \brief Get the kind of convective numerical scheme for the flow
    *        equations (centered or upwind).
@@ -4734,6 +5216,12 @@ public:
    */
   LIMITER GetKind_SlopeLimit_Species() const { return Kind_SlopeLimit_Species; }
 
+  /*!
+   * \brief Get the method for limiting the spatial gradients.
+   * \return Method for limiting the spatial gradients solving the heat equation.
+   */
+  LIMITER GetKind_SlopeLimit_Heat() const { return Kind_SlopeLimit_Heat; }
+
   /*!
    * \brief Get the method for limiting the spatial gradients.
    * \return Method for limiting the spatial gradients solving the adjoint turbulent equation.
@@ -4974,6 +5462,35 @@ public:
    */
   bool GetInconsistent_Disc(void) const { return Inconsistent_Disc; }
 
+  /*!
+   * \brief Whether the multizone discrete adjoint records the solution and the mesh coordinates as inputs
+   *        of one tape, used for the objective function gradient, the adjoint iterations, and the sensitivities.
+   */
+  bool GetCombined_Recording_Disc(void) const { return Combined_Recording_Disc; }
+
+  /*!
+   * \brief Whether the discrete adjoint uses the hand-differentiated JST flux (external function of the tape)
+   *        instead of recording the edge loop, where applicable (see CEulerSolver::Centered_Residual).
+   */
+  bool GetAdjoint_Flux_Kernel_Disc(void) const { return Adjoint_Flux_Kernel_Disc; }
+
+  /*!
+   * \brief Whether the single-zone discrete adjoint treats each OBJECTIVE_FUNCTION as a separate objective,
+   *        all adjoints are solved with one recording of the primal iteration instead of one run per objective.
+   */
+  bool GetBatch_Objectives_Disc(void) const { return Batch_Objectives_Disc; }
+
+  /*!
+   * \brief Set the objective that a batched discrete adjoint is solving for (-1 for the combined objective),
+   *        it determines the extension of the adjoint filenames.
+   */
+  void SetBatch_ObjFunc(short val_obj) { Batch_ObjFunc = val_obj; }
+
+  /*!
+   * \brief Get the objective that a batched discrete adjoint is solving for (-1 for the combined objective).
+   */
+  short GetBatch_ObjFunc(void) const { return Batch_ObjFunc; }
+
   /*!
    * \brief Provides information about the way in which the limiter will be treated by the
    *        disc. adjoint method.
@@ -5424,6 +5941,28 @@ public:
    */
   bool GetWrt_Restart_Overwrite(void) const { return Wrt_Restart_Overwrite; }
 
+  /*!
+   * \brief Flag for whether binary restart files are read by mapping them into memory (instead of MPI I/O).
+   */
+  bool GetRead_Restart_MMap(void) const { return Read_Restart_MMap; }
+
+  /*!
+   * \brief Flag for whether the mesh files of the next zones, and the restart files, are read in the background
+   *        (into the page cache) while the zones are preprocessed.
+   */
+  bool GetPrefetch_Input_Files(void) const { return Prefetch_Input_Files; }
+
+  /*!
+   * \brief Flag for whether the unsteady binary restarts are written to, and read from, a single time series file.
+   * \return <code>TRUE</code> for time dependent problems with RESTART_TIME_SERIES=YES.
+   */
+  bool GetRestart_Time_Series(void) const { return Restart_Time_Series && Time_Domain; }
+
+  /*!
+   * \brief Get the number of steps between the full frames of restart time series (the others are deltas).
+   */
+  unsigned long GetRestart_KeyFrame_Interval(void) const { return Restart_KeyFrame_Interval; }
+
     /*!
    * \brief Flag for whether visualization files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -5467,6 +6006,12 @@ public:
    */
   bool GetFrozen(void) const { return frozen; }
 
+  /*!
+   * \brief Indicates whether the NEMO chemistry and vib. relaxation sources are treated point-implicitly
+   *        by the explicit time integration schemes.
+   */
+  bool GetPointImplicit_Sources(void) const { return point_implicit_sources; }
+
   /*!
    * \brief Indicates whether electron gas is present in the gas mixture.
    */
@@ -5524,6 +6069,25 @@ public:
    */
   string GetSolution_FileName(void) const { return Solution_FileName; }
 
+  /*!
+   * \brief Set the name of the file with the solution of the flow problem (SU2_SOL batch mode).
+   * \param[in] filename - Name of the solution file.
+   */
+  void SetSolution_FileName(string filename) { Solution_FileName = std::move(filename); }
+
+  /*!
+   * \brief Get the number of solution files that SU2_SOL converts in one run.
+   * \return Number of files, 0 if only SOLUTION_FILENAME is converted.
+   */
+  unsigned short GetnSol_Batch_Files(void) const { return nSol_Batch_Files; }
+
+  /*!
+   * \brief Get the name of one of the solution files that SU2_SOL converts in one run.
+   * \param[in] iFile - Index of the file.
+   * \return Name of the solution file.
+   */
+  const string& GetSol_Batch_FileName(unsigned short iFile) const { return Sol_Batch_FileNames[iFile]; }
+
   /*!
    * \brief Get the name of the file with the solution of the adjoint flow problem
    *          with drag objective function.
@@ -5538,6 +6102,18 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (SU2 or SU2_BINARY).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
+  /*!
+   * \brief Check if CGNS meshes are read with collective parallel I/O.
+   * \return <code>TRUE</code> if the parallel CGNS (HDF5) API is used.
+   */
+  bool GetCGNS_ParallelRead(void) const { return CGNS_ParallelRead; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -5587,6 +6163,12 @@ public:
    */
   string GetVolume_FileName(void) const { return Volume_FileName; }
 
+  /*!
+   * \brief Set the name of the file with the flow variables (SU2_SOL batch mode).
+   * \param[in] filename - Name of the volume output file.
+   */
+  void SetVolume_FileName(string filename) { Volume_FileName = std::move(filename); }
+
   /*!
    * \brief Add any numbers necessary to the filename (iteration number, zone ID ...)
    * \param[in] filename - the base filename.
@@ -5673,6 +6255,12 @@ public:
    */
   string GetSurfCoeff_FileName(void) const { return SurfCoeff_FileName; }
 
+  /*!
+   * \brief Set the name of the file with the flow variables on the surface (SU2_SOL batch mode).
+   * \param[in] filename - Name of the surface output file.
+   */
+  void SetSurfCoeff_FileName(string filename) { SurfCoeff_FileName = std::move(filename); }
+
   /*!
    * \brief Get the name of the file with the surface information for the adjoint problem.
    * \return Name of the file with the surface information for the adjoint problem.
@@ -5707,6 +6295,13 @@ public:
    */
   string GetObjFunc_Extension(string val_filename) const;
 
+  /*!
+   * \brief Get the objective function extension of the adjoint filenames (e.g. "_cd", "_combo").
+   * \note For a batched adjoint this is the extension of the current objective, with its index if the
+   *       same kind of objective is listed more than once.
+   */
+  string GetObjFunc_Suffix() const;
+
   /*!
    * \brief Get functional that is going to be used to evaluate the residual flow convergence.
    * \return Functional that is going to be used to evaluate the residual flow convergence.
@@ -5867,6 +6462,12 @@ public:
    */
   unsigned short GetKind_GridMovement() const { return Kind_GridMovement; }
 
+  /*!
+   * \brief Get whether rigid motions rotate the normals of the dual grid instead of recomputing its metrics.
+   * \return <code>TRUE</code> if the metrics are transformed.
+   */
+  bool GetRigidMotion_TransformMetrics() const { return RigidMotion_TransformMetrics; }
+
   /*!
    * \brief Set the type of dynamic mesh motion.
    * \param[in] motion_Type - Specify motion type.
@@ -6474,6 +7075,12 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void) const { return Damp_Correc_Prolong; }
 
+  /*!
+   * \brief Get whether the Jacobians of the coarse multigrid levels are formed algebraically (R*A*P).
+   * \return <code>TRUE</code> if the coarse levels do not assemble their own Jacobian.
+   */
+  bool GetMG_GalerkinJacobian(void) const { return MG_GalerkinJacobian; }
+
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -8708,6 +9315,17 @@ public:
    */
   unsigned long GetNonphysical_Points(void) const { return Nonphys_Points; }
 
+  /*!
+   * \brief Set whether the current flow iteration lags the edge Jacobian (see GetJacobian_Lag).
+   * \param[in] lagged - True if the edge loop only computes residuals.
+   */
+  void SetLagged_Jacobian_Iter(bool lagged) { Lagged_Jacobian_Iter = lagged; }
+
+  /*!
+   * \brief Get whether the current flow iteration lags the edge Jacobian, the flux kernels then skip the Jacobians.
+   */
+  bool GetLagged_Jacobian_Iter(void) const { return Lagged_Jacobian_Iter; }
+
   /*!
    * \brief Set the current number of non-physical reconstructions for 2nd-order upwinding.
    * \param[in] val_nonphys_reconstr - current number of non-physical reconstructions for 2nd-order upwinding.
@@ -9087,6 +9705,13 @@ public:
    */
   unsigned short GetSizeMatMulPadding(void) const { return sizeMatMulPadding; }
 
+  /*!
+   * \brief Function to make available whether or not the volume residual of
+            the DG-FEM solver is computed on the GPU.
+   * \return True if the CUDA backend is used.
+   */
+  bool GetFEM_DG_GPU(void) const { return FEM_DG_GPU; }
+
   /*!
    * \brief Function to make available whether or not the entropy must be computed.
    * \return The boolean whether or not the entropy must be computed.
@@ -9137,6 +9762,23 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the number of donor points of the local RBF patch of each target point (0 for a global RBF).
+   */
+  unsigned short GetRadialBasisFunctionLocalPoints(void) const { return RadialBasisFunction_LocalPoints; }
+
+  /*!
+   * \brief Get the number of time steps after which the relative position of sliding interfaces repeats.
+   * \return Period in time steps, 0 if the sliding mesh coefficients should not be cached.
+   */
+  unsigned long GetSlidingInterfacePeriodSteps(void) const { return SlidingInterface_PeriodSteps; }
+
+  /*!
+   * \brief Get the prefix of the files where the interface interpolation coefficients are cached.
+   * \return File name prefix, empty if the coefficients should not be cached.
+   */
+  const string& GetInterpolation_Cache_FileName(void) const { return Interpolation_Cache_FileName; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9334,12 +9976,24 @@ public:
    */
   bool GetTime_Domain(void) const { return Time_Domain; }
 
+  /*!
+   * \brief Check if the inner iterations of a time step start from an extrapolation of the previous time levels.
+   * \return YES if the initial guess is extrapolated.
+   */
+  bool GetTime_Step_Extrapolation(void) const { return Time_Step_Extrapolation; }
+
   /*!
    * \brief Get the number of inner iterations
    * \return Number of inner iterations on each multizone block
    */
   unsigned long GetnInner_Iter(void) const { return nInnerIter; }
 
+  /*!
+   * \brief Get the number of outer iterations between two iterations of the zone (lagged zones).
+   * \return The zone is iterated (and receives interface data) when OuterIter is a multiple of this value.
+   */
+  unsigned long GetZoneUpdateFreq(void) const { return ZoneUpdateFreq; }
+
   /*!
    * \brief Get the number of outer iterations
    * \return Number of outer iterations for the multizone problem
@@ -9364,6 +10018,70 @@ public:
    */
   unsigned long GetRestart_Iter(void) const { return Restart_Iter; }
 
+  /*!
+   * \brief Get the number of time iterations between in-memory (buddy) checkpoints.
+   * \return Checkpoint frequency, 0 if disabled.
+   */
+  unsigned long GetBuddy_Checkpoint_Freq(void) const { return Buddy_Checkpoint_Freq; }
+
+  /*!
+   * \brief Get the node-local directory where the buddy checkpoints are kept.
+   * \return Directory name.
+   */
+  const string& GetBuddy_Checkpoint_Dir(void) const { return Buddy_Checkpoint_Dir; }
+
+  /*!
+   * \brief Get the number of time slices of the parallel-in-time (Parareal) driver.
+   * \return Number of slices, 1 if the driver is not used.
+   */
+  unsigned long GetParareal_Slices(void) const { return Parareal_Slices; }
+
+  /*!
+   * \brief Get the ratio of the time steps of the coarse and fine Parareal propagators.
+   */
+  unsigned long GetParareal_Coarse_Factor(void) const { return Parareal_Coarse_Factor; }
+
+  /*!
+   * \brief Get the maximum number of Parareal iterations.
+   */
+  unsigned long GetParareal_Iter(void) const { return Parareal_Iter; }
+
+  /*!
+   * \brief Get the relative change of the start states of the slices at which Parareal stops.
+   */
+  su2double GetParareal_Tol(void) const { return Parareal_Tol; }
+
+  /*!
+   * \brief Get the kind of coupling with other codes through preCICE.
+   */
+  PRECICE_COUPLING GetPrecice_Coupling(void) const { return Precice_Coupling; }
+
+  /*!
+   * \brief Get the name of the preCICE configuration file.
+   */
+  const string& GetPrecice_Config_File(void) const { return Precice_Config_File; }
+
+  /*!
+   * \brief Get the name of SU2 as a preCICE participant.
+   */
+  const string& GetPrecice_Participant(void) const { return Precice_Participant; }
+
+  /*!
+   * \brief Get the prefix of the names of the preCICE meshes, the name of a mesh is "<prefix>-<marker tag>".
+   */
+  const string& GetPrecice_Mesh_Prefix(void) const { return Precice_Mesh_Prefix; }
+
+  /*!
+   * \brief Get the number of markers coupled through preCICE.
+   */
+  unsigned short GetnMarker_Precice(void) const { return nMarker_Precice; }
+
+  /*!
+   * \brief Get the tag of a marker coupled through preCICE.
+   * \param[in] val_marker - Index of the marker in MARKER_PRECICE.
+   */
+  const string& GetMarker_Precice(unsigned short val_marker) const { return Marker_Precice[val_marker]; }
+
   /*!
    * \brief Get the time step for multizone problems
    * \return Time step for multizone problems, it is set on all the zones
@@ -9382,6 +10100,48 @@ public:
    */
   unsigned short GetComm_Level(void) const { return Comm_Level; }
 
+  /*!
+   * \brief Get whether halo exchanges should be overlapped with interior computations.
+   * \return YES if the edges of the residual loops are split into interior and halo-adjacent sets.
+   */
+  bool GetComm_Overlap(void) const { return Comm_Overlap; }
+
+  /*!
+   * \brief Get whether a dedicated thread progresses (and unpacks) the overlapped halo exchanges.
+   * \return YES if the thread is requested, only used together with COMM_OVERLAP.
+   */
+  bool GetComm_Progress_Thread(void) const { return Comm_Progress_Thread; }
+
+  /*!
+   * \brief Get whether the point-to-point (halo) comms use persistent MPI requests.
+   */
+  bool GetPersistent_MPI_Comms(void) const { return Persistent_MPI_Comms; }
+
+  /*!
+   * \brief Get whether the point-to-point (halo) comms between ranks of the same node use MPI shared memory.
+   */
+  bool GetShared_Memory_Comms(void) const { return Shared_Memory_Comms; }
+
+  /*!
+   * \brief Get whether the residual reductions of the solvers of a zone are packed into one non-blocking collective.
+   */
+  bool GetDeferred_Res_Reduction(void) const { return Deferred_Res_Reduction; }
+
+  /*!
+   * \brief Get whether the halo exchanges of gradients, limiters, and sensors (reconstruction only) use single precision.
+   */
+  bool GetHalo_Single_Precision(void) const { return Halo_Single_Precision; }
+
+  /*!
+   * \brief Get whether large released buffers are kept for reuse (see MemoryAllocation::CLargeBufferPool).
+   */
+  bool GetMemory_Pool(void) const { return Memory_Pool; }
+
+  /*!
+   * \brief Get whether large buffers are backed by transparent huge pages (see MemoryAllocation::CLargeBufferPool).
+   */
+  bool GetTransparent_Huge_Pages(void) const { return Transparent_Huge_Pages; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9438,6 +10198,12 @@ public:
    */
   su2double GetCFL_Rad(void) const { return CFL_Rad; }
 
+  /*!
+   * \brief Get the number of flow iterations between solves of the radiation equation.
+   * \return Radiation solve frequency, the source term is updated every iteration.
+   */
+  unsigned long GetRad_Freq(void) const { return Rad_Freq; }
+
   /*!
    * \brief Determines if radiation needs to be incorporated to the analysis.
    * \return Radiation boolean
@@ -9486,6 +10252,26 @@ public:
    */
   su2double GetMeshBoxOffset(unsigned short val_iDim) const { return mesh_box_offset[val_iDim]; }
 
+  /*!
+   * \brief Get the kind of elements of the SYNTHETIC grid.
+   */
+  SYNTHETIC_MESH_ELEM GetSyntheticMesh_Elements() const { return SyntheticMesh_Elements; }
+
+  /*!
+   * \brief Get the shape of the SYNTHETIC grid.
+   */
+  SYNTHETIC_MESH_GEOM GetSyntheticMesh_Geometry() const { return SyntheticMesh_Geometry; }
+
+  /*!
+   * \brief Get the number of cell layers of prisms above y_minus of the HYBRID SYNTHETIC grid.
+   */
+  unsigned short GetSyntheticMesh_Layers() const { return SyntheticMesh_Layers; }
+
+  /*!
+   * \brief Get the ratio between consecutive spacings in y (from y_minus) of the SYNTHETIC grid.
+   */
+  su2double GetSyntheticMesh_Growth() const { return SyntheticMesh_Growth; }
+
   /*!
    * \brief Get the number of screen output variables requested (maximum 6)
    */
@@ -9617,6 +10403,130 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Check if the volume files are written asynchronously (in a background thread).
+   */
+  bool GetAsync_Output() const { return Async_Output; }
+
+  /*!
+   * \brief Check if each rank writes its own piece (.vtu) of the volume data of PARAVIEW_MULTIBLOCK files.
+   */
+  bool GetMultiblock_Rank_Pieces() const { return Multiblock_Rank_Pieces; }
+
+  /*!
+   * \brief Get the number of collective buffering aggregators of the MPI-IO writes (0 leaves it to MPI).
+   */
+  unsigned long GetMPIIO_CbNodes() const { return MPIIO_CbNodes; }
+
+  /*!
+   * \brief Get the number of stripes of the files written with MPI-IO (0 leaves it to the file system).
+   */
+  unsigned long GetMPIIO_StripeCount() const { return MPIIO_StripeCount; }
+
+  /*!
+   * \brief Get the stripe size in bytes of the files written with MPI-IO (0 leaves it to the file system).
+   */
+  unsigned long GetMPIIO_StripeSize() const { return MPIIO_StripeSize; }
+
+  /*!
+   * \brief Get the number of subfiles in which the files written with MPI-IO are split (0 or 1 for one file).
+   */
+  unsigned long GetMPIIO_Subfiles() const { return MPIIO_Subfiles; }
+
+  /*!
+   * \brief Get the deflate (gzip) level used for the HDF5 data of XDMF files, 0 means no compression.
+   */
+  unsigned short GetXDMF_Compression() const { return XDMF_Compression; }
+
+  /*!
+   * \brief Get the number of decimal digits kept by the lossy (scale-offset) compression of the fields
+   *        of XDMF files, a negative value means lossless output.
+   */
+  int GetXDMF_Lossy_Digits() const { return XDMF_Lossy_Digits; }
+
+  /*!
+   * \brief Get the engine of the ADIOS2 output stream (BP4, BP5, SST, ...).
+   */
+  const string& GetADIOS2_Engine() const { return ADIOS2_Engine; }
+
+  /*!
+   * \brief Get the ADIOS2 XML configuration file (empty if not used), it takes precedence over ADIOS2_ENGINE.
+   */
+  const string& GetADIOS2_Config_File() const { return ADIOS2_Config_File; }
+
+  /*!
+   * \brief Get the values of SAMPLE_PROBES (nDim coordinates per probe).
+   * \param[out] nValues - Number of values.
+   */
+  const su2double* GetSample_Probes(unsigned short& nValues) const { nValues = nSample_Probes; return Sample_Probes; }
+
+  /*!
+   * \brief Get the values of SAMPLE_LINES (start point, end point, and number of samples per line).
+   * \param[out] nValues - Number of values.
+   */
+  const su2double* GetSample_Lines(unsigned short& nValues) const { nValues = nSample_Lines; return Sample_Lines; }
+
+  /*!
+   * \brief Get the values of SAMPLE_PLANES (origin, two edge vectors, and number of samples along each edge per plane).
+   * \param[out] nValues - Number of values.
+   */
+  const su2double* GetSample_Planes(unsigned short& nValues) const { nValues = nSample_Planes; return Sample_Planes; }
+
+  /*!
+   * \brief Get the number of markers whose vertices are sampled.
+   */
+  unsigned short GetnSample_Markers() const { return nSample_Markers; }
+
+  /*!
+   * \brief Get the name of a sampled marker.
+   */
+  const string& GetSample_Marker(unsigned short iMarker) const { return Sample_Markers[iMarker]; }
+
+  /*!
+   * \brief Get the number of sampled volume output fields.
+   */
+  unsigned short GetnSample_Fields() const { return nSample_Fields; }
+
+  /*!
+   * \brief Get the name of a sampled volume output field.
+   */
+  const string& GetSample_Field(unsigned short iField) const { return Sample_Fields[iField]; }
+
+  /*!
+   * \brief Get the number of iterations between samples.
+   */
+  unsigned long GetSample_Frequency() const { return Sample_Frequency; }
+
+  /*!
+   * \brief Get the name of the output file of the samples.
+   */
+  const string& GetSample_FileName() const { return Sample_FileName; }
+
+  /*!
+   * \brief Whether probes, lines, planes, or markers are sampled.
+   */
+  bool GetSampling() const { return nSample_Probes + nSample_Lines + nSample_Planes + nSample_Markers > 0; }
+
+  /*!
+   * \brief Get the number of phase bins of the phase averaged volume output.
+   */
+  unsigned short GetTimeStatistics_Phases() const { return TimeStatistics_Phases; }
+
+  /*!
+   * \brief Get the period of the phase averages in time iterations.
+   */
+  unsigned long GetTimeStatistics_Period() const { return TimeStatistics_Period; }
+
+  /*!
+   * \brief Get the number of frequencies of the spectrum volume output.
+   */
+  unsigned short GetnTimeStatistics_Frequencies() const { return nTimeStatistics_Frequencies; }
+
+  /*!
+   * \brief Get a frequency of the spectrum volume output.
+   */
+  su2double GetTimeStatistics_Frequency(unsigned short iFreq) const { return TimeStatistics_Frequencies[iFreq]; }
+
   /*!
    * \brief GetVolumeOutputFrequency
    * \param[in] iFile: index of file number for which the writing frequency needs to be returned.
@@ -9641,6 +10551,12 @@ public:
    */
   unsigned short GetPastixFillLvl(void) const { return pastix_fill_lvl; }
 
+  /*!
+   * \brief Get the parts of the matrix factorized by PaStiX.
+   * \return GLOBAL - whole matrix, RANK or NODE - diagonal blocks of each rank or node (block-Jacobi).
+   */
+  PASTIX_BLOCKS GetPastixBlocks(void) const { return pastix_blocks; }
+
   /*!
    * \brief Check if an option is present in the config file
    * \param[in] - Name of the option
@@ -9660,11 +10576,46 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get the maximum number of linear solves for which the preconditioner is reused (0 means rebuild every time).
+   */
+  unsigned long GetLinear_Solver_Prec_Reuse(void) const { return Linear_Solver_Prec_Reuse; }
+
+  /*!
+   * \brief Get the growth factor of linear iterations, w.r.t. the first solve after a build, that forces a rebuild.
+   */
+  su2double GetLinear_Solver_Prec_Reuse_Growth(void) const { return Linear_Solver_Prec_Reuse_Growth; }
+
+  /*!
+   * \brief Get the number of directions that RECYCLED_FGMRES keeps between the solves of a linear system.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
+  /*!
+   * \brief Get how the tolerance of the (flow, turbulence, etc.) linear solvers is chosen for each solve.
+   */
+  LINEAR_SOLVER_FORCING GetKind_Linear_Solver_Forcing(void) const { return Kind_Linear_Solver_Forcing; }
+
+  /*!
+   * \brief Get the parameters of the Eisenstat-Walker forcing term (gamma, alpha, maximum tolerance).
+   */
+  const array<su2double,3>& GetLinear_Solver_Forcing_Param(void) const { return Linear_Solver_Forcing_Param; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get how the edges are grouped before they are colored for the thread-parallel edge loops.
+   */
+  EDGE_COLORING GetEdgeColoringMethod(void) const { return Kind_EdgeColoring; }
+
+  /*!
+   * \brief Get the strategy of the thread-parallel edge loops when the coloring efficiency is low.
+   */
+  EDGE_FALLBACK GetEdgeColoringFallback(void) const { return Kind_EdgeFallback; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9680,6 +10631,81 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Check if an additional ParMETIS balance constraint is used.
+   */
+  bool GetParMETIS_Constraint(PARMETIS_CONSTRAINT constraint) const {
+    for (unsigned short i = 0; i < nParMETIS_Constraints; ++i)
+      if (ParMETIS_Constraints[i] == constraint) return true;
+    return false;
+  }
+
+  /*!
+   * \brief Get the load balancing tolerance of the additional ParMETIS constraints.
+   */
+  passivedouble GetParMETIS_Constraint_Tolerance() const { return SU2_TYPE::GetValue(ParMETIS_Constraint_Tolerance); }
+
+  /*!
+   * \brief Check if the interface points of each zone are placed on the ranks of the coupled points of the
+   *        previous zones.
+   */
+  bool GetParMETIS_Copartition() const { return ParMETIS_Copartition; }
+
+  /*!
+   * \brief Get the partitioner of the initial grid.
+   */
+  PARTITIONER GetKind_Partitioner() const { return Kind_Partitioner; }
+
+  /*!
+   * \brief Check if a geometric partitioning is refined by ParMETIS (adaptive repartitioning).
+   */
+  bool GetPartitioner_Refinement() const { return Partitioner_Refinement; }
+
+  /*!
+   * \brief Check if the ParMETIS partitioning is stored and reused by later runs.
+   */
+  bool GetPartition_Cache() const { return Partition_Cache; }
+
+  /*!
+   * \brief Get the prefix of the partition cache files.
+   */
+  const string& GetPartition_Cache_FileName() const { return Partition_Cache_FileName; }
+
+  /*!
+   * \brief Check if the cost of the ranks is measured to write ParMETIS weights for later runs.
+   */
+  bool GetLoad_Balance_Measure() const { return Load_Balance_Measure; }
+
+  /*!
+   * \brief Check if the grid is partitioned with the measured weights of a previous run.
+   */
+  bool GetLoad_Balance_Weights() const { return Load_Balance_Weights; }
+
+  /*!
+   * \brief Get the prefix of the measured weights files.
+   */
+  const string& GetLoad_Balance_FileName() const { return Load_Balance_FileName; }
+
+  /*!
+   * \brief Get the error indicator used to mark the points for mesh adaptation.
+   */
+  ADAPT_INDICATOR GetKind_Adapt_Indicator() const { return Kind_Adapt_Indicator; }
+
+  /*!
+   * \brief Get the flow variable on which the mesh adaptation indicator is computed.
+   */
+  ADAPT_VARIABLE GetKind_Adapt_Variable() const { return Kind_Adapt_Variable; }
+
+  /*!
+   * \brief Get the fraction of the points (largest indicator) marked for refinement.
+   */
+  passivedouble GetAdapt_Refine_Fraction() const { return SU2_TYPE::GetValue(Adapt_Refine_Fraction); }
+
+  /*!
+   * \brief Get the fraction of the points (smallest indicator) marked for coarsening.
+   */
+  passivedouble GetAdapt_Coarsen_Fraction() const { return SU2_TYPE::GetValue(Adapt_Coarsen_Fraction); }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -9717,6 +10743,12 @@ public:
    */
   unsigned short GetRom_SaveFreq(void) const { return rom_save_freq; }
 
+  /*!
+   * \brief Get how the POD basis read from LIBROM_BASE_FILENAME is used online.
+   * \return Online use of the POD basis.
+   */
+  ROM_ONLINE GetKind_ROM_Online(void) const { return Kind_ROM_Online; }
+
   /*!
    * \brief Check if the gradient smoothing is active
    * \return true means that smoothing is applied to the sensitivities
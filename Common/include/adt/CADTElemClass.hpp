@@ -31,6 +31,8 @@
 #include "./CBBoxTargetClass.hpp"
 #include "../parallelization/omp_structure.hpp"
 
+#include <limits>
+
 /*!
  * \class CADTElemClass
  * \ingroup ADT
@@ -41,6 +43,7 @@
 class CADTElemClass : public CADTBaseClass {
  private:
   unsigned short nDim; /*!< \brief Number of spatial dimensions. */
+  bool isGlobal;       /*!< \brief Whether the ADT contains the elements of all ranks. */
 
   vector<su2double> coorPoints; /*!< \brief Vector, which contains the coordinates
                                             of the points in the ADT. */
@@ -84,6 +87,20 @@ class CADTElemClass : public CADTBaseClass {
                 vector<unsigned short>& val_VTKElem, vector<unsigned short>& val_markerID,
                 vector<unsigned long>& val_elemID, const bool globalTree);
 
+  /*!
+   * \brief Function, which returns whether or not the ADT contains the elements of all ranks.
+   * \return  True for a global tree, or in sequential mode, false for a local tree.
+   */
+  inline bool IsGlobal() const { return isGlobal; }
+
+  /*!
+   * \brief Function, which determines the bounding box of all the elements in the ADT.
+   * \note For an empty ADT the minimum coordinates are larger than the maximum ones.
+   * \param[out] coorMin  Minimum coordinates of the bounding box.
+   * \param[out] coorMax  Maximum coordinates of the bounding box.
+   */
+  void GetBoundingBox(su2double* coorMin, su2double* coorMax) const;
+
   /*!
    * \brief Function, which determines the element that contains the given coordinate.
    * \note This simply forwards the call to the implementation function selecting the right
@@ -118,8 +135,24 @@ class CADTElemClass : public CADTBaseClass {
   inline void DetermineNearestElement(const su2double* coor, su2double& dist, unsigned short& markerID,
                                       unsigned long& elemID, int& rankID) {
     const auto iThread = omp_get_thread_num();
+    auto nearest = std::numeric_limits<unsigned long>::max();
+    DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist,
+                                 markerID, elemID, rankID, nearest);
+  }
+
+  /*!
+   * \overload
+   * \brief Determine the nearest element starting from a guess, e.g. the result of a previous search for
+   *        a point that has moved. The distance to the guess bounds the search, which makes it much cheaper
+   *        when the guess is close to the nearest element. The result does not depend on the guess.
+   * \param[in,out] nearest  On input, index of an element of the ADT (ignored if out of range), on output
+   *                         index of the nearest element.
+   */
+  inline void DetermineNearestElement(const su2double* coor, su2double& dist, unsigned short& markerID,
+                                      unsigned long& elemID, int& rankID, unsigned long& nearest) {
+    const auto iThread = omp_get_thread_num();
     DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist,
-                                 markerID, elemID, rankID);
+                                 markerID, elemID, rankID, nearest);
   }
 
  private:
@@ -137,7 +170,8 @@ class CADTElemClass : public CADTBaseClass {
    */
   void DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets, vector<unsigned long>& frontLeaves,
                                     vector<unsigned long>& frontLeavesNew, const su2double* coor, su2double& dist,
-                                    unsigned short& markerID, unsigned long& elemID, int& rankID) const;
+                                    unsigned short& markerID, unsigned long& elemID, int& rankID,
+                                    unsigned long& nearest) const;
 
   /*!
    * \brief Function, which checks whether or not the given coordinate is
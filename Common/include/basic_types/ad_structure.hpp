@@ -159,6 +159,8 @@ inline void SetPreaccIn(const T& data, const int size_x, const int size_y) {}
  * Input/Output of the section are set with several calls to SetPreaccIn()/SetPreaccOut().
  *
  * Note: the call of this routine must be followed by a call of EndPreacc() and the end of the code section.
+ *       Sections can be nested, inner sections are then part of the outermost one (their inputs and
+ *       outputs are ignored), which allows preaccumulating code that calls preaccumulated functions.
  */
 inline void StartPreacc() {}
 
@@ -302,6 +304,11 @@ SU2_OMP(threadprivate(PreaccActive))
 
 extern bool PreaccEnabled;
 
+extern int PreaccNesting;
+#ifdef HAVE_OPDI
+SU2_OMP(threadprivate(PreaccNesting))
+#endif
+
 #ifdef HAVE_OPDI
 using CoDiTapePosition = Tape::Position;
 using OpDiState = void*;
@@ -436,6 +443,12 @@ FORCEINLINE void SetPreaccIn(const T& data, const int size_x, const int size_y)
 }
 
 FORCEINLINE void StartPreacc() {
+  /*--- Nested section, becomes part of the outer one. ---*/
+  if (PreaccActive || PreaccNesting > 0) {
+    PreaccActive = false;
+    ++PreaccNesting;
+    return;
+  }
   if (AD::getTape().isActive() && PreaccEnabled) {
     PreaccHelper.start();
     PreaccActive = true;
@@ -484,6 +497,10 @@ FORCEINLINE void Push_TapePosition() {
 }
 
 FORCEINLINE void EndPreacc() {
+  if (PreaccNesting > 0) {
+    if (--PreaccNesting == 0) PreaccActive = true;
+    return;
+  }
   if (PreaccActive) {
     PreaccHelper.finish(false);
     PreaccActive = false;
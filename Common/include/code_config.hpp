@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 #if defined(_MSC_VER)
@@ -137,6 +138,27 @@ using su2mixedfloat = float;
 using su2mixedfloat = passivedouble;
 #endif
 
+/*--- Type of the local (i.e. per rank) indices of the sparse patterns of the geometry and of the
+ * matrices, the global indices are always "unsigned long". ---*/
+#ifdef USE_64BIT_LOCAL_INDICES
+using su2localindex = unsigned long;
+#else
+using su2localindex = uint32_t;
+#endif
+
+/*--- Type for the linear systems that individual solvers may choose to solve in single precision
+ * at runtime (LINEAR_SOLVER_SINGLE_PREC), this is only needed when su2mixedfloat is not float. ---*/
+using su2singlefloat = float;
+#if !defined(CODI_FORWARD_TYPE) && !defined(USE_MIXED_PRECISION)
+#define USE_SINGLE_PRECISION_SYSTEMS
+#endif
+
+/*--- The flow solvers may read the MUSCL gradients and limiters from a single precision copy at runtime
+ * (MUSCL_FLOW_SINGLE_PREC), the copy is not differentiable, so this is not available with AD. ---*/
+#if !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+#define USE_SINGLE_PRECISION_RECONSTRUCTION
+#endif
+
 /*--- Detect if OpDiLib has to be used. ---*/
 #if defined(HAVE_OMP) && defined(CODI_REVERSE_TYPE)
 #ifndef __INTEL_COMPILER
@@ -541,8 +541,15 @@ class C2DContainer
 
   /*!
    * \brief Set value of all entries to "value".
+   * \note Large arrays of numbers are set by all threads with the schedule of the point loops of the
+   *       solvers (chunks of at most 512 rows), to place their pages on the NUMA domains of those threads.
    */
   void setConstant(const Scalar_t& value) noexcept {
+    if (std::is_arithmetic<Scalar_t>::value && useFirstTouch(size() * sizeof(Scalar_t))) {
+      const size_t rowChunk = computeStaticChunkSize(rows(), omp_get_max_threads(), 512);
+      firstTouchSet(size(), value, m_data, IsRowMajor ? rowChunk * cols() : rowChunk);
+      return;
+    }
     for (size_t i = 0; i < size(); ++i) m_data[i] = value;
   }
 
@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <vector>
@@ -45,6 +46,7 @@ class CFileReaderLUT {
   unsigned short table_dim = 2;
   std::string version_lut;
   std::string version_reader;
+  bool binary_format = false;
   unsigned long n_levels = 1;
   su2vector<unsigned long> n_points, n_triangles, n_hull_points;
 
@@ -78,7 +80,17 @@ class CFileReaderLUT {
    */
   bool GetStrippedLine(std::ifstream& file_stream, std::string& line) const;
 
+  /*! \brief Read a table in the binary format written by CLookUpTable::WriteBinaryLUT.
+   * \param[in] file_stream - Stream positioned after the identifier of the format.
+   * \param[in] file_name - LUT input file name (for error messages).
+   */
+  void ReadBinaryLUT(std::ifstream& file_stream, const std::string& file_name);
+
  public:
+  /*! \brief Identifier at the start of binary table files, used to detect the format.
+   */
+  static inline const char* BinaryIdentifier() { return "SU2LUTB1"; }
+
   /*! \brief Get table version as listed in input file.
    */
   inline const std::string& GetVersionLUT() const { return version_lut; }
@@ -87,6 +99,10 @@ class CFileReaderLUT {
    */
   inline const std::string& GetVersionReader() const { return version_reader; }
 
+  /*! \brief Whether the table was read from a binary file.
+   */
+  inline bool GetBinaryFormat() const { return binary_format; }
+
   /*! \brief Get number of data points at specific table level.
    * \param[in] i_level - table level index.
    * \returns data point count at table level.
@@ -122,18 +138,21 @@ class CFileReaderLUT {
    * \returns table data
    */
   inline const su2activematrix& GetTableData(std::size_t i_level = 0) const { return table_data[i_level]; }
+  inline su2activematrix& GetTableData(std::size_t i_level = 0) { return table_data[i_level]; }
 
   /*! \brief Get table connectivity at a specific level.
    * \param[in] i_level - table level index.
    * \returns data connectivity
    */
   inline const su2matrix<unsigned long>& GetTriangles(std::size_t i_level = 0) const { return triangles[i_level]; }
+  inline su2matrix<unsigned long>& GetTriangles(std::size_t i_level = 0) { return triangles[i_level]; }
 
   /*! \brief Get hull node information at a specific table level.
    * \param[in] i_level - table level index.
    * \returns hull node indices.
    */
   inline const su2vector<unsigned long>& GetHull(std::size_t i_level = 0) const { return hull[i_level]; }
+  inline su2vector<unsigned long>& GetHull(std::size_t i_level = 0) { return hull[i_level]; }
 
   /*! \brief Get table level value.
    * \param[in] i_level - table level index.
@@ -145,7 +164,7 @@ class CFileReaderLUT {
    */
   inline unsigned short GetTableDim() const { return table_dim; }
 
-  /*! \brief Read LUT file and store information
+  /*! \brief Read LUT file and store information, ASCII or binary format (detected automatically).
    * \param[in] file_name - LUT input file name.
    */
   void ReadRawLUT(const std::string& file_name);
@@ -29,6 +29,8 @@
 
 #include <array>
 #include <iomanip>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,8 @@ class CLookUpTable {
   su2vector<su2double> z_values_levels; /*!< \brief Constant z-values of each table level.*/
 
   unsigned short table_dim = 2; /*!< \brief Table dimension.*/
+
+  bool binary_file = false; /*!< \brief The table was read from a binary file. */
   /*!
    * \brief The lower and upper limits of the z, y and x variable for each table level.
    */
@@ -90,6 +94,13 @@ class CLookUpTable {
   su2vector<std::vector<std::array<unsigned long, 2>>> edges;
   su2vector<su2vector<std::vector<unsigned long>>> edge_to_triangle;
 
+  /*! \brief
+   * Neighbors of each triangle, the one opposite to each vertex (n_triangles if there is none), for each level.
+   */
+  su2vector<su2matrix<unsigned long>> triangle_neighbors;
+
+  unsigned long idx_CV1, idx_CV2; /*!< \brief Indices of the controlling variables in the table data. */
+
   /*! \brief
    * The hull contains the boundary of the lookup table.
    */
@@ -154,6 +165,22 @@ class CLookUpTable {
    */
   void IdentifyUniqueEdges();
 
+  /*!
+   * \brief Set the neighbors of each triangle from the edge to triangle connectivity.
+   */
+  void IdentifyTriangleNeighbors();
+
+  /*!
+   * \brief Find the triangle that contains a point. The search starts from the hint (if any) and walks across
+   * the triangles towards the point, the trapezoidal map is used if that fails.
+   * \param[in] val_CV1 - First coordinate of the point.
+   * \param[in] val_CV2 - Second coordinate of the point.
+   * \param[in] i_level - Table level.
+   * \param[in,out] hints - Last triangle found on each level, updated with the result, can be nullptr.
+   * \returns Index of the triangle.
+   */
+  unsigned long FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level, unsigned long* hints);
+
   /*!
    * \brief Read the lookup table from file and store the data.
    * \param[in] file_name_lut - the filename of the lookup table.
@@ -287,6 +314,26 @@ class CLookUpTable {
  public:
   CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in);
 
+  /*!
+   * \brief Get a table that is shared by all users of the same file and controlling variables in this process.
+   * \note The lookups do not modify the table, therefore the fluid models of all threads and multigrid levels can
+   *       share one copy of the data and of the search structures, instead of loading one copy each.
+   * \param[in] file_name_lut - Table file name, ASCII or binary format.
+   * \param[in] name_CV1_in - Name of controlling variable 1.
+   * \param[in] name_CV2_in - Name of controlling variable 2.
+   * \param[in] write_binary - When the table is loaded (from an ASCII file), the master rank writes it in binary
+   *            format to <file_name_lut>.bin, which can be used as the table file of later runs.
+   * \return Shared pointer to the table, which is released when its last user is destroyed.
+   */
+  static std::shared_ptr<CLookUpTable> GetShared(const std::string& file_name_lut, const std::string& name_CV1_in,
+                                                 const std::string& name_CV2_in, bool write_binary = false);
+
+  /*!
+   * \brief Write the table in the binary format read by CFileReaderLUT, which is much faster to load.
+   * \param[in] file_name - Output file name.
+   */
+  void WriteBinaryLUT(const std::string& file_name) const;
+
   /*!
    * \brief Print information to screen.
    */
@@ -298,10 +345,11 @@ class CLookUpTable {
    * \param[out] val_var - The stored value of the variable to look up.
    * \param[in] val_CV1 - Value of controlling variable 1.
    * \param[in] val_CV2 - Value of controlling variable 2.
+   * \param[in,out] hints - Optional search hints of the caller, see GetNLevels.
    * \returns 1 if the lookup and subsequent interpolation was a success, 0 if not.
    */
   unsigned long LookUp_XY(const std::string& val_name_var, su2double* val_var, su2double val_CV1, su2double val_CV2,
-                          unsigned long i_level = 0);
+                          unsigned long i_level = 0, unsigned long* hints = nullptr);
 
   /*!
    * \brief Lookup 1 value for each of the variables in "val_name_var" using controlling variable
@@ -310,10 +358,12 @@ class CLookUpTable {
    * \param[out] val_vars - pointer to the vector of stored values of the variables to look up.
    * \param[in] val_CV1 - value of controlling variable 1.
    * \param[in] val_CV2 - value of controlling variable 2.
+   * \param[in,out] hints - Optional search hints of the caller, see GetNLevels.
    * \returns 1 if the lookup and subsequent interpolation was a success, 0 if not.
    */
   unsigned long LookUp_XY(const std::vector<std::string>& val_names_var, std::vector<su2double*>& val_vars,
-                          su2double val_CV1, su2double val_CV2, unsigned long i_level = 0);
+                          su2double val_CV1, su2double val_CV2, unsigned long i_level = 0,
+                          unsigned long* hints = nullptr);
 
   /*!
    * \brief Lookup the value of the variable "val_name_var" using controlling variable values(val_CV1,val_CV2).
@@ -321,10 +371,12 @@ class CLookUpTable {
    * \param[out] val_var - The stored value of the variable to look up.
    * \param[in] val_CV1 - Value of controlling variable 1.
    * \param[in] val_CV2 - Value of controlling variable 2.
+   * \param[in,out] hints - Optional search hints of the caller, see GetNLevels.
    * \returns 1 if the lookup and subsequent interpolation was a success, 0 if not.
    */
   unsigned long LookUp_XY(const std::vector<std::string>& val_names_var, std::vector<su2double>& val_vars,
-                          su2double val_CV1, su2double val_CV2, unsigned long i_level = 0);
+                          su2double val_CV1, su2double val_CV2, unsigned long i_level = 0,
+                          unsigned long* hints = nullptr);
 
   /*!
    * \brief Lookup the value of the variable "val_name_var" using controlling variable values(val_CV1,val_CV2,val_z).
@@ -333,10 +385,11 @@ class CLookUpTable {
    * \param[in] val_CV1 - Value of controlling variable 1.
    * \param[in] val_CV2 - Value of controlling variable 2.
    * \param[in] val_CV3 - Value of controlling variable 3.
+   * \param[in,out] hints - Optional search hints of the caller, see GetNLevels.
    * \returns 1 if the lookup and subsequent interpolation was a success, 0 if not.
    */
   unsigned long LookUp_XYZ(const std::string& val_name_var, su2double* val_var, su2double val_CV1, su2double val_CV2,
-                           su2double val_CV3);
+                           su2double val_CV3, unsigned long* hints = nullptr);
 
   /*!
    * \brief Lookup the value of the variable "val_name_var" using controlling variable values(val_CV1,val_CV2,val_z).
@@ -345,10 +398,12 @@ class CLookUpTable {
    * \param[in] val_CV1 - Value of controlling variable 1.
    * \param[in] val_CV2 - Value of controlling variable 2.
    * \param[in] val_CV3 - Value of controlling variable 3.
+   * \param[in,out] hints - Optional search hints of the caller, see GetNLevels.
    * \returns 1 if the lookup and subsequent interpolation was a success, 0 if not.
    */
   unsigned long LookUp_XYZ(const std::vector<std::string>& val_names_var, std::vector<su2double>& val_vars,
-                           su2double val_CV1, su2double val_CV2, su2double val_CV3 = 0);
+                           su2double val_CV1, su2double val_CV2, su2double val_CV3 = 0,
+                           unsigned long* hints = nullptr);
 
   /*!
    * \brief Find the table levels with constant z-values directly above and below query val_z.
@@ -358,6 +413,14 @@ class CLookUpTable {
    */
   std::pair<unsigned long, unsigned long> FindInclusionLevels(const su2double val_CV3);
 
+  /*!
+   * \brief Get the number of table levels.
+   * \note Callers can keep one search hint per level (initialized to any value >= the number of triangles) and
+   *       pass them to the lookups. Successive lookups of nearby states, e.g. neighboring grid points, then find
+   *       their triangle with a short walk from the previous one instead of a trapezoidal map search.
+   */
+  inline unsigned long GetNLevels() const { return n_table_levels; }
+
   /*!
    * \brief Determine the minimum and maximum value of the second controlling variable.
    * \returns Pair of minimum and maximum value of controlling variable 2.
@@ -71,6 +71,21 @@
   void Set(unsigned long row, std::vector<passivedouble> vals) {                                                 \
     unsigned long j = 0;                                                                                         \
     for (const auto& val : vals) Set(row, j++, val);                                                             \
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Gets all the values of the matrix in one call (row-major, rows x cols). */                          \
+  std::vector<passivedouble> GetAll() const {                                                                    \
+    std::vector<passivedouble> vals(rows_ * cols_);                                                              \
+    for (unsigned long i = 0; i < rows_; ++i)                                                                    \
+      for (unsigned long j = 0; j < cols_; ++j) vals[i * cols_ + j] = Get(i, j);                                 \
+    return vals;                                                                                                 \
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Sets all the values of the matrix in one call (row-major, rows x cols). */                          \
+  void SetAll(const std::vector<passivedouble>& vals) {                                                          \
+    if (vals.size() != rows_ * cols_) SU2_MPI::Error("Wrong number of values.", CURRENT_FUNCTION);               \
+    for (unsigned long i = 0; i < rows_; ++i)                                                                    \
+      for (unsigned long j = 0; j < cols_; ++j) Set(i, j, vals[i * cols_ + j]);                                  \
   }
 
 /*!
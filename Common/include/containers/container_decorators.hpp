@@ -121,6 +121,12 @@ class C3DContainerDecorator {
   Index rows() const noexcept { return m_storage.cols() / m_innerSz; }
   Index cols() const noexcept { return m_innerSz; }
 
+  /*!
+   * \brief Pointer to the contiguous storage, the inner-most dimension is the fastest.
+   */
+  Scalar* data() noexcept { return m_storage.data(); }
+  const Scalar* data() const noexcept { return m_storage.data(); }
+
   /*!
    * \brief Element-wise access.
    */
@@ -173,6 +179,7 @@ class C3DContainerDecorator {
 using C3DIntMatrix = C3DContainerDecorator<su2matrix<unsigned long> >;
 using C3DDoubleMatrix = C3DContainerDecorator<su2activematrix>;
 using CVectorOfMatrix = C3DDoubleMatrix;
+using C3DSingleMatrix = C3DContainerDecorator<su2matrix<su2singlefloat> >;
 
 /*!
  * \class C2DDummyLastView
@@ -715,6 +715,14 @@ class CFEMStandardElement : public CFEMStandardElementBase {
                                             functions   in the integration points. As such second derivatives can be
                                             computed   using one call to the BLAS routines. */
 
+  unsigned short nDOFs1D = 0; /*!< \brief Number of DOFs per direction when the basis functions in the integration
+                                           points are a tensor product of 1D functions (hexahedra), 0 otherwise. */
+  unsigned short nInt1D = 0;  /*!< \brief Number of integration points per direction for a tensor product element. */
+  vector<su2double> lagBasisInt1D;    /*!< \brief 1D Lagrangian basis functions in the 1D integration points,
+                                                  nInt1D x nDOFs1D. lagBasisIntegration is their tensor product. */
+  vector<su2double> derLagBasisInt1D; /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D
+                                                  integration points, nInt1D x nDOFs1D. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs
                                        is such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs
@@ -768,6 +776,19 @@ class CFEMStandardElement : public CFEMStandardElementBase {
     return (*this);
   }
 
+  /*!
+   * \brief Get a standard element from a cache shared by all the meshes of the process, the element is created
+   *        the first time it is requested. The arguments are the same as for the constructor.
+   * \note The tables of a standard element are expensive to compute at high polynomial degree, the same elements
+   *       are needed by the partitioning, the DG mesh, and the solvers. Not thread safe.
+   * \return Reference to the cached element, to be copied by the caller.
+   */
+  static const CFEMStandardElement& Get(unsigned short val_VTK_Type, unsigned short val_nPoly, bool val_constJac,
+                                        CConfig* config, unsigned short val_orderExact = 0,
+                                        const vector<su2double>* rLocSolDOFs = nullptr,
+                                        const vector<su2double>* sLocSolDOFs = nullptr,
+                                        const vector<su2double>* tLocSolDOFs = nullptr);
+
   /*!
   * \brief Function, which computes the Lagrangian basis functions for the
            given parametric coordinates.
@@ -861,6 +882,57 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   */
   inline const su2double* GetMat2ndDerBasisFunctionsInt(void) const { return mat2ndDerBasisInt.data(); }
 
+  /*!
+   * \brief Function, which indicates whether the basis functions in the integration points are a tensor
+   *        product of 1D basis functions, in which case the TensorProduct functions can be used instead of
+   *        the matrix products with matBasisIntegration, lagBasisIntegrationTrans and matDerBasisIntTrans.
+   * \return  True for hexahedra, false otherwise.
+   */
+  inline bool TensorProductElement(void) const { return nDOFs1D > 0; }
+
+  /*!
+   * \brief Function, which makes available the size of the work array needed by the TensorProduct functions.
+   * \return  The size of the work array per padded entry, i.e. it must be multiplied by NPad.
+   */
+  inline unsigned int GetSizeWorkTensorProduct(void) const {
+    const unsigned int N = nDOFs1D, M = nInt1D;
+    return N * M * (2 * N + 3 * M);
+  }
+
+  /*!
+  * \brief Function, which computes the solution and, if desired, its parametric derivatives in the integration
+           points by sum factorization. The result is identical to the product of matBasisIntegration and sol,
+           but the cost per element scales with nPoly^4 instead of nPoly^6.
+  * \param[in]  NPad          - Padded number of entries per DOF (leading dimension of sol and solAndGradInt).
+  * \param[in]  sol           - Solution in the DOFs, nDOFs x NPad.
+  * \param[out] solAndGradInt - Solution followed by its r-, s- and t-derivatives in the integration points,
+                                 each block nIntegration x NPad.
+  * \param[in]  work          - Work array of size GetSizeWorkTensorProduct()*NPad.
+  * \param[in]  gradients     - Whether or not the derivatives must be computed.
+  */
+  void TensorProductSolAndGradInt(unsigned short NPad, const su2double* sol, su2double* solAndGradInt,
+                                  su2double* work, bool gradients) const;
+
+  /*!
+  * \brief Function, which computes the product of lagBasisIntegrationTrans and dataInt by sum factorization.
+  * \param[in]  NPad    - Padded number of entries per point.
+  * \param[in]  dataInt - Data in the integration points, nIntegration x NPad.
+  * \param[out] res     - Result in the DOFs, nDOFs x NPad.
+  * \param[in]  work    - Work array of size GetSizeWorkTensorProduct()*NPad.
+  */
+  void TensorProductBasisTrans(unsigned short NPad, const su2double* dataInt, su2double* res, su2double* work) const;
+
+  /*!
+  * \brief Function, which computes the product of matDerBasisIntTrans and fluxes by sum factorization.
+  * \param[in]  NPad   - Padded number of entries per point.
+  * \param[in]  fluxes - Parametric fluxes in the integration points, the 3 components of a point are contiguous,
+                          i.e. (nIntegration*3) x NPad.
+  * \param[out] res    - Result in the DOFs, nDOFs x NPad.
+  * \param[in]  work   - Work array of size GetSizeWorkTensorProduct()*NPad.
+  */
+  void TensorProductDerBasisTrans(unsigned short NPad, const su2double* fluxes, su2double* res,
+                                  su2double* work) const;
+
   /*!
    * \brief Function, which makes available the connectivity of face 0.
    * \return  The pointer to data, which stores the connectivity of face 0.
@@ -1072,6 +1144,12 @@ class CFEMStandardElement : public CFEMStandardElementBase {
    */
   void DataStandardHexahedron(void);
 
+  /*!
+  * \brief Function, which creates the 1D data used by the TensorProduct functions, if the basis functions
+           in the integration points are a tensor product of 1D functions.
+  */
+  void CreateTensorProductData(void);
+
   /*!
   * \brief Function, which determines the connectivity of the linear subtetrahedra for a high
            order tetrahedron.
@@ -1219,6 +1297,17 @@ class CFEMStandardInternalFace : public CFEMStandardElementBase {
     return (*this);
   }
 
+  /*!
+   * \brief Get a standard internal face from the cache shared by all the meshes of the process, see
+   *        CFEMStandardElement::Get. The arguments are the same as for the constructor.
+   * \return Reference to the cached face, to be copied by the caller.
+   */
+  static const CFEMStandardInternalFace& Get(unsigned short val_VTK_TypeFace, unsigned short val_VTK_TypeSide0,
+                                             unsigned short val_nPolySide0, unsigned short val_VTK_TypeSide1,
+                                             unsigned short val_nPolySide1, bool val_constJac,
+                                             bool val_swapFaceInElementSide0, bool val_swapFaceInElementSide1,
+                                             CConfig* config, unsigned short val_orderExact = 0);
+
   /*!
   * \brief Function, which makes available the r-derivatives of the elements
            basis functions of side 0 in the integration points.
@@ -1512,6 +1601,16 @@ class CFEMStandardBoundaryFace : public CFEMStandardElementBase {
     return (*this);
   }
 
+  /*!
+   * \brief Get a standard boundary face from the cache shared by all the meshes of the process, see
+   *        CFEMStandardElement::Get. The arguments are the same as for the constructor.
+   * \return Reference to the cached face, to be copied by the caller.
+   */
+  static const CFEMStandardBoundaryFace& Get(unsigned short val_VTK_TypeFace, unsigned short val_VTK_TypeElem,
+                                             unsigned short val_nPolyElem, bool val_constJac,
+                                             bool val_swapFaceInElement, CConfig* config,
+                                             unsigned short val_orderExact = 0);
+
   /*!
   * \brief Function, which makes available the r-derivatives of the element
            basis functions in the integration points.
@@ -51,6 +51,7 @@ extern "C" {
 #include <climits>
 #include <memory>
 #include <unordered_map>
+#include <tuple>
 
 #include "primal_grid/CPrimalGrid.hpp"
 #include "dual_grid/CDualGrid.hpp"
@@ -187,22 +188,26 @@ class CGeometry {
 
   /*--- Sparsity patterns associated with the geometry. ---*/
 
-  CCompressedSparsePatternUL finiteVolumeCSRFill0, /*!< \brief 0-fill FVM sparsity. */
-      finiteVolumeCSRFillN,                        /*!< \brief N-fill FVM sparsity (e.g. for ILUn preconditioner). */
-      finiteElementCSRFill0,                       /*!< \brief 0-fill FEM sparsity. */
-      finiteElementCSRFillN;                       /*!< \brief N-fill FEM sparsity (e.g. for ILUn preconditioner). */
+  CCompressedSparsePatternLocal finiteVolumeCSRFill0, /*!< \brief 0-fill FVM sparsity. */
+      finiteVolumeCSRFillN,                           /*!< \brief N-fill FVM sparsity (e.g. for ILUn preconditioner). */
+      finiteElementCSRFill0,                          /*!< \brief 0-fill FEM sparsity. */
+      finiteElementCSRFillN;                          /*!< \brief N-fill FEM sparsity (e.g. for ILUn preconditioner). */
 
-  CEdgeToNonZeroMapUL edgeToCSRMap; /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
+  CEdgeToNonZeroMapLocal edgeToCSRMap; /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
   /*--- Edge and element colorings. ---*/
 
   CCompressedSparsePatternUL edgeColoring, /*!< \brief Edge coloring structure for thread-based parallelization. */
       elemColoring;                        /*!< \brief Element coloring structure for thread-based parallelization. */
   unsigned long edgeColorGroupSize{1};     /*!< \brief Size of the edge groups within each color. */
+  EDGE_COLORING edgeColoringMethod{EDGE_COLORING::GREEDY}; /*!< \brief How the edges are grouped before coloring. */
   unsigned long elemColorGroupSize{1};     /*!< \brief Size of the element groups within each color. */
 
   ColMajorMatrix<uint8_t> CoarseGridColor_; /*!< \brief Coarse grid levels, colorized. */
 
+  std::vector<uint8_t> MetricsChanged; /*!< \brief Points whose volume or edges changed in the last incremental
+                                            update of the dual grid, empty after a complete update. */
+
  public:
   /*!< \brief Linelets (mesh lines perpendicular to stretching direction). */
   struct CLineletInfo {
@@ -227,6 +232,33 @@ class CGeometry {
  protected:
   mutable CLineletInfo lineletInfo;
 
+  /*!< \brief Stencils of the element filter, built once for a set of radii and applied as sparse products. */
+  struct CElementFilterInfo {
+    vector<passivedouble> radius;   /*!< \brief Radius of each filter stage. */
+    unsigned short searchLimit = 0; /*!< \brief Search limit used to build the stencils. */
+
+    /*!< \brief Neighbours of each local element for each stage, indices < nElem are local elements, the
+     * others are remote elements (nElem + position in the receive buffer of the exchange plan). */
+    vector<CCompressedSparsePatternUL> stencils;
+
+    vector<int> sendCount, sendDispl, recvCount, recvDispl; /*!< \brief Plan to fetch the remote elements. */
+    vector<unsigned long> sendElem; /*!< \brief Local elements to send, in the order of the plan. */
+  };
+  mutable CElementFilterInfo elemFilterInfo;
+
+ public:
+  /*!< \brief Least-squares gradient weights of each point-neighbour pair, w_ij = inv(R_i'R_i) d_ij omega_ij, stored
+   * in the CSR order of the point neighbours (CPoint::GetPoints()) such that grad(U)_i = sum_j w_ij (U_j - U_i). */
+  struct CLeastSquaresWeights {
+    su2activematrix weights[2];     /*!< \brief Unweighted [0] and inverse-distance weighted [1] variants, nnz x nDim. */
+    bool valid[2] = {false, false}; /*!< \brief Whether each variant is consistent with the current dual grid. */
+
+    void Invalidate() { valid[0] = valid[1] = false; }
+  };
+
+ protected:
+  CLeastSquaresWeights lsqWeights; /*!< \brief Computed by the gradient routines on first use. */
+
  public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -282,8 +314,17 @@ class CGeometry {
   su2double* bufD_P2PSend{nullptr};  /*!< \brief Data structure for su2double point-to-point send. */
   unsigned short* bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short* bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
+  float* bufF_P2PRecv{nullptr};           /*!< \brief Data structure for float point-to-point receive. */
+  float* bufF_P2PSend{nullptr};           /*!< \brief Data structure for float point-to-point send. */
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
+  bool persistentP2P{false}; /*!< \brief Use persistent requests for the point-to-point comms (PERSISTENT_MPI_COMMS). */
+  mutable map<tuple<unsigned short, unsigned short, bool>, vector<SU2_MPI::Request> >
+      P2PPersistentRequests; /*!< \brief Persistent requests for each data type, count per point, and direction,
+                                the sends are followed by the recvs. */
+  struct CSharedP2PComms;
+  unique_ptr<CSharedP2PComms> sharedP2P; /*!< \brief Buffers in shared memory and on-node neighbors for the
+                                            point-to-point comms (SHARED_MEMORY_COMMS), nullptr if not used. */
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -316,6 +357,8 @@ class CGeometry {
   unsigned short* bufS_PeriodicSend{nullptr};  /*!< \brief Data structure for unsigned long periodic send. */
   SU2_MPI::Request* req_PeriodicSend{nullptr}; /*!< \brief Data structure for periodic send requests. */
   SU2_MPI::Request* req_PeriodicRecv{nullptr}; /*!< \brief Data structure for periodic recv requests. */
+  bool disjointPeriodicPairs{false}; /*!< \brief True if no point (on any rank) lies on more than one pair of
+                                        periodic markers, all pairs can then be communicated at once. */
 
   /*--- Mesh quality metrics. ---*/
 
@@ -382,6 +425,36 @@ class CGeometry {
   void PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType, unsigned short countPerPoint,
                     int val_iMessage, bool val_reverse) const;
 
+  /*!
+   * \brief Get the persistent requests for a type of point-to-point communication, creating them on first use.
+   * \note The pattern of the communications is fixed after preprocessing, therefore the requests only need to be
+   *       created once for each combination of data type, count per point, and direction (and buffer allocation).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return The nP2PSend send requests followed by the nP2PRecv recv requests.
+   */
+  const vector<SU2_MPI::Request>& GetP2PPersistentRequests(unsigned short commType, unsigned short countPerPoint,
+                                                           bool val_reverse) const;
+
+  /*!
+   * \brief Free the persistent requests, needed when the communication buffers are reallocated.
+   */
+  void FreeP2PPersistentRequests();
+
+  /*!
+   * \brief Copy the data of a point-to-point send directly into the buffer of the destination rank, if it
+   *        is on the same node (SHARED_MEMORY_COMMS). The message that is then sent has no data, it only
+   *        notifies the destination.
+   * \note Waits until the destination has posted its recvs, i.e. until it no longer reads its buffer.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_iSend - Index of the message in the order they are stored.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return True if the destination is on the same node.
+   */
+  bool PutP2PShared(unsigned short commType, unsigned short countPerPoint, int val_iSend, bool val_reverse) const;
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -696,10 +769,10 @@ class CGeometry {
   inline virtual void SetPoint_Connectivity() {}
 
   /*!
-   * \brief Orders the RCM.
+   * \brief Renumber the points to improve the locality of the data accesses.
    * \param[in] config - Definition of the particular problem.
    */
-  inline virtual void SetRCM_Ordering(CConfig* config) {}
+  inline virtual void SetPoint_Ordering(const CConfig* config) {}
 
   /*!
    * \brief Connects elements  .
@@ -848,6 +921,13 @@ class CGeometry {
    */
   inline virtual void SetColorGrid_Parallel(const CConfig* config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] cost - Measured compute time of this rank.
+   */
+  inline virtual void WriteLoadBalanceWeights(const CConfig* config, passivedouble cost) const {}
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1341,6 +1421,14 @@ class CGeometry {
    */
   static void UpdateGeometry(CGeometry** geometry_container, CConfig* config);
 
+  /*!
+   * \brief Rotate the edge and boundary vertex normals after a rigid rotation of the grid, which does not change
+   *        the volumes, this replaces SetControlVolume and SetBoundControlVolume for rigid motions.
+   * \note Element centroids are not updated.
+   * \param[in] rotMatrix - Rotation matrix (3x3 also in 2D, then only the top left block is used).
+   */
+  void RotateDualGrid(const su2double rotMatrix[][3]);
+
   /*!
    * \brief Update the multi-grid structure for the customized boundary conditions
    * \param geometry_container - Geometrical definition.
@@ -1641,9 +1729,16 @@ class CGeometry {
                                const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels,
                                const unsigned short search_limit, su2double* values) const;
 
+  /*!
+   * \brief Build the stencils of FilterValuesAtElementCG and the plan to fetch the remote elements they reference.
+   * \param[in] radius - Radius of each filter stage.
+   * \param[in] search_limit - Max degree of neighborhood considered for neighbor search.
+   */
+  void SetElementFilterStencils(const vector<passivedouble>& radius, unsigned short search_limit) const;
+
   /*!
    * \brief Build the global (entire mesh!) adjacency matrix for the elements in compressed format.
-   *        Used by FilterValuesAtElementCG to search for geometrically close neighbours.
+   *        Used by SetElementFilterStencils to search for geometrically close neighbours.
    * \param[out] neighbour_start - i'th position stores the start position in "neighbour_idx" for the immediate
    *             neighbours of global element "i". Size nElemDomain+1
    * \param[out] neighbour_idx - Global index of the neighbours, mush be NULL on entry and free'd by calling function.
@@ -1701,21 +1796,21 @@ class CGeometry {
    * \param[in] fillLvl - Level of fill of the pattern.
    * \return Reference to the sparse pattern.
    */
-  const CCompressedSparsePatternUL& GetSparsePattern(ConnectivityType type, unsigned long fillLvl = 0);
+  const CCompressedSparsePatternLocal& GetSparsePattern(ConnectivityType type, unsigned long fillLvl = 0);
 
   /*!
    * \brief Get the edge to sparse pattern map.
    * \note This method builds the map and required pattern (0-fill FVM) if that has not been done yet.
    * \return Reference to the map.
    */
-  const CEdgeToNonZeroMapUL& GetEdgeToSparsePatternMap();
+  const CEdgeToNonZeroMapLocal& GetEdgeToSparsePatternMap();
 
   /*!
    * \brief Get the transpose of the (main, i.e 0 fill) sparse pattern (e.g. CSR becomes CSC).
    * \param[in] type - Finite volume or finite element.
    * \return Reference to the map.
    */
-  const su2vector<unsigned long>& GetTransposeSparsePatternMap(ConnectivityType type);
+  const su2vector<su2localindex>& GetTransposeSparsePatternMap(ConnectivityType type);
 
   /*!
    * \brief Get the edge coloring.
@@ -1725,6 +1820,21 @@ class CGeometry {
    */
   const CCompressedSparsePatternUL& GetEdgeColoring(su2double* efficiency = nullptr);
 
+  /*!
+   * \brief Measures of the memory locality of the groups of the edge coloring (each is processed by one thread).
+   * \param[out] bandwidth - Average range of the point indices of the groups.
+   * \param[out] pointsPerEdge - Average number of distinct points read by the groups per edge (lower is better).
+   */
+  void GetEdgeColoringLocality(su2double& bandwidth, su2double& pointsPerEdge) const;
+
+  /*!
+   * \brief Partition the points (domain and halo) of the rank into compact sub-domains, with METIS if available,
+   *        otherwise by recursive coordinate bisection.
+   * \param[in] nPart - Number of sub-domains.
+   * \return Sub-domain of each point.
+   */
+  vector<unsigned long> PartitionPoints(unsigned long nPart) const;
+
   /*!
    * \brief Force the natural (sequential) edge coloring.
    */
@@ -1755,6 +1865,18 @@ class CGeometry {
    */
   inline unsigned long GetElementColorGroupSize() const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Get the points whose dual grid metrics changed in the last (incremental) update.
+   * \return Flag per point, empty if all the metrics were recomputed.
+   */
+  inline const std::vector<uint8_t>& GetMetricsChanged() const { return MetricsChanged; }
+
+  /*!
+   * \brief Get the precomputed least-squares gradient weights, they are invalidated when the dual grid is updated.
+   * \return Reference to the weights, see CLeastSquaresWeights.
+   */
+  inline CLeastSquaresWeights& GetLeastSquaresWeights() { return lsqWeights; }
+
   /*!
    * \brief Get the linelet definition, this function computes the linelets if that has not been done yet.
    */
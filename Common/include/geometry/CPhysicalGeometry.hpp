@@ -30,6 +30,7 @@
 #include "CGeometry.hpp"
 #include "meshreader/CMeshReaderFVM.hpp"
 #include "../containers/C2DContainer.hpp"
+#include "../toolboxes/CMonotonicArena.hpp"
 
 /*!
  * \class CPhysicalGeometry
@@ -86,10 +87,40 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long* Elem_ID_BoundTria_Linear{nullptr};
   unsigned long* Elem_ID_BoundQuad_Linear{nullptr};
 
+  CMonotonicArena PointsArena;  /*!< \brief Local points received in DistributePoints, released after LoadPoints. */
+  CMonotonicArena VolumeArena;  /*!< \brief Local volume elements, released after LoadVolumeElements. */
+  CMonotonicArena SurfaceArena; /*!< \brief Local surface elements, released after LoadSurfaceElements. */
+
+  vector<vector<unsigned long> > WallADT_Nearest; /*!< \brief Nearest element of each point in the wall ADT of each
+                                                      zone, used as initial guess when the wall distance is updated. */
+
+  su2activematrix CoordMetrics;   /*!< \brief Coordinates for which the dual grid metrics were computed. */
+  vector<uint8_t> MovedPoint;     /*!< \brief Points that moved more than DUAL_GRID_UPDATE_TOL in the last update. */
+  su2double LocalDomainVolume{0}; /*!< \brief Volume of the elements of this rank. */
+
   su2double Streamwise_Periodic_RefNode[MAXNDIM] = {
       0}; /*!< \brief Coordinates of the reference node [m] on the receiving periodic marker, for recovered
              pressure/temperature computation only.*/
 
+  /*!
+   * \brief Compute the Reverse Cuthill-McKee ordering of the domain points.
+   * \return The old index of each new point (halo points are not included).
+   */
+  vector<unsigned long> ComputeRCM_Ordering() const;
+
+  /*!
+   * \brief Compute the ordering of the domain points along a Hilbert curve through their coordinates.
+   * \return The old index of each new point (halo points are not included).
+   */
+  vector<unsigned long> ComputeHilbert_Ordering() const;
+
+  /*!
+   * \brief Average distance between the indices of neighbor domain points over all ranks,
+   *        a measure of the locality of the indirect accesses in the edge loops and matrix products.
+   * \param[in] NewIndex - Index of each point in the numbering being evaluated.
+   */
+  passivedouble GetAverageNeighborDistance(const vector<unsigned long>& NewIndex) const;
+
  public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetBoundControlVolume;
@@ -357,10 +388,11 @@ class CPhysicalGeometry final : public CGeometry {
   void SetPoint_Connectivity() override;
 
   /*!
-   * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
+   * \brief Renumber the points of the rank (see POINT_ORDERING), the halo points are kept at the end.
+   * \note Must be called before creating the edges, vertices, and solvers, which all follow this numbering.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetRCM_Ordering(CConfig* config) override;
+  void SetPoint_Ordering(const CConfig* config) override;
 
   /*!
    * \brief Set elements which surround an element.
@@ -482,6 +514,29 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetColorGrid_Parallel(const CConfig* config) override;
 
+  /*!
+   * \brief Flags of the points returned by GetLinearMarkerFlags.
+   */
+  enum : unsigned short { MARKER_POINT = 1, INTERFACE_POINT = 2 };
+
+  /*!
+   * \brief Flag the points of the linear partitioning of this rank that are on the boundary markers
+   *        and/or on the zone interfaces (for the ParMETIS constraints and co-partitioning).
+   * \note Must be called by all ranks, before the partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \return Combination of MARKER_POINT and INTERFACE_POINT for each point.
+   */
+  vector<unsigned short> GetLinearMarkerFlags(const CConfig* config) const;
+
+  /*!
+   * \brief Write the ParMETIS weights of the points measured by this run, for SetColorGrid_Parallel
+   *        in later runs (see LOAD_BALANCE_MEASURE).
+   * \note Must be called by all ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] cost - Measured compute time of this rank.
+   */
+  void WriteLoadBalanceWeights(const CConfig* config, passivedouble cost) const override;
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -737,13 +792,23 @@ class CPhysicalGeometry final : public CGeometry {
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
    * \details The ADT might belong to another zone, giving rise to lower wall distances
-   * than those already stored.
+   * than those already stored. The nearest element of each point is kept as the initial guess
+   * of the next search (e.g. after the mesh deforms), which then only visits a few leaves of the ADT.
    * \param[in] WallADT - The ADT to reduce the wall distance
    * \param[in] config - ignored
    * \param[in] iZone - zone whose markers made the ADT
    */
   void SetWallDistance(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) override;
 
+  /*!
+   * \brief Reduce the wall distance with the walls of the other ranks, for a local (distributed) ADT.
+   * \details The ranks exchange the bounding boxes of their walls, each point is sent to the rank with the
+   * closest box, and then to the other ranks whose box is closer than the distance found. Collective.
+   * \param[in] WallADT - Local ADT of the walls of this rank.
+   * \param[in] iZone - zone whose markers made the ADT
+   */
+  void SetRemoteWallDistance(CADTElemClass* WallADT, unsigned short iZone);
+
   /*!
    * \brief Set wall distances a specific value
    */
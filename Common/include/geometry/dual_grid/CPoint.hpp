@@ -48,16 +48,19 @@ class CPoint {
  private:
   friend class CPhysicalGeometry;
 
+  enum : unsigned long { NO_VERTEX_DATA = ~0ul }; /*!< \brief VertexPtr of points that were never on a boundary. */
+
   const unsigned long nDim = 0;
 
   su2vector<unsigned long> GlobalIndex; /*!< \brief Global index in the parallel simulation. */
   su2vector<unsigned long> Color;       /*!< \brief Color of the point in the partitioning strategy. */
 
-  CCompressedSparsePatternUL Point; /*!< \brief Points surrounding the central node of the control volume. */
+  CCompressedSparsePatternLocal Point; /*!< \brief Points surrounding the central node of the control volume. */
   CCompressedSparsePatternL Edge;   /*!< \brief Edges that set up a control volume (same sparse structure as Point). */
   CCompressedSparsePatternL Elem;   /*!< \brief Elements that set up a control volume around a node. */
-  vector<vector<long> > Vertex; /*!< \brief Index of the vertex that correspond which the control volume (we need one
-                                   for each marker in the same node). */
+  su2vector<unsigned long> VertexPtr; /*!< \brief Position of the vertices of each boundary point in VertexData. */
+  vector<long> VertexData; /*!< \brief Index of the vertex that correspond which the control volume (we need one
+                              for each marker in the same node), nMarker values per boundary point. */
 
   su2activevector Volume;          /*!< \brief Volume or Area of the control volume in 3D and 2D. */
   su2activevector Volume_n;        /*!< \brief Volume at time n. */
@@ -93,6 +96,8 @@ class CPoint {
   su2vector<unsigned long> Parent_CV; /*!< \brief Index of the parent control volume in the agglomeration process. */
   su2vector<unsigned short> nChildren_CV; /*!< \brief Number of children in the agglomeration process. */
   vector<vector<unsigned long> >
+      Children_CV_Agglomeration; /*!< \brief Children control volumes while the agglomeration is in progress. */
+  CCompressedSparsePatternUL
       Children_CV; /*!< \brief Index of the children control volumes in the agglomeration process. */
   su2vector<bool> Agglomerate_Indirect; /*!< \brief This flag indicates if the indirect points can be agglomerated. */
   su2vector<bool> Agglomerate;          /*!< \brief This flag indicates if the element has been agglomerated. */
@@ -200,6 +205,13 @@ class CPoint {
    */
   void SetElems(const vector<vector<long> >& elemsMatrix);
 
+  /*!
+   * \brief Set the elements that are connected to each point, already in compressed (CSR) format.
+   * \param[in] outerPtr - Start of the elements of each point (size nPoint+1).
+   * \param[in] innerIdx - Elements of all the points.
+   */
+  void SetElems(su2vector<long>&& outerPtr, su2vector<long>&& innerIdx);
+
   /*!
    * \brief Reset the elements of a control volume.
    */
@@ -235,16 +247,23 @@ class CPoint {
    */
   void SetPoints(const vector<vector<unsigned long> >& pointsMatrix);
 
+  /*!
+   * \brief Set the points that compose the control volume, already in compressed (CSR) format.
+   * \param[in] outerPtr - Start of the neighbors of each point (size nPoint+1).
+   * \param[in] innerIdx - Neighbors of all the points.
+   */
+  void SetPoints(su2vector<su2localindex>&& outerPtr, su2vector<su2localindex>&& innerIdx);
+
   /*!
    * \brief Get the entire point adjacency information in compressed format (CSR).
    */
-  const CCompressedSparsePatternUL& GetPoints() const { return Point; }
+  const CCompressedSparsePatternLocal& GetPoints() const { return Point; }
 
   /*!
    * \brief Reset the points that compose the control volume.
    */
   inline void ResetPoints() {
-    Point = CCompressedSparsePatternUL();
+    Point = CCompressedSparsePatternLocal();
     Edge = CCompressedSparsePatternL();
   }
 
@@ -268,7 +287,7 @@ class CPoint {
   /*!
    * \brief Get inner iterator to loop over neighbor points.
    */
-  inline CCompressedSparsePatternUL::CInnerIter GetPoints(unsigned long iPoint) const {
+  inline CCompressedSparsePatternLocal::CInnerIter GetPoints(unsigned long iPoint) const {
     return Point.getInnerIter(iPoint);
   }
 
@@ -304,7 +323,7 @@ class CPoint {
    * \param[in] iMarker - Marker of the vertex to be added (position where is going to be stored).
    */
   inline void SetVertex(unsigned long iPoint, long iVertex, unsigned long iMarker) {
-    if (Boundary(iPoint)) Vertex[iPoint][iMarker] = iVertex;
+    if (Boundary(iPoint)) VertexData[VertexPtr(iPoint) + iMarker] = iVertex;
   }
 
   /*!
@@ -315,7 +334,7 @@ class CPoint {
    */
   inline long GetVertex(unsigned long iPoint, unsigned long iMarker) const {
     if (Boundary(iPoint))
-      return Vertex[iPoint][iMarker];
+      return VertexData[VertexPtr(iPoint) + iMarker];
     else
       return -1;
   }
@@ -324,10 +343,17 @@ class CPoint {
    * \brief Set if a point belong to the boundary.
    * \param[in] iPoint - Index of the point.
    * \note It also create the structure to store the vertex.
-   * \param[in] nMarker - Max number of marker.
+   * \param[in] nMarker - Max number of marker (the same for all points).
    */
   inline void SetBoundary(unsigned long iPoint, unsigned short nMarker) {
-    if (!Boundary(iPoint)) Vertex[iPoint].resize(nMarker, -1);
+    if (!Boundary(iPoint)) {
+      /*--- The vertices of a point that was reset are stored in the same place. ---*/
+      if (VertexPtr(iPoint) == NO_VERTEX_DATA) {
+        VertexPtr(iPoint) = VertexData.size();
+        VertexData.resize(VertexData.size() + nMarker);
+      }
+      fill_n(VertexData.begin() + VertexPtr(iPoint), nMarker, -1);
+    }
     Boundary(iPoint) = true;
   }
 
@@ -335,10 +361,7 @@ class CPoint {
    * \brief Reset the boundary of a control volume.
    * \param[in] iPoint - Index of the point.
    */
-  inline void ResetBoundary(unsigned long iPoint) {
-    Vertex[iPoint].clear();
-    Boundary(iPoint) = false;
-  }
+  inline void ResetBoundary(unsigned long iPoint) { Boundary(iPoint) = false; }
 
   /*!
    * \brief Mark the point as boundary.
@@ -612,6 +635,12 @@ class CPoint {
    */
   void SetVolume_nM1();
 
+  /*!
+   * \brief Advance the time levels of the volume, same as SetVolume_nM1 followed by SetVolume_n,
+   *        but the storage of times n and n-1 is swapped instead of copied.
+   */
+  void ShiftVolume_n();
+
   /*!
    * \brief Set the volume of the control volume at time n using n-1.
    */
@@ -654,10 +683,16 @@ class CPoint {
    * \param[in] children_CV - Index of the children control volume.
    */
   inline void SetChildren_CV(unsigned long iPoint, unsigned long nchildren_CV, unsigned long children_CV) {
-    Children_CV[iPoint].resize(nchildren_CV + 1);
-    Children_CV[iPoint][nchildren_CV] = children_CV;
+    Children_CV_Agglomeration[iPoint].resize(nchildren_CV + 1);
+    Children_CV_Agglomeration[iPoint][nchildren_CV] = children_CV;
   }
 
+  /*!
+   * \brief Store the children control volumes contiguously once the agglomeration is complete.
+   * \note After this the children cannot be modified.
+   */
+  void FinalizeChildren_CV();
+
   /*!
    * \brief Get the parent control volume of an agglomerated control volume.
    * \param[in] iPoint - Index of the point.
@@ -672,7 +707,16 @@ class CPoint {
    * \return Index of the parent control volume.
    */
   inline unsigned long GetChildren_CV(unsigned long iPoint, unsigned short nchildren_CV) const {
-    return Children_CV[iPoint][nchildren_CV];
+    if (Children_CV.empty()) return Children_CV_Agglomeration[iPoint][nchildren_CV];
+    return Children_CV.getInnerIdx(iPoint, nchildren_CV);
+  }
+
+  /*!
+   * \brief Get inner iterator to loop over the children control volumes of an agglomerated control volume.
+   * \note Only available after FinalizeChildren_CV, the children are stored contiguously (CSR).
+   */
+  inline CCompressedSparsePatternUL::CInnerIter GetChildren(unsigned long iPoint) const {
+    return Children_CV.getInnerIter(iPoint);
   }
 
   /*!
@@ -745,6 +789,12 @@ class CPoint {
    */
   void SetCoord_n1();
 
+  /*!
+   * \brief Advance the time levels of the coordinates, same as SetCoord_n1 followed by SetCoord_n,
+   *        but the storage of times n and n-1 is swapped instead of copied.
+   */
+  void ShiftCoord_n();
+
   /*!
    * \brief Set the coordinates of the control volume at time n, for restart cases.
    * \param[in] iPoint - Index of the point.
@@ -0,0 +1,190 @@
+/*!
+ * \file element_kernels.hpp
+ * \brief Batched kernels for the stiffness matrices of 3D finite elements, the
+ *        integration (Gauss) points of an element are processed as SIMD lanes.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CElement.hpp"
+#include "../../parallelization/vectorization.hpp"
+
+/*!
+ * \namespace ElementKernels
+ * \brief Element kernels for tetrahedra and hexahedra with compile-time sizes. The strain-displacement
+ *        matrices (B) are never formed, their sparsity is exploited directly. The strains are in the
+ *        Voigt order used by the elasticity numerics: xx, yy, zz, xy, xz, yz (engineering shear strains).
+ * \note The callbacks receive the contributions of node pairs (a,b) with b >= a, the caller adds the
+ *       symmetric terms, as the scalar implementations of the numerics do.
+ * \ingroup Elasticity_Equations
+ */
+namespace ElementKernels {
+
+/*--- Vector over the Gauss points of an element. ---*/
+template <size_t NGAUSS>
+using GaussDouble = simd::Array<su2double, NGAUSS>;
+
+/*--- Non-zeros of the columns of B, for each column (displacement component) the rows
+ *    (strain components) and the components of the gradient of the shape function. ---*/
+constexpr unsigned short BRows[3][3] = {{0, 3, 4}, {1, 3, 5}, {2, 4, 5}};
+constexpr unsigned short BGrad[3][3] = {{0, 1, 2}, {1, 0, 2}, {2, 0, 1}};
+
+/*!
+ * \brief Gather the gradients of the shape functions, and the weights times the Jacobian, of an element.
+ * \param[in] element - The element, the gradients for the frame must have been computed.
+ * \param[in] frame - REFERENCE (GradNi_X, J_X) or CURRENT (GradNi_x, J_x) frame.
+ * \param[out] gradN - Gradients of the shape functions, [node][dimension].
+ * \param[out] wJ - Integration weights times the Jacobian.
+ */
+template <size_t NNODE, size_t NGAUSS>
+FORCEINLINE void GatherGradients(const CElement& element, CElement::FrameType frame,
+                                 GaussDouble<NGAUSS> (&gradN)[NNODE][3], GaussDouble<NGAUSS>& wJ) {
+  const bool ref = (frame == CElement::REFERENCE);
+  for (size_t g = 0; g < NGAUSS; ++g) {
+    wJ[g] = element.GetWeight(g) * (ref ? element.GetJ_X(g) : element.GetJ_x(g));
+    for (size_t a = 0; a < NNODE; ++a)
+      for (size_t i = 0; i < 3; ++i)
+        gradN[a][i][g] = ref ? element.GetGradNi_X(a, g, i) : element.GetGradNi_x(a, g, i);
+  }
+}
+
+/*!
+ * \brief Stiffness (B^T.D.B) of an isotropic linear elastic material, which only needs the Lame parameters.
+ * \param[in] gradN - Gradients of the shape functions, [node][dimension].
+ * \param[in] wJ - Integration weights times the Jacobian.
+ * \param[in] lambda - First Lame parameter.
+ * \param[in] mu - Shear modulus.
+ * \param[in] addKab - Callback (a, b, su2double K[3][3]) to store the block of the node pair.
+ */
+template <size_t NNODE, size_t NGAUSS, class F>
+FORCEINLINE void IsotropicStiffness(const GaussDouble<NGAUSS> (&gradN)[NNODE][3], const GaussDouble<NGAUSS>& wJ,
+                                    su2double lambda, su2double mu, const F& addKab) {
+  using Double = GaussDouble<NGAUSS>;
+
+  for (size_t a = 0; a < NNODE; ++a) {
+    Double lambdaGrad[3], muGrad[3];
+    for (size_t i = 0; i < 3; ++i) {
+      lambdaGrad[i] = lambda * wJ * gradN[a][i];
+      muGrad[i] = mu * wJ * gradN[a][i];
+    }
+    for (size_t b = a; b < NNODE; ++b) {
+      const auto& gb = gradN[b];
+      const su2double diag = Double(muGrad[0] * gb[0] + muGrad[1] * gb[1] + muGrad[2] * gb[2]).sum();
+
+      su2double Kab[3][3];
+      for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j)
+          Kab[i][j] = Double(lambdaGrad[i] * gb[j] + muGrad[j] * gb[i]).sum() + (i == j ? diag : 0.0);
+      addKab(a, b, Kab);
+    }
+  }
+}
+
+/*!
+ * \brief Constitutive term (B^T.D.B) of the stiffness, with a symmetric constitutive matrix per Gauss point.
+ * \param[in] gradN - Gradients of the shape functions, [node][dimension].
+ * \param[in] wJ - Integration weights times the Jacobian.
+ * \param[in] D - Constitutive matrix (6x6, Voigt order).
+ * \param[in] addKab - Callback (a, b, su2double K[3][3]) to store the block of the node pair.
+ */
+template <size_t NNODE, size_t NGAUSS, class F>
+FORCEINLINE void ConstitutiveStiffness(const GaussDouble<NGAUSS> (&gradN)[NNODE][3], const GaussDouble<NGAUSS>& wJ,
+                                       const GaussDouble<NGAUSS> (&D)[6][6], const F& addKab) {
+  using Double = GaussDouble<NGAUSS>;
+
+  for (size_t a = 0; a < NNODE; ++a) {
+    /*--- B_a^T.D times the weights, only three entries of each column of B_a are non-zero. ---*/
+    Double BtD[3][6];
+    for (size_t i = 0; i < 3; ++i) {
+      const auto& r = BRows[i];
+      const auto& c = BGrad[i];
+      const Double g0 = wJ * gradN[a][c[0]], g1 = wJ * gradN[a][c[1]], g2 = wJ * gradN[a][c[2]];
+      for (size_t l = 0; l < 6; ++l) BtD[i][l] = g0 * D[r[0]][l] + g1 * D[r[1]][l] + g2 * D[r[2]][l];
+    }
+    for (size_t b = a; b < NNODE; ++b) {
+      const auto& gb = gradN[b];
+      su2double Kab[3][3];
+      for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+          const auto& r = BRows[j];
+          const auto& c = BGrad[j];
+          Kab[i][j] = Double(BtD[i][r[0]] * gb[c[0]] + BtD[i][r[1]] * gb[c[1]] + BtD[i][r[2]] * gb[c[2]]).sum();
+        }
+      }
+      addKab(a, b, Kab);
+    }
+  }
+}
+
+/*!
+ * \brief Nodal stress term of the residual, the integral of sigma.grad(N_a).
+ * \param[in] gradN - Gradients of the shape functions in the current frame, [node][dimension].
+ * \param[in] wJ - Integration weights times the Jacobian of the current frame.
+ * \param[in] stress - Symmetric Cauchy stress tensor.
+ * \param[in] addKta - Callback (a, const su2double Kt[3]) to store the term of each node.
+ */
+template <size_t NNODE, size_t NGAUSS, class F>
+FORCEINLINE void NodalStressTerm(const GaussDouble<NGAUSS> (&gradN)[NNODE][3], const GaussDouble<NGAUSS>& wJ,
+                                 const GaussDouble<NGAUSS> (&stress)[3][3], const F& addKta) {
+  using Double = GaussDouble<NGAUSS>;
+
+  Double wStress[3][3];
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 3; ++j) wStress[i][j] = wJ * stress[i][j];
+
+  for (size_t a = 0; a < NNODE; ++a) {
+    const auto& ga = gradN[a];
+    su2double Kta[3];
+    for (size_t i = 0; i < 3; ++i)
+      Kta[i] = Double(wStress[i][0] * ga[0] + wStress[i][1] * ga[1] + wStress[i][2] * ga[2]).sum();
+    addKta(a, Kta);
+  }
+}
+
+/*!
+ * \brief Stress (geometric) term of the stiffness, the integral of grad(N_a).sigma.grad(N_b).
+ * \param[in] gradN - Gradients of the shape functions in the current frame, [node][dimension].
+ * \param[in] wJ - Integration weights times the Jacobian of the current frame.
+ * \param[in] stress - Symmetric Cauchy stress tensor.
+ * \param[in] addKsab - Callback (a, b, su2double Ks) to store the term of the node pair.
+ */
+template <size_t NNODE, size_t NGAUSS, class F>
+FORCEINLINE void StressStiffness(const GaussDouble<NGAUSS> (&gradN)[NNODE][3], const GaussDouble<NGAUSS>& wJ,
+                                 const GaussDouble<NGAUSS> (&stress)[3][3], const F& addKsab) {
+  using Double = GaussDouble<NGAUSS>;
+
+  for (size_t a = 0; a < NNODE; ++a) {
+    Double sGrad[3];
+    for (size_t i = 0; i < 3; ++i)
+      sGrad[i] = wJ * (gradN[a][0] * stress[0][i] + gradN[a][1] * stress[1][i] + gradN[a][2] * stress[2][i]);
+
+    for (size_t b = a; b < NNODE; ++b) {
+      const auto& gb = gradN[b];
+      addKsab(a, b, Double(sGrad[0] * gb[0] + sGrad[1] * gb[1] + sGrad[2] * gb[2]).sum());
+    }
+  }
+}
+
+}  // namespace ElementKernels
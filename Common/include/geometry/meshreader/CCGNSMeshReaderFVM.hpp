@@ -30,6 +30,9 @@
 
 #ifdef HAVE_CGNS
 #include "cgnslib.h"
+#ifdef HAVE_MPI
+#include "pcgnslib.h"
+#endif
 #endif
 
 #include "CMeshReaderFVM.hpp"
@@ -45,6 +48,7 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
   int cgnsFileID;         /*!< \brief CGNS file identifier. */
   const int cgnsBase = 1; /*!< \brief CGNS database index (the CGNS reader currently assumes a single database). */
   const int cgnsZone = 1; /*!< \brief CGNS zone index (and 1 zone in that database). */
+  bool parallelIO = false; /*!< \brief File opened with the parallel (HDF5) API, for collective reads. */
 
   int nSections; /*!< \brief Total number of sections in the CGNS file. */
 
@@ -0,0 +1,89 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CMeshReaderFVM.hpp"
+#include "SU2BinaryMesh.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid (see SU2BinaryMesh.hpp) into linear partitions for the finite volume
+ *        solver (FVM). Each rank reads its chunk of points and elements with collective (MPI-IO) reads,
+ *        the elements are then sent to the ranks that own their points.
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief Handle of the mesh file. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief Handle of the mesh file. */
+#endif
+
+  uint64_t header[SU2BinaryMesh::HEADER_SIZE] = {}; /*!< \brief Header of the file. */
+
+  /*!
+   * \brief Collective read of a block of bytes (the size can be different, including 0, on each rank).
+   * \param[in] offset - Position in the file (bytes).
+   * \param[in] nBytes - Number of bytes to read.
+   * \param[out] buffer - Where to read to.
+   */
+  void ReadBlock(uint64_t offset, uint64_t nBytes, void* buffer);
+
+  /*!
+   * \brief Reads and checks the header of the file.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of the linear partition of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and sends them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the markers, the surface connectivity is only read by the master rank.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+};
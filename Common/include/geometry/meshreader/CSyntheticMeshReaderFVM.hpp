@@ -0,0 +1,113 @@
+/*!
+ * \file CSyntheticMeshReaderFVM.hpp
+ * \brief Header file for the class CSyntheticMeshReaderFVM.
+ *        The implementations are in the <i>CSyntheticMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSyntheticMeshReaderFVM
+ * \brief Generates a structured 3D grid directly into the linear partitions for the finite volume solver (FVM),
+ *        each rank only visits its own points and the elements around them, such that very large meshes can be
+ *        generated without mesh files (weak-scaling benchmarks).
+ * \details The grid has MESH_BOX_SIZE points, the cells are hexahedra, tetrahedra (six per hexahedron,
+ *          conforming), or prisms in the first SYNTHETIC_MESH_LAYERS cell layers above y_minus and tetrahedra
+ *          elsewhere (HYBRID). The spacing in y can grow geometrically from y_minus (boundary layer). The BOX
+ *          geometry is that of CBoxMeshReaderFVM, with ANNULUS, x is the axial coordinate, y the radius, and z the
+ *          angle (degrees), for rotationally periodic (z_minus, z_plus) and sliding (x_minus, x_plus) test cases.
+ */
+class CSyntheticMeshReaderFVM : public CMeshReaderFVM {
+ private:
+  /*!
+   * \brief An element of a cell, defined by the (i,j,k) offsets of its nodes from the first node of the cell.
+   */
+  struct CellElement {
+    unsigned short vtkType = 0;
+    unsigned short nNodes = 0;
+    std::array<std::array<unsigned short, 3>, N_POINTS_HEXAHEDRON> offsets{};
+  };
+
+  unsigned long nNode[3] = {0}; /*!< \brief Number of grid nodes in each direction. */
+
+  vector<passivedouble> nodeCoord[3]; /*!< \brief Coordinates of the grid lines in each direction (before mapping). */
+
+  SYNTHETIC_MESH_GEOM geometryType; /*!< \brief Shape of the domain. */
+  SYNTHETIC_MESH_ELEM elementType;  /*!< \brief Kind of elements. */
+  unsigned long nLayers = 0;        /*!< \brief Cell layers of prisms for HYBRID. */
+
+  vector<CellElement> hexaCell;  /*!< \brief Elements of a hexahedral cell. */
+  vector<CellElement> tetraCell; /*!< \brief Elements of a tetrahedral cell. */
+  vector<CellElement> prismCell; /*!< \brief Elements of a prismatic cell. */
+
+  vector<unsigned long> elementsBeforeRow; /*!< \brief Elements before each j row of a k plane of cells. */
+
+  /*!
+   * \brief Elements of the cells in the j-th layer.
+   */
+  inline const vector<CellElement>& CellElements(unsigned long j) const {
+    if (elementType == SYNTHETIC_MESH_ELEM::HEXAHEDRA) return hexaCell;
+    if (elementType == SYNTHETIC_MESH_ELEM::HYBRID && j < nLayers) return prismCell;
+    return tetraCell;
+  }
+
+  /*!
+   * \brief Global index of a point.
+   */
+  inline unsigned long PointIndex(unsigned long i, unsigned long j, unsigned long k) const {
+    return (k * nNode[1] + j) * nNode[0] + i;
+  }
+
+  /*!
+   * \brief Builds the elements of each kind of cell, with positive orientation.
+   */
+  void SetCellElements();
+
+  /*!
+   * \brief Computes the coordinates of the grid lines, and those of the points of this rank.
+   */
+  void ComputePointCoordinates();
+
+  /*!
+   * \brief Computes the connectivity of the elements that have a point in this rank.
+   */
+  void ComputeVolumeConnectivity();
+
+  /*!
+   * \brief Computes the connectivity of the faces of the elements on the six sides (master rank).
+   */
+  void ComputeSurfaceConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSyntheticMeshReaderFVM class.
+   */
+  CSyntheticMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+};
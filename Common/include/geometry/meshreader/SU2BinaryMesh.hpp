@@ -0,0 +1,97 @@
+/*!
+ * \file SU2BinaryMesh.hpp
+ * \brief Layout of the native SU2 binary mesh format, shared by the reader
+ *        (CSU2BinaryMeshReaderFVM) and the writer (CSU2MeshFileWriter).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/*!
+ * \brief Native binary mesh format (single zone). All integers are 64-bit unsigned and all
+ *        coordinates are doubles, in the native byte order. The file is made of:
+ *        - The header, HEADER_SIZE integers, see HeaderField;
+ *        - The point coordinates, NPOINT x NDIM doubles (point-major);
+ *        - The element offset table, NELEM+1 integers, position of each element in the connectivity block;
+ *        - The element connectivity block, CONN_SIZE integers, [VTK type, nodes...] for each element;
+ *        - The marker table, NMARKER MarkerEntry;
+ *        - The surface connectivity blocks, [VTK type, nodes...] for each element of each marker.
+ * \note The offsets allow each rank to read only its linear partition of points and elements,
+ *       without parsing the rest of the file.
+ * \ingroup Geometry
+ */
+namespace SU2BinaryMesh {
+
+constexpr uint64_t MagicNumber = 0x5355324d455348;  /*!< \brief Hex representation of "SU2MESH". */
+constexpr uint64_t Version = 1;                     /*!< \brief Version of the layout. */
+constexpr int MarkerNameSize = 256;                 /*!< \brief Fixed size of the marker names. */
+
+/*!
+ * \brief Position of the header fields, the offsets are in bytes from the start of the file.
+ */
+enum HeaderField : int {
+  MAGIC,
+  VERSION,
+  NDIM,
+  NPOINT,
+  NELEM,
+  NMARKER,
+  CONN_SIZE,
+  POINT_OFFSET,
+  ELEM_INDEX_OFFSET,
+  ELEM_CONN_OFFSET,
+  MARKER_OFFSET,
+  HEADER_SIZE = 16 /*!< \brief The remaining fields are reserved. */
+};
+
+/*!
+ * \brief Entry of the marker table, the offset of the connectivity is in bytes from the start of the file.
+ */
+struct MarkerEntry {
+  char name[MarkerNameSize];
+  uint64_t nElem;
+  uint64_t connOffset;
+  uint64_t connSize;
+};
+static_assert(sizeof(MarkerEntry) == MarkerNameSize + 3 * sizeof(uint64_t), "Unexpected padding.");
+
+/*!
+ * \brief Read the header of a binary mesh file (serial, only for metadata).
+ * \param[in] filename - Name of the mesh file.
+ * \param[out] header - The HEADER_SIZE fields of the header.
+ * \return False if the file cannot be read or it is not an SU2 binary mesh.
+ */
+inline bool ReadHeader(const std::string& filename, uint64_t* header) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file.read(reinterpret_cast<char*>(header), HEADER_SIZE * sizeof(uint64_t))) return false;
+  return header[MAGIC] == MagicNumber;
+}
+
+}  // namespace SU2BinaryMesh
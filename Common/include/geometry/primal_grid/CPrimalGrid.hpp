@@ -48,8 +48,12 @@ class CPrimalGrid {
    * If this is a boundary element, stores the index of the adjacent domain element. */
   unsigned long GlobalIndex_DomainElement;
 
-  std::unique_ptr<unsigned long[]> Nodes;    /*!< \brief Global node indices of the element. */
-  std::unique_ptr<long[]> Neighbor_Elements; /*!< \brief Vector to store the elements surronding this element. */
+  unsigned long* Nodes;     /*!< \brief Global node indices of the element. */
+  long* Neighbor_Elements;  /*!< \brief Vector to store the elements surronding this element. */
+
+  /*--- Storage of the nodes and neighbors of the FEM elements, the others store them inline. ---*/
+  std::unique_ptr<unsigned long[]> NodesFEM;
+  std::unique_ptr<long[]> Neighbor_ElementsFEM;
 
   su2double Coord_CG[3] = {0.0}; /*!< \brief Coordinates of the center-of-gravity of the element. */
   su2double Volume;              /*!< \brief Volume of the element. */
@@ -77,6 +81,17 @@ class CPrimalGrid {
    */
   CPrimalGrid(bool FEM, unsigned short nNodes, unsigned short nNeighbor_Elements);
 
+  /*!
+   * \brief Constructor of the class, for elements that store the nodes and neighbors themselves.
+   * \param[in] FEM - Whether this is a FEM element.
+   * \param[in] nodes - Storage of the nodes.
+   * \param[in] neighbor_Elements - Storage of the neighbor elements, initialized by the derived class.
+   */
+  CPrimalGrid(bool FEM, unsigned long* nodes, long* neighbor_Elements);
+
+  CPrimalGrid(const CPrimalGrid&) = delete;
+  CPrimalGrid& operator=(const CPrimalGrid&) = delete;
+
   /*!
    * \brief Destructor of the class.
    */
@@ -466,8 +481,15 @@ class CPrimalGrid {
  */
 template <typename Connectivity>
 class CPrimalGridWithConnectivity : public CPrimalGrid {
+ private:
+  /*--- Inline storage, avoids two small heap allocations per element. ---*/
+  unsigned long NodeStorage[Connectivity::nNodes];
+  long NeighborStorage[Connectivity::nFaces > 0 ? Connectivity::nFaces : 1];
+
  public:
-  CPrimalGridWithConnectivity(bool FEM) : CPrimalGrid(FEM, Connectivity::nNodes, Connectivity::nFaces) {}
+  CPrimalGridWithConnectivity(bool FEM) : CPrimalGrid(FEM, NodeStorage, NeighborStorage) {
+    for (auto& neighbor : NeighborStorage) neighbor = -1;
+  }
 
   inline unsigned short GetnNodes() const final { return Connectivity::nNodes; }
 
@@ -74,6 +74,8 @@ class CFreeFormDefBox : public CGridMovement {
   vector<unsigned short> Fix_KPlane;    /*!< \brief Fix FFD K plane. */
 
   CFreeFormBlending** BlendingFunction;
+  mutable vector<su2double> BasisValues[3]; /*!< \brief Work arrays, values of the univariate bases at a point. */
+  mutable vector<su2double> BasisDerivatives[2][3]; /*!< \brief Work arrays, 1st and 2nd derivatives of the bases. */
 
  public:
   /*!
@@ -591,11 +593,28 @@ class CFreeFormDefBox : public CGridMovement {
   /*!
    * \brief Here we take the parametric coords of a point in the box and we convert them to the
    *        physical cartesian coords by plugging the ParamCoords on the Bezier parameterization of our box.
+   * \note The univariate bases are evaluated once per direction, and the control points where the basis
+   *       is zero (outside the support of B-splines) are skipped, which also keeps them out of the AD tape.
    * \param[in] ParamCoord - Parametric coordinates of a point.
    * \return Pointer to the cartesian coordinates of a point.
    */
   su2double* EvalCartesianCoord(su2double* ParamCoord) const;
 
+  /*!
+   * \brief Computes the derivatives of the cartesian coordinates w.r.t. the parametric coordinates of a point.
+   * \param[in] ParamCoord - Parametric coordinates of a point.
+   * \param[out] val_Jacobian - dX_i / du_j.
+   */
+  void EvalParametricJacobian(const su2double* ParamCoord, su2double val_Jacobian[][3]) const;
+
+  /*!
+   * \brief Evaluates the univariate bases (and optionally their derivatives) of the three directions at a point,
+   *        the tensor-product evaluations then only multiply these values (stored in the work arrays).
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[in] nDerivatives - Number of derivatives (0, 1, or 2).
+   */
+  void EvalUnivariateBases(const su2double* uvw, unsigned short nDerivatives) const;
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -657,90 +676,15 @@ class CFreeFormDefBox : public CGridMovement {
   void SetDeformationZone(CGeometry* geometry, CConfig* config, unsigned short iFFDBox) const;
 
   /*!
-   * \brief The routine computes the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2  evaluated at (u, v, w).
-   * \param[in] val_coord - Parametric coordiates of the target point.
-   * \param[in] xyz - Cartesians coordinates of the point.
-   * \param[in] analytical - Compute the analytical gradient.
-   * \return Value of the analytical gradient.
-   */
-  su2double* GetFFDGradient(su2double* val_coord, su2double* xyz);
-
-  /*!
-   * \brief The routine that computes the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 evaluated at (u, v, w)
-   *        Input: (u, v, w), (x, y, z)
-   *        Output: Hessian F (u, v, w).
+   * \brief Computes the gradient and the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 in a single pass over
+   *        the control points, evaluating each univariate basis (and its derivatives) only once.
    * \param[in] uvw - Current value of the parametrics coordinates.
    * \param[in] xyz - Cartesians coordinates of the target point to compose the functional.
-   * \param[in] val_Hessian - Value of the hessian.
-   */
-  void GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian);
-
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)^2+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)^2
-   *        Input: val_t, val_diff (to identify the index of the Bernstein polynomail we differentiate), the i, j, k ,
-   * l, m, n E.G.: val_diff=2 => we differentiate w.r.t. w  (val_diff=0,1, or 2) Output: d [B_i^l*B_j^m *B_k^n] / d
-   * val_diff (val_u, val_v, val_w). \param[in] uvw - __________. \param[in] val_diff - __________. \param[in] ijk -
-   * __________. \param[in] lmn - Degree of the FFD box. \return __________.
-   */
-  su2double GetDerivative1(su2double* uvw, unsigned short val_diff, unsigned short* ijk, unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)^2+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)^2
-   *        Input: (u, v, w), dim , xyz=(x, y, z), l, m, n E.G.: dim=2 => we use the third coordinate of the control
-   * points, and the z-coordinate of xyz  (0<=dim<=2) Output: 2* ( (Sum_{i, j, k}^l, m, n P_{ijk}[dim] B_i^l[u] B_j^m[v]
-   * B_k^n[w]) - xyz[dim]). \param[in] uvw - __________. \param[in] dim - __________. \param[in] xyz - __________.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return __________.
-   */
-  su2double GetDerivative2(su2double* uvw, unsigned short dim, const su2double* xyz, const unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   * \param[in] uvw - Parametric coordiates of the point.
-   * \param[in] dim - Value of the coordinate to be differentiate.
-   * \param[in] diff_this - Diferentiation with respect this coordinate.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return Sum_{i, j, k}^{l, m, n} [one of them with -1,
-   *        depending on diff_this=0,1 or 2] P_{ijk}[dim] * (B_i^l[u] B_j^m[v] B_k^n[w])--one of them diffrentiated;
-   *        which? diff_thiss will tell us ; E.G.: dim=2, diff_this=1 => we use the third coordinate of the control
-   *        points, and derivate de v-Bersntein polynomial (use m-1 when summing!!).
-   */
-  su2double GetDerivative3(su2double* uvw, unsigned short dim, unsigned short diff_this, unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   *        Input: val_t, val_diff, val_diff2 (to identify the index of the Bernstein polynomials we differentiate), the
-   * i, j, k , l, m, n E.G.: val_diff=1, val_diff2=2  =>  we differentiate w.r.t. v and w  (val_diff=0,1, or 2) E.G.:
-   * val_diff=0, val_diff2=0 => we differentiate w.r.t. u two times Output: [d [B_i^l*B_j^m *B_k^n]/d val_diff *d
-   * [B_i^l*B_j^m *B_k^n]/d val_diff2] (val_u, val_v, val_w) . \param[in] uvw - __________. \param[in] val_diff -
-   * __________. \param[in] val_diff2 - __________. \param[in] ijk - __________. \param[in] lmn - Degree of the FFD box.
-   * \return __________.
-   */
-  su2double GetDerivative4(su2double* uvw, unsigned short val_diff, unsigned short val_diff2, unsigned short* ijk,
-                           unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   *        Input: (u, v, w), dim , diff_this, diff_this_also, xyz=(x, y, z), l, m, n
-   *        Output:
-   *        Sum_{i, j, k}^{l, m, n} [two of them with -1, depending on diff_this, diff_this_also=0,1 or 2]
-   *        P_{ijk}[dim] * (B_i^l[u] B_j^m[v] B_k^n[w])--one of them diffrentiated; which? diff_thiss will tell us ;
-   *        E.G.: dim=2, diff_this=1 => we use the third coordinate of the control points, and derivate de v-Bersntein
-   *        polynomial (use m-1 when summing!!).
-   * \param[in] uvw - __________.
-   * \param[in] dim - __________.
-   * \param[in] diff_this - __________.
-   * \param[in] diff_this_also - __________.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return __________.
+   * \param[out] val_Gradient - Value of the gradient.
+   * \param[out] val_Hessian - Value of the hessian.
    */
-  su2double GetDerivative5(su2double* uvw, unsigned short dim, unsigned short diff_this, unsigned short diff_this_also,
-                           unsigned short* lmn) const;
+  void GetFFDGradientHessian(const su2double* uvw, const su2double* xyz, su2double* val_Gradient,
+                             su2double** val_Hessian) const;
 
   /*!
    * \brief Euclidean norm of a vector.
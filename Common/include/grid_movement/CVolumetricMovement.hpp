@@ -48,15 +48,56 @@ class CVolumetricMovement : public CGridMovement {
   unsigned long nIterMesh; /*!< \brief Number of iterations in the mesh update. +*/
 
 #ifndef CODI_FORWARD_TYPE
-  CSysMatrix<su2mixedfloat> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
-  CSysSolve<su2mixedfloat> System;       /*!< \brief Linear solver/smoother. */
+  using StiffScalar = su2mixedfloat;
 #else
-  CSysMatrix<su2double> StiffMatrix;
-  CSysSolve<su2double> System;
+  using StiffScalar = su2double;
 #endif
+  CSysMatrix<StiffScalar> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
+  CSysSolve<StiffScalar> System;       /*!< \brief Linear solver/smoother. */
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  unsigned long StiffMatrixAge = 0; /*!< \brief Number of solves with the current stiffness matrix, 0 if not valid. */
+
+  /*--- Previous deformations for the warm start (see DEFORM_WARM_START), the solutions are stored
+   * minus their r.h.s., i.e. only the displacements of the nodes that are not prescribed. ---*/
+  vector<CSysVector<su2double> > WarmStartRes; /*!< \brief R.h.s. (boundary displacements) of previous deformations. */
+  vector<CSysVector<su2double> > WarmStartSol; /*!< \brief Solution minus r.h.s. of previous deformations. */
+
+  /*!
+   * \brief Predict the initial guess of the deformation from previous ones, by least squares fit of the
+   *        current r.h.s. (LinSysRes) with the previous r.h.s. (the problem is linear for a fixed stiffness).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Norm of the residual of the cold start, the linear tolerance is relative to it (0 if no history).
+   */
+  su2double SetWarmStart(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Add the current deformation (LinSysRes, LinSysSol) to the warm start history, dropping the oldest.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void StoreWarmStart(const CConfig* config);
+
+  /*!
+   * \brief Identify the coordinate axis normal to a (planar, axis aligned) symmetry plane.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iMarker - Index of the symmetry plane marker.
+   * \return Axis along which the displacements of the plane are zero.
+   */
+  unsigned short GetSymmetryAxis(CGeometry* geometry, unsigned short iMarker) const;
+
+  /*!
+   * \brief Grid deformation by radial basis function interpolation of the boundary displacements.
+   * \note The RBF centers are a subset of the boundary points, selected greedily where the interpolation
+   *       error is largest, there is no linear solve, and the volume points are evaluated in parallel.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] UpdateGeo - Update geometry.
+   * \param[in] Screen_Output - Print information about the deformation.
+   */
+  void SetVolume_Deformation_RBF(CGeometry* geometry, CConfig* config, bool UpdateGeo, bool Screen_Output);
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -87,6 +128,15 @@ class CVolumetricMovement : public CGridMovement {
    */
   void UpdateDualGrid(CGeometry* geometry, CConfig* config);
 
+  /*!
+   * \brief Update the dual grid after a rigid motion, by transforming the metrics if RIGID_MOTION_TRANSFORM_METRICS
+   *        is set, i.e. the normals are rotated and the volumes are kept, otherwise as UpdateDualGrid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation of the motion, nullptr for translations.
+   */
+  void UpdateDualGrid_Rigid(CGeometry* geometry, CConfig* config, const su2double rotMatrix[][3]);
+
   /*!
    * \brief Update the coarse multigrid levels after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
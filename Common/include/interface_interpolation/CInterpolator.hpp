@@ -31,6 +31,7 @@
 #include "../../include/containers/container_decorators.hpp"
 #include <vector>
 #include <algorithm>
+#include <functional>
 
 class CConfig;
 class CGeometry;
@@ -85,6 +86,9 @@ class CInterpolator {
   CGeometry* const donor_geometry;  /*! \brief Donor geometry. */
   CGeometry* const target_geometry; /*! \brief Target geometry. */
 
+  unsigned long transferCoeffVersion = 0; /*! \brief Incremented each time the transfer coefficients are computed. */
+  bool transferCoeffFromCache = false;    /*! \brief The initial coefficients were read from the cache file. */
+
  public:
   struct CDonorInfo {
     vector<int> processor;
@@ -132,6 +136,18 @@ class CInterpolator {
    */
   virtual void PrintStatistics(void) const {}
 
+  /*!
+   * \brief Get the version of the transfer coefficients, it changes each time they are (re)computed, which
+   *        allows users of targetVertices (e.g. communication plans) to detect that they are outdated.
+   */
+  inline unsigned long GetTransferCoeffVersion() const { return transferCoeffVersion; }
+
+  /*!
+   * \brief Whether the initial transfer coefficients were read from the cache instead of computed,
+   *        in which case there are no statistics to print.
+   */
+  inline bool GetTransferCoeffFromCache() const { return transferCoeffFromCache; }
+
   /*!
    * \brief Check whether an interface should be processed or not, i.e. if it is part of the zones.
    * \param[in] val_markDonor  - Marker tag from donor zone.
@@ -147,6 +163,14 @@ class CInterpolator {
   static bool CheckZonesInterface(const CConfig* donor, const CConfig* target);
 
  protected:
+  /*!
+   * \brief Set up the initial transfer matrix, reading it from the cache file (INTERPOLATION_CACHE_FILENAME)
+   *        if it matches the interface, otherwise computing it (SetTransferCoeff) and writing the cache.
+   * \note To be called by the constructors of the derived classes, later updates use SetTransferCoeff.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitTransferCoeff(const CConfig* const* config);
+
   /*!
    * \brief Reconstruct the boundary connectivity from parallel partitioning and broadcasts it to all threads.
    * \param[in] val_zone   - index of the zone
@@ -186,4 +210,85 @@ class CInterpolator {
   unsigned long Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
                                     vector<unsigned long>& allNumElem, vector<unsigned short>& numNodes,
                                     su2matrix<long>& idxNodes) const;
+
+  /*!
+   * \brief Search done by the donor ranks for the target coordinates they receive in DistributedDonorSearch.
+   * \details The arguments are the target coordinates and the floating point and integer parts of the result.
+   *          The first floating point value must be the squared distance beyond which no better donor can exist
+   *          (used to decide what other ranks need to be searched). Returns false if there are no local donors.
+   * \note Called concurrently by multiple threads.
+   */
+  using LocalDonorSearch = std::function<bool(const su2double*, su2double*, unsigned long*)>;
+
+  /*!
+   * \brief Find the donors of the target vertices of an interface without gathering the donor surface.
+   * \details The ranks exchange the bounding boxes of their donor points, each target vertex is sent to the rank
+   *          with the closest box, and then to the other ranks whose box is closer than the distance that was found.
+   *          The donor ranks run a local search (e.g. with an ADT) and reply point-to-point.
+   * \note Collective, all ranks must call this for each interface marker.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] localDonorCoord - Coordinates of the donor points searched by this rank (defines its bounding box).
+   * \param[in] nReal - Number of floating point values per result.
+   * \param[in] nInt - Number of integer values per result.
+   * \param[in] localSearch - The local search.
+   * \param[out] resultStart - Results of target vertex "i" are in rows [resultStart[i], resultStart[i+1]).
+   * \param[out] real - Floating point part of the results.
+   * \param[out] integer - Integer part of the results.
+   */
+  void DistributedDonorSearch(int markTarget, unsigned short nDim, const vector<su2double>& localDonorCoord,
+                              unsigned long nReal, unsigned long nInt, const LocalDonorSearch& localSearch,
+                              vector<unsigned long>& resultStart, su2activematrix& real,
+                              su2matrix<unsigned long>& integer) const;
+
+  /*!
+   * \brief Find the ranks that own (as domain points) some global points of the donor boundary.
+   * \note Collective, uses a distributed directory instead of gathering all the points.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] globalPoints - Global indices of the points.
+   * \param[out] owners - Rank that owns each point.
+   */
+  void FindDonorOwners(int markDonor, const vector<unsigned long>& globalPoints, vector<int>& owners) const;
+
+ private:
+  /*!
+   * \brief Send target coordinates to other ranks, run the local search there, and receive the results.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] nReal - Number of floating point values per result.
+   * \param[in] nInt - Number of integer values per result.
+   * \param[in] queryVertex - Target vertices to send to each rank.
+   * \param[in] localSearch - The local search.
+   * \param[out] real - Floating point part of the results, ordered as queryVertex.
+   * \param[out] integer - Integer part of the results, with an extra column indicating success.
+   */
+  void ExchangeDonorQueries(int markTarget, unsigned short nDim, unsigned long nReal, unsigned long nInt,
+                            const vector<vector<unsigned long> >& queryVertex, const LocalDonorSearch& localSearch,
+                            su2activematrix& real, su2matrix<unsigned long>& integer) const;
+
+  /*!
+   * \brief Key of the transfer coefficient cache, a hash of the interpolation options and of the
+   *        (global index, coordinates) of the vertices of the interface markers.
+   * \note Collective, the key does not depend on the partitioning.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long TransferCoeffCacheKey(const CConfig* const* config) const;
+
+  /*!
+   * \brief Read the transfer coefficients of the owned target vertices from a cache file.
+   * \note Collective, the ranks of the donor points are not stored, they are found again.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] fileName - Name of the cache file.
+   * \param[in] key - Expected key of the cache.
+   * \return False on all ranks if the file is missing, outdated, or incomplete for any rank.
+   */
+  bool ReadTransferCoeffCache(const CConfig* const* config, const string& fileName, unsigned long key);
+
+  /*!
+   * \brief Gather the transfer coefficients on the master rank and write them to a cache file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] fileName - Name of the cache file.
+   * \param[in] key - Key of the cache.
+   */
+  void WriteTransferCoeffCache(const CConfig* const* config, const string& fileName, unsigned long key) const;
 };
@@ -30,9 +30,8 @@
 
 /*!
  * \brief Nearest Neighbor(s) interpolation.
- * \note The closest k neighbors are used for IDW interpolation, the computational
- * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using an ADT.
+ * \note The closest k neighbors are used for IDW interpolation. The search is distributed,
+ * each rank only searches an ADT of its donor points.
  * \ingroup Interfaces
  */
 class CNearestNeighbor final : public CInterpolator {
@@ -46,6 +45,11 @@ class CNearestNeighbor final : public CInterpolator {
     unsigned pidx;
     int proc;
     DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) {}
+
+    /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
+    bool operator<(const DonorInfo& other) const {
+      return (dist != other.dist) ? (dist < other.dist) : (pidx < other.pidx);
+    }
   };
 
  public:
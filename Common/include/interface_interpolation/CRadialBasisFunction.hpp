@@ -32,6 +32,9 @@
 
 /*!
  * \brief Radial basis function interpolation.
+ * \note By default one (dense) RBF is built for all the donor points of an interface, which
+ * scales as O(N^3). With RADIAL_BASIS_FUNCTION_LOCAL_POINTS each target point uses an RBF of its
+ * closest donors instead, which scales linearly and is found with a distributed search.
  * \ingroup Interfaces
  */
 class CRadialBasisFunction final : public CInterpolator {
@@ -101,6 +104,20 @@ class CRadialBasisFunction final : public CInterpolator {
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix& P);
 
  private:
+  /*!
+   * \brief Set up the transfer matrix with local RBF patches.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLocalTransferCoeff(const CConfig* const* config);
+
+  /*!
+   * \brief Reduce the interpolation statistics over all ranks and check for target points without donors.
+   * \param[in] totalTargetPoints - Local number of target points.
+   * \param[in] totalDonorPoints - Local number of donors (sum over target points).
+   * \param[in] denseSize - Local size of the equivalent dense interpolation matrix.
+   */
+  void ReduceStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints, unsigned long denseSize);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
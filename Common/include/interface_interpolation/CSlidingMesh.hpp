@@ -52,6 +52,31 @@ class CSlidingMesh final : public CInterpolator {
   void SetTransferCoeff(const CConfig* const* config) override;
 
  private:
+  /*! \brief Coefficients of each time step of the interface period (see SLIDING_INTERFACE_PERIOD_STEPS), this
+   *         requires storing one copy of the coefficients per time step of the period. */
+  vector<vector<vector<CDonorInfo> > > cachedTargetVertices;
+
+  /*! \brief Index (in the reconstructed donor boundary) of the closest donor node of each target vertex, per marker,
+   *         used as the starting point of the search at the next computation of the coefficients. */
+  vector<vector<unsigned long> > closestDonor;
+
+  /*!
+   * \brief Find the closest donor node to a point, by walking over the donor surface from an initial guess.
+   * \note Falls back to a brute force search if the guess is not valid or the walk ends far from the point.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] coord - Coordinates of the point.
+   * \param[in] donorCoord - Coordinates of the donor boundary nodes.
+   * \param[in] nLinkedNodes - Number of neighbors of each donor node.
+   * \param[in] startLinkedNodes - Start index of the neighbors of each donor node in linkedNodes.
+   * \param[in] linkedNodes - Neighbors of the donor nodes.
+   * \param[in] guess - Initial guess, values greater than the number of donor nodes are ignored.
+   * \return Index of the closest donor node.
+   */
+  static unsigned long FindClosestDonor(unsigned short nDim, const su2double* coord, const su2activematrix& donorCoord,
+                                        const su2vector<unsigned long>& nLinkedNodes,
+                                        const su2vector<unsigned long>& startLinkedNodes,
+                                        const su2vector<unsigned long>& linkedNodes, unsigned long guess);
+
   /*!
    * \brief For 3-Dimensional grids, build the dual surface element
    * \param[in] map         - array containing the index of the boundary points connected to the node
@@ -0,0 +1,279 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Smoothed aggregation algebraic multigrid for block-sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Smoothed aggregation AMG hierarchy built from a block-CSR matrix (the format of CSysMatrix).
+ * \note The hierarchy is rank-local, the fine level only considers the columns of domain points,
+ *       i.e. across ranks this is an additive (block-Jacobi type) method, like the ILU preconditioner.
+ *       The aggregates are only computed once since the sparse pattern of the fine matrix is fixed,
+ *       subsequent calls to Build only recompute the transfer and coarse operators.
+ *       By default the tentative prolongation injects the block variables (the near null space is
+ *       the constant for each variable). A near null space can be given instead (e.g. the rigid body
+ *       modes for elasticity), then the tentative prolongation is the local QR factorization of the
+ *       modes of each aggregate, and the coarse levels have one variable per mode.
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  enum : unsigned long { MAXNVAR = 20 };       /*!< \brief Consistent with CSysMatrix. */
+  enum : unsigned long { OMP_MIN_SIZE = 32 };  /*!< \brief Chunk size for the thread-parallel loops. */
+  enum : unsigned long { MAX_DENSE_SIZE = 1024 }; /*!< \brief Max size of the coarsest system for a direct solve. */
+
+  /*!
+   * \brief Block-CSR matrix, either owning its data or viewing the fine matrix.
+   */
+  struct BlockCSR {
+    unsigned long nRow = 0, nCol = 0;
+    const su2localindex* rowPtr = nullptr;
+    const su2localindex* colInd = nullptr;
+    const ScalarType* val = nullptr;
+
+    std::vector<su2localindex> rowPtrData, colIndData;
+    std::vector<ScalarType> valData;
+
+    /*! \brief Point the public pointers to the owned data. */
+    void SetPointers() {
+      rowPtr = rowPtrData.data();
+      colInd = colIndData.data();
+      val = valData.data();
+    }
+  };
+
+  /*!
+   * \brief One level of the hierarchy, the transfer operators connect it to the next (coarser) level.
+   */
+  struct CLevel {
+    unsigned long nVar = 0;             /*!< \brief Block size of this level. */
+    BlockCSR A;                         /*!< \brief System matrix. */
+    BlockCSR P;                         /*!< \brief Prolongation from the next level. */
+    BlockCSR R;                         /*!< \brief Restriction to the next level (P transposed). */
+    std::vector<ScalarType> invDiag;    /*!< \brief Inverse of the diagonal blocks. */
+    ScalarType omega = 0;               /*!< \brief Damping 4 / (3 rho(D^-1 A)) of the prolongation smoothing. */
+    std::vector<unsigned long> aggregate; /*!< \brief Index of the aggregate of each point. */
+    unsigned long nAggregates = 0;        /*!< \brief Number of points of the next level. */
+    std::vector<ScalarType> T;            /*!< \brief Tentative prolongation blocks of each point (empty = identity). */
+    std::vector<ScalarType> B;            /*!< \brief Near null space of the coarse levels, nModes columns per point. */
+    mutable std::vector<ScalarType> x, b, r; /*!< \brief Working vectors of the cycle. */
+  };
+
+  unsigned long nVar = 0;           /*!< \brief Block size of the fine level. */
+  unsigned long nModes = 0;         /*!< \brief Number of near null space modes (0 = injection). */
+  unsigned long maxLevels = 0;      /*!< \brief Maximum number of levels (including the fine one). */
+  unsigned long nSmooth = 0;        /*!< \brief Number of pre and post smoothing sweeps. */
+  ScalarType strength = 0.08;       /*!< \brief Strength of connection threshold. */
+  ScalarType smoothRelax = 0.7;     /*!< \brief Relaxation of the damped Jacobi smoother. */
+  bool aggregatesReady = false;     /*!< \brief Aggregates are cached between builds. */
+
+  std::vector<ScalarType> nullSpace;         /*!< \brief Near null space of the fine level. */
+  std::vector<CLevel> levels;                /*!< \brief The hierarchy, fine to coarse. */
+  std::vector<ScalarType> coarseLU;          /*!< \brief Dense LU factorization of the coarsest matrix. */
+  std::vector<unsigned long> coarsePivot;    /*!< \brief Row pivots of the coarse LU factorization. */
+
+  /*--- Small dense block operations (row major), a is m x n, or m x k for the product with b (k x n). ---*/
+
+  static inline void BlockGemv(unsigned long m, unsigned long n, const ScalarType* a, const ScalarType* x,
+                               ScalarType* y) {
+    for (auto i = 0ul; i < m; ++i) {
+      ScalarType sum = 0;
+      for (auto j = 0ul; j < n; ++j) sum += a[i * n + j] * x[j];
+      y[i] = sum;
+    }
+  }
+
+  static inline void BlockGemvSub(unsigned long m, unsigned long n, const ScalarType* a, const ScalarType* x,
+                                  ScalarType* y) {
+    for (auto i = 0ul; i < m; ++i)
+      for (auto j = 0ul; j < n; ++j) y[i] -= a[i * n + j] * x[j];
+  }
+
+  static inline void BlockGemmAdd(unsigned long m, unsigned long k, unsigned long n, const ScalarType* a,
+                                  const ScalarType* b, ScalarType* c) {
+    for (auto i = 0ul; i < m; ++i)
+      for (auto l = 0ul; l < k; ++l)
+        for (auto j = 0ul; j < n; ++j) c[i * n + j] += a[i * k + l] * b[l * n + j];
+  }
+
+  /*!
+   * \brief Invert a small block by Gaussian elimination with partial pivoting.
+   * \param[in] n - Size of the block.
+   * \param[in] block - The block to invert.
+   * \param[out] inverse - The inverse.
+   */
+  static void BlockInverse(unsigned long n, const ScalarType* block, ScalarType* inverse);
+
+  /*!
+   * \brief Frobenius norm of a square block of size n.
+   */
+  static inline ScalarType BlockNorm(unsigned long n, const ScalarType* a) {
+    ScalarType sum = 0;
+    for (auto i = 0ul; i < n * n; ++i) sum += a[i] * a[i];
+    using std::sqrt;
+    return sqrt(sum);
+  }
+
+  /*!
+   * \brief Compute the inverse of the diagonal blocks of a level, and the damping factor (omega).
+   */
+  void ComputeInverseDiagonal(CLevel& level) const;
+
+  /*!
+   * \brief Greedy (3 phase) aggregation based on the strength of connection between blocks.
+   */
+  void ComputeAggregates(CLevel& level) const;
+
+  /*!
+   * \brief Tentative prolongation of a level from the QR factorization of the near null space of each aggregate.
+   * \note Without near null space the tentative prolongation is the injection and nothing is stored.
+   * \param[in] level - The level, its tentative prolongation is computed.
+   * \param[in] B - Near null space of the level (nModes columns per variable).
+   * \param[out] coarse - The next level, its block size and near null space (the R factors) are set.
+   */
+  void ComputeTentativeProlongation(CLevel& level, const ScalarType* B, CLevel& coarse) const;
+
+  /*!
+   * \brief Build the smoothed prolongation P = (I - w D^-1 A) P_tent and the restriction R = P^T.
+   * \param[in] level - The level.
+   * \param[in] nVarCoarse - Block size of the next level.
+   */
+  void ComputeTransferOperators(CLevel& level, unsigned long nVarCoarse) const;
+
+  /*!
+   * \brief Sparse block matrix product C = A * B, the blocks of A are m x k and those of B k x n.
+   */
+  static void MatrixMatrixProduct(const BlockCSR& A, const BlockCSR& B, unsigned long m, unsigned long k,
+                                  unsigned long n, BlockCSR& C);
+
+  /*!
+   * \brief Transpose a block matrix, including the blocks (of size m x n).
+   */
+  static void Transpose(const BlockCSR& A, unsigned long m, unsigned long n, BlockCSR& At);
+
+  /*!
+   * \brief Factorize the coarsest matrix densely, if it is small enough.
+   */
+  void FactorizeCoarsest();
+
+  /*!
+   * \brief Block residual r = b - A x.
+   */
+  void Residual(const CLevel& level) const;
+
+  /*!
+   * \brief Damped block-Jacobi sweeps, if zeroGuess the first sweep does not need a residual.
+   */
+  void Smooth(const CLevel& level, unsigned long nSweep, bool zeroGuess) const;
+
+  /*!
+   * \brief Solve on the coarsest level (direct or by smoothing).
+   */
+  void SolveCoarsest(const CLevel& level) const;
+
+ public:
+  /*!
+   * \brief Set the parameters of the hierarchy.
+   * \param[in] max_levels - Maximum number of levels.
+   * \param[in] num_smooth - Number of pre and post smoothing sweeps.
+   */
+  void SetParameters(unsigned long max_levels, unsigned long num_smooth) {
+    maxLevels = std::max(max_levels, 2ul);
+    nSmooth = std::max(num_smooth, 1ul);
+  }
+
+  /*!
+   * \brief Set the near null space used to build the tentative prolongation of the fine level.
+   * \note The aggregates are recomputed on the next call to Build.
+   * \param[in] num_modes - Number of modes.
+   * \param[in] modes - Values of the modes, for each point a block of nVar x num_modes (row major).
+   */
+  void SetNearNullSpace(unsigned long num_modes, std::vector<ScalarType> modes) {
+    nModes = num_modes;
+    nullSpace = std::move(modes);
+    aggregatesReady = false;
+  }
+
+  /*!
+   * \brief Whether a near null space was set.
+   */
+  inline bool HasNearNullSpace() const { return nModes != 0; }
+
+  /*!
+   * \brief Build (or update) the hierarchy from the domain part of a block-CSR matrix.
+   * \note Not thread safe, must be called by one thread.
+   * \param[in] nvar - Block size.
+   * \param[in] nPointDomain - Number of rows (only columns < nPointDomain are considered).
+   * \param[in] row_ptr - Pointers to the first element in each row.
+   * \param[in] col_ind - Column index of each block.
+   * \param[in] values - Blocks of the matrix.
+   */
+  void Build(unsigned long nvar, unsigned long nPointDomain, const su2localindex* row_ptr,
+             const su2localindex* col_ind, const ScalarType* values);
+
+  /*!
+   * \brief Apply one V-cycle with zero initial guess.
+   * \note Can be called by multiple threads, "rhs" and "sol" need to support operator [].
+   * \param[in] rhs - Right hand side.
+   * \param[out] sol - Approximate solution.
+   */
+  template <class VectorType>
+  void Apply(const VectorType& rhs, VectorType& sol) const {
+    auto& fine = levels[0];
+    const auto nRow = fine.A.nRow * nVar;
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE * nVar)
+    for (auto i = 0ul; i < nRow; ++i) fine.b[i] = rhs[i];
+    END_SU2_OMP_FOR
+
+    Cycle();
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE * nVar)
+    for (auto i = 0ul; i < nRow; ++i) sol[i] = fine.x[i];
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief V-cycle on the working vectors of the levels, the rhs is taken from the finest level.
+   */
+  void Cycle() const;
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+};
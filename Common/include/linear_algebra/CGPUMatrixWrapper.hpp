@@ -0,0 +1,112 @@
+/*!
+ * \file CGPUMatrixWrapper.hpp
+ * \brief Wrapper of the device (CUDA) copy of a CSysMatrix, used to offload
+ *        the matrix-vector products and the Jacobi preconditioner.
+ * \note The implementation (kernels) is in CGPUMatrixWrapper.cu.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_CUDA
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#error Cannot use the CUDA backend with AD
+#endif
+
+/*!
+ * \class CGPUMatrixWrapper
+ * \ingroup SpLinSys
+ * \brief Device-resident copy of a block-CSR matrix (and of the inverse of its diagonal blocks).
+ * \note The matrix is assembled on the host and uploaded once per solve (see CSysMatrix::FinalizeStorage),
+ *       the vectors of the products are staged through persistent device buffers.
+ *       The methods must be called by one thread.
+ */
+template <class ScalarType>
+class CGPUMatrixWrapper {
+ private:
+  unsigned long nPoint = 0, nPointDomain = 0, nVar = 0, nEqn = 0, nnz = 0;
+
+  su2localindex* d_rowPtr = nullptr; /*!< \brief Device copy of the row pointers (domain rows). */
+  su2localindex* d_colInd = nullptr; /*!< \brief Device copy of the column indices. */
+  ScalarType* d_values = nullptr;    /*!< \brief Device copy of the blocks. */
+  ScalarType* d_invDiag = nullptr;   /*!< \brief Device copy of the inverse diagonal blocks (Jacobi). */
+  ScalarType* d_vec = nullptr;       /*!< \brief Input vector of the products (nPoint blocks). */
+  ScalarType* d_prod = nullptr;      /*!< \brief Output vector of the products (nPointDomain blocks). */
+
+  /*!
+   * \brief Release all device memory.
+   */
+  void Clean();
+
+ public:
+  CGPUMatrixWrapper() = default;
+
+  /*--- Move or copy is not allowed. ---*/
+  CGPUMatrixWrapper(CGPUMatrixWrapper&&) = delete;
+  CGPUMatrixWrapper(const CGPUMatrixWrapper&) = delete;
+  CGPUMatrixWrapper& operator=(CGPUMatrixWrapper&&) = delete;
+  CGPUMatrixWrapper& operator=(const CGPUMatrixWrapper&) = delete;
+
+  /*!
+   * \brief Class destructor.
+   */
+  ~CGPUMatrixWrapper() { Clean(); }
+
+  /*!
+   * \brief Allocate the device memory and upload the sparse pattern.
+   * \param[in] npoint - Number of columns (blocks), including halos.
+   * \param[in] npointdomain - Number of rows (blocks).
+   * \param[in] nvar - Number of rows of the blocks.
+   * \param[in] neqn - Number of columns of the blocks.
+   * \param[in] rowPtr - Row pointers of the host matrix.
+   * \param[in] colInd - Column indices of the host matrix.
+   */
+  void Initialize(unsigned long npoint, unsigned long npointdomain, unsigned long nvar, unsigned long neqn,
+                  const su2localindex* rowPtr, const su2localindex* colInd);
+
+  /*!
+   * \brief Upload the values of the matrix.
+   */
+  void SetValues(const ScalarType* values);
+
+  /*!
+   * \brief Upload the inverse diagonal blocks (Jacobi preconditioner).
+   */
+  void SetInvDiagonal(const ScalarType* invDiag);
+
+  /*!
+   * \brief Matrix-vector product on the device, prod = A * vec (domain rows).
+   * \param[in] vec - Host vector with nPoint blocks.
+   * \param[out] prod - Host vector with nPointDomain blocks.
+   */
+  void MatrixVectorProduct(const ScalarType* vec, ScalarType* prod) const;
+
+  /*!
+   * \brief Application of the Jacobi preconditioner on the device, prod = inv(D) * vec (domain rows).
+   */
+  void JacobiProduct(const ScalarType* vec, ScalarType* prod) const;
+};
+
+#endif
@@ -71,13 +71,15 @@ class CPastixWrapper {
     unsigned long nVar = 0;
     unsigned long nPoint = 0;
     unsigned long nPointDomain = 0;
-    const unsigned long* rowptr = nullptr;
-    const unsigned long* colidx = nullptr;
+    const su2localindex* rowptr = nullptr;
+    const su2localindex* colidx = nullptr;
     const ScalarType* values = nullptr;
 
     unsigned long size_rhs() const { return nPointDomain * nVar; }
   } matrix; /*!< \brief Pointers and sizes of the input matrix. */
 
+  SU2_Comm comm;       /*!< \brief Ranks that factorize the same block of the matrix (see PASTIX_BLOCKS). */
+  bool owncomm;        /*!< \brief The communicator was created (split) by this class. */
   bool issetup;        /*!< \brief Signals that the matrix data has been provided. */
   bool isinitialized;  /*!< \brief Signals that the sparsity pattern has been set. */
   bool isfactorized;   /*!< \brief Signals that a factorization has been computed. */
@@ -86,13 +88,13 @@ class CPastixWrapper {
   const int mpi_size, mpi_rank;
 
   vector<unsigned long> sort_rows;           /*!< \brief List of rows with halo points. */
-  vector<vector<unsigned long> > sort_order; /*!< \brief How each of those rows needs to be sorted. */
+  vector<vector<unsigned long> > sort_order; /*!< \brief How each of those rows needs to be sorted (and filtered). */
 
   /*!
    * \brief Run the external solver for the task it is currently setup to execute.
    */
   void Run() {
-    dpastix(&state, SU2_MPI::GetComm(), nCols, colptr.data(), rowidx.data(), values.data(), loc2glb.data(), perm.data(),
+    dpastix(&state, comm, nCols, colptr.data(), rowidx.data(), values.data(), loc2glb.data(), perm.data(),
             NULL, workvec.data(), 1, iparm, dparm);
   }
 
@@ -121,6 +123,8 @@ class CPastixWrapper {
    */
   CPastixWrapper()
       : state(nullptr),
+        comm(SU2_MPI::GetComm()),
+        owncomm(false),
         issetup(false),
         isinitialized(false),
         isfactorized(false),
@@ -138,7 +142,12 @@ class CPastixWrapper {
   /*!
    * \brief Class destructor.
    */
-  ~CPastixWrapper() { Clean(); }
+  ~CPastixWrapper() {
+    Clean();
+#ifdef HAVE_MPI
+    if (owncomm) MPI_Comm_free(&comm);
+#endif
+  }
 
   /*!
    * \brief Set matrix data, only once.
@@ -149,8 +158,8 @@ class CPastixWrapper {
    * \param[in] colidx - Non zeros column indices.
    * \param[in] values - Matrix coefficients.
    */
-  void SetMatrix(unsigned long nVar, unsigned long nPoint, unsigned long nPointDomain, const unsigned long* rowptr,
-                 const unsigned long* colidx, const ScalarType* values) {
+  void SetMatrix(unsigned long nVar, unsigned long nPoint, unsigned long nPointDomain, const su2localindex* rowptr,
+                 const su2localindex* colidx, const ScalarType* values) {
     if (issetup) return;
     matrix.nVar = nVar;
     matrix.nPoint = nPoint;
@@ -31,6 +31,8 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CGPUMatrixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -116,6 +118,8 @@ template <class ScalarType>
 class CSysMatrix {
  private:
   friend struct CSysMatrixComms;
+  template <class>
+  friend class CSysMatrix;
 
   const int rank; /*!< \brief MPI Rank. */
   const int size; /*!< \brief MPI Size. */
@@ -140,27 +144,34 @@ class CSysMatrix {
 
   ScalarType* matrix;           /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;            /*!< \brief Number of possible nonzero entries in the matrix. */
-  const unsigned long* row_ptr; /*!< \brief Pointers to the first element in each row. */
-  const unsigned long* dia_ptr; /*!< \brief Pointers to the diagonal element in each row. */
-  const unsigned long* col_ind; /*!< \brief Column index for each of the elements in val(). */
-  const unsigned long* col_ptr; /*!< \brief The transpose of col_ind, pointer to blocks with the same column index. */
+  const su2localindex* row_ptr; /*!< \brief Pointers to the first element in each row. */
+  const su2localindex* dia_ptr; /*!< \brief Pointers to the diagonal element in each row. */
+  const su2localindex* col_ind; /*!< \brief Column index for each of the elements in val(). */
+  const su2localindex* col_ptr; /*!< \brief The transpose of col_ind, pointer to blocks with the same column index. */
 
   ScalarType* ILU_matrix;           /*!< \brief Entries of the ILU sparse matrix. */
   unsigned long nnz_ilu;            /*!< \brief Number of possible nonzero entries in the matrix (ILU). */
-  const unsigned long* row_ptr_ilu; /*!< \brief Pointers to the first element in each row (ILU). */
-  const unsigned long* dia_ptr_ilu; /*!< \brief Pointers to the diagonal element in each row (ILU). */
-  const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
+  const su2localindex* row_ptr_ilu; /*!< \brief Pointers to the first element in each row (ILU). */
+  const su2localindex* dia_ptr_ilu; /*!< \brief Pointers to the diagonal element in each row (ILU). */
+  const su2localindex* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
-  /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> >
-      LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
+  /*--- The linelets are sorted by length and solved in batches of LINELET_C, one linelet per SIMD lane. ---*/
+  enum : unsigned long { LINELET_C = simd::preferredLen<ScalarType>() }; /*!< \brief Linelets per batch. */
+  vector<unsigned long> LineletBatch; /*!< \brief Linelet of each lane of each batch (nLinelet for padding). */
+
+  /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads,
+   * the inner vectors store the values of the lanes of a batch contiguously (interleaved). ---*/
+  mutable vector<vector<ScalarType> >
+      LineletUpper; /*!< \brief Upper blocks of the tri-diag system (working memory). */
   mutable vector<vector<ScalarType> >
       LineletInvDiag; /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
   mutable vector<vector<ScalarType> >
       LineletVector; /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  mutable vector<vector<ScalarType> >
+      LineletWork; /*!< \brief Lower block, weight, and block being inverted (working memory). */
 
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
@@ -179,11 +190,125 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+#ifdef HAVE_CUDA
+  mutable CGPUMatrixWrapper<ScalarType> gpu_wrapper; /*!< \brief Device copy of the matrix. */
+#endif
+
+  /*!
+   * \brief State of the device copy of the matrix (see EnableGPU).
+   */
+  struct {
+    bool enabled = false;      /*!< \brief The products are offloaded to the device. */
+    bool valid = false;        /*!< \brief The device values are consistent with the host matrix. */
+    bool invDiagValid = false; /*!< \brief The device inverse diagonal blocks are consistent with invM. */
+  } gpu;
+
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Hierarchy of the AMG preconditioner. */
+
+  using SellArray = simd::Array<ScalarType>; /*!< \brief SIMD type of the SELL format, one lane per row. */
+  enum : unsigned long { SELL_C = SellArray::Size };   /*!< \brief Rows per slice of the SELL format. */
+  enum : unsigned long { SELL_SIGMA = 8 * SELL_C }; /*!< \brief Rows are sorted by length within these windows. */
+
+  /*!
+   * \brief SELL-C-sigma copy of the matrix (domain rows), used by the products and the Jacobi preconditioner.
+   * \note The rows of a slice are the SIMD lanes, the C blocks of column "k" of a slice are interleaved, i.e.
+   *       entry (i,j) of the block of lane "l" is at val[((k * nVar + i) * nEqn + j) * C + l].
+   *       Short rows are padded with zero blocks pointing to the diagonal.
+   */
+  struct {
+    bool enabled = false;               /*!< \brief The format was requested (and is supported by the type). */
+    bool valid = false;                 /*!< \brief The values are consistent with the block-CSR matrix. */
+    unsigned long nSlice = 0;           /*!< \brief Number of slices. */
+    std::vector<su2localindex> row;     /*!< \brief Row of each lane of each slice (nPointDomain for padding). */
+    std::vector<unsigned long> slicePtr; /*!< \brief First column of each slice. */
+    std::vector<su2localindex> colInd;  /*!< \brief Column index of each block, per column and lane. */
+    std::vector<unsigned long> srcIdx;  /*!< \brief Position of each block in "matrix" (nnz for padding). */
+    ScalarType* val = nullptr;          /*!< \brief Interleaved blocks. */
+    ScalarType* invDiag = nullptr;      /*!< \brief Interleaved inverse diagonal blocks of groups of C rows (Jacobi). */
+  } sell;
+
+  /*!
+   * \brief Edge-based copy of the matrix, used by the products and the LU_SGS preconditioner.
+   * \note The pattern is structurally symmetric, each edge (i,j), i > j, is a pair of off-diagonal blocks stored
+   *       together, (i,j) then (j,i). The edges are sorted by "i" and then "j", i.e. like the lower part of the
+   *       CSR pattern, such that only the lower endpoint needs to be stored. The products scatter the upper blocks,
+   *       the edges between thread partitions are handled separately to avoid races.
+   *       In the symmetric flavor (SYMMETRIC format or IC preconditioner with CG) only the lower block is stored,
+   *       the upper is its transpose. Rows with only a diagonal block (e.g. Dirichlet rows set by DeleteValsRowi)
+   *       are allowed to break the symmetry, their DOFs are masked and their products computed separately.
+   */
+  struct {
+    bool enabled = false;                 /*!< \brief The format was requested (and is supported by the type). */
+    bool valid = false;                   /*!< \brief The values are consistent with the block-CSR matrix. */
+    bool symmetric = false;               /*!< \brief Only the lower block of each edge is stored. */
+    bool warned = false;                  /*!< \brief The user was warned about a non symmetric matrix. */
+    bool factorized = false;              /*!< \brief The IC pivots were computed (and the symmetric copy was valid). */
+    unsigned long numAsym = 0;            /*!< \brief Non symmetric entries found by the threads (working variable). */
+    std::vector<unsigned long> rowPtr;    /*!< \brief First edge of each row (nPoint + 1). */
+    std::vector<su2localindex> col;       /*!< \brief Lower endpoint of each edge. */
+    std::vector<unsigned long> upperSrc;  /*!< \brief Position of the upper block of each edge in "matrix". */
+    std::vector<unsigned long> ifacePtr;  /*!< \brief First interface edge of each thread partition. */
+    std::vector<unsigned long> ifaceEdge; /*!< \brief Interface edges (lower endpoint in the partition, other not). */
+    std::vector<su2localindex> ifaceRow;  /*!< \brief Upper endpoint of the interface edges. */
+    ScalarType* dia = nullptr;            /*!< \brief Diagonal blocks of the domain rows. */
+    ScalarType* val = nullptr;            /*!< \brief Pairs of off-diagonal blocks of the edges. */
+    std::vector<ScalarType> mask;         /*!< \brief 0 for the domain DOFs with only a diagonal block, else 1. */
+    std::vector<unsigned long> fixedDofs; /*!< \brief Domain DOFs with mask 0. */
+    ScalarType* pivot = nullptr;          /*!< \brief Inverse pivots of the incomplete Cholesky factorization. */
+    mutable std::vector<ScalarType> work; /*!< \brief Accumulator of the IC backward sweep (working memory). */
+  } edge_fmt;
+
+  /*!
+   * \brief Level sets of the ILU sparse pattern (domain rows), used for thread-parallel ILU that is equivalent to
+   *        the single-thread one, instead of the thread partitions (see LINEAR_SOLVER_ILU_LEVEL_SCHEDULING).
+   * \note Rows of the same "lower" level do not depend on each other in the factorization and forward substitution,
+   *       likewise for the "upper" levels and the backward substitution. The rows are sorted by level (CSR-like).
+   */
+  struct {
+    bool enabled = false;                  /*!< \brief Use the levels instead of the thread partitions. */
+    std::vector<unsigned long> lowerPtr;   /*!< \brief First row of each lower level. */
+    std::vector<unsigned long> lowerRows;  /*!< \brief Rows sorted by lower level. */
+    std::vector<unsigned long> upperPtr;   /*!< \brief First row of each upper level. */
+    std::vector<unsigned long> upperRows;  /*!< \brief Rows sorted by upper level. */
+  } ilu_levels;
+
+  enum : unsigned long { MAX_COARSE_SIZE = 2048 }; /*!< \brief Max. size of the (dense) coarse system. */
+
+  /*!
+   * \brief Restricted additive Schwarz (RAS) extension of the ILU preconditioner, and its coarse correction
+   *        (see LINEAR_SOLVER_SCHWARZ_OVERLAP and LINEAR_SOLVER_SCHWARZ_COARSE).
+   * \note The overlap is made of the halo points up to some layers (graph distance) away from the domain. Their rows
+   *       in the ILU copy are replaced by the rows of their owners (sent with the pattern of the P2P comms), the
+   *       couplings to other halo points are dropped, and they are factorized after the domain rows. Only the domain
+   *       part of the result is kept (restricted). The coarse space has one aggregate per rank and variable, the
+   *       coarse system is gathered and solved by all ranks, and the correction is applied before the ILU.
+   */
+  struct {
+    bool enabled = false;                 /*!< \brief The halo rows are exchanged (overlap > 0), on all ranks. */
+    bool coarse = false;                  /*!< \brief The coarse correction is applied. */
+    std::vector<unsigned long> haloRows;  /*!< \brief Halo points in the overlap (ascending). */
+    std::vector<int> owner;               /*!< \brief Owner rank of each halo point, -1 if unknown. */
+    std::vector<unsigned long> dropPos;   /*!< \brief Blocks of the domain rows (ILU copy) coupled to other halos. */
+    std::vector<int> sendRank, recvRank;  /*!< \brief Neighbor ranks of the row exchange. */
+    std::vector<unsigned long> sendPtr, recvPtr; /*!< \brief First block of each message. */
+    std::vector<unsigned long> sendPos;   /*!< \brief Position in "matrix" of each sent block. */
+    std::vector<long> recvPos;            /*!< \brief Position in the ILU copy of each received block, -1 to drop. */
+    std::vector<su2double> sendBuf, recvBuf; /*!< \brief Buffers of the row exchange. */
+    std::vector<int> coarseSlot;          /*!< \brief Column (0 self, 1+i recvRank[i]) of the coarse row of halos. */
+    std::vector<int> coarseCount, coarseDispl; /*!< \brief Blocks of the coarse row of each rank (Allgatherv). */
+    std::vector<int> coarseCol;           /*!< \brief Column (rank) of the gathered blocks of the coarse rows. */
+    std::vector<su2double> coarseRow;     /*!< \brief Coarse row of this rank. */
+    std::vector<passivedouble> coarseLU;  /*!< \brief LU factors of the dense coarse matrix. */
+    std::vector<unsigned long> coarsePiv; /*!< \brief Pivots of the LU factorization. */
+    mutable std::vector<ScalarType> coarseSol; /*!< \brief Coarse correction, nVar values per rank. */
+    mutable CSysVector<ScalarType> coarseRes;  /*!< \brief Residual after the coarse correction. */
+  } schwarz;
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
   struct {
-    const unsigned long* ptr = nullptr;
+    const su2localindex* ptr = nullptr;
     unsigned long nEdge = 0;
 
     operator bool() { return nEdge != 0; }
@@ -355,6 +480,114 @@ class CSysMatrix {
    */
   void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
 
+  /*!
+   * \brief Build the sparse pattern of the SELL-C-sigma copy of the matrix.
+   */
+  void BuildSELLPattern();
+
+  /*!
+   * \brief Build the pattern of the edge-based copy of the matrix (after the thread partitions).
+   */
+  void BuildEdgePattern();
+
+  /*!
+   * \brief Set the rigid body modes (translations and rotations) of the domain points as the near null space of
+   *        the AMG preconditioner, for elasticity (structural and mesh deformation) systems.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetAMGRigidBodyModes(const CGeometry* geometry);
+
+  /*!
+   * \brief Build the level sets of the ILU sparse pattern for level-scheduled ILU.
+   */
+  void BuildILULevels();
+
+  /*!
+   * \brief Eliminate the lower part of row iPoint of the ILU matrix, considering only the submatrix [begin,end[.
+   * \note The diagonal blocks of the rows in the lower part must have been inverted already.
+   */
+  void FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward substitution of row iPoint of the ILU factorization, considering only columns >= begin.
+   */
+  void ForwardSubstitutionILU(unsigned long iPoint, unsigned long begin, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Backward substitution of row iPoint of the ILU factorization, considering only columns < end.
+   */
+  void BackwardSubstitutionILU(unsigned long iPoint, unsigned long end, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Set up the overlap and the coarse space of the ILU preconditioner (restricted additive Schwarz).
+   * \note Collective (point-to-point with the neighbor ranks), to be called by the master thread.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetupSchwarz(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Replace the halo rows of the ILU copy by the rows of their owners, and build the coarse system.
+   */
+  void BuildSchwarz();
+
+  /*!
+   * \brief Factorize the halo rows of the overlap, after the domain rows.
+   */
+  void FactorizeHaloRowsILU();
+
+  /*!
+   * \brief Forward and backward substitution of the halo rows of the overlap, between those of the domain rows.
+   */
+  void SubstituteHaloRowsILU(CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Compute the coarse correction and the updated residual (coarseRes).
+   * \param[in] vec - Residual.
+   * \return The updated residual.
+   */
+  const CSysVector<ScalarType>& ComputeCoarseCorrection(const CSysVector<ScalarType>& vec) const;
+
+  /*!
+   * \brief Owner rank of a point, -1 if unknown.
+   */
+  inline int PointOwner(unsigned long iPoint) const {
+    return (iPoint < nPointDomain) ? rank : schwarz.owner[iPoint - nPointDomain];
+  }
+
+  /*!
+   * \brief Product of the SELL-C-sigma copy of the matrix by a vector, for the domain rows.
+   * \param[in] vec - Vector to be multiplied by the matrix.
+   * \param[out] prod - Result of the product.
+   */
+  void SELLProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Product of the edge-based copy of the matrix by a vector, for the domain rows.
+   * \param[in] vec - Vector to be multiplied by the matrix.
+   * \param[out] prod - Result of the product.
+   */
+  void EdgeProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief LU_SGS preconditioner with the edge-based copy of the matrix (same result as with BCSR).
+   */
+  void EdgeLU_SGS(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                  const CConfig* config) const;
+
+  /*!
+   * \brief Copy the values of the matrix to the symmetric edge-based copy.
+   * \return False if the matrix is not symmetric (except for the masked DOFs).
+   */
+  bool FinalizeSymmetricStorage();
+
+  /*!
+   * \brief Product of the symmetric edge-based copy of the matrix by a vector, for the domain rows.
+   * \param[in] vec - Vector to be multiplied by the matrix.
+   * \param[out] prod - Result of the product.
+   */
+  void SymmetricEdgeProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -376,10 +609,41 @@ class CSysMatrix {
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] needTranspPtr - If "col_ptr" should be created, used for "SetDiagonalAsColumnSum".
+   * \param[in] grad_mode - If the matrix is used for gradient smoothing.
+   * \param[in] assemblyOnly - The matrix is only used to assemble the system, which is solved with a copy
+   *            (see CopyValues), therefore no storage is allocated for preconditioners.
    */
   void Initialize(unsigned long npoint, unsigned long npointdomain, unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry* geometry, const CConfig* config, bool needTranspPtr = false,
-                  bool grad_mode = false);
+                  bool grad_mode = false, bool assemblyOnly = false);
+
+  /*!
+   * \brief Copy the values of a matrix with the same sparse pattern and block size, converting the type.
+   * \note Used to solve in single precision a system assembled in higher precision.
+   * \param[in] other - Matrix being copied.
+   */
+  template <class OtherType>
+  void CopyValues(const CSysMatrix<OtherType>& other) {
+    assert(row_ptr == other.row_ptr && nVar == other.nVar && nEqn == other.nEqn && "Incompatible matrices.");
+    const auto size = nnz * nVar * nEqn;
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto i = 0ul; i < size; ++i) matrix[i] = PassiveAssign(other.matrix[i]);
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Copy the values into the vectorized (SELL-C-sigma) or edge-based storage, if that format was requested.
+   * \note Must be called after the matrix is assembled and before it is used in products, the copy is invalidated
+   *       by SetValZero, TransposeInPlace, and MatrixMatrixAddition (then the block-CSR storage is used).
+   */
+  void FinalizeStorage();
+
+  /*!
+   * \brief Offload the matrix-vector products, and the Jacobi preconditioner, to the device (CUDA builds).
+   * \note Must be called after Initialize. The matrix is still assembled on the host, and it is copied to
+   *       the device by FinalizeStorage, the same operations that invalidate the SELL copy invalidate it.
+   */
+  void EnableGPU();
 
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
@@ -391,6 +655,16 @@ class CSysMatrix {
    */
   void SetValDiagonalZero(void);
 
+  /*!
+   * \brief Set the domain rows of this matrix to the Galerkin product R*A*P of a matrix on a finer
+   *        agglomerated grid, i.e. coarse block IJ is the sum of the fine blocks ij with i in I and j in J.
+   * \note Fine blocks that do not map to an entry of this sparse pattern are dropped.
+   * \param[in] fine - Matrix of the finer level.
+   * \param[in] geometry_fine - Geometry of the finer level (parent of each fine point).
+   * \param[in] geometry_coarse - Geometry of this level (children of each coarse point).
+   */
+  void SetGalerkinProduct(const CSysMatrix& fine, const CGeometry* geometry_fine, const CGeometry* geometry_coarse);
+
   /*!
    * \brief Get a pointer to the start of block "ij"
    * \param[in] block_i - Row index.
@@ -627,6 +901,49 @@ class CSysMatrix {
     }
   }
 
+  /*!
+   * \brief SIMD version of UpdateBlocks that only updates the row of point i (ii and ij) or the row of point j
+   *        (jj and ji) of each edge, for when the rows of the matrix are owned by different threads.
+   * \param[in] rowOfJ - Update the row of point j instead of the row of point i.
+   * \note Nothing is updated if the mask is 0.
+   */
+  template <class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void UpdateRowBlocks(simd::Array<I, N> iEdge, simd::Array<I, N> iPoint, simd::Array<I, N> jPoint,
+                                   bool rowOfJ, const MatTypeSIMD& block_i, const MatTypeSIMD& block_j,
+                                   simd::Array<F, N> mask = 1) {
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar * nEqn);
+
+    /*--- Row i: ii += block_i, ij = block_j. Row j: jj -= block_j, ji = -block_i. ---*/
+    const auto& diag = rowOfJ ? block_j : block_i;
+    const auto& offDiag = rowOfJ ? block_i : block_j;
+    const auto sign = rowOfJ ? -1 : 1;
+    ScalarType blk_d[N][blkSz], blk_o[N][blkSz];
+
+    for (size_t i = 0; i < blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k = 0; k < N; ++k) {
+        blk_d[k][i] = PassiveAssign(sign * mask[k] * diag.data()[i][k]);
+        blk_o[k][i] = PassiveAssign(sign * mask[k] * offDiag.data()[i][k]);
+      }
+    }
+
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+
+      auto bdiag = &matrix[dia_ptr[rowOfJ ? jPoint[k] : iPoint[k]] * blkSz];
+      auto boff = &matrix[edge_ptr(iEdge[k], rowOfJ) * blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < blkSz; ++i) {
+        bdiag[i] += blk_d[k][i];
+        boff[i] = blk_o[k][i];
+      }
+    }
+  }
+
   /*!
    * \brief Sets 2 blocks ij and ji (add to i* sub from j*) associated with
    *        one edge of an FVM-type sparse pattern.
@@ -740,6 +1057,36 @@ class CSysMatrix {
     SetBlock2Diag<OtherType, false>(block_i, val_block, alpha);
   }
 
+  /*!
+   * \brief SIMD version of AddBlock2Diag, adds the blocks to the diagonals of multiple (distinct) points.
+   * \note Nothing is updated if the mask is 0.
+   */
+  template <class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void AddBlock2Diag(simd::Array<I, N> iPoint, const MatTypeSIMD& block, simd::Array<F, N> mask = 1) {
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar * nEqn);
+
+    ScalarType blk[N][blkSz];
+
+    for (size_t i = 0; i < blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k = 0; k < N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]] * blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < blkSz; ++i) bii[i] += blk[k][i];
+    }
+  }
+
   /*!
    * \brief Short-hand to AddBlock2Diag with alpha = -1, i.e. subtracts from the current diagonal.
    */
@@ -868,6 +1215,22 @@ class CSysMatrix {
   void ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                 const CConfig* config) const;
 
+  /*!
+   * \brief Build the incomplete Cholesky preconditioner (zero fill, only the pivots are modified), it requires
+   *        the symmetric edge-based copy of the matrix, see FinalizeStorage.
+   */
+  void BuildICPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (falls back to LU_SGS if the matrix is not symmetric).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeICPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                               const CConfig* config) const;
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -917,4 +1280,21 @@ class CSysMatrix {
    */
   void ComputePastixPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
+
+  /*!
+   * \brief Build the algebraic multigrid (smoothed aggregation) preconditioner.
+   * \note The aggregates are computed on the first call and then reused.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig* config);
+
+  /*!
+   * \brief Apply one V-cycle of the AMG preconditioner.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
 };
@@ -111,10 +111,28 @@ class CSysSolve {
 
   LinearToleranceType tol_type =
       LinearToleranceType::ABSOLUTE; /*!< \brief How the linear solvers interpret the tolerance. */
+  ScalarType tolRefNorm = 0.0;       /*!< \brief If positive, RELATIVE tolerances refer to this norm. */
   bool xIsZero = false;              /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;         /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10;    /*!< \brief Monitoring frequency. */
 
+  /*--- Reuse of the preconditioner across calls to Solve (see LINEAR_SOLVER_PREC_REUSE). ---*/
+  unsigned long precondAge = 0;       /*!< \brief Number of solves with the current preconditioner, 0 if not built. */
+  unsigned long precondBuildIter = 0; /*!< \brief Iterations of the first solve after the last build. */
+  bool matrixUnchanged = false;       /*!< \brief The matrix is the same as in the last solve. */
+
+  /*--- Subspace recycled between calls to Solve by RECYCLED_FGMRES. ---*/
+  std::vector<VectorType> RecycleU; /*!< \brief Recycled directions, the corrections of the previous solves. */
+  std::vector<VectorType> RecycleC; /*!< \brief Products of the current matrix with RecycleU, orthonormalized. */
+  VectorType RecycleR;              /*!< \brief Deflated residual, and product of the matrix with the correction. */
+  VectorType RecycleDx;             /*!< \brief Correction of the current solve. */
+  unsigned long recycleSize = 0;    /*!< \brief Number of directions stored. */
+  unsigned long recycleNext = 0;    /*!< \brief Where the next correction is stored (the oldest is replaced). */
+
+  /*--- History of the Eisenstat-Walker forcing term (see LINEAR_SOLVER_FORCING). ---*/
+  ScalarType forcingResOld = 0.0; /*!< \brief Norm of the right hand side (nonlinear residual) of the last solve. */
+  ScalarType forcingTol = 0.0;    /*!< \brief Tolerance of the last solve. */
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -184,6 +202,23 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with one reorthogonalization pass (CGS2)
+   *
+   * \param[in] shared_hsbg - if the Hessenberg matrix is shared by multiple threads
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the projections of each pass (and the norm of the vector) are computed with a single
+   * reduction, i.e. 2 global synchronizations instead of the i+2 (or more) of ModGramSchmidt.
+   */
+  void ClassicalGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -321,10 +356,31 @@ class CSysSolve {
    * \param[out] residual - final normalized residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] classical_gs - use classical Gram-Schmidt with reorthogonalization instead of modified Gram-Schmidt.
    */
   unsigned long FGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
-                                 bool monitoring, const CConfig* config) const;
+                                 bool monitoring, const CConfig* config, bool classical_gs = false) const;
+
+  /*!
+   * \brief Pipelined (single reduction per iteration) Flexible Generalized Minimal Residual method
+   * \note The reorthogonalization and normalization of each new basis vector are delayed by one iteration
+   *       (DCGS2, Swirydowicz et al. 2020), this allows computing them with the same global reduction as the
+   *       projections of the next vector. The Hessenberg columns are finalized with one iteration of lag,
+   *       and the convergence check is therefore done one mat-vec later than in FGMRES.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                  bool monitoring, const CConfig* config) const;
 
   /*!
    * \brief Flexible Generalized Minimal Residual method with restarts (frequency comes from config).
@@ -333,6 +389,27 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config);
 
+  /*!
+   * \brief FGMRES deflated by a subspace recycled from the previous solves (GCRO, de Sturler 1999).
+   * \note The recycled directions (U) are the corrections of the last solves, at the start of each solve
+   *       C = A*U is recomputed and orthonormalized, the initial guess is improved by projection onto
+   *       the span of C, and FGMRES is applied to the deflated operator (I-C*C^T)*A. The directions
+   *       are kept for as long as the object lives (size from LINEAR_SOLVER_RECYCLE_SIZE).
+   *       The harmonic Ritz vectors of GCRO-DR are not used, they require a dense generalized eigensolver.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long RecycledFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                         const PrecondType& precond, ScalarType tol, unsigned long m,
+                                         ScalarType& residual, bool monitoring, const CConfig* config);
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -405,11 +482,33 @@ class CSysSolve {
    */
   inline void SetToleranceType(LinearToleranceType type) { tol_type = type; }
 
+  /*!
+   * \brief Set the norm w.r.t. which RELATIVE tolerances are interpreted, instead of the initial residual.
+   * \note Used with warm starts to keep the tolerance of a cold start, 0 restores the default behavior.
+   */
+  inline void SetToleranceReferenceNorm(ScalarType norm) { tolRefNorm = norm; }
+
+  /*!
+   * \brief Force the preconditioner to be rebuilt by the next call to Solve, e.g. because the matrix was reassembled.
+   */
+  inline void ResetPreconditioner() { precondAge = 0; }
+
+  /*!
+   * \brief Tell the next calls to Solve that the matrix is the same as in the last solve, so that the
+   *        preconditioner is kept regardless of LINEAR_SOLVER_PREC_REUSE (e.g. modified Newton methods).
+   */
+  inline void SetMatrixUnchanged(bool unchanged) { matrixUnchanged = unchanged; }
+
   /*!
    * \brief Assume the initial solution is 0 to save one product, or don't.
    */
   inline void SetxIsZero(bool isZero) { xIsZero = isZero; }
 
+  /*!
+   * \brief Get whether the initial solution is assumed to be 0.
+   */
+  inline bool GetxIsZero() const { return xIsZero; }
+
   /*!
    * \brief Set whether to recompute residuals at the end (while monitoring only).
    */
@@ -419,4 +518,15 @@ class CSysSolve {
    * \brief Set the screen output frequency during monitoring.
    */
   inline void SetMonitoringFrequency(bool frequency) { monitorFreq = frequency; }
+
+  /*!
+   * \brief Eisenstat-Walker (choice 2) forcing term, i.e. the relative tolerance of an inexact Newton step,
+   *        eta_k = gamma * (|F_k| / |F_k-1|)^alpha, safeguarded and limited to [minTol, max tolerance].
+   * \note Updates the history of the nonlinear residual, call it once per nonlinear iteration (all threads).
+   * \param[in] resNorm - Norm of the nonlinear residual, |F_k|.
+   * \param[in] minTol - Lower bound of the tolerance.
+   * \param[in] config - Definition of the problem (parameters of the forcing term).
+   * \return The tolerance for the current solve.
+   */
+  ScalarType ForcingTerm(ScalarType resNorm, ScalarType minTol, const CConfig* config);
 };
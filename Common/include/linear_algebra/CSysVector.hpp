@@ -33,6 +33,8 @@
 #include "../parallelization/vectorization.hpp"
 #include "vector_expressions.hpp"
 
+#include <vector>
+
 /*!
  * \brief OpenMP worksharing construct used in CSysVector for loops.
  * \note The loop will only run in parallel if methods are called from a
@@ -338,6 +340,125 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   inline ScalarType norm() const { return sqrt(squaredNorm()); }
 
+  /*!
+   * \brief Accumulate the partial (thread and rank local) dot products of "this" with n vectors.
+   * \note Use with reduceSums to fuse multiple reductions into one global synchronization.
+   * \param[in] n - Number of vectors.
+   * \param[in] vecs - Pointer to the first of the n vectors, they must be contiguous (e.g. in a std::vector).
+   * \param[in,out] sums - The n partial sums (n + 1 with the squared norm of "this").
+   * \param[in] withSelf - Also accumulate the squared norm of "this" in sums[n].
+   */
+  void localMultiDot(unsigned long n, const CSysVector* vecs, ScalarType* sums, bool withSelf = false) const {
+    SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      const ScalarType val = vec_val[i];
+      for (auto k = 0ul; k < n; ++k) sums[k] += val * vecs[k].vec_val[i];
+      if (withSelf) sums[n] += val * val;
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Reduce partial sums across all threads and ranks with a single global synchronization.
+   * \param[in] n - Number of sums.
+   * \param[in,out] sums - On entry the partial sums of the thread, on exit the global sums (same for all threads).
+   */
+  static void reduceSums(unsigned long n, ScalarType* sums) {
+    static std::vector<ScalarType> shared;
+    SU2_OMP_SAFE_GLOBAL_ACCESS(shared.assign(n, ScalarType(0));)
+
+    SU2_OMP_CRITICAL {
+      for (auto k = 0ul; k < n; ++k) shared[k] += sums[k];
+    }
+    END_SU2_OMP_CRITICAL
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      const std::vector<ScalarType> local(shared);
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(local.data(), shared.data(), n, mpi_type, MPI_SUM,
+                                                 SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#else
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+#endif
+
+    for (auto k = 0ul; k < n; ++k) sums[k] = shared[k];
+  }
+
+  /*!
+   * \brief Dot products of "this" with n vectors, with a single reduction across threads and ranks.
+   * \param[in] n - Number of vectors.
+   * \param[in] vecs - Pointer to the first of the n vectors, they must be contiguous.
+   * \param[out] res - The n dot products.
+   */
+  void multiDot(unsigned long n, const CSysVector* vecs, ScalarType* res) const {
+    for (auto k = 0ul; k < n; ++k) res[k] = 0.0;
+    localMultiDot(n, vecs, res);
+    reduceSums(n, res);
+  }
+
+  /*!
+   * \brief Subtract a linear combination of n vectors from "this", in one pass, this -= sum_k coeff[k] * vecs[k].
+   * \param[in] n - Number of vectors.
+   * \param[in] coeff - The n coefficients.
+   * \param[in] vecs - Pointer to the first of the n vectors, they must be contiguous.
+   */
+  void subtractLinComb(unsigned long n, const ScalarType* coeff, const CSysVector* vecs) {
+    SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+    for (auto i = 0ul; i < nElm; ++i) {
+      ScalarType sum = 0.0;
+      for (auto k = 0ul; k < n; ++k) sum += coeff[k] * vecs[k].vec_val[i];
+      vec_val[i] -= sum;
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Add a linear combination of n vectors to "this", in one pass, this += sum_k coeff[k] * vecs[k].
+   * \param[in] n - Number of vectors.
+   * \param[in] coeff - The n coefficients.
+   * \param[in] vecs - Pointer to the first of the n vectors, they must be contiguous.
+   */
+  void addLinComb(unsigned long n, const ScalarType* coeff, const CSysVector* vecs) {
+    SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+    for (auto i = 0ul; i < nElm; ++i) {
+      ScalarType sum = 0.0;
+      for (auto k = 0ul; k < n; ++k) sum += coeff[k] * vecs[k].vec_val[i];
+      vec_val[i] += sum;
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Fused update and partial reductions, this += a * u, and accumulate the partial dot products
+   *        of the updated "this" with n vectors, and its squared norm, in the same pass.
+   * \note Use with reduceSums to obtain the global values, the halo entries are updated but not reduced.
+   * \param[in] a - Scale of u.
+   * \param[in] u - Vector added to "this".
+   * \param[in] n - Number of vectors.
+   * \param[in] vecs - Pointer to the first of the n vectors, they must be contiguous.
+   * \param[in,out] sums - The n + 1 partial sums, the squared norm of "this" goes in sums[n].
+   */
+  void localAxpyMultiDot(ScalarType a, const CSysVector& u, unsigned long n, const CSysVector* vecs,
+                         ScalarType* sums) {
+    SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      const ScalarType val = vec_val[i] + a * u.vec_val[i];
+      vec_val[i] = val;
+      for (auto k = 0ul; k < n; ++k) sums[k] += val * vecs[k].vec_val[i];
+      sums[n] += val * val;
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+    for (auto i = nElmDomain; i < nElm; ++i) vec_val[i] += a * u.vec_val[i];
+    END_SU2_OMP_FOR
+  }
+
   /*!
    * \brief Get pointer to a block.
    * \param[in] iPoint - Index of block.
@@ -419,6 +540,26 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Vectorized version of AddBlock, updates multiple iPoint's.
+   * \note See SIMD overload of SetBlock.
+   */
+  template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
+  FORCEINLINE void AddBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
+    /*--- "Transpose" and scale input vector. ---*/
+    constexpr size_t nVar = VecTypeSIMD::StaticSize;
+    assert(nVar == this->nVar);
+    ScalarType vec[N][nVar];
+    UnpackBlock(vector, mask, vec);
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < nVar; ++i) vec_val[iPoint[k] * nVar + i] += vec[k][i];
+    }
+  }
+
   /*!
    * \brief Vectorized version of UpdateBlocks, updates multiple i/jPoint's.
    * \note See SIMD overload of SetBlock.
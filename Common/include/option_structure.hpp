@@ -119,6 +119,7 @@ const unsigned short COMM_TYPE_DOUBLE         = 4;  /*!< \brief Communication ty
 const unsigned short COMM_TYPE_CHAR           = 5;  /*!< \brief Communication type for char. */
 const unsigned short COMM_TYPE_SHORT          = 6;  /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7;  /*!< \brief Communication type for int. */
+const unsigned short COMM_TYPE_FLOAT          = 8;  /*!< \brief Communication type for float. */
 
 /*!
  * \brief Types of geometric entities based on VTK nomenclature
@@ -285,10 +286,12 @@ static const MapType<std::string, MAIN_SOLVER> Solver_Map = {
 enum class ENUM_MULTIZONE {
   MZ_BLOCK_GAUSS_SEIDEL, /*!< \brief Definition of a Block-Gauss-Seidel multizone solver. */
   MZ_BLOCK_JACOBI,       /*!< \brief Definition of a Block-Jacobi solver. */
+  MZ_BLOCK_JACOBI_ASYNC, /*!< \brief Block-Jacobi solver with the interface transfers of all zones overlapped. */
 };
 static const MapType<std::string, ENUM_MULTIZONE> Multizone_Map = {
   MakePair("BLOCK_GAUSS_SEIDEL", ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL)
   MakePair("BLOCK_JACOBI", ENUM_MULTIZONE::MZ_BLOCK_JACOBI)
+  MakePair("BLOCK_JACOBI_ASYNC", ENUM_MULTIZONE::MZ_BLOCK_JACOBI_ASYNC)
 };
 
 /*!
@@ -1448,6 +1451,18 @@ static const MapType<std::string, ENUM_TIME_INT> Time_Int_Map = {
   MakePair("ADER_DG", ADER_DG)
 };
 
+/*!
+ * \brief Linearly implicit (Rosenbrock) variants of EULER_IMPLICIT for time-accurate (TIME_STEPPING) flows.
+ */
+enum class ROSENBROCK_SCHEME {
+  NONE,  /*!< \brief Backward Euler with one Newton iteration, first order. */
+  ROS2,  /*!< \brief Two stage Rosenbrock-W method of Verwer et al., second order and L-stable. */
+};
+static const MapType<std::string, ROSENBROCK_SCHEME> Rosenbrock_Map = {
+  MakePair("NONE", ROSENBROCK_SCHEME::NONE)
+  MakePair("ROS2", ROSENBROCK_SCHEME::ROS2)
+};
+
 /*!
  * \brief Type of predictor for the ADER-DG time integration scheme.
  */
@@ -1494,10 +1509,12 @@ static const MapType<std::string, STRUCT_TIME_INT> Time_Int_Map_FEA = {
 enum class STRUCT_SPACE_ITE {
   NEWTON,       /*!< \brief Full Newton-Rapshon method. */
   MOD_NEWTON,   /*!< \brief Modified Newton-Raphson method. */
+  BFGS,         /*!< \brief Modified Newton-Raphson method with BFGS updates of the inverse tangent. */
 };
 static const MapType<std::string, STRUCT_SPACE_ITE> Space_Ite_Map_FEA = {
   MakePair("NEWTON_RAPHSON", STRUCT_SPACE_ITE::NEWTON)
   MakePair("MODIFIED_NEWTON_RAPHSON", STRUCT_SPACE_ITE::MOD_NEWTON)
+  MakePair("BFGS", STRUCT_SPACE_ITE::BFGS)
 };
 
 /*!
@@ -1593,11 +1610,13 @@ enum class BGS_RELAXATION {
   NONE,       /*!< \brief No relaxation in the strongly coupled approach. */
   FIXED,      /*!< \brief Relaxation with a fixed parameter. */
   AITKEN,     /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  QUASI_NEWTON, /*!< \brief Interface quasi-Newton with inverse Jacobian from a least-squares model (IQN-ILS). */
 };
 static const MapType<std::string, BGS_RELAXATION> AitkenForm_Map = {
   MakePair("NONE", BGS_RELAXATION::NONE)
   MakePair("FIXED_PARAMETER", BGS_RELAXATION::FIXED)
   MakePair("AITKEN_DYNAMIC", BGS_RELAXATION::AITKEN)
+  MakePair("QUASI_NEWTON", BGS_RELAXATION::QUASI_NEWTON)
 };
 
 /*!
@@ -1976,13 +1995,111 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5, /*!< \brief SU2 binary input format (see SU2BinaryMesh.hpp). */
+  SYNTHETIC = 6   /*!< \brief 3D structured mesh generated by each rank (see CSyntheticMeshReaderFVM). */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
+  MakePair("SYNTHETIC", SYNTHETIC)
+};
+
+/*!
+ * \brief Elements of the SYNTHETIC mesh.
+ */
+enum class SYNTHETIC_MESH_ELEM {
+  HEXAHEDRA,  /*!< \brief One hexahedron per cell. */
+  TETRAHEDRA, /*!< \brief Six tetrahedra per cell. */
+  HYBRID,     /*!< \brief Prisms in the first cell layers above y_minus, tetrahedra elsewhere. */
+};
+static const MapType<std::string, SYNTHETIC_MESH_ELEM> SyntheticMeshElem_Map = {
+  MakePair("HEXAHEDRA", SYNTHETIC_MESH_ELEM::HEXAHEDRA)
+  MakePair("TETRAHEDRA", SYNTHETIC_MESH_ELEM::TETRAHEDRA)
+  MakePair("HYBRID", SYNTHETIC_MESH_ELEM::HYBRID)
+};
+
+/*!
+ * \brief Shape of the SYNTHETIC mesh.
+ */
+enum class SYNTHETIC_MESH_GEOM {
+  BOX,     /*!< \brief Box, as the BOX mesh format. */
+  ANNULUS, /*!< \brief Sector of an annulus, x is axial, y radial, and z the angle in degrees. */
+};
+static const MapType<std::string, SYNTHETIC_MESH_GEOM> SyntheticMeshGeom_Map = {
+  MakePair("BOX", SYNTHETIC_MESH_GEOM::BOX)
+  MakePair("ANNULUS", SYNTHETIC_MESH_GEOM::ANNULUS)
+};
+
+/*!
+ * \brief Renumbering of the (domain) points of each rank, applied after partitioning.
+ */
+enum class POINT_ORDERING {
+  NONE,     /*!< \brief Keep the order given by the partitioning. */
+  RCM,      /*!< \brief Reverse Cuthill-McKee, reduces the bandwidth of the matrices. */
+  HILBERT,  /*!< \brief Hilbert space-filling curve, based on the coordinates. */
+};
+static const MapType<std::string, POINT_ORDERING> Point_Ordering_Map = {
+  MakePair("NONE", POINT_ORDERING::NONE)
+  MakePair("RCM", POINT_ORDERING::RCM)
+  MakePair("HILBERT", POINT_ORDERING::HILBERT)
+};
+
+/*!
+ * \brief Additional balance constraints of the ParMETIS partitioning, besides the work-estimate weights.
+ */
+enum class PARMETIS_CONSTRAINT {
+  BOUNDARY_VERTICES,   /*!< \brief Points on the boundary markers (e.g. wall distance, output). */
+  INTERFACE_VERTICES,  /*!< \brief Points on the zone and fluid interfaces (interpolation). */
+};
+static const MapType<std::string, PARMETIS_CONSTRAINT> ParMETIS_Constraint_Map = {
+  MakePair("BOUNDARY_VERTICES", PARMETIS_CONSTRAINT::BOUNDARY_VERTICES)
+  MakePair("INTERFACE_VERTICES", PARMETIS_CONSTRAINT::INTERFACE_VERTICES)
+};
+
+/*!
+ * \brief Partitioner of the initial (linearly distributed) grid.
+ */
+enum class PARTITIONER {
+  PARMETIS,       /*!< \brief Graph partitioning (ParMETIS k-way). */
+  HILBERT_CURVE,  /*!< \brief Pieces of equal weight of the Hilbert space-filling curve through the points. */
+};
+static const MapType<std::string, PARTITIONER> Partitioner_Map = {
+  MakePair("PARMETIS", PARTITIONER::PARMETIS)
+  MakePair("HILBERT_CURVE", PARTITIONER::HILBERT_CURVE)
+};
+
+/*!
+ * \brief Error indicator used to mark the points for mesh adaptation.
+ */
+enum class ADAPT_INDICATOR {
+  NONE,      /*!< \brief No indicator. */
+  GRADIENT,  /*!< \brief First difference estimate, h |grad(u)|. */
+  HESSIAN,   /*!< \brief Interpolation error estimate, h^2 |H(u)|. */
+};
+static const MapType<std::string, ADAPT_INDICATOR> Adapt_Indicator_Map = {
+  MakePair("NONE", ADAPT_INDICATOR::NONE)
+  MakePair("GRADIENT", ADAPT_INDICATOR::GRADIENT)
+  MakePair("HESSIAN", ADAPT_INDICATOR::HESSIAN)
+};
+
+/*!
+ * \brief Flow variable on which the mesh adaptation indicator is computed.
+ */
+enum class ADAPT_VARIABLE {
+  DENSITY,      /*!< \brief Density (compressible). */
+  PRESSURE,     /*!< \brief Pressure. */
+  TEMPERATURE,  /*!< \brief Temperature. */
+  VELOCITY,     /*!< \brief All velocity components. */
+};
+static const MapType<std::string, ADAPT_VARIABLE> Adapt_Variable_Map = {
+  MakePair("DENSITY", ADAPT_VARIABLE::DENSITY)
+  MakePair("PRESSURE", ADAPT_VARIABLE::PRESSURE)
+  MakePair("TEMPERATURE", ADAPT_VARIABLE::TEMPERATURE)
+  MakePair("VELOCITY", ADAPT_VARIABLE::VELOCITY)
 };
 
 
@@ -2001,6 +2118,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2008,6 +2126,9 @@ enum class OUTPUT_TYPE {
   PARAVIEW_MULTIBLOCK,     /*!< \brief Paraview XML Multiblock */
   CGNS,                    /*!< \brief CGNS format. */
   SURFACE_CGNS,            /*!< \brief CGNS format. */
+  XDMF,                    /*!< \brief XDMF descriptor with the data in HDF5 format. */
+  SURFACE_XDMF,            /*!< \brief XDMF descriptor with the data in HDF5 format. */
+  ADIOS2,                  /*!< \brief ADIOS2 stream (in-situ processing) or BP files. */
   STL_ASCII,               /*!< \brief STL ASCII format for surface solution output. */
   STL_BINARY,              /*!< \brief STL binary format for surface solution output. Not implemented yet. */
 };
@@ -2026,10 +2147,14 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
   MakePair("SURFACE_CGNS", OUTPUT_TYPE::SURFACE_CGNS)
+  MakePair("XDMF", OUTPUT_TYPE::XDMF)
+  MakePair("SURFACE_XDMF", OUTPUT_TYPE::SURFACE_XDMF)
+  MakePair("ADIOS2", OUTPUT_TYPE::ADIOS2)
   MakePair("STL_ASCII", OUTPUT_TYPE::STL_ASCII)
   MakePair("STL_BINARY", OUTPUT_TYPE::STL_BINARY)
 };
@@ -2214,17 +2339,35 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  FGMRES_CGS,           /*!< \brief FGMRES with classical Gram-Schmidt and reorthogonalization (fewer reductions). */
+  PIPELINED_FGMRES,     /*!< \brief FGMRES with one global reduction per iteration (delayed reorthogonalization). */
+  RECYCLED_FGMRES,      /*!< \brief FGMRES deflated by a subspace recycled from the previous solves (GCRO). */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("FGMRES_CGS", FGMRES_CGS)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("RECYCLED_FGMRES", RECYCLED_FGMRES)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
 };
 
+/*!
+ * \brief How the tolerance of the linear solver is chosen for each solve.
+ */
+enum class LINEAR_SOLVER_FORCING {
+  FIXED,             /*!< \brief Always the same tolerance (LINEAR_SOLVER_ERROR). */
+  EISENSTAT_WALKER,  /*!< \brief Adaptive (inexact Newton) tolerance from the history of the nonlinear residual. */
+};
+static const MapType<std::string, LINEAR_SOLVER_FORCING> Linear_Solver_Forcing_Map = {
+  MakePair("FIXED", LINEAR_SOLVER_FORCING::FIXED)
+  MakePair("EISENSTAT_WALKER", LINEAR_SOLVER_FORCING::EISENSTAT_WALKER)
+};
+
 /*!
  * \brief Types surface continuity at the intersection with the FFD
  */
@@ -2279,6 +2422,8 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
+  IC,             /*!< \brief Block incomplete Cholesky preconditioner (symmetric systems, CONJUGATE_GRADIENT). */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2288,11 +2433,57 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
+  MakePair("IC", IC)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
 };
 
+/*!
+ * \brief Parts of the matrix factorized by PaStiX.
+ */
+enum class PASTIX_BLOCKS {
+  GLOBAL,  /*!< \brief The entire (distributed) matrix. */
+  RANK,    /*!< \brief The diagonal block of each rank (block-Jacobi between ranks). */
+  NODE,    /*!< \brief The diagonal block of each shared memory node (block-Jacobi between nodes). */
+};
+static const MapType<std::string, PASTIX_BLOCKS> Pastix_Blocks_Map = {
+  MakePair("GLOBAL", PASTIX_BLOCKS::GLOBAL)
+  MakePair("RANK", PASTIX_BLOCKS::RANK)
+  MakePair("NODE", PASTIX_BLOCKS::NODE)
+};
+
+/*!
+ * \brief Storage formats used by CSysMatrix in the matrix-vector product and Jacobi preconditioner.
+ */
+enum class MATRIX_FORMAT {
+  BCSR,  /*!< \brief Block compressed row storage only. */
+  SELL,  /*!< \brief Additional SELL-C-sigma copy, vectorized across rows. */
+  EDGE,  /*!< \brief Additional copy with the off-diagonal blocks stored by edge, also used by LU_SGS. */
+  SYMMETRIC,  /*!< \brief Like EDGE but only one block per edge, for systems solved with CONJUGATE_GRADIENT. */
+};
+static const MapType<std::string, MATRIX_FORMAT> Matrix_Format_Map = {
+  MakePair("BCSR", MATRIX_FORMAT::BCSR)
+  MakePair("SELL", MATRIX_FORMAT::SELL)
+  MakePair("EDGE", MATRIX_FORMAT::EDGE)
+  MakePair("SYMMETRIC", MATRIX_FORMAT::SYMMETRIC)
+};
+
+/*!
+ * \brief Linear systems that can be solved in single precision (LINEAR_SOLVER_SINGLE_PREC).
+ */
+enum class LINEAR_SYSTEM {
+  FLOW,        /*!< \brief Mean flow equations. */
+  TURBULENCE,  /*!< \brief Turbulence and transition models. */
+  SPECIES,     /*!< \brief Species transport. */
+};
+static const MapType<std::string, LINEAR_SYSTEM> Linear_System_Map = {
+  MakePair("FLOW", LINEAR_SYSTEM::FLOW)
+  MakePair("TURBULENCE", LINEAR_SYSTEM::TURBULENCE)
+  MakePair("SPECIES", LINEAR_SYSTEM::SPECIES)
+};
+
 /*!
  * \brief Types of analytic definitions for various geometries
  */
@@ -2361,6 +2552,34 @@ static const MapType<std::string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map =
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Methods for the volumetric mesh deformation (SU2_DEF and rigid/dynamic deformations of SU2_CFD).
+ */
+enum class DEFORM_METHOD {
+  ELASTICITY,  /*!< \brief Linear elasticity (FEA) solve. */
+  RBF,         /*!< \brief Radial basis function interpolation of the boundary displacements (greedy point selection). */
+};
+static const MapType<std::string, DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("ELASTICITY", DEFORM_METHOD::ELASTICITY)
+  MakePair("RBF", DEFORM_METHOD::RBF)
+};
+
+/*!
+ * \brief Kind of coupling with other codes through preCICE.
+ */
+enum class PRECICE_COUPLING {
+  NONE,             /*!< \brief No preCICE coupling. */
+  FSI,              /*!< \brief Read displacements of the markers, write the fluid forces on them. */
+  CHT_TEMPERATURE,  /*!< \brief Read the wall temperatures, write the wall heat fluxes. */
+  CHT_HEATFLUX,     /*!< \brief Read the wall heat fluxes, write the wall temperatures. */
+};
+static const MapType<std::string, PRECICE_COUPLING> Precice_Coupling_Map = {
+  MakePair("NONE", PRECICE_COUPLING::NONE)
+  MakePair("FSI", PRECICE_COUPLING::FSI)
+  MakePair("CHT_TEMPERATURE", PRECICE_COUPLING::CHT_TEMPERATURE)
+  MakePair("CHT_HEATFLUX", PRECICE_COUPLING::CHT_HEATFLUX)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -2465,6 +2684,7 @@ enum MPI_QUANTITIES {
   PRIMITIVE_GRADIENT   ,  /*!< \brief Primitive gradient communication. */
   PRIMITIVE_GRAD_REC   ,  /*!< \brief Primitive reconstruction gradient communication. */
   PRIMITIVE_LIMITER    ,  /*!< \brief Primitive limiter communication. */
+  PRIMITIVE_RECONSTRUCTION, /*!< \brief Primitive reconstruction gradient and limiter communication. */
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
@@ -2481,6 +2701,7 @@ enum MPI_QUANTITIES {
   MESH_DISPLACEMENTS   ,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      ,  /*!< \brief Solution at time n. */
   SOLUTION_TIME_N1     ,  /*!< \brief Solution at time n-1. */
+  TIME_STEP            ,  /*!< \brief Local time step communication (multirate time stepping). */
 };
 
 /*!
@@ -2497,6 +2718,30 @@ static const MapType<std::string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Ordering of the edges before they are colored for the thread-parallel edge loops.
+ */
+enum class EDGE_COLORING {
+  GREEDY,       /*!< \brief Color the groups of edges in the natural order of the edges. */
+  PARTITIONED,  /*!< \brief Sort the edges by sub-domains of the points of the rank before forming the groups. */
+};
+static const MapType<std::string, EDGE_COLORING> Edge_Coloring_Map = {
+  MakePair("GREEDY",      EDGE_COLORING::GREEDY)
+  MakePair("PARTITIONED", EDGE_COLORING::PARTITIONED)
+};
+
+/*!
+ * \brief Strategy of the thread-parallel edge loops when the coloring efficiency is low.
+ */
+enum class EDGE_FALLBACK {
+  REDUCTION,       /*!< \brief Store the edge fluxes and sum them per point in a second loop. */
+  OWNER_COMPUTES,  /*!< \brief Each thread owns a range of points and computes all the edges of its points. */
+};
+static const MapType<std::string, EDGE_FALLBACK> Edge_Fallback_Map = {
+  MakePair("REDUCTION",      EDGE_FALLBACK::REDUCTION)
+  MakePair("OWNER_COMPUTES", EDGE_FALLBACK::OWNER_COMPUTES)
+};
+
 /*!
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
@@ -2601,6 +2846,20 @@ static const MapType<std::string, POD_KIND> POD_Map = {
   MakePair("INCREMENTAL_POD", POD_KIND::INCREMENTAL)
 };
 
+/*!
+ * \brief Online use of a POD basis (for use with libROM)
+ */
+enum class ROM_ONLINE {
+  NONE,              /*!< \brief The basis is not used online. */
+  LSPG,              /*!< \brief Replace the linear solve of the Newton step by its least-squares projection on the basis. */
+  INITIAL_GUESS,     /*!< \brief Use the projected step as the initial guess of the full linear solve. */
+};
+static const MapType<std::string, ROM_ONLINE> ROM_Online_Map = {
+  MakePair("NONE",          ROM_ONLINE::NONE)
+  MakePair("LSPG",          ROM_ONLINE::LSPG)
+  MakePair("INITIAL_GUESS", ROM_ONLINE::INITIAL_GUESS)
+};
+
 /*!
  * \brief Type of operation for the linear system solver, changes the source of solver options.
  */
@@ -0,0 +1,81 @@
+/*!
+ * \file comm_progress.hpp
+ * \brief Helper thread that drives the progress of non-blocking (MPI) communications.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <utility>
+
+/*!
+ * \class CCommProgressThread
+ * \brief Runs a polling function on a dedicated (non-OpenMP) thread until it reports completion or the thread is stopped.
+ * \details Most MPI implementations only make progress on non-blocking communications inside MPI calls, polling them
+ * (e.g. with MPI_Testsome) from a helper thread lets messages arrive while the compute threads are busy. The polling
+ * function can also process the messages as they arrive. The owner must not use the data touched by the function
+ * until Stop() returns, which also makes the effects of the function visible to the calling thread.
+ * \note Calling MPI from two threads requires MPI_THREAD_MULTIPLE.
+ */
+class CCommProgressThread {
+ private:
+  std::thread worker;
+  std::atomic<bool> stop{false};
+
+ public:
+  CCommProgressThread() = default;
+  CCommProgressThread(const CCommProgressThread&) = delete;
+  CCommProgressThread& operator=(const CCommProgressThread&) = delete;
+  ~CCommProgressThread() { Stop(); }
+
+  /*!
+   * \brief Start polling.
+   * \param[in] poll - Function called repeatedly by the thread, returns true when there is nothing left to do.
+   */
+  template <class F>
+  void Start(F poll) {
+    assert(!Active() && "The progress thread is already running.");
+    stop.store(false, std::memory_order_relaxed);
+    worker = std::thread([this](F fun) {
+      while (!stop.load(std::memory_order_acquire) && !fun()) std::this_thread::yield();
+    }, std::move(poll));
+  }
+
+  /*!
+   * \brief Whether the thread was started and not yet stopped.
+   */
+  bool Active() const { return worker.joinable(); }
+
+  /*!
+   * \brief Stop polling (if the function has not completed yet) and join the thread.
+   */
+  void Stop() {
+    if (!Active()) return;
+    stop.store(true, std::memory_order_release);
+    worker.join();
+  }
+};
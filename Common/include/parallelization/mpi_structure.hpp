@@ -173,6 +173,20 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int count, Request* request) { MPI_Startall(count, request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
@@ -181,6 +195,12 @@ class CBaseMPIWrapper {
     MPI_Testall(count, array_of_requests, flag, array_of_statuses);
   }
 
+  static inline void Testany(int count, Request* array_of_requests, int* index, int* flag, Status* status) {
+    MPI_Testany(count, array_of_requests, index, flag, status);
+  }
+
+  static inline void Query_thread(int* provided) { MPI_Query_thread(provided); }
+
   static inline void Waitall(int nrequests, Request* request, Status* status) {
     MPI_Waitall(nrequests, request, status);
   }
@@ -223,6 +243,11 @@ class CBaseMPIWrapper {
     MPI_Allgather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, comm);
   }
 
+  static inline void Iallgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
+                                Datatype recvtype, Comm comm, Request* request) {
+    MPI_Iallgather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, comm, request);
+  }
+
   static inline void Allgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm) {
     MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
@@ -539,6 +564,16 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int count, Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request* request) { return 0; }
@@ -582,6 +617,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
   }
 
+  static inline void Iallgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
+                                Datatype recvtype, Comm comm, Request* request) {
+    CopyData(sendbuf, recvbuf, sendcnt, sendtype);
+  }
+
   static inline void Sendrecv(const void* sendbuf, int sendcnt, Datatype sendtype, int dest, int sendtag, void* recvbuf,
                               int recvcnt, Datatype recvtype, int source, int recvtag, Comm comm, Status* status) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -624,9 +664,9 @@ template <>
 struct SelectMPIWrapper<passivedouble> {
   typedef CBaseMPIWrapper W;
 };
-#if defined USE_MIXED_PRECISION
+#if defined USE_MIXED_PRECISION || defined USE_SINGLE_PRECISION_SYSTEMS
 template <>
-struct SelectMPIWrapper<su2mixedfloat> {
+struct SelectMPIWrapper<float> {
   typedef CBaseMPIWrapper W;
 };
 #endif
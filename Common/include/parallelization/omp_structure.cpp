@@ -27,6 +27,25 @@
  */
 
 #include "omp_structure.hpp"
+#include "mpi_structure.hpp"
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+bool firstTouch = true;
+}
+
+void omp_set_first_touch(bool enable) { firstTouch = enable; }
+
+bool omp_get_first_touch() { return firstTouch; }
 
 void omp_initialize() {
 #ifdef HAVE_OPDI
@@ -54,6 +73,57 @@ void omp_finalize() {
 #endif
 }
 
+void omp_report_affinity() {
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  int nThread = omp_get_max_threads(), maxThread = 0;
+  SU2_MPI::Allreduce(&nThread, &maxThread, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+
+  /*--- CPU, NUMA node, and number of CPUs each thread may run on (-1 if not available). ---*/
+  std::vector<int> local(3 * maxThread, -1), global;
+  /*--- Not an AD-aware region, this may be called before omp_initialize. ---*/
+  SU2_OMP(parallel) {
+#if defined(__linux__)
+    const int iThread = omp_get_thread_num();
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+      local[3 * iThread] = cpu;
+      local[3 * iThread + 1] = node;
+    }
+    cpu_set_t cpus;
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) local[3 * iThread + 2] = CPU_COUNT(&cpus);
+#endif
+  }
+
+  if (rank == 0) global.resize(local.size() * size);
+  SU2_MPI::Gather(local.data(), local.size(), MPI_INT, global.data(), local.size(), MPI_INT, 0, SU2_MPI::GetComm());
+  if (rank != 0) return;
+
+  std::cout << "\nOpenMP thread affinity, CPU (NUMA node) of each thread, * if not bound to a single CPU:\n";
+  int notBound = 0, shared = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    std::cout << "  Rank " << iRank << ":";
+    std::set<int> cpus;
+    for (int iThread = 0; iThread < maxThread; ++iThread) {
+      const int* info = &global[3 * (iRank * maxThread + iThread)];
+      if (info[2] < 0) continue;
+      std::cout << ' ' << info[0] << '(' << info[1] << ')' << (info[2] > 1 ? "*" : "");
+      notBound += (info[2] > 1);
+      shared += !cpus.insert(info[0]).second;
+    }
+    std::cout << '\n';
+  }
+  if (notBound) {
+    std::cout << "WARNING: " << notBound << " threads are not bound to a single CPU, they may migrate away from the\n"
+              << "         NUMA domain of their data. Set e.g. OMP_PLACES=cores and OMP_PROC_BIND=close.\n";
+  }
+  if (shared) {
+    std::cout << "WARNING: " << shared << " threads run on the same CPU as another thread of their rank.\n";
+  }
+  std::cout << std::endl;
+}
+
 #ifdef HAVE_OPDI
 #include "opdi.cpp"
 #endif
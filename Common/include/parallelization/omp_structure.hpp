@@ -39,6 +39,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 
 #include "../code_config.hpp"
 
@@ -119,6 +120,23 @@ inline void omp_destroy_lock(omp_lock_t*) {}
 void omp_initialize();
 void omp_finalize();
 
+/*!
+ * \brief Print the CPU and NUMA node of each thread of each MPI rank (on the master rank), and warn about
+ *        threads that are not bound to a single CPU. Must be called by all ranks, outside parallel regions.
+ */
+void omp_report_affinity();
+
+/*!
+ * \brief Enable or disable the initialization of large arrays by all threads (see firstTouchSet), e.g.
+ *        to compare with the placement of the pages by one thread.
+ */
+void omp_set_first_touch(bool enable);
+
+/*!
+ * \brief Whether large arrays are initialized by all threads (the default).
+ */
+bool omp_get_first_touch();
+
 /*--- Detect SIMD support (version 4+, after Jul 2013). ---*/
 #ifdef _OPENMP
 #if _OPENMP >= 201307
@@ -257,6 +275,64 @@ void parallelSet(size_t size, T val, U* dst) {
   END_SU2_OMP_FOR
 }
 
+/*!
+ * \brief Minimum size, in bytes, of the arrays that are initialized by all threads (see firstTouchSet).
+ */
+enum : size_t { FIRST_TOUCH_MIN_BYTES = 1ul << 20 };
+
+/*!
+ * \brief Whether a newly allocated array should be initialized by all threads, i.e. if it is large,
+ *        there are several threads, and the caller is not in a parallel region.
+ * \param[in] bytes - Size of the array.
+ */
+inline bool useFirstTouch(size_t bytes) {
+  return (bytes >= FIRST_TOUCH_MIN_BYTES) && (omp_get_max_threads() > 1) && !omp_in_parallel() &&
+         omp_get_first_touch();
+}
+
+/*!
+ * \brief Set the entries of a newly allocated array with all the threads, with the static schedule of the
+ *        loops that will use it, such that the OS ("first touch" policy) places its pages on the NUMA
+ *        domains of those threads, instead of all on the domain of the thread that allocates it.
+ * \note Small arrays, or arrays set inside parallel regions, are set by the calling thread. This is not
+ *       an AD-aware parallel region, use it only for passive data.
+ * \param[in] size - Number of elements.
+ * \param[in] val - Value to set.
+ * \param[in] dst - Destination array.
+ * \param[in] chunkSize - Chunk size of the static schedule.
+ */
+template <class T, class U>
+void firstTouchSet(size_t size, T val, U* dst, size_t chunkSize) {
+  if (!useFirstTouch(size * sizeof(U))) {
+    for (size_t i = 0; i < size; ++i) dst[i] = val;
+    return;
+  }
+  SU2_OMP(parallel for schedule(static, chunkSize))
+  for (size_t i = 0; i < size; ++i) dst[i] = val;
+}
+
+/*!
+ * \brief Zero the bytes of a newly allocated array, in the same way as firstTouchSet, for
+ *        types that are valid when zeroed but cannot be assigned before being constructed.
+ * \param[in] size - Number of elements.
+ * \param[in] dst - Destination array.
+ * \param[in] chunkSize - Chunk size of the static schedule.
+ */
+template <class U>
+void firstTouchZero(size_t size, U* dst, size_t chunkSize) {
+  if (!useFirstTouch(size * sizeof(U))) {
+    if (size) memset(static_cast<void*>(dst), 0, size * sizeof(U));
+    return;
+  }
+  const size_t nChunk = roundUpDiv(size, chunkSize);
+  SU2_OMP(parallel for schedule(static, 1))
+  for (size_t iChunk = 0; iChunk < nChunk; ++iChunk) {
+    const size_t begin = iChunk * chunkSize;
+    const size_t end = (begin + chunkSize < size) ? begin + chunkSize : size;
+    memset(static_cast<void*>(dst + begin), 0, (end - begin) * sizeof(U));
+  }
+}
+
 /*!
  * \brief Atomically update a (shared) lhs value with a (local) rhs value.
  * \note For types without atomic support (non-arithmetic) this is done via critical.
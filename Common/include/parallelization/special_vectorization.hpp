@@ -41,6 +41,8 @@
  * strip their type / size characteristics, e.g. _mm256_add_pd -> add_p,
  * overload resolution will do the rest. The first four symbols are
  * undefined once we are done using them.
+ * \param[in] GATHER_P, SCATTER_P - Optional, wrappers of gather/scatter
+ * instructions, otherwise these operations are element-wise.
  */
 template <>
 class ARRAY_T {
@@ -81,7 +83,19 @@ class ARRAY_T {
   FORCEINLINE void stream(Scalar* ptr) const { stream_p(ptr, reg); }
   template <class T>
   FORCEINLINE void gather(const Scalar* begin, const T& offsets) {
+#ifdef GATHER_P
+    reg = GATHER_P(SIZE_TAG, begin, offsets);
+#else
     FOREACH x_[k] = begin[offsets[k]];
+#endif
+  }
+  template <class T>
+  FORCEINLINE void scatter(Scalar* begin, const T& offsets) const {
+#ifdef SCATTER_P
+    SCATTER_P(begin, offsets, reg);
+#else
+    FOREACH begin[offsets[k]] = x_[k];
+#endif
   }
 
   /*--- Compound assignement operators. ---*/
@@ -184,5 +198,7 @@ MAKE_BINARY_FUN(pow, ::pow)
 #undef SCALAR_T
 #undef REGISTER_T
 #undef SIZE_TAG
+#undef GATHER_P
+#undef SCATTER_P
 
 /// @}
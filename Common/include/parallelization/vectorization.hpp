@@ -35,6 +35,14 @@
 #ifdef __SSE2__
 #include "x86intrin.h"
 #endif
+/*--- SVE is only used with a vector length fixed at compile time (e.g. -msve-vector-bits=512). ---*/
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && __ARM_FEATURE_SVE_BITS > 0
+#define SU2_SVE_BITS __ARM_FEATURE_SVE_BITS
+#include <arm_sve.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace simd {
 /// \addtogroup SIMD
@@ -42,13 +50,17 @@ namespace simd {
 
 using namespace VecExpr;
 
-/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures. ---*/
+/*--- Detect preferred SIMD size (bytes). This covers x86 and ARM (64-bit) architectures. ---*/
 #if defined(__AVX512F__)
 constexpr size_t PREFERRED_SIZE = 64;
 #elif defined(__AVX__)
 constexpr size_t PREFERRED_SIZE = 32;
 #elif defined(__SSE2__)
 constexpr size_t PREFERRED_SIZE = 16;
+#elif defined(SU2_SVE_BITS)
+constexpr size_t PREFERRED_SIZE = SU2_SVE_BITS / 8;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+constexpr size_t PREFERRED_SIZE = 16;
 #else
 constexpr size_t PREFERRED_SIZE = 8;
 #endif
@@ -163,6 +175,10 @@ class Array : public CVecExpr<Array<Scalar_t, N>, Scalar_t> {
   FORCEINLINE void gather(const Scalar* begin, const T& offsets) {
     FOREACH x_[k] = begin[offsets[k]];
   }
+  template <class T>
+  FORCEINLINE void scatter(Scalar* begin, const T& offsets) const {
+    FOREACH begin[offsets[k]] = x_[k];
+  }
 
   /*--- Compound assignment operators. ---*/
 
@@ -196,6 +212,7 @@ struct TWO {};
 struct FOUR {};
 struct EIGHT {};
 struct SIXTEEN {};
+struct SVE {};
 }  // namespace SizeTag
 
 /*--- Constants for bitwise implementations. ---*/
@@ -340,6 +357,128 @@ FORCEINLINE __m512d sign_p(__m512d x) { return _mm512_or_pd(ones_8d, _mm512_and_
 
 #endif  // __AVX512F__
 
+/*--- ARM specializations, see https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ * for documentation on the NEON ("v*q_f64") and SVE ("sv*_f64") functions. ---*/
+
+#if defined(__ARM_NEON) && defined(__aarch64__) && !(defined(SU2_SVE_BITS) && SU2_SVE_BITS == 128)
+/*!
+ * Create specialization for array of 2 doubles (AArch64 NEON, unless SVE has the same size).
+ */
+#define ARRAY_T Array<double, 2>
+#define SCALAR_T double
+#define REGISTER_T float64x2_t
+#define SIZE_TAG SizeTag::TWO()
+
+static const float64x2_t ones_2d = vdupq_n_f64(1);
+static const uint64x2_t sign_mask_2d = vdupq_n_u64(sign_mask_d);
+
+FORCEINLINE float64x2_t set1_p(SizeTag::TWO, double p) { return vdupq_n_f64(p); }
+FORCEINLINE float64x2_t load_p(SizeTag::TWO, const double* p) { return vld1q_f64(p); }
+FORCEINLINE float64x2_t loadu_p(SizeTag::TWO, const double* p) { return vld1q_f64(p); }
+FORCEINLINE void store_p(double* p, float64x2_t x) { vst1q_f64(p, x); }
+FORCEINLINE void storeu_p(double* p, float64x2_t x) { vst1q_f64(p, x); }
+FORCEINLINE void stream_p(double* p, float64x2_t x) { vst1q_f64(p, x); }
+
+FORCEINLINE float64x2_t add_p(float64x2_t a, float64x2_t b) { return vaddq_f64(a, b); }
+FORCEINLINE float64x2_t sub_p(float64x2_t a, float64x2_t b) { return vsubq_f64(a, b); }
+FORCEINLINE float64x2_t mul_p(float64x2_t a, float64x2_t b) { return vmulq_f64(a, b); }
+FORCEINLINE float64x2_t div_p(float64x2_t a, float64x2_t b) { return vdivq_f64(a, b); }
+FORCEINLINE float64x2_t max_p(float64x2_t a, float64x2_t b) { return vmaxq_f64(a, b); }
+FORCEINLINE float64x2_t min_p(float64x2_t a, float64x2_t b) { return vminq_f64(a, b); }
+
+/*--- Comparisons produce all-ones masks, which select 1 or 0. ---*/
+FORCEINLINE float64x2_t mask_p(uint64x2_t m) {
+  return vreinterpretq_f64_u64(vandq_u64(m, vreinterpretq_u64_f64(ones_2d)));
+}
+FORCEINLINE float64x2_t eq_p(float64x2_t a, float64x2_t b) { return mask_p(vceqq_f64(a, b)); }
+FORCEINLINE float64x2_t lt_p(float64x2_t a, float64x2_t b) { return mask_p(vcltq_f64(a, b)); }
+FORCEINLINE float64x2_t le_p(float64x2_t a, float64x2_t b) { return mask_p(vcleq_f64(a, b)); }
+FORCEINLINE float64x2_t ne_p(float64x2_t a, float64x2_t b) { return vsubq_f64(ones_2d, eq_p(a, b)); }
+FORCEINLINE float64x2_t ge_p(float64x2_t a, float64x2_t b) { return mask_p(vcgeq_f64(a, b)); }
+FORCEINLINE float64x2_t gt_p(float64x2_t a, float64x2_t b) { return mask_p(vcgtq_f64(a, b)); }
+
+FORCEINLINE float64x2_t sqrt_p(float64x2_t x) { return vsqrtq_f64(x); }
+FORCEINLINE float64x2_t abs_p(float64x2_t x) { return vabsq_f64(x); }
+FORCEINLINE float64x2_t neg_p(float64x2_t x) { return vnegq_f64(x); }
+FORCEINLINE float64x2_t sign_p(float64x2_t x) {
+  return vreinterpretq_f64_u64(
+      vorrq_u64(vreinterpretq_u64_f64(ones_2d), vandq_u64(vreinterpretq_u64_f64(x), sign_mask_2d)));
+}
+
+#include "special_vectorization.hpp"
+
+#endif  // __ARM_NEON
+
+#ifdef SU2_SVE_BITS
+/*!
+ * Create specialization for array of SU2_SVE_BITS/64 doubles. The SVE types are "sizeless", the fixed-length
+ * versions (arm_sve_vector_bits attribute) can be used like the other register types (e.g. in unions).
+ * Since the vector length is fixed, the operations are predicated with an all-true predicate.
+ */
+typedef svfloat64_t sv_f64 __attribute__((arm_sve_vector_bits(SU2_SVE_BITS)));
+typedef svuint64_t sv_u64 __attribute__((arm_sve_vector_bits(SU2_SVE_BITS)));
+
+#define ARRAY_T Array<double, SU2_SVE_BITS / 64>
+#define SCALAR_T double
+#define REGISTER_T sv_f64
+#define SIZE_TAG SizeTag::SVE()
+#define GATHER_P gather_p
+#define SCATTER_P scatter_p
+
+FORCEINLINE svbool_t ptrue_sve() { return svptrue_b64(); }
+static const sv_f64 ones_sve = svdup_n_f64(1);
+
+FORCEINLINE sv_f64 set1_p(SizeTag::SVE, double p) { return svdup_n_f64(p); }
+FORCEINLINE sv_f64 load_p(SizeTag::SVE, const double* p) { return svld1_f64(ptrue_sve(), p); }
+FORCEINLINE sv_f64 loadu_p(SizeTag::SVE, const double* p) { return svld1_f64(ptrue_sve(), p); }
+FORCEINLINE void store_p(double* p, sv_f64 x) { svst1_f64(ptrue_sve(), p, x); }
+FORCEINLINE void storeu_p(double* p, sv_f64 x) { svst1_f64(ptrue_sve(), p, x); }
+FORCEINLINE void stream_p(double* p, sv_f64 x) { svstnt1_f64(ptrue_sve(), p, x); }
+
+/*--- Indexed loads and stores, the offsets are converted to a vector of 64-bit indices. ---*/
+template <class T>
+FORCEINLINE sv_u64 index_p(const T& offsets) {
+  uint64_t idx[SU2_SVE_BITS / 64];
+  for (size_t k = 0; k < SU2_SVE_BITS / 64; ++k) idx[k] = offsets[k];
+  return svld1_u64(ptrue_sve(), idx);
+}
+template <class T>
+FORCEINLINE sv_f64 gather_p(SizeTag::SVE, const double* p, const T& offsets) {
+  return svld1_gather_u64index_f64(ptrue_sve(), p, index_p(offsets));
+}
+template <class T>
+FORCEINLINE void scatter_p(double* p, const T& offsets, sv_f64 x) {
+  svst1_scatter_u64index_f64(ptrue_sve(), p, index_p(offsets), x);
+}
+
+FORCEINLINE sv_f64 add_p(sv_f64 a, sv_f64 b) { return svadd_f64_x(ptrue_sve(), a, b); }
+FORCEINLINE sv_f64 sub_p(sv_f64 a, sv_f64 b) { return svsub_f64_x(ptrue_sve(), a, b); }
+FORCEINLINE sv_f64 mul_p(sv_f64 a, sv_f64 b) { return svmul_f64_x(ptrue_sve(), a, b); }
+FORCEINLINE sv_f64 div_p(sv_f64 a, sv_f64 b) { return svdiv_f64_x(ptrue_sve(), a, b); }
+FORCEINLINE sv_f64 max_p(sv_f64 a, sv_f64 b) { return svmax_f64_x(ptrue_sve(), a, b); }
+FORCEINLINE sv_f64 min_p(sv_f64 a, sv_f64 b) { return svmin_f64_x(ptrue_sve(), a, b); }
+
+/*--- Comparisons produce predicates, the active lanes are set to 1 and the others to 0. ---*/
+FORCEINLINE sv_f64 mask_p(svbool_t m) { return svdup_n_f64_z(m, 1); }
+FORCEINLINE sv_f64 eq_p(sv_f64 a, sv_f64 b) { return mask_p(svcmpeq_f64(ptrue_sve(), a, b)); }
+FORCEINLINE sv_f64 lt_p(sv_f64 a, sv_f64 b) { return mask_p(svcmplt_f64(ptrue_sve(), a, b)); }
+FORCEINLINE sv_f64 le_p(sv_f64 a, sv_f64 b) { return mask_p(svcmple_f64(ptrue_sve(), a, b)); }
+FORCEINLINE sv_f64 ne_p(sv_f64 a, sv_f64 b) { return mask_p(svcmpne_f64(ptrue_sve(), a, b)); }
+FORCEINLINE sv_f64 ge_p(sv_f64 a, sv_f64 b) { return mask_p(svcmpge_f64(ptrue_sve(), a, b)); }
+FORCEINLINE sv_f64 gt_p(sv_f64 a, sv_f64 b) { return mask_p(svcmpgt_f64(ptrue_sve(), a, b)); }
+
+FORCEINLINE sv_f64 sqrt_p(sv_f64 x) { return svsqrt_f64_x(ptrue_sve(), x); }
+FORCEINLINE sv_f64 abs_p(sv_f64 x) { return svabs_f64_x(ptrue_sve(), x); }
+FORCEINLINE sv_f64 neg_p(sv_f64 x) { return svneg_f64_x(ptrue_sve(), x); }
+FORCEINLINE sv_f64 sign_p(sv_f64 x) {
+  const auto bits = svand_n_u64_x(ptrue_sve(), svreinterpret_u64_f64(x), sign_mask_d);
+  return svreinterpret_f64_u64(svorr_u64_x(ptrue_sve(), svreinterpret_u64_f64(ones_sve), bits));
+}
+
+#include "special_vectorization.hpp"
+
+#endif  // SU2_SVE_BITS
+
 #undef ARRAY_BOILERPLATE
 
 /// @}
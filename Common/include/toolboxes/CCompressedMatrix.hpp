@@ -0,0 +1,173 @@
+/*!
+ * \file CCompressedMatrix.hpp
+ * \brief Compact (optionally lossy, error-bounded) storage of matrices.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "../basic_types/datatype_structure.hpp"
+
+/*!
+ * \class CCompressedMatrix
+ * \brief Stores the (passive) values of a matrix, either exactly, or such that the error of each entry does not
+ *        exceed a fraction (relative tolerance) of the range of values of its column.
+ * \details The lossy mode is a prediction-quantization scheme: the entries of each column are quantized to integer
+ * multiples of twice the absolute tolerance, each row is predicted by the previous one, and the differences are
+ * encoded with a variable number of bytes. Rows that are close in memory should have similar values (e.g. the
+ * points of a renumbered grid) for a good compression ratio. A relative tolerance of 1e-6 typically reduces the
+ * size 2-3 times.
+ * \note The matrix type must provide rows(), cols(), and operator()(i,j).
+ */
+class CCompressedMatrix {
+ private:
+  unsigned long nRows = 0, nCols = 0;
+  bool lossless = true;
+  std::vector<passivedouble> origin, step; /*!< \brief Minimum and quantization step of each column. */
+  std::vector<uint8_t> bytes;              /*!< \brief Encoded values. */
+
+  void PutVarint(uint64_t value) {
+    while (value >= 0x80) {
+      bytes.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    bytes.push_back(static_cast<uint8_t>(value));
+  }
+
+  uint64_t GetVarint(size_t& pos) const {
+    uint64_t value = 0;
+    for (unsigned shift = 0;; shift += 7) {
+      const uint8_t byte = bytes[pos++];
+      value |= uint64_t(byte & 0x7f) << shift;
+      if (byte < 0x80) return value;
+    }
+  }
+
+ public:
+  /*!
+   * \brief Store a matrix.
+   * \param[in] mat - The matrix.
+   * \param[in] relTol - Max error of each entry relative to the range of its column, 0 for exact storage.
+   */
+  template <class Mat>
+  void Compress(const Mat& mat, passivedouble relTol) {
+    nRows = mat.rows();
+    nCols = mat.cols();
+    lossless = !(relTol > 0);
+    bytes.clear();
+    origin.clear();
+    step.clear();
+
+    if (lossless) {
+      bytes.resize(nRows * nCols * sizeof(passivedouble));
+      for (auto i = 0ul; i < nRows; ++i) {
+        for (auto j = 0ul; j < nCols; ++j) {
+          const passivedouble value = SU2_TYPE::GetValue(mat(i, j));
+          memcpy(&bytes[(i * nCols + j) * sizeof(passivedouble)], &value, sizeof(passivedouble));
+        }
+      }
+      return;
+    }
+
+    origin.resize(nCols);
+    step.resize(nCols);
+    for (auto j = 0ul; j < nCols; ++j) {
+      passivedouble minVal = 0, maxVal = 0;
+      for (auto i = 0ul; i < nRows; ++i) {
+        const passivedouble value = SU2_TYPE::GetValue(mat(i, j));
+        if (i == 0 || value < minVal) minVal = value;
+        if (i == 0 || value > maxVal) maxVal = value;
+      }
+      origin[j] = minVal;
+      /*--- Rounding to the nearest multiple of the step gives an error of at most half the step. ---*/
+      step[j] = 2 * relTol * (maxVal - minVal);
+      if (!(step[j] > 0)) step[j] = 1;
+    }
+
+    bytes.reserve(nRows * nCols * 3);
+    std::vector<int64_t> previous(nCols, 0);
+    for (auto i = 0ul; i < nRows; ++i) {
+      for (auto j = 0ul; j < nCols; ++j) {
+        const passivedouble value = SU2_TYPE::GetValue(mat(i, j));
+        const auto q = static_cast<int64_t>(std::llround((value - origin[j]) / step[j]));
+        const int64_t delta = q - previous[j];
+        previous[j] = q;
+        /*--- Zigzag encoding, small differences of either sign take few bytes. ---*/
+        PutVarint((static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+      }
+    }
+    bytes.shrink_to_fit();
+  }
+
+  /*!
+   * \brief Retrieve the matrix.
+   * \param[out] mat - Matrix with the same dimensions as the stored one.
+   */
+  template <class Mat>
+  void Decompress(Mat& mat) const {
+    assert(mat.rows() == nRows && mat.cols() == nCols && "Wrong dimensions.");
+
+    if (lossless) {
+      for (auto i = 0ul; i < nRows; ++i) {
+        for (auto j = 0ul; j < nCols; ++j) {
+          passivedouble value;
+          memcpy(&value, &bytes[(i * nCols + j) * sizeof(passivedouble)], sizeof(passivedouble));
+          mat(i, j) = value;
+        }
+      }
+      return;
+    }
+
+    size_t pos = 0;
+    std::vector<int64_t> previous(nCols, 0);
+    for (auto i = 0ul; i < nRows; ++i) {
+      for (auto j = 0ul; j < nCols; ++j) {
+        const auto zigzag = GetVarint(pos);
+        previous[j] += static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        mat(i, j) = origin[j] + previous[j] * step[j];
+      }
+    }
+  }
+
+  /*!
+   * \brief Number of rows of the stored matrix.
+   */
+  unsigned long rows() const { return nRows; }
+
+  /*!
+   * \brief Number of columns of the stored matrix.
+   */
+  unsigned long cols() const { return nCols; }
+
+  /*!
+   * \brief Size of the stored data in bytes.
+   */
+  size_t GetMemory() const { return bytes.capacity() + (origin.size() + step.size()) * sizeof(passivedouble); }
+};
@@ -0,0 +1,72 @@
+/*!
+ * \file CDistributedNearestNeighbor.hpp
+ * \brief Nearest neighbor search between distributed donor data and local target points.
+ *        The implementation is in <i>CDistributedNearestNeighbor.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../containers/C2DContainer.hpp"
+
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CDistributedNearestNeighbor
+ * \brief Finds, for each local target point, the nearest of the donor points held by all ranks, without
+ *        gathering the donors. The donors can be distributed in any way, e.g. the linear partitions in which
+ *        restart or profile files are read, and they carry their data (rows of values starting with the
+ *        coordinates) with them.
+ * \note Each rank sends its donors to the ranks whose target bounding box contains them, which then search
+ *       them with an ADT. Since the nearest donor of a target may be outside the box, a second round sends
+ *       the donors that are within the largest distance found by each rank of its box, which makes the
+ *       result exact. All ranks must call Search (it is collective), even if they have no targets or donors.
+ */
+class CDistributedNearestNeighbor {
+ private:
+  const unsigned short nDim;     /*!< \brief Number of dimensions. */
+  su2passivematrix targetCoord;  /*!< \brief Coordinates of the local target points. */
+
+ public:
+  /*!
+   * \brief Construct the search for a set of local target points.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] nTarget - Number of local target points.
+   * \param[in] coord - Coordinates of the targets, nTarget rows of nDim values.
+   */
+  CDistributedNearestNeighbor(unsigned short nDim, unsigned long nTarget, const su2double* coord);
+
+  /*!
+   * \brief Find the nearest donor of each target and copy its data.
+   * \param[in] nDonor - Number of donors on this rank.
+   * \param[in] nValue - Number of values per donor, the first nDim are its coordinates.
+   * \param[in] donorData - Values of the local donors, nDonor rows of nValue values.
+   * \param[out] targetData - Values of the nearest donor of each target (nTarget x nValue).
+   * \param[out] targetDist - Distance from each target to its nearest donor (max. double if there are no donors).
+   */
+  void Search(unsigned long nDonor, unsigned long nValue, const passivedouble* donorData,
+              su2passivematrix& targetData, vector<passivedouble>& targetDist) const;
+};
@@ -0,0 +1,81 @@
+/*!
+ * \file CFilePrefetcher.hpp
+ * \brief Background reading of input files (meshes, restarts) to have them in the page cache when needed.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../parallelization/comm_progress.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*!
+ * \class CFilePrefetcher
+ * \brief Reads a list of files, in order and in chunks, on a background thread and discards the data.
+ * \details This brings the files into the page cache of the node (or of the client of a parallel file system)
+ * while the ranks are busy with other work, e.g. the mesh of zone k+1 is read while zone k is partitioned,
+ * and the restart files of all zones while the geometry is preprocessed. The actual reads, with all their
+ * collectives, are done later by the usual readers, in the usual order. Missing files are skipped.
+ * One rank per node reads, the thread only uses the file system (no MPI or OpenMP).
+ */
+class CFilePrefetcher {
+ public:
+  enum : unsigned long { CHUNK_SIZE = 4ul << 20 }; /*!< \brief Bytes read per call of the polling function. */
+
+ private:
+  std::vector<std::string> files; /*!< \brief Files to read, without repetitions. */
+  unsigned long iFile = 0;        /*!< \brief File being read. */
+  std::ifstream stream;           /*!< \brief Stream of the current file. */
+  std::vector<char> buffer;       /*!< \brief Scratch space for the chunks. */
+  unsigned long bytesRead = 0;    /*!< \brief Total bytes read so far. */
+  CCommProgressThread worker;     /*!< \brief The reading thread. */
+
+  /*!
+   * \brief Read the next chunk.
+   * \return True when all the files have been read.
+   */
+  bool ReadChunk();
+
+ public:
+  /*!
+   * \brief Add a file to the list (before Start), names that are empty or already in the list are ignored.
+   */
+  void Add(const std::string& fileName);
+
+  /*!
+   * \brief Start reading in the background.
+   * \note Collective, must be called by all ranks, outside parallel regions.
+   */
+  void Start();
+
+  /*!
+   * \brief Stop reading (if it has not finished) and wait for the thread.
+   * \return Number of bytes that were read by this rank.
+   */
+  unsigned long Stop();
+};
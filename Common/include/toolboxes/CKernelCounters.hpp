@@ -0,0 +1,162 @@
+/*!
+ * \file CKernelCounters.hpp
+ * \brief Hardware counters (PAPI) or marker regions (LIKWID) around the main kernels.
+ *        The implementation is in <i>CKernelCounters.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Kernels measured by CKernelCounters (see the hardware-counters build option).
+ */
+enum class HW_KERNEL : unsigned short {
+  EDGE_LOOP,   /*!< \brief Vectorized edge loop of the flow solvers (CNumericsSIMD). */
+  SPMV,        /*!< \brief Sparse matrix-vector product. */
+  ILU,         /*!< \brief ILU preconditioner sweeps. */
+  GRADIENTS,   /*!< \brief Green-Gauss or least-squares gradients. */
+  PRIMITIVES,  /*!< \brief Primitive and secondary variables of the flow solvers. */
+  NUM_KERNELS  /*!< \brief Number of kernels (not a kernel). */
+};
+
+/*!
+ * \class CKernelCounters
+ * \brief Measures the main kernels with hardware counters, to find whether they are bound by memory bandwidth or
+ *        by compute on a given machine.
+ * \details With PAPI, each thread counts double precision operations and last level cache misses (the memory
+ * traffic is estimated as misses times the line size), the report gives GFLOP/s and GB/s per kernel and rank.
+ * With LIKWID, the kernels are marker regions and the rates are reported by likwid-perfctr (e.g. with the
+ * MEM_DP group and the -m flag), the report gives times and calls.
+ * \note All the threads that execute a kernel open and close its region, the kernels should not nest.
+ *       Without the build option the probes are empty.
+ */
+class CKernelCounters {
+ public:
+  enum : unsigned short { NKERNEL = static_cast<unsigned short>(HW_KERNEL::NUM_KERNELS) };
+  enum : unsigned short { NEVENT = 2 };       /*!< \brief Floating point operations and cache misses. */
+  enum : unsigned short { LINE_SIZE = 64 };   /*!< \brief Bytes transferred per cache miss. */
+
+  /*!
+   * \brief State of the counters when a region is opened.
+   */
+  struct Sample {
+    bool active = false;
+    passivedouble time = 0.0;
+    long long events[NEVENT] = {};
+  };
+
+ private:
+  /*!
+   * \brief Accumulated values of one thread, padded to avoid false sharing.
+   */
+  struct ThreadData {
+    bool ready = false;
+    int eventSet = -1;
+    int slot[NEVENT] = {-1, -1};  /*!< \brief Position of each event in the event set (-1 if not counted). */
+    passivedouble time[NKERNEL] = {};
+    unsigned long calls[NKERNEL] = {};
+    long long events[NKERNEL][NEVENT] = {};
+    char padding[64];
+  };
+
+  static bool initialized;                 /*!< \brief Whether the library was initialized. */
+  static int eventCodes[NEVENT];           /*!< \brief Events counted by PAPI (0 if not available). */
+  static std::vector<ThreadData> threads;  /*!< \brief Per thread data. */
+
+  /*!
+   * \brief Create the event set of the calling thread.
+   */
+  static void InitializeThread(ThreadData& data);
+
+  /*!
+   * \brief Read the events of the calling thread.
+   */
+  static void ReadEvents(const ThreadData& data, long long* events);
+
+ public:
+  /*!
+   * \brief Initialize the counter library, call once from a serial region.
+   */
+  static void Initialize();
+
+  /*!
+   * \brief Name of a kernel (also the name of the LIKWID region).
+   */
+  static const char* GetName(unsigned short kernel);
+
+  /*!
+   * \brief Open the region of a kernel for the calling thread.
+   */
+  static Sample Start(HW_KERNEL kernel);
+
+  /*!
+   * \brief Close the region of a kernel for the calling thread.
+   * \param[in] kernel - The kernel being closed.
+   * \param[in] start - As returned by Start.
+   */
+  static void Stop(HW_KERNEL kernel, const Sample& start);
+
+  /*!
+   * \brief Print the statistics of the rates over all ranks, and write the values of each rank to a CSV file.
+   * \note Must be called by all ranks, and by one thread.
+   * \param[in] fileName - Name of the CSV file.
+   */
+  static void Report(const std::string& fileName);
+};
+
+/*!
+ * \class CScopedKernelCounter
+ * \brief Measures the scope where the object is declared, see SU2_KERNEL_COUNTER.
+ */
+class CScopedKernelCounter {
+ private:
+  const HW_KERNEL kernel;
+  const CKernelCounters::Sample start;
+
+ public:
+  explicit CScopedKernelCounter(HW_KERNEL kernel_) : kernel(kernel_), start(CKernelCounters::Start(kernel_)) {}
+
+  ~CScopedKernelCounter() { CKernelCounters::Stop(kernel, start); }
+
+  CScopedKernelCounter(const CScopedKernelCounter&) = delete;
+  CScopedKernelCounter& operator=(const CScopedKernelCounter&) = delete;
+};
+
+/*!
+ * \brief Measure the enclosing scope as one of the HW_KERNEL's, e.g. SU2_KERNEL_COUNTER(SPMV);
+ */
+#if defined(HAVE_PAPI) || defined(HAVE_LIKWID)
+#define SU2_KERNEL_COUNTER_CAT2(a, b) a##b
+#define SU2_KERNEL_COUNTER_CAT(a, b) SU2_KERNEL_COUNTER_CAT2(a, b)
+#define SU2_KERNEL_COUNTER(KERNEL) \
+  const CScopedKernelCounter SU2_KERNEL_COUNTER_CAT(su2_kernel_counter_, __LINE__)(HW_KERNEL::KERNEL)
+#else
+#define SU2_KERNEL_COUNTER(KERNEL)
+#endif
@@ -0,0 +1,195 @@
+/*!
+ * \file CMemoryLedger.hpp
+ * \brief Per-subsystem accounting of the memory allocated with MemoryAllocation::aligned_alloc.
+ *        The reports are implemented in <i>CMemoryLedger.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/*!
+ * \brief Subsystems to which the allocations are charged (see SU2_MEMORY_SCOPE).
+ */
+enum class MEMORY_CATEGORY : unsigned char {
+  GEOMETRY,      /*!< \brief Primal and agglomerated grids. */
+  SOLVER,        /*!< \brief Solver and variable containers. */
+  SPARSE_MATRIX, /*!< \brief Values of the Jacobians and their preconditioners. */
+  LINEAR_SYSTEM, /*!< \brief Vectors of the linear systems (and other CSysVector). */
+  INTERFACE,     /*!< \brief Interpolation and transfer between zones. */
+  OTHER,         /*!< \brief Allocations outside any scope. */
+  NUM_CATEGORIES /*!< \brief Number of categories (not a category). */
+};
+
+/*!
+ * \class CMemoryLedger
+ * \brief Records the size of the live buffers of aligned_alloc (C2DContainer, CSysVector, CSysMatrix, etc.)
+ *        and charges them to the category of the innermost SU2_MEMORY_SCOPE of the allocating thread, such
+ *        that the current and high-water-mark bytes of each subsystem are known.
+ * \note Thread-safe. Buffers are charged to the category active when they were allocated, also when they
+ *       are released from another scope. Nothing is recorded until the ledger is enabled (WRT_PERFORMANCE,
+ *       or from the start with the build option enable-memory-ledger), until then the cost of Add/Remove is
+ *       the check of an atomic flag. Buffers allocated before that are not counted.
+ */
+class CMemoryLedger {
+ public:
+  enum : size_t { NCAT = static_cast<size_t>(MEMORY_CATEGORY::NUM_CATEGORIES) };
+
+ private:
+  static std::atomic<bool> enabled; /*!< \brief Whether the buffers are recorded. */
+
+  struct Ledger {
+    std::mutex mutex;
+    std::unordered_map<const void*, std::pair<size_t, MEMORY_CATEGORY>> live; /*!< \brief Live buffers. */
+    size_t current[NCAT + 1] = {}; /*!< \brief Bytes in use per category, the last entry is the total. */
+    size_t peak[NCAT + 1] = {};    /*!< \brief High-water-mark of current. */
+  };
+
+  /*--- Never destroyed, such that static containers can release their buffers. ---*/
+  static Ledger& Get() {
+    static auto* ledger = new Ledger;
+    return *ledger;
+  }
+
+  static MEMORY_CATEGORY& ThreadCategory() {
+    static thread_local MEMORY_CATEGORY category = MEMORY_CATEGORY::OTHER;
+    return category;
+  }
+
+ public:
+  /*!
+   * \brief Start recording the buffers.
+   */
+  static void Enable() { enabled.store(true, std::memory_order_relaxed); }
+
+  /*!
+   * \brief Whether the buffers are recorded.
+   */
+  static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Set the category of the allocations of the calling thread.
+   * \return The previous category.
+   */
+  static MEMORY_CATEGORY SetCategory(MEMORY_CATEGORY category) {
+    const auto previous = ThreadCategory();
+    ThreadCategory() = category;
+    return previous;
+  }
+
+  /*!
+   * \brief Record a new buffer.
+   */
+  static void Add(const void* ptr, size_t bytes) {
+    if (ptr == nullptr || !IsEnabled()) return;
+    const auto category = ThreadCategory();
+    const auto iCat = static_cast<size_t>(category);
+    auto& ledger = Get();
+    std::lock_guard<std::mutex> lock(ledger.mutex);
+    ledger.live[ptr] = std::make_pair(bytes, category);
+    for (auto i : {iCat, size_t(NCAT)}) {
+      ledger.current[i] += bytes;
+      if (ledger.current[i] > ledger.peak[i]) ledger.peak[i] = ledger.current[i];
+    }
+  }
+
+  /*!
+   * \brief Forget a buffer that is about to be released (buffers not recorded are ignored).
+   */
+  static void Remove(const void* ptr) {
+    if (ptr == nullptr || !IsEnabled()) return;
+    auto& ledger = Get();
+    std::lock_guard<std::mutex> lock(ledger.mutex);
+    auto it = ledger.live.find(ptr);
+    if (it == ledger.live.end()) return;
+    ledger.current[static_cast<size_t>(it->second.second)] -= it->second.first;
+    ledger.current[NCAT] -= it->second.first;
+    ledger.live.erase(it);
+  }
+
+  /*!
+   * \brief Get the current and peak bytes of each category of this rank, the last entry is the total.
+   */
+  static void GetUsage(size_t (&current)[NCAT + 1], size_t (&peak)[NCAT + 1]) {
+    auto& ledger = Get();
+    std::lock_guard<std::mutex> lock(ledger.mutex);
+    for (auto i = 0ul; i <= NCAT; ++i) {
+      current[i] = ledger.current[i];
+      peak[i] = ledger.peak[i];
+    }
+  }
+
+  /*!
+   * \brief Name of a category, as used in the reports.
+   */
+  static const char* Name(size_t iCat);
+
+  /*!
+   * \brief Current and peak memory (MB) of this rank by name, e.g. "SOLVER" and "SOLVER_PEAK", including
+   *        the total, the memory of the AD tape, and the resident memory of the process (for the Python wrapper).
+   */
+  static std::map<std::string, double> Summary();
+
+  /*!
+   * \brief Print the min/max over ranks of the memory of each category, and write the values of each
+   *        rank to a CSV file (one row per rank and call). Must be called by all ranks.
+   * \param[in] stage - Name of the stage of the run, e.g. "Preprocessing".
+   * \param[in] fileName - CSV file, overwritten on the first call and appended afterwards.
+   */
+  static void Report(const std::string& stage, const std::string& fileName);
+};
+
+/*!
+ * \class CMemoryScope
+ * \brief Charges the allocations of the calling thread in the scope where the object is declared to a
+ *        category, see SU2_MEMORY_SCOPE.
+ */
+class CMemoryScope {
+ private:
+  const MEMORY_CATEGORY previous;
+
+ public:
+  explicit CMemoryScope(MEMORY_CATEGORY category) : previous(CMemoryLedger::SetCategory(category)) {}
+
+  ~CMemoryScope() { CMemoryLedger::SetCategory(previous); }
+
+  CMemoryScope(const CMemoryScope&) = delete;
+  CMemoryScope& operator=(const CMemoryScope&) = delete;
+};
+
+/*!
+ * \brief Charge the allocations of the enclosing scope to one of the MEMORY_CATEGORY's, e.g. SU2_MEMORY_SCOPE(GEOMETRY);
+ */
+#define SU2_MEMORY_SCOPE_CAT2(a, b) a##b
+#define SU2_MEMORY_SCOPE_CAT(a, b) SU2_MEMORY_SCOPE_CAT2(a, b)
+#define SU2_MEMORY_SCOPE(CATEGORY) \
+  const CMemoryScope SU2_MEMORY_SCOPE_CAT(su2_memory_scope_, __LINE__)(MEMORY_CATEGORY::CATEGORY)
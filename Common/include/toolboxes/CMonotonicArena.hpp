@@ -0,0 +1,138 @@
+/*!
+ * \file CMonotonicArena.hpp
+ * \brief Arena for transient arrays that are released all at once.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "allocation_toolbox.hpp"
+
+/*!
+ * \class CMonotonicArena
+ * \brief Allocates the arrays of one phase of an algorithm (e.g. a stage of the mesh preprocessing),
+ *        which are then released all at once, either explicitly or when the arena is destroyed.
+ * \note Small arrays are packed into blocks, large arrays get a block of their own such that Release
+ *       returns all the memory to the system. The arrays are value-initialized (i.e. zero for numbers).
+ */
+class CMonotonicArena {
+ public:
+  enum : size_t { ALIGNMENT = 64 };           /*!< \brief Alignment of all the arrays. */
+  enum : size_t { DEFAULT_BLOCK = 1ul << 20 }; /*!< \brief Default size of the blocks for small arrays. */
+
+ private:
+  struct Block {
+    char* data;
+    size_t size, used;
+  };
+  struct Finalizer {
+    void* ptr;
+    size_t n;
+    void (*destroy)(void*, size_t);
+  };
+
+  const size_t blockSize;
+  std::vector<Block> smallBlocks;     /*!< \brief Blocks shared by small arrays, the last one is being filled. */
+  std::vector<char*> largeBlocks;     /*!< \brief Blocks of the large arrays. */
+  std::vector<Finalizer> finalizers;  /*!< \brief Destructors to call for arrays of non-trivial types. */
+  size_t allocatedBytes = 0;          /*!< \brief Bytes held by the arena. */
+
+  template <class T>
+  static void Destroy(void* ptr, size_t n) {
+    auto* values = static_cast<T*>(ptr);
+    for (size_t i = 0; i < n; ++i) values[i].~T();
+  }
+
+  char* Reserve(size_t bytes) {
+    using namespace MemoryAllocation;
+    bytes = round_up(ALIGNMENT, bytes);
+
+    if (bytes > blockSize / 4) {
+      auto* data = aligned_alloc<char>(ALIGNMENT, bytes);
+      if (data == nullptr) throw std::bad_alloc();
+      largeBlocks.push_back(data);
+      allocatedBytes += bytes;
+      return data;
+    }
+    if (smallBlocks.empty() || smallBlocks.back().used + bytes > smallBlocks.back().size) {
+      auto* data = aligned_alloc<char>(ALIGNMENT, blockSize);
+      if (data == nullptr) throw std::bad_alloc();
+      smallBlocks.push_back({data, blockSize, 0});
+      allocatedBytes += blockSize;
+    }
+    auto& block = smallBlocks.back();
+    auto* ptr = block.data + block.used;
+    block.used += bytes;
+    return ptr;
+  }
+
+ public:
+  /*!
+   * \brief Construct an empty arena.
+   * \param[in] blockSize_ - Size of the blocks for small arrays, arrays larger than 1/4 of it get their own block.
+   */
+  explicit CMonotonicArena(size_t blockSize_ = DEFAULT_BLOCK) : blockSize(blockSize_) {}
+
+  ~CMonotonicArena() { Release(); }
+
+  CMonotonicArena(const CMonotonicArena&) = delete;
+  CMonotonicArena& operator=(const CMonotonicArena&) = delete;
+
+  /*!
+   * \brief Allocate a value-initialized array, which lives until the arena is released.
+   * \param[in] n - Number of items.
+   * \return Pointer to the array, nullptr if n is 0.
+   */
+  template <class T>
+  T* Allocate(size_t n) {
+    static_assert(alignof(T) <= ALIGNMENT, "Over-aligned type.");
+    if (n == 0) return nullptr;
+    auto* ptr = reinterpret_cast<T*>(Reserve(n * sizeof(T)));
+    for (size_t i = 0; i < n; ++i) new (ptr + i) T();
+    if (!std::is_trivially_destructible<T>::value) finalizers.push_back({ptr, n, &Destroy<T>});
+    return ptr;
+  }
+
+  /*!
+   * \brief Destroy all the arrays and return their memory to the system.
+   */
+  void Release() {
+    for (auto it = finalizers.rbegin(); it != finalizers.rend(); ++it) it->destroy(it->ptr, it->n);
+    finalizers.clear();
+    for (auto& block : smallBlocks) MemoryAllocation::aligned_free(block.data);
+    for (auto* data : largeBlocks) MemoryAllocation::aligned_free(data);
+    std::vector<Block>().swap(smallBlocks);
+    std::vector<char*>().swap(largeBlocks);
+    allocatedBytes = 0;
+  }
+
+  /*!
+   * \brief Number of bytes held by the arena.
+   */
+  size_t GetAllocatedBytes() const { return allocatedBytes; }
+};
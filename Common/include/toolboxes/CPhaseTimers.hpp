@@ -0,0 +1,161 @@
+/*!
+ * \file CPhaseTimers.hpp
+ * \brief Low overhead scoped timers for the main phases of the solution process.
+ *        The implementation is in <i>CPhaseTimers.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Phases of the solution process measured by CPhaseTimers (see WRT_PHASE_TIMERS).
+ */
+enum class TIMER_PHASE : unsigned short {
+  ITERATION,           /*!< \brief Iterate of the CIteration classes. */
+  INTEGRATION,         /*!< \brief Time integration of a solver (CIntegration). */
+  PREPROCESSING,       /*!< \brief CSolver::Preprocessing. */
+  CONVECTIVE_RESIDUAL, /*!< \brief Centered or upwind residual. */
+  VISCOUS_RESIDUAL,    /*!< \brief Viscous residual. */
+  SOURCE_RESIDUAL,     /*!< \brief Source residual. */
+  GRADIENTS,           /*!< \brief Green-Gauss or least-squares gradients. */
+  LIMITERS,            /*!< \brief Slope limiters. */
+  LINEAR_SOLVER,       /*!< \brief CSysSolve::Solve. */
+  HALO_COMMS,          /*!< \brief Point-to-point (halo) communications. */
+  OUTPUT,              /*!< \brief Screen, history, and file output. */
+  NUM_PHASES           /*!< \brief Number of phases (not a phase). */
+};
+
+/*!
+ * \class CPhaseTimers
+ * \brief Registry of inclusive wall-clock times per phase, and per parent phase, i.e. the timers nest.
+ * \note Only the master thread of each rank records times, which makes the timers thread safe and cheap.
+ *       When disabled (the default) the only cost of a scoped timer is checking a flag.
+ */
+class CPhaseTimers {
+ public:
+  enum : unsigned short { NPHASE = static_cast<unsigned short>(TIMER_PHASE::NUM_PHASES) };
+  enum : unsigned short { ROOT = NPHASE };          /*!< \brief Parent of the outermost phases. */
+  enum : unsigned short { MAX_DEPTH = 32 };         /*!< \brief Deeper nesting levels are not recorded. */
+  enum : unsigned long { MAX_EVENTS = 1ul << 20 };  /*!< \brief Maximum number of events in the trace. */
+
+ private:
+  /*!
+   * \brief A timed scope, for the trace.
+   */
+  struct Event {
+    passivedouble start, duration;
+    unsigned short phase, depth;
+  };
+
+  static bool enabled;                               /*!< \brief Whether timers are recorded. */
+  static bool tracing;                               /*!< \brief Whether events are recorded for the trace. */
+  static passivedouble origin;                       /*!< \brief Time at which the timers were enabled. */
+  static unsigned short depth;                       /*!< \brief Current nesting level. */
+  static unsigned short stack[MAX_DEPTH];            /*!< \brief Phases currently active. */
+  static passivedouble totalTime[NPHASE + 1][NPHASE]; /*!< \brief Inclusive time of [parent][phase]. */
+  static unsigned long numCalls[NPHASE + 1][NPHASE];  /*!< \brief Number of calls of [parent][phase]. */
+  static std::vector<Event> events;                  /*!< \brief Events of the trace (of this rank). */
+
+ public:
+  /*!
+   * \brief Enable the timers, and optionally the recording of events for the trace.
+   */
+  static void Enable(bool trace);
+
+  /*!
+   * \brief Whether the timers are enabled.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Name of a phase.
+   */
+  static const char* GetName(unsigned short phase);
+
+  /*!
+   * \brief Open a timed phase.
+   * \return The start time.
+   */
+  static passivedouble Start(TIMER_PHASE phase);
+
+  /*!
+   * \brief Close the innermost timed phase.
+   * \param[in] phase - The phase being closed (must match the innermost).
+   * \param[in] startTime - As returned by Start.
+   */
+  static void Stop(TIMER_PHASE phase, passivedouble startTime);
+
+  /*!
+   * \brief Inclusive time of a phase on this rank, summed over all its parents.
+   */
+  static passivedouble GetTotalTime(TIMER_PHASE phase);
+
+  /*!
+   * \brief Reduce the times over all ranks (min/avg/max), print the hierarchy to screen, and write a JSON
+   *        file in Chrome trace format (chrome://tracing, Perfetto) with the events of the master rank
+   *        and the reduced summary.
+   * \note Must be called by all ranks, and by one thread.
+   * \param[in] fileName - Name of the JSON file, if empty only the screen output is produced.
+   */
+  static void Report(const std::string& fileName);
+};
+
+/*!
+ * \class CScopedPhaseTimer
+ * \brief Times the scope where the object is declared, see SU2_PHASE_TIMER.
+ */
+class CScopedPhaseTimer {
+ private:
+  const TIMER_PHASE phase;
+  const bool active;
+  passivedouble startTime = 0.0;
+
+ public:
+  explicit CScopedPhaseTimer(TIMER_PHASE phase_)
+      : phase(phase_), active(CPhaseTimers::IsEnabled() && omp_get_thread_num() == 0) {
+    if (active) startTime = CPhaseTimers::Start(phase);
+  }
+
+  ~CScopedPhaseTimer() {
+    if (active) CPhaseTimers::Stop(phase, startTime);
+  }
+
+  CScopedPhaseTimer(const CScopedPhaseTimer&) = delete;
+  CScopedPhaseTimer& operator=(const CScopedPhaseTimer&) = delete;
+};
+
+/*!
+ * \brief Time the enclosing scope as one of the TIMER_PHASE's, e.g. SU2_PHASE_TIMER(GRADIENTS);
+ */
+#define SU2_PHASE_TIMER_CAT2(a, b) a##b
+#define SU2_PHASE_TIMER_CAT(a, b) SU2_PHASE_TIMER_CAT2(a, b)
+#define SU2_PHASE_TIMER(PHASE) \
+  const CScopedPhaseTimer SU2_PHASE_TIMER_CAT(su2_phase_timer_, __LINE__)(TIMER_PHASE::PHASE)
@@ -44,6 +44,9 @@
  * Usage: Allocate, store the initial solution (operator (i,j), default is 0),
  * run the FP, store its result ("FPresult"), compute new solution, use it
  * as the new input of the FP, run the FP, etc.
+ * The products with the history are threaded, the small LS problem can be
+ * filtered to discard samples that are (almost) linearly dependent on newer
+ * ones (equivalent to the QR filter of IQN-ILS), see "setFilterTolerance".
  * \ingroup BLAS
  */
 template <class Scalar_t, bool WithMPI = true>
@@ -62,6 +65,7 @@ class CQuasiNewtonInvLeastSquares {
   su2vector<Scalar> mat, rhs, sol;      /*!< \brief Matrix, rhs, and solution of the normal equations. */
   Index iSample = 0;                    /*!< \brief Current sample index. */
   Index nPtDomain = 0;                  /*!< \brief Local size of the history, considered in dot products. */
+  Scalar filterTol = 0;                 /*!< \brief Relative tolerance to filter samples, 0 disables filtering. */
 
   void shiftHistoryLeft() {
     for (Index i = 1; i < X.size(); ++i) {
@@ -79,17 +83,32 @@ class CQuasiNewtonInvLeastSquares {
     mat = Scalar(0);
     rhs = Scalar(0);
 
-    /*--- Tiled part of the loop. ---*/
-    Index begin = 0;
-    while (end - begin >= BLOCK_SIZE) {
-      computeNormalEquations<BLOCK_SIZE>(mat, rhs, begin);
-      begin += BLOCK_SIZE;
-    }
+    /*--- Each thread accumulates the tiles it is assigned, the last "tile" is the remainder of the loop. ---*/
+    const Index nTiles = end / BLOCK_SIZE;
+
+    SU2_OMP_PARALLEL {
+      su2vector<Scalar> matLocal(mat.size()), rhsLocal(rhs.size());
+      matLocal = Scalar(0);
+      rhsLocal = Scalar(0);
 
-    /*--- Remainder of the loop. ---*/
-    if (begin != end) {
-      computeNormalEquations<0>(mat, rhs, begin, end - begin);
+      SU2_OMP_FOR_STAT(1)
+      for (Index iTile = 0; iTile <= nTiles; ++iTile) {
+        const Index begin = iTile * BLOCK_SIZE;
+        if (iTile < nTiles) {
+          computeNormalEquations<BLOCK_SIZE>(matLocal, rhsLocal, begin);
+        } else if (begin != end) {
+          computeNormalEquations<0>(matLocal, rhsLocal, begin, end - begin);
+        }
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_CRITICAL {
+        for (Index i = 0; i < mat.size(); ++i) mat(i) += matLocal(i);
+        for (Index i = 0; i < rhs.size(); ++i) rhs(i) += rhsLocal(i);
+      }
+      END_SU2_OMP_CRITICAL
     }
+    END_SU2_OMP_PARALLEL
 
     /*--- MPI reduction of the dot products. ---*/
     if (WithMPI) {
@@ -139,6 +158,59 @@ class CQuasiNewtonInvLeastSquares {
     }
   }
 
+  /*!
+   * \brief Solve the normal equations by Cholesky decomposition, discarding samples whose
+   * component orthogonal to the (newer) samples already factorized is smaller than filterTol
+   * times their norm, i.e. a small diagonal entry of the R factor of the QR decomposition.
+   */
+  void solveFilteredNormalEquations() {
+    /*--- Dense copy of the matrix, the newest sample is factorized first. ---*/
+    su2matrix<Scalar> L(iSample, iSample);
+    for (Index i = 0; i < iSample; ++i)
+      for (Index j = 0; j <= i; ++j)
+        L(iSample - 1 - i, iSample - 1 - j) = L(iSample - 1 - j, iSample - 1 - i) = mat(i * (i + 1) / 2 + j);
+
+    std::vector<bool> keep(iSample, true);
+
+    for (Index j = 0; j < iSample; ++j) {
+      Scalar diag = L(j, j);
+      for (Index k = 0; k < j; ++k)
+        if (keep[k]) diag -= pow(L(j, k), 2);
+
+      if (diag <= pow(filterTol, 2) * L(j, j)) {
+        keep[j] = false;
+        continue;
+      }
+      diag = sqrt(diag);
+      L(j, j) = diag;
+
+      for (Index i = j + 1; i < iSample; ++i) {
+        Scalar sum = L(i, j);
+        for (Index k = 0; k < j; ++k)
+          if (keep[k]) sum -= L(i, k) * L(j, k);
+        L(i, j) = sum / diag;
+      }
+    }
+
+    /*--- Forward and backward substitution over the samples that are kept. ---*/
+    std::vector<Scalar> y(iSample, Scalar(0));
+    for (Index i = 0; i < iSample; ++i) {
+      if (!keep[i]) continue;
+      Scalar sum = rhs(iSample - 1 - i);
+      for (Index k = 0; k < i; ++k)
+        if (keep[k]) sum -= L(i, k) * y[k];
+      y[i] = sum / L(i, i);
+    }
+    for (Index i = iSample; i-- > 0;) {
+      if (!keep[i]) continue;
+      Scalar sum = y[i];
+      for (Index k = i + 1; k < iSample; ++k)
+        if (keep[k]) sum -= L(k, i) * y[k];
+      y[i] = sum / L(i, i);
+    }
+    for (Index i = 0; i < iSample; ++i) sol(iSample - 1 - i) = y[i];
+  }
+
  public:
   /*! \brief Default construction without allocation. */
   CQuasiNewtonInvLeastSquares() = default;
@@ -176,6 +248,12 @@ class CQuasiNewtonInvLeastSquares {
   /*! \brief Size of the object, the number of samples. */
   Index size() const { return X.size(); }
 
+  /*!
+   * \brief Set the tolerance used to discard samples that are almost linearly dependent on newer ones.
+   * \param[in] tol - Relative tolerance (e.g. 1e-3), 0 (default) keeps all samples.
+   */
+  void setFilterTolerance(Scalar tol) { filterTol = tol; }
+
   /*! \brief Discard all history, keeping the current solution. */
   void reset() {
     std::swap(X[0], X[iSample]);
@@ -205,34 +283,38 @@ class CQuasiNewtonInvLeastSquares {
    * \note To be used after storing the FP result.
    */
   const su2matrix<Scalar>& compute() {
+    const Index nWork = work.size();
+
     /*--- Compute FP residual, clear correction. ---*/
-    SU2_OMP_SIMD
-    for (Index i = 0; i < work.size(); ++i) {
+    SU2_OMP_PARALLEL_(for schedule(static, BLOCK_SIZE))
+    for (Index i = 0; i < nWork; ++i) {
       R[iSample].data()[i] = work.data()[i] - X[iSample].data()[i];
       work.data()[i] = Scalar(0);
     }
+    END_SU2_OMP_PARALLEL
 
     if (iSample > 0) {
       /*--- Solve the normal equations. ---*/
       computeNormalEquations();
-      CSymmetricMatrix pseudoInv(iSample);
-      for (Index i = 0, k = 0; i < iSample; ++i)
-        for (Index j = 0; j <= i; ++j) pseudoInv(i, j) = mat(k++);
-      pseudoInv.Invert(true);
-      pseudoInv.MatVecMult(rhs.data(), sol.data());
+      if (filterTol > 0) {
+        solveFilteredNormalEquations();
+      } else {
+        CSymmetricMatrix pseudoInv(iSample);
+        for (Index i = 0, k = 0; i < iSample; ++i)
+          for (Index j = 0; j <= i; ++j) pseudoInv(i, j) = mat(k++);
+        pseudoInv.Invert(true);
+        pseudoInv.MatVecMult(rhs.data(), sol.data());
+      }
 
       /*--- Compute correction, cleared before for less trunc. error. ---*/
-      for (Index k = 0; k < iSample; ++k) {
-        const auto x1 = X[k + 1].data();
-        const auto r1 = R[k + 1].data();
-        const auto x0 = X[k].data();
-        const auto r0 = R[k].data();
-        SU2_OMP_SIMD
-        for (Index i = 0; i < work.size(); ++i) {
-          Scalar dy = r1[i] - r0[i] + x1[i] - x0[i];
+      SU2_OMP_PARALLEL_(for schedule(static, BLOCK_SIZE))
+      for (Index i = 0; i < nWork; ++i) {
+        for (Index k = 0; k < iSample; ++k) {
+          Scalar dy = R[k + 1].data()[i] - R[k].data()[i] + X[k + 1].data()[i] - X[k].data()[i];
           work.data()[i] += sol(k) * dy;
         }
       }
+      END_SU2_OMP_PARALLEL
     }
 
     /*--- Check for need to shift left. ---*/
@@ -242,8 +324,9 @@ class CQuasiNewtonInvLeastSquares {
     }
 
     /*--- Set new solution. ---*/
-    SU2_OMP_SIMD
-    for (Index i = 0; i < work.size(); ++i) work.data()[i] += R[iSample].data()[i] + X[iSample].data()[i];
+    SU2_OMP_PARALLEL_(for schedule(static, BLOCK_SIZE))
+    for (Index i = 0; i < nWork; ++i) work.data()[i] += R[iSample].data()[i] + X[iSample].data()[i];
+    END_SU2_OMP_PARALLEL
     std::swap(X[++iSample], work);
 
     return solution();
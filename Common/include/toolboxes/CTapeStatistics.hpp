@@ -0,0 +1,128 @@
+/*!
+ * \file CTapeStatistics.hpp
+ * \brief Memory recorded on the AD tape by the main kernels of the primal iteration.
+ *        The implementation is in <i>CTapeStatistics.cpp</i>.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+/*!
+ * \brief Kernels of the primal iteration measured by CTapeStatistics (see WRT_AD_STATISTICS).
+ */
+enum class TAPE_KERNEL : unsigned short {
+  PRIMITIVES,           /*!< \brief Primitive and secondary variables (fluid model). */
+  CONVECTIVE_RESIDUAL,  /*!< \brief Centered or upwind residual. */
+  VISCOUS_RESIDUAL,     /*!< \brief Viscous residual. */
+  SOURCE_RESIDUAL,      /*!< \brief Source residual of the mean flow and other solvers. */
+  TURB_SOURCE_RESIDUAL, /*!< \brief Source residual of the turbulence model. */
+  GRADIENTS,            /*!< \brief Green-Gauss or least-squares gradients. */
+  LIMITERS,             /*!< \brief Slope limiters. */
+  NUM_KERNELS           /*!< \brief Number of kernels (not a kernel). */
+};
+
+/*!
+ * \class CTapeStatistics
+ * \brief Accumulates the tape memory recorded inside each kernel, to find which parts of the
+ *        recording are worth preaccumulating. The kernels should not nest.
+ * \note Only the master thread is measured, with OpenMP the other threads record on their own tapes.
+ *       Without reverse AD, or when disabled (the default), the probes only check a flag.
+ */
+class CTapeStatistics {
+ public:
+  enum : unsigned short { NKERNEL = static_cast<unsigned short>(TAPE_KERNEL::NUM_KERNELS) };
+
+ private:
+  static bool enabled;                    /*!< \brief Whether the tape memory is measured. */
+  static passivedouble memory[NKERNEL];   /*!< \brief Tape memory (MB) recorded by each kernel. */
+  static unsigned long numCalls[NKERNEL]; /*!< \brief Number of calls of each kernel. */
+
+ public:
+  /*!
+   * \brief Enable the measurements and clear previous values (call before each recording).
+   */
+  static void Enable();
+
+  /*!
+   * \brief Whether the statistics are enabled.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Memory currently used by the tape of the calling thread, in MB.
+   */
+  static passivedouble UsedMemory();
+
+  /*!
+   * \brief Add the memory recorded by one call of a kernel.
+   */
+  static inline void Add(TAPE_KERNEL kernel, passivedouble mem) {
+    const auto iKernel = static_cast<unsigned short>(kernel);
+    memory[iKernel] += mem;
+    numCalls[iKernel] += 1;
+  }
+
+  /*!
+   * \brief Sum the memory over all ranks and print the table to screen, the total is the memory
+   *        currently used by the tape, the difference is reported as "Other".
+   * \note Must be called by all ranks, and by one thread.
+   */
+  static void Report();
+};
+
+/*!
+ * \class CScopedTapeProbe
+ * \brief Measures the tape memory recorded in the scope where the object is declared, see SU2_TAPE_PROBE.
+ */
+class CScopedTapeProbe {
+ private:
+  const TAPE_KERNEL kernel;
+  const bool active;
+  passivedouble startMemory = 0.0;
+
+ public:
+  explicit CScopedTapeProbe(TAPE_KERNEL kernel_)
+      : kernel(kernel_), active(CTapeStatistics::IsEnabled() && omp_get_thread_num() == 0) {
+    if (active) startMemory = CTapeStatistics::UsedMemory();
+  }
+
+  ~CScopedTapeProbe() {
+    if (active) CTapeStatistics::Add(kernel, CTapeStatistics::UsedMemory() - startMemory);
+  }
+
+  CScopedTapeProbe(const CScopedTapeProbe&) = delete;
+  CScopedTapeProbe& operator=(const CScopedTapeProbe&) = delete;
+};
+
+/*!
+ * \brief Measure the tape memory of the enclosing scope as one of the TAPE_KERNEL's, e.g. SU2_TAPE_PROBE(GRADIENTS);
+ */
+#define SU2_TAPE_PROBE_CAT2(a, b) a##b
+#define SU2_TAPE_PROBE_CAT(a, b) SU2_TAPE_PROBE_CAT2(a, b)
+#define SU2_TAPE_PROBE(KERNEL) \
+  const CScopedTapeProbe SU2_TAPE_PROBE_CAT(su2_tape_probe_, __LINE__)(TAPE_KERNEL::KERNEL)
@@ -34,11 +34,23 @@
 #include <malloc.h>
 #else
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
 #endif
 
+#include <cstdio>
 #include <cstring>
 
+#include <atomic>
 #include <cassert>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "CMemoryLedger.hpp"
 
 namespace MemoryAllocation {
 
@@ -46,8 +58,175 @@ inline constexpr bool is_power_of_two(size_t x) { return x && !(x & (x - 1)); }
 
 inline constexpr size_t round_up(size_t multiple, size_t x) { return ((x + multiple - 1) / multiple) * multiple; }
 
+/*!
+ * \brief Aligned allocation from the system (size must be a multiple of alignment), nullptr if it fails.
+ */
+inline void* system_aligned_alloc(size_t alignment, size_t size) noexcept {
+  void* ptr = nullptr;
+#if defined(__APPLE__)
+  if (::posix_memalign(&ptr, alignment, size) != 0) {
+    ptr = nullptr;
+  }
+#elif defined(_WIN32)
+  ptr = _aligned_malloc(size, alignment);
+#else
+  ptr = ::aligned_alloc(alignment, size);
+#endif
+  return ptr;
+}
+
+/*!
+ * \brief Free memory allocated with system_aligned_alloc.
+ */
+inline void system_aligned_free(void* ptr) noexcept {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+/*!
+ * \class CLargeBufferPool
+ * \brief Optional handling of the large buffers of aligned_alloc (e.g. solver variables, sparse matrices, and
+ *        vectors). With pooling, released buffers are kept and given to later requests of a similar size, which
+ *        avoids returning memory to the system and faulting it in again when containers are reallocated often
+ *        (dynamic meshes, multizone). With huge pages the buffers are aligned to 2 MB and the OS is advised to
+ *        back them with transparent huge pages, which reduces the TLB misses of the indirect accesses of the
+ *        sparse products and edge loops (Linux only).
+ * \note Thread-safe. The mode must be set before the buffers are allocated (see CDriver), buffers allocated
+ *       before are simply freed.
+ */
+class CLargeBufferPool {
+ public:
+  enum : size_t { HUGE_PAGE = 2ul << 20 };   /*!< \brief Alignment and size granularity of the buffers. */
+  enum : size_t { MIN_BYTES = 4ul << 20 };   /*!< \brief Smaller buffers are not handled by the pool. */
+  enum : size_t { MIN_CACHE = 256ul << 20 }; /*!< \brief Bytes that can always be cached, see Release. */
+
+ private:
+  std::mutex mutex;
+  bool pooling = false, hugePages = false;
+  std::atomic<size_t> numLive{0};             /*!< \brief Number of buffers in use. */
+  std::unordered_map<void*, size_t> live;     /*!< \brief Size of the buffers in use. */
+  std::multimap<size_t, void*> cached;        /*!< \brief Released buffers by size. */
+  size_t liveBytes = 0, cachedBytes = 0;
+  unsigned long numAlloc = 0, numReused = 0;
+
+ public:
+  /*!
+   * \brief Set the mode of the pool, disabling pooling releases the cached buffers.
+   * \param[in] pooling_ - Keep the released buffers for reuse.
+   * \param[in] hugePages_ - Advise the OS to use transparent huge pages.
+   */
+  void Configure(bool pooling_, bool hugePages_) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pooling = pooling_;
+      hugePages = hugePages_;
+    }
+    if (!pooling_) Trim();
+  }
+
+  /*!
+   * \brief Whether the pool handles large buffers.
+   */
+  bool Enabled() const { return pooling || hugePages; }
+
+  /*!
+   * \brief Allocate a buffer aligned to HUGE_PAGE, from the cached ones if possible.
+   * \param[in] size - Bytes requested.
+   * \return Pointer to the buffer, nullptr if the pool is disabled or the size is small.
+   */
+  void* Allocate(size_t size) {
+    if (!Enabled() || size < MIN_BYTES) return nullptr;
+    const size_t bytes = round_up(HUGE_PAGE, size);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++numAlloc;
+    void* ptr = nullptr;
+    size_t ptrBytes = bytes;
+
+    /*--- The smallest cached buffer that is large enough, if it does not waste more than 25%. ---*/
+    auto it = cached.lower_bound(bytes);
+    if (it != cached.end() && it->first <= bytes + bytes / 4) {
+      ptr = it->second;
+      ptrBytes = it->first;
+      cachedBytes -= ptrBytes;
+      cached.erase(it);
+      ++numReused;
+    } else {
+      ptr = system_aligned_alloc(HUGE_PAGE, bytes);
+      if (ptr == nullptr) return nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      if (hugePages) madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+    }
+    live[ptr] = ptrBytes;
+    liveBytes += ptrBytes;
+    ++numLive;
+    return ptr;
+  }
+
+  /*!
+   * \brief Release a buffer, it is cached if pooling is enabled and the cached bytes do not exceed the
+   *        bytes in use (or MIN_CACHE), otherwise it is freed.
+   * \return False if the buffer was not allocated by the pool.
+   */
+  bool Release(void* ptr) {
+    if (numLive == 0 || ptr == nullptr) return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = live.find(ptr);
+    if (it == live.end()) return false;
+    const size_t bytes = it->second;
+    live.erase(it);
+    liveBytes -= bytes;
+    --numLive;
+
+    if (pooling && cachedBytes + bytes <= (liveBytes > MIN_CACHE ? liveBytes : size_t(MIN_CACHE))) {
+      cached.emplace(bytes, ptr);
+      cachedBytes += bytes;
+    } else {
+      system_aligned_free(ptr);
+    }
+    return true;
+  }
+
+  /*!
+   * \brief Free the cached buffers.
+   */
+  void Trim() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& buffer : cached) system_aligned_free(buffer.second);
+    cached.clear();
+    cachedBytes = 0;
+  }
+
+  /*!
+   * \brief Get the statistics of the pool.
+   * \param[out] allocations - Number of buffers allocated by the pool.
+   * \param[out] reused - How many of those were cached buffers.
+   * \param[out] cachedMB - Size of the buffers currently cached.
+   */
+  void GetStatistics(unsigned long& allocations, unsigned long& reused, double& cachedMB) {
+    std::lock_guard<std::mutex> lock(mutex);
+    allocations = numAlloc;
+    reused = numReused;
+    cachedMB = cachedBytes / double(1ul << 20);
+  }
+};
+
+/*!
+ * \brief The pool used by aligned_alloc (never destroyed, such that static containers can release their buffers).
+ */
+inline CLargeBufferPool& LargeBufferPool() {
+  static auto* pool = new CLargeBufferPool;
+  return *pool;
+}
+
 /*!
  * \brief Aligned memory allocation compatible across platforms.
+ * \note Large buffers may come from the LargeBufferPool, all buffers are recorded in the CMemoryLedger.
  * \param[in] alignment, in bytes, of the memory being allocated.
  * \param[in] size, also in bytes.
  * \tparam ZeroInit, initialize memory to 0.
@@ -62,16 +241,11 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept {
   size = round_up(alignment, size);
 
   void* ptr = nullptr;
+  if (alignment <= CLargeBufferPool::HUGE_PAGE) ptr = LargeBufferPool().Allocate(size);
+  if (ptr == nullptr) ptr = system_aligned_alloc(alignment, size);
+
+  CMemoryLedger::Add(ptr, size);
 
-#if defined(__APPLE__)
-  if (::posix_memalign(&ptr, alignment, size) != 0) {
-    ptr = nullptr;
-  }
-#elif defined(_WIN32)
-  ptr = _aligned_malloc(size, alignment);
-#else
-  ptr = ::aligned_alloc(alignment, size);
-#endif
   if (ZeroInit) memset(ptr, 0, size);
   return static_cast<T*>(ptr);
 }
@@ -82,10 +256,42 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept {
  */
 template <class T>
 inline void aligned_free(T* ptr) noexcept {
+  CMemoryLedger::Remove(ptr);
+  if (LargeBufferPool().Release(const_cast<void*>(static_cast<const void*>(ptr)))) return;
+  system_aligned_free(const_cast<void*>(static_cast<const void*>(ptr)));
+}
+
+/*!
+ * \brief Resident memory of the process, in bytes (0 if not available on the platform).
+ */
+inline size_t ResidentMemory() noexcept {
+  size_t pages = 0;
+#if defined(__linux__)
+  if (FILE* file = fopen("/proc/self/statm", "r")) {
+    unsigned long size = 0, resident = 0;
+    if (fscanf(file, "%lu %lu", &size, &resident) == 2) pages = resident;
+    fclose(file);
+  }
+  return pages * sysconf(_SC_PAGESIZE);
+#else
+  return pages;
+#endif
+}
+
+/*!
+ * \brief Peak resident memory of the process so far, in bytes (0 if not available on the platform).
+ */
+inline size_t PeakResidentMemory() noexcept {
 #if defined(_WIN32)
-  _aligned_free(ptr);
+  return 0;
 #else
-  free(ptr);
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss;
+#else
+  return usage.ru_maxrss * size_t(1024);
+#endif
 #endif
 }
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 namespace GeometryToolbox {
 /// \addtogroup GeometryToolbox
@@ -216,5 +217,47 @@ inline void TangentProjection(Int nDim, const Mat& tensor, const Scalar* vector,
 
   for (Int iDim = 0; iDim < nDim; iDim++) proj[iDim] -= normalProj * vector[iDim];
 }
+/*!
+ * \brief Index of a point along the Hilbert space-filling curve (J. Skilling, "Programming the Hilbert curve",
+ *        AIP Conf. Proc. 707, 2004).
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] coords - Integer coordinates of the point, in [0, 2^bits), modified.
+ * \param[in] bits - Number of bits of each coordinate, nDim * bits <= 64.
+ * \return Index of the point, consecutive indices are adjacent points of the 2^bits lattice.
+ */
+template <typename Int>
+inline uint64_t HilbertIndex(Int nDim, uint32_t* coords, unsigned bits) {
+  const uint32_t M = uint32_t(1) << (bits - 1);
+
+  /*--- Inverse undo. ---*/
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (Int i = 0; i < nDim; i++) {
+      if (coords[i] & Q) {
+        coords[0] ^= P;
+      } else {
+        const uint32_t t = (coords[0] ^ coords[i]) & P;
+        coords[0] ^= t;
+        coords[i] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (Int i = 1; i < nDim; i++) coords[i] ^= coords[i - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (coords[nDim - 1] & Q) t ^= Q - 1;
+  }
+  for (Int i = 0; i < nDim; i++) coords[i] ^= t;
+
+  /*--- Interleave the bits of the transposed index. ---*/
+  uint64_t index = 0;
+  for (int b = bits - 1; b >= 0; b--) {
+    for (Int i = 0; i < nDim; i++) index = (index << 1) | ((coords[i] >> b) & 1);
+  }
+  return index;
+}
+
 /// @}
 }  // namespace GeometryToolbox
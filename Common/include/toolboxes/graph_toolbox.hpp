@@ -29,6 +29,7 @@
 
 #include "../containers/C2DContainer.hpp"
 #include "../parallelization/omp_structure.hpp"
+#include "../parallelization/mpi_structure.hpp"
 
 #include <set>
 #include <vector>
@@ -36,6 +37,7 @@
 #include <cassert>
 #include <algorithm>
 #include <numeric>
+#include <utility>
 
 /// \addtogroup Graph
 /// @{
@@ -106,9 +108,9 @@ class CCompressedSparsePattern {
    * \param[in] innerIdx - Inner indices.
    */
   CCompressedSparsePattern(su2vector<Index_t>&& outerPtr, su2vector<Index_t>&& innerIdx)
-      : m_outerPtr(outerPtr), m_innerIdx(innerIdx) {
+      : m_outerPtr(std::move(outerPtr)), m_innerIdx(std::move(innerIdx)) {
     /*--- perform a basic sanity check ---*/
-    assert(m_innerIdx.size() == m_outerPtr(m_outerPtr.size() - 1));
+    assert(m_innerIdx.size() == static_cast<size_t>(m_outerPtr(m_outerPtr.size() - 1)));
   }
 
   /*!
@@ -337,6 +339,22 @@ using CCompressedSparsePatternUL = CCompressedSparsePattern<unsigned long>;
 using CCompressedSparsePatternL = CCompressedSparsePattern<long>;
 using CEdgeToNonZeroMapUL = CEdgeToNonZeroMap<unsigned long>;
 
+/*--- Patterns of local (per rank) indices, e.g. adjacency of the points and sparse matrices. ---*/
+using CCompressedSparsePatternLocal = CCompressedSparsePattern<su2localindex>;
+using CEdgeToNonZeroMapLocal = CEdgeToNonZeroMap<su2localindex>;
+
+/*!
+ * \brief Check that a number of entries can be represented by the index type of a pattern.
+ * \param[in] size - Number of entries (points, non zeros, etc.).
+ */
+template <typename Index_t>
+void checkPatternIndexRange(size_t size) {
+  if (size > std::numeric_limits<Index_t>::max()) {
+    SU2_MPI::Error("Too many entries for the local indices of the sparse patterns, partition the mesh in more ranks\n"
+                   "or compile with -Denable-64bit-local-indices=true.", CURRENT_FUNCTION);
+  }
+}
+
 /*!
  * \brief Build a sparse pattern from geometry information, of type FVM or FEM,
  *        for a given fill-level. At fill-level N, the immediate neighbors of the
@@ -352,6 +370,7 @@ using CEdgeToNonZeroMapUL = CEdgeToNonZeroMap<unsigned long>;
  */
 template <class Geometry_t, typename Index_t>
 CCompressedSparsePattern<Index_t> buildCSRPattern(Geometry_t& geometry, ConnectivityType type, Index_t fillLvl) {
+  checkPatternIndexRange<Index_t>(geometry.GetnPoint());
   Index_t nPoint = geometry.GetnPoint();
 
   std::vector<Index_t> outerPtr(nPoint + 1);
@@ -409,6 +428,7 @@ CCompressedSparsePattern<Index_t> buildCSRPattern(Geometry_t& geometry, Connecti
 
     /*--- Store final sparse pattern for iPoint. ---*/
     innerIdx.insert(innerIdx.end(), neighbors.begin(), neighbors.end());
+    checkPatternIndexRange<Index_t>(innerIdx.size());
   }
   outerPtr.back() = innerIdx.size();
 
@@ -496,7 +516,7 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
   const Index_t nOuter = pattern.getOuterSize();
 
   /*--- Trivial case. ---*/
-  if (groupSize >= nOuter) return createNaturalColoring(nOuter);
+  if (groupSize >= nOuter) return createNaturalColoring<T>(nOuter);
 
   const Index_t minIdx = pattern.getMinInnerIdx();
   const Index_t nInner = pattern.getMaxInnerIdx() + 1 - minIdx;
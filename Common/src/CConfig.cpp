@@ -36,6 +36,7 @@
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/geometry/meshreader/SU2BinaryMesh.hpp"
 
 using namespace PrintingToolbox;
 
@@ -686,7 +687,13 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
       nZone = 1;
       break;
     }
-    case BOX: {
+    case BOX:
+    case SYNTHETIC: {
+      nZone = 1;
+      break;
+    }
+    case SU2_BINARY: {
+      /*--- The binary format is single zone. ---*/
       nZone = 1;
       break;
     }
@@ -796,10 +803,20 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
       nDim = 2;
       break;
     }
-    case BOX: {
+    case BOX:
+    case SYNTHETIC: {
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+      uint64_t header[SU2BinaryMesh::HEADER_SIZE];
+      if (!SU2BinaryMesh::ReadHeader(val_mesh_filename, header)) {
+        SU2_MPI::Error(val_mesh_filename + string(" was not found or is not an SU2 binary mesh file."),
+                       CURRENT_FUNCTION);
+      }
+      nDim = header[SU2BinaryMesh::NDIM];
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -1077,6 +1094,11 @@ void CConfig::SetConfig_Options() {
   // and none of us that write the parsers want to write a full c++ interpreter. Please
   // play nice with the existing format so that you don't break the existing scripts.
 
+  /*--- Avoid rehashing the maps of the options while they are added. ---*/
+
+  all_options.reserve(1024);
+  option_map.reserve(1024);
+
   /* BEGIN_CONFIG_OPTIONS */
 
   /*!\par CONFIG_CATEGORY: Problem Definition \ingroup Config */
@@ -1154,8 +1176,16 @@ void CConfig::SetConfig_Options() {
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief READ_RESTART_MMAP \n DESCRIPTION: Read binary restart files by mapping them into memory (node-local storage). \n Options: NO, YES \ingroup Config */
+  addBoolOption("READ_RESTART_MMAP", Read_Restart_MMap, false);
+  /*!\brief PREFETCH_INPUT_FILES \n DESCRIPTION: Read the mesh files of the next zones, and the restart files, in the background during preprocessing. \n Options: NO, YES \ingroup Config */
+  addBoolOption("PREFETCH_INPUT_FILES", Prefetch_Input_Files, false);
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_RESTART_OVERWRITE", Wrt_Restart_Overwrite, true);
+  /*!\brief RESTART_TIME_SERIES \n DESCRIPTION: Append the unsteady binary restarts to a single (compressed) file. \n Options: NO, YES \ingroup Config */
+  addBoolOption("RESTART_TIME_SERIES", Restart_Time_Series, false);
+  /*!\brief RESTART_KEYFRAME_INTERVAL \n DESCRIPTION: Steps between full frames of restart time series, the others store deltas. \ingroup Config */
+  addUnsignedLongOption("RESTART_KEYFRAME_INTERVAL", Restart_KeyFrame_Interval, 10);
   /*!\brief WRT_SURFACE_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
@@ -1174,6 +1204,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("INTERPOLATION_METHOD",Kind_DataDriven_Method, DataDrivenMethod_Map, ENUM_DATADRIVEN_METHOD::LUT);
   /*!\brief FILENAME_INTERPOLATOR \n DESCRIPTION: Input file for the interpolation method. \n \ingroup Config*/
   addStringListOption("FILENAMES_INTERPOLATOR", n_Datadriven_files, DataDriven_Method_FileNames);
+  /*!\brief WRITE_BINARY_LUT \n DESCRIPTION: Write the look-up table in binary format to <file>.bin after loading it. \n \ingroup Config*/
+  addBoolOption("WRITE_BINARY_LUT", Write_Binary_LUT, false);
   /*!\brief DATADRIVEN_NEWTON_RELAXATION \n DESCRIPTION: Relaxation factor for Newton solvers in data-driven fluid model. \n \ingroup Config*/
   addDoubleOption("DATADRIVEN_NEWTON_RELAXATION", DataDriven_Relaxation_Factor, 0.05);
 
@@ -1210,6 +1242,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("INLET_TEMPERATURE_VE", Inlet_Temperature_ve, 0.0);
   /* DESCRIPTION: Specify if mixture is frozen */
   addBoolOption("FROZEN_MIXTURE", frozen, false);
+  /* DESCRIPTION: Treat the chemistry and vib. relaxation sources point-implicitly with explicit schemes */
+  addBoolOption("POINT_IMPLICIT_SOURCES", point_implicit_sources, false);
   /* DESCRIPTION: Specify if there is ionization */
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
@@ -1237,6 +1271,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulation of real gas models ---*/
+  /* DESCRIPTION: Evaluate the fluid model (VW_GAS, PR_GAS, or COOLPROP) by interpolation on a table built at startup */
+  addBoolOption("TABULATE_FLUID_MODEL", Tabulate_FluidModel, false);
+  /* DESCRIPTION: Density range of the fluid table {min, max} (the table is uniform in log(rho)) */
+  addDoubleArrayOption("TABULATION_DENSITY_RANGE", Tabulation_Density_Range.size(), Tabulation_Density_Range.data());
+  /* DESCRIPTION: Temperature range of the fluid table {min, max}, determines the range of internal energy */
+  addDoubleArrayOption("TABULATION_TEMPERATURE_RANGE", Tabulation_Temperature_Range.size(), Tabulation_Temperature_Range.data());
+  /* DESCRIPTION: Number of table nodes {density, energy} */
+  addUShortArrayOption("TABULATION_SIZE", Tabulation_Size.size(), Tabulation_Size.data());
+  /* DESCRIPTION: File where the fluid table is cached, empty to always build the table */
+  addStringOption("TABULATION_FILENAME", Tabulation_FileName, "");
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, VISCOSITYMODEL::SUTHERLAND);
@@ -1266,6 +1312,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Definition of the turbulent thermal conductivity model (CONSTANT_PRANDTL_TURB (default), NONE). */
   addEnumOption("TURBULENT_CONDUCTIVITY_MODEL", Kind_ConductivityModel_Turb, TurbConductivityModel_Map, CONDUCTIVITYMODEL_TURB::CONSTANT_PRANDTL);
 
+  /* DESCRIPTION: Relative change of temperature and density below which the transport properties are reused. */
+  addDoubleOption("TRANSPORT_PROPERTIES_TOLERANCE", Transport_Properties_Tol, 0.0);
+
  /*--- Options related to Constant Thermal Conductivity Model ---*/
 
  /* DESCRIPTION: default value for AIR */
@@ -1360,6 +1409,8 @@ void CConfig::SetConfig_Options() {
   addDoubleListOption("SPECIES_CLIPPING_MAX", nSpecies_Clipping_Max, Species_Clipping_Max);
   /*!\brief SPECIES_CLIPPING_MIN \n DESCRIPTION: Minimum values for scalar clipping \ingroup Config*/
   addDoubleListOption("SPECIES_CLIPPING_MIN", nSpecies_Clipping_Min, Species_Clipping_Min);
+  /*!\brief SPECIES_SEGREGATED_SOLVE \n DESCRIPTION: Solve the species one at a time, with a scalar Jacobian shared by all species \n DEFAULT: false \ingroup Config*/
+  addBoolOption("SPECIES_SEGREGATED_SOLVE", Species_Segregated_Solve, false);
 
   /*!\brief FLAME_INIT \n DESCRIPTION: flame initialization using the flamelet model \ingroup Config*/
   /*--- flame offset (x,y,z) ---*/
@@ -1507,6 +1558,17 @@ void CConfig::SetConfig_Options() {
   /*!\brief MARKER_PYTHON_CUSTOM\n DESCRIPTION: Python customizable marker(s) \ingroup Config*/
   addStringListOption("MARKER_PYTHON_CUSTOM", nMarker_PyCustom, Marker_PyCustom);
 
+  /*!\brief PRECICE_COUPLING\n DESCRIPTION: Kind of coupling with other codes through preCICE (NONE, FSI, CHT_TEMPERATURE, CHT_HEATFLUX) \ingroup Config*/
+  addEnumOption("PRECICE_COUPLING", Precice_Coupling, Precice_Coupling_Map, PRECICE_COUPLING::NONE);
+  /*!\brief PRECICE_CONFIG_FILE\n DESCRIPTION: preCICE configuration file \ingroup Config*/
+  addStringOption("PRECICE_CONFIG_FILE", Precice_Config_File, string("precice-config.xml"));
+  /*!\brief PRECICE_PARTICIPANT\n DESCRIPTION: Name of SU2 as a preCICE participant \ingroup Config*/
+  addStringOption("PRECICE_PARTICIPANT", Precice_Participant, string("SU2"));
+  /*!\brief PRECICE_MESH_PREFIX\n DESCRIPTION: Prefix of the preCICE mesh names, one mesh per marker named <prefix>-<marker> \ingroup Config*/
+  addStringOption("PRECICE_MESH_PREFIX", Precice_Mesh_Prefix, string("SU2"));
+  /*!\brief MARKER_PRECICE\n DESCRIPTION: Markers coupled through preCICE \ingroup Config*/
+  addStringListOption("MARKER_PRECICE", nMarker_Precice, Marker_Precice);
+
   /*!\brief MARKER_WALL_FUNCTIONS\n DESCRIPTION: Viscous wall markers for which wall functions must be applied.
    Format: (Wall function marker, wall function type, ...) \ingroup Config*/
   addWallFunctionOption("MARKER_WALL_FUNCTIONS", nMarker_WallFunctions, Marker_WallFunctions,
@@ -1712,9 +1774,19 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Compute the matrix-free products of the NK method with forward AD instead of finite differences. */
+  addBoolOption("NEWTON_KRYLOV_FORWARD_AD", NK_ForwardAD, false);
+  /* DESCRIPTION: Solve the turbulence model together with the flow in the NK method (fully coupled RANS). */
+  addBoolOption("NEWTON_KRYLOV_COUPLED_TURB", NK_CoupledTurb, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
+  /* DESCRIPTION: Relative tolerance to discard (almost) linearly dependent quasi-Newton samples, 0 keeps all. */
+  addDoubleOption("QUASI_NEWTON_FILTER_TOLERANCE", QuasiNewtonFilterTol, 0.0);
+  /* DESCRIPTION: Accelerate the steady primal fixed-point iterations with the quasi-Newton method. */
+  addBoolOption("QUASI_NEWTON_PRIMAL", QuasiNewtonPrimal, false);
+  /* DESCRIPTION: Primal quasi-Newton parameters {first accelerated iteration, residual increase to reset}. */
+  addDoubleArrayOption("QUASI_NEWTON_PRIMAL_PARAM", QuasiNewtonPrimalParam.size(), QuasiNewtonPrimalParam.data());
   /* DESCRIPTION: Whether to use vectorized numerical schemes, less robust against transients. */
   addBoolOption("USE_VECTORIZATION", UseVectorization, false);
 
@@ -1749,10 +1821,26 @@ void CConfig::SetConfig_Options() {
   // these options share nRKStep as their size, which is not a good idea in general
   /* DESCRIPTION: Runge-Kutta alpha coefficients */
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
+  /* DESCRIPTION: Jacobi iterations of the implicit residual smoothing of the explicit schemes (0 = no smoothing) */
+  addUnsignedShortOption("RESIDUAL_SMOOTHING_ITER", Residual_Smoothing_Iter, 0);
+  /* DESCRIPTION: Coefficient of the implicit residual smoothing */
+  addDoubleOption("RESIDUAL_SMOOTHING_COEFF", Residual_Smoothing_Coeff, 0.5);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
   addUnsignedShortOption("TIME_DOFS_ADER_DG", nTimeDOFsADER_DG, 2);
+  /* DESCRIPTION: Order (1 or 2) of the BDF scheme of the implicit DG-FEM time integration. */
+  addUnsignedShortOption("BDF_ORDER_DG", nOrderBDF_DG, 2);
+  /* DESCRIPTION: Maximum number of Newton iterations per time step of the implicit DG-FEM time integration. */
+  addUnsignedShortOption("NEWTON_ITER_DG", nNewtonIter_DG, 10);
+  /* DESCRIPTION: Relative reduction of the unsteady residual that ends the Newton iterations of the implicit DG-FEM time integration. */
+  addDoubleOption("NEWTON_TOL_DG", NewtonTol_DG, 1e-4);
+  /* DESCRIPTION: Number of coarse polynomial levels of the p-multigrid cycle for steady DG-FEM computations (0 = off). */
+  addUnsignedShortOption("PMG_LEVELS_DG", nPMGLevels_DG, 0);
+  /* DESCRIPTION: Number of pre-smoothing Runge-Kutta iterations on each level of the p-multigrid cycle. */
+  addUnsignedShortOption("PMG_PRE_SMOOTH_DG", nPMGPreSmooth_DG, 1);
+  /* DESCRIPTION: Number of post-smoothing Runge-Kutta iterations on each level of the p-multigrid cycle. */
+  addUnsignedShortOption("PMG_POST_SMOOTH_DG", nPMGPostSmooth_DG, 1);
   /* DESCRIPTION: Unsteady Courant-Friedrichs-Lewy number of the finest grid */
   addDoubleOption("UNST_CFL_NUMBER", Unst_CFL, 0.0);
   /* DESCRIPTION: Integer number of periodic time instances for Harmonic Balance */
@@ -1765,8 +1853,20 @@ void CConfig::SetConfig_Options() {
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
+  /* DESCRIPTION: Number of primal states kept in memory by the unsteady adjoint to recompute missing restart files */
+  addUnsignedShortOption("UNST_ADJOINT_CHECKPOINTS", Unst_Adjoint_Checkpoints, 0);
+  /* DESCRIPTION: Number of inner iterations of the recomputed primal time steps (0 uses INNER_ITER) */
+  addUnsignedLongOption("UNST_ADJOINT_PRIMAL_ITER", Unst_Adjoint_PrimalIter, 0);
+  /* DESCRIPTION: Max error of the primal states kept in memory by the unsteady adjoint, relative to the range of each variable (0 stores them exactly) */
+  addDoubleOption("UNST_ADJOINT_CHECKPOINT_TOL", Unst_Adjoint_Checkpoint_Tol, 0.0);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FLOW", Kind_TimeIntScheme_Flow, Time_Int_Map, EULER_IMPLICIT);
+  /* DESCRIPTION: Rosenbrock variant of EULER_IMPLICIT for time-accurate flows (NONE, ROS2) */
+  addEnumOption("ROSENBROCK_SCHEME", Kind_Rosenbrock, Rosenbrock_Map, ROSENBROCK_SCHEME::NONE);
+  /* DESCRIPTION: Iterations between assemblies of the Jacobian of the vectorized edge loop of the compressible flow solvers (1 assembles it every iteration) */
+  addUnsignedShortOption("JACOBIAN_LAG", Jacobian_Lag, 1);
+  /* DESCRIPTION: The lagged Jacobian is also assembled when the average CFL changes by more than this factor */
+  addDoubleOption("JACOBIAN_LAG_CFL_FACTOR", Jacobian_Lag_CFL_Factor, 2.0);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FEM_FLOW", Kind_TimeIntScheme_FEM_Flow, Time_Int_Map, RUNGE_KUTTA_EXPLICIT);
   /* DESCRIPTION: ADER-DG predictor step */
@@ -1803,12 +1903,44 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Thread-parallel ILU via level scheduling, instead of one block (partition) per thread */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Level_Scheduling, false);
+  /* DESCRIPTION: Layers of halo points included in the ILU preconditioner (restricted additive Schwarz), 0 drops the
+   * couplings between ranks (block-Jacobi), the overlap is limited by the halo layers of the partitions */
+  addUnsignedShortOption("LINEAR_SOLVER_SCHWARZ_OVERLAP", Linear_Solver_Schwarz_Overlap, 0);
+  /* DESCRIPTION: Coarse correction of the ILU preconditioner with one aggregate per rank, solved redundantly */
+  addBoolOption("LINEAR_SOLVER_SCHWARZ_COARSE", Linear_Solver_Schwarz_Coarse, false);
+  /* DESCRIPTION: Maximum number of levels of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of pre and post smoothing sweeps on each level of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SMOOTH", Linear_Solver_AMG_Smooth, 2);
+  /* DESCRIPTION: Build the AMG preconditioner of elasticity (FEA and mesh deformation) systems with the rigid body modes */
+  addBoolOption("LINEAR_SOLVER_AMG_RIGID_BODY_MODES", Linear_Solver_AMG_RigidBodyModes, true);
+  /*!\brief LINEAR_SOLVER_MATRIX_FORMAT
+   *  \n DESCRIPTION: Storage format of the matrix in the products of the linear solver \n OPTIONS: see \link Matrix_Format_Map \endlink \n DEFAULT: BCSR \ingroup Config*/
+  addEnumOption("LINEAR_SOLVER_MATRIX_FORMAT", Kind_Matrix_Format, Matrix_Format_Map, MATRIX_FORMAT::BCSR);
+  /*!\brief LINEAR_SOLVER_SINGLE_PREC
+   *  \n DESCRIPTION: Linear systems (of types of solvers) that are solved in single precision \n OPTIONS: see \link Linear_System_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumListOption("LINEAR_SOLVER_SINGLE_PREC", nLinear_Solver_Single_Prec, Linear_Solver_Single_Prec, Linear_System_Map);
+  /*!\brief LINEAR_SOLVER_GPU
+   *  \n DESCRIPTION: Linear systems (of types of solvers) whose products and Jacobi preconditioner run on the GPU \n OPTIONS: see \link Linear_System_Map \endlink \n DEFAULT: NONE \ingroup Config*/
+  addEnumListOption("LINEAR_SOLVER_GPU", nLinear_Solver_GPU, Linear_Solver_GPU, Linear_System_Map);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Number of linear solves for which the (ILU, JACOBI, AMG) preconditioner is reused before being rebuilt (0 means never reused). */
+  addUnsignedLongOption("LINEAR_SOLVER_PREC_REUSE", Linear_Solver_Prec_Reuse, 0);
+  /* DESCRIPTION: The reused preconditioner is rebuilt if the linear iterations exceed this factor times those of the first solve after the last build. */
+  addDoubleOption("LINEAR_SOLVER_PREC_REUSE_GROWTH", Linear_Solver_Prec_Reuse_Growth, 1.5);
+  /* DESCRIPTION: Number of directions recycled between the solves of each linear system by RECYCLED_FGMRES. */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 8);
+  /* DESCRIPTION: How the tolerance of the linear solver is chosen for each solve (FIXED, EISENSTAT_WALKER). */
+  addEnumOption("LINEAR_SOLVER_FORCING", Kind_Linear_Solver_Forcing, Linear_Solver_Forcing_Map, LINEAR_SOLVER_FORCING::FIXED);
+  /* DESCRIPTION: Gamma, alpha, and maximum tolerance of the Eisenstat-Walker forcing term. */
+  addDoubleArrayOption("LINEAR_SOLVER_FORCING_PARAM", Linear_Solver_Forcing_Param.size(), Linear_Solver_Forcing_Param.data());
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1880,6 +2012,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_GALERKIN_JACOBIAN\n DESCRIPTION: Form the Jacobian of the coarse levels algebraically from the fine Jacobian (implicit multigrid). DEFAULT NO \ingroup Config*/
+  addBoolOption("MG_GALERKIN_JACOBIAN", MG_GalerkinJacobian, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1910,6 +2044,10 @@ void CConfig::SetConfig_Options() {
 
   /*!\brief MUSCL_FLOW \n DESCRIPTION: Check if the MUSCL scheme should be used \ingroup Config*/
   addBoolOption("MUSCL_FLOW", MUSCL_Flow, true);
+  /*!\brief MUSCL_FLOW_SINGLE_PREC \n DESCRIPTION: Read the reconstruction gradients and limiters of the flow from a single precision copy in the edge loop \ingroup Config*/
+  addBoolOption("MUSCL_FLOW_SINGLE_PREC", MUSCL_Flow_Single_Prec, false);
+  /*!\brief EDGE_GEOMETRY_CACHE \n DESCRIPTION: Store the geometry of the edges in the order of the vectorized edge loop \ingroup Config*/
+  addBoolOption("EDGE_GEOMETRY_CACHE", Edge_Geometry_Cache, false);
   /*!\brief SLOPE_LIMITER_FLOW
    * DESCRIPTION: Slope limiter for the direct solution. \n OPTIONS: See \link Limiter_Map \endlink \n DEFAULT VENKATAKRISHNAN \ingroup Config*/
   addEnumOption("SLOPE_LIMITER_FLOW", Kind_SlopeLimit_Flow, Limiter_Map, LIMITER::VENKATAKRISHNAN);
@@ -2030,6 +2168,12 @@ void CConfig::SetConfig_Options() {
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Record one tape w.r.t. solution and mesh coordinates for the multizone discrete adjoint */
+  addBoolOption("COMBINED_RECORDING_DISC", Combined_Recording_Disc, false);
+  /* DESCRIPTION: Use the hand-differentiated JST flux in the discrete adjoint instead of recording it */
+  addBoolOption("ADJOINT_FLUX_KERNEL_DISC", Adjoint_Flux_Kernel_Disc, false);
+  /* DESCRIPTION: Solve the discrete adjoint of each objective function separately, reusing one recording */
+  addBoolOption("BATCH_OBJECTIVES_DISC", Batch_Objectives_Disc, false);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -2038,6 +2182,12 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Automatically reorient elements that seem flipped */
   addBoolOption("REORIENT_ELEMENTS",ReorientElements, true);
+  /*!\brief POINT_ORDERING
+   *  \n DESCRIPTION: Renumbering of the points of each rank after partitioning \n OPTIONS: see \link Point_Ordering_Map \endlink \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, POINT_ORDERING::RCM);
+  /*!\brief DISTRIBUTED_WALL_DISTANCE
+   *  \n DESCRIPTION: Compute the wall distance with the wall elements of each rank instead of gathering them on all ranks \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("DISTRIBUTED_WALL_DISTANCE", Distributed_WallDistance, false);
 
   /*!\par CONFIG_CATEGORY: Sobolev Gradient Solver Parameters \ingroup Config */
   /*--- Options related to the Sobolev smoothing solver ---*/
@@ -2084,6 +2234,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, SU2 (ASCII) or SU2_BINARY (.su2b extension). \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
+  /* DESCRIPTION: Read CGNS (HDF5) meshes with collective parallel I/O (pCGNS) */
+  addBoolOption("CGNS_PARALLEL_READ", CGNS_ParallelRead, false);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2096,6 +2250,15 @@ void CConfig::SetConfig_Options() {
   mesh_box_offset[0] = 0.0; mesh_box_offset[1] = 0.0; mesh_box_offset[2] = 0.0;
   addDoubleArrayOption("MESH_BOX_OFFSET", 3, mesh_box_offset);
 
+  /* DESCRIPTION: Elements of the SYNTHETIC grid (HEXAHEDRA, TETRAHEDRA, HYBRID). */
+  addEnumOption("SYNTHETIC_MESH_ELEMENTS", SyntheticMesh_Elements, SyntheticMeshElem_Map, SYNTHETIC_MESH_ELEM::HEXAHEDRA);
+  /* DESCRIPTION: Shape of the SYNTHETIC grid (BOX, ANNULUS). */
+  addEnumOption("SYNTHETIC_MESH_GEOMETRY", SyntheticMesh_Geometry, SyntheticMeshGeom_Map, SYNTHETIC_MESH_GEOM::BOX);
+  /* DESCRIPTION: Number of cell layers of prisms above y_minus for HYBRID SYNTHETIC grids. */
+  addUnsignedShortOption("SYNTHETIC_MESH_LAYERS", SyntheticMesh_Layers, 8);
+  /* DESCRIPTION: Ratio between consecutive spacings in y, from y_minus, of the SYNTHETIC grid (1 is uniform). */
+  addDoubleOption("SYNTHETIC_MESH_GROWTH", SyntheticMesh_Growth, 1.0);
+
   /* DESCRIPTION: Determine if the mesh file supports multizone. \n DEFAULT: true (temporarily) */
   addBoolOption("MULTIZONE_MESH", Multizone_Mesh, true);
   /* DESCRIPTION: Determine if we need to allocate memory to store the multizone residual. \n DEFAULT: true (temporarily) */
@@ -2122,6 +2285,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("BREAKDOWN_FILENAME", Breakdown_FileName, string("forces_breakdown.dat"));
   /*!\brief SOLUTION_FLOW_FILENAME \n DESCRIPTION: Restart flow input file (the file output under the filename set by RESTART_FLOW_FILENAME) \n DEFAULT: solution_flow.dat \ingroup Config */
   addStringOption("SOLUTION_FILENAME", Solution_FileName, string("solution.dat"));
+  /*!\brief SOLUTION_FILENAME_LIST \n DESCRIPTION: Solution files that SU2_SOL converts one after the other, reusing the geometry preprocessing. \ingroup Config */
+  addStringListOption("SOLUTION_FILENAME_LIST", nSol_Batch_Files, Sol_Batch_FileNames);
   /*!\brief SOLUTION_ADJ_FILENAME\n DESCRIPTION: Restart adjoint input file. Objective function abbreviation is expected. \ingroup Config*/
   addStringOption("SOLUTION_ADJ_FILENAME", Solution_AdjFileName, string("solution_adj.dat"));
   /*!\brief RESTART_FLOW_FILENAME \n DESCRIPTION: Output file restart flow \ingroup Config*/
@@ -2153,6 +2318,13 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /*!\brief WRT_PHASE_TIMERS
+   *  \n DESCRIPTION: Time the main phases of the solution process (iteration, residuals, gradients, linear solver,
+   *  communications, output), print the hierarchy at the end of SU2_CFD, and write a trace file.  \ingroup Config*/
+  addBoolOption("WRT_PHASE_TIMERS", Wrt_Phase_Timers, false);
+  /*!\brief PHASE_TIMERS_FILENAME
+   *  \n DESCRIPTION: Output file of the phase timers in Chrome trace format (JSON).  \ingroup Config*/
+  addStringOption("PHASE_TIMERS_FILENAME", Phase_Timers_FileName, string("phase_timers.json"));
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2163,6 +2335,30 @@ void CConfig::SetConfig_Options() {
   /*!\brief COMM_LEVEL
    *  \n DESCRIPTION: Level of MPI communications during runtime  \ingroup Config*/
   addEnumOption("COMM_LEVEL", Comm_Level, Comm_Map, COMM_FULL);
+  /*!\brief COMM_OVERLAP
+   *  \n DESCRIPTION: Overlap the halo exchange of the limiters with the interior edge loop of the flow residuals \ingroup Config*/
+  addBoolOption("COMM_OVERLAP", Comm_Overlap, false);
+  /*!\brief COMM_PROGRESS_THREAD
+   *  \n DESCRIPTION: Progress and unpack the overlapped halo exchanges with a dedicated thread (requires MPI_THREAD_MULTIPLE) \ingroup Config*/
+  addBoolOption("COMM_PROGRESS_THREAD", Comm_Progress_Thread, false);
+  /*!\brief PERSISTENT_MPI_COMMS
+   *  \n DESCRIPTION: Create persistent MPI requests once for the halo exchanges, instead of posting new ones for each exchange \ingroup Config*/
+  addBoolOption("PERSISTENT_MPI_COMMS", Persistent_MPI_Comms, false);
+  /*!\brief SHARED_MEMORY_COMMS
+   *  \n DESCRIPTION: Copy the halo data directly into the buffers of the neighbors on the same node (MPI-3 shared memory) \ingroup Config*/
+  addBoolOption("SHARED_MEMORY_COMMS", Shared_Memory_Comms, false);
+  /*!\brief DEFERRED_RESIDUAL_REDUCTION
+   *  \n DESCRIPTION: Reduce the residuals of all the solvers of the zone with one non-blocking collective per iteration \ingroup Config*/
+  addBoolOption("DEFERRED_RESIDUAL_REDUCTION", Deferred_Res_Reduction, false);
+  /*!\brief HALO_SINGLE_PRECISION
+   *  \n DESCRIPTION: Send the gradients, limiters, and sensors used by the reconstruction in single precision in the halo exchanges \ingroup Config*/
+  addBoolOption("HALO_SINGLE_PRECISION", Halo_Single_Precision, false);
+  /*!\brief MEMORY_POOL
+   *  \n DESCRIPTION: Keep the released large buffers (variables, matrices, vectors) for reuse by later allocations \ingroup Config*/
+  addBoolOption("MEMORY_POOL", Memory_Pool, false);
+  /*!\brief TRANSPARENT_HUGE_PAGES
+   *  \n DESCRIPTION: Align the large buffers to 2 MB and advise the OS to back them with transparent huge pages (Linux) \ingroup Config*/
+  addBoolOption("TRANSPARENT_HUGE_PAGES", Transparent_Huge_Pages, false);
 
   /*!\par CONFIG_CATEGORY: Dynamic mesh definition \ingroup Config*/
   /*--- Options related to dynamic meshes ---*/
@@ -2193,6 +2389,8 @@ void CConfig::SetConfig_Options() {
   addDoubleArrayOption("PLUNGING_OMEGA", 3, Plunging_Omega);
   /* DESCRIPTION: Plunging amplitude (m) in x, y, & z directions (RIGID_MOTION only) */
   addDoubleArrayOption("PLUNGING_AMPL", 3, Plunging_Ampl);
+  /* DESCRIPTION: Rotate the normals of the dual grid instead of recomputing its metrics (RIGID_MOTION only) */
+  addBoolOption("RIGID_MOTION_TRANSFORM_METRICS", RigidMotion_TransformMetrics, false);
   /* DESCRIPTION: Coordinates of the rigid motion origin */
   addDoubleListOption("SURFACE_MOTION_ORIGIN", nMarkerMotion_Origin, MarkerMotion_Origin);
   /* DESCRIPTION: Translational velocity vector (m/s) in the x, y, & z directions (DEFORMING only) */
@@ -2335,6 +2533,22 @@ void CConfig::SetConfig_Options() {
   addBoolOption("DEFORM_CONSOLE_OUTPUT", Deform_Output, false);
   /* DESCRIPTION: Number of nonlinear deformation iterations (surface deformation increments) */
   addUnsignedLongOption("DEFORM_NONLINEAR_ITER", GridDef_Nonlinear_Iter, 1);
+  /* DESCRIPTION: Number of deformation solves (increments or calls) that reuse the stiffness matrix and its preconditioner */
+  addUnsignedLongOption("DEFORM_STIFFNESS_REUSE", Deform_Stiffness_Reuse, 0);
+  /* DESCRIPTION: Only the elements with points that moved more than this are updated in the dual grid (0 updates all) */
+  addDoubleOption("DUAL_GRID_UPDATE_TOL", DualGrid_UpdateTol, 0.0);
+  /* DESCRIPTION: Number of previous deformations used to predict the initial guess of the deformation solve (0 is cold start) */
+  addUnsignedShortOption("DEFORM_WARM_START", Deform_Warm_Start, 0);
+  /* DESCRIPTION: Method of volumetric mesh deformation (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Deform_Method, Deform_Method_Map, DEFORM_METHOD::ELASTICITY);
+  /* DESCRIPTION: Radial basis function of the RBF mesh deformation (WENDLAND_C2, GAUSSIAN, INV_MULTI_QUADRIC) */
+  addEnumOption("DEFORM_RBF_FUNCTION", Deform_RBF_Function, RadialBasisFunction_Map, RADIAL_BASIS::WENDLAND_C2);
+  /* DESCRIPTION: Support radius of the RBF mesh deformation, 0 uses the size of the region of prescribed displacements */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Tolerance (relative to the max. displacement) of the greedy selection of RBF points */
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tolerance, 1e-3);
+  /* DESCRIPTION: Maximum number of points selected for the RBF mesh deformation */
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_Max_Points, 2000);
   /* DESCRIPTION: Deform coefficient (-1.0 to 0.5) */
   addDoubleOption("DEFORM_COEFF", Deform_Coeff, 1E6);
   /* DESCRIPTION: Deform limit in m or inches */
@@ -2386,6 +2600,8 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
+  /* DESCRIPTION: Compute the volume residual of the inviscid DG-FEM solver on the GPU (NO, YES) */
+  addBoolOption("FEM_DG_GPU", FEM_DG_GPU, false);
 
   /*!\par CONFIG_CATEGORY: FEA solver \ingroup Config*/
   /*--- Options related to the FEA solver ---*/
@@ -2460,6 +2676,20 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Iterative method for non-linear structural analysis */
   addEnumOption("NONLINEAR_FEM_SOLUTION_METHOD", Kind_SpaceIteScheme_FEA, Space_Ite_Map_FEA, STRUCT_SPACE_ITE::NEWTON);
+  /* DESCRIPTION: Maximum number of iterations for which the tangent of MODIFIED_NEWTON_RAPHSON and BFGS is kept,
+   * also across time steps, 0 updates it at the start of each time step. */
+  addUnsignedLongOption("NONLINEAR_FEM_TANGENT_REUSE", FEA_Tangent_Reuse, 0);
+  /* DESCRIPTION: Update the tangent of MODIFIED_NEWTON_RAPHSON and BFGS when the ratio between the norms of
+   * consecutive residuals exceeds this value. */
+  addDoubleOption("NONLINEAR_FEM_TANGENT_REFRESH", FEA_Tangent_Refresh, 1.0);
+  /* DESCRIPTION: Solve linear structures by superposition of their modes, e.g. for aeroelastic FSI */
+  addBoolOption("MODAL_SUPERPOSITION", Modal_Superposition, false);
+  /* DESCRIPTION: Number of structural modes for MODAL_SUPERPOSITION */
+  addUnsignedShortOption("MODAL_NUMBER_MODES", nModes_FEA, 10);
+  /* DESCRIPTION: Damping ratio of the structural modes */
+  addDoubleOption("MODAL_DAMPING", Modal_Damping, 0.0);
+  /* DESCRIPTION: File with the structural modes, read if it exists, otherwise the modes are computed and written */
+  addStringOption("MODAL_FILENAME", Modal_FileName, string("modes.dat"));
   /* DESCRIPTION: Formulation for bidimensional elasticity solver */
   addEnumOption("FORMULATION_ELASTICITY_2D", Kind_2DElasForm, ElasForm_2D, STRUCT_2DFORM::PLANE_STRAIN);
   /*  DESCRIPTION: Apply dead loads
@@ -2530,16 +2760,32 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTER_ITER", nOuterIter, 1);
   /* DESCRIPTION: Number of inner iterations in each multizone block. */
   addUnsignedLongOption("INNER_ITER", nInnerIter, 1);
+  /* DESCRIPTION: Number of outer iterations between two iterations of this zone in a multizone problem. */
+  addUnsignedLongOption("ZONE_UPDATE_FREQ", ZoneUpdateFreq, 1);
   /* DESCRIPTION: Number of time steps solved in the multizone problem. */
   addUnsignedLongOption("TIME_ITER", nTimeIter, 1);
   /* DESCRIPTION: Number of iterations in each single-zone block. */
   addUnsignedLongOption("ITER", nIter, 1000);
   /* DESCRIPTION: Restart iteration in the multizone problem. */
   addUnsignedLongOption("RESTART_ITER", Restart_Iter, 1);
+  /* DESCRIPTION: Number of time iterations between in-memory checkpoints copied to a buddy rank (0 disables them). */
+  addUnsignedLongOption("BUDDY_CHECKPOINT_FREQ", Buddy_Checkpoint_Freq, 0);
+  /* DESCRIPTION: Node-local (memory backed) directory where the buddy checkpoints are kept. */
+  addStringOption("BUDDY_CHECKPOINT_DIR", Buddy_Checkpoint_Dir, string("/dev/shm"));
+  /* DESCRIPTION: Number of time slices solved concurrently by the parallel-in-time (Parareal) driver, 1 disables it. */
+  addUnsignedLongOption("PARAREAL_SLICES", Parareal_Slices, 1);
+  /* DESCRIPTION: Ratio of the time steps of the coarse and fine Parareal propagators. */
+  addUnsignedLongOption("PARAREAL_COARSE_FACTOR", Parareal_Coarse_Factor, 10);
+  /* DESCRIPTION: Maximum number of Parareal iterations. */
+  addUnsignedLongOption("PARAREAL_ITER", Parareal_Iter, 10);
+  /* DESCRIPTION: Relative change of the start states of the slices at which the Parareal iteration stops. */
+  addDoubleOption("PARAREAL_TOL", Parareal_Tol, 1e-6);
   /* DESCRIPTION: Minimum error threshold for the linear solver for the implicit formulation */
   addDoubleOption("TIME_STEP", Time_Step, 0.0);
   /* DESCRIPTION: Total Physical Time for time-domain problems (s) */
   addDoubleOption("MAX_TIME", Max_Time, 1.0);
+  /* DESCRIPTION: Start each dual time step from a linear extrapolation of the two previous time levels */
+  addBoolOption("TIME_STEP_EXTRAPOLATION", Time_Step_Extrapolation, false);
   /* DESCRIPTION: Determines if the special output is written out */
   addBoolOption("SPECIAL_OUTPUT", SpecialOutput, false);
 
@@ -2579,6 +2825,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Number of donor points in the local RBF patch of each target point, 0 uses a global RBF
+   * (dense matrix, only suitable for small interfaces). */
+  addUnsignedShortOption("RADIAL_BASIS_FUNCTION_LOCAL_POINTS", RadialBasisFunction_LocalPoints, 0);
+
+  /* DESCRIPTION: Number of time steps after which the relative position of sliding interfaces repeats
+   * (e.g. one revolution), the sliding mesh coefficients are then cached and reused, 0 disables the cache. */
+  addUnsignedLongOption("SLIDING_INTERFACE_PERIOD_STEPS", SlidingInterface_PeriodSteps, 0);
+
+  /* DESCRIPTION: Prefix of the files where the interface interpolation coefficients are stored after being computed,
+   * and read from on later runs if the interface and interpolation options did not change, empty disables the cache. */
+  addStringOption("INTERPOLATION_CACHE_FILENAME", Interpolation_Cache_FileName, string(""));
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2639,6 +2897,8 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION:  Courant-Friedrichs-Lewy condition of the finest grid in radiation solvers */
   addDoubleOption("CFL_NUMBER_RAD", CFL_Rad, 1.0);
+  /* DESCRIPTION: Solve the radiation equation every N inner iterations of the flow, in between only the source term is updated */
+  addUnsignedLongOption("RADIATION_FREQ", Rad_Freq, 1);
 
   /*!\par CONFIG_CATEGORY: Heat solver \ingroup Config*/
   /*--- options related to the heat solver ---*/
@@ -2776,6 +3036,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Number of partitions of the mesh */
   addPythonOption("NUMBER_PART");
 
+  /* DESCRIPTION: Number of adjoint evaluations the python optimizer runs concurrently */
+  addPythonOption("OPT_CONCURRENT_JOBS");
+
   /* DESCRIPTION: Optimization objective function with optional scaling factor*/
   addPythonOption("OPT_OBJECTIVE");
 
@@ -2812,6 +3075,48 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Additional ParMETIS balance constraints (multi-constraint partitioning) */
+  addEnumListOption("PARMETIS_CONSTRAINTS", nParMETIS_Constraints, ParMETIS_Constraints, ParMETIS_Constraint_Map);
+
+  /* DESCRIPTION: Load balancing tolerance of the additional ParMETIS constraints */
+  addDoubleOption("PARMETIS_CONSTRAINT_TOLERANCE", ParMETIS_Constraint_Tolerance, 0.1);
+
+  /* DESCRIPTION: Place the interface points of each zone on the ranks of the coupled points of the previous zones */
+  addBoolOption("PARMETIS_COPARTITION", ParMETIS_Copartition, false);
+
+  /* DESCRIPTION: Partitioner of the grid, graph (PARMETIS) or geometric (HILBERT_CURVE) */
+  addEnumOption("PARTITIONER", Kind_Partitioner, Partitioner_Map, PARTITIONER::PARMETIS);
+
+  /* DESCRIPTION: Refine the geometric partitioning with ParMETIS (adaptive repartitioning) */
+  addBoolOption("PARTITIONER_REFINEMENT", Partitioner_Refinement, false);
+
+  /* DESCRIPTION: Store the ParMETIS partitioning and reuse it in later runs with the same mesh and number of ranks */
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+
+  /* DESCRIPTION: Prefix of the partition cache files (one per rank) */
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache"));
+
+  /* DESCRIPTION: Measure the compute time of the ranks and write the corresponding ParMETIS weights at the end of the run */
+  addBoolOption("LOAD_BALANCE_MEASURE", Load_Balance_Measure, false);
+
+  /* DESCRIPTION: Partition with the measured weights written by a previous run */
+  addBoolOption("LOAD_BALANCE_WEIGHTS", Load_Balance_Weights, false);
+
+  /* DESCRIPTION: Prefix of the measured weights files (one per rank) */
+  addStringOption("LOAD_BALANCE_FILENAME", Load_Balance_FileName, string("load_balance"));
+
+  /* DESCRIPTION: Error indicator used to mark the points for mesh adaptation (NONE, GRADIENT, HESSIAN) */
+  addEnumOption("ADAPT_INDICATOR", Kind_Adapt_Indicator, Adapt_Indicator_Map, ADAPT_INDICATOR::NONE);
+
+  /* DESCRIPTION: Flow variable of the mesh adaptation indicator (DENSITY, PRESSURE, TEMPERATURE, VELOCITY) */
+  addEnumOption("ADAPT_VARIABLE", Kind_Adapt_Variable, Adapt_Variable_Map, ADAPT_VARIABLE::PRESSURE);
+
+  /* DESCRIPTION: Fraction of the points with the largest indicator that are marked for refinement */
+  addDoubleOption("ADAPT_REFINE_FRACTION", Adapt_Refine_Fraction, 0.1);
+
+  /* DESCRIPTION: Fraction of the points with the smallest indicator that are marked for coarsening */
+  addDoubleOption("ADAPT_COARSEN_FRACTION", Adapt_Coarsen_Fraction, 0.0);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2892,6 +3197,66 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
+  /* DESCRIPTION: Write the RESTART, PARAVIEW, and PARAVIEW_LEGACY files in a background thread */
+  addBoolOption("ASYNC_OUTPUT", Async_Output, false);
+
+  /* DESCRIPTION: Each rank writes its own piece (.vtu) of the volume data of PARAVIEW_MULTIBLOCK files */
+  addBoolOption("PARAVIEW_MULTIBLOCK_PIECES", Multiblock_Rank_Pieces, false);
+
+  /* DESCRIPTION: Number of collective buffering aggregators of the MPI-IO writes (0 is the MPI default) */
+  addUnsignedLongOption("MPIIO_CB_NODES", MPIIO_CbNodes, 0);
+
+  /* DESCRIPTION: Number of stripes of the files written with MPI-IO (0 is the file system default) */
+  addUnsignedLongOption("MPIIO_STRIPE_COUNT", MPIIO_StripeCount, 0);
+
+  /* DESCRIPTION: Stripe size in bytes of the files written with MPI-IO (0 is the file system default) */
+  addUnsignedLongOption("MPIIO_STRIPE_SIZE", MPIIO_StripeSize, 0);
+
+  /* DESCRIPTION: Number of subfiles, each written by a group of ranks, of the files written with MPI-IO */
+  addUnsignedLongOption("MPIIO_SUBFILES", MPIIO_Subfiles, 0);
+
+  /* DESCRIPTION: Deflate level (0-9) of the HDF5 data of XDMF files, 0 writes uncompressed data */
+  addUnsignedShortOption("XDMF_COMPRESSION_LEVEL", XDMF_Compression, 0);
+
+  /* DESCRIPTION: Decimal digits kept by the lossy compression of the fields of XDMF files (-1 is lossless) */
+  addIntegerOption("XDMF_LOSSY_DIGITS", XDMF_Lossy_Digits, -1);
+
+  /* DESCRIPTION: Engine of the ADIOS2 output stream, BP4/BP5 write files, SST streams to in-situ consumers */
+  addStringOption("ADIOS2_ENGINE", ADIOS2_Engine, string("BP4"));
+
+  /* DESCRIPTION: ADIOS2 XML configuration file of the output stream (engine parameters, operators) */
+  addStringOption("ADIOS2_CONFIG_FILE", ADIOS2_Config_File, string(""));
+
+  /* DESCRIPTION: Coordinates of the probes sampled to SAMPLE_FILENAME, nDim values per probe */
+  addDoubleListOption("SAMPLE_PROBES", nSample_Probes, Sample_Probes);
+
+  /* DESCRIPTION: Lines sampled to SAMPLE_FILENAME, per line the start and end points and the number of samples */
+  addDoubleListOption("SAMPLE_LINES", nSample_Lines, Sample_Lines);
+
+  /* DESCRIPTION: Planes sampled to SAMPLE_FILENAME (3D), per plane the origin, the two edge vectors, and the number of samples along each edge */
+  addDoubleListOption("SAMPLE_PLANES", nSample_Planes, Sample_Planes);
+
+  /* DESCRIPTION: Markers whose vertices are sampled to SAMPLE_FILENAME */
+  addStringListOption("SAMPLE_MARKERS", nSample_Markers, Sample_Markers);
+
+  /* DESCRIPTION: Volume output fields written to SAMPLE_FILENAME */
+  addStringListOption("SAMPLE_FIELDS", nSample_Fields, Sample_Fields);
+
+  /* DESCRIPTION: Iterations between samples (of the time iterations for unsteady problems) */
+  addUnsignedLongOption("SAMPLE_FREQUENCY", Sample_Frequency, 1);
+
+  /* DESCRIPTION: Binary output file of the samples */
+  addStringOption("SAMPLE_FILENAME", Sample_FileName, string("samples.dat"));
+
+  /* DESCRIPTION: Number of phase bins of the PHASE_AVERAGE volume output (unsteady) */
+  addUnsignedShortOption("TIME_STATISTICS_PHASES", TimeStatistics_Phases, 0);
+
+  /* DESCRIPTION: Period of the PHASE_AVERAGE volume output, in time iterations */
+  addUnsignedLongOption("TIME_STATISTICS_PERIOD", TimeStatistics_Period, 0);
+
+  /* DESCRIPTION: Frequencies (Hz) of the SPECTRUM volume output (unsteady) */
+  addDoubleListOption("TIME_STATISTICS_FREQUENCIES", nTimeStatistics_Frequencies, TimeStatistics_Frequencies);
+
   /* DESCRIPTION: Parameter to perturb eigenvalues */
   addDoubleOption("UQ_DELTA_B", uq_delta_b, 1.0);
 
@@ -2913,9 +3278,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Level of fill for PaStiX incomplete LU factorization. */
   addUnsignedShortOption("PASTIX_FILL_LEVEL", pastix_fill_lvl, 1);
 
+  /* DESCRIPTION: Parts of the matrix factorized by PaStiX, GLOBAL, or the diagonal blocks of each RANK or NODE. */
+  addEnumOption("PASTIX_BLOCKS", pastix_blocks, Pastix_Blocks_Map, PASTIX_BLOCKS::GLOBAL);
+
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Form the colored groups of edges from the natural order of the edges (GREEDY) or from sub-domains of the points of each rank (PARTITIONED). */
+  addEnumOption("EDGE_COLORING_METHOD", Kind_EdgeColoring, Edge_Coloring_Map, EDGE_COLORING::GREEDY);
+
+  /* DESCRIPTION: Strategy of the edge loops when the coloring efficiency is low, store the edge fluxes and sum them per point (REDUCTION), or let each thread compute all the edges of the points it owns (OWNER_COMPUTES). */
+  addEnumOption("EDGE_COLORING_FALLBACK", Kind_EdgeFallback, Edge_Fallback_Map, EDGE_FALLBACK::REDUCTION);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -2934,6 +3308,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief ROM_SAVE_FREQ \n DESCRIPTION: How often to save snapshots for unsteady problems.*/
   addUnsignedShortOption("ROM_SAVE_FREQ", rom_save_freq, 1);
 
+  /*!\brief LIBROM_ONLINE \n DESCRIPTION: Use a POD basis (read from LIBROM_BASE_FILENAME) to project the Newton steps of the flow solver.*/
+  addEnumOption("LIBROM_ONLINE", Kind_ROM_Online, ROM_Online_Map, ROM_ONLINE::NONE);
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -3006,7 +3383,8 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
     if (TokenizeString(text_line, option_name, option_value)) {
       /*--- See if it's a python option ---*/
 
-      if (option_map.find(option_name) == option_map.end()) {
+      const auto option = option_map.find(option_name);
+      if (option == option_map.end()) {
           string newString;
           newString.append("Line " + to_string(line_count)  + " " + option_name);
           newString.append(": invalid option name");
@@ -3042,7 +3420,8 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
             size_t maxScore = 0;
             for (auto& candidate : option_map) {
               auto score = countMatchChars(candidate.first);
-              if (score > maxScore) {
+              /*--- Ties are resolved alphabetically, the map is not sorted. ---*/
+              if (score > maxScore || (score == maxScore && score > 0 && candidate.first < match)) {
                 maxScore = score;
                 match = candidate.first;
               }
@@ -3077,7 +3456,7 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
 
       /*--- Set the value and check error ---*/
 
-      string out = option_map[option_name]->SetValue(option_value);
+      string out = option->second->SetValue(option_value);
       if (out.compare("") != 0) {
         /*--- valid option, but deprecated value ---*/
         if (!option_name.compare("KIND_TURB_MODEL")) {
@@ -3112,15 +3491,15 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
 
 void CConfig::SetDefaultFromConfig(CConfig *config){
 
-  map<string, bool> noInheritance = {{"SCREEN_OUTPUT", true},{"HISTORY_OUTPUT", true}};
+  const auto NoInheritance = [](const string& name) { return name == "SCREEN_OUTPUT" || name == "HISTORY_OUTPUT"; };
 
-  map<string, bool>::iterator iter = all_options.begin(), curr_iter;
-
-  while (iter != all_options.end()){
-    curr_iter = iter++;
-    if (!config->option_map[curr_iter->first]->GetValue().empty() && !noInheritance[curr_iter->first]){
-      option_map[curr_iter->first]->SetValue(config->option_map[curr_iter->first]->GetValue());
-      all_options.erase(curr_iter);
+  for (auto iter = all_options.begin(); iter != all_options.end();) {
+    const auto& value = config->option_map.at(iter->first)->GetValue();
+    if (!value.empty() && !NoInheritance(iter->first)) {
+      option_map.at(iter->first)->SetValue(value);
+      iter = all_options.erase(iter);
+    } else {
+      ++iter;
     }
   }
 }
@@ -3129,9 +3508,9 @@ void CConfig::SetDefault(){
 
   /*--- Set the default values for all of the options that weren't set ---*/
 
-  for (auto iter = all_options.begin(); iter != all_options.end(); ++iter) {
-    if (option_map[iter->first]->GetValue().empty())
-      option_map[iter->first]->SetDefault();
+  for (const auto& unset : all_options) {
+    auto* option = option_map.at(unset.first);
+    if (option->GetValue().empty()) option->SetDefault();
   }
 }
 
@@ -3164,7 +3543,8 @@ bool CConfig::SetRunTime_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
     if (TokenizeString(text_line, option_name, option_value)) {
 
-      if (option_map.find(option_name) == option_map.end()) {
+      const auto option = option_map.find(option_name);
+      if (option == option_map.end()) {
 
         /*--- See if it's a python option ---*/
 
@@ -3196,7 +3576,7 @@ bool CConfig::SetRunTime_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
       /*--- Set the value and check error ---*/
 
-      string out = option_map[option_name]->SetValue(option_value);
+      string out = option->second->SetValue(option_value);
       if (out.compare("") != 0) {
         errorString.append(out);
         errorString.append("\n");
@@ -3397,11 +3777,70 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   }
 #endif
 
+  /*--- XDMF files store their data in HDF5, which is built together with CGNS. ---*/
+#ifndef HAVE_HDF5
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
+    if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::XDMF ||
+        VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::SURFACE_XDMF) {
+      SU2_MPI::Error(string("XDMF file requested in option OUTPUT_FILES but SU2 was built without HDF5 (CGNS) support.\n"),CURRENT_FUNCTION);
+    }
+  }
+#endif
+#ifndef HAVE_ADIOS2
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
+    if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::ADIOS2) {
+      SU2_MPI::Error(string("ADIOS2 output requested in option OUTPUT_FILES but SU2 was built without ADIOS2 support.\n"),CURRENT_FUNCTION);
+    }
+  }
+#endif
+#ifndef HAVE_PRECICE
+  if (Precice_Coupling != PRECICE_COUPLING::NONE) {
+    SU2_MPI::Error("PRECICE_COUPLING requested but SU2 was built without preCICE support (-Denable-precice=true).",
+                   CURRENT_FUNCTION);
+  }
+#endif
+  if (Precice_Coupling != PRECICE_COUPLING::NONE) {
+    if (!Time_Domain) SU2_MPI::Error("preCICE coupling requires TIME_DOMAIN= YES.", CURRENT_FUNCTION);
+    if (nMarker_Precice == 0) {
+      SU2_MPI::Error("preCICE coupling requires at least one MARKER_PRECICE.", CURRENT_FUNCTION);
+    }
+  }
+  if (Parareal_Slices > 1) {
+    if (!Time_Domain || Multizone_Problem) {
+      SU2_MPI::Error("PARAREAL_SLICES requires a single-zone problem with TIME_DOMAIN= YES.", CURRENT_FUNCTION);
+    }
+#ifdef HAVE_MPI
+    /*--- The driver splits the ranks into contiguous groups, one per slice, each writes its own history. ---*/
+    int worldRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+    const int iSlice = worldRank / SU2_MPI::GetSize();
+    if (iSlice > 0) Conv_FileName += "_slice" + to_string(iSlice);
+#else
+    SU2_MPI::Error("PARAREAL_SLICES requires SU2 built with MPI.", CURRENT_FUNCTION);
+#endif
+  }
+  if (XDMF_Compression > 9) {
+    SU2_MPI::Error("XDMF_COMPRESSION_LEVEL must be between 0 and 9.", CURRENT_FUNCTION);
+  }
+
   /*--- Check if CoolProp is used with non-dimensionalization. ---*/
   if (Kind_FluidModel == COOLPROP && Ref_NonDim != DIMENSIONAL) {
     SU2_MPI::Error("CoolProp can not be used with non-dimensionalization.", CURRENT_FUNCTION);
   }
 
+  if (Tabulate_FluidModel) {
+    if (Kind_FluidModel != VW_GAS && Kind_FluidModel != PR_GAS && Kind_FluidModel != COOLPROP) {
+      SU2_MPI::Error("TABULATE_FLUID_MODEL is only available for VW_GAS, PR_GAS, and COOLPROP.", CURRENT_FUNCTION);
+    }
+    if (Tabulation_Density_Range[0] <= 0 || Tabulation_Density_Range[1] <= Tabulation_Density_Range[0] ||
+        Tabulation_Temperature_Range[0] <= 0 || Tabulation_Temperature_Range[1] <= Tabulation_Temperature_Range[0]) {
+      SU2_MPI::Error("TABULATION_DENSITY_RANGE and TABULATION_TEMPERATURE_RANGE must be positive and increasing.", CURRENT_FUNCTION);
+    }
+    if (Tabulation_Size[0] < 4 || Tabulation_Size[1] < 4) {
+      SU2_MPI::Error("TABULATION_SIZE must be at least 4 in each direction.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- STL_BINARY output not implemented yet, but already a value in option_structure.hpp---*/
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
     if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::STL_BINARY){
@@ -3687,6 +4126,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
   }
 
+  if (Batch_Objectives_Disc && (Time_Domain || Multizone_Problem)) {
+    SU2_MPI::Error("BATCH_OBJECTIVES_DISC is only available for steady single-zone problems.", CURRENT_FUNCTION);
+  }
+
   /*--- Check for unsteady problem ---*/
 
   if ((TimeMarching == TIME_MARCHING::TIME_STEPPING ||
@@ -3737,6 +4180,29 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (Time_Domain && !GetWrt_Restart_Overwrite()){
     SU2_MPI::Error("Appending iterations to the filename (WRT_RESTART_OVERWRITE=NO) is incompatible with transient problems.", CURRENT_FUNCTION);
   }
+  if (GetRestart_Time_Series()) {
+    if (!Read_Binary_Restart)
+      SU2_MPI::Error("RESTART_TIME_SERIES requires binary restart files (READ_BINARY_RESTART= YES).", CURRENT_FUNCTION);
+    if (GetFEMSolver())
+      SU2_MPI::Error("RESTART_TIME_SERIES is not available for the FEM (DG) solvers.", CURRENT_FUNCTION);
+    if (Restart_KeyFrame_Interval == 0)
+      SU2_MPI::Error("RESTART_KEYFRAME_INTERVAL must be at least 1.", CURRENT_FUNCTION);
+  }
+  if (GetSampling()) {
+    if (GetFEMSolver())
+      SU2_MPI::Error("Sampling (SAMPLE_*) is not available for the FEM (DG) solvers.", CURRENT_FUNCTION);
+    if (nSample_Fields == 0)
+      SU2_MPI::Error("SAMPLE_FIELDS must list the volume output fields to sample.", CURRENT_FUNCTION);
+    if (Sample_Frequency == 0)
+      SU2_MPI::Error("SAMPLE_FREQUENCY must be at least 1.", CURRENT_FUNCTION);
+  }
+  if (TimeStatistics_Phases > 0 && TimeStatistics_Period < TimeStatistics_Phases) {
+    SU2_MPI::Error("TIME_STATISTICS_PERIOD must be at least TIME_STATISTICS_PHASES time iterations.", CURRENT_FUNCTION);
+  }
+  for (unsigned short iFreq = 0; iFreq < nTimeStatistics_Frequencies; iFreq++) {
+    if (TimeStatistics_Frequencies[iFreq] <= 0.0)
+      SU2_MPI::Error("TIME_STATISTICS_FREQUENCIES must be positive.", CURRENT_FUNCTION);
+  }
   if (Time_Domain && !GetWrt_Surface_Overwrite()){
     SU2_MPI::Error("Appending iterations to the filename (WRT_SURFACE_OVERWRITE=NO) is incompatible with transient problems.", CURRENT_FUNCTION);
   }
@@ -3791,6 +4257,19 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
   }
 
+  if (DiscreteAdjoint && (Kind_SpaceIteScheme_FEA == STRUCT_SPACE_ITE::BFGS || FEA_Tangent_Reuse > 0)) {
+    SU2_MPI::Error("BFGS and NONLINEAR_FEM_TANGENT_REUSE are not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
+  if (Modal_Superposition) {
+    if (Kind_Struct_Solver != STRUCT_DEFORMATION::SMALL)
+      SU2_MPI::Error("MODAL_SUPERPOSITION requires GEOMETRIC_CONDITIONS= SMALL_DEFORMATIONS.", CURRENT_FUNCTION);
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("MODAL_SUPERPOSITION is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+    if (nModes_FEA == 0)
+      SU2_MPI::Error("MODAL_NUMBER_MODES must be positive.", CURRENT_FUNCTION);
+  }
+
   Radiation = (Kind_Radiation != RADIATION_MODEL::NONE);
 
   /*--- Check for unsupported features. ---*/
@@ -4072,6 +4551,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   }
 
 
+  if (ZoneUpdateFreq == 0) {
+    SU2_MPI::Error("ZONE_UPDATE_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
+
   if ((Multizone_Problem || Time_Domain) && OptionIsSet("ITER")){
     SU2_MPI::Error("ITER must not be used when running multizone and/or unsteady problems.\n"
                    "Use TIME_ITER, OUTER_ITER or INNER_ITER to specify number of time iterations,\n"
@@ -4638,25 +5121,69 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
      performance in the matrix multiplications. */
   sizeMatMulPadding = byteAlignmentMatMul/sizeof(passivedouble);
 
+  /* The device kernels of the DG-FEM volume residual are only implemented
+     for static 3D grids, an ideal gas, and without source terms. */
+  if (FEM_DG_GPU) {
+#ifndef HAVE_CUDA
+    SU2_MPI::Error("FEM_DG_GPU requires CUDA support (meson.py ... -Denable-cuda=true ...).", CURRENT_FUNCTION);
+#endif
+    if (Kind_Solver != MAIN_SOLVER::FEM_EULER || val_nDim != 3)
+      SU2_MPI::Error("FEM_DG_GPU is only available for 3D FEM_EULER problems.", CURRENT_FUNCTION);
+    if ((Kind_FluidModel != STANDARD_AIR && Kind_FluidModel != IDEAL_GAS) || Tabulate_FluidModel)
+      SU2_MPI::Error("FEM_DG_GPU requires FLUID_MODEL= STANDARD_AIR or IDEAL_GAS.", CURRENT_FUNCTION);
+    if (Body_Force || GetDynamic_Grid() || Kind_Verification_Solution != VERIFICATION_SOLUTION::NONE)
+      SU2_MPI::Error("FEM_DG_GPU is not compatible with body forces, dynamic grids, or verification solutions.",
+                     CURRENT_FUNCTION);
+  }
+
   /* Correct the number of time levels for time accurate local time
      stepping, if needed.  */
   if (nLevels_TimeAccurateLTS == 0)  nLevels_TimeAccurateLTS =  1;
   if (nLevels_TimeAccurateLTS  > 15) nLevels_TimeAccurateLTS = 15;
 
   /* Check that no time accurate local time stepping is specified for time
-     integration schemes other than ADER. */
-  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && nLevels_TimeAccurateLTS != 1) {
+     integration schemes other than ADER, or the explicit Euler scheme of the
+     compressible finite volume solvers (multirate time stepping). */
+  const bool multirateFVM = (Kind_Solver == MAIN_SOLVER::EULER || Kind_Solver == MAIN_SOLVER::NAVIER_STOKES) &&
+                            (Kind_TimeIntScheme_Flow == EULER_EXPLICIT) &&
+                            (TimeMarching == TIME_MARCHING::TIME_STEPPING) && !DiscreteAdjoint && !ContinuousAdjoint;
+
+  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && !multirateFVM && nLevels_TimeAccurateLTS != 1) {
 
     if (rank==MASTER_NODE) {
       cout << endl << "WARNING: "
            << nLevels_TimeAccurateLTS << " levels specified for time accurate local time stepping." << endl
-           << "Time accurate local time stepping is only possible for ADER, hence this option is not used." << endl
+           << "Time accurate local time stepping is only possible for ADER, or for the compressible finite volume" << endl
+           << "solvers with TIME_DISCRE_FLOW= EULER_EXPLICIT, hence this option is not used." << endl
            << endl;
     }
 
     nLevels_TimeAccurateLTS = 1;
   }
 
+  if (multirateFVM && nLevels_TimeAccurateLTS != 1 && Unst_CFL == 0.0) {
+    SU2_MPI::Error("The time levels of the multirate time stepping are based on the local time steps,\n"
+                   "UNST_CFL_NUMBER must be specified.", CURRENT_FUNCTION);
+  }
+
+  if (Kind_TimeIntScheme_FEM_Flow == EULER_IMPLICIT) {
+    if ((nOrderBDF_DG < 1) || (nOrderBDF_DG > 2))
+      SU2_MPI::Error("BDF_ORDER_DG must be 1 or 2.", CURRENT_FUNCTION);
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("TIME_DISCRE_FEM_FLOW= EULER_IMPLICIT is not available for the discrete adjoint.",
+                     CURRENT_FUNCTION);
+  }
+
+  if (nPMGLevels_DG > 0) {
+    if (Kind_TimeIntScheme_FEM_Flow != RUNGE_KUTTA_EXPLICIT)
+      SU2_MPI::Error("PMG_LEVELS_DG requires TIME_DISCRE_FEM_FLOW= RUNGE-KUTTA_EXPLICIT.", CURRENT_FUNCTION);
+    if (TimeMarching != TIME_MARCHING::STEADY)
+      SU2_MPI::Error("The p-multigrid cycle of the DG-FEM solver is only available for steady problems.",
+                     CURRENT_FUNCTION);
+    if (nPMGPreSmooth_DG + nPMGPostSmooth_DG == 0)
+      SU2_MPI::Error("PMG_PRE_SMOOTH_DG and PMG_POST_SMOOTH_DG cannot both be zero.", CURRENT_FUNCTION);
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     TimeMarching = TIME_MARCHING::TIME_STEPPING;  // Only time stepping for ADER.
@@ -4835,6 +5362,54 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   if (Fixed_CL_Mode) Update_AoA = false;
 
+  if (NewtonKrylov && NK_ForwardAD) {
+#ifndef CODI_FORWARD_TYPE
+    if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
+      SU2_MPI::Error("NEWTON_KRYLOV_FORWARD_AD= YES requires forward AD support.\n"
+                     "Please use SU2_CFD_DIRECTDIFF (meson.py ... -Denable-directdiff=true ...).",
+                     CURRENT_FUNCTION);
+    }
+#endif
+    if (DirectDiff != NO_DERIVATIVE) {
+      SU2_MPI::Error("NEWTON_KRYLOV_FORWARD_AD is not compatible with DIRECT_DIFF.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The residual reductions are packed by the single-zone fluid iteration. ---*/
+  if (DiscreteAdjoint || ContinuousAdjoint) Deferred_Res_Reduction = false;
+
+  if (Deferred_Res_Reduction && Multizone_Problem) {
+    SU2_MPI::Error("DEFERRED_RESIDUAL_REDUCTION is only available for single-zone problems.", CURRENT_FUNCTION);
+  }
+
+  /*--- The primal quasi-Newton acceleration is for the steady single-zone fixed-point iterations. ---*/
+  if (DiscreteAdjoint || ContinuousAdjoint) QuasiNewtonPrimal = false;
+
+  if (QuasiNewtonPrimal) {
+    if (Time_Domain || Multizone_Problem) {
+      SU2_MPI::Error("QUASI_NEWTON_PRIMAL is only available for steady single-zone problems.", CURRENT_FUNCTION);
+    }
+    if (nQuasiNewtonSamples < 2) {
+      SU2_MPI::Error("QUASI_NEWTON_PRIMAL requires QUASI_NEWTON_NUM_SAMPLES > 1.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The adjoint solvers do not use the NK integration of the flow. ---*/
+  if (DiscreteAdjoint || ContinuousAdjoint) NK_CoupledTurb = false;
+
+  if (NK_CoupledTurb) {
+    if (!NewtonKrylov || Kind_Turb_Model == TURB_MODEL::NONE) {
+      SU2_MPI::Error("NEWTON_KRYLOV_COUPLED_TURB requires NEWTON_KRYLOV= YES and a turbulence model.", CURRENT_FUNCTION);
+    }
+    if (Kind_Trans_Model != TURB_TRANS_MODEL::NONE) {
+      SU2_MPI::Error("NEWTON_KRYLOV_COUPLED_TURB is not compatible with transition models.", CURRENT_FUNCTION);
+    }
+    if (Kind_TimeIntScheme_Flow == EULER_IMPLICIT && Kind_TimeIntScheme_Turb != EULER_IMPLICIT) {
+      SU2_MPI::Error("NEWTON_KRYLOV_COUPLED_TURB with TIME_DISCRE_FLOW= EULER_IMPLICIT requires\n"
+                     "TIME_DISCRE_TURB= EULER_IMPLICIT (the Jacobians are used for preconditioning).", CURRENT_FUNCTION);
+    }
+  }
+
   if (DirectDiff != NO_DERIVATIVE) {
 #ifndef CODI_FORWARD_TYPE
     if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
@@ -5182,7 +5757,7 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     Kind_ConductivityModel_Turb = CONDUCTIVITYMODEL_TURB::NONE;
   }
 
-  /* Set a default for the size of the RECTANGLE / BOX grid sizes. */
+  /* Set a default for the size of the RECTANGLE / BOX / SYNTHETIC grid sizes. */
 
   if (nMesh_Box_Size == 0) {
     nMesh_Box_Size = 3;
@@ -5204,6 +5779,87 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /* A block-Jacobi factorization is not a direct solver. */
+
+  if (pastix_blocks != PASTIX_BLOCKS::GLOBAL &&
+      (isPastix(Kind_Linear_Solver) || isPastix(Kind_DiscAdj_Linear_Solver) || isPastix(Kind_Deform_Linear_Solver))) {
+    SU2_MPI::Error("PASTIX_BLOCKS= RANK or NODE can only be used with the PaStiX preconditioners.", CURRENT_FUNCTION);
+  }
+
+  /* The incomplete Cholesky preconditioner is symmetric, and it only supports the symmetric solver. */
+
+  if ((Kind_Linear_Solver_Prec == IC && Kind_Linear_Solver != CONJUGATE_GRADIENT) ||
+      (Kind_DiscAdj_Linear_Prec == IC && Kind_DiscAdj_Linear_Solver != CONJUGATE_GRADIENT) ||
+      (Kind_Deform_Linear_Solver_Prec == IC && Kind_Deform_Linear_Solver != CONJUGATE_GRADIENT) ||
+      (Kind_Grad_Linear_Solver_Prec == IC && Kind_Grad_Linear_Solver != CONJUGATE_GRADIENT)) {
+    SU2_MPI::Error("The IC preconditioner can only be used with the CONJUGATE_GRADIENT linear solver.",
+                   CURRENT_FUNCTION);
+  }
+
+  if (Mesh_Out_FileFormat != SU2 && Mesh_Out_FileFormat != SU2_BINARY) {
+    SU2_MPI::Error("MESH_OUT_FORMAT must be SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
+
+  if (nLinear_Solver_GPU > 0) {
+#ifndef HAVE_CUDA
+    SU2_MPI::Error("LINEAR_SOLVER_GPU requires CUDA support (meson.py ... -Denable-cuda=true ...).", CURRENT_FUNCTION);
+#endif
+  }
+
+  /*--- The single precision copy of the Jacobian is only used to solve the primal system, the matrices used by
+   * the discrete adjoint or as preconditioners of the Newton-Krylov method must keep their precision. ---*/
+
+  if (nLinear_Solver_Single_Prec > 0) {
+#ifndef USE_SINGLE_PRECISION_SYSTEMS
+    if (rank == MASTER_NODE)
+      cout << "WARNING: LINEAR_SOLVER_SINGLE_PREC has no effect in mixed precision or forward AD builds." << endl;
+    nLinear_Solver_Single_Prec = 0;
+#endif
+    if (DiscreteAdjoint) {
+      SU2_MPI::Error("LINEAR_SOLVER_SINGLE_PREC is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+    }
+    if (NewtonKrylov && GetLinear_Solver_Single_Prec(LINEAR_SYSTEM::FLOW)) {
+      SU2_MPI::Error("LINEAR_SOLVER_SINGLE_PREC= FLOW is not compatible with NEWTON_KRYLOV.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (MUSCL_Flow_Single_Prec) {
+#ifndef USE_SINGLE_PRECISION_RECONSTRUCTION
+    if (rank == MASTER_NODE) cout << "WARNING: MUSCL_FLOW_SINGLE_PREC has no effect in AD builds." << endl;
+    MUSCL_Flow_Single_Prec = false;
+#endif
+  }
+
+  if (Edge_Geometry_Cache) {
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+    if (rank == MASTER_NODE) cout << "WARNING: EDGE_GEOMETRY_CACHE has no effect in AD builds." << endl;
+    Edge_Geometry_Cache = false;
+#endif
+    if (GetDynamic_Grid() || Deform_Mesh) {
+      SU2_MPI::Error("EDGE_GEOMETRY_CACHE is not compatible with moving or deforming grids.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (Transport_Properties_Tol < 0.0) {
+    SU2_MPI::Error("TRANSPORT_PROPERTIES_TOLERANCE must be non-negative.", CURRENT_FUNCTION);
+  }
+  if (Transport_Properties_Tol > 0.0 && (DiscreteAdjoint || DirectDiff != NO_DERIVATIVE)) {
+    SU2_MPI::Error("TRANSPORT_PROPERTIES_TOLERANCE > 0 is not differentiable.", CURRENT_FUNCTION);
+  }
+
+  if (Distributed_WallDistance && (DiscreteAdjoint || DirectDiff != NO_DERIVATIVE)) {
+    SU2_MPI::Error("DISTRIBUTED_WALL_DISTANCE is not differentiable (the remote distances are passive).", CURRENT_FUNCTION);
+  }
+
+  if (Kind_BGS_RelaxMethod == BGS_RELAXATION::QUASI_NEWTON) {
+    if (nQuasiNewtonSamples < 2) {
+      SU2_MPI::Error("BGS_RELAXATION= QUASI_NEWTON requires QUASI_NEWTON_NUM_SAMPLES > 1.", CURRENT_FUNCTION);
+    }
+    if (DiscreteAdjoint || DirectDiff != NO_DERIVATIVE) {
+      SU2_MPI::Error("BGS_RELAXATION= QUASI_NEWTON is not differentiable, use AITKEN_DYNAMIC.", CURRENT_FUNCTION);
+    }
+  }
+
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -5234,6 +5890,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
         Iter_Avg_Objective = nTimeIter;
       }
 
+      /*--- By default, recomputed primal time steps use the same number of inner iterations as the adjoint. ---*/
+
+      if (Unst_Adjoint_PrimalIter == 0) Unst_Adjoint_PrimalIter = nInnerIter;
+
+      if (Unst_Adjoint_Checkpoint_Tol < 0 || Unst_Adjoint_Checkpoint_Tol >= 0.5) {
+        SU2_MPI::Error("UNST_ADJOINT_CHECKPOINT_TOL must be in [0, 0.5).", CURRENT_FUNCTION);
+      }
+
     }
 
     /*--- Note that this is deliberately done at the end of this routine! ---*/
@@ -5330,6 +5994,61 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                    CURRENT_FUNCTION);
   }
 
+  if (Kind_Rosenbrock != ROSENBROCK_SCHEME::NONE &&
+      (TimeMarching != TIME_MARCHING::TIME_STEPPING || Kind_TimeIntScheme_Flow != EULER_IMPLICIT ||
+       !GetFluidProblem() || DiscreteAdjoint || ContinuousAdjoint)) {
+    SU2_MPI::Error("ROSENBROCK_SCHEME requires TIME_MARCHING= TIME_STEPPING and TIME_DISCRE_FLOW= EULER_IMPLICIT,\n"
+                   "for the primal finite volume flow solvers.", CURRENT_FUNCTION);
+  }
+
+  if (Jacobian_Lag == 0) Jacobian_Lag = 1;
+
+  if (Jacobian_Lag > 1) {
+    const bool compressible = (Kind_Solver == MAIN_SOLVER::EULER || Kind_Solver == MAIN_SOLVER::NAVIER_STOKES ||
+                               Kind_Solver == MAIN_SOLVER::RANS);
+    if (!compressible || Kind_TimeIntScheme_Flow != EULER_IMPLICIT || !UseVectorization || NewtonKrylov ||
+        DiscreteAdjoint || ContinuousAdjoint) {
+      SU2_MPI::Error("JACOBIAN_LAG > 1 requires TIME_DISCRE_FLOW= EULER_IMPLICIT and USE_VECTORIZATION= YES,\n"
+                     "for the primal compressible flow solvers (without NEWTON_KRYLOV).", CURRENT_FUNCTION);
+    }
+    if (Jacobian_Lag_CFL_Factor < 1.0) {
+      SU2_MPI::Error("JACOBIAN_LAG_CFL_FACTOR must be at least 1.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (Kind_ROM_Online != ROM_ONLINE::NONE) {
+#ifndef HAVE_LIBROM
+    SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
+#endif
+    if (!GetFluidProblem() || Kind_TimeIntScheme_Flow != EULER_IMPLICIT || Kind_Rosenbrock != ROSENBROCK_SCHEME::NONE ||
+        DiscreteAdjoint || ContinuousAdjoint) {
+      SU2_MPI::Error("LIBROM_ONLINE requires TIME_DISCRE_FLOW= EULER_IMPLICIT (without ROSENBROCK_SCHEME),\n"
+                     "for the primal finite volume flow solvers.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The recording of the adjoint must contain the radiation solve. ---*/
+
+  if (Rad_Freq == 0 || DiscreteAdjoint) Rad_Freq = 1;
+
+  if (nSol_Batch_Files > 0 && (Time_Domain || Multizone_Problem || TimeMarching == TIME_MARCHING::HARMONIC_BALANCE ||
+                               FSI_Problem || Kind_Solver == MAIN_SOLVER::FEM_EULER ||
+                               Kind_Solver == MAIN_SOLVER::FEM_NAVIER_STOKES || Kind_Solver == MAIN_SOLVER::FEM_RANS ||
+                               Kind_Solver == MAIN_SOLVER::FEM_LES || Restart_Time_Series)) {
+    SU2_MPI::Error("SOLUTION_FILENAME_LIST is only available for steady single zone finite volume solutions,\n"
+                   "use TIME_DOMAIN= NO to convert the snapshots of an unsteady simulation.", CURRENT_FUNCTION);
+  }
+
+  /*--- Consistency of the mesh adaptation marking. ---*/
+
+  if (Kind_Adapt_Indicator != ADAPT_INDICATOR::NONE) {
+    if (Adapt_Refine_Fraction < 0.0 || Adapt_Coarsen_Fraction < 0.0 ||
+        Adapt_Refine_Fraction + Adapt_Coarsen_Fraction > 1.0) {
+      SU2_MPI::Error("ADAPT_REFINE_FRACTION and ADAPT_COARSEN_FRACTION must be positive and add up to at most 1.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
   /* Protect against using CFL adaption for non-flow or certain
    unsteady flow problems. */
 
@@ -5436,6 +6155,26 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
           "to be equal to the number of entries of SPECIES_INIT +1",
           CURRENT_FUNCTION);
 
+    /*--- The shared scalar Jacobian is only assembled by the species transport solver, without the boundaries
+     *    that operate on the full blocks of the Jacobian. It is the Jacobian of the first species, which is
+     *    only exact for all of them if they have the same diffusivity. ---*/
+    if (Species_Segregated_Solve) {
+      if (Kind_Species_Model != SPECIES_MODEL::SPECIES_TRANSPORT)
+        SU2_MPI::Error("SPECIES_SEGREGATED_SOLVE= YES is only available for SPECIES_MODEL= SPECIES_TRANSPORT.", CURRENT_FUNCTION);
+      if (nMarker_PerBound > 0 || nMarker_Fluid_InterfaceBound > 0)
+        SU2_MPI::Error("SPECIES_SEGREGATED_SOLVE= YES is not compatible with periodic or fluid interface markers.", CURRENT_FUNCTION);
+
+      bool sameDiffusivity = Kind_Diffusivity_Model != DIFFUSIVITYMODEL::FLAMELET;
+      if (Kind_Diffusivity_Model == DIFFUSIVITYMODEL::CONSTANT_LEWIS) {
+        for (auto iSpecies = 1u; iSpecies < nSpecies_Init; ++iSpecies)
+          sameDiffusivity &= (Constant_Lewis_Number[iSpecies] == Constant_Lewis_Number[0]);
+      }
+      if (!sameDiffusivity)
+        SU2_MPI::Error("SPECIES_SEGREGATED_SOLVE= YES requires all species to have the same diffusivity,\n"
+                       "the FLAMELET diffusivity model, or different CONSTANT_LEWIS_NUMBER values, are not supported.",
+                       CURRENT_FUNCTION);
+    }
+
     // Helper function that checks scalar variable bounds,
     auto checkScalarBounds = [&](su2double scalar, const string& name, su2double lowerBound, su2double upperBound) {
       if (scalar < lowerBound || scalar > upperBound)
@@ -6928,12 +7667,16 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case FGMRES_CGS:
+            case PIPELINED_FGMRES:
+            case RECYCLED_FGMRES:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG: cout << "Using an AMG preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
@@ -6942,6 +7685,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An AMG"; break;
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
@@ -6974,7 +7718,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case FGMRES_CGS: case PIPELINED_FGMRES: case RECYCLED_FGMRES:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -7024,6 +7768,15 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
 
+        case EULER_IMPLICIT:
+          if(TimeMarching == TIME_MARCHING::TIME_STEPPING)
+            cout << "Implicit BDF" << nOrderBDF_DG << " method for the flow equations." << endl;
+          else
+            cout << "Implicit Euler method (local time stepping) for the flow equations." << endl;
+          cout << "Jacobian-free Newton-Krylov (FGMRES) with at most " << nNewtonIter_DG
+               << " Newton iterations per time step." << endl;
+          break;
+
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
             cout << "ADER-DG for the flow equations with global time stepping." << endl;
@@ -8296,7 +9049,7 @@ string CConfig::GetMultiInstance_HistoryFileName(string val_filename, int val_iI
 
 string CConfig::GetObjFunc_Extension(string val_filename) const {
 
-  string AdjExt, Filename = std::move(val_filename);
+  string Filename = std::move(val_filename);
 
   if (ContinuousAdjoint || DiscreteAdjoint) {
 
@@ -8305,54 +9058,7 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
     unsigned short lastindex = Filename.find_last_of('.');
     Filename = Filename.substr(0, lastindex);
 
-    if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
-        case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
-        case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
-        case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
-        case INVERSE_DESIGN_PRESSURE:     AdjExt = "_invpress"; break;
-        case INVERSE_DESIGN_HEATFLUX:     AdjExt = "_invheat";  break;
-        case MOMENT_X_COEFFICIENT:        AdjExt = "_cmx";      break;
-        case MOMENT_Y_COEFFICIENT:        AdjExt = "_cmy";      break;
-        case MOMENT_Z_COEFFICIENT:        AdjExt = "_cmz";      break;
-        case EFFICIENCY:                  AdjExt = "_eff";      break;
-        case EQUIVALENT_AREA:             AdjExt = "_ea";       break;
-        case NEARFIELD_PRESSURE:          AdjExt = "_nfp";      break;
-        case FORCE_X_COEFFICIENT:         AdjExt = "_cfx";      break;
-        case FORCE_Y_COEFFICIENT:         AdjExt = "_cfy";      break;
-        case FORCE_Z_COEFFICIENT:         AdjExt = "_cfz";      break;
-        case THRUST_COEFFICIENT:          AdjExt = "_ct";       break;
-        case TORQUE_COEFFICIENT:          AdjExt = "_cq";       break;
-        case TOTAL_HEATFLUX:              AdjExt = "_totheat";  break;
-        case MAXIMUM_HEATFLUX:            AdjExt = "_maxheat";  break;
-        case AVG_TEMPERATURE:             AdjExt = "_avtp";     break;
-        case FIGURE_OF_MERIT:             AdjExt = "_merit";    break;
-        case BUFFET_SENSOR:               AdjExt = "_buffet";   break;
-        case SURFACE_TOTAL_PRESSURE:      AdjExt = "_pt";       break;
-        case SURFACE_STATIC_PRESSURE:     AdjExt = "_pe";       break;
-        case SURFACE_STATIC_TEMPERATURE:  AdjExt = "_T";        break;
-        case SURFACE_MASSFLOW:            AdjExt = "_mfr";      break;
-        case SURFACE_UNIFORMITY:          AdjExt = "_uniform";  break;
-        case SURFACE_SECONDARY:           AdjExt = "_second";   break;
-        case SURFACE_MOM_DISTORTION:      AdjExt = "_distort";  break;
-        case SURFACE_SECOND_OVER_UNIFORM: AdjExt = "_sou";      break;
-        case SURFACE_PRESSURE_DROP:       AdjExt = "_dp";       break;
-        case SURFACE_SPECIES_0:           AdjExt = "_avgspec0"; break;
-        case SURFACE_SPECIES_VARIANCE:    AdjExt = "_specvar";  break;
-        case SURFACE_MACH:                AdjExt = "_mach";     break;
-        case CUSTOM_OBJFUNC:              AdjExt = "_custom";   break;
-        case REFERENCE_GEOMETRY:          AdjExt = "_refgeom";  break;
-        case REFERENCE_NODE:              AdjExt = "_refnode";  break;
-        case VOLUME_FRACTION:             AdjExt = "_volfrac";  break;
-        case TOPOL_DISCRETENESS:          AdjExt = "_topdisc";  break;
-        case TOPOL_COMPLIANCE:            AdjExt = "_topcomp";  break;
-        case STRESS_PENALTY:              AdjExt = "_stress";   break;
-      }
-    }
-    else{
-      AdjExt = "_combo";
-    }
-    Filename.append(AdjExt);
+    Filename.append(GetObjFunc_Suffix());
 
     /*--- Lastly, add the .dat extension ---*/
     Filename.append(".dat");
@@ -8362,6 +9068,67 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
   return Filename;
 }
 
+string CConfig::GetObjFunc_Suffix() const {
+
+  string AdjExt;
+  const bool batched = (Batch_ObjFunc >= 0 && Batch_ObjFunc < nObj);
+
+  if (nObj==1 || batched) {
+    const auto iObj = batched ? Batch_ObjFunc : 0;
+    switch (Kind_ObjFunc[iObj]) {
+      case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
+      case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
+      case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
+      case INVERSE_DESIGN_PRESSURE:     AdjExt = "_invpress"; break;
+      case INVERSE_DESIGN_HEATFLUX:     AdjExt = "_invheat";  break;
+      case MOMENT_X_COEFFICIENT:        AdjExt = "_cmx";      break;
+      case MOMENT_Y_COEFFICIENT:        AdjExt = "_cmy";      break;
+      case MOMENT_Z_COEFFICIENT:        AdjExt = "_cmz";      break;
+      case EFFICIENCY:                  AdjExt = "_eff";      break;
+      case EQUIVALENT_AREA:             AdjExt = "_ea";       break;
+      case NEARFIELD_PRESSURE:          AdjExt = "_nfp";      break;
+      case FORCE_X_COEFFICIENT:         AdjExt = "_cfx";      break;
+      case FORCE_Y_COEFFICIENT:         AdjExt = "_cfy";      break;
+      case FORCE_Z_COEFFICIENT:         AdjExt = "_cfz";      break;
+      case THRUST_COEFFICIENT:          AdjExt = "_ct";       break;
+      case TORQUE_COEFFICIENT:          AdjExt = "_cq";       break;
+      case TOTAL_HEATFLUX:              AdjExt = "_totheat";  break;
+      case MAXIMUM_HEATFLUX:            AdjExt = "_maxheat";  break;
+      case AVG_TEMPERATURE:             AdjExt = "_avtp";     break;
+      case FIGURE_OF_MERIT:             AdjExt = "_merit";    break;
+      case BUFFET_SENSOR:               AdjExt = "_buffet";   break;
+      case SURFACE_TOTAL_PRESSURE:      AdjExt = "_pt";       break;
+      case SURFACE_STATIC_PRESSURE:     AdjExt = "_pe";       break;
+      case SURFACE_STATIC_TEMPERATURE:  AdjExt = "_T";        break;
+      case SURFACE_MASSFLOW:            AdjExt = "_mfr";      break;
+      case SURFACE_UNIFORMITY:          AdjExt = "_uniform";  break;
+      case SURFACE_SECONDARY:           AdjExt = "_second";   break;
+      case SURFACE_MOM_DISTORTION:      AdjExt = "_distort";  break;
+      case SURFACE_SECOND_OVER_UNIFORM: AdjExt = "_sou";      break;
+      case SURFACE_PRESSURE_DROP:       AdjExt = "_dp";       break;
+      case SURFACE_SPECIES_0:           AdjExt = "_avgspec0"; break;
+      case SURFACE_SPECIES_VARIANCE:    AdjExt = "_specvar";  break;
+      case SURFACE_MACH:                AdjExt = "_mach";     break;
+      case CUSTOM_OBJFUNC:              AdjExt = "_custom";   break;
+      case REFERENCE_GEOMETRY:          AdjExt = "_refgeom";  break;
+      case REFERENCE_NODE:              AdjExt = "_refnode";  break;
+      case VOLUME_FRACTION:             AdjExt = "_volfrac";  break;
+      case TOPOL_DISCRETENESS:          AdjExt = "_topdisc";  break;
+      case TOPOL_COMPLIANCE:            AdjExt = "_topcomp";  break;
+      case STRESS_PENALTY:              AdjExt = "_stress";   break;
+    }
+    /*--- Distinguish objectives of the same kind (e.g. on different markers). ---*/
+    if (batched && nObj > 1 && count(Kind_ObjFunc, Kind_ObjFunc + nObj, Kind_ObjFunc[iObj]) > 1) {
+      AdjExt.append(to_string(iObj));
+    }
+  }
+  else{
+    AdjExt = "_combo";
+  }
+
+  return AdjExt;
+}
+
 unsigned short CConfig::GetContainerPosition(unsigned short val_eqsystem) {
 
   switch (val_eqsystem) {
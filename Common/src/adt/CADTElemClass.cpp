@@ -61,6 +61,7 @@ CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coo
 #ifdef HAVE_MPI
 
   /* Parallel mode. Check whether a global or a local tree must be built. */
+  isGlobal = globalTree;
   if (globalTree) {
     /*--- The local grids are gathered on all ranks. For very large cases this
           could become a serious memory bottleneck and a parallel version may
@@ -158,6 +159,7 @@ CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coo
 
   /*--- Sequential mode. Copy the data from the arguments into the member
         variables and set the ranks to MASTER_NODE. ---*/
+  isGlobal = true;
   coorPoints = val_coor;
   elemConns = val_connElem;
   elemVTK_Type = val_VTKElem;
@@ -260,6 +262,22 @@ CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coo
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
+void CADTElemClass::GetBoundingBox(su2double* coorMin, su2double* coorMax) const {
+  for (unsigned short k = 0; k < nDim; ++k) {
+    coorMin[k] = numeric_limits<passivedouble>::max();
+    coorMax[k] = -numeric_limits<passivedouble>::max();
+  }
+
+  const unsigned long nElem = elemVTK_Type.size();
+  for (unsigned long i = 0; i < nElem; ++i) {
+    const su2double* BBox = BBoxCoor.data() + nDimADT * i;
+    for (unsigned short k = 0; k < nDim; ++k) {
+      coorMin[k] = min(coorMin[k], BBox[k]);
+      coorMax[k] = max(coorMax[k], BBox[nDim + k]);
+    }
+  }
+}
+
 bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& frontLeaves,
                                                     vector<unsigned long>& frontLeavesNew, const su2double* coor,
                                                     unsigned short& markerID, unsigned long& elemID, int& rankID,
@@ -340,7 +358,7 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
                                                  vector<unsigned long>& frontLeaves,
                                                  vector<unsigned long>& frontLeavesNew, const su2double* coor,
                                                  su2double& dist, unsigned short& markerID, unsigned long& elemID,
-                                                 int& rankID) const {
+                                                 int& rankID, unsigned long& nearest) const {
   const bool wasActive = AD::BeginPassive();
 
   /*----------------------------------------------------------------------------*/
@@ -364,6 +382,19 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
     dist += ds * ds;
   }
 
+  /*--- The distance to the initial guess is also guaranteed, and usually much smaller. ---*/
+  if (nearest < elemVTK_Type.size()) {
+    su2double dist2Guess;
+    Dist2ToElement(nearest, coor, dist2Guess);
+    if (dist2Guess <= dist) {
+      jj = nearest;
+      dist = dist2Guess;
+      markerID = localMarkers[jj];
+      elemID = localElemIDs[jj];
+      rankID = ranksOfElems[jj];
+    }
+  }
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -518,6 +549,8 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
 
   AD::EndPassive(wasActive);
 
+  nearest = jj;
+
   /* At the moment the square of the distance is stored in dist. Compute
      the correct value. */
   Dist2ToElement(jj, coor, dist);
@@ -237,3 +237,93 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
      Take the sqrt to obtain the correct value. */
   dist = sqrt(dist);
 }
+
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                                     vector<unsigned long>& frontLeavesNew, const su2double* coor,
+                                                     unsigned long nNodes, vector<su2double>& dist,
+                                                     vector<unsigned long>& pointID, vector<int>& rankID) const {
+  dist.clear();
+  pointID.clear();
+  rankID.clear();
+  if (isEmpty || nNodes == 0) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--- The candidates are kept in a max-heap of (distance squared, index), the
+        top of the heap is the search radius once nNodes candidates are found.
+        Unlike the single node search, only terminal children are considered,
+        as the central nodes of the leaves also appear as terminal children. ---*/
+
+  vector<pair<su2double, unsigned long> > heap;
+  heap.reserve(nNodes + 1);
+
+  auto squaredDistance = [&](unsigned long kk) {
+    const su2double* coorTarget = coorPoints.data() + nDimADT * kk;
+    su2double d2 = 0.0;
+    for (unsigned short l = 0; l < nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      d2 += ds * ds;
+    }
+    return d2;
+  };
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for (;;) {
+    frontLeavesNew.clear();
+
+    for (unsigned long i = 0; i < frontLeaves.size(); ++i) {
+      const unsigned long ll = frontLeaves[i];
+      for (unsigned short mm = 0; mm < 2; ++mm) {
+        const unsigned long kk = leaves[ll].children[mm];
+        const bool full = (heap.size() == nNodes);
+
+        if (leaves[ll].childrenAreTerminal[mm]) {
+          /*--- Child contains a node, it replaces the furthest candidate if closer. ---*/
+          const auto candidate = make_pair(squaredDistance(kk), kk);
+          if (full && !(candidate < heap.front())) continue;
+
+          /*--- A single point ADT has the same node as both children. ---*/
+          bool duplicate = false;
+          for (const auto& entry : heap) duplicate |= (entry.second == kk);
+          if (duplicate) continue;
+
+          if (full) {
+            pop_heap(heap.begin(), heap.end());
+            heap.pop_back();
+          }
+          heap.push_back(candidate);
+          push_heap(heap.begin(), heap.end());
+        } else {
+          /*--- Child contains a leaf, keep it if it may contain closer nodes. ---*/
+          su2double posDist = 0.0;
+          for (unsigned short l = 0; l < nDimADT; ++l) {
+            su2double ds = 0.0;
+            if (coor[l] < leaves[kk].xMin[l])
+              ds = coor[l] - leaves[kk].xMin[l];
+            else if (coor[l] > leaves[kk].xMax[l])
+              ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds * ds;
+          }
+          if (!full || posDist <= heap.front().first) frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if (frontLeaves.empty()) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  sort_heap(heap.begin(), heap.end());
+
+  for (const auto& entry : heap) {
+    /* Recompute the distance to get the correct dependency if we use AD. */
+    dist.push_back(sqrt(squaredDistance(entry.second)));
+    pointID.push_back(localPointIDs[entry.second]);
+    rankID.push_back(ranksOfPoints[entry.second]);
+  }
+}
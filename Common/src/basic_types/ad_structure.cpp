@@ -41,6 +41,11 @@ SU2_OMP(threadprivate(PreaccActive))
 
 bool PreaccEnabled = true;
 
+int PreaccNesting = 0;
+#ifdef HAVE_OPDI
+SU2_OMP(threadprivate(PreaccNesting))
+#endif
+
 codi::PreaccumulationHelper<su2double> PreaccHelper;
 #ifdef HAVE_OPDI
 SU2_OMP(threadprivate(PreaccHelper))
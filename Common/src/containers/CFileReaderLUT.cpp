@@ -52,12 +52,25 @@ void CFileReaderLUT::ReadRawLUT(const string& file_name) {
   bool eoConnectivity = false;
   bool eoHull = false;
 
-  file_stream.open(file_name.c_str(), ifstream::in);
+  file_stream.open(file_name.c_str(), ifstream::in | ifstream::binary);
 
   if (!file_stream.is_open()) {
     SU2_MPI::Error(string("There is no look-up-table file called ") + file_name, CURRENT_FUNCTION);
   }
 
+  /*--- Binary tables start with an identifier, which cannot be the start of an ASCII table. ---*/
+  const string identifier = BinaryIdentifier();
+  string file_start(identifier.size(), ' ');
+  file_stream.read(&file_start[0], file_start.size());
+  binary_format = (file_stream && file_start == identifier);
+  if (binary_format) {
+    ReadBinaryLUT(file_stream, file_name);
+    file_stream.close();
+    return;
+  }
+  file_stream.clear();
+  file_stream.seekg(0);
+
   /*--- Read header ---*/
   SkipToFlag(file_stream, line, "<Header>");
   table_dim = 2;
@@ -324,6 +337,78 @@ void CFileReaderLUT::ReadRawLUT(const string& file_name) {
   file_stream.close();
 }
 
+void CFileReaderLUT::ReadBinaryLUT(ifstream& file_stream, const string& file_name) {
+  /*--- Layout (native byte order): identifier, table dimension, number of levels, number of variables, version
+   * string, variable names, and for each level its z value and point, triangle and hull point counts. Then, for each
+   * level, the data (variable-major), the 0-based triangle connectivity, and the hull point indices.
+   * Strings are stored as their length followed by the characters, integers as uint64_t. ---*/
+
+  auto readUInt = [&]() {
+    uint64_t value = 0;
+    file_stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return static_cast<unsigned long>(value);
+  };
+  auto readString = [&]() {
+    string value(readUInt(), ' ');
+    if (!value.empty()) file_stream.read(&value[0], value.size());
+    return value;
+  };
+
+  table_dim = readUInt();
+  n_levels = readUInt();
+  n_variables = readUInt();
+  version_lut = readString();
+
+  names_var.resize(n_variables);
+  for (auto& name : names_var) name = readString();
+
+  n_points.resize(n_levels);
+  n_triangles.resize(n_levels);
+  n_hull_points.resize(n_levels);
+  table_levels.resize(n_levels);
+
+  for (unsigned long i_level = 0; i_level < n_levels; i_level++) {
+    passivedouble z_level = 0;
+    file_stream.read(reinterpret_cast<char*>(&z_level), sizeof(z_level));
+    table_levels[i_level] = z_level;
+    n_points[i_level] = readUInt();
+    n_triangles[i_level] = readUInt();
+    n_hull_points[i_level] = readUInt();
+  }
+
+  if (!file_stream) SU2_MPI::Error("Invalid header in binary look-up-table file " + file_name, CURRENT_FUNCTION);
+
+  table_data.resize(n_levels);
+  triangles.resize(n_levels);
+  hull.resize(n_levels);
+
+  vector<passivedouble> values;
+  vector<uint64_t> indices;
+
+  for (unsigned long i_level = 0; i_level < n_levels; i_level++) {
+    table_data[i_level].resize(n_variables, n_points[i_level]);
+    values.resize(n_points[i_level]);
+    for (unsigned long iVar = 0; iVar < n_variables; iVar++) {
+      file_stream.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(passivedouble));
+      for (unsigned long iPoint = 0; iPoint < n_points[i_level]; iPoint++)
+        table_data[i_level](iVar, iPoint) = values[iPoint];
+    }
+
+    triangles[i_level].resize(n_triangles[i_level], 3);
+    indices.resize(3 * n_triangles[i_level]);
+    file_stream.read(reinterpret_cast<char*>(indices.data()), indices.size() * sizeof(uint64_t));
+    for (unsigned long iTri = 0; iTri < n_triangles[i_level]; iTri++)
+      for (int iPoint = 0; iPoint < 3; iPoint++) triangles[i_level](iTri, iPoint) = indices[3 * iTri + iPoint];
+
+    hull[i_level].resize(n_hull_points[i_level]);
+    indices.resize(n_hull_points[i_level]);
+    file_stream.read(reinterpret_cast<char*>(indices.data()), indices.size() * sizeof(uint64_t));
+    for (unsigned long iHull = 0; iHull < n_hull_points[i_level]; iHull++) hull[i_level][iHull] = indices[iHull];
+  }
+
+  if (!file_stream) SU2_MPI::Error("Binary look-up-table file " + file_name + " is truncated.", CURRENT_FUNCTION);
+}
+
 void CFileReaderLUT::SkipToFlag(ifstream& file_stream, const string& current_line, const string& flag) const {
   string next_line;
 
@@ -25,6 +25,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <map>
 #include <utility>
 
 #include "../../../Common/include/containers/CLookUpTable.hpp"
@@ -49,6 +50,8 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   IdentifyUniqueEdges();
 
+  IdentifyTriangleNeighbors();
+
   if (rank == MASTER_NODE) cout << " done." << endl;
 
   PrintTableInfo();
@@ -113,6 +116,88 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
   if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
 }
 
+shared_ptr<CLookUpTable> CLookUpTable::GetShared(const string& file_name_lut, const string& name_CV1_in,
+                                                const string& name_CV2_in, bool write_binary) {
+  /*--- Tables in use, identified by file and controlling variables. Expired entries are replaced. ---*/
+  static map<string, weak_ptr<CLookUpTable>> tables;
+
+  shared_ptr<CLookUpTable> table;
+
+  SU2_OMP_CRITICAL {
+    auto& entry = tables[file_name_lut + '\n' + name_CV1_in + '\n' + name_CV2_in];
+    table = entry.lock();
+
+    if (!table) {
+      table = make_shared<CLookUpTable>(file_name_lut, name_CV1_in, name_CV2_in);
+      entry = table;
+
+      if (write_binary && (table->rank == MASTER_NODE) && !table->binary_file) {
+        table->WriteBinaryLUT(file_name_lut + ".bin");
+      }
+    }
+  }
+  END_SU2_OMP_CRITICAL
+
+  return table;
+}
+
+void CLookUpTable::WriteBinaryLUT(const string& file_name) const {
+  ofstream file_stream(file_name, ios::out | ios::binary);
+  if (!file_stream.is_open()) {
+    SU2_MPI::Error("Could not open " + file_name + " to write the look-up table.", CURRENT_FUNCTION);
+  }
+
+  auto writeUInt = [&](unsigned long value) {
+    const auto tmp = static_cast<uint64_t>(value);
+    file_stream.write(reinterpret_cast<const char*>(&tmp), sizeof(tmp));
+  };
+  auto writeString = [&](const string& value) {
+    writeUInt(value.size());
+    file_stream.write(value.data(), value.size());
+  };
+
+  /*--- See CFileReaderLUT::ReadBinaryLUT for the layout. ---*/
+  const string identifier = CFileReaderLUT::BinaryIdentifier();
+  file_stream.write(identifier.data(), identifier.size());
+  writeUInt(table_dim);
+  writeUInt(n_table_levels);
+  writeUInt(n_variables);
+  writeString(version_lut);
+  for (unsigned long iVar = 0; iVar < n_variables; iVar++) writeString(names_var[iVar]);
+
+  for (unsigned long i_level = 0; i_level < n_table_levels; i_level++) {
+    const passivedouble z_level = (table_dim == 3) ? SU2_TYPE::GetValue(z_values_levels[i_level]) : 0.0;
+    file_stream.write(reinterpret_cast<const char*>(&z_level), sizeof(z_level));
+    writeUInt(n_points[i_level]);
+    writeUInt(n_triangles[i_level]);
+    writeUInt(n_hull_points[i_level]);
+  }
+
+  vector<passivedouble> values;
+  vector<uint64_t> indices;
+
+  for (unsigned long i_level = 0; i_level < n_table_levels; i_level++) {
+    values.resize(n_points[i_level]);
+    for (unsigned long iVar = 0; iVar < n_variables; iVar++) {
+      for (unsigned long iPoint = 0; iPoint < n_points[i_level]; iPoint++)
+        values[iPoint] = SU2_TYPE::GetValue(table_data[i_level](iVar, iPoint));
+      file_stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(passivedouble));
+    }
+
+    indices.resize(3 * n_triangles[i_level]);
+    for (unsigned long iTri = 0; iTri < n_triangles[i_level]; iTri++)
+      for (int iPoint = 0; iPoint < 3; iPoint++) indices[3 * iTri + iPoint] = triangles[i_level](iTri, iPoint);
+    file_stream.write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(uint64_t));
+
+    indices.assign(hull[i_level].data(), hull[i_level].data() + n_hull_points[i_level]);
+    file_stream.write(reinterpret_cast<const char*>(indices.data()), indices.size() * sizeof(uint64_t));
+  }
+
+  if (!file_stream) SU2_MPI::Error("Could not write the look-up table to " + file_name, CURRENT_FUNCTION);
+
+  cout << "Look-up table written in binary format to " << file_name << endl;
+}
+
 void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   CFileReaderLUT file_reader;
 
@@ -136,9 +221,10 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
     n_points[i_level] = file_reader.GetNPoints(i_level);
     n_triangles[i_level] = file_reader.GetNTriangles(i_level);
     n_hull_points[i_level] = file_reader.GetNHullPoints(i_level);
-    table_data[i_level] = file_reader.GetTableData(i_level);
-    triangles[i_level] = file_reader.GetTriangles(i_level);
-    hull[i_level] = file_reader.GetHull(i_level);
+    /*--- Move instead of copying, large tables would otherwise need twice their size during loading. ---*/
+    table_data[i_level] = std::move(file_reader.GetTableData(i_level));
+    triangles[i_level] = std::move(file_reader.GetTriangles(i_level));
+    hull[i_level] = std::move(file_reader.GetHull(i_level));
     memory_footprint_data += n_points[i_level] * sizeof(su2double);
   }
   memory_footprint_data /= 1e6;
@@ -146,6 +232,7 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   n_variables = file_reader.GetNVariables();
   version_lut = file_reader.GetVersionLUT();
   version_reader = file_reader.GetVersionReader();
+  binary_file = file_reader.GetBinaryFormat();
   names_var = file_reader.GetNamesVar();
 
   if (table_dim == 3) {
@@ -158,8 +245,8 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
 }
 
 void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv2) {
-  int idx_CV1 = GetIndexOfVar(name_cv1);
-  int idx_CV2 = GetIndexOfVar(name_cv2);
+  idx_CV1 = GetIndexOfVar(name_cv1);
+  idx_CV2 = GetIndexOfVar(name_cv2);
   limits_table_x.resize(n_table_levels);
   limits_table_y.resize(n_table_levels);
 
@@ -354,6 +441,58 @@ void CLookUpTable::IdentifyUniqueEdges() {
   }
 }
 
+void CLookUpTable::IdentifyTriangleNeighbors() {
+  triangle_neighbors.resize(n_table_levels);
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    triangle_neighbors[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE) = n_triangles[i_level];
+
+    for (auto iEdge = 0ul; iEdge < edges[i_level].size(); iEdge++) {
+      const auto& edge_triangles = edge_to_triangle[i_level][iEdge];
+      if (edge_triangles.size() != 2) continue;
+
+      /*--- Each triangle of the edge is the neighbor opposite to the vertex of the other that is not on the edge. ---*/
+      for (int iSide = 0; iSide < 2; iSide++) {
+        const auto iTri = edge_triangles[iSide];
+        for (auto iPoint = 0ul; iPoint < N_POINTS_TRIANGLE; iPoint++) {
+          const auto point = triangles[i_level](iTri, iPoint);
+          if (point != edges[i_level][iEdge][0] && point != edges[i_level][iEdge][1])
+            triangle_neighbors[i_level](iTri, iPoint) = edge_triangles[1 - iSide];
+        }
+      }
+    }
+  }
+}
+
+unsigned long CLookUpTable::FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                         unsigned long* hints) {
+  /*--- Maximum number of steps of the walk, the search is local, far away points use the trapezoidal map. ---*/
+  constexpr unsigned short max_walk_steps = 16;
+
+  if (hints != nullptr && hints[i_level] < n_triangles[i_level]) {
+    auto id_triangle = hints[i_level];
+
+    for (unsigned short iStep = 0; iStep < max_walk_steps; iStep++) {
+      /*--- The interpolation coefficients are the barycentric coordinates of the point, if the smallest is
+       * negative the point is beyond the edge opposite to that vertex. ---*/
+      std::array<su2double, 3> interp_coeffs{0};
+      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
+      const auto iMin = min_element(interp_coeffs.begin(), interp_coeffs.end()) - interp_coeffs.begin();
+
+      if (interp_coeffs[iMin] >= 0 || IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
+        hints[i_level] = id_triangle;
+        return id_triangle;
+      }
+      id_triangle = triangle_neighbors[i_level](id_triangle, iMin);
+      if (id_triangle == n_triangles[i_level]) break;
+    }
+  }
+
+  const auto id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
+  if (hints != nullptr) hints[i_level] = id_triangle;
+  return id_triangle;
+}
+
 void CLookUpTable::ComputeInterpCoeffs() {
   for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
     /* build KD tree for y, x space */
@@ -424,7 +563,7 @@ std::pair<unsigned long, unsigned long> CLookUpTable::FindInclusionLevels(const
 }
 
 unsigned long CLookUpTable::LookUp_XYZ(const std::string& val_name_var, su2double* val_var, su2double val_CV1,
-                                       su2double val_CV2, su2double val_CV3) {
+                                       su2double val_CV2, su2double val_CV3, unsigned long* hints) {
   /*--- Perform quasi-3D interpolation for a single variable named val_name_var on a query point
         with coordinates val_CV1, val_CV2, and val_CV3 ---*/
 
@@ -444,8 +583,8 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::string& val_name_var, su2doubl
     unsigned long upper_level = inclusion_levels.second;
 
     su2double val_var_lower, val_var_upper;
-    unsigned long exit_code_lower = LookUp_XY(val_name_var, &val_var_lower, val_CV1_lower, val_CV2_lower, lower_level);
-    unsigned long exit_code_upper = LookUp_XY(val_name_var, &val_var_upper, val_CV1_upper, val_CV2_upper, upper_level);
+    unsigned long exit_code_lower = LookUp_XY(val_name_var, &val_var_lower, val_CV1_lower, val_CV2_lower, lower_level, hints);
+    unsigned long exit_code_upper = LookUp_XY(val_name_var, &val_var_upper, val_CV1_upper, val_CV2_upper, upper_level, hints);
 
     /* 4: Perform linear interpolation along the z-direction using the x-y interpolation results
              from upper and lower trapezoidal maps */
@@ -455,12 +594,12 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::string& val_name_var, su2doubl
   } else {
     /* Perform single, 2D interpolation when val_CV3 lies outside table bounds */
     unsigned long bound_level = inclusion_levels.first;
-    LookUp_XY(val_name_var, val_var, val_CV1, val_CV2, bound_level);
+    LookUp_XY(val_name_var, val_var, val_CV1, val_CV2, bound_level, hints);
     return 1;
   }
 }
 unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names_var, std::vector<su2double>& val_vars,
-                                       su2double val_CV1, su2double val_CV2, su2double val_CV3) {
+                                       su2double val_CV1, su2double val_CV2, su2double val_CV3, unsigned long* hints) {
   /*--- Perform quasi-3D interpolation for a vector of variables with names val_names_var
         on a query point with coordinates val_CV1, val_CV2, and val_CV3 ---*/
 
@@ -482,8 +621,8 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names
     std::vector<su2double> val_vars_lower, val_vars_upper;
     val_vars_lower.resize(val_vars.size());
     val_vars_upper.resize(val_vars.size());
-    unsigned long exit_code_lower = LookUp_XY(val_names_var, val_vars_lower, val_CV1_lower, val_CV2_lower, lower_level);
-    unsigned long exit_code_upper = LookUp_XY(val_names_var, val_vars_upper, val_CV1_upper, val_CV2_upper, upper_level);
+    unsigned long exit_code_lower = LookUp_XY(val_names_var, val_vars_lower, val_CV1_lower, val_CV2_lower, lower_level, hints);
+    unsigned long exit_code_upper = LookUp_XY(val_names_var, val_vars_upper, val_CV1_upper, val_CV2_upper, upper_level, hints);
 
     /* 4: Perform linear interpolation along the z-direction using the x-y interpolation results
              from upper and lower trapezoidal maps */
@@ -493,7 +632,7 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names
   } else {
     /* Perform single, 2D interpolation when val_CV3 lies outside table bounds */
     unsigned long bound_level = inclusion_levels.first;
-    LookUp_XY(val_names_var, val_vars, val_CV1, val_CV2, bound_level);
+    LookUp_XY(val_names_var, val_vars, val_CV1, val_CV2, bound_level, hints);
     return 1;
   }
 }
@@ -580,7 +719,7 @@ std::array<std::array<su2double, 2>, 2> CLookUpTable::ComputeNormalizedXY(
 }
 
 unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val_var, su2double val_CV1,
-                                      su2double val_CV2, unsigned long i_level) {
+                                      su2double val_CV2, unsigned long i_level, unsigned long* hints) {
   unsigned long exit_code = 1;
 
   if (noSource(val_name_var)) {
@@ -593,7 +732,7 @@ unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val
   if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
       (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
     /* find the triangle that holds the (x, y) point */
-    unsigned long id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
+    unsigned long id_triangle = FindTriangle(val_CV1, val_CV2, i_level, hints);
 
     if (IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
       /* get interpolation coefficients for point on triangle */
@@ -614,20 +753,22 @@ unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val
 }
 
 unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double>& val_vars,
-                                      su2double val_CV1, su2double val_CV2, unsigned long i_level) {
+                                      su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                      unsigned long* hints) {
   vector<su2double*> look_up_data(val_names_var.size());
 
   for (long unsigned int i_var = 0; i_var < val_vars.size(); ++i_var) {
     look_up_data[i_var] = &val_vars[i_var];
   }
 
-  unsigned long exit_code = LookUp_XY(val_names_var, look_up_data, val_CV1, val_CV2, i_level);
+  unsigned long exit_code = LookUp_XY(val_names_var, look_up_data, val_CV1, val_CV2, i_level, hints);
 
   return exit_code;
 }
 
 unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double*>& val_vars,
-                                      su2double val_CV1, su2double val_CV2, unsigned long i_level) {
+                                      su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                      unsigned long* hints) {
   unsigned long exit_code = 1;
   unsigned long id_triangle = 0;
   std::array<su2double, 3> interp_coeffs{0};
@@ -638,7 +779,7 @@ unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vecto
   if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
       (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
     /* if so, try to find the triangle that holds the (prog, enth) point */
-    id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
+    id_triangle = FindTriangle(val_CV1, val_CV2, i_level, hints);
 
     /* check if point is inside a triangle (if table domain is non-rectangular,
      * the previous range check might be true but the point could still be outside of the domain) */
@@ -783,14 +924,18 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
 
 bool CLookUpTable::IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle,
                                 unsigned long i_level) {
-  su2double tri_x_0 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][0]];
-  su2double tri_y_0 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][0]];
+  /*--- Use the stored indices of the controlling variables, looking them up by name is comparatively slow. ---*/
+  const su2double* val_x = table_data[i_level][idx_CV1];
+  const su2double* val_y = table_data[i_level][idx_CV2];
+
+  su2double tri_x_0 = val_x[triangles[i_level][val_id_triangle][0]];
+  su2double tri_y_0 = val_y[triangles[i_level][val_id_triangle][0]];
 
-  su2double tri_x_1 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][1]];
-  su2double tri_y_1 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][1]];
+  su2double tri_x_1 = val_x[triangles[i_level][val_id_triangle][1]];
+  su2double tri_y_1 = val_y[triangles[i_level][val_id_triangle][1]];
 
-  su2double tri_x_2 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][2]];
-  su2double tri_y_2 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][2]];
+  su2double tri_x_2 = val_x[triangles[i_level][val_id_triangle][2]];
+  su2double tri_y_2 = val_y[triangles[i_level][val_id_triangle][2]];
 
   su2double area_tri = TriArea(tri_x_0, tri_y_0, tri_x_1, tri_y_1, tri_x_2, tri_y_2);
 
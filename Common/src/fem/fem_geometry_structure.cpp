@@ -2887,15 +2887,15 @@ void CMeshFEM_DG::CreateFaces(CConfig* config) {
 
       /* Create the new standard elements if no match was found. */
       if (j == standardMatchingFacesSol.size()) {
-        standardMatchingFacesSol.emplace_back(VTK_Type, localFaces[i].elemType0, localFaces[i].nPolySol0,
-                                              localFaces[i].elemType1, localFaces[i].nPolySol1,
-                                              localFaces[i].JacFaceIsConsideredConstant, swapFaceInElementSide0,
-                                              swapFaceInElementSide1, config);
+        standardMatchingFacesSol.push_back(CFEMStandardInternalFace::Get(
+            VTK_Type, localFaces[i].elemType0, localFaces[i].nPolySol0, localFaces[i].elemType1,
+            localFaces[i].nPolySol1, localFaces[i].JacFaceIsConsideredConstant, swapFaceInElementSide0,
+            swapFaceInElementSide1, config));
 
-        standardMatchingFacesGrid.emplace_back(
+        standardMatchingFacesGrid.push_back(CFEMStandardInternalFace::Get(
             VTK_Type, localFaces[i].elemType0, localFaces[i].nPolyGrid0, localFaces[i].elemType1,
             localFaces[i].nPolyGrid1, localFaces[i].JacFaceIsConsideredConstant, swapFaceInElementSide0,
-            swapFaceInElementSide1, config, standardMatchingFacesSol[j].GetOrderExact());
+            swapFaceInElementSide1, config, standardMatchingFacesSol[j].GetOrderExact()));
         matchingFaces[ii].indStandardElement = j;
       }
 
@@ -3071,12 +3071,13 @@ void CMeshFEM_DG::CreateFaces(CConfig* config) {
 
         /* Create the new standard elements if no match was found. */
         if (j == standardBoundaryFacesSol.size()) {
-          standardBoundaryFacesSol.emplace_back(VTK_Type, localFaces[i].elemType0, localFaces[i].nPolySol0,
-                                                localFaces[i].JacFaceIsConsideredConstant, swapFaceInElement, config);
+          standardBoundaryFacesSol.push_back(
+              CFEMStandardBoundaryFace::Get(VTK_Type, localFaces[i].elemType0, localFaces[i].nPolySol0,
+                                            localFaces[i].JacFaceIsConsideredConstant, swapFaceInElement, config));
 
-          standardBoundaryFacesGrid.emplace_back(VTK_Type, localFaces[i].elemType0, localFaces[i].nPolyGrid0,
-                                                 localFaces[i].JacFaceIsConsideredConstant, swapFaceInElement, config,
-                                                 standardBoundaryFacesSol[j].GetOrderExact());
+          standardBoundaryFacesGrid.push_back(CFEMStandardBoundaryFace::Get(
+              VTK_Type, localFaces[i].elemType0, localFaces[i].nPolyGrid0, localFaces[i].JacFaceIsConsideredConstant,
+              swapFaceInElement, config, standardBoundaryFacesSol[j].GetOrderExact()));
           surfElem[ii].indStandardElement = j;
         }
       }
@@ -3123,13 +3124,13 @@ void CMeshFEM_DG::CreateStandardVolumeElements(CConfig* config) {
 
     /* Create the new standard elements if no match was found. */
     if (j == standardElementsSol.size()) {
-      standardElementsSol.emplace_back(volElem[i].VTK_Type, volElem[i].nPolySol, volElem[i].JacIsConsideredConstant,
-                                       config);
+      standardElementsSol.push_back(CFEMStandardElement::Get(volElem[i].VTK_Type, volElem[i].nPolySol,
+                                                             volElem[i].JacIsConsideredConstant, config));
 
-      standardElementsGrid.emplace_back(volElem[i].VTK_Type, volElem[i].nPolyGrid, volElem[i].JacIsConsideredConstant,
-                                        config, standardElementsSol[j].GetOrderExact(),
-                                        standardElementsSol[j].GetRDOFs(), standardElementsSol[j].GetSDOFs(),
-                                        standardElementsSol[j].GetTDOFs());
+      standardElementsGrid.push_back(CFEMStandardElement::Get(
+          volElem[i].VTK_Type, volElem[i].nPolyGrid, volElem[i].JacIsConsideredConstant, config,
+          standardElementsSol[j].GetOrderExact(), standardElementsSol[j].GetRDOFs(), standardElementsSol[j].GetSDOFs(),
+          standardElementsSol[j].GetTDOFs()));
       volElem[i].indStandardElement = j;
     }
   }
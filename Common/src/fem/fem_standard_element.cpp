@@ -29,6 +29,40 @@
 #include "../../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../../include/linear_algebra/blas_structure.hpp"
 
+#include <memory>
+
+namespace {
+/*!
+ * \brief Cache of standard elements (or faces) of type T, identified by the arguments of their constructor.
+ * \note The elements are stored by pointer so that the references returned remain valid.
+ */
+template <class T>
+class CStandardElementCache {
+  vector<pair<vector<passivedouble>, unique_ptr<T> > > entries;
+
+ public:
+  /*!
+   * \brief Find the element with the given key, or create it with "make" (returning a new object).
+   */
+  template <class F>
+  const T& Get(vector<passivedouble>&& key, F make) {
+    for (const auto& entry : entries) {
+      if (entry.first == key) return *entry.second;
+    }
+    entries.emplace_back(std::move(key), unique_ptr<T>(make()));
+    return *entries.back().second;
+  }
+};
+
+/*!
+ * \brief Start the key of a cached element with the parameters of the config that affect all elements.
+ */
+vector<passivedouble> StandardElementKey(const CConfig* config) {
+  return {SU2_TYPE::GetValue(config->GetQuadrature_Factor_Straight()),
+          SU2_TYPE::GetValue(config->GetQuadrature_Factor_Curved())};
+}
+}  // namespace
+
 /*----------------------------------------------------------------------------------*/
 /*          Public member functions of CFEMStandardElementBase.                     */
 /*----------------------------------------------------------------------------------*/
@@ -1884,6 +1918,9 @@ CFEMStandardElement::CFEMStandardElement(unsigned short val_VTK_Type, unsigned s
       mat2ndDerBasisIntPoint = mat2ndDerBasisIntPoint + offsetDerInt;
     }
   }
+
+  /*--- Create the 1D data for the sum factorization of tensor product elements. ---*/
+  if (VTK_Type == HEXAHEDRON) CreateTensorProductData();
 }
 
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double* parCoor, vector<su2double>& lagBasis) {
@@ -2012,6 +2049,29 @@ void CFEMStandardElement::BasisFunctionsAndDerivativesInPoint(const su2double* p
     MatMulRowMajor(nDOFs, 1, VDr[i], matVandermondeInv, dLagBasis[i]);
 }
 
+const CFEMStandardElement& CFEMStandardElement::Get(unsigned short val_VTK_Type, unsigned short val_nPoly,
+                                                   bool val_constJac, CConfig* config, unsigned short val_orderExact,
+                                                   const vector<su2double>* rLocSolDOFs,
+                                                   const vector<su2double>* sLocSolDOFs,
+                                                   const vector<su2double>* tLocSolDOFs) {
+  static CStandardElementCache<CFEMStandardElement> cache;
+
+  /*--- The locations of the solution DOFs are part of the key, with their sizes as separators. ---*/
+  auto key = StandardElementKey(config);
+  key.insert(key.end(), {passivedouble(val_VTK_Type), passivedouble(val_nPoly), passivedouble(val_constJac),
+                         passivedouble(val_orderExact)});
+  for (const auto* locDOFs : {rLocSolDOFs, sLocSolDOFs, tLocSolDOFs}) {
+    key.push_back(locDOFs ? passivedouble(locDOFs->size()) : -1.0);
+    if (locDOFs)
+      for (const auto& val : *locDOFs) key.push_back(SU2_TYPE::GetValue(val));
+  }
+
+  return cache.Get(std::move(key), [&]() {
+    return new CFEMStandardElement(val_VTK_Type, val_nPoly, val_constJac, config, val_orderExact, rLocSolDOFs,
+                                   sLocSolDOFs, tLocSolDOFs);
+  });
+}
+
 bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type, unsigned short val_nPoly,
                                               bool val_constJac) {
   if (val_VTK_Type != VTK_Type) return false;
@@ -2021,6 +2081,151 @@ bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type, unsig
   return true;
 }
 
+namespace {
+/*!
+ * \brief Applies the 1D matrix mat, or its transpose, to one index of a 3D array of points. The points of the input
+ *        are numbered (iOuter*nSum + l)*nInner + iInner and have a stride of strideIn, those of the output are
+ *        numbered (iOuter*nOut + m)*nInner + iInner and are contiguous. Each point stores NPad entries.
+ *        The length of the sum is a template argument for the common polynomial degrees (0 means runtime).
+ */
+template <unsigned short NSUM>
+void TensorProductStage(unsigned short nSumRun, unsigned short nOut, unsigned short nOuter, unsigned short nInner,
+                        unsigned short NPad, const su2double* mat, bool trans, unsigned short strideIn,
+                        const su2double* in, bool add, su2double* out) {
+  const unsigned short nSum = NSUM ? NSUM : nSumRun;
+
+  for (unsigned short iOuter = 0; iOuter < nOuter; ++iOuter) {
+    for (unsigned short m = 0; m < nOut; ++m) {
+      for (unsigned short iInner = 0; iInner < nInner; ++iInner) {
+        su2double* c = out + ((iOuter * nOut + m) * nInner + iInner) * NPad;
+        if (!add)
+          for (unsigned short v = 0; v < NPad; ++v) c[v] = 0.0;
+
+        for (unsigned short l = 0; l < nSum; ++l) {
+          const su2double a = trans ? mat[l * nOut + m] : mat[m * nSum + l];
+          const su2double* b = in + ((iOuter * nSum + l) * nInner + iInner) * strideIn;
+          SU2_OMP_SIMD
+          for (unsigned short v = 0; v < NPad; ++v) c[v] += a * b[v];
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Selects the specialization of TensorProductStage for the length of the sum.
+ */
+void TensorProductStageDispatch(unsigned short nSum, unsigned short nOut, unsigned short nOuter,
+                                unsigned short nInner, unsigned short NPad, const su2double* mat, bool trans,
+                                unsigned short strideIn, const su2double* in, bool add, su2double* out) {
+  switch (nSum) {
+    case 2:
+      TensorProductStage<2>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 3:
+      TensorProductStage<3>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 4:
+      TensorProductStage<4>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 5:
+      TensorProductStage<5>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 6:
+      TensorProductStage<6>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 7:
+      TensorProductStage<7>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    case 8:
+      TensorProductStage<8>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+    default:
+      TensorProductStage<0>(nSum, nOut, nOuter, nInner, NPad, mat, trans, strideIn, in, add, out);
+      break;
+  }
+}
+}  // namespace
+
+void CFEMStandardElement::TensorProductSolAndGradInt(unsigned short NPad, const su2double* sol,
+                                                     su2double* solAndGradInt, su2double* work,
+                                                     bool gradients) const {
+  const unsigned short N = nDOFs1D, M = nInt1D;
+  const su2double* L = lagBasisInt1D.data();
+  const su2double* D = derLagBasisInt1D.data();
+
+  /*--- Partial results, the first letter is the matrix applied in the x-direction
+        and the second letter the one applied in the y-direction. ---*/
+  su2double* TL = work;
+  su2double* TD = TL + N * N * M * NPad;
+  su2double* TLL = TD + N * N * M * NPad;
+  su2double* TLD = TLL + N * M * M * NPad;
+  su2double* TDL = TLD + N * M * M * NPad;
+
+  const unsigned long offDeriv = static_cast<unsigned long>(nIntegration) * NPad;
+
+  /*--- Contraction of the x-index. ---*/
+  TensorProductStageDispatch(N, M, N * N, 1, NPad, L, false, NPad, sol, false, TL);
+  if (gradients) TensorProductStageDispatch(N, M, N * N, 1, NPad, D, false, NPad, sol, false, TD);
+
+  /*--- Contraction of the y-index. ---*/
+  TensorProductStageDispatch(N, M, N, M, NPad, L, false, NPad, TL, false, TLL);
+  if (gradients) {
+    TensorProductStageDispatch(N, M, N, M, NPad, D, false, NPad, TL, false, TLD);
+    TensorProductStageDispatch(N, M, N, M, NPad, L, false, NPad, TD, false, TDL);
+  }
+
+  /*--- Contraction of the z-index, which gives the solution and the r-, s- and t-derivatives. ---*/
+  TensorProductStageDispatch(N, M, 1, M * M, NPad, L, false, NPad, TLL, false, solAndGradInt);
+  if (gradients) {
+    TensorProductStageDispatch(N, M, 1, M * M, NPad, L, false, NPad, TDL, false, solAndGradInt + offDeriv);
+    TensorProductStageDispatch(N, M, 1, M * M, NPad, L, false, NPad, TLD, false, solAndGradInt + 2 * offDeriv);
+    TensorProductStageDispatch(N, M, 1, M * M, NPad, D, false, NPad, TLL, false, solAndGradInt + 3 * offDeriv);
+  }
+}
+
+void CFEMStandardElement::TensorProductBasisTrans(unsigned short NPad, const su2double* dataInt, su2double* res,
+                                                  su2double* work) const {
+  const unsigned short N = nDOFs1D, M = nInt1D;
+  const su2double* L = lagBasisInt1D.data();
+
+  su2double* TL = work;
+  su2double* TLL = TL + M * M * N * NPad;
+
+  TensorProductStageDispatch(M, N, M * M, 1, NPad, L, true, NPad, dataInt, false, TL);
+  TensorProductStageDispatch(M, N, M, N, NPad, L, true, NPad, TL, false, TLL);
+  TensorProductStageDispatch(M, N, 1, N * N, NPad, L, true, NPad, TLL, false, res);
+}
+
+void CFEMStandardElement::TensorProductDerBasisTrans(unsigned short NPad, const su2double* fluxes, su2double* res,
+                                                     su2double* work) const {
+  const unsigned short N = nDOFs1D, M = nInt1D;
+  const su2double* L = lagBasisInt1D.data();
+  const su2double* D = derLagBasisInt1D.data();
+
+  /*--- The residual is Dz^T Ly^T Lx^T ft + Lz^T (Ly^T Dx^T fr + Dy^T Lx^T fs),
+        the components of the fluxes are interleaved, hence the stride of 3*NPad. ---*/
+  su2double* A = work;
+  su2double* B = A + M * M * N * NPad;
+  su2double* C = B + M * M * N * NPad;
+  su2double* Q1 = C + M * M * N * NPad;
+  su2double* Q2 = Q1 + M * N * N * NPad;
+
+  /*--- Contraction of the x-index. ---*/
+  TensorProductStageDispatch(M, N, M * M, 1, NPad, D, true, 3 * NPad, fluxes, false, A);
+  TensorProductStageDispatch(M, N, M * M, 1, NPad, L, true, 3 * NPad, fluxes + NPad, false, B);
+  TensorProductStageDispatch(M, N, M * M, 1, NPad, L, true, 3 * NPad, fluxes + 2 * NPad, false, C);
+
+  /*--- Contraction of the y-index. ---*/
+  TensorProductStageDispatch(M, N, M, N, NPad, L, true, NPad, A, false, Q1);
+  TensorProductStageDispatch(M, N, M, N, NPad, D, true, NPad, B, true, Q1);
+  TensorProductStageDispatch(M, N, M, N, NPad, L, true, NPad, C, false, Q2);
+
+  /*--- Contraction of the z-index. ---*/
+  TensorProductStageDispatch(M, N, 1, N * N, NPad, L, true, NPad, Q1, false, res);
+  TensorProductStageDispatch(M, N, 1, N * N, NPad, D, true, NPad, Q2, true, res);
+}
+
 /*----------------------------------------------------------------------------------*/
 /*           Private member functions of CFEMStandardElement.                       */
 /*----------------------------------------------------------------------------------*/
@@ -2062,6 +2267,11 @@ void CFEMStandardElement::Copy(const CFEMStandardElement& other) {
   matDerBasisSolDOFs = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt = other.mat2ndDerBasisInt;
+
+  nDOFs1D = other.nDOFs1D;
+  nInt1D = other.nInt1D;
+  lagBasisInt1D = other.lagBasisInt1D;
+  derLagBasisInt1D = other.derLagBasisInt1D;
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2447,6 +2657,50 @@ void CFEMStandardElement::DataStandardHexahedron() {
   VTK_Type2 = NONE;
 }
 
+void CFEMStandardElement::CreateTensorProductData() {
+  /*--- The integration rule of the hexahedron is a tensor product of a 1D rule,
+        whose points are the first nInt1D points in r-direction. ---*/
+  unsigned short M = 1;
+  while (M * M * M < nIntegration) ++M;
+  if (M * M * M != nIntegration) return;
+
+  vector<su2double> rInt1D(rIntegration.begin(), rIntegration.begin() + M);
+
+  unsigned short N;
+  vector<su2double> rDOFs1D, matVandermondeInv1D, lag1D, der1D;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, rInt1D, N, rDOFs1D, matVandermondeInv1D, lag1D, der1D);
+  if (N * N * N != nDOFs) return;
+
+  /*--- Check that the 3D basis functions and derivatives are indeed the tensor products
+        of the 1D data. If not, the general matrix products are used. ---*/
+  for (unsigned short kk = 0; kk < M; ++kk) {
+    for (unsigned short jj = 0; jj < M; ++jj) {
+      for (unsigned short ii = 0; ii < M; ++ii) {
+        const unsigned int p = (kk * M + jj) * M + ii;
+        for (unsigned short k = 0; k < N; ++k) {
+          for (unsigned short j = 0; j < N; ++j) {
+            for (unsigned short i = 0; i < N; ++i) {
+              const unsigned int ind = p * nDOFs + (k * N + j) * N + i;
+              const su2double Lx = lag1D[ii * N + i], Ly = lag1D[jj * N + j], Lz = lag1D[kk * N + k];
+              const su2double Dx = der1D[ii * N + i], Dy = der1D[jj * N + j], Dz = der1D[kk * N + k];
+
+              if (fabs(lagBasisIntegration[ind] - Lx * Ly * Lz) > 1.e-10) return;
+              if (fabs(drLagBasisIntegration[ind] - Dx * Ly * Lz) > 1.e-8) return;
+              if (fabs(dsLagBasisIntegration[ind] - Lx * Dy * Lz) > 1.e-8) return;
+              if (fabs(dtLagBasisIntegration[ind] - Lx * Ly * Dz) > 1.e-8) return;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  nDOFs1D = N;
+  nInt1D = M;
+  lagBasisInt1D = lag1D;
+  derLagBasisInt1D = der1D;
+}
+
 void CFEMStandardElement::SubConnTetrahedron() {
   /*--- Initialize the number of DOFs for the current edges to the number of
         DOFs of the edges present in the tetrahedron. Also initialize the
@@ -3394,6 +3648,25 @@ CFEMStandardInternalFace::CFEMStandardInternalFace(unsigned short val_VTK_TypeFa
   }
 }
 
+const CFEMStandardInternalFace& CFEMStandardInternalFace::Get(
+    unsigned short val_VTK_TypeFace, unsigned short val_VTK_TypeSide0, unsigned short val_nPolySide0,
+    unsigned short val_VTK_TypeSide1, unsigned short val_nPolySide1, bool val_constJac, bool val_swapFaceInElementSide0,
+    bool val_swapFaceInElementSide1, CConfig* config, unsigned short val_orderExact) {
+  static CStandardElementCache<CFEMStandardInternalFace> cache;
+
+  auto key = StandardElementKey(config);
+  key.insert(key.end(), {passivedouble(val_VTK_TypeFace), passivedouble(val_VTK_TypeSide0),
+                         passivedouble(val_nPolySide0), passivedouble(val_VTK_TypeSide1), passivedouble(val_nPolySide1),
+                         passivedouble(val_constJac), passivedouble(val_swapFaceInElementSide0),
+                         passivedouble(val_swapFaceInElementSide1), passivedouble(val_orderExact)});
+
+  return cache.Get(std::move(key), [&]() {
+    return new CFEMStandardInternalFace(val_VTK_TypeFace, val_VTK_TypeSide0, val_nPolySide0, val_VTK_TypeSide1,
+                                        val_nPolySide1, val_constJac, val_swapFaceInElementSide0,
+                                        val_swapFaceInElementSide1, config, val_orderExact);
+  });
+}
+
 bool CFEMStandardInternalFace::SameStandardMatchingFace(unsigned short val_VTK_TypeFace, bool val_constJac,
                                                         unsigned short val_VTK_TypeSide0, unsigned short val_nPolySide0,
                                                         unsigned short val_VTK_TypeSide1, unsigned short val_nPolySide1,
@@ -3604,6 +3877,24 @@ unsigned short CFEMStandardBoundaryFace::GetNDOFsPerSubFace() const {
   return nDOFsSubface;
 }
 
+const CFEMStandardBoundaryFace& CFEMStandardBoundaryFace::Get(unsigned short val_VTK_TypeFace,
+                                                             unsigned short val_VTK_TypeElem,
+                                                             unsigned short val_nPolyElem, bool val_constJac,
+                                                             bool val_swapFaceInElement, CConfig* config,
+                                                             unsigned short val_orderExact) {
+  static CStandardElementCache<CFEMStandardBoundaryFace> cache;
+
+  auto key = StandardElementKey(config);
+  key.insert(key.end(), {passivedouble(val_VTK_TypeFace), passivedouble(val_VTK_TypeElem),
+                         passivedouble(val_nPolyElem), passivedouble(val_constJac),
+                         passivedouble(val_swapFaceInElement), passivedouble(val_orderExact)});
+
+  return cache.Get(std::move(key), [&]() {
+    return new CFEMStandardBoundaryFace(val_VTK_TypeFace, val_VTK_TypeElem, val_nPolyElem, val_constJac,
+                                        val_swapFaceInElement, config, val_orderExact);
+  });
+}
+
 bool CFEMStandardBoundaryFace::SameStandardBoundaryFace(unsigned short val_VTK_TypeFace, bool val_constJac,
                                                         unsigned short val_VTK_TypeElem, unsigned short val_nPolyElem,
                                                         bool val_swapFaceInElem) {
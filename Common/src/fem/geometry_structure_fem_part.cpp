@@ -2928,7 +2928,8 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig* config
       if (standardVolumeElements[ii].SameStandardElement(VTK_Type, nPolyGrid, true)) break;
     }
 
-    if (ii == standardVolumeElements.size()) standardVolumeElements.emplace_back(VTK_Type, nPolyGrid, true, config);
+    if (ii == standardVolumeElements.size())
+      standardVolumeElements.push_back(CFEMStandardElement::Get(VTK_Type, nPolyGrid, true, config));
 
     /*--- Allocate the memory for some help vectors to carry out the matrix
           product to determine the derivatives of the coordinates w.r.t.
@@ -3059,7 +3060,8 @@ void CPhysicalGeometry::DetermineFEMConstantJacobiansAndLenScale(CConfig* config
         if (standardFaceElements[jj].SameStandardElement(VTK_Type, nPolyGrid, true)) break;
       }
 
-      if (jj == standardFaceElements.size()) standardFaceElements.emplace_back(VTK_Type, nPolyGrid, true, config);
+      if (jj == standardFaceElements.size())
+        standardFaceElements.push_back(CFEMStandardElement::Get(VTK_Type, nPolyGrid, true, config));
 
       /*--- Set the pointer to store the face connectivity of this face. ---*/
       unsigned short* connFace = nullptr;
@@ -3262,7 +3264,8 @@ void CPhysicalGeometry::DetermineDonorElementsWallFunctions(CConfig* config) {
       if (standardVolumeElements[ii].SameStandardElement(VTK_Parent, nPolyGrid, true)) break;
     }
 
-    if (ii == standardVolumeElements.size()) standardVolumeElements.emplace_back(VTK_Parent, nPolyGrid, true, config);
+    if (ii == standardVolumeElements.size())
+      standardVolumeElements.push_back(CFEMStandardElement::Get(VTK_Parent, nPolyGrid, true, config));
 
     /* Determine the necessary data for splitting the element in its linear
        sub-elements. */
@@ -3431,9 +3434,11 @@ void CPhysicalGeometry::DetermineDonorElementsWallFunctions(CConfig* config) {
             }
 
             if (ii == standardBoundaryFacesSol.size()) {
-              standardBoundaryFacesSol.emplace_back(VTK_Type, VTK_Elem, nPolySol, constJac, false, config);
-              standardBoundaryFacesGrid.emplace_back(VTK_Type, VTK_Elem, nPolyGrid, constJac, false, config,
-                                                     standardBoundaryFacesSol[ii].GetOrderExact());
+              standardBoundaryFacesSol.push_back(
+                  CFEMStandardBoundaryFace::Get(VTK_Type, VTK_Elem, nPolySol, constJac, false, config));
+              standardBoundaryFacesGrid.push_back(CFEMStandardBoundaryFace::Get(
+                  VTK_Type, VTK_Elem, nPolyGrid, constJac, false, config,
+                  standardBoundaryFacesSol[ii].GetOrderExact()));
             }
 
             /* Get the required information from the standard element. */
@@ -4449,7 +4454,8 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(CConfig* config, const vector<CFa
       if (standardElements[ii].SameStandardElement(VTK_Type, nPolySol, JacIsConstant)) break;
     }
 
-    if (ii == standardElements.size()) standardElements.emplace_back(VTK_Type, nPolySol, JacIsConstant, config);
+    if (ii == standardElements.size())
+      standardElements.push_back(CFEMStandardElement::Get(VTK_Type, nPolySol, JacIsConstant, config));
 
     /* Initialize the computational work for this element, which is stored
        in the 1st vertex weight. */
@@ -4522,8 +4528,9 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(CConfig* config, const vector<CFa
           }
 
           if (ii == standardMatchingFaces.size())
-            standardMatchingFaces.emplace_back(VTK_Type_Face, low->elemType0, low->nPolySol0, low->elemType1,
-                                               low->nPolySol1, JacIsConstant, false, false, config);
+            standardMatchingFaces.push_back(CFEMStandardInternalFace::Get(VTK_Type_Face, low->elemType0, low->nPolySol0,
+                                                                          low->elemType1, low->nPolySol1, JacIsConstant,
+                                                                          false, false, config));
 
           /* Update the computational work for this element, i.e. the 1st
              vertex weight. */
@@ -4540,7 +4547,8 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(CConfig* config, const vector<CFa
         }
 
         if (ii == standardBoundaryFaces.size())
-          standardBoundaryFaces.emplace_back(VTK_Type_Face, VTK_Type, nPolySol, JacIsConstant, false, config);
+          standardBoundaryFaces.push_back(
+              CFEMStandardBoundaryFace::Get(VTK_Type_Face, VTK_Type, nPolySol, JacIsConstant, false, config));
 
         /* Update the computational work for this element, i.e. the 1st
            vertex weight. */
@@ -26,12 +26,115 @@
  */
 
 #include <unordered_set>
+#include <functional>
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
+#include "../../include/toolboxes/CPhaseTimers.hpp"
+
+/*--- Shared memory point-to-point comms need plain MPI datatypes in the buffers (not AD types). ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_SHARED_P2P
+#endif
+
+/*!
+ * \brief Point-to-point comms through shared memory with the neighbors on the same node (SHARED_MEMORY_COMMS).
+ * \note The buffers of the ranks of a node are MPI-3 shared windows, the sender copies the data of a message
+ *       directly into the buffer of the receiver, and sends a message without data (which the completion of
+ *       the comms in the solvers waits for as usual). Before copying, the sender waits for a "ready" message
+ *       that the receiver sends when it posts its recvs, at that point the receiver has unpacked the data of
+ *       the previous comms.
+ */
+struct CGeometry::CSharedP2PComms {
+  enum : int { OFFSET_TAG_RECV = 0, OFFSET_TAG_SEND = 1, READY_TAG = 2 };
+  enum : int { WIN_D_SEND = 0, WIN_D_RECV = 1, WIN_S_SEND = 2, WIN_S_RECV = 3, WIN_F_SEND = 4, WIN_F_RECV = 5, N_WIN };
+
+  vector<int> nodeRankSend;     /*!< \brief Node rank of the neighbor of each send, -1 if on another node. */
+  vector<int> nodeRankRecv;     /*!< \brief Node rank of the neighbor of each recv, -1 if on another node. */
+  vector<int> remoteRecvOffset; /*!< \brief Offset (points) of each send in the recv buffer of the neighbor. */
+  vector<int> remoteSendOffset; /*!< \brief Offset (points) of each recv in the send buffer of the neighbor. */
+
+  /*!
+   * \brief Check if a send goes to the same node, in reverse mode the recv structures are used for the sends.
+   */
+  bool SendOnNode(int iSend, bool reverse) const { return (reverse ? nodeRankRecv : nodeRankSend)[iSend] >= 0; }
+
+  /*!
+   * \brief Check if a recv comes from the same node, in reverse mode the send structures are used for the recvs.
+   */
+  bool RecvOnNode(int iRecv, bool reverse) const { return (reverse ? nodeRankSend : nodeRankRecv)[iRecv] >= 0; }
+
+#ifdef HAVE_SHARED_P2P
+  MPI_Comm nodeComm = MPI_COMM_NULL;  /*!< \brief Ranks of this node. */
+  MPI_Comm readyComm = MPI_COMM_NULL; /*!< \brief Duplicate of the global communicator for the "ready" messages. */
+  MPI_Win win[N_WIN];                 /*!< \brief Windows of the buffers (WIN_D_SEND, etc.). */
+  void* local[N_WIN] = {nullptr};     /*!< \brief Address of the buffers of this rank. */
+  vector<void*> base[N_WIN];          /*!< \brief Address of the buffers of each node rank. */
+  bool allocated = false;
+  vector<MPI_Request> readyRequests;  /*!< \brief Sends of the "ready" messages of the last recvs. */
+
+  ~CSharedP2PComms() {
+    Free();
+    for (auto& request : readyRequests) MPI_Wait(&request, MPI_STATUS_IGNORE);
+    MPI_Comm_free(&readyComm);
+    MPI_Comm_free(&nodeComm);
+  }
+
+  /*!
+   * \brief Allocate the windows (collective over the node), with the sizes in bytes of the buffers.
+   */
+  void Allocate(const size_t (&bytes)[N_WIN], const int (&dispUnit)[N_WIN]) {
+    Free();
+    int nodeSize = 0;
+    MPI_Comm_size(nodeComm, &nodeSize);
+
+    /*--- Each rank keeps its buffers in its own NUMA domain. ---*/
+    MPI_Info info;
+    MPI_Info_create(&info);
+    MPI_Info_set(info, "alloc_shared_noncontig", "true");
+
+    for (int iWin = 0; iWin < N_WIN; ++iWin) {
+      MPI_Win_allocate_shared(bytes[iWin], dispUnit[iWin], info, nodeComm, &local[iWin], &win[iWin]);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win[iWin]);
+      memset(local[iWin], 0, bytes[iWin]);
+
+      base[iWin].assign(nodeSize, nullptr);
+      for (int iNode = 0; iNode < nodeSize; ++iNode) {
+        MPI_Aint size;
+        int unit;
+        MPI_Win_shared_query(win[iWin], iNode, &size, &unit, &base[iWin][iNode]);
+      }
+    }
+    MPI_Info_free(&info);
+    allocated = true;
+  }
+
+  void Free() {
+    if (!allocated) return;
+    for (auto& w : win) {
+      MPI_Win_unlock_all(w);
+      MPI_Win_free(&w);
+    }
+    allocated = false;
+  }
+
+  /*!
+   * \brief Tell the neighbors on the node that send to this rank that its buffer can be written.
+   */
+  void PostReady(bool reverse, const int* neighbors, int nRecv) {
+    if (!readyRequests.empty()) MPI_Waitall(readyRequests.size(), readyRequests.data(), MPI_STATUSES_IGNORE);
+    readyRequests.clear();
+    for (int iRecv = 0; iRecv < nRecv; ++iRecv) {
+      if (!RecvOnNode(iRecv, reverse)) continue;
+      readyRequests.emplace_back();
+      MPI_Isend(nullptr, 0, MPI_BYTE, neighbors[iRecv], READY_TAG, readyComm, &readyRequests.back());
+    }
+  }
+#endif
+};
 
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
@@ -94,12 +197,19 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
-  delete[] bufD_P2PRecv;
-  delete[] bufD_P2PSend;
+  if (!sharedP2P) {
+    delete[] bufD_P2PRecv;
+    delete[] bufD_P2PSend;
+
+    delete[] bufS_P2PRecv;
+    delete[] bufS_P2PSend;
 
-  delete[] bufS_P2PRecv;
-  delete[] bufS_P2PSend;
+    delete[] bufF_P2PRecv;
+    delete[] bufF_P2PSend;
+  }
+  sharedP2P.reset();
 
+  FreeP2PPersistentRequests();
   delete[] req_P2PSend;
   delete[] req_P2PRecv;
 
@@ -277,6 +387,9 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
   bufS_P2PSend = nullptr;
   bufS_P2PRecv = nullptr;
 
+  bufF_P2PSend = nullptr;
+  bufF_P2PRecv = nullptr;
+
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
   if (nP2PSend > 0) {
@@ -286,6 +399,69 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
     req_P2PRecv = new SU2_MPI::Request[nP2PRecv];
   }
 
+  /*--- The requests can be persistent since the pattern of the comms is fixed (not available with AD types). ---*/
+
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  FreeP2PPersistentRequests();
+  persistentP2P = config->GetPersistent_MPI_Comms();
+#endif
+
+  /*--- The neighbors on the same node can exchange the data through shared memory. ---*/
+
+  sharedP2P.reset();
+#ifdef HAVE_SHARED_P2P
+  if (config->GetShared_Memory_Comms() && size > SINGLE_NODE) {
+    sharedP2P.reset(new CSharedP2PComms);
+    auto& shm = *sharedP2P;
+    const auto comm = SU2_MPI::GetComm();
+
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &shm.nodeComm);
+    MPI_Comm_dup(comm, &shm.readyComm);
+
+    MPI_Group group, nodeGroup;
+    MPI_Comm_group(comm, &group);
+    MPI_Comm_group(shm.nodeComm, &nodeGroup);
+    shm.nodeRankSend.resize(nP2PSend);
+    shm.nodeRankRecv.resize(nP2PRecv);
+    MPI_Group_translate_ranks(group, nP2PSend, Neighbors_P2PSend, nodeGroup, shm.nodeRankSend.data());
+    MPI_Group_translate_ranks(group, nP2PRecv, Neighbors_P2PRecv, nodeGroup, shm.nodeRankRecv.data());
+    MPI_Group_free(&group);
+    MPI_Group_free(&nodeGroup);
+    for (auto& nodeRank : shm.nodeRankSend) nodeRank = (nodeRank == MPI_UNDEFINED) ? -1 : nodeRank;
+    for (auto& nodeRank : shm.nodeRankRecv) nodeRank = (nodeRank == MPI_UNDEFINED) ? -1 : nodeRank;
+
+    /*--- The sender writes into the buffer of the receiver, hence it needs the offsets of its messages
+     in the buffers of the neighbors, the recv buffer for forward comms and the send buffer for reverse. ---*/
+
+    shm.remoteRecvOffset.resize(nP2PSend);
+    shm.remoteSendOffset.resize(nP2PRecv);
+    vector<MPI_Request> requests(2 * (nP2PSend + nP2PRecv));
+    auto request = requests.data();
+    for (iSend = 0; iSend < nP2PSend; iSend++) {
+      MPI_Irecv(&shm.remoteRecvOffset[iSend], 1, MPI_INT, Neighbors_P2PSend[iSend], CSharedP2PComms::OFFSET_TAG_RECV,
+                shm.readyComm, request++);
+      MPI_Isend(&nPoint_P2PSend[iSend], 1, MPI_INT, Neighbors_P2PSend[iSend], CSharedP2PComms::OFFSET_TAG_SEND,
+                shm.readyComm, request++);
+    }
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      MPI_Irecv(&shm.remoteSendOffset[iRecv], 1, MPI_INT, Neighbors_P2PRecv[iRecv], CSharedP2PComms::OFFSET_TAG_SEND,
+                shm.readyComm, request++);
+      MPI_Isend(&nPoint_P2PRecv[iRecv], 1, MPI_INT, Neighbors_P2PRecv[iRecv], CSharedP2PComms::OFFSET_TAG_RECV,
+                shm.readyComm, request++);
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    unsigned long nOnNode[2] = {0, 0}, nTotal[2] = {0, 0};
+    for (auto nodeRank : shm.nodeRankSend) nOnNode[0] += (nodeRank >= 0);
+    nOnNode[1] = nP2PSend;
+    SU2_MPI::Reduce(nOnNode, nTotal, 2, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, comm);
+    if (rank == MASTER_NODE) {
+      cout << "Shared memory halo exchanges: " << nTotal[0] << " of " << nTotal[1]
+           << " point-to-point messages are between ranks of the same node." << endl;
+    }
+  }
+#endif
+
   /*--- Build lists of local index values for send. ---*/
 
   count = 0;
@@ -346,19 +522,51 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     maxCountPerPoint = countPerPoint;
 
+    /*--- The persistent requests refer to the buffers. ---*/
+
+    FreeP2PPersistentRequests();
+
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
-    delete[] bufD_P2PSend;
-    bufD_P2PSend = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+    if (sharedP2P) {
+#ifdef HAVE_SHARED_P2P
+      /*--- The neighbors on the node write into these buffers, they are MPI shared windows. ---*/
+
+      const size_t nSend = maxCountPerPoint * nPoint_P2PSend[nP2PSend];
+      const size_t nRecv = maxCountPerPoint * nPoint_P2PRecv[nP2PRecv];
+      const size_t bytes[] = {nSend * sizeof(su2double),      nRecv * sizeof(su2double),
+                              nSend * sizeof(unsigned short), nRecv * sizeof(unsigned short),
+                              nSend * sizeof(float),          nRecv * sizeof(float)};
+      const int dispUnit[] = {sizeof(su2double),      sizeof(su2double), sizeof(unsigned short),
+                              sizeof(unsigned short), sizeof(float),     sizeof(float)};
+      sharedP2P->Allocate(bytes, dispUnit);
+
+      bufD_P2PSend = static_cast<su2double*>(sharedP2P->local[CSharedP2PComms::WIN_D_SEND]);
+      bufD_P2PRecv = static_cast<su2double*>(sharedP2P->local[CSharedP2PComms::WIN_D_RECV]);
+      bufS_P2PSend = static_cast<unsigned short*>(sharedP2P->local[CSharedP2PComms::WIN_S_SEND]);
+      bufS_P2PRecv = static_cast<unsigned short*>(sharedP2P->local[CSharedP2PComms::WIN_S_RECV]);
+      bufF_P2PSend = static_cast<float*>(sharedP2P->local[CSharedP2PComms::WIN_F_SEND]);
+      bufF_P2PRecv = static_cast<float*>(sharedP2P->local[CSharedP2PComms::WIN_F_RECV]);
+#endif
+    } else {
+      delete[] bufD_P2PSend;
+      bufD_P2PSend = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
 
-    delete[] bufD_P2PRecv;
-    bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+      delete[] bufD_P2PRecv;
+      bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
 
-    delete[] bufS_P2PSend;
-    bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+      delete[] bufS_P2PSend;
+      bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
 
-    delete[] bufS_P2PRecv;
-    bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+      delete[] bufS_P2PRecv;
+      bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+
+      delete[] bufF_P2PSend;
+      bufF_P2PSend = new float[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+
+      delete[] bufF_P2PRecv;
+      bufF_P2PRecv = new float[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+    }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
@@ -369,6 +577,19 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
 
+  if (persistentP2P) {
+    SU2_OMP_MASTER {
+      const auto& requests = GetP2PPersistentRequests(commType, countPerPoint, val_reverse);
+      copy(requests.begin() + nP2PSend, requests.end(), req_P2PRecv);
+      SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+#ifdef HAVE_SHARED_P2P
+      if (sharedP2P) sharedP2P->PostReady(val_reverse, val_reverse ? Neighbors_P2PSend : Neighbors_P2PRecv, nP2PRecv);
+#endif
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   SU2_OMP_MASTER
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
@@ -389,9 +610,11 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
       auto nPointP2P = nPoint_P2PSend[iRecv + 1] - nPoint_P2PSend[iRecv];
 
-      /*--- Total count can include multiple pieces of data per element. ---*/
+      /*--- Total count can include multiple pieces of data per element, the
+       neighbors on the same node write the data directly (PutP2PShared). ---*/
 
       auto count = countPerPoint * nPointP2P;
+      if (sharedP2P && sharedP2P->RecvOnNode(iRecv, val_reverse)) count = 0;
 
       /*--- Get the rank from which we receive the message. Note again
        that we use the send rank as the source instead of the recv rank. ---*/
@@ -412,6 +635,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iRecv]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PSend[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iRecv]));
+          break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
           break;
@@ -427,9 +654,11 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
       auto nPointP2P = nPoint_P2PRecv[iRecv + 1] - nPoint_P2PRecv[iRecv];
 
-      /*--- Total count can include multiple pieces of data per element. ---*/
+      /*--- Total count can include multiple pieces of data per element, the
+       neighbors on the same node write the data directly (PutP2PShared). ---*/
 
       auto count = countPerPoint * nPointP2P;
+      if (sharedP2P && sharedP2P->RecvOnNode(iRecv, val_reverse)) count = 0;
 
       /*--- Get the rank from which we receive the message. ---*/
 
@@ -447,6 +676,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iMessage]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iMessage]));
+          break;
         default:
           SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
           break;
@@ -454,6 +687,14 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
     }
   }
   END_SU2_OMP_MASTER
+
+#ifdef HAVE_SHARED_P2P
+  if (sharedP2P) {
+    SU2_OMP_MASTER
+    sharedP2P->PostReady(val_reverse, val_reverse ? Neighbors_P2PSend : Neighbors_P2PRecv, nP2PRecv);
+    END_SU2_OMP_MASTER
+  }
+#endif
 }
 
 void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType,
@@ -464,6 +705,16 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
 
+  if (persistentP2P) {
+    SU2_OMP_MASTER {
+      req_P2PSend[val_iSend] = GetP2PPersistentRequests(commType, countPerPoint, val_reverse)[val_iSend];
+      PutP2PShared(commType, countPerPoint, val_iSend, val_reverse);
+      SU2_MPI::Start(&req_P2PSend[val_iSend]);
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   SU2_OMP_MASTER
   if (val_reverse) {
     /*--- Compute our location in the buffer using the recv data
@@ -477,9 +728,11 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
 
     auto nPointP2P = nPoint_P2PRecv[val_iSend + 1] - nPoint_P2PRecv[val_iSend];
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
+    /*--- Total count can include multiple pieces of data per element, no data
+     is sent to the neighbors on the same node, it is copied directly. ---*/
 
     auto count = countPerPoint * nPointP2P;
+    if (PutP2PShared(commType, countPerPoint, val_iSend, val_reverse)) count = 0;
 
     /*--- Get the rank to which we send the message. Note again
      that we use the recv rank as the dest instead of the send rank. ---*/
@@ -500,6 +753,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
         break;
@@ -515,9 +772,11 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
 
     auto nPointP2P = nPoint_P2PSend[val_iSend + 1] - nPoint_P2PSend[val_iSend];
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
+    /*--- Total count can include multiple pieces of data per element, no data
+     is sent to the neighbors on the same node, it is copied directly. ---*/
 
     auto count = countPerPoint * nPointP2P;
+    if (PutP2PShared(commType, countPerPoint, val_iSend, val_reverse)) count = 0;
 
     /*--- Get the rank to which we send the message. ---*/
 
@@ -535,6 +794,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PSend[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       default:
         SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
         break;
@@ -543,6 +806,133 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
   END_SU2_OMP_MASTER
 }
 
+const vector<SU2_MPI::Request>& CGeometry::GetP2PPersistentRequests(unsigned short commType,
+                                                                    unsigned short countPerPoint,
+                                                                    bool val_reverse) const {
+  auto& requests = P2PPersistentRequests[make_tuple(commType, countPerPoint, val_reverse)];
+  if (!requests.empty() || nP2PSend + nP2PRecv == 0) return requests;
+
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  requests.resize(nP2PSend + nP2PRecv);
+
+  /*--- Create one request for a message, the offsets and counts are given by the cumulative
+   number of points of the send or recv structures, in reverse mode their roles are swapped
+   (but not the buffers, as in PostP2PSends and PostP2PRecvs). ---*/
+
+  auto init = [&](bool send, const int* nPointCumulative, const int* neighbors, int iMessage, bool sendBuffer,
+                  SU2_MPI::Request* request) {
+    const auto offset = countPerPoint * nPointCumulative[iMessage];
+    auto count = countPerPoint * (nPointCumulative[iMessage + 1] - nPointCumulative[iMessage]);
+    const auto neighbor = neighbors[iMessage];
+
+    /*--- The data of the neighbors on the same node is copied directly (PutP2PShared). ---*/
+    if (sharedP2P && (send ? sharedP2P->SendOnNode(iMessage, val_reverse) : sharedP2P->RecvOnNode(iMessage, val_reverse)))
+      count = 0;
+
+    void* buf = nullptr;
+    SU2_MPI::Datatype datatype = MPI_DOUBLE;
+
+    switch (commType) {
+      case COMM_TYPE_DOUBLE:
+        buf = (sendBuffer ? bufD_P2PSend : bufD_P2PRecv) + offset;
+        datatype = MPI_DOUBLE;
+        break;
+      case COMM_TYPE_UNSIGNED_SHORT:
+        buf = (sendBuffer ? bufS_P2PSend : bufS_P2PRecv) + offset;
+        datatype = MPI_UNSIGNED_SHORT;
+        break;
+      case COMM_TYPE_FLOAT:
+        buf = (sendBuffer ? bufF_P2PSend : bufF_P2PRecv) + offset;
+        datatype = MPI_FLOAT;
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+
+    /*--- Same tags as the non-persistent comms. ---*/
+    if (send) {
+      SU2_MPI::Send_init(buf, count, datatype, neighbor, rank + 1, SU2_MPI::GetComm(), request);
+    } else {
+      SU2_MPI::Recv_init(buf, count, datatype, neighbor, neighbor + 1, SU2_MPI::GetComm(), request);
+    }
+  };
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    if (val_reverse)
+      init(true, nPoint_P2PRecv, Neighbors_P2PRecv, iSend, false, &requests[iSend]);
+    else
+      init(true, nPoint_P2PSend, Neighbors_P2PSend, iSend, true, &requests[iSend]);
+  }
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    if (val_reverse)
+      init(false, nPoint_P2PSend, Neighbors_P2PSend, iRecv, true, &requests[nP2PSend + iRecv]);
+    else
+      init(false, nPoint_P2PRecv, Neighbors_P2PRecv, iRecv, false, &requests[nP2PSend + iRecv]);
+  }
+#endif
+  return requests;
+}
+
+bool CGeometry::PutP2PShared(unsigned short commType, unsigned short countPerPoint, int val_iSend,
+                             bool val_reverse) const {
+  if (!sharedP2P || !sharedP2P->SendOnNode(val_iSend, val_reverse)) return false;
+
+#ifdef HAVE_SHARED_P2P
+  const auto& shm = *sharedP2P;
+
+  /*--- In reverse mode the recv structures and buffer are used to send, into the send buffer of the neighbor. ---*/
+
+  const int* nPointCumulative = val_reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+  const auto dest = (val_reverse ? Neighbors_P2PRecv : Neighbors_P2PSend)[val_iSend];
+  const auto nodeRank = (val_reverse ? shm.nodeRankRecv : shm.nodeRankSend)[val_iSend];
+  const auto remoteOffset = countPerPoint * (val_reverse ? shm.remoteSendOffset : shm.remoteRecvOffset)[val_iSend];
+  const auto offset = countPerPoint * nPointCumulative[val_iSend];
+  const auto count = countPerPoint * (nPointCumulative[val_iSend + 1] - nPointCumulative[val_iSend]);
+
+  /*--- Wait until the neighbor has posted its recvs, i.e. it no longer reads the data of the previous comms. ---*/
+
+  MPI_Recv(nullptr, 0, MPI_BYTE, dest, CSharedP2PComms::READY_TAG, shm.readyComm, MPI_STATUS_IGNORE);
+
+  /*--- Copy, and synchronize the memory before the (empty) message notifies the neighbor. ---*/
+
+  switch (commType) {
+    case COMM_TYPE_DOUBLE: {
+      const int iWin = val_reverse ? CSharedP2PComms::WIN_D_SEND : CSharedP2PComms::WIN_D_RECV;
+      const su2double* data = (val_reverse ? bufD_P2PRecv : bufD_P2PSend) + offset;
+      copy(data, data + count, static_cast<su2double*>(shm.base[iWin][nodeRank]) + remoteOffset);
+      MPI_Win_sync(shm.win[iWin]);
+      break;
+    }
+    case COMM_TYPE_UNSIGNED_SHORT: {
+      const int iWin = val_reverse ? CSharedP2PComms::WIN_S_SEND : CSharedP2PComms::WIN_S_RECV;
+      const unsigned short* data = (val_reverse ? bufS_P2PRecv : bufS_P2PSend) + offset;
+      copy(data, data + count, static_cast<unsigned short*>(shm.base[iWin][nodeRank]) + remoteOffset);
+      MPI_Win_sync(shm.win[iWin]);
+      break;
+    }
+    case COMM_TYPE_FLOAT: {
+      const int iWin = val_reverse ? CSharedP2PComms::WIN_F_SEND : CSharedP2PComms::WIN_F_RECV;
+      const float* data = (val_reverse ? bufF_P2PRecv : bufF_P2PSend) + offset;
+      copy(data, data + count, static_cast<float*>(shm.base[iWin][nodeRank]) + remoteOffset);
+      MPI_Win_sync(shm.win[iWin]);
+      break;
+    }
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+      break;
+  }
+#endif
+  return true;
+}
+
+void CGeometry::FreeP2PPersistentRequests() {
+  for (auto& type : P2PPersistentRequests) {
+    for (auto& request : type.second) SU2_MPI::Request_free(&request);
+  }
+  P2PPersistentRequests.clear();
+}
+
 void CGeometry::GetCommCountAndType(const CConfig* config, unsigned short commType, unsigned short& COUNT_PER_POINT,
                                     unsigned short& MPI_TYPE) const {
   switch (commType) {
@@ -577,6 +967,7 @@ void CGeometry::GetCommCountAndType(const CConfig* config, unsigned short commTy
 
 void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsigned short commType) const {
   if (nP2PSend == 0) return;
+  SU2_PHASE_TIMER(HALO_COMMS);
 
   /*--- Local variables ---*/
 
@@ -674,6 +1065,7 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsign
 
 void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, unsigned short commType) {
   if (nP2PRecv == 0) return;
+  SU2_PHASE_TIMER(HALO_COMMS);
 
   /*--- Local variables ---*/
 
@@ -935,6 +1327,29 @@ void CGeometry::PreprocessPeriodicComms(CGeometry* geometry, CConfig* config) {
     req_PeriodicRecv = new SU2_MPI::Request[nPeriodicRecv];
   }
 
+  /*--- The pairs of periodic markers are normally communicated one after the
+   other, so that the data of points shared by adjacent periodic faces (e.g.
+   edges of a periodic box) is accumulated correctly. When no point belongs to
+   more than one pair, the order does not matter and one exchange can update all
+   the pairs. All ranks must agree, since the number of messages depends on it. ---*/
+
+  const unsigned short nPeriodicPair = config->GetnMarker_Periodic() / 2;
+  vector<unsigned short> pairOfPoint(geometry->GetnPoint(), 0);
+  int disjoint = 1;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) continue;
+    const unsigned short iPair = (config->GetMarker_All_PerBound(iMarker) - 1) % nPeriodicPair + 1;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (pairOfPoint[iPoint] != 0 && pairOfPoint[iPoint] != iPair) disjoint = 0;
+      pairOfPoint[iPoint] = iPair;
+    }
+  }
+  int allDisjoint = disjoint;
+  SU2_MPI::Allreduce(&disjoint, &allDisjoint, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  disjointPeriodicPairs = (allDisjoint != 0);
+
   /*--- Allocate arrays for sending the periodic point index and marker
    index to the recv rank so that it can store the local values. Therefore,
    the recv rank can quickly loop through the buffers to unpack the data. ---*/
@@ -1247,34 +1662,59 @@ void CGeometry::PostPeriodicSends(CGeometry* geometry, const CConfig* config, un
 }
 
 void CGeometry::SetEdges() {
-  nEdge = 0;
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
-        if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
-          }
-          break;
-        }
+  /*--- The edge (i,j) belongs to the smallest point, the edges of each point are counted in a first pass and
+   * numbered in a second (threaded) pass, which gives the same numbering as visiting the points in order. ---*/
+
+  su2vector<unsigned long> edgePtr(nPoint + 1);
+
+  /*--- Position of iPoint in the neighbors of jPoint, the pattern is symmetric unless the mesh is broken. ---*/
+  auto FindNeighbor = [this](unsigned long jPoint, unsigned long iPoint) {
+    for (unsigned short jNode = 0; jNode < nodes->GetnPoint(jPoint); jNode++) {
+      if (nodes->GetPoint(jPoint, jNode) == iPoint) return jNode;
+    }
+    return nodes->GetnPoint(jPoint);
+  };
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      unsigned long nEdgePoint = 0;
+      for (auto jPoint : nodes->GetPoints(iPoint)) {
+        if (jPoint > iPoint && FindNeighbor(jPoint, iPoint) < nodes->GetnPoint(jPoint)) ++nEdgePoint;
       }
+      edgePtr(iPoint + 1) = nEdgePoint;
     }
-  }
+    END_SU2_OMP_FOR
 
-  edges = new CEdge(nEdge, nDim);
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      edgePtr(0) = 0;
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) edgePtr(iPoint + 1) += edgePtr(iPoint);
+      nEdge = edgePtr(nPoint);
+      edges = new CEdge(nEdge, nDim);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto jPoint : nodes->GetPoints(iPoint)) {
-      if (iPoint < jPoint) {
-        auto iEdge = FindEdge(iPoint, jPoint);
+    /*--- Each edge is set by its first point, on both points, there are no races. ---*/
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      auto iEdge = edgePtr(iPoint);
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = nodes->GetPoint(iPoint, iNode);
+        if (jPoint < iPoint) continue;
+        const auto jNode = FindNeighbor(jPoint, iPoint);
+        if (jNode == nodes->GetnPoint(jPoint)) continue;
+
+        nodes->SetEdge(iPoint, iEdge, iNode);
+        nodes->SetEdge(jPoint, iEdge, jNode);
         edges->SetNodes(iEdge, iPoint, jPoint);
+        ++iEdge;
       }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+
   edges->SetPaddingNodes();
 }
 
@@ -1553,7 +1993,7 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
       JGlobalID_Airfoil;
   vector<unsigned short> Conection_Index0, Conection_Index1;
   vector<unsigned long> Duplicate;
-  su2double** Coord_Variation = nullptr;
+  su2activematrix Coord_Variation;
   vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
   vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
   vector<bool> AddExtra;
@@ -1591,8 +2031,7 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
    we should go from vertex to points ---*/
 
   if (!original_surface) {
-    Coord_Variation = new su2double*[nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++) Coord_Variation[iPoint] = new su2double[nDim];
+    Coord_Variation.resize(nPoint, nDim) = su2double(0.0);
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_GeoEval(iMarker) == YES) {
@@ -1610,6 +2049,25 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
       for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
         PointIndex = 0;
 
+        /*--- In 3D, skip the elements whose nodes are all on the same side of the plane, none of their
+         edges can intersect it. The signed distances are measured as in SegmentIntersectsPlane. ---*/
+
+        if (nDim == 3) {
+          bool anyAbove = false, anyBelow = false;
+          for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            iPoint = bound[iMarker][iElem]->GetNode(iNode);
+            su2double Dist = 0.0;
+            for (iDim = 0; iDim < 3; iDim++) {
+              su2double Coord = nodes->GetCoord(iPoint, iDim);
+              if (!original_surface) Coord += Coord_Variation[iPoint][iDim];
+              Dist += (Plane_Normal[iDim] + 1E-6) * (Coord - (Plane_P0[iDim] + 1E-6));
+            }
+            anyAbove |= (Dist >= 0.0);
+            anyBelow |= (Dist <= 0.0);
+          }
+          if (!anyAbove || !anyBelow) continue;
+        }
+
         /*--- To decide if an element is going to be used or not should be done element based,
          The first step is to compute and average coordinate for the element ---*/
 
@@ -1757,11 +2215,6 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
     }
   }
 
-  if (!original_surface) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++) delete[] Coord_Variation[iPoint];
-    delete[] Coord_Variation;
-  }
-
 #ifdef HAVE_MPI
 
   /*--- Copy the coordinates of all the points in the plane to the master node ---*/
@@ -2346,6 +2799,35 @@ void CGeometry::UpdateGeometry(CGeometry** geometry_container, CConfig* config)
   geometry_container[MESH_0]->ComputeSurfaceAreaCfgFile(config);
 }
 
+void CGeometry::RotateDualGrid(const su2double rotMatrix[][3]) {
+  auto rotate = [&](const su2double* normal, su2double* rotNormal) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      rotNormal[iDim] = 0.0;
+      for (unsigned short jDim = 0; jDim < nDim; jDim++) rotNormal[iDim] += rotMatrix[iDim][jDim] * normal[jDim];
+    }
+  };
+
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    su2double Normal[MAXNDIM] = {0.0};
+    rotate(edges->GetNormal(iEdge), Normal);
+    edges->SetNormal(iEdge, Normal);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_DYN(1)
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      su2double Normal[MAXNDIM] = {0.0};
+      rotate(vertex[iMarker][iVertex]->GetNormal(), Normal);
+      vertex[iMarker][iVertex]->SetNormal(Normal);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(lsqWeights.Invalidate();)
+}
+
 void CGeometry::SetCustomBoundary(CConfig* config) {
   unsigned short iMarker;
   unsigned long iVertex;
@@ -2967,208 +3449,206 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
   /*--- Check if we need to do any work. ---*/
   if (kernels.empty()) return;
 
-  /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
-  processor, this is required because the filter reaches far into adjacent partitions. ---*/
+  /*--- The neighbourhoods (stencils) only depend on the radii, they are searched on the first call
+  and the filter then becomes a sparse matrix-vector product over local and fetched remote values,
+  which is also what gets recorded for the adjoint. ---*/
 
-  /*--- Adjacency matrix ---*/
-  vector<unsigned long> neighbour_start;
-  long* neighbour_idx = nullptr;
-  GetGlobalElementAdjacencyMatrix(neighbour_start, neighbour_idx);
+  vector<passivedouble> radius;
+  for (const auto& r : filter_radius) radius.push_back(SU2_TYPE::GetValue(r));
 
-  /*--- Element centroids and volumes. ---*/
-  auto *cg_elem = new su2double[Global_nElemDomain * nDim], *vol_elem = new su2double[Global_nElemDomain];
-#ifdef HAVE_MPI
-  /*--- Number of subdomain each point is part of. ---*/
-  vector<char> halo_detect(Global_nElemDomain);
-#endif
+  if (radius != elemFilterInfo.radius || search_limit != elemFilterInfo.searchLimit)
+    SetElementFilterStencils(radius, search_limit);
 
-  /*--- Inputs of a filter stage, like with CG and volumes, each processor needs to see everything. ---*/
-  auto* work_values = new su2double[Global_nElemDomain];
+  const auto& info = elemFilterInfo;
 
-  /*--- When gathering the neighborhood of each element we use a vector of booleans to indicate
-  whether an element is already added to the list of neighbors (one vector per thread). ---*/
-  vector<vector<bool>> is_neighbor(omp_get_max_threads());
+  /*--- Values of the local elements followed by those of the remote elements referenced by the stencils. ---*/
+  auto fetchRemote = [&](const su2double* local, unsigned short nVal, vector<su2double>& full) {
+    const auto nRecv = info.recvDispl[size];
+    full.resize((nElem + nRecv) * nVal);
+    for (auto i = 0ul; i < nElem * nVal; ++i) full[i] = local[i];
 
-  /*--- Begin OpenMP parallel section, count total number of searches for which
-  the recursion limit is reached and the full neighborhood is not considered. ---*/
-  unsigned long limited_searches = 0;
+    auto scaled = [&](const vector<int>& v) {
+      vector<int> w(v.size());
+      for (auto i = 0ul; i < v.size(); ++i) w[i] = nVal * v[i];
+      return w;
+    };
+    vector<su2double> sendBuf(info.sendElem.size() * nVal);
+    for (auto i = 0ul; i < info.sendElem.size(); ++i)
+      for (auto iVal = 0u; iVal < nVal; ++iVal) sendBuf[i * nVal + iVal] = local[info.sendElem[i] * nVal + iVal];
 
-  SU2_OMP_PARALLEL_(reduction(+ : limited_searches)) {
-    /*--- Initialize ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] = 0.0;
-      vol_elem[iElem] = 0.0;
-    }
-    END_SU2_OMP_FOR
+    SU2_MPI::Alltoallv(sendBuf.data(), scaled(info.sendCount).data(), scaled(info.sendDispl).data(), MPI_DOUBLE,
+                       &full[nElem * nVal], scaled(info.recvCount).data(), scaled(info.recvDispl).data(),
+                       MPI_DOUBLE, SU2_MPI::GetComm());
+  };
 
-    /*--- Populate ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-      auto iElem_global = elem[iElem]->GetGlobalIndex();
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem_global + iDim] = elem[iElem]->GetCG(iDim);
-      vol_elem[iElem_global] = elem[iElem]->GetVolume();
-    }
-    END_SU2_OMP_FOR
+  /*--- Element centroids and volumes. ---*/
+  vector<su2double> cg_local(nElem * nDim), vol_local(nElem), cg_elem, vol_elem, work_values;
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_local[nDim * iElem + iDim] = elem[iElem]->GetCG(iDim);
+    vol_local[iElem] = elem[iElem]->GetVolume();
+  }
+  fetchRemote(cg_local.data(), nDim, cg_elem);
+  fetchRemote(vol_local.data(), 1, vol_elem);
 
-#ifdef HAVE_MPI
-    /*--- Account for the duplication introduced by the halo elements and the
-    reduction using MPI_SUM, which is required to maintain differentiabillity. ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) halo_detect[iElem] = 0;
-    END_SU2_OMP_FOR
+  for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
+    auto kernel_type = kernels[iKernel].first;
+    su2double kernel_param = kernels[iKernel].second;
+    su2double kernel_radius = filter_radius[iKernel];
+    const auto& stencil = info.stencils[iKernel];
 
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) halo_detect[elem[iElem]->GetGlobalIndex()] = 1;
-    END_SU2_OMP_FOR
+    /*--- Inputs of this stage are the outputs of the previous. ---*/
+    fetchRemote(values, 1, work_values);
 
-    /*--- Share with all processors ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      auto* dbl_buffer = new su2double[Global_nElemDomain * nDim];
-      SU2_MPI::Allreduce(cg_elem, dbl_buffer, Global_nElemDomain * nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, cg_elem);
-      delete[] dbl_buffer;
-
-      dbl_buffer = new su2double[Global_nElemDomain];
-      SU2_MPI::Allreduce(vol_elem, dbl_buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, vol_elem);
-      delete[] dbl_buffer;
+    /*--- Filter ---*/
+    SU2_OMP_PARALLEL_(for schedule(dynamic, 128))
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      /*--- Apply the kernel ---*/
+      su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
+
+      switch (kernel_type) {
+        /*--- distance-based kernels (weighted averages) ---*/
+        case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
+        case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
+        case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
+
+          for (auto k = 0ul; k < stencil.getNumNonZeros(iElem); ++k) {
+            const auto idx = stencil.innerIdx(iElem)[k];
+            su2double distance = 0.0;
+            for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+              distance += pow(cg_elem[nDim * iElem + iDim] - cg_elem[nDim * idx + iDim], 2);
+            distance = sqrt(distance);
+
+            switch (kernel_type) {
+              case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
+                weight = 1.0;
+                break;
+              case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
+                weight = kernel_radius - distance;
+                break;
+              case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
+                weight = exp(-0.5 * pow(distance / kernel_param, 2));
+                break;
+              default:
+                break;
+            }
+            weight *= vol_elem[idx];
+            numerator += weight * work_values[idx];
+            denominator += weight;
+          }
+          values[iElem] = numerator / denominator;
+          break;
 
-      vector<char> char_buffer(Global_nElemDomain);
-      MPI_Allreduce(halo_detect.data(), char_buffer.data(), Global_nElemDomain, MPI_CHAR, MPI_SUM, SU2_MPI::GetComm());
-      halo_detect.swap(char_buffer);
-    }
-    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+        /*--- morphology kernels (image processing) ---*/
+        case ENUM_FILTER_KERNEL::DILATE_MORPH:
+        case ENUM_FILTER_KERNEL::ERODE_MORPH:
+
+          for (auto k = 0ul; k < stencil.getNumNonZeros(iElem); ++k) {
+            const auto idx = stencil.innerIdx(iElem)[k];
+            switch (kernel_type) {
+              case ENUM_FILTER_KERNEL::DILATE_MORPH:
+                numerator += exp(kernel_param * work_values[idx]);
+                break;
+              case ENUM_FILTER_KERNEL::ERODE_MORPH:
+                numerator += exp(kernel_param * (1.0 - work_values[idx]));
+                break;
+              default:
+                break;
+            }
+            denominator += 1.0;
+          }
+          values[iElem] = log(numerator / denominator) / kernel_param;
+          if (kernel_type == ENUM_FILTER_KERNEL::ERODE_MORPH) values[iElem] = 1.0 - values[iElem];
+          break;
 
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      su2double numRepeat = halo_detect[iElem];
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] /= numRepeat;
-      vol_elem[iElem] /= numRepeat;
+        default:
+          SU2_MPI::Error("Unknown type of filter kernel", CURRENT_FUNCTION);
+      }
     }
-    END_SU2_OMP_FOR
-#endif
-
-    /*--- SECOND: Each processor performs the average for its elements. For each
-    element we look for neighbours of neighbours of... until the distance to the
-    closest newly found one is greater than the filter radius.  ---*/
+    END_SU2_OMP_PARALLEL
+  }
+}
 
-    is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain, false);
+void CGeometry::SetElementFilterStencils(const vector<passivedouble>& radius, unsigned short search_limit) const {
+  /*--- The search requires the adjacency matrix and the element centroids of the entire mesh, because the
+  filter reaches far into adjacent partitions, but this is only done once. It does not need to be recorded. ---*/
 
-    for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
-      auto kernel_type = kernels[iKernel].first;
-      su2double kernel_param = kernels[iKernel].second;
-      su2double kernel_radius = filter_radius[iKernel];
+  const bool wasActive = AD::BeginPassive();
 
-      /*--- Synchronize work values ---*/
-      /*--- Initialize ---*/
-      SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) work_values[iElem] = 0.0;
-      END_SU2_OMP_FOR
+  auto& info = elemFilterInfo;
+  info.radius = radius;
+  info.searchLimit = search_limit;
 
-      /*--- Populate ---*/
-      SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < nElem; ++iElem) work_values[elem[iElem]->GetGlobalIndex()] = values[iElem];
-      END_SU2_OMP_FOR
+  /*--- Adjacency matrix ---*/
+  vector<unsigned long> neighbour_start;
+  long* neighbour_idx = nullptr;
+  GetGlobalElementAdjacencyMatrix(neighbour_start, neighbour_idx);
 
+  /*--- Element centroids, the owner of each element (lowest rank where it is present), and the
+  local index of the elements present on this rank. ---*/
+  vector<su2double> cg_elem(Global_nElemDomain * nDim, 0.0);
+  vector<int> owner(Global_nElemDomain, size);
+  vector<long> globalToLocal(Global_nElemDomain, -1);
 #ifdef HAVE_MPI
-      /*--- Share with all processors ---*/
-      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-        auto* buffer = new su2double[Global_nElemDomain];
-        SU2_MPI::Allreduce(work_values, buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        swap(buffer, work_values);
-        delete[] buffer;
-      }
-      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  /*--- Number of subdomain each element is part of. ---*/
+  vector<char> halo_detect(Global_nElemDomain, 0);
+#endif
 
-      /*--- Account for duplication ---*/
-      SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-        su2double numRepeat = halo_detect[iElem];
-        work_values[iElem] /= numRepeat;
-      }
-      END_SU2_OMP_FOR
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    auto iElem_global = elem[iElem]->GetGlobalIndex();
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem_global + iDim] = elem[iElem]->GetCG(iDim);
+    owner[iElem_global] = rank;
+    globalToLocal[iElem_global] = iElem;
+#ifdef HAVE_MPI
+    halo_detect[iElem_global] = 1;
 #endif
+  }
 
-      /*--- Filter ---*/
-      SU2_OMP_FOR_DYN(128)
-      for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-        int thread = omp_get_thread_num();
+#ifdef HAVE_MPI
+  /*--- Share with all processors ---*/
+  {
+    vector<su2double> dbl_buffer(Global_nElemDomain * nDim);
+    SU2_MPI::Allreduce(cg_elem.data(), dbl_buffer.data(), Global_nElemDomain * nDim, MPI_DOUBLE, MPI_SUM,
+                       SU2_MPI::GetComm());
+    cg_elem.swap(dbl_buffer);
 
-        /*--- Center of the search ---*/
-        auto iElem_global = elem[iElem]->GetGlobalIndex();
+    vector<char> char_buffer(Global_nElemDomain);
+    MPI_Allreduce(halo_detect.data(), char_buffer.data(), Global_nElemDomain, MPI_CHAR, MPI_SUM, SU2_MPI::GetComm());
+    halo_detect.swap(char_buffer);
 
-        /*--- Find the neighbours of iElem ---*/
-        vector<long> neighbours;
-        limited_searches +=
-            !GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius), search_limit, neighbour_start,
-                                    neighbour_idx, cg_elem, neighbours, is_neighbor[thread]);
-        /*--- Apply the kernel ---*/
-        su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
-
-        switch (kernel_type) {
-          /*--- distance-based kernels (weighted averages) ---*/
-          case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
-          case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
-          case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
-
-            for (auto idx : neighbours) {
-              su2double distance = 0.0;
-              for (unsigned short iDim = 0; iDim < nDim; ++iDim)
-                distance += pow(cg_elem[nDim * iElem_global + iDim] - cg_elem[nDim * idx + iDim], 2);
-              distance = sqrt(distance);
-
-              switch (kernel_type) {
-                case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
-                  weight = 1.0;
-                  break;
-                case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
-                  weight = kernel_radius - distance;
-                  break;
-                case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
-                  weight = exp(-0.5 * pow(distance / kernel_param, 2));
-                  break;
-                default:
-                  break;
-              }
-              weight *= vol_elem[idx];
-              numerator += weight * work_values[idx];
-              denominator += weight;
-            }
-            values[iElem] = numerator / denominator;
-            break;
+    vector<int> int_buffer(Global_nElemDomain);
+    SU2_MPI::Allreduce(owner.data(), int_buffer.data(), Global_nElemDomain, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+    owner.swap(int_buffer);
+  }
+  for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
+    su2double numRepeat = halo_detect[iElem];
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] /= numRepeat;
+  }
+#endif
 
-          /*--- morphology kernels (image processing) ---*/
-          case ENUM_FILTER_KERNEL::DILATE_MORPH:
-          case ENUM_FILTER_KERNEL::ERODE_MORPH:
+  /*--- For each element we look for neighbours of neighbours of... until the distance to the
+  closest newly found one is greater than the filter radius. ---*/
 
-            for (auto idx : neighbours) {
-              switch (kernel_type) {
-                case ENUM_FILTER_KERNEL::DILATE_MORPH:
-                  numerator += exp(kernel_param * work_values[idx]);
-                  break;
-                case ENUM_FILTER_KERNEL::ERODE_MORPH:
-                  numerator += exp(kernel_param * (1.0 - work_values[idx]));
-                  break;
-                default:
-                  break;
-              }
-              denominator += 1.0;
-            }
-            values[iElem] = log(numerator / denominator) / kernel_param;
-            if (kernel_type == ENUM_FILTER_KERNEL::ERODE_MORPH) values[iElem] = 1.0 - values[iElem];
-            break;
+  vector<vector<vector<long>>> neighbours(radius.size(), vector<vector<long>>(nElem));
+  unsigned long limited_searches = 0;
 
-          default:
-            SU2_MPI::Error("Unknown type of filter kernel", CURRENT_FUNCTION);
-        }
+  SU2_OMP_PARALLEL_(reduction(+ : limited_searches)) {
+    vector<bool> is_neighbor(Global_nElemDomain, false);
+
+    for (auto iKernel = 0ul; iKernel < radius.size(); ++iKernel) {
+      SU2_OMP_FOR_DYN(128)
+      for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+        limited_searches +=
+            !GetRadialNeighbourhood(elem[iElem]->GetGlobalIndex(), radius[iKernel], search_limit, neighbour_start,
+                                    neighbour_idx, cg_elem.data(), neighbours[iKernel][iElem], is_neighbor);
       }
       END_SU2_OMP_FOR
     }
   }
   END_SU2_OMP_PARALLEL
 
-  limited_searches /= kernels.size();
+  delete[] neighbour_idx;
+
+  limited_searches /= radius.size();
 
   unsigned long tmp = limited_searches;
   SU2_MPI::Reduce(&tmp, &limited_searches, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
@@ -3177,10 +3657,59 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
     cout << "Warning: The filter radius was limited for " << limited_searches << " elements ("
          << limited_searches / (0.01 * Global_nElemDomain) << "%).\n";
 
-  delete[] neighbour_idx;
-  delete[] cg_elem;
-  delete[] vol_elem;
-  delete[] work_values;
+  /*--- Remote elements referenced by the stencils, sorted by owner to define the receive buffer. ---*/
+
+  vector<long> remoteSlot(Global_nElemDomain, -1);
+  vector<unsigned long> remote;
+  for (const auto& stage : neighbours) {
+    for (const auto& list : stage) {
+      for (const auto idx : list) {
+        if (globalToLocal[idx] < 0 && remoteSlot[idx] < 0) {
+          remoteSlot[idx] = 0;
+          remote.push_back(idx);
+        }
+      }
+    }
+  }
+  sort(remote.begin(), remote.end(), [&](unsigned long a, unsigned long b) {
+    return make_pair(owner[a], a) < make_pair(owner[b], b);
+  });
+
+  info.recvCount.assign(size, 0);
+  for (auto i = 0ul; i < remote.size(); ++i) {
+    remoteSlot[remote[i]] = nElem + i;
+    info.recvCount[owner[remote[i]]]++;
+  }
+
+  /*--- Convert the stencils to local/remote indices. ---*/
+
+  info.stencils.clear();
+  for (auto& stage : neighbours) {
+    for (auto& list : stage) {
+      for (auto& idx : list) idx = (globalToLocal[idx] >= 0) ? globalToLocal[idx] : remoteSlot[idx];
+    }
+    info.stencils.emplace_back(stage);
+    vector<vector<long>>().swap(stage);
+  }
+
+  /*--- Tell the owners which of their elements are needed. ---*/
+
+  info.sendCount.resize(size);
+  SU2_MPI::Alltoall(info.recvCount.data(), 1, MPI_INT, info.sendCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  info.sendDispl.assign(size + 1, 0);
+  info.recvDispl.assign(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    info.sendDispl[iRank + 1] = info.sendDispl[iRank] + info.sendCount[iRank];
+    info.recvDispl[iRank + 1] = info.recvDispl[iRank] + info.recvCount[iRank];
+  }
+  info.sendElem.resize(info.sendDispl[size]);
+  SU2_MPI::Alltoallv(remote.data(), info.recvCount.data(), info.recvDispl.data(), MPI_UNSIGNED_LONG,
+                     info.sendElem.data(), info.sendCount.data(), info.sendDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+  for (auto& iElem : info.sendElem) iElem = globalToLocal[iElem];
+
+  AD::EndPassive(wasActive);
 }
 
 void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long>& neighbour_start, long*& neighbour_idx) const {
@@ -3574,10 +4103,10 @@ void CGeometry::SetGridVelocity(const CConfig* config) {
   }
 }
 
-const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl) {
+const CCompressedSparsePatternLocal& CGeometry::GetSparsePattern(ConnectivityType type, unsigned long fillLvl) {
   bool fvm = (type == ConnectivityType::FiniteVolume);
 
-  CCompressedSparsePatternUL* pattern = nullptr;
+  CCompressedSparsePatternLocal* pattern = nullptr;
 
   if (fillLvl == 0)
     pattern = fvm ? &finiteVolumeCSRFill0 : &finiteElementCSRFill0;
@@ -3585,26 +4114,26 @@ const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType t
     pattern = fvm ? &finiteVolumeCSRFillN : &finiteElementCSRFillN;
 
   if (pattern->empty()) {
-    *pattern = buildCSRPattern(*this, type, fillLvl);
+    *pattern = buildCSRPattern(*this, type, su2localindex(fillLvl));
     pattern->buildDiagPtr();
   }
 
   return *pattern;
 }
 
-const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap() {
+const CEdgeToNonZeroMapLocal& CGeometry::GetEdgeToSparsePatternMap() {
   if (edgeToCSRMap.empty()) {
     if (finiteVolumeCSRFill0.empty()) {
-      finiteVolumeCSRFill0 = buildCSRPattern(*this, ConnectivityType::FiniteVolume, 0ul);
+      finiteVolumeCSRFill0 = buildCSRPattern(*this, ConnectivityType::FiniteVolume, su2localindex(0));
     }
     edgeToCSRMap = mapEdgesToSparsePattern(*this, finiteVolumeCSRFill0);
   }
   return edgeToCSRMap;
 }
 
-const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(ConnectivityType type) {
+const su2vector<su2localindex>& CGeometry::GetTransposeSparsePatternMap(ConnectivityType type) {
   /*--- Yes the const cast is weird but it is still better than repeating code. ---*/
-  auto& pattern = const_cast<CCompressedSparsePatternUL&>(GetSparsePattern(type));
+  auto& pattern = const_cast<CCompressedSparsePatternLocal&>(GetSparsePattern(type));
   pattern.buildTransposePtr();
   return pattern.transposePtr();
 }
@@ -3622,14 +4151,29 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
       return edgeColoring;
     }
 
+    /*--- Order in which the edges are grouped. For the partitioned method the edges of each sub-domain
+     *    (of the first point of the edge) are consecutive, this keeps the groups compact, and also the
+     *    consecutive groups of a color, which are processed by the same thread. The sub-domains have
+     *    a few times more edges than the groups, to let the coloring find independent groups. ---*/
+    vector<unsigned long> order(nEdge);
+    iota(order.begin(), order.end(), 0ul);
+
+    if (edgeColoringMethod == EDGE_COLORING::PARTITIONED) {
+      constexpr unsigned long groupsPerPart = 16;
+      const auto part = PartitionPoints(max(1ul, nEdge / (groupsPerPart * edgeColorGroupSize)));
+      stable_sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) {
+        return part[edges->GetNode(a, 0)] < part[edges->GetNode(b, 0)];
+      });
+    }
+
     /*--- Create a temporary sparse pattern from the edges. ---*/
     su2vector<unsigned long> outerPtr(nEdge + 1);
     su2vector<unsigned long> innerIdx(nEdge * 2);
 
-    for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
-      outerPtr(iEdge) = 2 * iEdge;
-      innerIdx(iEdge * 2 + 0) = edges->GetNode(iEdge, 0);
-      innerIdx(iEdge * 2 + 1) = edges->GetNode(iEdge, 1);
+    for (unsigned long k = 0; k < nEdge; ++k) {
+      outerPtr(k) = 2 * k;
+      innerIdx(k * 2 + 0) = edges->GetNode(order[k], 0);
+      innerIdx(k * 2 + 1) = edges->GetNode(order[k], 1);
     }
     outerPtr(nEdge) = 2 * nEdge;
 
@@ -3639,6 +4183,14 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
     constexpr bool balanceColors = true;
     edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
 
+    /*--- Map the positions in the grouping order back to edges. ---*/
+    for (unsigned long iColor = 0; iColor < edgeColoring.getOuterSize(); ++iColor) {
+      for (unsigned long k = 0; k < edgeColoring.getNumNonZeros(iColor); ++k) {
+        auto& iEdge = edgeColoring.getInnerIdx(iColor, k);
+        iEdge = order[iEdge];
+      }
+    }
+
     /*--- If the coloring fails use the natural coloring. This is a
      *    "soft" failure as this "bad" coloring should be detected
      *    downstream and a fallback strategy put in place. ---*/
@@ -3648,9 +4200,103 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
   if (efficiency != nullptr) {
     *efficiency = coloringEfficiency(edgeColoring, omp_get_max_threads(), edgeColorGroupSize);
   }
+
   return edgeColoring;
 }
 
+void CGeometry::GetEdgeColoringLocality(su2double& bandwidth, su2double& pointsPerEdge) const {
+  bandwidth = pointsPerEdge = 0.0;
+  if (edgeColoring.empty()) return;
+
+  /*--- Each group is processed by one thread, the points it reads are marked with the group number. ---*/
+  vector<unsigned long> lastGroup(nPoint, std::numeric_limits<unsigned long>::max());
+  unsigned long sumRange = 0, sumPoints = 0, nGroup = 0;
+
+  for (unsigned long iColor = 0; iColor < edgeColoring.getOuterSize(); ++iColor) {
+    const auto colorSize = edgeColoring.getNumNonZeros(iColor);
+    const auto* colorEdges = edgeColoring.innerIdx(iColor);
+
+    for (unsigned long iGroup = 0; iGroup < colorSize; iGroup += edgeColorGroupSize, ++nGroup) {
+      unsigned long minPoint = nPoint, maxPoint = 0;
+      for (auto k = iGroup; k < min(iGroup + edgeColorGroupSize, colorSize); ++k) {
+        for (unsigned short iNode = 0; iNode < 2; ++iNode) {
+          const auto iPoint = edges->GetNode(colorEdges[k], iNode);
+          minPoint = min(minPoint, iPoint);
+          maxPoint = max(maxPoint, iPoint);
+          sumPoints += (lastGroup[iPoint] != nGroup);
+          lastGroup[iPoint] = nGroup;
+        }
+      }
+      sumRange += maxPoint + 1 - minPoint;
+    }
+  }
+  bandwidth = su2double(sumRange) / nGroup;
+  pointsPerEdge = su2double(sumPoints) / nEdge;
+}
+
+vector<unsigned long> CGeometry::PartitionPoints(unsigned long nPart) const {
+  vector<unsigned long> part(nPoint, 0);
+  if (nPart < 2 || nPoint < nPart) return part;
+
+#ifdef HAVE_METIS
+  /*--- Graph of the points in CSR format. ---*/
+  vector<idx_t> xadj(nPoint + 1, 0), adjncy;
+  adjncy.reserve(2 * nEdge);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (const auto jPoint : nodes->GetPoints(iPoint)) adjncy.push_back(jPoint);
+    xadj[iPoint + 1] = adjncy.size();
+  }
+
+  idx_t nVertex = nPoint, nCon = 1, nParts = nPart, edgeCut = 0;
+  idx_t options[METIS_NOPTIONS];
+  METIS_SetDefaultOptions(options);
+  vector<idx_t> metisPart(nPoint);
+
+  if (METIS_PartGraphKway(&nVertex, &nCon, xadj.data(), adjncy.data(), nullptr, nullptr, nullptr, &nParts, nullptr,
+                          nullptr, options, &edgeCut, metisPart.data()) == METIS_OK) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) part[iPoint] = metisPart[iPoint];
+    return part;
+  }
+#endif
+
+  /*--- Fallback, recursive coordinate bisection, the points are split at the median coordinate of the
+   *    longest side of their bounding box, the number of points of each side is proportional to its parts. ---*/
+  vector<unsigned long> idx(nPoint);
+  iota(idx.begin(), idx.end(), 0ul);
+
+  function<void(unsigned long, unsigned long, unsigned long, unsigned long)> bisect;
+  bisect = [&](unsigned long begin, unsigned long end, unsigned long firstPart, unsigned long numParts) {
+    if (numParts == 1) {
+      for (auto k = begin; k < end; ++k) part[idx[k]] = firstPart;
+      return;
+    }
+    su2double lo[MAXNDIM] = {0.0}, hi[MAXNDIM] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      lo[iDim] = hi[iDim] = nodes->GetCoord(idx[begin], iDim);
+    }
+    for (auto k = begin; k < end; ++k) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        lo[iDim] = min(lo[iDim], nodes->GetCoord(idx[k], iDim));
+        hi[iDim] = max(hi[iDim], nodes->GetCoord(idx[k], iDim));
+      }
+    }
+    unsigned short axis = 0;
+    for (unsigned short iDim = 1; iDim < nDim; ++iDim) {
+      if (hi[iDim] - lo[iDim] > hi[axis] - lo[axis]) axis = iDim;
+    }
+    const auto leftParts = numParts / 2;
+    const auto mid = begin + (end - begin) * leftParts / numParts;
+    nth_element(idx.begin() + begin, idx.begin() + mid, idx.begin() + end, [&](unsigned long a, unsigned long b) {
+      return nodes->GetCoord(a, axis) < nodes->GetCoord(b, axis);
+    });
+    bisect(begin, mid, firstPart, leftParts);
+    bisect(mid, end, firstPart + leftParts, numParts - leftParts);
+  };
+  bisect(0, nPoint, 0, nPart);
+
+  return part;
+}
+
 void CGeometry::SetNaturalEdgeColoring() {
   if (nEdge == 0) return;
   edgeColoring = createNaturalColoring(nEdge);
@@ -3932,7 +4578,14 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
     for (int iZone = 0; iZone < nZone; iZone++) {
       unique_ptr<CADTElemClass> WallADT =
           geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
-      if (WallADT && !WallADT->IsEmpty()) {
+      /*--- A local ADT (distributed walls) may be empty only on some ranks. ---*/
+      bool emptyADT = !WallADT || WallADT->IsEmpty();
+      if (WallADT && !WallADT->IsGlobal()) {
+        int localEmpty = emptyADT, globalEmpty;
+        SU2_MPI::Allreduce(&localEmpty, &globalEmpty, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+        emptyADT = globalEmpty;
+      }
+      if (!emptyADT) {
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
          * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
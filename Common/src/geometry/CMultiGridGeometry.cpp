@@ -453,6 +453,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
 
   nPoint = Index_CoarseCV;
 
+  nodes->FinalizeChildren_CV();
+
   /*--- Console output with the summary of the agglomeration ---*/
 
   unsigned long nPointFine = fine_grid->GetnPoint();
@@ -495,6 +497,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
   }
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColoringMethod = config->GetEdgeColoringMethod();
 }
 
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, const CGeometry* fine_grid,
@@ -838,106 +841,126 @@ void CMultiGridGeometry::MatchPeriodic(const CConfig* config, unsigned short val
 }
 
 void CMultiGridGeometry::SetControlVolume(const CGeometry* fine_grid, unsigned short action) {
+  /*--- The loops are over coarse points or edges, and each edge is written only when visiting its
+   *    endpoint with the largest index, therefore they can be parallel (the accumulation order is
+   *    the same as in serial). This function can be called by all threads of a parallel region. ---*/
+
+  /*--- If the fine grid was updated incrementally, only the coarse points with children that changed are
+   *    recomputed. A coarse edge can only change if both its points changed, and it is recomputed (zeroed
+   *    and accumulated) when visiting its point with the largest index, as in the complete update. ---*/
+
+  const auto& fineChanged = fine_grid->GetMetricsChanged();
+  const bool incremental = (action != ALLOCATE) && !fineChanged.empty();
+
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
-    long FineEdge, CoarseEdge;
-    unsigned short iChildren;
-    bool change_face_orientation;
-    su2double Coarse_Volume, Area;
-
-    /*--- Compute the area of the coarse volume ---*/
-    for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
-      nodes->SetVolume(iCoarsePoint, 0.0);
-      Coarse_Volume = 0.0;
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
-      }
-      nodes->SetVolume(iCoarsePoint, Coarse_Volume);
-    }
+    lsqWeights.Invalidate();
+    if (incremental)
+      MetricsChanged.resize(nPoint);
+    else
+      MetricsChanged.clear();
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-    /*--- Update or not the values of faces at the edge ---*/
-    if (action != ALLOCATE) {
-      edges->SetZeroValues();
+  /*--- Compute the area of the coarse volume ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    if (incremental) {
+      MetricsChanged[iCoarsePoint] = false;
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++)
+        MetricsChanged[iCoarsePoint] |= fineChanged[nodes->GetChildren_CV(iCoarsePoint, iChildren)];
+      if (!MetricsChanged[iCoarsePoint]) continue;
     }
+    su2double Coarse_Volume = 0.0;
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+      Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
+    }
+    nodes->SetVolume(iCoarsePoint, Coarse_Volume);
+  }
+  END_SU2_OMP_FOR
 
-    for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  /*--- Update or not the values of faces at the edge ---*/
+  const su2double Zero[3] = {0.0};
+  if (action != ALLOCATE && !incremental) {
+    SU2_OMP_FOR_STAT(roundUpDiv(nEdge, omp_get_max_threads()))
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) edges->SetNormal(iEdge, Zero);
+    END_SU2_OMP_FOR
+  }
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    if (incremental) {
+      if (!MetricsChanged[iCoarsePoint]) continue;
+      for (auto iNeigh = 0u; iNeigh < nodes->GetnPoint(iCoarsePoint); iNeigh++) {
+        if (nodes->GetPoint(iCoarsePoint, iNeigh) < iCoarsePoint)
+          edges->SetNormal(nodes->GetEdge(iCoarsePoint, iNeigh), Zero);
+      }
+    }
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
 
-        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-          iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
-          if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
-            FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+      for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
+        const auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+        if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
+          const auto FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
 
-            change_face_orientation = false;
-            if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
+          const bool change_face_orientation = (iFinePoint < iFinePoint_Neighbor);
 
-            CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          const auto CoarseEdge = FindEdge(iParent, iCoarsePoint);
 
-            const auto Normal = fine_grid->edges->GetNormal(FineEdge);
+          const auto Normal = fine_grid->edges->GetNormal(FineEdge);
 
-            if (change_face_orientation) {
-              edges->SubNormal(CoarseEdge, Normal);
-            } else {
-              edges->AddNormal(CoarseEdge, Normal);
-            }
+          if (change_face_orientation) {
+            edges->SubNormal(CoarseEdge, Normal);
+          } else {
+            edges->AddNormal(CoarseEdge, Normal);
           }
         }
       }
+    }
+  }
+  END_SU2_OMP_FOR
 
-    /*--- Check if there is a normal with null area ---*/
+  /*--- Check if there is a normal with null area ---*/
 
-    for (iEdge = 0; iEdge < nEdge; iEdge++) {
-      const auto NormalFace = edges->GetNormal(iEdge);
-      Area = GeometryToolbox::Norm(nDim, NormalFace);
-      if (Area == 0.0) {
-        su2double DefaultNormal[3] = {EPS * EPS};
-        edges->SetNormal(iEdge, DefaultNormal);
-      }
+  SU2_OMP_FOR_STAT(roundUpDiv(nEdge, omp_get_max_threads()))
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    const auto NormalFace = edges->GetNormal(iEdge);
+    const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
+    if (Area == 0.0) {
+      su2double DefaultNormal[3] = {EPS * EPS};
+      edges->SetNormal(iEdge, DefaultNormal);
     }
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  END_SU2_OMP_FOR
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(const CGeometry* fine_grid, unsigned short action) {
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex;
-    unsigned short iMarker, iChildren, iDim;
-    su2double *Normal, Area, *NormalFace = nullptr;
+  /*--- Each coarse vertex only gathers from the fine vertices of its children, the loops
+   *    over the vertices of each marker can be parallel. ---*/
 
-    Normal = new su2double[nDim];
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_STAT(roundUpDiv(nVertex[iMarker], omp_get_max_threads()))
+    for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+      if (action != ALLOCATE) vertex[iMarker][iVertex]->SetZeroValues();
 
-    if (action != ALLOCATE) {
-      for (iMarker = 0; iMarker < nMarker; iMarker++)
-        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) vertex[iMarker][iVertex]->SetZeroValues();
-    }
-
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
-        for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
-          iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-          if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) {
-            FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
-            fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
-            vertex[iMarker][iVertex]->AddNormal(Normal);
-          }
+      const auto iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+        const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+        const auto FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+        if (FineVertex != -1) {
+          vertex[iMarker][iVertex]->AddNormal(fine_grid->vertex[iMarker][FineVertex]->GetNormal());
         }
       }
 
-    delete[] Normal;
-
-    /*--- Check if there is a normal with null area ---*/
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        NormalFace = vertex[iMarker][iVertex]->GetNormal();
-        Area = GeometryToolbox::Norm(nDim, NormalFace);
-        if (Area == 0.0)
-          for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS * EPS;
-      }
+      /*--- Check if there is a normal with null area ---*/
+      auto NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
+      if (Area == 0.0)
+        for (auto iDim = 0u; iDim < nDim; iDim++) NormalFace[iDim] = EPS * EPS;
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 void CMultiGridGeometry::SetCoord(const CGeometry* fine_grid) {
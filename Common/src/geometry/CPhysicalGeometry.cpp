@@ -35,6 +35,8 @@
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSyntheticMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../../include/geometry/primal_grid/CPrimalGrid.hpp"
 #include "../../include/geometry/primal_grid/CLine.hpp"
@@ -51,6 +53,8 @@
 #include <iterator>
 #include <unordered_set>
 #include <queue>
+#include <numeric>
+#include <cstdint>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -60,6 +64,7 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {}
 CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone, unsigned short val_nZone)
     : CGeometry() {
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColoringMethod = config->GetEdgeColoringMethod();
 
   string text_line, Marker_Tag;
   ifstream mesh_file;
@@ -98,6 +103,8 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
       case CGNS_GRID:
       case RECTANGLE:
       case BOX:
+      case SYNTHETIC:
+      case SU2_BINARY:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -182,6 +189,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
 
 CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGeometry() {
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColoringMethod = config->GetEdgeColoringMethod();
 
   /*--- The new geometry class has the same problem dimension/zone. ---*/
 
@@ -192,18 +200,33 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
 
   PrepareOffsets(geometry->GetGlobal_nPoint());
 
+  /*--- Resident and peak memory after each stage of the preprocessing, the
+   transient data of each stage is kept in an arena that is released once
+   the data has been loaded into the geometry structures. ---*/
+
+  vector<string> stageNames;
+  vector<passivedouble> stageMemory;
+  auto recordMemory = [&](const string& name) {
+    stageNames.push_back(name);
+    const auto resident = MemoryAllocation::ResidentMemory();
+    stageMemory.push_back(resident);
+    stageMemory.push_back(max(resident, MemoryAllocation::PeakResidentMemory()));
+  };
+
   /*--- Communicate the coloring data so that each rank has a complete set
    of colors for all points that reside on it, including repeats. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Distributing ParMETIS coloring." << endl;
 
   DistributeColoring(config, geometry);
+  recordMemory("Coloring");
 
   /*--- Redistribute the points to all ranks based on the coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Rebalancing vertices." << endl;
 
   DistributePoints(config, geometry);
+  recordMemory("Points");
 
   /*--- Distribute the element information to all ranks based on coloring. ---*/
 
@@ -215,6 +238,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   DistributeVolumeConnectivity(config, geometry, HEXAHEDRON);
   DistributeVolumeConnectivity(config, geometry, PRISM);
   DistributeVolumeConnectivity(config, geometry, PYRAMID);
+  recordMemory("Volume elements");
 
   /*--- Distribute the marker information to all ranks based on coloring. ---*/
 
@@ -237,6 +261,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   DistributeSurfaceConnectivity(config, geometry, LINE);
   DistributeSurfaceConnectivity(config, geometry, TRIANGLE);
   DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
+  recordMemory("Surface elements");
 
   /*--- Reduce the total number of elements that we have on each rank. ---*/
 
@@ -251,8 +276,27 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
    our geometry class data structures. ---*/
 
   LoadPoints(config, geometry);
+  PointsArena.Release();
+  Local_Points = nullptr;
+  Local_Colors = nullptr;
+  Local_Coords = nullptr;
+  recordMemory("Load points");
+
   LoadVolumeElements(config, geometry);
+  VolumeArena.Release();
+  Conn_Tria = Conn_Quad = Conn_Tetr = Conn_Hexa = Conn_Pris = Conn_Pyra = nullptr;
+  ID_Tria = ID_Quad = ID_Tetr = ID_Hexa = ID_Pris = ID_Pyra = nullptr;
+  recordMemory("Load volume elements");
+
   LoadSurfaceElements(config, geometry);
+  SurfaceArena.Release();
+  Conn_Line = Conn_BoundTria = Conn_BoundQuad = nullptr;
+  Conn_Line_Linear = Conn_BoundTria_Linear = Conn_BoundQuad_Linear = nullptr;
+  ID_Line = ID_BoundTria = ID_BoundQuad = nullptr;
+  ID_Line_Linear = ID_BoundTria_Linear = ID_BoundQuad_Linear = nullptr;
+  Elem_ID_Line = Elem_ID_BoundTria = Elem_ID_BoundQuad = nullptr;
+  Elem_ID_Line_Linear = Elem_ID_BoundTria_Linear = Elem_ID_BoundQuad_Linear = nullptr;
+  recordMemory("Load surface elements");
 
   /*--- If the gradient smoothing solver is active, allocate space for the sensitivity and initialize. ---*/
   if (config->GetSmoothGradient()) {
@@ -264,44 +308,25 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   decltype(Neighbors)().swap(Neighbors);
   decltype(Color_List)().swap(Color_List);
 
-  delete[] Local_Points;
-  delete[] Local_Colors;
-  delete[] Local_Coords;
-
-  delete[] Conn_Line_Linear;
-  delete[] Conn_BoundTria_Linear;
-  delete[] Conn_BoundQuad_Linear;
-
-  delete[] Conn_Line;
-  delete[] Conn_BoundTria;
-  delete[] Conn_BoundQuad;
-  delete[] Conn_Tria;
-  delete[] Conn_Quad;
-  delete[] Conn_Tetr;
-  delete[] Conn_Hexa;
-  delete[] Conn_Pris;
-  delete[] Conn_Pyra;
-
-  delete[] ID_Line;
-  delete[] ID_BoundTria;
-  delete[] ID_BoundQuad;
-  delete[] ID_Line_Linear;
-  delete[] ID_BoundTria_Linear;
-  delete[] ID_BoundQuad_Linear;
-
-  delete[] ID_Tria;
-  delete[] ID_Quad;
-  delete[] ID_Tetr;
-  delete[] ID_Hexa;
-  delete[] ID_Pris;
-  delete[] ID_Pyra;
-
-  delete[] Elem_ID_Line;
-  delete[] Elem_ID_BoundTria;
-  delete[] Elem_ID_BoundQuad;
-  delete[] Elem_ID_Line_Linear;
-  delete[] Elem_ID_BoundTria_Linear;
-  delete[] Elem_ID_BoundQuad_Linear;
+  /*--- Report the maximum memory over the ranks after each stage. ---*/
+
+  using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+  vector<passivedouble> maxMemory(stageMemory.size());
+  MPIWrapper::Allreduce(stageMemory.data(), maxMemory.data(), stageMemory.size(), MPI_DOUBLE, MPI_MAX,
+                        SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    PrintingToolbox::CTablePrinter MemoryTable(&std::cout);
+    MemoryTable.AddColumn("Preprocessing stage", 24);
+    MemoryTable.AddColumn("Resident [MB]", 14);
+    MemoryTable.AddColumn("Peak [MB]", 14);
+    MemoryTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+    MemoryTable.PrintHeader();
+    for (size_t iStage = 0; iStage < stageNames.size(); ++iStage) {
+      MemoryTable << stageNames[iStage] << maxMemory[2 * iStage] / 1048576 << maxMemory[2 * iStage + 1] / 1048576;
+    }
+    MemoryTable.PrintFooter();
+  }
 }
 
 CPhysicalGeometry::~CPhysicalGeometry() {
@@ -897,14 +922,11 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig* config, CGeo
   /*--- Allocate the memory that we need for receiving the
    values and then cue up the non-blocking receives. Note that
    we do not include our own rank in the communications. We will
-   directly copy our own data later. ---*/
+   directly copy our own data later. The receive buffers are kept as the
+   connectivity of this rank, they are released after LoadVolumeElements. ---*/
 
-  unsigned long* connRecv = nullptr;
-  connRecv = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-  for (iRecv = 0; iRecv < NODES_PER_ELEMENT * nElem_Recv[size]; iRecv++) connRecv[iRecv] = 0;
-
-  auto* idRecv = new unsigned long[nElem_Recv[size]];
-  for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) idRecv[iRecv] = 0;
+  auto* connRecv = VolumeArena.Allocate<unsigned long>(NODES_PER_ELEMENT * nElem_Recv[size]);
+  auto* idRecv = VolumeArena.Allocate<unsigned long>(nElem_Recv[size]);
 
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
@@ -947,30 +969,12 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig* config, CGeo
   CompleteCommsAll(nSends, connSendReq, nRecvs, connRecvReq);
   CompleteCommsAll(nSends, idSendReq, nRecvs, idRecvReq);
 
-  /*--- Store the connectivity for this rank in the proper structure
-   It will be loaded into the geometry objects in a later step. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    Conn_Elem = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-    int count = 0;
-    nElem_Total = 0;
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      nElem_Total++;
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
-        Conn_Elem[count] = connRecv[iRecv * NODES_PER_ELEMENT + iNode];
-        count++;
-      }
-    }
-  }
-
-  /*--- Store the global element IDs too. ---*/
+  /*--- The connectivity and global element IDs for this rank will be
+   loaded into the geometry objects in a later step. ---*/
 
-  if (nElem_Recv[size] > 0) {
-    ID_Elems = new unsigned long[nElem_Recv[size]];
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      ID_Elems[iRecv] = idRecv[iRecv];
-    }
-  }
+  nElem_Total = nElem_Recv[size];
+  Conn_Elem = connRecv;
+  ID_Elems = idRecv;
 
   /*--- Store the particular element count, IDs, & conn. in the class data,
    and set the class data pointer to the connectivity array. ---*/
@@ -1032,9 +1036,7 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig* config, CGeo
   delete[] idRecvReq;
 
   delete[] connSend;
-  delete[] connRecv;
   delete[] idSend;
-  delete[] idRecv;
   delete[] nElem_Recv;
   delete[] nElem_Send;
   delete[] nElem_Flag;
@@ -1187,17 +1189,12 @@ void CPhysicalGeometry::DistributePoints(const CConfig* config, CGeometry* geome
   /*--- Allocate the memory that we need for receiving the
    values and then cue up the non-blocking receives. Note that
    we do not include our own rank in the communications. We will
-   directly copy our own data later. ---*/
-
-  auto* colorRecv = new unsigned long[nPoint_Recv[size]];
-  for (iRecv = 0; iRecv < nPoint_Recv[size]; iRecv++) colorRecv[iRecv] = 0;
+   directly copy our own data later. The receive buffers are kept as the
+   local points of this rank, they are released after LoadPoints. ---*/
 
-  auto* idRecv = new unsigned long[nPoint_Recv[size]];
-  for (iRecv = 0; iRecv < nPoint_Recv[size]; iRecv++) idRecv[iRecv] = 0;
-
-  su2double* coordRecv = nullptr;
-  coordRecv = new su2double[nDim * nPoint_Recv[size]];
-  for (iRecv = 0; iRecv < nDim * nPoint_Recv[size]; iRecv++) coordRecv[iRecv] = 0;
+  auto* colorRecv = PointsArena.Allocate<unsigned long>(nPoint_Recv[size]);
+  auto* idRecv = PointsArena.Allocate<unsigned long>(nPoint_Recv[size]);
+  auto* coordRecv = PointsArena.Allocate<su2double>(nDim * nPoint_Recv[size]);
 
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
@@ -1254,16 +1251,13 @@ void CPhysicalGeometry::DistributePoints(const CConfig* config, CGeometry* geome
   /*--- Store the proper local IDs, colors, and coordinates. We will load
    all of this information into our geometry classes in a later step. ---*/
 
-  Local_Points = new unsigned long[nPoint_Recv[size]];
-  Local_Colors = new unsigned long[nPoint_Recv[size]];
-  Local_Coords = new su2double[nDim * nPoint_Recv[size]];
+  Local_Points = idRecv;
+  Local_Colors = colorRecv;
+  Local_Coords = coordRecv;
 
   nLocal_PointDomain = 0;
   nLocal_PointGhost = 0;
   for (iRecv = 0; iRecv < nPoint_Recv[size]; iRecv++) {
-    Local_Points[iRecv] = idRecv[iRecv];
-    Local_Colors[iRecv] = colorRecv[iRecv];
-    for (iDim = 0; iDim < nDim; iDim++) Local_Coords[iRecv * nDim + iDim] = coordRecv[iRecv * nDim + iDim];
     if (Local_Colors[iRecv] == (unsigned long)rank)
       nLocal_PointDomain++;
     else
@@ -1281,11 +1275,8 @@ void CPhysicalGeometry::DistributePoints(const CConfig* config, CGeometry* geome
   delete[] coordRecvReq;
 
   delete[] colorSend;
-  delete[] colorRecv;
   delete[] idSend;
-  delete[] idRecv;
   delete[] coordSend;
-  delete[] coordRecv;
   delete[] nPoint_Recv;
   delete[] nPoint_Send;
   delete[] nPoint_Flag;
@@ -1496,15 +1487,9 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig* config, CGeometry*
    we do not include our own rank in the communications. We will
    directly copy our own data later. ---*/
 
-  unsigned long* connRecv = nullptr;
-  connRecv = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-  for (iRecv = 0; iRecv < NODES_PER_ELEMENT * nElem_Recv[size]; iRecv++) connRecv[iRecv] = 0;
-
-  auto* markerRecv = new unsigned long[nElem_Recv[size]];
-  for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) markerRecv[iRecv] = 0;
-
-  auto* idRecv = new unsigned long[nElem_Recv[size]];
-  for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) idRecv[iRecv] = 0;
+  auto* connRecv = SurfaceArena.Allocate<unsigned long>(NODES_PER_ELEMENT * nElem_Recv[size]);
+  auto* markerRecv = SurfaceArena.Allocate<unsigned long>(nElem_Recv[size]);
+  auto* idRecv = SurfaceArena.Allocate<unsigned long>(nElem_Recv[size]);
 
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
@@ -1556,40 +1541,14 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig* config, CGeometry*
   CompleteCommsAll(nSends, markerSendReq, nRecvs, markerRecvReq);
   CompleteCommsAll(nSends, idSendReq, nRecvs, idRecvReq);
 
-  /*--- Store the connectivity for this rank in the proper data
-   structure before post-processing below. First, allocate
-   appropriate amount of memory for this section. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    Conn_Elem = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-    int count = 0;
-    nElem_Total = 0;
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      nElem_Total++;
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
-        Conn_Elem[count] = connRecv[iRecv * NODES_PER_ELEMENT + iNode];
-        count++;
-      }
-    }
-  }
-
-  /*--- Store the global marker ID for each element. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    Linear_Markers = new unsigned long[nElem_Recv[size]];
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      Linear_Markers[iRecv] = markerRecv[iRecv];
-    }
-  }
+  /*--- The receive buffers become the connectivity, global marker ID, and
+   global surface elem ID of each element of this rank, they are released
+   with the other surface elements after LoadSurfaceElements. ---*/
 
-  /*--- Store the global surface elem ID for each element. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    ID_SurfElem = new unsigned long[nElem_Recv[size]];
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      ID_SurfElem[iRecv] = idRecv[iRecv];
-    }
-  }
+  nElem_Total = nElem_Recv[size];
+  Conn_Elem = connRecv;
+  Linear_Markers = markerRecv;
+  ID_SurfElem = idRecv;
 
   /*--- Store the particular global element count in the class data,
    and set the class data pointer to the connectivity array. ---*/
@@ -1638,10 +1597,6 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig* config, CGeometry*
   delete[] markerSend;
   delete[] idSend;
 
-  delete[] connRecv;
-  delete[] markerRecv;
-  delete[] idRecv;
-
   delete[] nElem_Recv;
   delete[] nElem_Send;
   delete[] nElem_Flag;
@@ -1835,15 +1790,9 @@ void CPhysicalGeometry::DistributeSurfaceConnectivity(CConfig* config, CGeometry
    we do not include our own rank in the communications. We will
    directly copy our own data later. ---*/
 
-  unsigned long* connRecv = nullptr;
-  connRecv = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-  for (iRecv = 0; iRecv < NODES_PER_ELEMENT * nElem_Recv[size]; iRecv++) connRecv[iRecv] = 0;
-
-  auto* markerRecv = new unsigned long[nElem_Recv[size]];
-  for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) markerRecv[iRecv] = 0;
-
-  auto* idRecv = new unsigned long[nElem_Recv[size]];
-  for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) idRecv[iRecv] = 0;
+  auto* connRecv = SurfaceArena.Allocate<unsigned long>(NODES_PER_ELEMENT * nElem_Recv[size]);
+  auto* markerRecv = SurfaceArena.Allocate<unsigned long>(nElem_Recv[size]);
+  auto* idRecv = SurfaceArena.Allocate<unsigned long>(nElem_Recv[size]);
 
   /*--- Allocate memory for the MPI requests if we need to communicate. ---*/
 
@@ -1893,39 +1842,14 @@ void CPhysicalGeometry::DistributeSurfaceConnectivity(CConfig* config, CGeometry
   CompleteCommsAll(nSends, markerSendReq, nRecvs, markerRecvReq);
   CompleteCommsAll(nSends, idSendReq, nRecvs, idRecvReq);
 
-  /*--- Store the connectivity for this rank in the proper data
-   structure. It will be loaded into the geometry objects in a later step. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    Conn_Elem = new unsigned long[NODES_PER_ELEMENT * nElem_Recv[size]];
-    int count = 0;
-    nElem_Total = 0;
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      nElem_Total++;
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++) {
-        Conn_Elem[count] = connRecv[iRecv * NODES_PER_ELEMENT + iNode];
-        count++;
-      }
-    }
-  }
-
-  /*--- Store the global marker IDs too. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    Local_Markers = new unsigned long[nElem_Recv[size]];
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      Local_Markers[iRecv] = markerRecv[iRecv];
-    }
-  }
+  /*--- The receive buffers are kept as the connectivity, global marker IDs, and
+   global surface elem IDs of this rank. They will be loaded into the geometry
+   objects in a later step. ---*/
 
-  /*--- Store the global surface elem IDs too. ---*/
-
-  if (nElem_Recv[size] > 0) {
-    ID_SurfElem = new unsigned long[nElem_Recv[size]];
-    for (iRecv = 0; iRecv < nElem_Recv[size]; iRecv++) {
-      ID_SurfElem[iRecv] = idRecv[iRecv];
-    }
-  }
+  nElem_Total = nElem_Recv[size];
+  Conn_Elem = connRecv;
+  Local_Markers = markerRecv;
+  ID_SurfElem = idRecv;
 
   /*--- Store the particular global element count in the class data,
    and set the class data pointer to the connectivity array. ---*/
@@ -1971,11 +1895,8 @@ void CPhysicalGeometry::DistributeSurfaceConnectivity(CConfig* config, CGeometry
   delete[] idRecvReq;
 
   delete[] connSend;
-  delete[] connRecv;
   delete[] markerSend;
-  delete[] markerRecv;
   delete[] idSend;
-  delete[] idRecv;
   delete[] nElem_Recv;
   delete[] nElem_Send;
   delete[] nElem_Flag;
@@ -3476,6 +3397,12 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
     case BOX:
       MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
+    case SYNTHETIC:
+      MeshFVM = new CSyntheticMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     default:
       SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
       break;
@@ -4400,67 +4327,118 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig* config) {
 }
 
 void CPhysicalGeometry::SetPoint_Connectivity() {
-  vector<vector<unsigned long> > points(nPoint);
+  /*--- The elements surrounding each point, and then the points surrounding each point, are built directly in
+   * compressed format with two threaded passes, one counts the entries of each point and the other fills them.
+   * The result is the same as the serial construction (elements in ascending order, neighbors in the order
+   * they are found in those elements). ---*/
 
-  SU2_OMP_PARALLEL {
-    unsigned short Node_Neighbor, iNode, iNeighbor;
-    unsigned long jElem, Point_Neighbor, iPoint, iElem;
+  su2vector<long> elemPtr(nPoint + 1), elemIdx, elemPos(nPoint);
+  su2vector<su2localindex> pointPtr(nPoint + 1), pointIdx;
 
-    /*--- Loop over all the elements ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      vector<vector<long> > elems(nPoint);
+  /*--- The neighbors of a point are the nodes connected to it by the edges of its elements. ---*/
 
-      for (iElem = 0; iElem < nElem; iElem++) {
-        /*--- Loop over all the nodes of an element ---*/
-        for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-          iPoint = elem[iElem]->GetNode(iNode);
-          elems[iPoint].push_back(iElem);
+  auto FindNeighbors = [this](unsigned long iPoint, vector<unsigned long>& neighbors) {
+    neighbors.clear();
+    for (auto jElem : nodes->GetElems(iPoint)) {
+      for (unsigned short iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
+        if (elem[jElem]->GetNode(iNode) != iPoint) continue;
+
+        for (unsigned short iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+          const auto Point_Neighbor = elem[jElem]->GetNode(elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor));
+
+          /*--- Store the point into the point, if it is new ---*/
+          if (find(neighbors.begin(), neighbors.end(), Point_Neighbor) == neighbors.end())
+            neighbors.push_back(Point_Neighbor);
         }
       }
-      nodes->SetElems(elems);
+    }
+  };
+
+  SU2_OMP_PARALLEL {
+    /*--- Count the elements of each point. ---*/
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint <= nPoint; iPoint++) elemPtr(iPoint) = 0;
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        atomicAdd(1l, elemPtr(elem[iElem]->GetNode(iNode) + 1));
+    }
+    END_SU2_OMP_FOR
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+        elemPtr(iPoint + 1) += elemPtr(iPoint);
+        elemPos(iPoint) = elemPtr(iPoint);
+      }
+      elemIdx.resize(elemPtr(nPoint));
     }
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-    /*--- Loop over all the points ---*/
+    /*--- Fill, the threads claim positions atomically, then each list is sorted. ---*/
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+        auto& next = elemPos(elem[iElem]->GetNode(iNode));
+        long pos;
+        SU2_OMP(atomic capture)
+        pos = next++;
+        elemIdx(pos) = iElem;
+      }
+    }
+    END_SU2_OMP_FOR
 
     SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
-      /*--- Loop over all elements shared by the point ---*/
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      sort(elemIdx.data() + elemPtr(iPoint), elemIdx.data() + elemPtr(iPoint + 1));
+    }
+    END_SU2_OMP_FOR
 
-      for (iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
-        jElem = nodes->GetElem(iPoint, iElem);
+    SU2_OMP_SAFE_GLOBAL_ACCESS(nodes->SetElems(std::move(elemPtr), std::move(elemIdx));)
 
-        /*--- If we find the point iPoint in the surrounding element ---*/
+    /*--- Count the neighbors of each point. ---*/
 
-        for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
-          if (elem[jElem]->GetNode(iNode) != iPoint) continue;
+    vector<unsigned long> neighbors;
 
-          /*--- Localize the local index of the neighbor of iPoint in the element ---*/
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      FindNeighbors(iPoint, neighbors);
 
-          for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-            Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-            Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+      /*--- Set the number of neighbors variable, this is important for JST and multigrid in parallel. ---*/
+      nodes->SetnNeighbor(iPoint, neighbors.size());
+    }
+    END_SU2_OMP_FOR
 
-            /*--- Store the point into the point, if it is new ---*/
-            auto End = points[iPoint].end();
-            if (find(points[iPoint].begin(), End, Point_Neighbor) == End) points[iPoint].push_back(Point_Neighbor);
-          }
-        }
-      }
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      unsigned long nNonZero = 0;
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nNonZero += nodes->GetnNeighbor(iPoint);
+      checkPatternIndexRange<su2localindex>(max<unsigned long>(nPoint, nNonZero));
 
-      /*--- Set the number of neighbors variable, this is important for JST and multigrid in parallel. ---*/
-      nodes->SetnNeighbor(iPoint, points[iPoint].size());
+      pointPtr(0) = 0;
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+        pointPtr(iPoint + 1) = pointPtr(iPoint) + nodes->GetnNeighbor(iPoint);
+      pointIdx.resize(nNonZero);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    /*--- Fill, each point writes its own range. ---*/
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      FindNeighbors(iPoint, neighbors);
+      copy(neighbors.begin(), neighbors.end(), pointIdx.data() + pointPtr(iPoint));
     }
     END_SU2_OMP_FOR
 
-    SU2_OMP_MASTER
-    nodes->SetPoints(points);
-    END_SU2_OMP_MASTER
+    SU2_OMP_SAFE_GLOBAL_ACCESS(nodes->SetPoints(std::move(pointPtr), std::move(pointIdx));)
   }
   END_SU2_OMP_PARALLEL
 }
 
-void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
+vector<unsigned long> CPhysicalGeometry::ComputeRCM_Ordering() const {
   /*--- The result is the RCM ordering, during the process it is also used as
    * the queue of new points considered by the algorithm. This is possible
    * because points move from the front of the queue to the back of the result,
@@ -4530,11 +4508,128 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
     if (!status) SU2_MPI::Error("RCM ordering failed", CURRENT_FUNCTION);
   }
 
+  return Result;
+}
+
+namespace {
+/*!
+ * \brief Position of a point along a Hilbert curve, using the "transpose" algorithm of J. Skilling (2004),
+ *        Programming the Hilbert curve, AIP Conference Proceedings 707.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] nBits - Bits per dimension, nDim * nBits <= 64.
+ * \param[in] X - Integer coordinates in [0, 2^nBits), modified.
+ * \return The index of the point along the curve.
+ */
+uint64_t HilbertIndex(unsigned short nDim, unsigned short nBits, uint32_t* X) {
+  const uint32_t M = 1u << (nBits - 1);
+
+  /*--- Inverse undo excess work. ---*/
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (auto i = 0u; i < nDim; ++i) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (auto i = 1u; i < nDim; ++i) X[i] ^= X[i - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (X[nDim - 1] & Q) t ^= Q - 1;
+  }
+  for (auto i = 0u; i < nDim; ++i) X[i] ^= t;
+
+  /*--- Interleave the bits of the transposed index. ---*/
+  uint64_t index = 0;
+  for (int bit = nBits - 1; bit >= 0; --bit) {
+    for (auto i = 0u; i < nDim; ++i) index = (index << 1) | ((X[i] >> bit) & 1u);
+  }
+  return index;
+}
+}  // namespace
+
+vector<unsigned long> CPhysicalGeometry::ComputeHilbert_Ordering() const {
+  /*--- Bounding box of the domain points. ---*/
+  passivedouble minCoord[MAXNDIM], maxCoord[MAXNDIM];
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    minCoord[iDim] = std::numeric_limits<passivedouble>::max();
+    maxCoord[iDim] = std::numeric_limits<passivedouble>::lowest();
+  }
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const auto x = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+      minCoord[iDim] = min(minCoord[iDim], x);
+      maxCoord[iDim] = max(maxCoord[iDim], x);
+    }
+  }
+
+  /*--- Map the coordinates to integers and compute the position along the curve. ---*/
+  const unsigned short nBits = (nDim == 2) ? 32 : 21;
+  const passivedouble maxInt = std::ldexp(1.0, nBits) - 1;
+
+  vector<uint64_t> Key(nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    uint32_t X[MAXNDIM] = {0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const auto range = max(maxCoord[iDim] - minCoord[iDim], std::numeric_limits<passivedouble>::min());
+      const auto x = (SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - minCoord[iDim]) / range;
+      X[iDim] = static_cast<uint32_t>(x * maxInt);
+    }
+    Key[iPoint] = HilbertIndex(nDim, nBits, X);
+  }
+
+  vector<unsigned long> Result(nPointDomain);
+  iota(Result.begin(), Result.end(), 0ul);
+  stable_sort(Result.begin(), Result.end(), [&](unsigned long iPoint, unsigned long jPoint) {
+    return Key[iPoint] < Key[jPoint];
+  });
+  return Result;
+}
+
+passivedouble CPhysicalGeometry::GetAverageNeighborDistance(const vector<unsigned long>& NewIndex) const {
+  unsigned long Local[2] = {0, 0}, Global[2] = {0, 0};
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (const auto jPoint : nodes->GetPoints(iPoint)) {
+      if (jPoint >= nPointDomain) continue;
+      const auto i = NewIndex[iPoint], j = NewIndex[jPoint];
+      Local[0] += (i > j) ? i - j : j - i;
+      Local[1] += 1;
+    }
+  }
+  SU2_MPI::Allreduce(Local, Global, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  return passivedouble(Global[0]) / max(Global[1], 1ul);
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(const CConfig* config) {
+  auto Result = (config->GetKind_Point_Ordering() == POINT_ORDERING::HILBERT) ? ComputeHilbert_Ordering()
+                                                                              : ComputeRCM_Ordering();
+
   /*--- Add the MPI points ---*/
   for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
     Result.push_back(iPoint);
   }
 
+  /*--- Report the locality of the new numbering. ---*/
+
+  vector<unsigned long> InvResult(nPoint);
+  iota(InvResult.begin(), InvResult.end(), 0ul);
+  const auto DistanceBefore = GetAverageNeighborDistance(InvResult);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    InvResult[Result[iPoint]] = iPoint;
+  }
+  const auto DistanceAfter = GetAverageNeighborDistance(InvResult);
+
+  if (rank == MASTER_NODE) {
+    cout << "Average index distance between neighbor points: " << DistanceBefore << " (before), " << DistanceAfter
+         << " (after)." << endl;
+  }
+
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -4568,11 +4663,6 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
 
   /*--- Set the new conectivities ---*/
 
-  auto& InvResult = AuxGlobalIndex;  // alias to re-use storage
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    InvResult[Result[iPoint]] = iPoint;
-  }
-
   for (auto iElem = 0ul; iElem < nElem; iElem++) {
     for (auto iNode = 0u; iNode < elem[iElem]->GetnNodes(); iNode++) {
       auto iPoint = elem[iElem]->GetNode(iNode);
@@ -4640,120 +4730,172 @@ void CPhysicalGeometry::SetElement_Connectivity() {
 }
 
 void CPhysicalGeometry::SetBoundVolume() {
-  unsigned short cont, iMarker, iElem, iNode_Domain, iNode_Surface;
-  unsigned long Point_Domain, Point_Surface, Point, iElem_Surface, iElem_Domain;
-  bool CheckVol;
+  /*--- The surface elements are independent, the first one (in serial order) without a volume element is
+   * reported after the threaded loops. ---*/
+
+  unsigned short errMarker = nMarker;
+  unsigned long errElem = 0;
+
+  SU2_OMP_PARALLEL
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iElem_Surface = 0ul; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
+      const auto nNode_Surface = bound[iMarker][iElem_Surface]->GetnNodes();
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++)
-    for (iElem_Surface = 0; iElem_Surface < nElem_Bound[iMarker]; iElem_Surface++) {
       /*--- Choose and arbitrary point from the surface --*/
-      Point = bound[iMarker][iElem_Surface]->GetNode(0);
-      CheckVol = false;
+      const auto Point = bound[iMarker][iElem_Surface]->GetNode(0);
+      bool CheckVol = false;
 
-      for (iElem = 0; iElem < nodes->GetnElem(Point); iElem++) {
+      for (auto iElem_Domain : nodes->GetElems(Point)) {
         /*--- Look for elements surronding that point --*/
-        cont = 0;
-        iElem_Domain = nodes->GetElem(Point, iElem);
-        for (iNode_Domain = 0; iNode_Domain < elem[iElem_Domain]->GetnNodes(); iNode_Domain++) {
-          Point_Domain = elem[iElem_Domain]->GetNode(iNode_Domain);
-          for (iNode_Surface = 0; iNode_Surface < bound[iMarker][iElem_Surface]->GetnNodes(); iNode_Surface++) {
-            Point_Surface = bound[iMarker][iElem_Surface]->GetNode(iNode_Surface);
-            if (Point_Surface == Point_Domain) cont++;
-            if (cont == bound[iMarker][iElem_Surface]->GetnNodes()) break;
+        unsigned short cont = 0;
+        for (unsigned short iNode_Domain = 0; iNode_Domain < elem[iElem_Domain]->GetnNodes(); iNode_Domain++) {
+          const auto Point_Domain = elem[iElem_Domain]->GetNode(iNode_Domain);
+          for (unsigned short iNode_Surface = 0; iNode_Surface < nNode_Surface; iNode_Surface++) {
+            if (bound[iMarker][iElem_Surface]->GetNode(iNode_Surface) == Point_Domain) cont++;
+            if (cont == nNode_Surface) break;
           }
-          if (cont == bound[iMarker][iElem_Surface]->GetnNodes()) break;
+          if (cont == nNode_Surface) break;
         }
 
-        if (cont == bound[iMarker][iElem_Surface]->GetnNodes()) {
+        if (cont == nNode_Surface) {
           bound[iMarker][iElem_Surface]->SetDomainElement(iElem_Domain);
           CheckVol = true;
           break;
         }
       }
       if (!CheckVol) {
-        char buf[100];
-        SPRINTF(buf, "The surface element (%u, %lu) doesn't have an associated volume element", iMarker, iElem_Surface);
-        SU2_MPI::Error(buf, CURRENT_FUNCTION);
+        SU2_OMP_CRITICAL
+        if (iMarker < errMarker || (iMarker == errMarker && iElem_Surface < errElem)) {
+          errMarker = iMarker;
+          errElem = iElem_Surface;
+        }
+        END_SU2_OMP_CRITICAL
       }
     }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  if (errMarker < nMarker) {
+    char buf[100];
+    SPRINTF(buf, "The surface element (%u, %lu) doesn't have an associated volume element", errMarker, errElem);
+    SU2_MPI::Error(buf, CURRENT_FUNCTION);
+  }
 }
 
 void CPhysicalGeometry::SetVertex(const CConfig* config) {
-  unsigned long iPoint, iVertex, iElem;
-  unsigned short iMarker, iNode;
+  nVertex = new unsigned long[nMarker];
+  vertex = new CVertex**[nMarker];
 
-  /*--- Initialize the Vertex vector for each node of the grid ---*/
+  SU2_OMP_PARALLEL {
+    /*--- Initialize the Vertex vector for each node of the grid ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iMarker = 0; iMarker < nMarker; iMarker++) nodes->SetVertex(iPoint, -1, iMarker);
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) nodes->SetVertex(iPoint, -1, iMarker);
+    END_SU2_OMP_FOR
 
-  /*--- Create and compute the vector with the number of vertex per marker ---*/
+    /*--- The markers only touch their own vertex index of each point, thus they are processed concurrently. ---*/
 
-  nVertex = new unsigned long[nMarker];
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    /*--- Initialize the number of Bound Vertex for each Marker ---*/
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      const bool sendRecv = (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE);
 
-    nVertex[iMarker] = 0;
-    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
-      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      /*--- Compute the number of vertices of the marker ---*/
 
-        /*--- Set the vertex in the node information ---*/
+      nVertex[iMarker] = 0;
+      for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++)
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
 
-        if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
-          nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
-          nVertex[iMarker]++;
-        }
-      }
-  }
+          /*--- Set the vertex in the node information ---*/
 
-  /*--- Initialize the Vertex vector for each node, the previous result is deleted ---*/
+          if ((nodes->GetVertex(iPoint, iMarker) == -1) || sendRecv) {
+            nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
+            nVertex[iMarker]++;
+          }
+        }
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iMarker = 0; iMarker < nMarker; iMarker++) nodes->SetVertex(iPoint, -1, iMarker);
+      /*--- Reset the Vertex vector for the nodes of the marker, the previous result is deleted ---*/
 
-  /*--- Create the bound vertex structure, note that the order
-   is the same as in the input file, this is important for Send/Receive part ---*/
+      for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++)
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+          nodes->SetVertex(bound[iMarker][iElem]->GetNode(iNode), -1, iMarker);
 
-  vertex = new CVertex**[nMarker];
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    vertex[iMarker] = new CVertex*[nVertex[iMarker]];
-    nVertex[iMarker] = 0;
+      /*--- Create the bound vertex structure, note that the order
+       is the same as in the input file, this is important for Send/Receive part ---*/
 
-    /*--- Initialize the number of Bound Vertex for each Marker ---*/
+      vertex[iMarker] = new CVertex*[nVertex[iMarker]];
+      nVertex[iMarker] = 0;
 
-    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
-      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++)
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
 
-        /*--- Set the vertex in the node information ---*/
+          /*--- Set the vertex in the node information ---*/
 
-        if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
-          iVertex = nVertex[iMarker];
-          vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
+          if ((nodes->GetVertex(iPoint, iMarker) == -1) || sendRecv) {
+            const auto iVertex = nVertex[iMarker];
+            vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
 
-          if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
-            vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
+            if (sendRecv) {
+              vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
+            }
+            nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
+            nVertex[iMarker]++;
           }
-          nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
-          nVertex[iMarker]++;
         }
-      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+namespace {
+/*!
+ * \brief Coordinate along which the turbomachinery boundaries are divided in span-wise sections.
+ * \return The radius or the axial coordinate depending on the type of machine and on the boundary.
+ */
+su2double TurboSpanCoordinate(unsigned short kindTurbo, unsigned short marker_flag, const su2double* coord) {
+  const auto radius = [coord]() { return sqrt(coord[0] * coord[0] + coord[1] * coord[1]); };
+  switch (kindTurbo) {
+    case AXIAL:
+      return radius();
+    case CENTRIPETAL_AXIAL:
+      return (marker_flag == OUTFLOW) ? radius() : coord[2];
+    case AXIAL_CENTRIFUGAL:
+      return (marker_flag == INFLOW) ? radius() : coord[2];
+    default:
+      return coord[2];
   }
 }
 
+/*!
+ * \brief Index of the span-wise section closest to a value, by bisection of the sorted section values.
+ * \note Ties are resolved in favor of the lowest index, i.e. as a linear search would.
+ */
+unsigned short NearestSpan(const su2double* spanValues, unsigned short nSpan, su2double value) {
+  if (nSpan == 0) return 0;
+  const auto end = spanValues + nSpan;
+  auto it = std::lower_bound(spanValues, end, value);
+  if (it == end || (it != spanValues && value - *(it - 1) <= *it - value)) {
+    it = std::lower_bound(spanValues, end, *(it - 1));
+  }
+  return it - spanValues;
+}
+}  // namespace
+
 void CPhysicalGeometry::ComputeNSpan(CConfig* config, unsigned short val_iZone, unsigned short marker_flag,
                                      bool allocate) {
-  unsigned short iMarker, jMarker, iMarkerTP, iSpan, jSpan;
+  unsigned short iMarker, jMarker, iMarkerTP, iSpan;
   unsigned long iPoint, iVertex;
   long jVertex;
   int nSpan, nSpan_loc;
-  su2double *coord, *valueSpan, min, max, radius, delta;
+  su2double *coord, *valueSpan, min, max, delta;
   short PeriodicBoundary;
   unsigned short SpanWise_Kind = config->GetKind_SpanWise();
 
-  unsigned short iSize;
-  int nSpan_max;
   su2double MyMin, MyMax;
 
   nSpan = 0;
@@ -4770,14 +4912,14 @@ void CPhysicalGeometry::ComputeNSpan(CConfig* config, unsigned short val_iZone,
     }
   } else {
     if (SpanWise_Kind == AUTOMATIC) {
-      /*--- loop to find inflow of outflow marker---*/
+      /*--- Collect, in a single pass, the span-wise value of the vertices that are both on the inflow
+       * (or outflow) marker and on a periodic marker, each of them defines a span-wise section. ---*/
+      vector<su2double> localValueSpan;
       for (iMarker = 0; iMarker < nMarker; iMarker++) {
         for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery() + 1; iMarkerTP++) {
           if (config->GetMarker_All_Turbomachinery(iMarker) != iMarkerTP) continue;
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) != marker_flag) continue;
 
-          /*--- loop to find the vertex that ar both of inflow or outflow marker and on the periodic
-           * in order to caount the number of Span ---*/
           for (jMarker = 0; jMarker < nMarker; jMarker++) {
             if (config->GetMarker_All_KindBC(jMarker) != PERIODIC_BOUNDARY) continue;
 
@@ -4789,100 +4931,27 @@ void CPhysicalGeometry::ComputeNSpan(CConfig* config, unsigned short val_iZone,
               jVertex = nodes->GetVertex(iPoint, jMarker);
 
               if ((jVertex != -1) && (PeriodicBoundary == (val_iZone + 1))) {
-                nSpan++;
+                coord = nodes->GetCoord(iPoint);
+                localValueSpan.push_back(
+                    TurboSpanCoordinate(config->GetKind_TurboMachinery(val_iZone), marker_flag, coord));
               }
             }
           }
         }
       }
 
-      /*--- storing the local number of span---*/
-      nSpan_loc = nSpan;
-      SU2_MPI::Allreduce(&nSpan_loc, &nSpan, 1, MPI_INT, MPI_SUM, SU2_MPI::GetComm());
-      SU2_MPI::Allreduce(&nSpan_loc, &nSpan_max, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+      /*--- Gather the span-wise values of all the processors, without padding. ---*/
+      nSpan_loc = localValueSpan.size();
+      vector<int> My_nSpan_loc(size), displs(size + 1, 0);
+      SU2_MPI::Allgather(&nSpan_loc, 1, MPI_INT, My_nSpan_loc.data(), 1, MPI_INT, SU2_MPI::GetComm());
+      for (int iRank = 0; iRank < size; iRank++) displs[iRank + 1] = displs[iRank] + My_nSpan_loc[iRank];
+      nSpan = displs[size];
 
-      /*--- initialize the vector that will contain the disordered values span-wise ---*/
       nSpanWiseSections[marker_flag - 1] = nSpan;
       valueSpan = new su2double[nSpan];
 
-      for (iSpan = 0; iSpan < nSpan; iSpan++) {
-        valueSpan[iSpan] = -1001.0;
-      }
-
-      /*--- store the local span-wise value for each processor ---*/
-      nSpan_loc = 0;
-      for (iMarker = 0; iMarker < nMarker; iMarker++) {
-        for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery() + 1; iMarkerTP++) {
-          if (config->GetMarker_All_Turbomachinery(iMarker) != iMarkerTP) continue;
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) != marker_flag) continue;
-
-          for (jMarker = 0; jMarker < nMarker; jMarker++) {
-            if (config->GetMarker_All_KindBC(jMarker) != PERIODIC_BOUNDARY) continue;
-
-            for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-              iPoint = vertex[iMarker][iVertex]->GetNode();
-              if (!nodes->GetDomain(iPoint)) continue;
-
-              PeriodicBoundary = config->GetMarker_All_PerBound(jMarker);
-              jVertex = nodes->GetVertex(iPoint, jMarker);
-
-              if ((jVertex != -1) && (PeriodicBoundary == (val_iZone + 1))) {
-                coord = nodes->GetCoord(iPoint);
-                radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                switch (config->GetKind_TurboMachinery(val_iZone)) {
-                  case CENTRIFUGAL:
-                    valueSpan[nSpan_loc] = coord[2];
-                    break;
-                  case CENTRIPETAL:
-                    valueSpan[nSpan_loc] = coord[2];
-                    break;
-                  case AXIAL:
-                    valueSpan[nSpan_loc] = radius;
-                    break;
-                  case CENTRIPETAL_AXIAL:
-                    if (marker_flag == OUTFLOW) {
-                      valueSpan[nSpan_loc] = radius;
-                    } else {
-                      valueSpan[nSpan_loc] = coord[2];
-                    }
-                    break;
-                  case AXIAL_CENTRIFUGAL:
-                    if (marker_flag == INFLOW) {
-                      valueSpan[nSpan_loc] = radius;
-                    } else {
-                      valueSpan[nSpan_loc] = coord[2];
-                    }
-                    break;
-                }
-                nSpan_loc++;
-              }
-            }
-          }
-        }
-      }
-
-      /*--- Gather the span-wise values on all the processor ---*/
-
-      vector<su2double> MyTotValueSpan(nSpan_max * size, -1001.0);
-      vector<su2double> MyValueSpan(nSpan_max, -1001.0);
-      vector<int> My_nSpan_loc(size);
-
-      for (iSpan = 0; iSpan < nSpan_loc; iSpan++) {
-        MyValueSpan[iSpan] = valueSpan[iSpan];
-      }
-
-      SU2_MPI::Allgather(MyValueSpan.data(), nSpan_max, MPI_DOUBLE, MyTotValueSpan.data(), nSpan_max, MPI_DOUBLE,
-                         SU2_MPI::GetComm());
-      SU2_MPI::Allgather(&nSpan_loc, 1, MPI_INT, My_nSpan_loc.data(), 1, MPI_INT, SU2_MPI::GetComm());
-
-      jSpan = 0;
-      for (iSize = 0; iSize < size; iSize++) {
-        for (iSpan = 0; iSpan < My_nSpan_loc[iSize]; iSpan++) {
-          valueSpan[jSpan] = MyTotValueSpan[iSize * nSpan_max + iSpan];
-          jSpan++;
-        }
-      }
-      if (jSpan != nSpan) SU2_MPI::Error("Panic!", CURRENT_FUNCTION);
+      SU2_MPI::Allgatherv(localValueSpan.data(), nSpan_loc, MPI_DOUBLE, valueSpan, My_nSpan_loc.data(),
+                          displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
 
       /*--- Terrible stuff to do but so is this entire bloody function goodness me... ---*/
       SpanWiseValue[marker_flag - 1] = valueSpan;
@@ -4920,36 +4989,10 @@ void CPhysicalGeometry::ComputeNSpan(CConfig* config, unsigned short val_iZone,
 
               if ((jVertex != -1) && (PeriodicBoundary == (val_iZone + 1))) {
                 coord = nodes->GetCoord(iPoint);
-                radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                switch (config->GetKind_TurboMachinery(val_iZone)) {
-                  case CENTRIFUGAL:
-                  case CENTRIPETAL:
-                    if (coord[2] < min) min = coord[2];
-                    if (coord[2] > max) max = coord[2];
-                    break;
-                  case AXIAL:
-                    if (radius < min) min = radius;
-                    if (radius > max) max = radius;
-                    break;
-                  case CENTRIPETAL_AXIAL:
-                    if (marker_flag == OUTFLOW) {
-                      if (radius < min) min = radius;
-                      if (radius > max) max = radius;
-                    } else {
-                      if (coord[2] < min) min = coord[2];
-                      if (coord[2] > max) max = coord[2];
-                    }
-                    break;
-                  case AXIAL_CENTRIFUGAL:
-                    if (marker_flag == INFLOW) {
-                      if (radius < min) min = radius;
-                      if (radius > max) max = radius;
-                    } else {
-                      if (coord[2] < min) min = coord[2];
-                      if (coord[2] > max) max = coord[2];
-                    }
-                    break;
-                }
+                const su2double value =
+                    TurboSpanCoordinate(config->GetKind_TurboMachinery(val_iZone), marker_flag, coord);
+                if (value < min) min = value;
+                if (value > max) max = value;
               }
             }
           }
@@ -4991,24 +5034,21 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
   unsigned long iPoint, **ordered, **disordered, **oldVertex3D, iInternalVertex;
   unsigned long nVert, nVertMax;
   unsigned short iMarker, iMarkerTP, iSpan, jSpan, iDim;
-  su2double min, minInt, max, *coord, dist, Normal2, *TurboNormal, *NormalArea, target = 0.0, **area, ***unitnormal,
-                                                                                Area = 0.0;
-  bool** checkAssign;
+  su2double min, minInt, max, *coord, Normal2, *TurboNormal, *NormalArea, **area, ***unitnormal, Area = 0.0;
   min = 10.0E+06;
   minInt = 10.0E+06;
   max = -10.0E+06;
 
   su2double radius;
-  long iVertex, iSpanVertex, jSpanVertex, kSpanVertex = 0;
+  long iVertex, iSpanVertex, kSpanVertex = 0;
   int *nTotVertex_gb, *nVertexSpanHalo;
   su2double **x_loc, **y_loc, **z_loc, **angCoord_loc, **deltaAngCoord_loc, **angPitch, **deltaAngPitch,
       *minIntAngPitch, *minAngPitch, *maxAngPitch;
   int** rank_loc;
 #ifdef HAVE_MPI
-  unsigned short iSize, kSize = 0, jSize;
+  unsigned short iSize, kSize = 0;
   su2double MyMin, MyIntMin, MyMax;
   su2double *x_gb = nullptr, *y_gb = nullptr, *z_gb = nullptr, *angCoord_gb = nullptr, *deltaAngCoord_gb = nullptr;
-  bool* checkAssign_gb = nullptr;
   unsigned long My_nVert;
 
 #endif
@@ -5044,7 +5084,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
   oldVertex3D = new unsigned long*[nSpanWiseSections[marker_flag - 1]];
   area = new su2double*[nSpanWiseSections[marker_flag - 1]];
   unitnormal = new su2double**[nSpanWiseSections[marker_flag - 1]];
-  checkAssign = new bool*[nSpanWiseSections[marker_flag - 1]];
 
   /*--- Initialize the new Vertex structure. The if statement ensures that these vectors are initialized
    * only once even if the routine is called more than once.---*/
@@ -5086,76 +5125,19 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
         if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag) {
           /*--- compute the amount of vertexes for each span-wise section to initialize the CTurboVertex pointers and
            * auxiliary pointers  ---*/
+          vector<unsigned short> vertexSpan(nVertex[iMarker]);
           for (iVertex = 0; (unsigned long)iVertex < nVertex[iMarker]; iVertex++) {
             iPoint = vertex[iMarker][iVertex]->GetNode();
             if (nDim == 3) {
-              dist = 10E+06;
-              jSpan = std::numeric_limits<unsigned short>::max();
               coord = nodes->GetCoord(iPoint);
-
-              switch (config->GetKind_TurboMachinery(val_iZone)) {
-                case CENTRIFUGAL:
-                case CENTRIPETAL:
-                  for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                    if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                      dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                      jSpan = iSpan;
-                    }
-                  }
-                  break;
-                case AXIAL:
-                  radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                  for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                    if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                      dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                      jSpan = iSpan;
-                    }
-                  }
-                  break;
-                case CENTRIPETAL_AXIAL:
-                  if (marker_flag == OUTFLOW) {
-                    radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  } else {
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  }
-                  break;
-
-                case AXIAL_CENTRIFUGAL:
-                  if (marker_flag == INFLOW) {
-                    radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  } else {
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  }
-                  break;
-              }
+              jSpan = NearestSpan(SpanWiseValue[marker_flag - 1], nSpanWiseSections[marker_flag - 1],
+                                  TurboSpanCoordinate(config->GetKind_TurboMachinery(val_iZone), marker_flag, coord));
             }
-
             /*--- 2D problem do not need span-wise separation---*/
             else {
               jSpan = 0;
             }
+            vertexSpan[iVertex] = jSpan;
 
             if (nodes->GetDomain(iPoint)) {
               nVertexSpan[iMarker][jSpan]++;
@@ -5174,7 +5156,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
             ordered[iSpan] = new unsigned long[nVertexSpanHalo[iSpan]];
             disordered[iSpan] = new unsigned long[nVertexSpanHalo[iSpan]];
             oldVertex3D[iSpan] = new unsigned long[nVertexSpanHalo[iSpan]];
-            checkAssign[iSpan] = new bool[nVertexSpanHalo[iSpan]];
             area[iSpan] = new su2double[nVertexSpanHalo[iSpan]];
             unitnormal[iSpan] = new su2double*[nVertexSpanHalo[iSpan]];
             for (iVertex = 0; iVertex < nVertexSpanHalo[iSpan]; iVertex++) {
@@ -5188,73 +5169,7 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
           /*--- store the vertexes in a ordered manner in span-wise directions but not yet ordered pitch-wise ---*/
           for (iVertex = 0; (unsigned long)iVertex < nVertex[iMarker]; iVertex++) {
             iPoint = vertex[iMarker][iVertex]->GetNode();
-            if (nDim == 3) {
-              dist = 10E+06;
-              jSpan = std::numeric_limits<unsigned short>::max();
-
-              coord = nodes->GetCoord(iPoint);
-              switch (config->GetKind_TurboMachinery(val_iZone)) {
-                case CENTRIFUGAL:
-                case CENTRIPETAL:
-                  for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                    if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                      dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                      jSpan = iSpan;
-                    }
-                  }
-                  break;
-                case AXIAL:
-                  radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                  for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                    if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                      dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                      jSpan = iSpan;
-                    }
-                  }
-                  break;
-                case CENTRIPETAL_AXIAL:
-                  if (marker_flag == OUTFLOW) {
-                    radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  } else {
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  }
-                  break;
-
-                case AXIAL_CENTRIFUGAL:
-                  if (marker_flag == INFLOW) {
-                    radius = sqrt(coord[0] * coord[0] + coord[1] * coord[1]);
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(radius - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  } else {
-                    for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-                      if (dist > (abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]))) {
-                        dist = abs(coord[2] - SpanWiseValue[marker_flag - 1][iSpan]);
-                        jSpan = iSpan;
-                      }
-                    }
-                  }
-                  break;
-              }
-            }
-            /*--- 2D problem do not need span-wise separation---*/
-            else {
-              jSpan = 0;
-            }
+            jSpan = vertexSpan[iVertex];
             /*--- compute the face area associated with the vertex ---*/
             vertex[iMarker][iVertex]->GetNormal(NormalArea);
             for (iDim = 0; iDim < nDim; iDim++) NormalArea[iDim] = -NormalArea[iDim];
@@ -5268,7 +5183,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
             for (iDim = 0; iDim < nDim; iDim++) {
               unitnormal[jSpan][nVertexSpanHalo[jSpan]][iDim] = NormalArea[iDim];
             }
-            checkAssign[jSpan][nVertexSpanHalo[jSpan]] = false;
             nVertexSpanHalo[jSpan]++;
           }
 
@@ -5322,13 +5236,23 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
 
             iInternalVertex = 0;
 
+            /*--- Pitch-wise order, i.e. by increasing Y-coordinate starting from the vertex at minimum pitch
+             * found above. Vertices with the same Y-coordinate are visited by decreasing index. ---*/
+            vector<long> pitchOrder(nVertexSpanHalo[iSpan]);
+            iota(pitchOrder.begin(), pitchOrder.end(), 0l);
+            sort(pitchOrder.begin(), pitchOrder.end(), [&](long a, long b) {
+              const su2double ya = nodes->GetCoord(disordered[iSpan][a], 1);
+              const su2double yb = nodes->GetCoord(disordered[iSpan][b], 1);
+              return (ya < yb) || (ya == yb && a > b);
+            });
+            const auto first = find(pitchOrder.begin(), pitchOrder.end(), kSpanVertex);
+            if (first != pitchOrder.end()) rotate(pitchOrder.begin(), first, first + 1);
+
             /*--- reordering the vertex pitch-wise, store the ordered vertexes span-wise and pitch-wise---*/
             for (iSpanVertex = 0; iSpanVertex < nVertexSpanHalo[iSpan]; iSpanVertex++) {
-              dist = 10E+06;
+              kSpanVertex = pitchOrder[iSpanVertex];
               ordered[iSpan][iSpanVertex] = disordered[iSpan][kSpanVertex];
-              checkAssign[iSpan][kSpanVertex] = true;
               coord = nodes->GetCoord(ordered[iSpan][iSpanVertex]);
-              target = coord[1];
               if (nDim == 2 && config->GetKind_TurboMachinery(val_iZone) == AXIAL) {
                 angPitch[iSpan][iSpanVertex] = coord[1];
               } else {
@@ -5433,14 +5357,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
                 turbovertex[iMarker][iSpan][iInternalVertex]->SetTurboNormal(TurboNormal);
                 iInternalVertex++;
               }
-
-              for (jSpanVertex = 0; jSpanVertex < nVertexSpanHalo[iSpan]; jSpanVertex++) {
-                coord = nodes->GetCoord(disordered[iSpan][jSpanVertex]);
-                if (dist >= (coord[1] - target) && !checkAssign[iSpan][jSpanVertex] && (coord[1] - target) >= 0.0) {
-                  dist = coord[1] - target;
-                  kSpanVertex = jSpanVertex;
-                }
-              }
             }
           }
 
@@ -5448,7 +5364,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
             delete[] ordered[iSpan];
             delete[] disordered[iSpan];
             delete[] oldVertex3D[iSpan];
-            delete[] checkAssign[iSpan];
             delete[] area[iSpan];
             delete[] angPitch[iSpan];
             delete[] deltaAngPitch[iSpan];
@@ -5579,13 +5494,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
       z_gb = new su2double[nTotVertex_gb[iSpan] * size];
       angCoord_gb = new su2double[nTotVertex_gb[iSpan] * size];
       deltaAngCoord_gb = new su2double[nTotVertex_gb[iSpan] * size];
-      checkAssign_gb = new bool[nTotVertex_gb[iSpan] * size];
-
-      for (iSize = 0; iSize < size; iSize++) {
-        for (iSpanVertex = 0; iSpanVertex < nTotVertex_gb[iSpan]; iSpanVertex++) {
-          checkAssign_gb[iSize * nTotVertex_gb[iSpan] + iSpanVertex] = false;
-        }
-      }
     }
     SU2_MPI::Gather(y_loc[iSpan], nTotVertex_gb[iSpan], MPI_DOUBLE, y_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE,
                     SU2_MPI::GetComm());
@@ -5615,28 +5523,28 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
         }
       }
 
-      kSpanVertex = 0;
-      for (iSpanVertex = 0; iSpanVertex < nTotVertex_gb[iSpan]; iSpanVertex++) {
-        x_loc[iSpan][iSpanVertex] = x_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex];
-        y_loc[iSpan][iSpanVertex] = y_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex];
-        z_loc[iSpan][iSpanVertex] = z_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex];
-        angCoord_loc[iSpan][iSpanVertex] = angCoord_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex];
-        deltaAngCoord_loc[iSpan][iSpanVertex] = deltaAngCoord_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex];
-        rank_loc[iSpan][iSpanVertex] = kSize;
-        target = angCoord_loc[iSpan][iSpanVertex];
-        checkAssign_gb[kSize * nTotVertex_gb[iSpan] + kSpanVertex] = true;
-        min = 10.0E+06;
-        for (jSize = 0; jSize < size; jSize++) {
-          for (jSpanVertex = 0; jSpanVertex < nTotVertex_gb[iSpan]; jSpanVertex++) {
-            if ((angCoord_gb[jSize * nTotVertex_gb[iSpan] + jSpanVertex] < min) &&
-                (angCoord_gb[jSize * nTotVertex_gb[iSpan] + jSpanVertex] >= target) &&
-                !checkAssign_gb[jSize * nTotVertex_gb[iSpan] + jSpanVertex]) {
-              kSize = jSize;
-              kSpanVertex = jSpanVertex;
-              min = angCoord_gb[jSize * nTotVertex_gb[iSpan] + jSpanVertex];
-            }
-          }
-        }
+      /*--- Global pitch-wise order, by increasing angular coordinate starting from the first vertex of
+       * the processor with the lowest one, ties are ordered by processor. Unused (padding) entries and
+       * values below the starting one are excluded. ---*/
+      const long nTot = nTotVertex_gb[iSpan];
+      vector<long> globalOrder;
+      for (long iEntry = 0; iEntry < nTot * size; iEntry++) {
+        if (angCoord_gb[iEntry] >= min) globalOrder.push_back(iEntry);
+      }
+      stable_sort(globalOrder.begin(), globalOrder.end(),
+                  [&](long a, long b) { return angCoord_gb[a] < angCoord_gb[b]; });
+      const auto first = find(globalOrder.begin(), globalOrder.end(), kSize * nTot);
+      if (first != globalOrder.end()) rotate(globalOrder.begin(), first, first + 1);
+      if (globalOrder.empty()) globalOrder.push_back(kSize * nTot);
+
+      for (iSpanVertex = 0; iSpanVertex < nTot; iSpanVertex++) {
+        const auto iEntry = globalOrder[std::min<long>(iSpanVertex, globalOrder.size() - 1)];
+        x_loc[iSpan][iSpanVertex] = x_gb[iEntry];
+        y_loc[iSpan][iSpanVertex] = y_gb[iEntry];
+        z_loc[iSpan][iSpanVertex] = z_gb[iEntry];
+        angCoord_loc[iSpan][iSpanVertex] = angCoord_gb[iEntry];
+        deltaAngCoord_loc[iSpan][iSpanVertex] = deltaAngCoord_gb[iEntry];
+        rank_loc[iSpan][iSpanVertex] = iEntry / nTot;
       }
 
       delete[] x_gb;
@@ -5644,7 +5552,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
       delete[] z_gb;
       delete[] angCoord_gb;
       delete[] deltaAngCoord_gb;
-      delete[] checkAssign_gb;
     }
   }
 
@@ -5751,7 +5658,6 @@ void CPhysicalGeometry::SetTurboVertex(CConfig* config, unsigned short val_iZone
   delete[] ordered;
   delete[] disordered;
   delete[] oldVertex3D;
-  delete[] checkAssign;
   delete[] TurboNormal;
   delete[] unitnormal;
   delete[] NormalArea;
@@ -5896,10 +5802,6 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig* config, unsigned short val_iZo
   Normal = new su2double[nDim];
 
   bool grid_movement = config->GetGrid_Movement();
-#ifdef HAVE_MPI
-  su2double MyTotalArea, MyTotalRadius, *MyTotalTurboNormal = nullptr, *MyTotalNormal = nullptr,
-                                        *MyTotalGridVel = nullptr;
-#endif
 
   /*--- Intialization of the vector for the interested boundary ---*/
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -5934,16 +5836,15 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig* config, unsigned short val_iZo
     }
   }
 
-  /*--- start computing the average quantities span wise --- */
-  for (iSpan = 0; iSpan < nSpanWiseSections[marker_flag - 1]; iSpan++) {
-    /*--- Forces initialization for contenitors to zero ---*/
-    for (iDim = 0; iDim < nDim; iDim++) {
-      TotalTurboNormal[iDim] = 0.0;
-      TotalNormal[iDim] = 0.0;
-      TotalGridVel[iDim] = 0.0;
-    }
-    TotalArea = 0.0;
-    TotalRadius = 0.0;
+  /*--- Local sums of all the spans (area, radius, turbo normal, normal, and grid velocity), they are
+   * reduced with a single collective instead of one per quantity and span. ---*/
+  const unsigned short nSpan = nSpanWiseSections[marker_flag - 1];
+  const unsigned short nSum = 2 + 3 * nDim;
+  su2activematrix localSums(nSpan, nSum), totalSums(nSpan, nSum);
+  localSums = su2double(0.0);
+
+  for (iSpan = 0; iSpan < nSpan; iSpan++) {
+    su2double* sums = localSums[iSpan];
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery() + 1; iMarkerTP++) {
         if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP) {
@@ -5960,54 +5861,35 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig* config, unsigned short val_iZo
                 radius = 0.0;
               }
               Area = turbovertex[iMarker][iSpan][iVertex]->GetArea();
-              TotalArea += Area;
-              TotalRadius += radius;
+              sums[0] += Area;
+              sums[1] += radius;
               for (iDim = 0; iDim < nDim; iDim++) {
-                TotalTurboNormal[iDim] += TurboNormal[iDim];
-                TotalNormal[iDim] += Normal[iDim];
+                sums[2 + iDim] += TurboNormal[iDim];
+                sums[2 + nDim + iDim] += Normal[iDim];
               }
               if (grid_movement) {
                 gridVel = nodes->GetGridVel(iPoint);
-                for (iDim = 0; iDim < nDim; iDim++) TotalGridVel[iDim] += gridVel[iDim];
+                for (iDim = 0; iDim < nDim; iDim++) sums[2 + 2 * nDim + iDim] += gridVel[iDim];
               }
             }
           }
         }
       }
     }
+  }
 
-#ifdef HAVE_MPI
-
-    MyTotalArea = TotalArea;
-    TotalArea = 0;
-    MyTotalRadius = TotalRadius;
-    TotalRadius = 0;
-    SU2_MPI::Allreduce(&MyTotalArea, &TotalArea, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(&MyTotalRadius, &TotalRadius, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-    MyTotalTurboNormal = new su2double[nDim];
-    MyTotalNormal = new su2double[nDim];
-    MyTotalGridVel = new su2double[nDim];
+  SU2_MPI::Allreduce(localSums.data(), totalSums.data(), localSums.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
+  /*--- start computing the average quantities span wise --- */
+  for (iSpan = 0; iSpan < nSpan; iSpan++) {
+    TotalArea = totalSums(iSpan, 0);
+    TotalRadius = totalSums(iSpan, 1);
     for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalTurboNormal[iDim] = TotalTurboNormal[iDim];
-      TotalTurboNormal[iDim] = 0.0;
-      MyTotalNormal[iDim] = TotalNormal[iDim];
-      TotalNormal[iDim] = 0.0;
-      MyTotalGridVel[iDim] = TotalGridVel[iDim];
-      TotalGridVel[iDim] = 0.0;
+      TotalTurboNormal[iDim] = totalSums(iSpan, 2 + iDim);
+      TotalNormal[iDim] = totalSums(iSpan, 2 + nDim + iDim);
+      TotalGridVel[iDim] = totalSums(iSpan, 2 + 2 * nDim + iDim);
     }
 
-    SU2_MPI::Allreduce(MyTotalTurboNormal, TotalTurboNormal, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(MyTotalNormal, TotalNormal, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    SU2_MPI::Allreduce(MyTotalGridVel, TotalGridVel, nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-    delete[] MyTotalTurboNormal;
-    delete[] MyTotalNormal;
-    delete[] MyTotalGridVel;
-
-#endif
-
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery() + 1; iMarkerTP++) {
         if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP) {
@@ -7031,8 +6913,40 @@ void CPhysicalGeometry::FindUniqueNode_PeriodicBound(const CConfig* config) {
 }
 
 void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action) {
-  /*--- Update values of faces of the edge ---*/
-  if (action != ALLOCATE) {
+  /*--- With DUAL_GRID_UPDATE_TOL, an update only recomputes the elements with points that moved more than the
+   * tolerance, the contributions computed with the previous coordinates are removed and the new ones added.
+   * The metrics then correspond to CoordMetrics, which lags the coordinates by less than the tolerance.
+   * The discrete adjoint needs the dependence of all the metrics on the coordinates. ---*/
+
+  const su2double tol = config->GetDiscrete_Adjoint() ? 0.0 : config->GetDualGrid_UpdateTol();
+  const bool incremental = (action != ALLOCATE) && (tol > 0.0) && (CoordMetrics.rows() == nPoint);
+  const bool threaded = (omp_get_num_threads() > 1);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (threaded) GetElementColoring();
+    lsqWeights.Invalidate();
+    if (!incremental) {
+      if (tol > 0.0) CoordMetrics.resize(nPoint, nDim);
+      MovedPoint.clear();
+      MetricsChanged.clear();
+      LocalDomainVolume = 0.0;
+    } else {
+      MovedPoint.resize(nPoint);
+      MetricsChanged.resize(nPoint);
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  if (incremental) {
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      const auto dist2 = GeometryToolbox::SquaredDistance(nDim, nodes->GetCoord(iPoint), CoordMetrics[iPoint]);
+      MovedPoint[iPoint] = dist2 > tol * tol;
+      MetricsChanged[iPoint] = false;
+    }
+    END_SU2_OMP_FOR
+  } else if (action != ALLOCATE) {
+    /*--- Update values of faces of the edge ---*/
     su2double ZeroArea[MAXNDIM] = {0.0};
 
     SU2_OMP_FOR_STAT(1024)
@@ -7044,126 +6958,189 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
     END_SU2_OMP_FOR
   }
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { /*--- The following is difficult to parallelize with threads. ---*/
+  su2double my_DomainVolume = 0.0;
 
-    su2double my_DomainVolume = 0.0;
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto nNodes = elem[iElem]->GetnNodes();
+  /*--- Adds (or subtracts) the contributions of an element, computed with the given coordinates, to the
+   * volumes of its points and to the normals of its edges. Flipping the orientation of the faces negates them. ---*/
 
-      /*--- To make preaccumulation more effective, use as few inputs
-       as possible, recomputing intermediate quantities as needed. ---*/
-      AD::StartPreacc();
+  auto ElementContribution = [&](unsigned long iElem, const array<const su2double*, N_POINTS_MAXIMUM>& Coord,
+                                 bool subtract) {
+    const auto nNodes = elem[iElem]->GetnNodes();
 
-      /*--- Get pointers to the coordinates of all the element nodes ---*/
-      array<const su2double*, N_POINTS_MAXIMUM> Coord;
+    /*--- To make preaccumulation more effective, use as few inputs
+     as possible, recomputing intermediate quantities as needed.
+     Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (!threaded) AD::StartPreacc();
 
-      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-        auto iPoint = elem[iElem]->GetNode(iNode);
-        Coord[iNode] = nodes->GetCoord(iPoint);
 #ifdef CODI_REVERSE_TYPE
-        /*--- The same points and edges will be referenced multiple times as they are common
-         to many of the element's faces, therefore they are "registered" here only once. ---*/
-        AD::SetPreaccIn(nodes->Volume(iPoint));
-        for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
-          auto jPoint = elem[iElem]->GetNode(jNode);
-          auto iEdge = FindEdge(iPoint, jPoint, false);
-          if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
-        }
-#endif
+    /*--- The same points and edges will be referenced multiple times as they are common
+     to many of the element's faces, therefore they are "registered" here only once. ---*/
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      auto iPoint = elem[iElem]->GetNode(iNode);
+      AD::SetPreaccIn(nodes->Volume(iPoint));
+      for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
+        auto jPoint = elem[iElem]->GetNode(jNode);
+        auto iEdge = FindEdge(iPoint, jPoint, false);
+        if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
       }
-      AD::SetPreaccIn(Coord, nNodes, nDim);
+    }
+#endif
+    AD::SetPreaccIn(Coord, nNodes, nDim);
 
-      /*--- Compute the element median CG coordinates ---*/
-      auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(nDim, Coord);
-      AD::SetPreaccOut(Coord_Elem_CG, nDim);
+    /*--- Compute the element median CG coordinates ---*/
+    auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(nDim, Coord);
+    AD::SetPreaccOut(Coord_Elem_CG, nDim);
 
-      for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
-        /*--- In 2D all the faces have only one edge ---*/
-        unsigned short nEdgesFace = 1;
+    for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+      /*--- In 2D all the faces have only one edge ---*/
+      unsigned short nEdgesFace = 1;
 
-        /*--- In 3D the number of edges per face is the same as the number of point
-         per face and the median CG of the face is needed. ---*/
-        su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
-        if (nDim == 3) {
-          nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+      /*--- In 3D the number of edges per face is the same as the number of point
+       per face and the median CG of the face is needed. ---*/
+      su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
+      if (nDim == 3) {
+        nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
 
-          for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
-            auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
-            for (unsigned short iDim = 0; iDim < nDim; iDim++)
-              Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim] / nEdgesFace;
-          }
+        for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
+          auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim] / nEdgesFace;
         }
+      }
 
-        /*-- Loop over the edges of a face ---*/
-        for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
-          const auto face_iNode = elem[iElem]->GetFaces(iFace, iEdgesFace);
-          unsigned short face_jNode;
+      /*-- Loop over the edges of a face ---*/
+      for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+        const auto face_iNode = elem[iElem]->GetFaces(iFace, iEdgesFace);
+        unsigned short face_jNode;
 
-          if (nDim == 2) {
-            /*--- In 2D only one edge (two points) per edge ---*/
-            face_jNode = elem[iElem]->GetFaces(iFace, 1);
-          } else {
-            /*--- In 3D we "circle around" the face ---*/
-            face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace + 1) % nEdgesFace);
-          }
+        if (nDim == 2) {
+          /*--- In 2D only one edge (two points) per edge ---*/
+          face_jNode = elem[iElem]->GetFaces(iFace, 1);
+        } else {
+          /*--- In 3D we "circle around" the face ---*/
+          face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace + 1) % nEdgesFace);
+        }
 
-          const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
-          const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
+        const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
+        const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
 
-          /*--- We define a direction (from the smalest index to the greatest) --*/
-          const bool change_face_orientation = (face_iPoint > face_jPoint);
-          const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+        /*--- We define a direction (from the smalest index to the greatest) --*/
+        const bool change_face_orientation = (face_iPoint > face_jPoint) != subtract;
+        const auto iEdge = FindEdge(face_iPoint, face_jPoint);
 
-          su2double Coord_Edge_CG[MAXNDIM] = {0.0};
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
-          }
-
-          su2double Volume_i, Volume_j;
+        su2double Coord_Edge_CG[MAXNDIM] = {0.0};
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
+        }
 
-          if (nDim == 2) {
-            /*--- Two dimensional problem ---*/
-            if (change_face_orientation)
-              edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
-            else
-              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+        su2double Volume_i, Volume_j;
 
-            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
-            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
-          } else {
-            /*--- Three dimensional problem ---*/
-            if (change_face_orientation)
-              edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-            else
-              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+        if (nDim == 2) {
+          /*--- Two dimensional problem ---*/
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
 
-            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-          }
+          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
+          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
+        } else {
+          /*--- Three dimensional problem ---*/
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
 
-          nodes->AddVolume(face_iPoint, Volume_i);
-          nodes->AddVolume(face_jPoint, Volume_j);
+          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+        }
 
-          my_DomainVolume += Volume_i + Volume_j;
+        if (subtract) {
+          Volume_i = -Volume_i;
+          Volume_j = -Volume_j;
         }
+        nodes->AddVolume(face_iPoint, Volume_i);
+        nodes->AddVolume(face_jPoint, Volume_j);
+
+        my_DomainVolume += Volume_i + Volume_j;
       }
+    }
 
 #ifdef CODI_REVERSE_TYPE
-      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-        auto iPoint = elem[iElem]->GetNode(iNode);
-        AD::SetPreaccOut(nodes->Volume(iPoint));
-        for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
-          auto jPoint = elem[iElem]->GetNode(jNode);
-          auto iEdge = FindEdge(iPoint, jPoint, false);
-          if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
-        }
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      auto iPoint = elem[iElem]->GetNode(iNode);
+      AD::SetPreaccOut(nodes->Volume(iPoint));
+      for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
+        auto jPoint = elem[iElem]->GetNode(jNode);
+        auto iEdge = FindEdge(iPoint, jPoint, false);
+        if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
       }
+    }
 #endif
-      AD::EndPreacc();
+    AD::EndPreacc();
+  };
+
+  auto UpdateElement = [&](unsigned long iElem) {
+    const auto nNodes = elem[iElem]->GetnNodes();
+
+    /*--- Get pointers to the coordinates of all the element nodes ---*/
+    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+
+    if (!incremental) {
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+        Coord[iNode] = nodes->GetCoord(elem[iElem]->GetNode(iNode));
+      ElementContribution(iElem, Coord, false);
+      return;
+    }
+
+    bool moved = false;
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const auto iPoint = elem[iElem]->GetNode(iNode);
+      Coord[iNode] = CoordMetrics[iPoint];
+      moved |= MovedPoint[iPoint];
     }
+    if (!moved) return;
+
+    ElementContribution(iElem, Coord, true);
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const auto iPoint = elem[iElem]->GetNode(iNode);
+      if (MovedPoint[iPoint]) Coord[iNode] = nodes->GetCoord(iPoint);
+      MetricsChanged[iPoint] = true;
+    }
+    ElementContribution(iElem, Coord, false);
+  };
+
+  if (threaded) {
+    /*--- The elements of a color do not share points, thus neither edges. ---*/
+    const auto& coloring = GetElementColoring();
+
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); iColor++) {
+      const auto elems = coloring.innerIdx(iColor);
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, GetElementColorGroupSize()))
+      for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); k++) UpdateElement(elems[k]);
+      END_SU2_OMP_FOR
+    }
+  } else {
+    for (auto iElem = 0ul; iElem < nElem; iElem++) UpdateElement(iElem);
+  }
+
+  atomicAdd(my_DomainVolume, LocalDomainVolume);
+
+  /*--- Store the coordinates for which the metrics were computed. ---*/
+
+  if (tol > 0.0) {
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      if (incremental && !MovedPoint[iPoint]) continue;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) CoordMetrics(iPoint, iDim) = nodes->GetCoord(iPoint, iDim);
+    }
+    END_SU2_OMP_FOR
+  }
 
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
     su2double DomainVolume;
-    SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&LocalDomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
     config->SetDomainVolume(DomainVolume);
 
     if ((rank == MASTER_NODE) && (action == ALLOCATE)) {
@@ -7184,12 +7161,26 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
 }
 
 void CPhysicalGeometry::SetBoundControlVolume(const CConfig* config, unsigned short action) {
+  /*--- After an incremental update of the volumes (see SetControlVolume) only the markers with points that
+   * moved are recomputed, with the coordinates for which the volume metrics were computed. ---*/
+
+  const bool incremental = (action != ALLOCATE) && !MovedPoint.empty();
+
+  auto SkipMarker = [&](unsigned short iMarker) {
+    if (!incremental) return false;
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+      if (MovedPoint[vertex[iMarker][iVertex]->GetNode()]) return false;
+    return true;
+  };
+
   /*--- Clear normals ---*/
 
   if (action != ALLOCATE) {
     SU2_OMP_FOR_DYN(1)
-    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++)
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (SkipMarker(iMarker)) continue;
       for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) vertex[iMarker][iVertex]->SetZeroValues();
+    }
     END_SU2_OMP_FOR
   }
 
@@ -7197,6 +7188,7 @@ void CPhysicalGeometry::SetBoundControlVolume(const CConfig* config, unsigned sh
 
   SU2_OMP_FOR_DYN(1)
   for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (SkipMarker(iMarker)) continue;
     for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
       const auto nNodes = bound[iMarker][iElem]->GetnNodes();
 
@@ -7209,7 +7201,7 @@ void CPhysicalGeometry::SetBoundControlVolume(const CConfig* config, unsigned sh
       for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
         const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
         const auto iVertex = nodes->GetVertex(iPoint, iMarker);
-        Coord[iNode] = nodes->GetCoord(iPoint);
+        Coord[iNode] = incremental ? CoordMetrics[iPoint] : nodes->GetCoord(iPoint);
         AD::SetPreaccIn(vertex[iMarker][iVertex]->GetNormal(), nDim);
       }
       AD::SetPreaccIn(Coord, nNodes, nDim);
@@ -7708,6 +7700,192 @@ void CPhysicalGeometry::SetBoundTecPlot(char mesh_filename[MAX_STRING_SIZE], boo
   Tecplot_File.close();
 }
 
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+namespace {
+/*--- Identifies the files of the partition cache (SetColorGrid_Parallel). ---*/
+constexpr uint64_t PartitionCacheMagic = 0x53553250415254;
+constexpr uint64_t PartitionCacheVersion = 1;
+
+/*--- Identifies the files of the measured load balancing weights (WriteLoadBalanceWeights), the
+ * weights are stored as real numbers and scaled to integers for ParMETIS. ---*/
+constexpr uint64_t LoadBalanceMagic = 0x5355324c4f4144;
+constexpr uint64_t LoadBalanceVersion = 1;
+constexpr passivedouble LoadBalanceWeightScale = 16;
+
+/*--- Interface points of the zones partitioned so far, for the co-partitioning (PARMETIS_COPARTITION),
+ * all ranks hold all of them. ---*/
+vector<su2double> CopartitionCoords;
+vector<int> CopartitionColors;
+
+/*!
+ * \brief Name of the measured weights file of a rank, which holds the weights of its linear piece of the grid.
+ */
+string LoadBalanceFileName(const CConfig* config, unsigned short nZone, int rank) {
+  auto filename = config->GetLoad_Balance_FileName();
+  if (nZone > 1) filename += "_" + to_string(config->GetiZone());
+  return filename + "_" + to_string(rank) + ".dat";
+}
+
+/*!
+ * \brief FNV-1a hash of an array, used to check that a cached partitioning matches the inputs of ParMETIS.
+ */
+template <class T>
+uint64_t HashArray(const T* data, size_t size, uint64_t hash = 0xcbf29ce484222325) {
+  const auto bytes = reinterpret_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size * sizeof(T); ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+/*!
+ * \brief Geometric partitioning, the Hilbert curve through the points is split into pieces of equal weight.
+ * \note The splitting keys are found by a bisection of the (64 bit) key space for all pieces at once, i.e. at
+ *       most 64 reductions of nParts values, the points are not moved between the ranks.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] coords - Coordinates of the local points.
+ * \param[in] weights - Weights of the local points (stride "stride", the first is used).
+ * \param[in] nParts - Number of pieces.
+ * \param[out] part - Piece of each local point.
+ * \param[in] comm - Communicator.
+ */
+template <class CoordsType, class WeightType, class PartType>
+void HilbertCurvePartition(unsigned short nDim, const CoordsType& coords, const vector<WeightType>& weights,
+                           size_t stride, int nParts, vector<PartType>& part, MPI_Comm comm) {
+  enum : size_t { MAXNDIM = 3 };
+  const auto nPoint = part.size();
+
+  /*--- Bounding box of all the points. ---*/
+
+  passivedouble bbox[2 * MAXNDIM] = {0.0}, globalBbox[2 * MAXNDIM];
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    bbox[iDim] = numeric_limits<passivedouble>::max();
+    bbox[nDim + iDim] = numeric_limits<passivedouble>::max();
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      const auto x = SU2_TYPE::GetValue(coords(iPoint, iDim));
+      bbox[iDim] = min(bbox[iDim], x);
+      bbox[nDim + iDim] = min(bbox[nDim + iDim], -x);
+    }
+  }
+  SU2_MPI::Allreduce(bbox, globalBbox, 2 * nDim, MPI_DOUBLE, MPI_MIN, comm);
+
+  /*--- Index of the points along the curve, on a lattice of 2^bits points per direction. ---*/
+
+  const unsigned bits = 64 / nDim;
+  const passivedouble maxLattice = pow(2.0, bits) - 1;
+
+  vector<pair<uint64_t, passivedouble> > keys(nPoint);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    uint32_t lattice[MAXNDIM] = {0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const auto lo = globalBbox[iDim], hi = -globalBbox[nDim + iDim];
+      const auto x = (SU2_TYPE::GetValue(coords(iPoint, iDim)) - lo) / max(hi - lo, EPS);
+      lattice[iDim] = static_cast<uint32_t>(min(max(x, 0.0), 1.0) * maxLattice);
+    }
+    keys[iPoint] = make_pair(GeometryToolbox::HilbertIndex(nDim, lattice, bits), weights[iPoint * stride]);
+  }
+
+  /*--- Cumulative weights of the sorted local points. ---*/
+
+  vector<pair<uint64_t, passivedouble> > sorted(keys);
+  sort(sorted.begin(), sorted.end());
+  vector<passivedouble> cumulative(nPoint + 1, 0.0);
+  for (unsigned long i = 0; i < nPoint; ++i) cumulative[i + 1] = cumulative[i] + sorted[i].second;
+
+  passivedouble totalWeight = 0.0;
+  SU2_MPI::Allreduce(&cumulative[nPoint], &totalWeight, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+  /*--- Piece i ends at the smallest key for which the weight of the points up to it reaches (i+1)/nParts
+   * of the total, bisection of [lower, upper] for the nParts-1 splitting keys. ---*/
+
+  const auto nSplit = nParts - 1;
+  vector<uint64_t> lower(nSplit, 0), upper(nSplit, numeric_limits<uint64_t>::max());
+  vector<passivedouble> localBelow(nSplit), globalBelow(nSplit);
+
+  for (int iter = 0; iter < 64; ++iter) {
+    bool done = true;
+    for (int i = 0; i < nSplit; ++i) {
+      const auto mid = lower[i] + (upper[i] - lower[i]) / 2;
+      const auto end = upper_bound(sorted.begin(), sorted.end(), make_pair(mid, numeric_limits<passivedouble>::max()));
+      localBelow[i] = cumulative[end - sorted.begin()];
+      done &= (lower[i] == upper[i]);
+    }
+    if (done) break;
+
+    SU2_MPI::Allreduce(localBelow.data(), globalBelow.data(), nSplit, MPI_DOUBLE, MPI_SUM, comm);
+
+    for (int i = 0; i < nSplit; ++i) {
+      const auto mid = lower[i] + (upper[i] - lower[i]) / 2;
+      if (globalBelow[i] < totalWeight * (i + 1) / nParts) {
+        lower[i] = mid + 1;
+      } else {
+        upper[i] = mid;
+      }
+    }
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    part[iPoint] = lower_bound(lower.begin(), lower.end(), keys[iPoint].first) - lower.begin();
+  }
+}
+}  // namespace
+#endif
+
+vector<unsigned short> CPhysicalGeometry::GetLinearMarkerFlags(const CConfig* config) const {
+  /*--- The surface elements are only known by the master rank (LoadUnpartitionedSurfaceElements), which
+   * flags the points of each marker and sends them to the ranks that own them in the linear partitioning. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  auto comm = SU2_MPI::GetComm();
+
+  vector<int> sendCounts(size, 0), recvCounts(size, 0), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  vector<unsigned long> sendPoints;
+  vector<unsigned short> sendFlags;
+
+  if (rank == MASTER_NODE) {
+    vector<pair<unsigned long, unsigned short> > points;
+    for (unsigned short iMarker = 0; iMarker < nMarker; ++iMarker) {
+      const bool interface = (config->GetMarker_All_ZoneInterface(iMarker) == YES) ||
+                             (config->GetMarker_All_KindBC(iMarker) == FLUID_INTERFACE);
+      const unsigned short flag = MARKER_POINT | (interface ? INTERFACE_POINT : 0);
+      for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; ++iElem) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); ++iNode) {
+          points.emplace_back(bound[iMarker][iElem]->GetNode(iNode), flag);
+        }
+      }
+    }
+    sort(points.begin(), points.end());
+
+    /*--- Sorted by global index, hence also by destination rank. ---*/
+    for (const auto& point : points) {
+      if (!sendPoints.empty() && sendPoints.back() == point.first) {
+        sendFlags.back() |= point.second;
+        continue;
+      }
+      sendPoints.push_back(point.first);
+      sendFlags.push_back(point.second);
+      ++sendCounts[pointPartitioner.GetRankContainingIndex(point.first)];
+    }
+    for (int iRank = 0; iRank < size; ++iRank) sendDispl[iRank + 1] = sendDispl[iRank] + sendCounts[iRank];
+  }
+
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+  for (int iRank = 0; iRank < size; ++iRank) recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+
+  vector<unsigned long> recvPoints(recvDispl[size]);
+  vector<unsigned short> recvFlags(recvDispl[size]);
+  SU2_MPI::Alltoallv(sendPoints.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG, recvPoints.data(),
+                     recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG, comm);
+  SU2_MPI::Alltoallv(sendFlags.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_SHORT, recvFlags.data(),
+                     recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_SHORT, comm);
+
+  vector<unsigned short> flags(nPoint, 0);
+  const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+  for (size_t i = 0; i < recvPoints.size(); ++i) flags[recvPoints[i] - firstIndex] = recvFlags[i];
+  return flags;
+}
+
 void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   /*--- We need to have parallel support with MPI and have the ParMETIS
    library compiled and linked for parallel graph partitioning. ---*/
@@ -7729,7 +7907,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   idx_t wgtflag = 2;
   idx_t numflag = 0;
   idx_t ncon = 1;
-  real_t ubvec = 1.0 + config->GetParMETIS_Tolerance();
+  vector<real_t> ubvec(1, 1.0 + config->GetParMETIS_Tolerance());
   idx_t nparts = size;
   idx_t options[METIS_NOPTIONS];
   METIS_SetDefaultOptions(options);
@@ -7737,8 +7915,6 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 
   /*--- Fill the necessary ParMETIS input data arrays. ---*/
 
-  vector<real_t> tpwgts(size, 1.0 / size);
-
   vector<idx_t> vtxdist(size + 1);
   vtxdist[0] = 0;
   for (int i = 0; i < size; i++) {
@@ -7759,22 +7935,305 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
   }
 
+  /*--- Weights measured by a previous run (see WriteLoadBalanceWeights), they replace the static
+   * weights only if the files of all ranks are valid. ---*/
+
+  bool measured = false;
+  if (config->GetLoad_Balance_Weights()) {
+    vector<passivedouble> weights(nPoint);
+    int valid = 0;
+    ifstream weights_file(LoadBalanceFileName(config, nZone, rank), ios::binary);
+    if (weights_file.is_open()) {
+      uint64_t header[4] = {0};
+      weights_file.read(reinterpret_cast<char*>(header), sizeof(header));
+      if (weights_file && header[0] == LoadBalanceMagic && header[1] == LoadBalanceVersion &&
+          header[2] == nPoint && header[3] == Global_nPointDomain) {
+        weights_file.read(reinterpret_cast<char*>(weights.data()), nPoint * sizeof(passivedouble));
+        valid = weights_file.good();
+      }
+    }
+    int allValid = 0;
+    SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, comm);
+
+    if (allValid) {
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        vwgt[iPoint] = max<idx_t>(1, lround(LoadBalanceWeightScale * weights[iPoint]));
+      }
+      measured = true;
+      if (rank == MASTER_NODE) cout << "Using the measured load balancing weights." << endl;
+    } else if (rank == MASTER_NODE) {
+      cout << "WARNING: Missing or outdated measured load balancing weights, using the static weights." << endl;
+    }
+  }
+
+  /*--- Additional balance constraints, with weight 1 for the points on the boundaries and/or interfaces.
+   * Constraints without points are ignored, ParMETIS cannot balance them. ---*/
+
+  vector<unsigned short> constraints;
+  if (config->GetParMETIS_Constraint(PARMETIS_CONSTRAINT::BOUNDARY_VERTICES)) constraints.push_back(MARKER_POINT);
+  if (config->GetParMETIS_Constraint(PARMETIS_CONSTRAINT::INTERFACE_VERTICES)) constraints.push_back(INTERFACE_POINT);
+
+  const bool copartition = config->GetParMETIS_Copartition() && (nZone > 1);
+  vector<unsigned short> flags;
+  if (!constraints.empty() || copartition) flags = GetLinearMarkerFlags(config);
+
+  if (!constraints.empty()) {
+    vector<unsigned long> localCount(constraints.size(), 0), globalCount(constraints.size(), 0);
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      for (size_t iCon = 0; iCon < constraints.size(); ++iCon) localCount[iCon] += (flags[iPoint] & constraints[iCon]) != 0;
+    }
+    SU2_MPI::Allreduce(localCount.data(), globalCount.data(), constraints.size(), MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
+    vector<unsigned short> active;
+    for (size_t iCon = 0; iCon < constraints.size(); ++iCon) {
+      if (globalCount[iCon] > 0) active.push_back(constraints[iCon]);
+    }
+    if (active.size() < constraints.size() && rank == MASTER_NODE) {
+      cout << "WARNING: Some ParMETIS constraints have no points (no markers of that kind) and are ignored." << endl;
+    }
+
+    if (!active.empty()) {
+      ncon = 1 + active.size();
+      vector<idx_t> multiWgt(nPoint * ncon);
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        multiWgt[iPoint * ncon] = vwgt[iPoint];
+        for (size_t iCon = 0; iCon < active.size(); ++iCon) {
+          multiWgt[iPoint * ncon + 1 + iCon] = (flags[iPoint] & active[iCon]) != 0;
+        }
+      }
+      vwgt.swap(multiWgt);
+      ubvec.resize(ncon, 1.0 + config->GetParMETIS_Constraint_Tolerance());
+      if (rank == MASTER_NODE) cout << "Multi-constraint partitioning (" << ncon << " constraints)." << endl;
+    }
+  }
+
+  vector<real_t> tpwgts(ncon * size, 1.0 / size);
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
   vector<idx_t> part(nPoint);
 
+  /*--- The partitioning of a previous run can be reused if the inputs of ParMETIS (graph, weights,
+   * number of ranks) and the coordinates of the points are the same. Each rank keeps its own file
+   * with the colors of its initial (linear) piece of the grid. ---*/
+
+  const bool cache = config->GetPartition_Cache();
+  string cacheFilename;
+  uint64_t hash = 0;
+  int previous = 0;
+  int cached = 0;
+
+  if (cache) {
+    cacheFilename = config->GetPartition_Cache_FileName();
+    if (nZone > 1) cacheFilename += "_" + to_string(config->GetiZone());
+    cacheFilename += "_" + to_string(rank) + ".dat";
+
+    const uint64_t sizes[] = {uint64_t(size), Global_nPointDomain, nPoint, uint64_t(ncon), uint64_t(copartition),
+                              uint64_t(config->GetKind_Partitioner()), uint64_t(config->GetPartitioner_Refinement())};
+    hash = HashArray(sizes, 7);
+    hash = HashArray(ubvec.data(), ubvec.size(), hash);
+    hash = HashArray(xadj.data(), xadj.size(), hash);
+    hash = HashArray(adjacency.data(), adjacency.size(), hash);
+    hash = HashArray(vwgt.data(), vwgt.size(), hash);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble coord = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+        hash = HashArray(&coord, 1, hash);
+      }
+    }
+
+    int valid = 0;
+    ifstream cache_file(cacheFilename, ios::binary);
+    if (cache_file.is_open()) {
+      uint64_t header[4] = {0};
+      cache_file.read(reinterpret_cast<char*>(header), sizeof(header));
+      if (cache_file && header[0] == PartitionCacheMagic && header[1] == PartitionCacheVersion &&
+          header[2] == nPoint) {
+        cache_file.read(reinterpret_cast<char*>(part.data()), nPoint * sizeof(idx_t));
+        previous = cache_file.good();
+        valid = previous && header[3] == hash;
+      }
+    }
+
+    /*--- Any rank with a missing or outdated file invalidates the entire cache. A partitioning of
+     * the same grid with other weights can still be the starting point of the repartitioning. ---*/
+    SU2_MPI::Allreduce(&valid, &cached, 1, MPI_INT, MPI_MIN, comm);
+    const int localPrevious = previous;
+    SU2_MPI::Allreduce(&localPrevious, &previous, 1, MPI_INT, MPI_MIN, comm);
+
+    if (cached && rank == MASTER_NODE) {
+      cout << "Graph partitioning read from the cache (" << cacheFilename << ")." << endl;
+    }
+  }
+
   /*--- Calling ParMETIS ---*/
 
-  if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-  auto err =
-      ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag, &numflag,
-                           &ncon, &nparts, tpwgts.data(), &ubvec, options, &edgecut, part.data(), &comm);
+  /*--- With measured weights, the partitioning of a previous run (usually the one that measured them)
+   * is adapted, which is faster and keeps most points on the same rank. The distribution of the
+   * graph is linear, not that partitioning, hence the "uncoupled" mode of ParMETIS. ---*/
+
+  auto AdaptiveRepart = [&]() {
+    if (rank == MASTER_NODE) cout << "Calling ParMETIS (adaptive repartitioning)...";
+    idx_t adaptiveOptions[4] = {1, 0, 15, PARMETIS_PSR_UNCOUPLED};
+    real_t ipc2redist = 1000.0;
+    return ParMETIS_V3_AdaptiveRepart(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, nullptr,
+                                      &wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), &ipc2redist,
+                                      adaptiveOptions, &edgecut, part.data(), &comm);
+  };
+
+  int err = METIS_OK;
+  bool graphPartitioning = !cached;
+  if (cached) {
+    /*--- Nothing to do, the cached partitioning is already renumbered for the co-partitioning. ---*/
+  } else if (measured && previous) {
+    err = AdaptiveRepart();
+  } else if (config->GetKind_Partitioner() == PARTITIONER::HILBERT_CURVE) {
+    /*--- Geometric partitioning, optionally refined by the adaptive repartitioning, which also
+     * accounts for the additional constraints. ---*/
+    graphPartitioning = config->GetPartitioner_Refinement();
+    if (rank == MASTER_NODE) {
+      if (ncon > 1 && !graphPartitioning) {
+        cout << "WARNING: The additional constraints are ignored by the geometric partitioning." << endl;
+      }
+      cout << "Geometric partitioning (Hilbert curve)...";
+    }
+    HilbertCurvePartition(nDim, [this](unsigned long iPoint, unsigned short iDim) {
+                            return nodes->GetCoord(iPoint, iDim); },
+                          vwgt, ncon, nparts, part, comm);
+    if (rank == MASTER_NODE) cout << " done." << endl;
+
+    if (graphPartitioning) err = AdaptiveRepart();
+  } else {
+    if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
+    err = ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag,
+                               &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), options, &edgecut, part.data(),
+                               &comm);
+  }
   if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
-  if (rank == MASTER_NODE) {
+  if (graphPartitioning && rank == MASTER_NODE) {
     cout << " graph partitioning complete (" << edgecut << " edge cuts)." << endl;
   }
 
+  /*--- Co-partitioning of the zones, the partitions of this zone are renumbered (the partitioning
+   * itself is not changed) such that its interface points are on the ranks that own the nearest
+   * interface points of the previous zones. Then its interface points are added to those. ---*/
+
+  if (copartition) {
+    vector<su2double> coord;
+    vector<unsigned long> interfacePoints;
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      if ((flags[iPoint] & INTERFACE_POINT) == 0) continue;
+      interfacePoints.push_back(iPoint);
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) coord.push_back(nodes->GetCoord(iPoint, iDim));
+    }
+
+    if (!cached && !CopartitionColors.empty()) {
+      /*--- Overlap between the partitions of this zone and the ranks of the previous zones. ---*/
+
+      vector<unsigned long> ids(CopartitionColors.size());
+      iota(ids.begin(), ids.end(), 0ul);
+      CADTPointsOnlyClass tree(nDim, ids.size(), CopartitionCoords.data(), ids.data(), false);
+
+      map<pair<int, int>, unsigned long> localOverlap;
+      for (size_t i = 0; i < interfacePoints.size(); ++i) {
+        su2double dist;
+        unsigned long id;
+        int dummy;
+        tree.DetermineNearestNode(&coord[i * nDim], dist, id, dummy);
+        ++localOverlap[make_pair(int(part[interfacePoints[i]]), CopartitionColors[id])];
+      }
+
+      vector<unsigned long> sendOverlap;
+      for (const auto& overlap : localOverlap) {
+        sendOverlap.push_back(overlap.first.first);
+        sendOverlap.push_back(overlap.first.second);
+        sendOverlap.push_back(overlap.second);
+      }
+      const int sendCount = sendOverlap.size();
+      vector<int> recvCounts(size), recvDispl(size + 1, 0);
+      SU2_MPI::Allgather(&sendCount, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+      for (int iRank = 0; iRank < size; ++iRank) recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+      vector<unsigned long> recvOverlap(recvDispl[size]);
+      SU2_MPI::Allgatherv(sendOverlap.data(), sendCount, MPI_UNSIGNED_LONG, recvOverlap.data(), recvCounts.data(),
+                          recvDispl.data(), MPI_UNSIGNED_LONG, comm);
+
+      /*--- Greedy matching (all ranks obtain the same), from the largest overlap down, the partitions
+       * without interface points keep their numbers where possible, the others take the free ranks. ---*/
+
+      map<pair<int, int>, unsigned long> overlap;
+      for (size_t i = 0; i < recvOverlap.size(); i += 3) {
+        overlap[make_pair(int(recvOverlap[i]), int(recvOverlap[i + 1]))] += recvOverlap[i + 2];
+      }
+      vector<pair<unsigned long, pair<int, int> > > sorted;
+      for (const auto& entry : overlap) sorted.emplace_back(entry.second, entry.first);
+      sort(sorted.rbegin(), sorted.rend());
+
+      vector<int> newColor(size, -1);
+      vector<bool> taken(size, false);
+      unsigned long matched = 0, total = 0;
+      for (const auto& entry : sorted) {
+        total += entry.first;
+        const int iPart = entry.second.first, iRank = entry.second.second;
+        if (newColor[iPart] >= 0 || taken[iRank]) continue;
+        newColor[iPart] = iRank;
+        taken[iRank] = true;
+        matched += entry.first;
+      }
+      for (int iPart = 0; iPart < size; ++iPart) {
+        if (newColor[iPart] < 0 && !taken[iPart]) {
+          newColor[iPart] = iPart;
+          taken[iPart] = true;
+        }
+      }
+      int iFree = 0;
+      for (int iPart = 0; iPart < size; ++iPart) {
+        if (newColor[iPart] >= 0) continue;
+        while (taken[iFree]) ++iFree;
+        newColor[iPart] = iFree;
+        taken[iFree] = true;
+      }
+
+      for (auto& color : part) color = newColor[color];
+
+      if (rank == MASTER_NODE && total > 0) {
+        cout << "Co-partitioning: " << (100 * matched) / total
+             << "% of the interface points are on the rank of the nearest point of the previous zones." << endl;
+      }
+    }
+
+    /*--- Add the interface points of this zone, with their final colors. ---*/
+
+    vector<int> color(interfacePoints.size());
+    for (size_t i = 0; i < interfacePoints.size(); ++i) color[i] = part[interfacePoints[i]];
+
+    const int sendCount = interfacePoints.size();
+    vector<int> recvCounts(size), recvDispl(size + 1, 0);
+    SU2_MPI::Allgather(&sendCount, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+    for (int iRank = 0; iRank < size; ++iRank) recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+
+    const auto offset = CopartitionColors.size();
+    CopartitionColors.resize(offset + recvDispl[size]);
+    SU2_MPI::Allgatherv(color.data(), sendCount, MPI_INT, CopartitionColors.data() + offset, recvCounts.data(),
+                        recvDispl.data(), MPI_INT, comm);
+
+    vector<passivedouble> passiveCoord(coord.size()), allCoord(recvDispl[size] * nDim);
+    for (size_t i = 0; i < coord.size(); ++i) passiveCoord[i] = SU2_TYPE::GetValue(coord[i]);
+    for (int iRank = 0; iRank <= size; ++iRank) recvDispl[iRank] *= nDim;
+    for (int iRank = 0; iRank < size; ++iRank) recvCounts[iRank] *= nDim;
+    SU2_MPI::Allgatherv(passiveCoord.data(), sendCount * nDim, MPI_DOUBLE, allCoord.data(), recvCounts.data(),
+                        recvDispl.data(), MPI_DOUBLE, comm);
+    CopartitionCoords.insert(CopartitionCoords.end(), allCoord.begin(), allCoord.end());
+  }
+
+  if (cache && !cached) {
+    ofstream cache_file(cacheFilename, ios::binary);
+    const uint64_t header[4] = {PartitionCacheMagic, PartitionCacheVersion, nPoint, hash};
+    cache_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    cache_file.write(reinterpret_cast<const char*>(part.data()), nPoint * sizeof(idx_t));
+    if (!cache_file.good()) SU2_MPI::Error("Could not write the partition cache " + cacheFilename, CURRENT_FUNCTION);
+  }
+
   /*--- Store the results of the partitioning (note that this is local
    since each processor is calling ParMETIS in parallel and storing the
    results for its initial piece of the grid. ---*/
@@ -7791,6 +8250,100 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 #endif
 }
 
+void CPhysicalGeometry::WriteLoadBalanceWeights(const CConfig* config, passivedouble cost) const {
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  if (size == SINGLE_NODE) return;
+
+  using MPI_Wrapper = typename SelectMPIWrapper<passivedouble>::W;
+  MPI_Comm comm = SU2_MPI::GetComm();
+
+  /*--- Static weights of the points, as in SetColorGrid_Parallel, and their sum. ---*/
+
+  const auto wp = config->GetParMETIS_PointWeight();
+  const auto we = config->GetParMETIS_EdgeWeight();
+
+  vector<passivedouble> weights(nPointDomain);
+  passivedouble localSums[2] = {cost, 0.0}, globalSums[2] = {0.0};
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    weights[iPoint] = wp + we * nodes->GetnPoint(iPoint);
+    localSums[1] += weights[iPoint];
+  }
+  passivedouble minCost = 0.0;
+  MPI_Wrapper::Allreduce(localSums, globalSums, 2, MPI_DOUBLE, MPI_SUM, comm);
+  MPI_Wrapper::Allreduce(&cost, &minCost, 1, MPI_DOUBLE, MPI_MIN, comm);
+
+  if (minCost <= 0.0 || localSums[1] <= 0.0) {
+    if (rank == MASTER_NODE) cout << "WARNING: The cost of the ranks was not measured, no load balancing weights written." << endl;
+    return;
+  }
+
+  /*--- The timers cannot tell the cost of each point, the points of a rank are scaled by its cost
+   * per unit of static weight, relative to the average, which preserves the total weight. ---*/
+
+  const passivedouble factor = (cost / localSums[1]) / (globalSums[0] / globalSums[1]);
+  for (auto& weight : weights) weight *= factor;
+
+  /*--- Send the weights to the ranks that hold the points in the linear partitioning, i.e. the
+   * distribution of the graph when it is partitioned by the next run. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+
+  vector<int> sendCounts(size, 0), recvCounts(size, 0), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    ++sendCounts[pointPartitioner.GetRankContainingIndex(nodes->GetGlobalIndex(iPoint))];
+  }
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + sendCounts[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+  }
+
+  vector<unsigned long> sendIndex(nPointDomain), recvIndex(recvDispl[size]);
+  vector<passivedouble> sendWeight(nPointDomain), recvWeight(recvDispl[size]);
+  vector<int> position(sendDispl.begin(), sendDispl.end() - 1);
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    const auto globalIndex = nodes->GetGlobalIndex(iPoint);
+    const auto pos = position[pointPartitioner.GetRankContainingIndex(globalIndex)]++;
+    sendIndex[pos] = globalIndex;
+    sendWeight[pos] = weights[iPoint];
+  }
+
+  SU2_MPI::Alltoallv(sendIndex.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG, recvIndex.data(),
+                     recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG, comm);
+  MPI_Wrapper::Alltoallv(sendWeight.data(), sendCounts.data(), sendDispl.data(), MPI_DOUBLE, recvWeight.data(),
+                         recvCounts.data(), recvDispl.data(), MPI_DOUBLE, comm);
+
+  /*--- Each rank writes the weights of its linear piece of the grid. ---*/
+
+  const uint64_t nLinear = pointPartitioner.GetSizeOnRank(rank);
+  const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  if (recvIndex.size() != nLinear) {
+    SU2_MPI::Error("The points of the linear partitioning are not all owned by one rank.", CURRENT_FUNCTION);
+  }
+  vector<passivedouble> linearWeights(nLinear);
+  for (size_t i = 0; i < recvIndex.size(); ++i) linearWeights[recvIndex[i] - firstIndex] = recvWeight[i];
+
+  const auto filename = LoadBalanceFileName(config, nZone, rank);
+  ofstream weights_file(filename, ios::binary);
+  const uint64_t header[4] = {LoadBalanceMagic, LoadBalanceVersion, nLinear, Global_nPointDomain};
+  weights_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  weights_file.write(reinterpret_cast<const char*>(linearWeights.data()), nLinear * sizeof(passivedouble));
+  if (!weights_file.good()) SU2_MPI::Error("Could not write the load balancing weights " + filename, CURRENT_FUNCTION);
+
+  const passivedouble imbalance = cost * size / globalSums[0];
+  passivedouble maxImbalance = 0.0;
+  MPI_Wrapper::Allreduce(&imbalance, &maxImbalance, 1, MPI_DOUBLE, MPI_MAX, comm);
+  if (rank == MASTER_NODE) {
+    cout << "Load balancing weights written (" << filename << "), measured imbalance " << maxImbalance << "." << endl;
+  }
+
+#endif
+}
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
    ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
@@ -10559,8 +11112,8 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*---         points of the elements close to a wall boundary.           ---*/
   /*--------------------------------------------------------------------------*/
 
-  std::unique_ptr<CADTElemClass> WallADT(
-      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, true));
+  std::unique_ptr<CADTElemClass> WallADT(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs,
+                                                           elemIDs, !config->GetDistributed_WallDistance()));
 
   return WallADT;
 }
@@ -10584,6 +11137,10 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
 
+    if (WallADT_Nearest.size() <= iZone) WallADT_Nearest.resize(iZone + 1);
+    auto& nearest = WallADT_Nearest[iZone];
+    nearest.resize(GetnPoint(), std::numeric_limits<unsigned long>::max());
+
     SU2_OMP_PARALLEL {
       CPHYSGEO_PARFOR
       for (unsigned long iPoint = 0; iPoint < GetnPoint(); ++iPoint) {
@@ -10592,7 +11149,7 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
         int rankID;
         su2double dist;
 
-        WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
+        WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID, nearest[iPoint]);
 
         if (dist < nodes->GetWall_Distance(iPoint)) {
           nodes->SetWall_Distance(iPoint, dist, rankID, iZone, markerID, elemID);
@@ -10602,6 +11159,177 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
     }
     END_SU2_OMP_PARALLEL
   }
+
+  /*--- With a local ADT (distributed walls) the walls of other ranks may be closer. ---*/
+  if (!WallADT->IsGlobal()) SetRemoteWallDistance(WallADT, iZone);
+}
+
+void CPhysicalGeometry::SetRemoteWallDistance(CADTElemClass* WallADT, unsigned short iZone) {
+  const auto big = numeric_limits<passivedouble>::max();
+
+  /*--- Bounding boxes of the wall elements of each rank, empty ranks have min > max. ---*/
+
+  su2double coorMin[MAXNDIM], coorMax[MAXNDIM];
+  WallADT->GetBoundingBox(coorMin, coorMax);
+
+  vector<passivedouble> localBox(2 * nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    localBox[iDim] = SU2_TYPE::GetValue(coorMin[iDim]);
+    localBox[nDim + iDim] = SU2_TYPE::GetValue(coorMax[iDim]);
+  }
+  su2passivematrix boxes(size, 2 * nDim);
+  SelectMPIWrapper<passivedouble>::W::Allgather(localBox.data(), 2 * nDim, MPI_DOUBLE, boxes.data(), 2 * nDim,
+                                                 MPI_DOUBLE, SU2_MPI::GetComm());
+
+  auto emptyBox = [&](int iRank) { return boxes(iRank, 0) > boxes(iRank, nDim); };
+
+  /*--- Squared distance from a point to a box (lower bound of the distance to the walls in it),
+   * and to the farthest corner of the box (upper bound). ---*/
+  auto boxDistance2 = [&](int iRank, unsigned long iPoint, passivedouble& upper2) {
+    passivedouble lower2 = 0.0;
+    upper2 = 0.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+      const auto dMin = boxes(iRank, iDim) - x;
+      const auto dMax = x - boxes(iRank, nDim + iDim);
+      const auto d = max({dMin, dMax, passivedouble(0)});
+      const auto D = max(fabs(dMin), fabs(dMax));
+      lower2 += d * d;
+      upper2 += D * D;
+    }
+    return lower2;
+  };
+
+  /*--- Radius (squared) beyond which no closer wall can exist for a point. ---*/
+  auto searchRadius2 = [&](unsigned long iPoint) {
+    const passivedouble dist = min(SU2_TYPE::GetValue(nodes->GetWall_Distance(iPoint)), sqrt(big));
+    auto radius2 = dist * dist;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank == rank || emptyBox(iRank)) continue;
+      passivedouble upper2;
+      boxDistance2(iRank, iPoint, upper2);
+      radius2 = min(radius2, upper2);
+    }
+    return radius2;
+  };
+
+  /*--- Send the coordinates of the points to the ranks that search them, and keep the
+   * results that improve the distances found so far. ---*/
+  auto searchRemote = [&](const vector<vector<unsigned long> >& query) {
+    vector<int> sendCount(size), recvCount(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+    for (int iRank = 0; iRank < size; ++iRank) sendCount[iRank] = query[iRank].size();
+
+    SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendDispl[iRank + 1] = sendDispl[iRank] + sendCount[iRank];
+      recvDispl[iRank + 1] = recvDispl[iRank] + recvCount[iRank];
+    }
+    auto scaled = [&](const vector<int>& v, int k) {
+      vector<int> w(v.size());
+      for (auto i = 0ul; i < v.size(); ++i) w[i] = k * v[i];
+      return w;
+    };
+
+    su2passivematrix sendCoord(sendDispl[size], nDim), recvCoord(recvDispl[size], nDim);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (auto i = 0ul; i < query[iRank].size(); ++i) {
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          sendCoord(sendDispl[iRank] + i, iDim) = SU2_TYPE::GetValue(nodes->GetCoord(query[iRank][i], iDim));
+      }
+    }
+    SelectMPIWrapper<passivedouble>::W::Alltoallv(sendCoord.data(), scaled(sendCount, nDim).data(),
+                                                   scaled(sendDispl, nDim).data(), MPI_DOUBLE, recvCoord.data(),
+                                                   scaled(recvCount, nDim).data(), scaled(recvDispl, nDim).data(),
+                                                   MPI_DOUBLE, SU2_MPI::GetComm());
+
+    /*--- Search the received points in the local ADT. ---*/
+
+    const unsigned long nRecv = recvDispl[size];
+    vector<passivedouble> recvDist(nRecv, big);
+    su2matrix<unsigned long> recvElem(nRecv, 2);
+
+    if (!WallADT->IsEmpty()) {
+      SU2_OMP_PARALLEL {
+        CPHYSGEO_PARFOR
+        for (unsigned long i = 0; i < nRecv; ++i) {
+          su2double coor[MAXNDIM] = {0.0};
+          for (auto iDim = 0u; iDim < nDim; ++iDim) coor[iDim] = recvCoord(i, iDim);
+
+          unsigned short markerID;
+          unsigned long elemID;
+          int rankID;
+          su2double dist;
+          WallADT->DetermineNearestElement(coor, dist, markerID, elemID, rankID);
+
+          recvDist[i] = SU2_TYPE::GetValue(dist);
+          recvElem(i, 0) = markerID;
+          recvElem(i, 1) = elemID;
+        }
+        END_CPHYSGEO_PARFOR
+      }
+      END_SU2_OMP_PARALLEL
+    }
+
+    /*--- Send the results back. ---*/
+
+    vector<passivedouble> sendDist(sendDispl[size]);
+    su2matrix<unsigned long> sendElem(sendDispl[size], 2);
+
+    SelectMPIWrapper<passivedouble>::W::Alltoallv(recvDist.data(), recvCount.data(), recvDispl.data(), MPI_DOUBLE,
+                                                   sendDist.data(), sendCount.data(), sendDispl.data(), MPI_DOUBLE,
+                                                   SU2_MPI::GetComm());
+    SU2_MPI::Alltoallv(recvElem.data(), scaled(recvCount, 2).data(), scaled(recvDispl, 2).data(), MPI_UNSIGNED_LONG,
+                       sendElem.data(), scaled(sendCount, 2).data(), scaled(sendDispl, 2).data(), MPI_UNSIGNED_LONG,
+                       SU2_MPI::GetComm());
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (auto i = 0ul; i < query[iRank].size(); ++i) {
+        const auto iPoint = query[iRank][i];
+        const auto iRes = sendDispl[iRank] + i;
+        if (sendDist[iRes] < nodes->GetWall_Distance(iPoint)) {
+          nodes->SetWall_Distance(iPoint, sendDist[iRes], iRank, iZone, sendElem(iRes, 0), sendElem(iRes, 1));
+        }
+      }
+    }
+  };
+
+  /*--- First round, send each point to the other rank with the closest box, if that box
+   * is within the distance found locally. ---*/
+
+  vector<int> firstRank(nPoint, -1);
+  vector<vector<unsigned long> > query(size);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const auto radius2 = searchRadius2(iPoint);
+    auto bestDist2 = big;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank == rank || emptyBox(iRank)) continue;
+      passivedouble upper2;
+      const auto lower2 = boxDistance2(iRank, iPoint, upper2);
+      if (lower2 <= radius2 && lower2 < bestDist2) {
+        firstRank[iPoint] = iRank;
+        bestDist2 = lower2;
+      }
+    }
+    if (firstRank[iPoint] >= 0) query[firstRank[iPoint]].push_back(iPoint);
+  }
+  searchRemote(query);
+
+  /*--- Second round, the other ranks whose box is within the updated distance. ---*/
+
+  for (auto& q : query) q.clear();
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    if (firstRank[iPoint] < 0) continue;
+    const auto radius2 = searchRadius2(iPoint);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank == rank || iRank == firstRank[iPoint] || emptyBox(iRank)) continue;
+      passivedouble upper2;
+      if (boxDistance2(iRank, iPoint, upper2) <= radius2) query[iRank].push_back(iPoint);
+    }
+  }
+  searchRemote(query);
 }
 
 #undef CPHYSGEO_PARFOR
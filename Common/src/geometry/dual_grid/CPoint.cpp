@@ -79,7 +79,7 @@ void CPoint::FullAllocation(unsigned short imesh, const CConfig* config) {
     /*--- The finest grid does not have children CV's. ---*/
     if (imesh != MESH_0) {
       nChildren_CV.resize(npoint) = 0;
-      Children_CV.resize(npoint);
+      Children_CV_Agglomeration.resize(npoint);
     }
   }
 
@@ -92,7 +92,7 @@ void CPoint::FullAllocation(unsigned short imesh, const CConfig* config) {
   PhysicalBoundary.resize(npoint) = false;
   PeriodicBoundary.resize(npoint) = false;
 
-  Vertex.resize(npoint);
+  VertexPtr.resize(npoint) = NO_VERTEX_DATA;
 
   /*--- For smoothing the numerical grid coordinates ---*/
   if (config->GetSmoothNumGrid()) {
@@ -136,11 +136,38 @@ void CPoint::FullAllocation(unsigned short imesh, const CConfig* config) {
 
 void CPoint::SetElems(const vector<vector<long> >& elemsMatrix) { Elem = CCompressedSparsePatternL(elemsMatrix); }
 
+void CPoint::SetElems(su2vector<long>&& outerPtr, su2vector<long>&& innerIdx) {
+  Elem = CCompressedSparsePatternL(std::move(outerPtr), std::move(innerIdx));
+}
+
 void CPoint::SetPoints(const vector<vector<unsigned long> >& pointsMatrix) {
-  Point = CCompressedSparsePatternUL(pointsMatrix);
+  size_t nNonZero = 0;
+  for (const auto& points : pointsMatrix) nNonZero += points.size();
+  checkPatternIndexRange<su2localindex>(max(pointsMatrix.size(), nNonZero));
+
+  Point = CCompressedSparsePatternLocal(pointsMatrix);
+  Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr() + Point.getOuterSize() + 1, long(-1));
+}
+
+void CPoint::SetPoints(su2vector<su2localindex>&& outerPtr, su2vector<su2localindex>&& innerIdx) {
+  Point = CCompressedSparsePatternLocal(std::move(outerPtr), std::move(innerIdx));
   Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr() + Point.getOuterSize() + 1, long(-1));
 }
 
+void CPoint::FinalizeChildren_CV() {
+  const auto npoint = nChildren_CV.size();
+  vector<unsigned long> outerPtr(npoint + 1, 0);
+  for (auto iPoint = 0ul; iPoint < npoint; ++iPoint) outerPtr[iPoint + 1] = outerPtr[iPoint] + nChildren_CV(iPoint);
+
+  Children_CV = CCompressedSparsePatternUL(outerPtr.begin(), outerPtr.end(), 0ul);
+  for (auto iPoint = 0ul; iPoint < npoint; ++iPoint)
+    for (auto iChild = 0ul; iChild < nChildren_CV(iPoint); ++iChild)
+      Children_CV.getInnerIdx(iPoint, iChild) = Children_CV_Agglomeration[iPoint][iChild];
+
+  /*--- Release the per-point lists. ---*/
+  vector<vector<unsigned long> >().swap(Children_CV_Agglomeration);
+}
+
 void CPoint::SetVolume_n() {
   assert(Volume_n.size() == Volume.size());
   parallelCopy(Volume.size(), Volume.data(), Volume_n.data());
@@ -151,6 +178,12 @@ void CPoint::SetVolume_nM1() {
   parallelCopy(Volume_n.size(), Volume_n.data(), Volume_nM1.data());
 }
 
+void CPoint::ShiftVolume_n() {
+  assert(Volume_nM1.size() == Volume_n.size());
+  SU2_OMP_SAFE_GLOBAL_ACCESS(std::swap(Volume_n, Volume_nM1);)
+  SetVolume_n();
+}
+
 void CPoint::SetVolume_Old() {
   assert(Volume_Old.size() == Volume.size());
   parallelCopy(Volume.size(), Volume.data(), Volume_Old.data());
@@ -186,6 +219,12 @@ void CPoint::SetCoord_n1() {
   parallelCopy(Coord_n.size(), Coord_n.data(), Coord_n1.data());
 }
 
+void CPoint::ShiftCoord_n() {
+  assert(Coord_n1.size() == Coord_n.size());
+  SU2_OMP_SAFE_GLOBAL_ACCESS(std::swap(Coord_n, Coord_n1);)
+  SetCoord_n();
+}
+
 void CPoint::SetCoord_Old() {
   assert(Coord_Old.size() == Coord.size());
   parallelCopy(Coord.size(), Coord.data(), Coord_Old.data());
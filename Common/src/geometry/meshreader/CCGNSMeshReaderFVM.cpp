@@ -59,7 +59,13 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig* val_config, unsigned short val_i
   }
 
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
-  if (cg_close(cgnsFileID)) cg_error_exit();
+  if (parallelIO) {
+#ifdef HAVE_MPI
+    if (cgp_close(cgnsFileID)) cgp_error_exit();
+#endif
+  } else {
+    if (cg_close(cgnsFileID)) cg_error_exit();
+  }
 
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
   ReformatCGNSVolumeConnectivity();
@@ -90,10 +96,31 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(const string& val_filename) {
    is the specific index number for this file and will be
    repeatedly used in the function calls. ---*/
 
-  if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cg_error_exit();
+  /*--- HDF5 files can be opened with the parallel API, the coordinates and the
+   connectivity of the volume sections are then read with collective calls. ---*/
+
+#ifdef HAVE_MPI
+  parallelIO = config->GetCGNS_ParallelRead() && (size > SINGLE_NODE);
+  if (parallelIO && file_type != CG_FILE_HDF5) {
+    parallelIO = false;
+    if (rank == MASTER_NODE)
+      cout << "WARNING: CGNS_PARALLEL_READ requires an HDF5 CGNS file, the file will be read in serial mode.\n";
+  }
+#endif
+
+  if (parallelIO) {
+#ifdef HAVE_MPI
+    if (cgp_mpi_comm(SU2_MPI::GetComm())) cgp_error_exit();
+    if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cgp_error_exit();
+#endif
+  } else {
+    if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cg_error_exit();
+  }
   if (rank == MASTER_NODE) {
     cout << "Reading the CGNS file: ";
-    cout << val_filename.c_str() << "." << endl;
+    cout << val_filename.c_str();
+    if (parallelIO) cout << " (parallel)";
+    cout << "." << endl;
   }
   if (cg_version(cgnsFileID, &file_version)) cg_error_exit();
   if (rank == MASTER_NODE) {
@@ -266,9 +293,20 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
 
-    if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble, &range_min, &range_max,
-                      localPointCoordinates[indC].data()))
-      cg_error_exit();
+    if (parallelIO) {
+#ifdef HAVE_MPI
+      /*--- Collective read (all ranks must call), ranks without points pass nullptr. ---*/
+      const cgsize_t memSize = numberOfLocalPoints, memMin = 1, memMax = numberOfLocalPoints;
+      auto* coords = (numberOfLocalPoints > 0) ? localPointCoordinates[indC].data() : nullptr;
+      if (cgp_coord_general_read_data(cgnsFileID, cgnsBase, cgnsZone, k + 1, &range_min, &range_max, RealDouble, 1,
+                                      &memSize, &memMin, &memMax, coords))
+        cgp_error_exit();
+#endif
+    } else {
+      if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble, &range_min, &range_max,
+                        localPointCoordinates[indC].data()))
+        cg_error_exit();
+    }
   }
 }
 
@@ -443,7 +481,17 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    partial read function in the CGNS API. Only call the CGNS API
    if we have a non-zero number of elements on this rank. ---*/
 
-  if (nElems[val_section] > 0) {
+  if (parallelIO && elemType != MIXED && elemType != NFACE_n && elemType != NGON_n) {
+#ifdef HAVE_MPI
+    /*--- Collective read of fixed-size elements (all ranks must call), ranks without elements pass nullptr.
+     Mixed sections are read with the independent partial reads below. ---*/
+    auto* conn = (nElems[val_section] > 0) ? connElemCGNS.data() : nullptr;
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
+                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank), conn) != CG_OK)
+      cgp_error_exit();
+#endif
+  } else if (nElems[val_section] > 0) {
     if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
                                         (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
@@ -0,0 +1,308 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error("The SU2 binary mesh format does not support multiple zones in one file.", CURRENT_FUNCTION);
+  }
+
+  /*--- The splitting of single surface actuator disks is only implemented by the ASCII reader. ---*/
+  const bool actuator_disk =
+      ((config->GetnMarker_ActDiskInlet() != 0) || (config->GetnMarker_ActDiskOutlet() != 0)) &&
+      ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) ||
+       ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) && (config->GetActDisk_SU2_DEF())));
+  if (actuator_disk && !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error("Single surface actuator disks are not supported by the SU2 binary mesh format.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- All ranks open the file. ---*/
+
+#ifdef HAVE_MPI
+  const int ierr =
+      MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle);
+  if (ierr != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  if (!fileHandle) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#endif
+
+  /* Read the metadata, then the points and interior elements of our rank's linear partition,
+   and the surface elements (master only). */
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+}
+
+void CSU2BinaryMeshReaderFVM::ReadBlock(uint64_t offset, uint64_t nBytes, void* buffer) {
+  /*--- The MPI counts are int, large blocks are read in chunks, and since the reads are collective
+   all ranks need to perform the same number of reads. ---*/
+
+  constexpr uint64_t maxChunk = 1ul << 30;
+
+  unsigned long nChunks = (nBytes + maxChunk - 1) / maxChunk, maxChunks = 0;
+  SU2_MPI::Allreduce(&nChunks, &maxChunks, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  auto* ptr = static_cast<char*>(buffer);
+  bool success = true;
+
+  for (auto iChunk = 0ul; iChunk < maxChunks; ++iChunk) {
+    const auto n = min(nBytes, maxChunk);
+#ifdef HAVE_MPI
+    MPI_Status status;
+    int count = 0;
+    const int ierr =
+        MPI_File_read_at_all(fileHandle, static_cast<MPI_Offset>(offset), ptr, int(n), MPI_BYTE, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    success &= (ierr == MPI_SUCCESS) && (static_cast<uint64_t>(count) == n);
+#else
+    if (n > 0) {
+      success &= (fseek(fileHandle, static_cast<long>(offset), SEEK_SET) == 0);
+      success &= (fread(ptr, 1, n, fileHandle) == n);
+    }
+#endif
+    offset += n;
+    ptr += n;
+    nBytes -= n;
+  }
+
+  if (!success) {
+    SU2_MPI::Error(string("Error reading SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  ReadBlock(0, sizeof(header), header);
+
+  if (header[SU2BinaryMesh::MAGIC] != SU2BinaryMesh::MagicNumber) {
+    SU2_MPI::Error(string("File ") + meshFilename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+  if (header[SU2BinaryMesh::VERSION] > SU2BinaryMesh::Version) {
+    SU2_MPI::Error(string("File ") + meshFilename + string(" was written by a newer version of SU2."),
+                   CURRENT_FUNCTION);
+  }
+
+  dimension = header[SU2BinaryMesh::NDIM];
+  if (dimension != 2 && dimension != 3) {
+    SU2_MPI::Error(string("Invalid dimension in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  numberOfGlobalPoints = header[SU2BinaryMesh::NPOINT];
+  numberOfGlobalElements = header[SU2BinaryMesh::NELEM];
+  numberOfMarkers = header[SU2BinaryMesh::NMARKER];
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const uint64_t firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- Our points are contiguous in the file. ---*/
+
+  vector<passivedouble> buffer(numberOfLocalPoints * dimension);
+  ReadBlock(header[SU2BinaryMesh::POINT_OFFSET] + firstPoint * dimension * sizeof(passivedouble),
+            buffer.size() * sizeof(passivedouble), buffer.data());
+
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) localPointCoordinates[k].resize(numberOfLocalPoints);
+
+  for (auto iPoint = 0ul; iPoint < numberOfLocalPoints; ++iPoint)
+    for (int k = 0; k < dimension; k++) localPointCoordinates[k][iPoint] = buffer[iPoint * dimension + k];
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /* Get partitioners to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements, 0);
+
+  const uint64_t nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const uint64_t firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- Read the entries of the offset table for our chunk of elements, and then their connectivity. ---*/
+
+  vector<uint64_t> index(nElemRead + 1);
+  ReadBlock(header[SU2BinaryMesh::ELEM_INDEX_OFFSET] + firstElem * sizeof(uint64_t),
+            index.size() * sizeof(uint64_t), index.data());
+
+  const uint64_t connBegin = index[0];
+  if (index[nElemRead] < connBegin || index[nElemRead] > header[SU2BinaryMesh::CONN_SIZE]) {
+    SU2_MPI::Error(string("Corrupt element table in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  vector<uint64_t> conn(index[nElemRead] - connBegin);
+  ReadBlock(header[SU2BinaryMesh::ELEM_CONN_OFFSET] + connBegin * sizeof(uint64_t), conn.size() * sizeof(uint64_t),
+            conn.data());
+
+  /*--- Each element is needed by all ranks that own at least one of its nodes (i.e. there will be element
+   redundancy, as with the other readers). Determine those ranks and count what goes to each one. ---*/
+
+  vector<int> elemRanks;
+  vector<uint64_t> elemRanksPtr(nElemRead + 1, 0);
+  vector<int> sendCounts(size, 0);
+
+  for (auto iElem = 0ul; iElem < nElemRead; ++iElem) {
+    const auto nPointsElem = index[iElem + 1] - index[iElem] - 1;
+    if (index[iElem + 1] <= index[iElem] || nPointsElem > N_POINTS_HEXAHEDRON) {
+      SU2_MPI::Error(string("Corrupt element table in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+    }
+    const auto* nodes = &conn[index[iElem] - connBegin + 1];
+
+    const auto begin = elemRanks.size();
+    for (auto iNode = 0ul; iNode < nPointsElem; ++iNode) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(nodes[iNode]);
+      if (find(elemRanks.begin() + begin, elemRanks.end(), iRank) == elemRanks.end()) {
+        elemRanks.push_back(iRank);
+        sendCounts[iRank] += SU2_CONN_SIZE;
+      }
+    }
+    elemRanksPtr[iElem + 1] = elemRanks.size();
+  }
+
+  /*--- Pack the elements in the format [globalID vtkType n0 ... n7], in order of global index. ---*/
+
+  vector<int> sendDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) sendDispl[iRank + 1] = sendDispl[iRank] + sendCounts[iRank];
+
+  vector<unsigned long> sendBuffer(sendDispl[size]);
+  vector<int> position(sendDispl.begin(), sendDispl.end() - 1);
+
+  for (auto iElem = 0ul; iElem < nElemRead; ++iElem) {
+    const auto* elem = &conn[index[iElem] - connBegin];
+    const auto nPointsElem = index[iElem + 1] - index[iElem] - 1;
+
+    for (auto k = elemRanksPtr[iElem]; k < elemRanksPtr[iElem + 1]; ++k) {
+      auto* dest = &sendBuffer[position[elemRanks[k]]];
+      position[elemRanks[k]] += SU2_CONN_SIZE;
+
+      dest[0] = firstElem + iElem;
+      dest[1] = elem[0];
+      for (auto iNode = 0ul; iNode < N_POINTS_HEXAHEDRON; ++iNode)
+        dest[SU2_CONN_SKIP + iNode] = (iNode < nPointsElem) ? elem[iNode + 1] : 0;
+    }
+  }
+
+  /*--- Exchange the elements. Since the element partitions are ordered by rank, the received elements
+   are sorted by global index. ---*/
+
+  vector<int> recvCounts(size, 0);
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> recvDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+  SU2_MPI::Alltoallv(sendBuffer.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  numberOfLocalElements = recvDispl[size] / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The marker table is small and read by all ranks. ---*/
+
+  vector<SU2BinaryMesh::MarkerEntry> markers(numberOfMarkers);
+  ReadBlock(header[SU2BinaryMesh::MARKER_OFFSET], markers.size() * sizeof(SU2BinaryMesh::MarkerEntry),
+            markers.data());
+
+  vector<uint64_t> conn;
+
+  for (auto iMarker = 0ul; iMarker < numberOfMarkers; ++iMarker) {
+    const auto& marker = markers[iMarker];
+    markerNames[iMarker] = string(marker.name, strnlen(marker.name, SU2BinaryMesh::MarkerNameSize));
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(
+          "Mesh file contains deprecated SEND_RECEIVE marker!\n"
+          "Please remove any SEND_RECEIVE markers from the mesh.",
+          CURRENT_FUNCTION);
+    }
+
+    /*--- The surface connectivity is handled by the master node. ---*/
+
+    conn.resize(rank == MASTER_NODE ? marker.connSize : 0);
+    ReadBlock(marker.connOffset, conn.size() * sizeof(uint64_t), conn.data());
+
+    if (rank != MASTER_NODE) continue;
+
+    auto& surfConn = surfaceElementConnectivity[iMarker];
+    surfConn.reserve(marker.nElem * SU2_CONN_SIZE);
+
+    for (auto pos = 0ul; pos < conn.size();) {
+      const auto VTK_Type = conn[pos];
+      if (VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) {
+        SU2_MPI::Error(string("Invalid surface element in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+      }
+      const uint64_t nPointsElem = nPointsOfElementType(VTK_Type);
+
+      if (dimension == 3 && VTK_Type == LINE) {
+        SU2_MPI::Error(
+            "Line boundary conditions are not possible for 3D calculations.\n"
+            "Please check the SU2 binary mesh file.",
+            CURRENT_FUNCTION);
+      }
+      if (pos + 1 + nPointsElem > conn.size()) {
+        SU2_MPI::Error(string("Corrupt marker in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+      }
+
+      surfConn.push_back(0);
+      surfConn.push_back(VTK_Type);
+      for (auto iNode = 0ul; iNode < N_POINTS_HEXAHEDRON; ++iNode)
+        surfConn.push_back((iNode < nPointsElem) ? conn[pos + 1 + iNode] : 0);
+
+      pos += 1 + nPointsElem;
+    }
+
+    if (surfConn.size() != marker.nElem * SU2_CONN_SIZE) {
+      SU2_MPI::Error(string("Corrupt marker in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+    }
+  }
+}
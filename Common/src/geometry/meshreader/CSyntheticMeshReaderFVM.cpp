@@ -0,0 +1,281 @@
+/*!
+ * \file CSyntheticMeshReaderFVM.cpp
+ * \brief Generates a structured grid directly into linear partitions for the finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSyntheticMeshReaderFVM.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+CSyntheticMeshReaderFVM::CSyntheticMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+  /* The synthetic mesh is always 3D. */
+  dimension = 3;
+
+  geometryType = config->GetSyntheticMesh_Geometry();
+  elementType = config->GetSyntheticMesh_Elements();
+  nLayers = config->GetSyntheticMesh_Layers();
+
+  for (int iDim = 0; iDim < 3; iDim++) {
+    if (config->GetMeshBoxSize(iDim) < 2) SU2_MPI::Error("MESH_BOX_SIZE must be at least 2.", CURRENT_FUNCTION);
+    nNode[iDim] = config->GetMeshBoxSize(iDim);
+  }
+
+  if (geometryType == SYNTHETIC_MESH_GEOM::ANNULUS && config->GetMeshBoxOffset(1) <= 0.0) {
+    SU2_MPI::Error("The ANNULUS synthetic mesh needs a positive inner radius (MESH_BOX_OFFSET in y).",
+                   CURRENT_FUNCTION);
+  }
+
+  SetCellElements();
+
+  /* Number of elements before each row of cells of a k plane, the last entry is the number of the plane. */
+  elementsBeforeRow.resize(nNode[1], 0);
+  for (unsigned long j = 1; j < nNode[1]; j++) {
+    elementsBeforeRow[j] = elementsBeforeRow[j - 1] + (nNode[0] - 1) * CellElements(j - 1).size();
+  }
+
+  /* Unlike the box grid, all the loops only visit the indices that are relevant to this rank, the cost of
+   the generation on each rank is proportional to its number of points. The master still stores the entire
+   surface connectivity, which is what the partitioning of the other readers expects. */
+  ComputePointCoordinates();
+  ComputeVolumeConnectivity();
+  ComputeSurfaceConnectivity();
+}
+
+void CSyntheticMeshReaderFVM::SetCellElements() {
+  using Offset = std::array<unsigned short, 3>;
+
+  /* Orientation of the tetrahedron abcd, positive when abc points away from d (see Check_IntElem_Orientation). */
+  auto orientation = [](const Offset& a, const Offset& b, const Offset& c, const Offset& d) {
+    int u[3], v[3], w[3];
+    for (int iDim = 0; iDim < 3; iDim++) {
+      u[iDim] = b[iDim] - a[iDim];
+      v[iDim] = c[iDim] - a[iDim];
+      w[iDim] = d[iDim] - a[iDim];
+    }
+    return (u[1] * v[2] - u[2] * v[1]) * w[0] + (u[2] * v[0] - u[0] * v[2]) * w[1] + (u[0] * v[1] - u[1] * v[0]) * w[2];
+  };
+
+  /* Hexahedron, same numbering as the box grid. */
+  CellElement hexa;
+  hexa.vtkType = HEXAHEDRON;
+  hexa.nNodes = N_POINTS_HEXAHEDRON;
+  hexa.offsets = {{{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}};
+  hexaCell.assign(1, hexa);
+
+  /* Six tetrahedra around the main diagonal (Kuhn), one for each order of the directions along the path from
+   (0,0,0) to (1,1,1). The faces of all cells are split along the same diagonal and therefore the mesh is
+   conforming, also with the prisms below. */
+  const int order[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  tetraCell.clear();
+  for (const auto& dirs : order) {
+    CellElement tetra;
+    tetra.vtkType = TETRAHEDRON;
+    tetra.nNodes = N_POINTS_TETRAHEDRON;
+    Offset node = {0, 0, 0};
+    for (int iNode = 0; iNode < 3; iNode++) {
+      tetra.offsets[iNode] = node;
+      node[dirs[iNode]] = 1;
+    }
+    tetra.offsets[3] = node;
+    if (orientation(tetra.offsets[0], tetra.offsets[1], tetra.offsets[2], tetra.offsets[3]) < 0)
+      std::swap(tetra.offsets[1], tetra.offsets[2]);
+    tetraCell.push_back(tetra);
+  }
+
+  /* Two prisms extruded in y, the (x,z) faces are split along the diagonal of the tetrahedra. */
+  const unsigned short triangles[2][3][2] = {{{0, 0}, {1, 0}, {1, 1}}, {{0, 0}, {1, 1}, {0, 1}}};
+  prismCell.clear();
+  for (const auto& tria : triangles) {
+    CellElement prism;
+    prism.vtkType = PRISM;
+    prism.nNodes = N_POINTS_PRISM;
+    for (int iNode = 0; iNode < 3; iNode++) {
+      prism.offsets[iNode] = {tria[iNode][0], 0, tria[iNode][1]};
+      prism.offsets[iNode + 3] = {tria[iNode][0], 1, tria[iNode][1]};
+    }
+    if (orientation(prism.offsets[0], prism.offsets[2], prism.offsets[1], prism.offsets[3]) < 0) {
+      std::swap(prism.offsets[1], prism.offsets[2]);
+      std::swap(prism.offsets[4], prism.offsets[5]);
+    }
+    prismCell.push_back(prism);
+  }
+}
+
+void CSyntheticMeshReaderFVM::ComputePointCoordinates() {
+  /* Grid lines, uniform in x and z, geometric growth of the spacing in y. */
+  const passivedouble growth = SU2_TYPE::GetValue(config->GetSyntheticMesh_Growth());
+
+  for (int iDim = 0; iDim < 3; iDim++) {
+    const passivedouble length = SU2_TYPE::GetValue(config->GetMeshBoxLength(iDim));
+    const passivedouble offset = SU2_TYPE::GetValue(config->GetMeshBoxOffset(iDim));
+    const auto nCell = nNode[iDim] - 1;
+    const bool stretched = (iDim == 1) && std::abs(growth - 1) > 1e-12;
+
+    nodeCoord[iDim].resize(nNode[iDim]);
+    for (unsigned long i = 0; i < nNode[iDim]; i++) {
+      const passivedouble s = stretched ? (std::pow(growth, i) - 1) / (std::pow(growth, nCell) - 1)
+                                        : passivedouble(i) / nCell;
+      nodeCoord[iDim][i] = offset + length * s;
+    }
+  }
+
+  /* Only the points of our linear partition are visited. */
+  numberOfGlobalPoints = nNode[0] * nNode[1] * nNode[2];
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  const auto firstIndex = pointPartitioner.GetCumulativeSizeBeforeRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  localPointCoordinates.resize(dimension);
+  for (int iDim = 0; iDim < dimension; iDim++) localPointCoordinates[iDim].resize(numberOfLocalPoints);
+
+  const passivedouble deg2rad = SU2_TYPE::GetValue(PI_NUMBER) / 180.0;
+
+  for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+    const auto globalIndex = firstIndex + iPoint;
+    const auto i = globalIndex % nNode[0];
+    const auto j = (globalIndex / nNode[0]) % nNode[1];
+    const auto k = globalIndex / (nNode[0] * nNode[1]);
+
+    const passivedouble x = nodeCoord[0][i], y = nodeCoord[1][j], z = nodeCoord[2][k];
+
+    localPointCoordinates[0][iPoint] = x;
+    if (geometryType == SYNTHETIC_MESH_GEOM::ANNULUS) {
+      /* y is the radius and z the angle, the mapping preserves the orientation of the elements. */
+      localPointCoordinates[1][iPoint] = y * cos(z * deg2rad);
+      localPointCoordinates[2][iPoint] = y * sin(z * deg2rad);
+    } else {
+      localPointCoordinates[1][iPoint] = y;
+      localPointCoordinates[2][iPoint] = z;
+    }
+  }
+}
+
+void CSyntheticMeshReaderFVM::ComputeVolumeConnectivity() {
+  const unsigned long elementsPerPlane = elementsBeforeRow.back();
+  numberOfGlobalElements = (nNode[2] - 1) * elementsPerPlane;
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  const auto firstIndex = pointPartitioner.GetCumulativeSizeBeforeRank(rank);
+  const auto lastIndex = firstIndex + pointPartitioner.GetSizeOnRank(rank);
+
+  /* A cell can only have points in our partition if its first point is at most one (i,j,k) step before it. */
+  const auto reach = PointIndex(1, 1, 1);
+  const auto firstCell = firstIndex > reach ? firstIndex - reach : 0ul;
+
+  numberOfLocalElements = 0;
+  unsigned long connectivity[N_POINTS_HEXAHEDRON] = {0};
+
+  for (auto cellIndex = firstCell; cellIndex < lastIndex; cellIndex++) {
+    const auto i = cellIndex % nNode[0];
+    const auto j = (cellIndex / nNode[0]) % nNode[1];
+    const auto k = cellIndex / (nNode[0] * nNode[1]);
+    if (i + 1 >= nNode[0] || j + 1 >= nNode[1] || k + 1 >= nNode[2]) continue;
+
+    const auto& elements = CellElements(j);
+    const auto firstElement = k * elementsPerPlane + elementsBeforeRow[j] + i * elements.size();
+
+    for (auto iElem = 0ul; iElem < elements.size(); iElem++) {
+      const auto& element = elements[iElem];
+
+      /* Store the element if any of its points is in our linear partition. */
+      bool isOwned = false;
+      for (unsigned short iNode = 0; iNode < element.nNodes; iNode++) {
+        const auto& offset = element.offsets[iNode];
+        connectivity[iNode] = PointIndex(i + offset[0], j + offset[1], k + offset[2]);
+        isOwned |= (connectivity[iNode] >= firstIndex && connectivity[iNode] < lastIndex);
+      }
+      if (!isOwned) continue;
+
+      localVolumeElementConnectivity.push_back(firstElement + iElem);
+      localVolumeElementConnectivity.push_back(element.vtkType);
+      for (unsigned short iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++) {
+        localVolumeElementConnectivity.push_back(iNode < element.nNodes ? connectivity[iNode] : 0);
+      }
+      numberOfLocalElements++;
+    }
+  }
+}
+
+void CSyntheticMeshReaderFVM::ComputeSurfaceConnectivity() {
+  /* The six sides, in the order of the box grid. */
+  numberOfMarkers = 6;
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames = {"x_minus", "x_plus", "y_minus", "y_plus", "z_minus", "z_plus"};
+
+  if (rank != MASTER_NODE) return;
+
+  for (int iDir = 0; iDir < 3; iDir++) {
+    /* The other two directions, such that (iDir, uDir, vDir) is right-handed. */
+    const int uDir = (iDir + 1) % 3, vDir = (iDir + 2) % 3;
+
+    for (unsigned short side = 0; side < 2; side++) {
+      auto& faces = surfaceElementConnectivity[2 * iDir + side];
+      const unsigned long cellOnSide = side ? nNode[iDir] - 2 : 0;
+
+      for (unsigned long v = 0; v + 1 < nNode[vDir]; v++) {
+        for (unsigned long u = 0; u + 1 < nNode[uDir]; u++) {
+          unsigned long cell[3];
+          cell[iDir] = cellOnSide;
+          cell[uDir] = u;
+          cell[vDir] = v;
+
+          /* The faces of the elements of the cell are the groups of 3 or 4 nodes on the side. */
+          for (const auto& element : CellElements(cell[1])) {
+            unsigned short nodes[4], nFaceNodes = 0;
+            for (unsigned short iNode = 0; iNode < element.nNodes; iNode++) {
+              if (element.offsets[iNode][iDir] == side) nodes[nFaceNodes++] = iNode;
+            }
+            if (nFaceNodes < 3) continue;
+
+            /* Counter-clockwise in (u,v) gives a normal in +iDir, which is outward for the plus side. */
+            auto angle = [&](unsigned short iNode) {
+              return atan2(element.offsets[iNode][vDir] - 0.5, element.offsets[iNode][uDir] - 0.5);
+            };
+            std::sort(nodes, nodes + nFaceNodes,
+                      [&](unsigned short a, unsigned short b) { return angle(a) < angle(b); });
+            if (side == 0) std::reverse(nodes, nodes + nFaceNodes);
+
+            faces.push_back(0);
+            faces.push_back(nFaceNodes == 3 ? TRIANGLE : QUADRILATERAL);
+            for (unsigned short iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++) {
+              unsigned long index = 0;
+              if (iNode < nFaceNodes) {
+                const auto& offset = element.offsets[nodes[iNode]];
+                index = PointIndex(cell[0] + offset[0], cell[1] + offset[1], cell[2] + offset[2]);
+              }
+              faces.push_back(index);
+            }
+          }
+        }
+      }
+    }
+  }
+}
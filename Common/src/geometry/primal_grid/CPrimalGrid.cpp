@@ -28,11 +28,17 @@
 #include "../../../include/geometry/primal_grid/CPrimalGrid.hpp"
 
 CPrimalGrid::CPrimalGrid(bool FEM, unsigned short nNodes, unsigned short nNeighbor_Elements)
-    : Nodes(new unsigned long[nNodes]), Neighbor_Elements(new long[nNeighbor_Elements]), FEM(FEM) {
-  GlobalIndex_DomainElement = 0;
+    : CPrimalGrid(FEM, nullptr, nullptr) {
+  NodesFEM.reset(new unsigned long[nNodes]);
+  Neighbor_ElementsFEM.reset(new long[nNeighbor_Elements]);
+  Nodes = NodesFEM.get();
+  Neighbor_Elements = Neighbor_ElementsFEM.get();
   for (unsigned short i = 0; i < nNeighbor_Elements; i++) Neighbor_Elements[i] = -1;
 }
 
+CPrimalGrid::CPrimalGrid(bool FEM, unsigned long* nodes, long* neighbor_Elements)
+    : GlobalIndex_DomainElement(0), Nodes(nodes), Neighbor_Elements(neighbor_Elements), FEM(FEM) {}
+
 void CPrimalGrid::InitializeNeighbors(unsigned short val_nFaces) {
   /*--- Initialize arrays to -1/false to indicate that no neighbor is present and
         that no periodic transformation is needed to the neighbor. ---*/
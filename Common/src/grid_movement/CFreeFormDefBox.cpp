@@ -815,75 +815,128 @@ su2double* CFreeFormDefBox::EvalCartesianCoord(su2double* ParamCoord) const {
 
   for (iDim = 0; iDim < nDim; iDim++) cart_coord[iDim] = 0.0;
 
-  for (iDegree = 0; iDegree <= lDegree; iDegree++)
-    for (jDegree = 0; jDegree <= mDegree; jDegree++)
-      for (kDegree = 0; kDegree <= nDegree; kDegree++)
+  EvalUnivariateBases(ParamCoord, 0);
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++) {
+    const su2double basis_i = BasisValues[0][iDegree];
+    if (basis_i == 0.0) continue;
+
+    for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double basis_ij = basis_i * BasisValues[1][jDegree];
+      if (basis_ij == 0.0) continue;
+
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double basis_ijk = basis_ij * BasisValues[2][kDegree];
+        if (basis_ijk == 0.0) continue;
+
         for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] *
-                              BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]) *
-                              BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]) *
-                              BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] * basis_ijk;
         }
+      }
+    }
+  }
 
   return cart_coord;
 }
 
-su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
-  unsigned short iDim, jDim, lmn[3];
+void CFreeFormDefBox::EvalUnivariateBases(const su2double* uvw, unsigned short nDerivatives) const {
+  const unsigned short lmn[] = {lDegree, mDegree, nDegree};
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    BasisValues[iDim].resize(lmn[iDim] + 1);
+    for (unsigned short iDegree = 0; iDegree <= lmn[iDim]; iDegree++)
+      BasisValues[iDim][iDegree] = BlendingFunction[iDim]->GetBasis(iDegree, uvw[iDim]);
+
+    for (unsigned short iDer = 0; iDer < nDerivatives; iDer++) {
+      BasisDerivatives[iDer][iDim].resize(lmn[iDim] + 1);
+      for (unsigned short iDegree = 0; iDegree <= lmn[iDim]; iDegree++)
+        BasisDerivatives[iDer][iDim][iDegree] = BlendingFunction[iDim]->GetDerivative(iDegree, uvw[iDim], iDer + 1);
+    }
+  }
+}
+
+void CFreeFormDefBox::EvalParametricJacobian(const su2double* ParamCoord, su2double val_Jacobian[][3]) const {
+  EvalUnivariateBases(ParamCoord, 1);
 
-  /*--- Set the Degree of the spline ---*/
+  for (unsigned short iDim = 0; iDim < 3; iDim++)
+    for (unsigned short jDim = 0; jDim < 3; jDim++) val_Jacobian[iDim][jDim] = 0.0;
 
-  lmn[0] = lDegree;
-  lmn[1] = mDegree;
-  lmn[2] = nDegree;
+  for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++) {
+    const su2double Ba = BasisValues[0][iDegree], Ba_der = BasisDerivatives[0][0][iDegree];
 
-  for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
+    for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double Bb = BasisValues[1][jDegree], Bb_der = BasisDerivatives[0][1][jDegree];
+      const su2double Bab = Ba * Bb, Ba_der_b = Ba_der * Bb, Ba_b_der = Ba * Bb_der;
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz, lmn) * GetDerivative3(val_coord, iDim, jDim, lmn);
+      for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double Bc = BasisValues[2][kDegree], Bc_der = BasisDerivatives[0][2][kDegree];
+        const su2double dBasis[] = {Ba_der_b * Bc, Ba_b_der * Bc, Bab * Bc_der};
+        const su2double* P = Coord_Control_Points[iDegree][jDegree][kDegree];
 
-  return Gradient;
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          for (unsigned short jDim = 0; jDim < 3; jDim++) val_Jacobian[iDim][jDim] += P[iDim] * dBasis[jDim];
+      }
+    }
+  }
 }
 
-void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian) {
-  unsigned short iDim, jDim, lmn[3];
+void CFreeFormDefBox::GetFFDGradientHessian(const su2double* uvw, const su2double* xyz, su2double* val_Gradient,
+                                            su2double** val_Hessian) const {
+  EvalUnivariateBases(uvw, 2);
 
-  /*--- Set the Degree of the spline ---*/
+  /*--- X(u, v, w), its first derivatives dX/du_i, and second derivatives d2X/du_i du_j (upper part). ---*/
 
-  lmn[0] = lDegree;
-  lmn[1] = mDegree;
-  lmn[2] = nDegree;
+  su2double X[3] = {}, dX[3][3] = {}, d2X[3][3][3] = {};
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++) val_Hessian[iDim][jDim] = 0.0;
+  for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++) {
+    const su2double B0[] = {BasisValues[0][iDegree], BasisDerivatives[0][0][iDegree], BasisDerivatives[1][0][iDegree]};
 
-  /*--- Note that being all the functions linear combinations of polynomials, they are C^\infty,
-   and the Hessian will be symmetric; no need to compute the under-diagonal part, for example ---*/
+    for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double B1[] = {BasisValues[1][jDegree], BasisDerivatives[0][1][jDegree],
+                              BasisDerivatives[1][1][jDegree]};
 
-  for (iDim = 0; iDim < nDim; iDim++) {
-    val_Hessian[0][0] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 0, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 0, lmn);
+      for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double B2[] = {BasisValues[2][kDegree], BasisDerivatives[0][2][kDegree],
+                                BasisDerivatives[1][2][kDegree]};
 
-    val_Hessian[1][1] += 2.0 * GetDerivative3(uvw, iDim, 1, lmn) * GetDerivative3(uvw, iDim, 1, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 1, 1, lmn);
+        /*--- Tensor product basis and its derivatives, the index is the order of differentiation. ---*/
+        const su2double basis = B0[0] * B1[0] * B2[0];
+        const su2double dBasis[] = {B0[1] * B1[0] * B2[0], B0[0] * B1[1] * B2[0], B0[0] * B1[0] * B2[1]};
+        const su2double d2Basis[3][3] = {{B0[2] * B1[0] * B2[0], B0[1] * B1[1] * B2[0], B0[1] * B1[0] * B2[1]},
+                                         {0.0, B0[0] * B1[2] * B2[0], B0[0] * B1[1] * B2[1]},
+                                         {0.0, 0.0, B0[0] * B1[0] * B2[2]}};
 
-    val_Hessian[2][2] += 2.0 * GetDerivative3(uvw, iDim, 2, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 2, 2, lmn);
+        const su2double* P = Coord_Control_Points[iDegree][jDegree][kDegree];
 
-    val_Hessian[0][1] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 1, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 1, lmn);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          X[iDim] += P[iDim] * basis;
+          for (unsigned short i = 0; i < 3; i++) {
+            dX[iDim][i] += P[iDim] * dBasis[i];
+            for (unsigned short j = i; j < 3; j++) d2X[iDim][i][j] += P[iDim] * d2Basis[i][j];
+          }
+        }
+      }
+    }
+  }
 
-    val_Hessian[0][2] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 2, lmn);
+  /*--- Gradient 2 (X-xyz).dX/du_i and Hessian 2 (dX/du_i.dX/du_j + (X-xyz).d2X/du_i du_j). ---*/
 
-    val_Hessian[1][2] += 2.0 * GetDerivative3(uvw, iDim, 1, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 1, 2, lmn);
+  for (unsigned short i = 0; i < nDim; i++) {
+    val_Gradient[i] = 0.0;
+    for (unsigned short j = 0; j < nDim; j++) val_Hessian[i][j] = 0.0;
   }
 
-  val_Hessian[1][0] = val_Hessian[0][1];
-  val_Hessian[2][0] = val_Hessian[0][2];
-  val_Hessian[2][1] = val_Hessian[1][2];
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    const su2double diff = 2.0 * (X[iDim] - xyz[iDim]);
+    for (unsigned short i = 0; i < nDim; i++) {
+      val_Gradient[i] += diff * dX[iDim][i];
+      for (unsigned short j = i; j < nDim; j++) {
+        val_Hessian[i][j] += 2.0 * dX[iDim][i] * dX[iDim][j] + diff * d2X[iDim][i][j];
+      }
+    }
+  }
+  for (unsigned short i = 0; i < nDim; i++)
+    for (unsigned short j = 0; j < i; j++) val_Hessian[i][j] = val_Hessian[j][i];
 }
 
 su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz,
@@ -913,16 +966,13 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   /*--- External iteration ---*/
 
   for (iter = 0; iter < (unsigned long)it_max * Random_Trials; iter++) {
-    /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
+    /*--- The independent term of the solution of our system is -Gradient(sol_old),
+     and the matrix of our system is Hessian(sol_old), both are computed together. ---*/
 
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    GetFFDGradientHessian(ParamCoord, xyz, Gradient, Hessian);
 
     for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = -Gradient[iDim];
 
-    /*--- Hessian = The Matrix of our system, getHessian(sol_old,xyz,...) ---*/
-
-    GetFFDHessian(ParamCoord, xyz, Hessian);
-
     /*--- Adjoint to Hessian ---*/
 
     AdjHessian[0][0] = Hessian[1][1] * Hessian[2][2] - Hessian[1][2] * Hessian[2][1];
@@ -1055,95 +1105,3 @@ bool CFreeFormDefBox::CheckPointInsideFFD(const su2double* coord) const {
   return true;
 }
 
-su2double CFreeFormDefBox::GetDerivative1(su2double* uvw, unsigned short val_diff, unsigned short* ijk,
-                                          unsigned short* lmn) const {
-  unsigned short iDim;
-  su2double value = 0.0;
-
-  value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 1);
-  for (iDim = 0; iDim < nDim; iDim++)
-    if (iDim != val_diff) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative2(su2double* uvw, unsigned short dim, const su2double* xyz,
-                                          const unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree;
-  su2double value = 0.0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] * BlendingFunction[0]->GetBasis(iDegree, uvw[0]) *
-                 BlendingFunction[1]->GetBasis(jDegree, uvw[1]) * BlendingFunction[2]->GetBasis(kDegree, uvw[2]);
-      }
-
-  return 2.0 * (value - xyz[dim]);
-}
-
-su2double CFreeFormDefBox::GetDerivative3(su2double* uvw, unsigned short dim, unsigned short diff_this,
-                                          unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree, iDim;
-  su2double value = 0;
-
-  auto* ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        ijk[0] = iDegree;
-        ijk[1] = jDegree;
-        ijk[2] = kDegree;
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] * GetDerivative1(uvw, diff_this, ijk, lmn);
-      }
-
-  delete[] ijk;
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative4(su2double* uvw, unsigned short val_diff, unsigned short val_diff2,
-                                          unsigned short* ijk, unsigned short* lmn) const {
-  unsigned short iDim;
-  su2double value = 0.0;
-
-  if (val_diff == val_diff2) {
-    value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 2);
-    for (iDim = 0; iDim < nDim; iDim++)
-      if (iDim != val_diff) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-  } else {
-    value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 1) *
-            BlendingFunction[val_diff2]->GetDerivative(ijk[val_diff2], uvw[val_diff2], 1);
-    for (iDim = 0; iDim < nDim; iDim++)
-      if ((iDim != val_diff) && (iDim != val_diff2)) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-  }
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative5(su2double* uvw, unsigned short dim, unsigned short diff_this,
-                                          unsigned short diff_this_also, unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree, iDim;
-  su2double value = 0.0;
-
-  auto* ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        ijk[0] = iDegree;
-        ijk[1] = jDegree;
-        ijk[2] = kDegree;
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] *
-                 GetDerivative4(uvw, diff_this, diff_this_also, ijk, lmn);
-      }
-
-  delete[] ijk;
-
-  return value;
-}
@@ -5004,36 +5004,18 @@ unsigned long CSurfaceMovement::calculateJacobianDeterminant(CGeometry* geometry
     if (config->GetMarker_All_DV(iMarker) == YES) {
       const auto ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
 
-      /*--- Calculate partial derivatives ---*/
-      unsigned short iDegree, jDegree, kDegree;
-      su2double Ba, Bb, Bc, Ba_der, Bb_der, Bc_der;
-      su2double determinant, d_du[3] = {0.0}, d_dv[3] = {0.0}, d_dw[3] = {0.0};
-
-      for (iDegree = 0; iDegree <= FFDBox->lDegree; iDegree++) {
-        Ba = FFDBox->BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
-        Ba_der = FFDBox->BlendingFunction[0]->GetDerivative(iDegree, ParamCoord[0], 1);
-
-        for (jDegree = 0; jDegree <= FFDBox->mDegree; jDegree++) {
-          Bb = FFDBox->BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
-          Bb_der = FFDBox->BlendingFunction[1]->GetDerivative(jDegree, ParamCoord[1], 1);
-
-          for (kDegree = 0; kDegree <= FFDBox->nDegree; kDegree++) {
-            Bc = FFDBox->BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
-            Bc_der = FFDBox->BlendingFunction[2]->GetDerivative(kDegree, ParamCoord[2], 1);
-
-            for (int i = 0; i < 3; ++i) {
-              d_du[i] += Ba_der * Bb * Bc * FFDBox->Coord_Control_Points[iDegree][jDegree][kDegree][i];
-              d_dv[i] += Ba * Bb_der * Bc * FFDBox->Coord_Control_Points[iDegree][jDegree][kDegree][i];
-              d_dw[i] += Ba * Bb * Bc_der * FFDBox->Coord_Control_Points[iDegree][jDegree][kDegree][i];
-            }
-          }
-        }
-      }
+      /*--- Calculate partial derivatives, column j of the Jacobian is d/du_j ---*/
+      su2double jac[3][3];
+      FFDBox->EvalParametricJacobian(ParamCoord, jac);
+
+      const su2double d_du[] = {jac[0][0], jac[1][0], jac[2][0]};
+      const su2double d_dv[] = {jac[0][1], jac[1][1], jac[2][1]};
+      const su2double d_dw[] = {jac[0][2], jac[1][2], jac[2][2]};
 
       /*--- Calculate determinant ---*/
-      determinant = d_du[0] * (d_dv[1] * d_dw[2] - d_dv[2] * d_dw[1]) -
-                    d_dv[0] * (d_du[1] * d_dw[2] - d_du[2] * d_dw[1]) +
-                    d_dw[0] * (d_du[1] * d_dv[2] - d_du[2] * d_dv[1]);
+      const su2double determinant = d_du[0] * (d_dv[1] * d_dw[2] - d_dv[2] * d_dw[1]) -
+                                    d_dv[0] * (d_du[1] * d_dw[2] - d_du[2] * d_dw[1]) +
+                                    d_dw[0] * (d_du[1] * d_dv[2] - d_du[2] * d_dv[1]);
 
       if (determinant < 0) {
         negative_determinants++;
@@ -27,7 +27,10 @@
 
 #include "../../include/grid_movement/CVolumetricMovement.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
+#include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
+#include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/geometry/elements/element_kernels.hpp"
 
 CVolumetricMovement::CVolumetricMovement() : CGridMovement(), System(LINEAR_SOLVER_MODE::MESH_DEFORM) {}
 
@@ -50,7 +53,9 @@ CVolumetricMovement::CVolumetricMovement(CGeometry* geometry, CConfig* config)
   if (config->GetVolumetric_Movement() || config->GetSmoothGradient()) {
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+    /*--- The RBF method does not need the stiffness matrix, but the gradient smoothing does. ---*/
+    if (config->GetDeform_Method() != DEFORM_METHOD::RBF || config->GetSmoothGradient())
+      StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
   }
 }
 
@@ -89,6 +94,20 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry* geometry, CConfig* config) {
   geometry->SetMaxLength(config);
 }
 
+void CVolumetricMovement::UpdateDualGrid_Rigid(CGeometry* geometry, CConfig* config,
+                                               const su2double rotMatrix[][3]) {
+  /*--- The transformed metrics would not depend on the coordinates, which the discrete adjoint needs. ---*/
+
+  if (!config->GetRigidMotion_TransformMetrics() || config->GetDiscrete_Adjoint()) {
+    UpdateDualGrid(geometry, config);
+    return;
+  }
+
+  /*--- Volumes and lengths are invariant, translations do not change the normals either. ---*/
+
+  if (rotMatrix != nullptr) geometry->RotateDualGrid(rotMatrix);
+}
+
 void CVolumetricMovement::UpdateMultiGrid(CGeometry** geometry, CConfig* config) {
   unsigned short iMGfine, iMGlevel, nMGlevel = config->GetnMGLevels();
 
@@ -123,22 +142,46 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- The RBF method interpolates the full displacements at once (no increments). ---*/
+
+  if (config->GetDeform_Method() == DEFORM_METHOD::RBF) {
+    if (Derivative) {
+      SU2_MPI::Error("The derivatives of the mesh deformation are not available with DEFORM_METHOD= RBF.",
+                     CURRENT_FUNCTION);
+    }
+    SetVolume_Deformation_RBF(geometry, config, UpdateGeo, Screen_Output);
+    return;
+  }
+
+  /*--- The stiffness matrix may be reused, and the solution warm started, only for the deformation
+   * itself, and not when recording or differentiating (the matrix would not depend on the coordinates). ---*/
+
+  const bool Reuse = !Derivative && !AD::TapeActive() && (config->GetDirectDiff() == NO_DERIVATIVE);
+  const bool WarmStart = Reuse && (config->GetDeform_Warm_Start() > 0);
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
    particular, the linear elasticity equations hold only for small deformations. ---*/
 
   for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
-    /*--- Initialize vector and sparse matrix ---*/
+    /*--- Initialize vectors ---*/
 
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
 
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
-
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+     elasticity equations (transfers element stiffnesses to point-to-point).
+     If allowed, the matrix of a previous increment or call is reused, the
+     boundary conditions below then do not modify it (rows are already deleted). ---*/
+
+    MinVolume = 0.0;
+    if (!Reuse || StiffMatrixAge == 0 || StiffMatrixAge > config->GetDeform_Stiffness_Reuse()) {
+      StiffMatrix.SetValZero();
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+      StiffMatrixAge = 0;
+      System.ResetPreconditioner();
+    }
 
     /*--- Set the boundary and volume displacements (as prescribed by the
      design variable perturbations controlling the surface shape)
@@ -171,6 +214,10 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
     /*--- To keep legacy behavior ---*/
     System.SetToleranceType(LinearToleranceType::RELATIVE);
 
+    /*--- Predict the initial guess from previous deformations, keeping the tolerance of a cold start. ---*/
+
+    System.SetToleranceReferenceNorm(WarmStart ? SU2_TYPE::GetValue(SetWarmStart(geometry, config)) : 0.0);
+
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
      * the discrete adjoint method we solve the system using the transposed matrix. ---*/
@@ -183,6 +230,9 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
     }
     su2double Residual = System.GetResidual();
 
+    StiffMatrixAge = Reuse ? StiffMatrixAge + 1 : 0;
+    if (WarmStart) StoreWarmStart(config);
+
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
 
@@ -220,6 +270,314 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
   }
 }
 
+void CVolumetricMovement::SetVolume_Deformation_RBF(CGeometry* geometry, CConfig* config, bool UpdateGeo,
+                                                    bool Screen_Output) {
+  const auto kindRBF = config->GetDeform_RBF_Function();
+  if (kindRBF != RADIAL_BASIS::WENDLAND_C2 && kindRBF != RADIAL_BASIS::GAUSSIAN &&
+      kindRBF != RADIAL_BASIS::INV_MULTI_QUADRIC) {
+    SU2_MPI::Error("DEFORM_RBF_FUNCTION must be positive definite (WENDLAND_C2, GAUSSIAN, INV_MULTI_QUADRIC).",
+                   CURRENT_FUNCTION);
+  }
+  const auto Kind_SU2 = config->GetKind_SU2();
+  const auto MaxPoints = max<unsigned long>(1, config->GetDeform_RBF_Max_Points());
+
+  /*--- Prescribe the displacements (in LinSysSol) of the same boundaries as SetBoundaryDisplacements,
+   moving surfaces get their displacements, the other boundaries are fixed, except symmetry planes
+   which are treated after the interpolation. As with the elasticity solve, the values are passive. ---*/
+
+  LinSysSol.SetValZero();
+  vector<bool> Prescribed(nPoint, false);
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    const auto KindBC = config->GetMarker_All_KindBC(iMarker);
+    if ((KindBC == SYMMETRY_PLANE) || (KindBC == SEND_RECEIVE) || (KindBC == INTERNAL_BOUNDARY)) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++)
+      Prescribed[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+  }
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    const bool DV = (config->GetMarker_All_DV(iMarker) == YES);
+    const bool Moving =
+        ((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) ||
+        (DV && (Kind_SU2 == SU2_COMPONENT::SU2_DEF)) || (DV && (Kind_SU2 == SU2_COMPONENT::SU2_DOT)) ||
+        (DV && (config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD)) ||
+        ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_COMPONENT::SU2_CFD));
+    if (!Moving) continue;
+
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const su2double* VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      Prescribed[iPoint] = true;
+      for (auto iDim = 0u; iDim < nDim; iDim++) LinSysSol(iPoint, iDim) = SU2_TYPE::GetValue(VarCoord[iDim]);
+    }
+  }
+
+  /*--- Local (owned) points with prescribed displacements, their coordinates, displacements, and the
+   current interpolation error. Also the max displacement and the bounding box for the default radius. ---*/
+
+  vector<unsigned long> BoundPoint;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+    if (Prescribed[iPoint]) BoundPoint.push_back(iPoint);
+  const auto nBound = BoundPoint.size();
+
+  su2passivematrix BoundCoord(nBound, nDim), BoundDisp(nBound, nDim);
+  vector<passivedouble> BoundError(nBound);
+
+  passivedouble MaxDisp = 0.0, BoxMin[3] = {0.0}, BoxMax[3] = {0.0};
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    BoxMin[iDim] = numeric_limits<passivedouble>::max();
+    BoxMax[iDim] = -numeric_limits<passivedouble>::max();
+  }
+  for (auto iBound = 0ul; iBound < nBound; iBound++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      BoundCoord(iBound, iDim) = SU2_TYPE::GetValue(geometry->nodes->GetCoord(BoundPoint[iBound], iDim));
+      BoundDisp(iBound, iDim) = SU2_TYPE::GetValue(LinSysSol(BoundPoint[iBound], iDim));
+      BoxMin[iDim] = min(BoxMin[iDim], BoundCoord(iBound, iDim));
+      BoxMax[iDim] = max(BoxMax[iDim], BoundCoord(iBound, iDim));
+    }
+    BoundError[iBound] = GeometryToolbox::Norm(nDim, BoundDisp[iBound]);
+    MaxDisp = max(MaxDisp, BoundError[iBound]);
+  }
+
+  using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+  passivedouble Local[7] = {MaxDisp}, Global[7] = {0.0};
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    Local[1 + iDim] = BoxMax[iDim];
+    Local[4 + iDim] = -BoxMin[iDim];
+  }
+  MPIWrapper::Allreduce(Local, Global, 7, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MaxDisp = Global[0];
+
+  /*--- Nothing moves. ---*/
+
+  if (MaxDisp == 0.0) {
+    Set_nIterMesh(0);
+    return;
+  }
+
+  passivedouble Radius = SU2_TYPE::GetValue(config->GetDeform_RBF_Radius());
+  if (Radius <= 0.0) {
+    Radius = 0.0;
+    for (auto iDim = 0u; iDim < nDim; iDim++) Radius += pow(Global[1 + iDim] + Global[4 + iDim], 2);
+    Radius = sqrt(Radius);
+  }
+  const passivedouble Tolerance = SU2_TYPE::GetValue(config->GetDeform_RBF_Tolerance()) * MaxDisp;
+
+  /*--- RBF interpolation of the displacements with the current centers. ---*/
+
+  su2passivematrix CtrlCoord, CtrlDisp, Coeff;
+  unsigned long nCtrl = 0;
+
+  auto Interpolate = [&](const passivedouble* Coord, passivedouble* Disp) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) Disp[iDim] = 0.0;
+    for (auto iCtrl = 0ul; iCtrl < nCtrl; iCtrl++) {
+      const auto Dist = GeometryToolbox::Distance(nDim, Coord, CtrlCoord[iCtrl]);
+      if ((kindRBF == RADIAL_BASIS::WENDLAND_C2) && (Dist >= Radius)) continue;
+      const passivedouble Phi =
+          SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(kindRBF, Radius, Dist));
+      for (auto iDim = 0u; iDim < nDim; iDim++) Disp[iDim] += Coeff(iCtrl, iDim) * Phi;
+    }
+  };
+
+  /*--- Greedy selection of the centers, each iteration the points with the largest error are added
+   (at most 25% of the current number to limit the number of factorizations), then the coefficients
+   are recomputed and the error is evaluated. The candidates of each rank are gathered by all ranks,
+   which then select and solve the same (small) dense system. ---*/
+
+  const auto nValues = 1 + 2 * nDim;
+  unsigned long nAdd = 1, iGreedy = 0;
+  passivedouble MaxError = MaxDisp;
+
+  while (true) {
+    /*--- Local candidates: the nAdd largest errors (above the tolerance). ---*/
+
+    vector<unsigned long> Order(nBound);
+    iota(Order.begin(), Order.end(), 0ul);
+    const auto nLocal = min<unsigned long>(nAdd, nBound);
+    partial_sort(Order.begin(), Order.begin() + nLocal, Order.end(),
+                 [&](unsigned long a, unsigned long b) { return BoundError[a] > BoundError[b]; });
+
+    vector<passivedouble> SendBuf(nAdd * nValues, -1.0), RecvBuf(size * nAdd * nValues);
+    for (auto iCand = 0ul; iCand < nLocal; iCand++) {
+      const auto iBound = Order[iCand];
+      auto* Buf = &SendBuf[iCand * nValues];
+      Buf[0] = BoundError[iBound];
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        Buf[1 + iDim] = BoundCoord(iBound, iDim);
+        Buf[1 + nDim + iDim] = BoundDisp(iBound, iDim);
+      }
+    }
+    MPIWrapper::Allgather(SendBuf.data(), nAdd * nValues, MPI_DOUBLE, RecvBuf.data(), nAdd * nValues, MPI_DOUBLE,
+                          SU2_MPI::GetComm());
+
+    /*--- Global candidates, the ranks sort the same data, ties are broken by position for consistency. ---*/
+
+    vector<unsigned long> Cand(size * nAdd);
+    iota(Cand.begin(), Cand.end(), 0ul);
+    stable_sort(Cand.begin(), Cand.end(),
+                [&](unsigned long a, unsigned long b) { return RecvBuf[a * nValues] > RecvBuf[b * nValues]; });
+
+    su2passivematrix OldCoord = CtrlCoord, OldDisp = CtrlDisp;
+    const auto nOld = nCtrl;
+    nCtrl = nOld;
+    for (auto iCand = 0ul; iCand < nAdd; iCand++) {
+      if (RecvBuf[Cand[iCand] * nValues] <= Tolerance) break;
+      ++nCtrl;
+    }
+    CtrlCoord.resize(nCtrl, nDim);
+    CtrlDisp.resize(nCtrl, nDim);
+    for (auto iCtrl = 0ul; iCtrl < nOld; iCtrl++) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        CtrlCoord(iCtrl, iDim) = OldCoord(iCtrl, iDim);
+        CtrlDisp(iCtrl, iDim) = OldDisp(iCtrl, iDim);
+      }
+    }
+    for (auto iCtrl = nOld; iCtrl < nCtrl; iCtrl++) {
+      const auto* Buf = &RecvBuf[Cand[iCtrl - nOld] * nValues];
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        CtrlCoord(iCtrl, iDim) = Buf[1 + iDim];
+        CtrlDisp(iCtrl, iDim) = Buf[1 + nDim + iDim];
+      }
+    }
+
+    /*--- Coefficients of the interpolation, C * Coeff = CtrlDisp, the kernels are positive definite. ---*/
+
+    CSymmetricMatrix C(nCtrl);
+    for (auto iCtrl = 0ul; iCtrl < nCtrl; iCtrl++) {
+      for (auto jCtrl = iCtrl; jCtrl < nCtrl; jCtrl++) {
+        const auto Dist = GeometryToolbox::Distance(nDim, CtrlCoord[iCtrl], CtrlCoord[jCtrl]);
+        C(iCtrl, jCtrl) = SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(kindRBF, Radius, Dist));
+      }
+    }
+    C.Invert(true);
+    C.MatMatMult('L', CtrlDisp, Coeff);
+
+    /*--- Interpolation error at the local points. ---*/
+
+    passivedouble LocalMaxError = 0.0;
+    SU2_OMP_PARALLEL_(for schedule(dynamic, 256) reduction(max : LocalMaxError))
+    for (auto iBound = 0ul; iBound < nBound; iBound++) {
+      passivedouble Disp[3] = {0.0}, Error[3] = {0.0};
+      Interpolate(BoundCoord[iBound], Disp);
+      for (auto iDim = 0u; iDim < nDim; iDim++) Error[iDim] = BoundDisp(iBound, iDim) - Disp[iDim];
+      BoundError[iBound] = GeometryToolbox::Norm(nDim, Error);
+      LocalMaxError = max(LocalMaxError, BoundError[iBound]);
+    }
+    END_SU2_OMP_PARALLEL
+    MPIWrapper::Allreduce(&LocalMaxError, &MaxError, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+    ++iGreedy;
+    if ((MaxError <= Tolerance) || (nCtrl >= MaxPoints) || (nCtrl == nOld)) break;
+
+    nAdd = min(max<unsigned long>(1, nCtrl / 4), MaxPoints - nCtrl);
+  }
+
+  /*--- Evaluate the displacements of the free points, the prescribed ones are imposed exactly. ---*/
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic, 256))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (Prescribed[iPoint]) continue;
+    passivedouble Coord[3] = {0.0}, Disp[3] = {0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) Coord[iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+    Interpolate(Coord, Disp);
+    for (auto iDim = 0u; iDim < nDim; iDim++) LinSysSol(iPoint, iDim) = Disp[iDim];
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- The free points of symmetry planes cannot move in the normal direction. ---*/
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) continue;
+    const auto axis = GetSymmetryAxis(geometry, iMarker);
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!Prescribed[iPoint]) LinSysSol(iPoint, axis) = 0.0;
+    }
+  }
+
+  /*--- Update the grid coordinates and cell volumes, and check the deformation. ---*/
+
+  UpdateGridCoord(geometry, config);
+  if (UpdateGeo) UpdateDualGrid(geometry, config);
+
+  su2double MinVolume, MaxVolume;
+  ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
+  ComputenNonconvexElements(geometry, Screen_Output);
+
+  Set_nIterMesh(iGreedy);
+
+  if (rank == MASTER_NODE && Screen_Output) {
+    cout << "RBF deformation, centers: " << nCtrl << ", greedy iter.: " << iGreedy
+         << ". Max. error / max. displacement: " << MaxError / MaxDisp << ". ";
+    if (nDim == 2)
+      cout << "Min. area: " << MinVolume << "." << endl;
+    else
+      cout << "Min. volume: " << MinVolume << "." << endl;
+  }
+}
+
+su2double CVolumetricMovement::SetWarmStart(CGeometry* geometry, const CConfig* config) {
+  if (WarmStartRes.empty()) return 0.0;
+
+  /*--- Residual of the cold start (only the prescribed displacements), the linear tolerance refers to it. ---*/
+
+  CSysVector<StiffScalar> ColdSol, ColdRes;
+  ColdSol.PassiveCopy(LinSysSol);
+  ColdRes.PassiveCopy(LinSysRes);
+  StiffMatrix.ComputeResidual(ColdSol, ColdRes, ColdRes);
+  const su2double ColdNorm = ColdRes.norm();
+
+  /*--- Orthonormalize the previous r.h.s. (modified Gram-Schmidt), applying the same linear combinations
+   to their solutions, and drop those that are (almost) linearly dependent, e.g. repeated increments. ---*/
+
+  vector<CSysVector<su2double> > Basis, BasisSol;
+  Basis.reserve(WarmStartRes.size());
+  BasisSol.reserve(WarmStartRes.size());
+
+  for (auto iBasis = 0ul; iBasis < WarmStartRes.size(); iBasis++) {
+    Basis.push_back(WarmStartRes[iBasis]);
+    BasisSol.push_back(WarmStartSol[iBasis]);
+    auto& Res = Basis.back();
+    auto& Sol = BasisSol.back();
+
+    const su2double Norm0 = Res.norm();
+    for (auto jBasis = 0ul; jBasis + 1 < Basis.size(); jBasis++) {
+      const su2double Proj = Basis[jBasis].dot(Res);
+      Res -= Proj * Basis[jBasis];
+      Sol -= Proj * BasisSol[jBasis];
+    }
+    const su2double Norm = Res.norm();
+
+    if (Norm <= 1e-8 * Norm0) {
+      Basis.pop_back();
+      BasisSol.pop_back();
+      continue;
+    }
+    Res /= Norm;
+    Sol /= Norm;
+  }
+
+  /*--- The deformation is linear in the r.h.s., the projection of the current r.h.s. on the basis
+   gives the combination of previous solutions. These only add displacements to the free nodes,
+   LinSysSol already holds the prescribed ones (the r.h.s.). ---*/
+
+  for (auto iBasis = 0ul; iBasis < Basis.size(); iBasis++) {
+    LinSysSol += Basis[iBasis].dot(LinSysRes) * BasisSol[iBasis];
+  }
+
+  return ColdNorm;
+}
+
+void CVolumetricMovement::StoreWarmStart(const CConfig* config) {
+  if (WarmStartRes.size() >= config->GetDeform_Warm_Start()) {
+    WarmStartRes.erase(WarmStartRes.begin());
+    WarmStartSol.erase(WarmStartSol.begin());
+  }
+  WarmStartRes.push_back(LinSysRes);
+  WarmStartSol.push_back(LinSysSol);
+  WarmStartSol.back() -= LinSysRes;
+}
+
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, su2double& MinVolume,
                                                           su2double& MaxVolume, bool Screen_Output) {
   unsigned long iElem, ElemCounter = 0, PointCorners[8];
@@ -1395,6 +1753,42 @@ void CVolumetricMovement::SetFEA_StiffMatrix2D(CGeometry* geometry, CConfig* con
   }
 }
 
+namespace {
+/*!
+ * \brief Stiffness matrix of an isotropic element with the batched element kernels.
+ * \param[in] shapeFunc - Computes the gradients of the shape functions and the determinant at a point.
+ * \param[in] Location - Integration points.
+ * \param[in] Weight - Integration weights.
+ * \param[in] Lambda - First Lame parameter.
+ * \param[in] Mu - Shear modulus.
+ * \param[out] StiffMatrix_Elem - Stiffness matrix of the element.
+ */
+template <size_t NNODE, size_t NGAUSS, class ShapeFunc>
+void SetBatchedStiffMatrix3D(const ShapeFunc& shapeFunc, const su2double Location[][3], const su2double* Weight,
+                             su2double Lambda, su2double Mu, su2double** StiffMatrix_Elem) {
+  ElementKernels::GaussDouble<NGAUSS> gradN[NNODE][3], wJ;
+  su2double DShapeFunction[8][4] = {{0.0}};
+
+  for (size_t iGauss = 0; iGauss < NGAUSS; iGauss++) {
+    const su2double Det =
+        shapeFunc(Location[iGauss][0], Location[iGauss][1], Location[iGauss][2], DShapeFunction);
+    wJ[iGauss] = Weight[iGauss] * fabs(Det);
+    for (size_t iNode = 0; iNode < NNODE; iNode++)
+      for (size_t iDim = 0; iDim < 3; iDim++) gradN[iNode][iDim][iGauss] = DShapeFunction[iNode][iDim];
+  }
+
+  ElementKernels::IsotropicStiffness(gradN, wJ, Lambda, Mu,
+                                     [StiffMatrix_Elem](size_t iNode, size_t jNode, su2double Kab[3][3]) {
+                                       for (size_t iDim = 0; iDim < 3; iDim++) {
+                                         for (size_t jDim = 0; jDim < 3; jDim++) {
+                                           StiffMatrix_Elem[iNode * 3 + iDim][jNode * 3 + jDim] = Kab[iDim][jDim];
+                                           StiffMatrix_Elem[jNode * 3 + jDim][iNode * 3 + iDim] = Kab[iDim][jDim];
+                                         }
+                                       }
+                                     });
+}
+}  // namespace
+
 void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry* geometry, CConfig* config, su2double** StiffMatrix_Elem,
                                                unsigned long PointCorners[8], su2double CoordCorners[8][3],
                                                unsigned short nNodes, su2double ElemVolume, su2double ElemDistance) {
@@ -1523,6 +1917,41 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry* geometry, CConfig* con
     Weight[7] = 1.0;
   }
 
+  /*--- Impose a type of stiffness for each element ---*/
+
+  switch (config->GetDeform_Stiffness_Type()) {
+    case INVERSE_VOLUME:
+      E = 1.0 / ElemVolume;
+      break;
+    case SOLID_WALL_DISTANCE:
+      E = 1.0 / ElemDistance;
+      break;
+    case CONSTANT_STIFFNESS:
+      E = 1.0 / EPS;
+      break;
+  }
+
+  Nu = config->GetDeform_Coeff();
+  Mu = E / (2.0 * (1.0 + Nu));
+  Lambda = Nu * E / ((1.0 + Nu) * (1.0 - 2.0 * Nu));
+
+  /*--- Tetrahedra and hexahedra use the batched element kernels, which exploit the sparsity of B. ---*/
+
+  if (nNodes == 4) {
+    auto shapeFunc = [&](su2double xi, su2double eta, su2double zeta, su2double DShape[8][4]) {
+      return ShapeFunc_Tetra(xi, eta, zeta, CoordCorners, DShape);
+    };
+    SetBatchedStiffMatrix3D<4, 1>(shapeFunc, Location, Weight, Lambda, Mu, StiffMatrix_Elem);
+    return;
+  }
+  if (nNodes == 8) {
+    auto shapeFunc = [&](su2double xi, su2double eta, su2double zeta, su2double DShape[8][4]) {
+      return ShapeFunc_Hexa(xi, eta, zeta, CoordCorners, DShape);
+    };
+    SetBatchedStiffMatrix3D<8, 8>(shapeFunc, Location, Weight, Lambda, Mu, StiffMatrix_Elem);
+    return;
+  }
+
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
     Xi = Location[iGauss][0];
     Eta = Location[iGauss][1];
@@ -1553,24 +1982,6 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry* geometry, CConfig* con
       B_Matrix[5][2 + iNode * nVar] = DShapeFunction[iNode][0];
     }
 
-    /*--- Impose a type of stiffness for each element ---*/
-
-    switch (config->GetDeform_Stiffness_Type()) {
-      case INVERSE_VOLUME:
-        E = 1.0 / ElemVolume;
-        break;
-      case SOLID_WALL_DISTANCE:
-        E = 1.0 / ElemDistance;
-        break;
-      case CONSTANT_STIFFNESS:
-        E = 1.0 / EPS;
-        break;
-    }
-
-    Nu = config->GetDeform_Coeff();
-    Mu = E / (2.0 * (1.0 + Nu));
-    Lambda = Nu * E / ((1.0 + Nu) * (1.0 - 2.0 * Nu));
-
     /*--- Compute the D Matrix (for plane strain and 3-D)---*/
 
     D_Matrix[0][0] = Lambda + 2.0 * Mu;
@@ -1645,7 +2056,7 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig* config) {
   unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
   unsigned long iPoint, total_index, iVertex;
-  su2double *VarCoord, MeanCoord[3] = {0.0, 0.0, 0.0}, VarIncrement = 1.0;
+  su2double *VarCoord, VarIncrement = 1.0;
 
   /*--- Get the SU2 module. SU2_CFD will use this routine for dynamically
    deforming meshes (MARKER_MOVING), while SU2_DEF will use it for deforming
@@ -1704,30 +2115,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig*
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE)) {
-      su2double* Coord_0 = nullptr;
-
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
-
-      /*--- Store the coord of the first point to help identify the axis. ---*/
-
-      iPoint = geometry->vertex[iMarker][0]->GetNode();
-      Coord_0 = geometry->nodes->GetCoord(iPoint);
-
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        VarCoord = geometry->nodes->GetCoord(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          MeanCoord[iDim] += (VarCoord[iDim] - Coord_0[iDim]) * (VarCoord[iDim] - Coord_0[iDim]);
-      }
-      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
-      if (nDim == 3) {
-        if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
-        if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
-      } else {
-        if ((MeanCoord[0] <= MeanCoord[1])) axis = 0;
-        if ((MeanCoord[1] <= MeanCoord[0])) axis = 1;
-      }
+      axis = GetSymmetryAxis(geometry, iMarker);
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
@@ -1773,6 +2161,32 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig*
   }
 }
 
+unsigned short CVolumetricMovement::GetSymmetryAxis(CGeometry* geometry, unsigned short iMarker) const {
+  unsigned short iDim, axis = 0;
+  su2double MeanCoord[3] = {0.0, 0.0, 0.0};
+
+  if (geometry->nVertex[iMarker] == 0) return axis;
+
+  /*--- Store the coord of the first point to help identify the axis. ---*/
+
+  const su2double* Coord_0 = geometry->nodes->GetCoord(geometry->vertex[iMarker][0]->GetNode());
+
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+    const su2double* Coord = geometry->nodes->GetCoord(geometry->vertex[iMarker][iVertex]->GetNode());
+    for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] += (Coord[iDim] - Coord_0[iDim]) * (Coord[iDim] - Coord_0[iDim]);
+  }
+  for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+  if (nDim == 3) {
+    if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+    if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+  } else {
+    if ((MeanCoord[0] <= MeanCoord[1])) axis = 0;
+    if ((MeanCoord[1] <= MeanCoord[0])) axis = 1;
+  }
+  return axis;
+}
+
 void CVolumetricMovement::SetBoundaryDerivatives(CGeometry* geometry, CConfig* config,
                                                  bool ForwardProjectionDerivative) {
   unsigned short iDim, iMarker;
@@ -2063,7 +2477,7 @@ void CVolumetricMovement::Rigid_Rotation(CGeometry* geometry, CConfig* config, u
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  UpdateDualGrid_Rigid(geometry, config, rotMatrix);
 }
 
 void CVolumetricMovement::Rigid_Pitching(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2209,7 +2623,7 @@ void CVolumetricMovement::Rigid_Pitching(CGeometry* geometry, CConfig* config, u
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  UpdateDualGrid_Rigid(geometry, config, rotMatrix);
 }
 
 void CVolumetricMovement::Rigid_Plunging(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2337,7 +2751,7 @@ void CVolumetricMovement::Rigid_Plunging(CGeometry* geometry, CConfig* config, u
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  UpdateDualGrid_Rigid(geometry, config, nullptr);
 }
 
 void CVolumetricMovement::Rigid_Translation(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2447,7 +2861,7 @@ void CVolumetricMovement::Rigid_Translation(CGeometry* geometry, CConfig* config
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  UpdateDualGrid_Rigid(geometry, config, nullptr);
 }
 
 void CVolumetricMovement::SetVolume_Scaling(CGeometry* geometry, CConfig* config, bool UpdateGeo) {
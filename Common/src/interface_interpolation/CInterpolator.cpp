@@ -27,7 +27,9 @@
 
 #include "../../include/interface_interpolation/CInterpolator.hpp"
 
+#include <fstream>
 #include <set>
+#include <unordered_map>
 
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
@@ -152,6 +154,258 @@ unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short n
   return dstIdx;
 }
 
+namespace {
+/*!
+ * \brief Personalized all-to-all exchange of items (groups of nVal values) ordered by destination rank.
+ * \param[in] sendBuf - Items to send.
+ * \param[in] sendCount - Number of items for each rank.
+ * \param[in] nVal - Number of values per item.
+ * \param[in] type - MPI type of the values.
+ * \param[out] recvCount - Number of items received from each rank.
+ * \return The received items ordered by source rank.
+ */
+template <class T>
+vector<T> ExchangeItems(const vector<T>& sendBuf, const vector<int>& sendCount, int nVal, SU2_MPI::Datatype type,
+                        vector<int>& recvCount) {
+  const int size = sendCount.size();
+  recvCount.resize(size);
+  SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> sendNum(size), sendDispl(size, 0), recvNum(size), recvDispl(size, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendNum[iRank] = sendCount[iRank] * nVal;
+    recvNum[iRank] = recvCount[iRank] * nVal;
+    if (iRank == 0) continue;
+    sendDispl[iRank] = sendDispl[iRank - 1] + sendNum[iRank - 1];
+    recvDispl[iRank] = recvDispl[iRank - 1] + recvNum[iRank - 1];
+  }
+  vector<T> recvBuf(recvDispl.back() + recvNum.back());
+
+  SU2_MPI::Alltoallv(sendBuf.data(), sendNum.data(), sendDispl.data(), type, recvBuf.data(), recvNum.data(),
+                     recvDispl.data(), type, SU2_MPI::GetComm());
+  return recvBuf;
+}
+}  // namespace
+
+void CInterpolator::FindDonorOwners(int markDonor, const vector<unsigned long>& globalPoints,
+                                    vector<int>& owners) const {
+  /*--- The owner of global point "g" is registered on rank g % size. ---*/
+
+  vector<vector<unsigned long> > registry(size);
+  if (markDonor != -1) {
+    for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); ++iVertex) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+      const auto iPointGlobal = donor_geometry->nodes->GetGlobalIndex(iPoint);
+      registry[iPointGlobal % size].push_back(iPointGlobal);
+    }
+  }
+
+  auto flatten = [this](const vector<vector<unsigned long> >& lists, vector<int>& count) {
+    vector<unsigned long> flat;
+    count.resize(size);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      count[iRank] = lists[iRank].size();
+      flat.insert(flat.end(), lists[iRank].begin(), lists[iRank].end());
+    }
+    return flat;
+  };
+
+  vector<int> sendCount, recvCount;
+  const auto registered = ExchangeItems(flatten(registry, sendCount), sendCount, 1, MPI_UNSIGNED_LONG, recvCount);
+
+  unordered_map<unsigned long, int> directory;
+  for (int iRank = 0, iPos = 0; iRank < size; ++iRank)
+    for (int i = 0; i < recvCount[iRank]; ++i) directory[registered[iPos++]] = iRank;
+
+  /*--- Ask the directory for the owners of the points. ---*/
+
+  vector<vector<unsigned long> > query(size);
+  for (const auto iPointGlobal : globalPoints) query[iPointGlobal % size].push_back(iPointGlobal);
+
+  const auto queried = ExchangeItems(flatten(query, sendCount), sendCount, 1, MPI_UNSIGNED_LONG, recvCount);
+
+  vector<int> reply(queried.size());
+  for (auto i = 0ul; i < queried.size(); ++i) {
+    const auto it = directory.find(queried[i]);
+    reply[i] = (it != directory.end()) ? it->second : -1;
+  }
+  const auto answer = ExchangeItems(reply, recvCount, 1, MPI_INT, sendCount);
+
+  /*--- The answers are ordered by directory rank, in the order of the queries. ---*/
+
+  vector<int> offset(size, 0);
+  for (int iRank = 1; iRank < size; ++iRank) offset[iRank] = offset[iRank - 1] + sendCount[iRank - 1];
+
+  owners.resize(globalPoints.size());
+  for (auto i = 0ul; i < globalPoints.size(); ++i) {
+    owners[i] = answer[offset[globalPoints[i] % size]++];
+    if (owners[i] < 0) SU2_MPI::Error("Donor point not found on any rank.", CURRENT_FUNCTION);
+  }
+}
+
+void CInterpolator::ExchangeDonorQueries(int markTarget, unsigned short nDim, unsigned long nReal,
+                                         unsigned long nInt, const vector<vector<unsigned long> >& queryVertex,
+                                         const LocalDonorSearch& localSearch, su2activematrix& real,
+                                         su2matrix<unsigned long>& integer) const {
+  /*--- Send the target coordinates. ---*/
+
+  vector<int> sendCount(size), recvCount;
+  vector<su2double> sendCoord;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendCount[iRank] = queryVertex[iRank].size();
+    for (const auto iVertex : queryVertex[iRank]) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      for (auto iDim = 0u; iDim < nDim; ++iDim) sendCoord.push_back(target_geometry->nodes->GetCoord(iPoint, iDim));
+    }
+  }
+  const auto recvCoord = ExchangeItems(sendCoord, sendCount, nDim, MPI_DOUBLE, recvCount);
+
+  /*--- Search the local donors, the last integer indicates if the search was successful. ---*/
+
+  const unsigned long nQuery = recvCoord.size() / nDim;
+  const auto nIntExt = nInt + 1;
+  vector<su2double> replyReal(nQuery * nReal, 0.0);
+  vector<unsigned long> replyInt(nQuery * nIntExt, 0);
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(roundUpDiv(nQuery, 2 * omp_get_max_threads()))
+    for (auto iQuery = 0ul; iQuery < nQuery; ++iQuery) {
+      replyInt[iQuery * nIntExt + nInt] =
+          localSearch(&recvCoord[iQuery * nDim], &replyReal[iQuery * nReal], &replyInt[iQuery * nIntExt]);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Return the results. ---*/
+
+  const auto resultReal = ExchangeItems(replyReal, recvCount, nReal, MPI_DOUBLE, sendCount);
+  const auto resultInt = ExchangeItems(replyInt, recvCount, nIntExt, MPI_UNSIGNED_LONG, sendCount);
+
+  const auto nResult = resultInt.size() / nIntExt;
+  real.resize(nResult, nReal);
+  integer.resize(nResult, nIntExt);
+  copy(resultReal.begin(), resultReal.end(), real.data());
+  copy(resultInt.begin(), resultInt.end(), integer.data());
+}
+
+void CInterpolator::DistributedDonorSearch(int markTarget, unsigned short nDim,
+                                           const vector<su2double>& localDonorCoord, unsigned long nReal,
+                                           unsigned long nInt, const LocalDonorSearch& localSearch,
+                                           vector<unsigned long>& resultStart, su2activematrix& real,
+                                           su2matrix<unsigned long>& integer) const {
+  /*--- Bounding boxes of the donor points of each rank, empty ranks have min > max. ---*/
+
+  const auto big = numeric_limits<passivedouble>::max();
+  vector<passivedouble> localBox(2 * nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    localBox[iDim] = big;
+    localBox[nDim + iDim] = -big;
+  }
+  for (auto i = 0ul; i < localDonorCoord.size(); ++i) {
+    const auto iDim = i % nDim;
+    const auto x = SU2_TYPE::GetValue(localDonorCoord[i]);
+    localBox[iDim] = min(localBox[iDim], x);
+    localBox[nDim + iDim] = max(localBox[nDim + iDim], x);
+  }
+  su2passivematrix boxes(size, 2 * nDim);
+  SelectMPIWrapper<passivedouble>::W::Allgather(localBox.data(), 2 * nDim, MPI_DOUBLE, boxes.data(), 2 * nDim,
+                                                 MPI_DOUBLE, SU2_MPI::GetComm());
+
+  auto emptyBox = [&](int iRank) { return boxes(iRank, 0) > boxes(iRank, nDim); };
+
+  auto boxDistance2 = [&](int iRank, unsigned long iPoint) {
+    passivedouble d2 = 0.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(target_geometry->nodes->GetCoord(iPoint, iDim));
+      const auto d = max({boxes(iRank, iDim) - x, x - boxes(iRank, nDim + iDim), passivedouble(0)});
+      d2 += d * d;
+    }
+    return d2;
+  };
+
+  const auto nVertexTarget = (markTarget != -1) ? target_geometry->GetnVertex(markTarget) : 0ul;
+
+  /*--- First round, send each target vertex to the rank with the closest box. ---*/
+
+  vector<vector<unsigned long> > queryVertex(size);
+
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+    const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+    int bestRank = -1;
+    passivedouble bestDist2 = big;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (emptyBox(iRank)) continue;
+      const auto d2 = boxDistance2(iRank, iPoint);
+      if (bestRank < 0 || d2 < bestDist2) {
+        bestRank = iRank;
+        bestDist2 = d2;
+      }
+    }
+    if (bestRank < 0) SU2_MPI::Error("The donor side of the interface has no points.", CURRENT_FUNCTION);
+    queryVertex[bestRank].push_back(iVertex);
+  }
+
+  su2activematrix real1, real2;
+  su2matrix<unsigned long> int1, int2;
+  ExchangeDonorQueries(markTarget, nDim, nReal, nInt, queryVertex, localSearch, real1, int1);
+
+  /*--- Second round, other ranks whose box is within the distance found in the first round. ---*/
+
+  vector<vector<unsigned long> > queryVertex2(size);
+
+  for (int iRank = 0, iRes = 0; iRank < size; ++iRank) {
+    for (const auto iVertex : queryVertex[iRank]) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      const auto radius2 = int1(iRes, nInt) ? SU2_TYPE::GetValue(real1(iRes, 0)) : big;
+      ++iRes;
+      for (int jRank = 0; jRank < size; ++jRank) {
+        if (jRank == iRank || emptyBox(jRank)) continue;
+        if (boxDistance2(jRank, iPoint) <= radius2) queryVertex2[jRank].push_back(iVertex);
+      }
+    }
+  }
+
+  ExchangeDonorQueries(markTarget, nDim, nReal, nInt, queryVertex2, localSearch, real2, int2);
+
+  /*--- Group the successful results by target vertex. ---*/
+
+  resultStart.assign(nVertexTarget + 1, 0);
+
+  auto forEachResult = [&](const vector<vector<unsigned long> >& query, const su2matrix<unsigned long>& ints,
+                           const function<void(unsigned long, unsigned long)>& f) {
+    for (int iRank = 0, iRes = 0; iRank < size; ++iRank) {
+      for (const auto iVertex : query[iRank]) {
+        if (ints(iRes, nInt)) f(iVertex, iRes);
+        ++iRes;
+      }
+    }
+  };
+  auto count = [&](unsigned long iVertex, unsigned long) { ++resultStart[iVertex + 1]; };
+  forEachResult(queryVertex, int1, count);
+  forEachResult(queryVertex2, int2, count);
+
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) resultStart[iVertex + 1] += resultStart[iVertex];
+
+  real.resize(resultStart.back(), nReal);
+  integer.resize(resultStart.back(), nInt);
+  auto pos = resultStart;
+
+  auto store = [&](const su2activematrix& reals, const su2matrix<unsigned long>& ints, unsigned long iVertex,
+                   unsigned long iRes) {
+    const auto iDst = pos[iVertex]++;
+    for (auto i = 0ul; i < nReal; ++i) real(iDst, i) = reals(iRes, i);
+    for (auto i = 0ul; i < nInt; ++i) integer(iDst, i) = ints(iRes, i);
+  };
+  forEachResult(queryVertex, int1,
+                [&](unsigned long iVertex, unsigned long iRes) { store(real1, int1, iVertex, iRes); });
+  forEachResult(queryVertex2, int2,
+                [&](unsigned long iVertex, unsigned long iRes) { store(real2, int2, iVertex, iRes); });
+}
+
 void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker) {
   const CGeometry* geom = Geometry[val_zone][INST_0][MESH_0];
   const auto nDim = geom->GetnDim();
@@ -376,3 +630,238 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker)
   SU2_MPI::Bcast(Buffer_Receive_StartLinkedNodes.data(), nGlobalVertex, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
   SU2_MPI::Bcast(Buffer_Receive_LinkedNodes.data(), nGlobalLinkedNodes, MPI_UNSIGNED_LONG, 0, SU2_MPI::GetComm());
 }
+
+namespace {
+/*--- Identification of the transfer coefficient cache files. ---*/
+constexpr unsigned long CACHE_MAGIC = 0x53553249434f4546ul;  // "SU2ICOEF"
+constexpr unsigned long CACHE_VERSION = 1;
+
+/*!
+ * \brief Mix the bytes of a value into a FNV-1a hash.
+ */
+template <class T>
+void HashBytes(const T& value, unsigned long& hash) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ul;
+  }
+}
+constexpr unsigned long HASH_OFFSET = 14695981039346656037ul;
+}  // namespace
+
+void CInterpolator::InitTransferCoeff(const CConfig* const* config) {
+  const auto& cacheName = config[donorZone]->GetInterpolation_Cache_FileName();
+  if (cacheName.empty()) {
+    SetTransferCoeff(config);
+    return;
+  }
+  const auto fileName = cacheName + "_" + to_string(donorZone) + "_" + to_string(targetZone) + ".dat";
+  const auto key = TransferCoeffCacheKey(config);
+
+  transferCoeffFromCache = ReadTransferCoeffCache(config, fileName, key);
+  if (transferCoeffFromCache) {
+    ++transferCoeffVersion;
+    return;
+  }
+  SetTransferCoeff(config);
+  WriteTransferCoeffCache(config, fileName, key);
+}
+
+unsigned long CInterpolator::TransferCoeffCacheKey(const CConfig* const* config) const {
+  /*--- Options that change the coefficients. ---*/
+  const auto* donorConfig = config[donorZone];
+  auto optionsHash = HASH_OFFSET;
+  HashBytes(donorConfig->GetKindInterpolation(), optionsHash);
+  HashBytes(config[targetZone]->GetConservativeInterpolation(), optionsHash);
+  HashBytes(donorConfig->GetNumNearestNeighbors(), optionsHash);
+  HashBytes(donorConfig->GetKindRadialBasisFunction(), optionsHash);
+  HashBytes(donorConfig->GetRadialBasisFunctionPolynomialOption(), optionsHash);
+  HashBytes(SU2_TYPE::GetValue(donorConfig->GetRadialBasisFunctionParameter()), optionsHash);
+  HashBytes(SU2_TYPE::GetValue(donorConfig->GetRadialBasisFunctionPruneTol()), optionsHash);
+  HashBytes(donorConfig->GetRadialBasisFunctionLocalPoints(), optionsHash);
+
+  /*--- The vertex hashes are summed, which makes the key independent of their distribution. ---*/
+  unsigned long vertexHash = 0;
+  const auto nMarkerInt = donorConfig->GetMarker_n_ZoneInterface() / 2;
+  const auto nDim = donor_geometry->GetnDim();
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+    const int marker[] = {donorConfig->FindInterfaceMarker(iMarkerInt),
+                          config[targetZone]->FindInterfaceMarker(iMarkerInt)};
+    const CGeometry* geometry[] = {donor_geometry, target_geometry};
+
+    for (unsigned short iSide = 0; iSide < 2; ++iSide) {
+      if (marker[iSide] == -1) continue;
+      for (auto iVertex = 0ul; iVertex < geometry[iSide]->GetnVertex(marker[iSide]); ++iVertex) {
+        const auto iPoint = geometry[iSide]->vertex[marker[iSide]][iVertex]->GetNode();
+        if (!geometry[iSide]->nodes->GetDomain(iPoint)) continue;
+        auto hash = HASH_OFFSET;
+        HashBytes(iMarkerInt, hash);
+        HashBytes(iSide, hash);
+        HashBytes(geometry[iSide]->nodes->GetGlobalIndex(iPoint), hash);
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          HashBytes(SU2_TYPE::GetValue(geometry[iSide]->nodes->GetCoord(iPoint, iDim)), hash);
+        vertexHash += hash;
+      }
+    }
+  }
+  unsigned long globalVertexHash = 0;
+  SU2_MPI::Allreduce(&vertexHash, &globalVertexHash, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  HashBytes(globalVertexHash, optionsHash);
+  return optionsHash;
+}
+
+bool CInterpolator::ReadTransferCoeffCache(const CConfig* const* config, const string& fileName,
+                                           unsigned long key) {
+  /*--- All ranks read the file, and keep the records of the target vertices they own. ---*/
+
+  const unsigned long nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+  targetVertices.clear();
+  targetVertices.resize(config[targetZone]->GetnMarker_All());
+
+  ifstream file(fileName, ios::binary);
+  unsigned long header[4] = {0};
+  file.read(reinterpret_cast<char*>(header), sizeof(header));
+  int success = file && (header[0] == CACHE_MAGIC) && (header[1] == CACHE_VERSION) && (header[2] == key) &&
+                (header[3] == nMarkerInt);
+
+  for (unsigned short iMarkerInt = 0; success && iMarkerInt < nMarkerInt; iMarkerInt++) {
+    /*--- Record layout: number of targets, integers, and reals, then the integers (for each target its global
+     *    index, number of donors, and their global indices) and the reals (the coefficients). ---*/
+    unsigned long sizes[3] = {0};
+    file.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+    vector<unsigned long> ints(sizes[1]);
+    vector<passivedouble> reals(sizes[2]);
+    file.read(reinterpret_cast<char*>(ints.data()), ints.size() * sizeof(unsigned long));
+    file.read(reinterpret_cast<char*>(reals.data()), reals.size() * sizeof(passivedouble));
+    if (!file) {
+      success = false;
+      break;
+    }
+
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+    if (markTarget == -1 || sizes[0] == 0) continue;
+
+    const auto nVertexTarget = target_geometry->GetnVertex(markTarget);
+    targetVertices[markTarget].resize(nVertexTarget);
+
+    unordered_map<unsigned long, unsigned long> localVertex;
+    for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (target_geometry->nodes->GetDomain(iPoint))
+        localVertex[target_geometry->nodes->GetGlobalIndex(iPoint)] = iVertex;
+    }
+
+    unsigned long nFound = 0;
+    for (unsigned long iTarget = 0, iInt = 0, iReal = 0; iTarget < sizes[0]; ++iTarget) {
+      if (iInt + 2 > ints.size() || iReal + ints[iInt + 1] > reals.size()) {
+        success = false;
+        break;
+      }
+      const auto it = localVertex.find(ints[iInt]);
+      const auto nDonor = ints[iInt + 1];
+      iInt += 2;
+      if (it != localVertex.end()) {
+        auto& target = targetVertices[markTarget][it->second];
+        target.resize(nDonor);
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+          target.globalPoint[iDonor] = ints[iInt + iDonor];
+          target.coefficient[iDonor] = reals[iReal + iDonor];
+        }
+        ++nFound;
+      }
+      iInt += nDonor;
+      iReal += nDonor;
+    }
+    if (nFound != localVertex.size()) success = false;
+  }
+
+  int allSuccess = 0;
+  SU2_MPI::Allreduce(&success, &allSuccess, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allSuccess) {
+    targetVertices.clear();
+    return false;
+  }
+
+  /*--- The ranks that own the donor points depend on the partition, they are not cached. ---*/
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+    const auto markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+
+    vector<unsigned long> globalPoints;
+    if (markTarget != -1) {
+      for (const auto& target : targetVertices[markTarget])
+        globalPoints.insert(globalPoints.end(), target.globalPoint.begin(), target.globalPoint.end());
+    }
+    vector<int> owners;
+    FindDonorOwners(markDonor, globalPoints, owners);
+
+    if (markTarget == -1) continue;
+    auto iOwner = 0ul;
+    for (auto& target : targetVertices[markTarget])
+      for (auto& processor : target.processor) processor = owners[iOwner++];
+  }
+  return true;
+}
+
+void CInterpolator::WriteTransferCoeffCache(const CConfig* const* config, const string& fileName,
+                                            unsigned long key) const {
+  const unsigned long nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+
+  ofstream file;
+  if (rank == MASTER_NODE) {
+    file.open(fileName, ios::binary);
+    const unsigned long header[] = {CACHE_MAGIC, CACHE_VERSION, key, nMarkerInt};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  }
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- Records of the owned target vertices, see ReadTransferCoeffCache for the layout. ---*/
+    unsigned long nTarget = 0;
+    vector<unsigned long> ints;
+    vector<su2double> reals;
+
+    if (markTarget != -1 && !targetVertices[markTarget].empty()) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); ++iVertex) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+        const auto& target = targetVertices[markTarget][iVertex];
+        ints.push_back(target_geometry->nodes->GetGlobalIndex(iPoint));
+        ints.push_back(target.nDonor());
+        ints.insert(ints.end(), target.globalPoint.begin(), target.globalPoint.end());
+        reals.insert(reals.end(), target.coefficient.begin(), target.coefficient.end());
+        ++nTarget;
+      }
+    }
+
+    /*--- Gather on the master rank. ---*/
+    unsigned long nTargetGlobal = 0;
+    SU2_MPI::Allreduce(&nTarget, &nTargetGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    vector<int> sendCount(size, 0), recvCount;
+    sendCount[MASTER_NODE] = ints.size();
+    const auto allInts = ExchangeItems(ints, sendCount, 1, MPI_UNSIGNED_LONG, recvCount);
+    sendCount[MASTER_NODE] = reals.size();
+    const auto allReals = ExchangeItems(reals, sendCount, 1, MPI_DOUBLE, recvCount);
+
+    if (rank != MASTER_NODE) continue;
+
+    vector<passivedouble> passiveReals(allReals.size());
+    for (auto i = 0ul; i < allReals.size(); ++i) passiveReals[i] = SU2_TYPE::GetValue(allReals[i]);
+
+    const unsigned long sizes[] = {nTargetGlobal, allInts.size(), passiveReals.size()};
+    file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+    file.write(reinterpret_cast<const char*>(allInts.data()), allInts.size() * sizeof(unsigned long));
+    file.write(reinterpret_cast<const char*>(passiveReals.data()), passiveReals.size() * sizeof(passivedouble));
+  }
+
+  if (rank == MASTER_NODE && !file) {
+    cout << "WARNING: Could not write the interpolation cache file " << fileName << "." << endl;
+  }
+}
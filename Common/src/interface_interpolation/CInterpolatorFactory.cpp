@@ -80,7 +80,12 @@ CInterpolator* CreateInterpolator(CGeometry**** geometry_container, const CConfi
     }
   }
 
-  if (verbose) interpolator->PrintStatistics();
+  if (verbose) {
+    if (interpolator->GetTransferCoeffFromCache())
+      cout << "  Coefficients read from the interpolation cache." << endl;
+    else
+      interpolator->PrintStatistics();
+  }
 
   return interpolator;
 }
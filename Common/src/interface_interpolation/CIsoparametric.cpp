@@ -27,6 +27,7 @@
 
 #include "../../include/interface_interpolation/CIsoparametric.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTElemClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
@@ -37,7 +38,7 @@ using namespace GeometryToolbox;
 CIsoparametric::CIsoparametric(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
                                unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
-  SetTransferCoeff(config);
+  InitTransferCoeff(config);
 }
 
 void CIsoparametric::PrintStatistics() const {
@@ -47,13 +48,16 @@ void CIsoparametric::PrintStatistics() const {
 }
 
 void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
+  ++transferCoeffVersion;
+
   const su2double matchingVertexTol = 1e-12;  // 1um^2
 
-  const int nProcessor = size;
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
   const auto nDim = donor_geometry->GetnDim();
 
-  Buffer_Receive_nVertex_Donor = new unsigned long[nProcessor];
+  /*--- Layout of the search results, real: squared distance to the element, distance to the mapped point,
+   *    and isoparameters, integer: number of nodes, global index of the nodes, their owners, and error. ---*/
+  constexpr unsigned short nReal = 6, nInt = 10;
 
   /*--- Make space for donor info. ---*/
 
@@ -68,9 +72,10 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
     /* High level procedure:
-     * - Loop through vertices of the target grid;
-     * - Find nearest element;
-     * - Compute and set the transfer coefficients.
+     * - Build an ADT of the local donor elements;
+     * - Send each target vertex to the ranks whose donor elements may be the closest;
+     * - Find the nearest element and compute the transfer coefficients on those ranks;
+     * - Keep the closest of the candidates.
      */
 
     /*--- On the donor side: find the tag of the boundary sharing the interface. ---*/
@@ -82,71 +87,122 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     /*--- Checks if the zone contains the interface, if not continue to the next step. ---*/
     if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    unsigned long nVertexDonor = 0, nVertexTarget = 0;
-    if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+    unsigned long nElemDonor = 0, nVertexTarget = 0;
+    if (markDonor != -1) nElemDonor = donor_geometry->GetnElem_Bound(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
+    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    const auto nGlobalVertexDonor =
-        accumulate(Buffer_Receive_nVertex_Donor, Buffer_Receive_nVertex_Donor + nProcessor, 0ul);
+    /*--- Local donor elements (which may include halo points) in the format of the ADT. ---*/
 
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
+    unordered_map<unsigned long, unsigned long> pointToSurface;
+    vector<su2double> surfaceCoor;
+    vector<unsigned long> surfacePoint, surfaceConn, elemIDs;
+    vector<unsigned short> VTK_TypeElem, markerIDs;
 
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
-    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+    for (auto iElem = 0ul; iElem < nElemDonor; ++iElem) {
+      const auto elem = donor_geometry->bound[markDonor][iElem];
+      markerIDs.push_back(markDonor);
+      VTK_TypeElem.push_back(elem->GetVTK_Type());
+      elemIDs.push_back(iElem);
 
-    /*--- Compress the vertex information, and build a map of global point to "compressed
-     *    index" to then reconstruct the donor elements in local index space. ---*/
-
-    su2activematrix donorCoord(nGlobalVertexDonor, nDim);
-    vector<long> donorPoint(nGlobalVertexDonor);
-    vector<int> donorProc(nGlobalVertexDonor);
-    unordered_map<long, unsigned long> globalToLocalMap;
-
-    auto iCount = 0ul;
-    for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
-      auto offset = iProcessor * MaxLocalVertex_Donor;
-      for (auto iVertex = 0ul; iVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++iVertex) {
-        for (int iDim = 0; iDim < nDim; ++iDim) donorCoord(iCount, iDim) = Buffer_Receive_Coord(offset + iVertex, iDim);
-        donorPoint[iCount] = Buffer_Receive_GlobalPoint[offset + iVertex];
-        donorProc[iCount] = iProcessor;
-        assert((globalToLocalMap.count(donorPoint[iCount]) == 0) && "Duplicate donor point found.");
-        globalToLocalMap[donorPoint[iCount]] = iCount;
-        ++iCount;
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) {
+        const auto iPoint = elem->GetNode(iNode);
+        const auto it = pointToSurface.emplace(iPoint, surfacePoint.size());
+        if (it.second) {
+          surfacePoint.push_back(donor_geometry->nodes->GetGlobalIndex(iPoint));
+          for (auto iDim = 0u; iDim < nDim; ++iDim)
+            surfaceCoor.push_back(donor_geometry->nodes->GetCoord(iPoint, iDim));
+        }
+        surfaceConn.push_back(it.first->second);
       }
     }
-    assert((iCount == nGlobalVertexDonor) && "Global donor point count mismatch.");
-
-    /*--- Collect donor element (face) information. ---*/
 
-    vector<unsigned long> allNumElem;
-    vector<unsigned short> elemNumNodes;
-    su2matrix<long> elemIdxNodes;
+    /*--- The transfer needs the rank that owns each donor point. ---*/
+    vector<int> surfaceOwner;
+    FindDonorOwners(markDonor, surfacePoint, surfaceOwner);
 
-    const auto nGlobalElemDonor = Collect_ElementInfo(markDonor, nDim, true, allNumElem, elemNumNodes, elemIdxNodes);
+    CADTElemClass donorADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, false);
 
-    /*--- Map the node to "local" indices and create a list of connected elements for each vertex. ---*/
+    auto localSearch = [&](const su2double* coord_i, su2double* real, unsigned long* integer) {
+      if (donorADT.IsEmpty()) return false;
 
-    vector<vector<unsigned> > vertexElements(nGlobalVertexDonor);
+      su2double dist;
+      unsigned short markerID;
+      unsigned long iElem;
+      int rankID;
+      donorADT.DetermineNearestElement(coord_i, dist, markerID, iElem, rankID);
 
-    for (auto iElem = 0u; iElem < nGlobalElemDonor; ++iElem) {
-      const auto nNode = elemNumNodes[iElem];
+      /*--- Fetch element info. ---*/
+      const auto elem = donor_geometry->bound[markDonor][iElem];
+      const auto nNode = elem->GetnNodes();
+      su2double coords[4][3] = {{0.0}};
+      unsigned long iSurf[4] = {0};
 
+      su2double minDist = 1e9;
+      unsigned short iClosestNode = 0;
       for (auto iNode = 0u; iNode < nNode; ++iNode) {
-        assert(globalToLocalMap.count(elemIdxNodes(iElem, iNode)) &&
-               "Unknown donor point referenced by donor element.");
-        const auto iVertex = globalToLocalMap.at(elemIdxNodes(iElem, iNode));
-        elemIdxNodes(iElem, iNode) = iVertex;
+        iSurf[iNode] = pointToSurface.at(elem->GetNode(iNode));
+        for (auto iDim = 0u; iDim < nDim; ++iDim) coords[iNode][iDim] = surfaceCoor[iSurf[iNode] * nDim + iDim];
+        const su2double d = SquaredDistance(nDim, coord_i, coords[iNode]);
+        if (d < minDist) {
+          minDist = d;
+          iClosestNode = iNode;
+        }
+      }
 
-        vertexElements[iVertex].push_back(iElem);
+      real[0] = dist * dist;
+
+      if (minDist < matchingVertexTol) {
+        /*--- Perfect match. ---*/
+        real[1] = 0.0;
+        real[2] = 1.0;
+        integer[0] = 1;
+        integer[1] = surfacePoint[iSurf[iClosestNode]];
+        integer[5] = surfaceOwner[iSurf[iClosestNode]];
+        integer[9] = 0;
+        return true;
       }
-    }
+
+      /*--- Compute the interpolation coefficients. ---*/
+      su2double* isoparams = real + 2;
+      int error = 0;
+      switch (nNode) {
+        case 2:
+          error = LineIsoparameters(coords, coord_i, isoparams);
+          break;
+        case 3:
+          error = TriangleIsoparameters(coords, coord_i, isoparams);
+          break;
+        case 4:
+          error = QuadrilateralIsoparameters(coords, coord_i, isoparams);
+          break;
+      }
+
+      /*--- Evaluate distance from target to final mapped point. ---*/
+      su2double finalCoord[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        for (auto iNode = 0u; iNode < nNode; ++iNode) finalCoord[iDim] += coords[iNode][iDim] * isoparams[iNode];
+
+      real[1] = Distance(nDim, coord_i, finalCoord);
+
+      /*--- Detect a very bad candidate (NaN). ---*/
+      if (real[1] != real[1]) error = 2;
+
+      integer[0] = nNode;
+      for (auto iNode = 0u; iNode < nNode; ++iNode) {
+        integer[1 + iNode] = surfacePoint[iSurf[iNode]];
+        integer[5 + iNode] = surfaceOwner[iSurf[iNode]];
+      }
+      integer[9] = error;
+      return true;
+    };
+
+    vector<unsigned long> resultStart;
+    su2activematrix resultReal;
+    su2matrix<unsigned long> resultInt;
+    DistributedDonorSearch(markTarget, nDim, surfaceCoor, nReal, nInt, localSearch, resultStart, resultReal,
+                           resultInt);
 
     /*--- Compute transfer coefficients for each target point. ---*/
     SU2_OMP_PARALLEL {
@@ -161,87 +217,26 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
         if (!target_geometry->nodes->GetDomain(iPoint)) continue;
         totalCount += 1;
 
-        /*--- Coordinates of the target point. ---*/
-        const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
-
-        /*--- Find the closest donor vertex. ---*/
-        su2double minDist = 1e9;
-        unsigned iClosestVertex = 0;
-        for (auto iVertexDonor = 0u; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-          su2double d = SquaredDistance(nDim, coord_i, donorCoord[iVertexDonor]);
-          if (d < minDist) {
-            minDist = d;
-            iClosestVertex = iVertexDonor;
-          }
-        }
-
-        if (minDist < matchingVertexTol) {
-          /*--- Perfect match. ---*/
-          target_vertex.resize(1);
-          target_vertex.coefficient[0] = 1.0;
-          target_vertex.globalPoint[0] = donorPoint[iClosestVertex];
-          target_vertex.processor[0] = donorProc[iClosestVertex];
-          continue;
-        }
-
-        /*--- Evaluate interpolation for the elements connected to the closest vertex. ---*/
-        DonorInfo donor;
-        donor.error = 2;
-        donor.distance = 1e9;
-        for (auto iElem : vertexElements[iClosestVertex]) {
-          /*--- Fetch element info. ---*/
-          DonorInfo candidate;
-          candidate.iElem = iElem;
-          const auto nNode = elemNumNodes[iElem];
-          su2double coords[4][3] = {{0.0}};
-
-          for (auto iNode = 0u; iNode < nNode; ++iNode) {
-            const auto iVertex = elemIdxNodes(iElem, iNode);
-            for (auto iDim = 0u; iDim < nDim; ++iDim) coords[iNode][iDim] = donorCoord(iVertex, iDim);
-          }
-
-          /*--- Compute the interpolation coefficients. ---*/
-          switch (nNode) {
-            case 2:
-              candidate.error = LineIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
-            case 3:
-              candidate.error = TriangleIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
-            case 4:
-              candidate.error = QuadrilateralIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
-          }
-
-          /*--- Evaluate distance from target to final mapped point. ---*/
-          su2double finalCoord[3] = {0.0};
-          for (auto iDim = 0u; iDim < nDim; ++iDim)
-            for (auto iNode = 0u; iNode < nNode; ++iNode)
-              finalCoord[iDim] += coords[iNode][iDim] * candidate.isoparams[iNode];
-
-          candidate.distance = Distance(nDim, coord_i, finalCoord);
-
-          /*--- Detect a very bad candidate (NaN). ---*/
-          if (candidate.distance != candidate.distance) continue;
-
-          /*--- Check if the candidate is an improvement, update donor if so. ---*/
-          if (candidate < donor) donor = candidate;
+        /*--- Keep the closest donor element found by the searched ranks. ---*/
+        auto iBest = resultStart[iVertexTarget];
+        for (auto iRes = iBest + 1; iRes < resultStart[iVertexTarget + 1]; ++iRes) {
+          if (resultReal(iRes, 0) < resultReal(iBest, 0)) iBest = iRes;
         }
 
-        if (donor.error > 1) SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
+        if (iBest == resultStart[iVertexTarget + 1] || resultInt(iBest, 9) > 1)
+          SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
 
-        errorCount += donor.error;
-        maxDist = max(maxDist, donor.distance);
+        errorCount += resultInt(iBest, 9);
+        maxDist = max(maxDist, resultReal(iBest, 1));
 
-        const auto nNode = elemNumNodes[donor.iElem];
+        const auto nNode = resultInt(iBest, 0);
 
         target_vertex.resize(nNode);
 
         for (auto iNode = 0u; iNode < nNode; ++iNode) {
-          const auto iVertex = elemIdxNodes(donor.iElem, iNode);
-          target_vertex.coefficient[iNode] = donor.isoparams[iNode];
-          target_vertex.globalPoint[iNode] = donorPoint[iVertex];
-          target_vertex.processor[iNode] = donorProc[iVertex];
+          target_vertex.coefficient[iNode] = resultReal(iBest, 2 + iNode);
+          target_vertex.globalPoint[iNode] = resultInt(iBest, 1 + iNode);
+          target_vertex.processor[iNode] = resultInt(iBest, 5 + iNode);
         }
       }
       END_SU2_OMP_FOR
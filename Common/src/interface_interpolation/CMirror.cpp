@@ -40,10 +40,12 @@ CMirror::CMirror(CGeometry**** geometry_container, const CConfig* const* config,
                        to_string(iZone) + string(" and ") + to_string(jZone) + string("."),
                    CURRENT_FUNCTION);
   }
-  SetTransferCoeff(config);
+  InitTransferCoeff(config);
 }
 
 void CMirror::SetTransferCoeff(const CConfig* const* config) {
+  ++transferCoeffVersion;
+
   const int nProcessor = size;
 
   vector<unsigned long> allNumVertexTarget(nProcessor);
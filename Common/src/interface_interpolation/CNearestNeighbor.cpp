@@ -27,13 +27,14 @@
 
 #include "../../include/interface_interpolation/CNearestNeighbor.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
 CNearestNeighbor::CNearestNeighbor(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
                                    unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
-  SetTransferCoeff(config);
+  InitTransferCoeff(config);
 }
 
 void CNearestNeighbor::PrintStatistics() const {
@@ -42,22 +43,25 @@ void CNearestNeighbor::PrintStatistics() const {
 }
 
 void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
+  ++transferCoeffVersion;
+
   /*--- Desired number of donor points. ---*/
   const auto nDonor = max<unsigned long>(config[donorZone]->GetNumNearestNeighbors(), 1);
 
   /*--- Epsilon used to avoid division by zero. ---*/
   const su2double eps = numeric_limits<passivedouble>::epsilon();
 
-  const int nProcessor = size;
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
   const auto nDim = donor_geometry->GetnDim();
 
-  Buffer_Receive_nVertex_Donor = new unsigned long[nProcessor];
-
   targetVertices.resize(config[targetZone]->GetnMarker_All());
 
   vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
 
+  /*--- Layout of the search results, real: squared search radius followed by the squared distances,
+   *    integer: global indices followed by the rank and the number of donors found. ---*/
+  const unsigned long nReal = 1 + nDonor, nInt = nDonor + 2;
+
   /*--- Cycle over nMarkersInt interface to determine communication pattern. ---*/
 
   AvgDistance = MaxDistance = 0.0;
@@ -77,26 +81,52 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    const auto nPossibleDonor =
-        accumulate(Buffer_Receive_nVertex_Donor, Buffer_Receive_nVertex_Donor + nProcessor, 0ul);
+    /*--- Local donor points, only this rank searches them. ---*/
+    vector<su2double> donorCoord;
+    vector<unsigned long> donorPoint;
+
+    for (auto iVertex = 0ul; iVertex < nVertexDonor; iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+      donorPoint.push_back(donor_geometry->nodes->GetGlobalIndex(iPoint));
+      for (auto iDim = 0u; iDim < nDim; iDim++) donorCoord.push_back(donor_geometry->nodes->GetCoord(iPoint, iDim));
+    }
+    const auto nLocalDonor = donorPoint.size();
+
+    CADTPointsOnlyClass donorADT(nDim, nLocalDonor, donorCoord.data(), donorPoint.data(), false);
 
-    Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
-    Buffer_Send_GlobalPoint.resize(MaxLocalVertex_Donor);
-    Buffer_Receive_Coord.resize(nProcessor * MaxLocalVertex_Donor, nDim);
-    Buffer_Receive_GlobalPoint.resize(nProcessor * MaxLocalVertex_Donor);
+    auto localSearch = [&](const su2double* coord, su2double* real, unsigned long* integer) {
+      if (nLocalDonor == 0) return false;
 
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+      vector<su2double> dist;
+      vector<unsigned long> pointID;
+      vector<int> rankID;
+      donorADT.DetermineNearestNodes(coord, nDonor, dist, pointID, rankID);
+      const auto nFound = pointID.size();
 
-    /*--- Find the closest donor points to each target. ---*/
+      /*--- Other ranks may have closer points if fewer than nDonor were found here. ---*/
+      const auto big = numeric_limits<passivedouble>::max();
+      real[0] = (nFound == nDonor) ? dist[nFound - 1] * dist[nFound - 1] : su2double(big);
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        real[1 + iDonor] = dist[iDonor] * dist[iDonor];
+        integer[iDonor] = pointID[iDonor];
+      }
+      integer[nDonor] = rank;
+      integer[nDonor + 1] = nFound;
+      return true;
+    };
+
+    vector<unsigned long> resultStart;
+    su2activematrix resultReal;
+    su2matrix<unsigned long> resultInt;
+    DistributedDonorSearch(markTarget, nDim, donorCoord, nReal, nInt, localSearch, resultStart, resultReal, resultInt);
+
+    /*--- Merge the candidates found by different ranks and keep the closest. ---*/
     SU2_OMP_PARALLEL {
       /*--- Working array for this thread. ---*/
       auto& donorInfo = DonorInfoVec[omp_get_thread_num()];
-      donorInfo.resize(nPossibleDonor);
 
       su2double avgDist = 0.0, maxDist = 0.0;
       unsigned long numTarget = 0;
@@ -108,27 +138,16 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
 
         if (!target_geometry->nodes->GetDomain(Point_Target)) continue;
 
-        /*--- Coordinates of the target point. ---*/
-        const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
-
-        /*--- Compute all distances. ---*/
-        for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-          for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-            const auto idx = iProcessor * MaxLocalVertex_Donor + jVertex;
-            const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-            const su2double* Coord_j = Buffer_Receive_Coord[idx];
-            const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
-
-            donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
+        donorInfo.clear();
+        for (auto iRes = resultStart[iVertexTarget]; iRes < resultStart[iVertexTarget + 1]; ++iRes) {
+          for (auto iDonor = 0ul; iDonor < resultInt(iRes, nDonor + 1); ++iDonor) {
+            donorInfo.emplace_back(resultReal(iRes, 1 + iDonor), resultInt(iRes, iDonor), resultInt(iRes, nDonor));
           }
         }
 
         /*--- Find k closest points. ---*/
-        partial_sort(donorInfo.begin(), donorInfo.begin() + nDonor, donorInfo.end(),
-                     [](const DonorInfo& a, const DonorInfo& b) {
-                       /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-                       return (a.dist != b.dist) ? (a.dist < b.dist) : (a.pidx < b.pidx);
-                     });
+        const auto nFound = min<unsigned long>(nDonor, donorInfo.size());
+        partial_sort(donorInfo.begin(), donorInfo.begin() + nFound, donorInfo.end());
 
         /*--- Update stats. ---*/
         numTarget += 1;
@@ -138,15 +157,15 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
 
         /*--- Compute interpolation numerators and denominator. ---*/
         su2double denom = 0.0;
-        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+        for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
           donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
           denom += donorInfo[iDonor].dist;
         }
 
         /*--- Set interpolation coefficients. ---*/
-        target_vertex.resize(nDonor);
+        target_vertex.resize(nFound);
 
-        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+        for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
           target_vertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
           target_vertex.processor[iDonor] = donorInfo[iDonor].proc;
           target_vertex.coefficient[iDonor] = donorInfo[iDonor].dist / denom;
@@ -163,8 +182,6 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     END_SU2_OMP_PARALLEL
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
-
   unsigned long tmp = totalTargetPoints;
   SU2_MPI::Allreduce(&tmp, &totalTargetPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   su2double tmp1 = AvgDistance, tmp2 = MaxDistance;
@@ -27,6 +27,7 @@
 
 #include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
@@ -47,7 +48,7 @@ extern "C" void dgemm_(const char*, const char*, const int*, const int*, const i
 CRadialBasisFunction::CRadialBasisFunction(CGeometry**** geometry_container, const CConfig* const* config,
                                            unsigned int iZone, unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
-  SetTransferCoeff(config);
+  InitTransferCoeff(config);
 }
 
 void CRadialBasisFunction::PrintStatistics() const {
@@ -99,6 +100,14 @@ su2double CRadialBasisFunction::Get_RadialBasisValue(RADIAL_BASIS type, const su
 }
 
 void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
+  ++transferCoeffVersion;
+
+  /*--- Local patches avoid the dense global problem, for large interfaces. ---*/
+  if (config[donorZone]->GetRadialBasisFunctionLocalPoints() > 0) {
+    SetLocalTransferCoeff(config);
+    return;
+  }
+
   /*--- RBF options. ---*/
   const auto kindRBF = config[donorZone]->GetKindRadialBasisFunction();
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
@@ -392,6 +401,11 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   }  // end loop over interface markers
 
+  ReduceStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+}
+
+void CRadialBasisFunction::ReduceStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints,
+                                            unsigned long denseSize) {
   /*--- Final reduction of interpolation statistics and basic sanity checks. ---*/
   auto Reduce = [](SU2_MPI::Op op, unsigned long& val) {
     auto tmp = val;
@@ -423,6 +437,215 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Density = totalDonorPoints / (0.01 * denseSize);
 }
 
+void CRadialBasisFunction::SetLocalTransferCoeff(const CConfig* const* config) {
+  /*--- RBF options. ---*/
+  const auto kindRBF = config[donorZone]->GetKindRadialBasisFunction();
+  const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
+  const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
+  const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const unsigned long nPatch = config[donorZone]->GetRadialBasisFunctionLocalPoints();
+
+  const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+  const int nDim = donor_geometry->GetnDim();
+
+  if (usePolynomial && nPatch <= static_cast<unsigned long>(nDim))
+    SU2_MPI::Error("The local RBF patches are too small for the polynomial term.", CURRENT_FUNCTION);
+
+  targetVertices.resize(config[targetZone]->GetnMarker_All());
+
+  /*--- Layout of the search results, real: squared search radius followed by the squared distance and
+   *    coordinates of each donor, integer: global indices followed by the rank and the number of donors. ---*/
+  const unsigned long nReal = 1 + nPatch * (1 + nDim), nInt = nPatch + 2;
+
+  /*--- Initialize variables for interpolation statistics. ---*/
+  unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
+  MinDonors = 1 << 30;
+  MaxDonors = 0;
+  MaxCorrection = 0.0;
+  AvgCorrection = 0.0;
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
+    /*--- On the donor side: find the tag of the boundary sharing the interface. ---*/
+    const auto markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- On the target side: find the tag of the boundary sharing the interface. ---*/
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- If the zone does not contain the interface continue to the next pair of markers. ---*/
+    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+
+    unsigned long nVertexDonor = 0, nVertexTarget = 0;
+    if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+    if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
+
+    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+
+    /*--- Local donor points, the ADT stores their index in the local arrays. ---*/
+    vector<su2double> donorCoord;
+    vector<unsigned long> donorPoint, donorIndex;
+
+    for (auto iVertex = 0ul; iVertex < nVertexDonor; ++iVertex) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+      donorIndex.push_back(donorPoint.size());
+      donorPoint.push_back(donor_geometry->nodes->GetGlobalIndex(iPoint));
+      for (int iDim = 0; iDim < nDim; ++iDim) donorCoord.push_back(donor_geometry->nodes->GetCoord(iPoint, iDim));
+    }
+    const auto nLocalDonor = donorPoint.size();
+
+    unsigned long nGlobalVertexDonor = 0;
+    SU2_MPI::Allreduce(&nLocalDonor, &nGlobalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+    CADTPointsOnlyClass donorADT(nDim, nLocalDonor, donorCoord.data(), donorIndex.data(), false);
+
+    auto localSearch = [&](const su2double* coord, su2double* real, unsigned long* integer) {
+      if (nLocalDonor == 0) return false;
+
+      vector<su2double> dist;
+      vector<unsigned long> index;
+      vector<int> rankID;
+      donorADT.DetermineNearestNodes(coord, nPatch, dist, index, rankID);
+      const auto nFound = index.size();
+
+      /*--- Other ranks may have closer points if fewer than nPatch were found here. ---*/
+      const auto big = numeric_limits<passivedouble>::max();
+      real[0] = (nFound == nPatch) ? dist[nFound - 1] * dist[nFound - 1] : su2double(big);
+
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        auto* donor = real + 1 + iDonor * (1 + nDim);
+        donor[0] = dist[iDonor] * dist[iDonor];
+        for (int iDim = 0; iDim < nDim; ++iDim) donor[1 + iDim] = donorCoord[index[iDonor] * nDim + iDim];
+        integer[iDonor] = donorPoint[index[iDonor]];
+      }
+      integer[nPatch] = rank;
+      integer[nPatch + 1] = nFound;
+      return true;
+    };
+
+    vector<unsigned long> resultStart;
+    su2activematrix resultReal;
+    su2matrix<unsigned long> resultInt;
+    DistributedDonorSearch(markTarget, nDim, donorCoord, nReal, nInt, localSearch, resultStart, resultReal,
+                           resultInt);
+
+    /*--- Build the local RBF of each target point from the closest donors found by all ranks. ---*/
+
+    struct Candidate {
+      su2double dist2;
+      unsigned long point;
+      int proc;
+      const su2double* coord;
+    };
+
+    SU2_OMP_PARALLEL {
+      vector<Candidate> candidates;
+      su2activematrix coords;
+      su2passivematrix C_inv_trunc;
+      vector<passivedouble> funcVec, coeffs;
+
+      /*--- Thread-local variables for statistics. ---*/
+      unsigned long minDonors = 1 << 30, maxDonors = 0, totalDonors = 0, numTarget = 0;
+      passivedouble sumCorr = 0.0, maxCorr = 0.0;
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget, 2 * omp_get_max_threads()))
+      for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+        auto& targetVertex = targetVertices[markTarget][iVertexTarget];
+        const auto iPoint = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+        const su2double* targetCoord = target_geometry->nodes->GetCoord(iPoint);
+        numTarget += 1;
+
+        candidates.clear();
+        for (auto iRes = resultStart[iVertexTarget]; iRes < resultStart[iVertexTarget + 1]; ++iRes) {
+          for (auto iDonor = 0ul; iDonor < resultInt(iRes, nPatch + 1); ++iDonor) {
+            const auto* donor = resultReal[iRes] + 1 + iDonor * (1 + nDim);
+            candidates.push_back({donor[0], resultInt(iRes, iDonor), int(resultInt(iRes, nPatch)), donor + 1});
+          }
+        }
+
+        /*--- Closest points, then an MPI-independent order (see SetTransferCoeff). ---*/
+        const auto nDonor = min(nPatch, candidates.size());
+        partial_sort(candidates.begin(), candidates.begin() + nDonor, candidates.end(),
+                     [](const Candidate& a, const Candidate& b) {
+                       return (a.dist2 != b.dist2) ? (a.dist2 < b.dist2) : (a.point < b.point);
+                     });
+        sort(candidates.begin(), candidates.begin() + nDonor,
+             [](const Candidate& a, const Candidate& b) { return a.point < b.point; });
+
+        if (nDonor == 0) {
+          minDonors = 0;
+          continue;
+        }
+
+        /*--- Generator matrix of the patch. ---*/
+        coords.resize(nDonor, nDim);
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor)
+          for (int iDim = 0; iDim < nDim; ++iDim) coords(iDonor, iDim) = candidates[iDonor].coord[iDim];
+
+        int nPolynomial = -1;
+        vector<int> keepPolynomialRow(nDim, 1);
+        ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF, coords, nPolynomial, keepPolynomialRow,
+                               C_inv_trunc);
+
+        /*--- Row of functions of the target point (polynomial and RBF terms) times the generator. ---*/
+        funcVec.assign(1 + nPolynomial + nDonor, 0.0);
+        if (usePolynomial) {
+          funcVec[0] = 1.0;
+          for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+            if (!keepPolynomialRow[iDim]) continue;
+            funcVec[idx++] = SU2_TYPE::GetValue(targetCoord[iDim]);
+          }
+        }
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+          const auto dist = GeometryToolbox::Distance(nDim, targetCoord, coords[iDonor]);
+          funcVec[1 + nPolynomial + iDonor] = SU2_TYPE::GetValue(Get_RadialBasisValue(kindRBF, paramRBF, dist));
+        }
+
+        coeffs.assign(nDonor, 0.0);
+        for (auto k = 0ul; k < funcVec.size(); ++k)
+          for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) coeffs[iDonor] += funcVec[k] * C_inv_trunc(k, iDonor);
+
+        /*--- Prune small coefficients. ---*/
+        auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), nDonor, coeffs.begin());
+        auto nnz = info.first;
+        totalDonors += nnz;
+        minDonors = min(minDonors, nnz);
+        maxDonors = max(maxDonors, nnz);
+        auto corr = fabs(info.second - 1.0);
+        sumCorr += corr;
+        maxCorr = max(maxCorr, corr);
+
+        /*--- Allocate and set donor information for this target point. ---*/
+        targetVertex.resize(nnz);
+
+        for (unsigned long iDonor = 0, iSet = 0; iDonor < nDonor; ++iDonor) {
+          if (fabs(coeffs[iDonor]) > 0.0) {
+            targetVertex.processor[iSet] = candidates[iDonor].proc;
+            targetVertex.globalPoint[iSet] = candidates[iDonor].point;
+            targetVertex.coefficient[iSet] = coeffs[iDonor];
+            ++iSet;
+          }
+        }
+      }
+      END_SU2_OMP_FOR
+      SU2_OMP_CRITICAL {
+        totalTargetPoints += numTarget;
+        totalDonorPoints += totalDonors;
+        denseSize += numTarget * nGlobalVertexDonor;
+        MinDonors = min(MinDonors, minDonors);
+        MaxDonors = max(MaxDonors, maxDonors);
+        AvgCorrection += sumCorr;
+        MaxCorrection = max(MaxCorrection, maxCorr);
+      }
+      END_SU2_OMP_CRITICAL
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  ReduceStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS type, bool usePolynomial, su2double radius,
                                                   const su2activematrix& coords, int& nPolynomial,
                                                   vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -30,6 +30,8 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+#include <unordered_map>
+
 CSlidingMesh::CSlidingMesh(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
                            unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
@@ -37,6 +39,26 @@ CSlidingMesh::CSlidingMesh(CGeometry**** geometry_container, const CConfig* cons
 }
 
 void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
+  ++transferCoeffVersion;
+
+  /*--- If the relative position of the interfaces repeats after a fixed number of time steps, the coefficients
+   * of each step of the period are computed once and then reused. The first computation (from the constructor)
+   * is not cached as it may not correspond to the mesh position of a time step. The cache is not used with AD
+   * since the coefficients depend on the coordinates. ---*/
+
+  const auto periodSteps = config[targetZone]->GetSlidingInterfacePeriodSteps();
+  const bool useCache = (periodSteps > 0) && (transferCoeffVersion > 1) && config[targetZone]->GetTime_Domain() &&
+                        !config[targetZone]->GetDiscrete_Adjoint();
+  const auto periodIndex = useCache ? config[targetZone]->GetTimeIter() % periodSteps : 0ul;
+
+  if (useCache) {
+    cachedTargetVertices.resize(periodSteps);
+    if (!cachedTargetVertices[periodIndex].empty()) {
+      targetVertices = cachedTargetVertices[periodIndex];
+      return;
+    }
+  }
+
   /* 0 - Variable declaration */
 
   /* --- General variables --- */
@@ -58,7 +80,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -101,6 +123,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   su2activematrix DonorPoint_Coord;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  closestDonor.resize(config[targetZone]->GetnMarker_All());
 
   /* 1 - Variable pre-processing */
 
@@ -171,7 +194,15 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
      * - Starting from the closest donor node, it expands the supermesh by including
      * donor elements neighboring the initial one, until the overall target area is fully covered.
      */
-    if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+    if (nVertexTarget) {
+      targetVertices[markTarget].resize(nVertexTarget);
+      closestDonor[markTarget].resize(nVertexTarget, nGlobalVertex_Donor);
+    }
+
+    unordered_map<unsigned long, unsigned long> targetGlobalToGathered;
+    targetGlobalToGathered.reserve(nGlobalVertex_Target);
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      targetGlobalToGathered.emplace(Target_GlobalPoint[jVertexTarget], jVertexTarget);
 
     if (nDim == 2) {
       target_iMidEdge_point = new su2double[nDim];
@@ -194,26 +225,12 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         if (target_geometry->nodes->GetDomain(target_iPoint)) {
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-            Coord_j = DonorPoint_Coord[donor_iPoint];
+          /*--- Find the closest donor_node, starting from the one of the previous computation ---*/
 
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0) {
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex = FindClosestDonor(nDim, Coord_i, DonorPoint_Coord, Donor_nLinkedNodes,
+                                              Donor_StartLinkedNodes, Donor_LinkedNodes,
+                                              closestDonor[markTarget][iVertex]);
+          closestDonor[markTarget][iVertex] = donor_StartIndex;
 
           donor_iPoint = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
@@ -221,8 +238,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           /*--- Contruct information regarding the target cell ---*/
 
           auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if (dPoint == Target_GlobalPoint[jVertexTarget]) break;
+          jVertexTarget = targetGlobalToGathered.at(dPoint);
 
           if (Target_nLinkedNodes[jVertexTarget] == 1) {
             target_segment[0] = Target_LinkedNodes[Target_StartLinkedNodes[jVertexTarget]];
@@ -448,9 +464,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++) Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
         auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++) {
-          if (dPoint == Target_GlobalPoint[target_iPoint]) break;
-        }
+        target_iPoint = targetGlobalToGathered.at(dPoint);
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -464,26 +478,12 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
+        /*--- Find the closest donor_node, starting from the one of the previous computation ---*/
 
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-          Coord_j = DonorPoint_Coord[donor_iPoint];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0) {
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        donor_StartIndex = FindClosestDonor(nDim, Coord_i, DonorPoint_Coord, Donor_nLinkedNodes,
+                                            Donor_StartLinkedNodes, Donor_LinkedNodes,
+                                            closestDonor[markTarget][iVertex]);
+        closestDonor[markTarget][iVertex] = donor_StartIndex;
 
         donor_iPoint = donor_StartIndex;
 
@@ -687,6 +687,66 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   delete[] Donor_Vect;
   delete[] Coeff_Vect;
   delete[] storeProc;
+
+  if (useCache) cachedTargetVertices[periodIndex] = targetVertices;
+}
+
+unsigned long CSlidingMesh::FindClosestDonor(unsigned short nDim, const su2double* coord,
+                                             const su2activematrix& donorCoord,
+                                             const su2vector<unsigned long>& nLinkedNodes,
+                                             const su2vector<unsigned long>& startLinkedNodes,
+                                             const su2vector<unsigned long>& linkedNodes, unsigned long guess) {
+  const unsigned long nDonor = donorCoord.rows();
+
+  if (guess < nDonor) {
+    /*--- Walk over the donor surface, towards the neighbor closest to the target point, until no neighbor is
+     * closer. Since the interfaces only move by a fraction of an element per time step, this takes a few steps. ---*/
+
+    auto iPoint = guess;
+    auto minDist = GeometryToolbox::SquaredDistance(nDim, coord, donorCoord[iPoint]);
+    auto nextPoint = iPoint;
+
+    do {
+      iPoint = nextPoint;
+      for (auto iLink = 0ul; iLink < nLinkedNodes[iPoint]; ++iLink) {
+        const auto jPoint = linkedNodes[startLinkedNodes[iPoint] + iLink];
+        if (jPoint >= nDonor) continue;
+        const auto dist = GeometryToolbox::SquaredDistance(nDim, coord, donorCoord[jPoint]);
+        if (dist < minDist) {
+          minDist = dist;
+          nextPoint = jPoint;
+        }
+      }
+    } while (nextPoint != iPoint);
+
+    /*--- The walk may stop at a local minimum (e.g. on disconnected boundaries), the result is only accepted
+     * if the target point is within the longest edge of the donor node. ---*/
+
+    su2double maxEdge = 0.0;
+    for (auto iLink = 0ul; iLink < nLinkedNodes[iPoint]; ++iLink) {
+      const auto jPoint = linkedNodes[startLinkedNodes[iPoint] + iLink];
+      if (jPoint >= nDonor) continue;
+      maxEdge = max(maxEdge, GeometryToolbox::SquaredDistance(nDim, donorCoord[iPoint], donorCoord[jPoint]));
+    }
+    if (minDist <= maxEdge) return iPoint;
+  }
+
+  /*--- Brute force to find the closest donor_node ---*/
+
+  su2double mindist = 1E6;
+  unsigned long closest = 0;
+
+  for (auto iPoint = 0ul; iPoint < nDonor; iPoint++) {
+    const auto dist = GeometryToolbox::Distance(nDim, coord, donorCoord[iPoint]);
+
+    if (dist < mindist) {
+      mindist = dist;
+      closest = iPoint;
+    }
+
+    if (dist == 0.0) break;
+  }
+  return closest;
 }
 
 int CSlidingMesh::Build_3D_surface_element(const su2vector<unsigned long>& map,
@@ -0,0 +1,650 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the smoothed aggregation algebraic multigrid.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+namespace {
+constexpr unsigned long NOT_AGGREGATED = std::numeric_limits<unsigned long>::max();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BlockInverse(unsigned long n, const ScalarType* block,
+                                                   ScalarType* inverse) {
+  ScalarType a[MAXNVAR * MAXNVAR];
+  for (auto i = 0ul; i < n * n; ++i) a[i] = block[i];
+
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j) inverse[i * n + j] = ScalarType(i == j);
+
+  for (auto k = 0ul; k < n; ++k) {
+    /*--- Partial pivoting. ---*/
+    auto piv = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(a[i * n + k]) > fabs(a[piv * n + k])) piv = i;
+
+    if (piv != k) {
+      for (auto j = 0ul; j < n; ++j) {
+        std::swap(a[k * n + j], a[piv * n + j]);
+        std::swap(inverse[k * n + j], inverse[piv * n + j]);
+      }
+    }
+    const ScalarType inv_piv = 1 / a[k * n + k];
+
+    for (auto j = 0ul; j < n; ++j) {
+      a[k * n + j] *= inv_piv;
+      inverse[k * n + j] *= inv_piv;
+    }
+    for (auto i = 0ul; i < n; ++i) {
+      if (i == k) continue;
+      const ScalarType w = a[i * n + k];
+      for (auto j = 0ul; j < n; ++j) {
+        a[i * n + j] -= w * a[k * n + j];
+        inverse[i * n + j] -= w * inverse[k * n + j];
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeInverseDiagonal(CLevel& level) const {
+  const auto& A = level.A;
+  const auto n = level.nVar;
+  const auto blkSz = n * n;
+  level.invDiag.resize(A.nRow * blkSz);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    const ScalarType* diag = nullptr;
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      if (A.colInd[k] == iRow) {
+        diag = &A.val[k * blkSz];
+        break;
+      }
+    }
+    if (diag == nullptr) SU2_MPI::Error("Missing diagonal block in AMG level.", CURRENT_FUNCTION);
+    BlockInverse(n, diag, &level.invDiag[iRow * blkSz]);
+  }
+
+  /*--- Estimate the spectral radius of D^-1 A with a Gershgorin (inf-norm) bound. ---*/
+  ScalarType rho = 0;
+  ScalarType DinvA[MAXNVAR * MAXNVAR];
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    ScalarType rowSum[MAXNVAR] = {0};
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      if (A.colInd[k] >= A.nCol) continue;
+      for (auto i = 0ul; i < blkSz; ++i) DinvA[i] = 0;
+      BlockGemmAdd(n, n, n, &level.invDiag[iRow * blkSz], &A.val[k * blkSz], DinvA);
+      for (auto i = 0ul; i < n; ++i)
+        for (auto j = 0ul; j < n; ++j) rowSum[i] += fabs(DinvA[i * n + j]);
+    }
+    for (auto i = 0ul; i < n; ++i) rho = max(rho, rowSum[i]);
+  }
+  level.omega = 4.0 / (3.0 * max(rho, ScalarType(1)));
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeAggregates(CLevel& level) const {
+  const auto& A = level.A;
+  const auto n = level.nVar;
+  const auto blkSz = n * n;
+  auto& agg = level.aggregate;
+
+  /*--- Norm of the diagonal blocks for the strength of connection. ---*/
+  std::vector<ScalarType> diagNorm(A.nRow, 0);
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k)
+      if (A.colInd[k] == iRow) diagNorm[iRow] = BlockNorm(n, &A.val[k * blkSz]);
+
+  auto isStrong = [&](unsigned long iRow, unsigned long k) {
+    const auto jRow = A.colInd[k];
+    if (jRow == iRow || jRow >= A.nCol) return false;
+    return BlockNorm(n, &A.val[k * blkSz]) >= strength * sqrt(diagNorm[iRow] * diagNorm[jRow]);
+  };
+
+  agg.assign(A.nRow, NOT_AGGREGATED);
+  unsigned long nAgg = 0;
+
+  /*--- Phase 1: Points whose strong neighbors are all free form new aggregates (point + neighborhood). ---*/
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (agg[iRow] != NOT_AGGREGATED) continue;
+    bool free = true;
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1] && free; ++k)
+      if (isStrong(iRow, k)) free = (agg[A.colInd[k]] == NOT_AGGREGATED);
+    if (!free) continue;
+
+    agg[iRow] = nAgg;
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k)
+      if (isStrong(iRow, k)) agg[A.colInd[k]] = nAgg;
+    ++nAgg;
+  }
+
+  /*--- Phase 2: Remaining points join the aggregate of their strongest aggregated neighbor. ---*/
+  auto tmp = agg;
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (agg[iRow] != NOT_AGGREGATED) continue;
+    ScalarType maxStrength = -1;
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      if (!isStrong(iRow, k) || agg[A.colInd[k]] == NOT_AGGREGATED) continue;
+      const auto s = BlockNorm(n, &A.val[k * blkSz]);
+      if (s > maxStrength) {
+        maxStrength = s;
+        tmp[iRow] = agg[A.colInd[k]];
+      }
+    }
+  }
+  agg.swap(tmp);
+
+  /*--- Phase 3: Left over points aggregate with their free strong neighbors (or alone). ---*/
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    if (agg[iRow] != NOT_AGGREGATED) continue;
+    agg[iRow] = nAgg;
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k)
+      if (isStrong(iRow, k) && agg[A.colInd[k]] == NOT_AGGREGATED) agg[A.colInd[k]] = nAgg;
+    ++nAgg;
+  }
+
+  level.nAggregates = nAgg;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeTentativeProlongation(CLevel& level, const ScalarType* B,
+                                                                    CLevel& coarse) const {
+  const auto nRow = level.A.nRow;
+  const auto n = level.nVar;
+  const auto nAgg = level.nAggregates;
+  const auto& agg = level.aggregate;
+
+  level.T.clear();
+  coarse.B.clear();
+  coarse.nVar = n;
+  if (nModes == 0) return;
+  coarse.nVar = nModes;
+
+  /*--- Points of each aggregate. ---*/
+  std::vector<unsigned long> aggPtr(nAgg + 1, 0), aggPts(nRow);
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) ++aggPtr[agg[iRow] + 1];
+  for (auto iAgg = 0ul; iAgg < nAgg; ++iAgg) aggPtr[iAgg + 1] += aggPtr[iAgg];
+  auto pos = aggPtr;
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) aggPts[pos[agg[iRow]]++] = iRow;
+
+  level.T.assign(nRow * n * nModes, 0);
+  coarse.B.assign(nAgg * nModes * nModes, 0);
+
+  /*--- Modified Gram-Schmidt on the rows of the aggregate, Q is stored in T and R in the coarse B.
+   *    Modes that are (numerically) dependent on the previous ones, e.g. rotations of an aggregate
+   *    with a single point, get a null column in T and a null row in R. ---*/
+  std::vector<ScalarType> Q;
+
+  for (auto iAgg = 0ul; iAgg < nAgg; ++iAgg) {
+    const auto nPts = aggPtr[iAgg + 1] - aggPtr[iAgg];
+    const auto m = nPts * n;
+    Q.resize(m * nModes);
+    for (auto k = 0ul; k < nPts; ++k) {
+      const auto iRow = aggPts[aggPtr[iAgg] + k];
+      for (auto i = 0ul; i < n * nModes; ++i) Q[k * n * nModes + i] = B[iRow * n * nModes + i];
+    }
+    auto* R = &coarse.B[iAgg * nModes * nModes];
+
+    for (auto j = 0ul; j < nModes; ++j) {
+      ScalarType norm0 = 0;
+      for (auto i = 0ul; i < m; ++i) norm0 += Q[i * nModes + j] * Q[i * nModes + j];
+
+      for (auto l = 0ul; l < j; ++l) {
+        ScalarType dot = 0;
+        for (auto i = 0ul; i < m; ++i) dot += Q[i * nModes + l] * Q[i * nModes + j];
+        R[l * nModes + j] = dot;
+        for (auto i = 0ul; i < m; ++i) Q[i * nModes + j] -= dot * Q[i * nModes + l];
+      }
+      ScalarType norm = 0;
+      for (auto i = 0ul; i < m; ++i) norm += Q[i * nModes + j] * Q[i * nModes + j];
+
+      const ScalarType eps = 1e-10;
+      if (norm > eps * norm0 && norm > 0) {
+        norm = sqrt(norm);
+        R[j * nModes + j] = norm;
+        for (auto i = 0ul; i < m; ++i) Q[i * nModes + j] /= norm;
+      } else {
+        for (auto i = 0ul; i < m; ++i) Q[i * nModes + j] = 0;
+      }
+    }
+
+    for (auto k = 0ul; k < nPts; ++k) {
+      const auto iRow = aggPts[aggPtr[iAgg] + k];
+      for (auto i = 0ul; i < n * nModes; ++i) level.T[iRow * n * nModes + i] = Q[k * n * nModes + i];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeTransferOperators(CLevel& level, unsigned long nVarCoarse) const {
+  const auto& A = level.A;
+  const auto& agg = level.aggregate;
+  const auto n = level.nVar;
+  const auto nc = nVarCoarse;
+  const auto blkSz = n * n;
+  const auto blkSzP = n * nc;
+  const bool injection = level.T.empty();
+  auto& P = level.P;
+
+  const ScalarType omega = level.omega;
+  ScalarType DinvA[MAXNVAR * MAXNVAR];
+
+  /*--- P(i,J) = delta(agg(i),J) T_i - w D_i^-1 sum_{j in J} A_ij T_j, marker[J] is the position of J in row i,
+   *    with injection T is the identity. ---*/
+  std::vector<unsigned long> marker(level.nAggregates, NOT_AGGREGATED);
+
+  P.nRow = A.nRow;
+  P.nCol = level.nAggregates;
+  P.rowPtrData.assign(A.nRow + 1, 0);
+  P.colIndData.clear();
+  P.valData.clear();
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    const auto rowBegin = P.colIndData.size();
+
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      const auto jRow = A.colInd[k];
+      if (jRow >= A.nCol) continue;
+      const auto J = agg[jRow];
+
+      if (marker[J] == NOT_AGGREGATED || marker[J] < rowBegin) {
+        marker[J] = P.colIndData.size();
+        P.colIndData.push_back(J);
+        P.valData.resize(P.valData.size() + blkSzP, 0);
+      }
+      auto* p = &P.valData[marker[J] * blkSzP];
+      if (injection) {
+        BlockGemmAdd(n, n, n, &level.invDiag[iRow * blkSz], &A.val[k * blkSz], p);
+      } else {
+        for (auto i = 0ul; i < blkSz; ++i) DinvA[i] = 0;
+        BlockGemmAdd(n, n, n, &level.invDiag[iRow * blkSz], &A.val[k * blkSz], DinvA);
+        BlockGemmAdd(n, n, nc, DinvA, &level.T[jRow * blkSzP], p);
+      }
+    }
+
+    for (auto k = rowBegin; k < P.colIndData.size(); ++k) {
+      auto* p = &P.valData[k * blkSzP];
+      for (auto i = 0ul; i < blkSzP; ++i) p[i] *= -omega;
+      if (P.colIndData[k] != agg[iRow]) continue;
+      if (injection) {
+        for (auto i = 0ul; i < n; ++i) p[i * (n + 1)] += 1;
+      } else {
+        for (auto i = 0ul; i < blkSzP; ++i) p[i] += level.T[iRow * blkSzP + i];
+      }
+    }
+    P.rowPtrData[iRow + 1] = P.colIndData.size();
+  }
+  P.SetPointers();
+
+  Transpose(P, n, nc, level.R);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::MatrixMatrixProduct(const BlockCSR& A, const BlockCSR& B, unsigned long m,
+                                                          unsigned long k, unsigned long n, BlockCSR& C) {
+  const auto blkSzA = m * k, blkSzB = k * n, blkSz = m * n;
+
+  C.nRow = A.nRow;
+  C.nCol = B.nCol;
+  C.rowPtrData.assign(A.nRow + 1, 0);
+  C.colIndData.clear();
+  C.valData.clear();
+
+  std::vector<unsigned long> marker(B.nCol, NOT_AGGREGATED), rowCols;
+  std::vector<ScalarType> rowVals;
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    rowCols.clear();
+    rowVals.clear();
+
+    for (auto kk = A.rowPtr[iRow]; kk < A.rowPtr[iRow + 1]; ++kk) {
+      const auto kRow = A.colInd[kk];
+      if (kRow >= A.nCol) continue;
+
+      for (auto l = B.rowPtr[kRow]; l < B.rowPtr[kRow + 1]; ++l) {
+        const auto jCol = B.colInd[l];
+        if (jCol >= B.nCol) continue;
+
+        if (marker[jCol] == NOT_AGGREGATED) {
+          marker[jCol] = rowCols.size();
+          rowCols.push_back(jCol);
+          rowVals.resize(rowVals.size() + blkSz, 0);
+        }
+        BlockGemmAdd(m, k, n, &A.val[kk * blkSzA], &B.val[l * blkSzB], &rowVals[marker[jCol] * blkSz]);
+      }
+    }
+
+    /*--- Store the row with sorted column indices. ---*/
+    auto sorted = rowCols;
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto jCol : sorted) {
+      C.colIndData.push_back(jCol);
+      const auto* src = &rowVals[marker[jCol] * blkSz];
+      C.valData.insert(C.valData.end(), src, src + blkSz);
+    }
+    for (const auto jCol : rowCols) marker[jCol] = NOT_AGGREGATED;
+
+    C.rowPtrData[iRow + 1] = C.colIndData.size();
+  }
+  C.SetPointers();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Transpose(const BlockCSR& A, unsigned long m, unsigned long n, BlockCSR& At) {
+  const auto blkSz = m * n;
+
+  At.nRow = A.nCol;
+  At.nCol = A.nRow;
+  At.rowPtrData.assign(A.nCol + 1, 0);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k)
+      if (A.colInd[k] < A.nCol) ++At.rowPtrData[A.colInd[k] + 1];
+
+  for (auto iRow = 0ul; iRow < A.nCol; ++iRow) At.rowPtrData[iRow + 1] += At.rowPtrData[iRow];
+
+  At.colIndData.resize(At.rowPtrData.back());
+  At.valData.resize(At.rowPtrData.back() * blkSz);
+
+  auto pos = At.rowPtrData;
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      const auto jCol = A.colInd[k];
+      if (jCol >= A.nCol) continue;
+      const auto dst = pos[jCol]++;
+      At.colIndData[dst] = iRow;
+      for (auto i = 0ul; i < m; ++i)
+        for (auto j = 0ul; j < n; ++j) At.valData[dst * blkSz + j * m + i] = A.val[k * blkSz + i * n + j];
+    }
+  }
+  At.SetPointers();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::FactorizeCoarsest() {
+  const auto& A = levels.back().A;
+  const auto nv = levels.back().nVar;
+  const auto n = A.nRow * nv;
+
+  coarseLU.clear();
+  coarsePivot.clear();
+  if (n > MAX_DENSE_SIZE) return;
+
+  coarseLU.assign(n * n, 0);
+  coarsePivot.resize(n);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      const auto jCol = A.colInd[k];
+      for (auto i = 0ul; i < nv; ++i)
+        for (auto j = 0ul; j < nv; ++j) coarseLU[(iRow * nv + i) * n + jCol * nv + j] = A.val[(k * nv + i) * nv + j];
+    }
+  }
+
+  /*--- LU with partial pivoting, in place. ---*/
+  for (auto k = 0ul; k < n; ++k) {
+    auto piv = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(coarseLU[i * n + k]) > fabs(coarseLU[piv * n + k])) piv = i;
+    coarsePivot[k] = piv;
+    if (piv != k)
+      for (auto j = 0ul; j < n; ++j) std::swap(coarseLU[k * n + j], coarseLU[piv * n + j]);
+
+    const ScalarType inv_piv = 1 / coarseLU[k * n + k];
+    for (auto i = k + 1; i < n; ++i) {
+      const ScalarType w = (coarseLU[i * n + k] *= inv_piv);
+      for (auto j = k + 1; j < n; ++j) coarseLU[i * n + j] -= w * coarseLU[k * n + j];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(unsigned long nvar, unsigned long nPointDomain,
+                                            const su2localindex* row_ptr, const su2localindex* col_ind,
+                                            const ScalarType* values) {
+  if (nvar > MAXNVAR || nModes > MAXNVAR)
+    SU2_MPI::Error("nVar or number of modes larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+  if (nModes != 0 && nullSpace.size() != nPointDomain * nvar * nModes)
+    SU2_MPI::Error("The near null space of the AMG does not match the matrix.", CURRENT_FUNCTION);
+  nVar = nvar;
+
+  if (!aggregatesReady) levels.clear();
+  if (levels.empty()) {
+    /*--- The fine level holds views of the transfer operators, avoid reallocation. ---*/
+    levels.reserve(maxLevels);
+    levels.resize(1);
+  }
+
+  /*--- The fine level is a view of the fine matrix. ---*/
+  levels[0].nVar = nVar;
+  auto& fine = levels[0].A;
+  fine.nRow = fine.nCol = nPointDomain;
+  fine.rowPtr = row_ptr;
+  fine.colInd = col_ind;
+  fine.val = values;
+
+  const unsigned long MinCoarseSize = 64;
+
+  for (auto iLevel = 0ul; iLevel + 1 < maxLevels; ++iLevel) {
+    auto& level = levels[iLevel];
+    ComputeInverseDiagonal(level);
+
+    if (!aggregatesReady) {
+      if (level.A.nRow <= MinCoarseSize) break;
+      ComputeAggregates(level);
+      /*--- Stop if the coarsening stagnates (in terms of variables, the modes may outnumber them). ---*/
+      const auto nVarCoarse = (nModes != 0) ? nModes : level.nVar;
+      if (level.nAggregates == 0 || 10 * level.nAggregates * nVarCoarse > 9 * level.A.nRow * level.nVar) {
+        level.aggregate.clear();
+        break;
+      }
+      /*--- The tentative prolongation only depends on the aggregates and on the near null space. ---*/
+      levels.emplace_back();
+      ComputeTentativeProlongation(level, (iLevel == 0) ? nullSpace.data() : level.B.data(), levels.back());
+    } else if (level.aggregate.empty()) {
+      break;
+    }
+    auto& coarse = levels[iLevel + 1];
+
+    ComputeTransferOperators(level, coarse.nVar);
+
+    /*--- Galerkin coarse operator, Ac = R A P. ---*/
+    BlockCSR AP;
+    MatrixMatrixProduct(level.A, level.P, level.nVar, level.nVar, coarse.nVar, AP);
+    MatrixMatrixProduct(level.R, AP, coarse.nVar, level.nVar, coarse.nVar, coarse.A);
+
+    /*--- Modes that were dropped from an aggregate leave null rows and columns, which are decoupled
+     *    with a unit diagonal (their right hand side is also null). ---*/
+    if (!level.T.empty()) {
+      const auto nc = coarse.nVar;
+      auto& Ac = coarse.A;
+      for (auto iRow = 0ul; iRow < Ac.nRow; ++iRow)
+        for (auto k = Ac.rowPtr[iRow]; k < Ac.rowPtr[iRow + 1]; ++k)
+          if (Ac.colInd[k] == iRow)
+            for (auto i = 0ul; i < nc; ++i)
+              if (Ac.valData[(k * nc + i) * nc + i] == ScalarType(0)) Ac.valData[(k * nc + i) * nc + i] = 1;
+    }
+  }
+  ComputeInverseDiagonal(levels.back());
+  aggregatesReady = true;
+
+  for (auto& level : levels) {
+    const auto n = level.A.nRow * level.nVar;
+    level.x.resize(n);
+    level.b.resize(n);
+    level.r.resize(n);
+  }
+
+  FactorizeCoarsest();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(const CLevel& level) const {
+  const auto& A = level.A;
+  const auto n = level.nVar;
+  const auto blkSz = n * n;
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    auto* r = &level.r[iRow * n];
+    for (auto i = 0ul; i < n; ++i) r[i] = level.b[iRow * n + i];
+    for (auto k = A.rowPtr[iRow]; k < A.rowPtr[iRow + 1]; ++k) {
+      const auto jCol = A.colInd[k];
+      if (jCol < A.nCol) BlockGemvSub(n, n, &A.val[k * blkSz], &level.x[jCol * n], r);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CLevel& level, unsigned long nSweep, bool zeroGuess) const {
+  const auto nRow = level.A.nRow;
+  const auto n = level.nVar;
+  const auto blkSz = n * n;
+  /*--- The relaxation is limited for stiff (e.g. anisotropic elasticity) operators. ---*/
+  const ScalarType relax = min(smoothRelax, level.omega);
+
+  for (auto iSweep = 0ul; iSweep < nSweep; ++iSweep) {
+    const bool first = zeroGuess && (iSweep == 0);
+    if (!first) Residual(level);
+
+    const auto& res = first ? level.b : level.r;
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+      ScalarType dx[MAXNVAR];
+      BlockGemv(n, n, &level.invDiag[iRow * blkSz], &res[iRow * n], dx);
+      for (auto i = 0ul; i < n; ++i) {
+        auto& x = level.x[iRow * n + i];
+        x = (first ? ScalarType(0) : x) + relax * dx[i];
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SolveCoarsest(const CLevel& level) const {
+  if (coarseLU.empty()) {
+    Smooth(level, 4 * nSmooth, true);
+    return;
+  }
+
+  const auto n = level.A.nRow * level.nVar;
+
+  SU2_OMP_MASTER {
+    auto& x = level.x;
+    for (auto i = 0ul; i < n; ++i) x[i] = level.b[i];
+
+    for (auto k = 0ul; k < n; ++k)
+      if (coarsePivot[k] != k) std::swap(x[k], x[coarsePivot[k]]);
+
+    for (auto i = 1ul; i < n; ++i)
+      for (auto j = 0ul; j < i; ++j) x[i] -= coarseLU[i * n + j] * x[j];
+
+    for (auto i = n; i > 0;) {
+      --i;
+      for (auto j = i + 1; j < n; ++j) x[i] -= coarseLU[i * n + j] * x[j];
+      x[i] /= coarseLU[i * n + i];
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle() const {
+  const auto nLevel = levels.size();
+
+  /*--- Down the V, pre-smoothing and restriction of the residual. ---*/
+
+  for (auto iLevel = 0ul; iLevel + 1 < nLevel; ++iLevel) {
+    const auto& level = levels[iLevel];
+    const auto& coarse = levels[iLevel + 1];
+    const auto n = level.nVar, nc = coarse.nVar;
+
+    Smooth(level, nSmooth, true);
+    Residual(level);
+
+    const auto& R = level.R;
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iRow = 0ul; iRow < R.nRow; ++iRow) {
+      auto* b = &coarse.b[iRow * nc];
+      for (auto i = 0ul; i < nc; ++i) b[i] = 0;
+      for (auto k = R.rowPtr[iRow]; k < R.rowPtr[iRow + 1]; ++k) {
+        ScalarType tmp[MAXNVAR];
+        BlockGemv(nc, n, &R.val[k * nc * n], &level.r[R.colInd[k] * n], tmp);
+        for (auto i = 0ul; i < nc; ++i) b[i] += tmp[i];
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  SolveCoarsest(levels.back());
+
+  /*--- Up the V, prolongation of the correction and post-smoothing. ---*/
+
+  for (auto iLevel = nLevel - 1; iLevel > 0; --iLevel) {
+    const auto& level = levels[iLevel - 1];
+    const auto& coarse = levels[iLevel];
+    const auto n = level.nVar, nc = coarse.nVar;
+
+    const auto& P = level.P;
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iRow = 0ul; iRow < P.nRow; ++iRow) {
+      auto* x = &level.x[iRow * n];
+      for (auto k = P.rowPtr[iRow]; k < P.rowPtr[iRow + 1]; ++k) {
+        ScalarType tmp[MAXNVAR];
+        BlockGemv(n, nc, &P.val[k * n * nc], &coarse.x[P.colInd[k] * nc], tmp);
+        for (auto i = 0ul; i < n; ++i) x[i] += tmp[i];
+      }
+    }
+    END_SU2_OMP_FOR
+
+    Smooth(level, nSmooth, false);
+  }
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+template class CAlgebraicMultigrid<su2singlefloat>;
+#endif
+#endif
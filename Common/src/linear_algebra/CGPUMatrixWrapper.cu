@@ -0,0 +1,172 @@
+/*!
+ * \file CGPUMatrixWrapper.cu
+ * \brief CUDA kernels and device memory management of CGPUMatrixWrapper.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HAVE_CUDA
+#define HAVE_CUDA
+#endif
+
+#include "../../include/linear_algebra/CGPUMatrixWrapper.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <cuda_runtime.h>
+#include <string>
+
+namespace {
+
+constexpr unsigned int BLOCK_SIZE = 256;
+
+inline void checkCuda(cudaError_t err, const char* func) {
+  if (err != cudaSuccess) SU2_MPI::Error(std::string("CUDA error: ") + cudaGetErrorString(err), func);
+}
+
+inline unsigned int numBlocks(unsigned long n) { return static_cast<unsigned int>((n + BLOCK_SIZE - 1) / BLOCK_SIZE); }
+
+template <class T>
+void allocAndCopy(T*& dst, const T* src, unsigned long n, const char* func) {
+  checkCuda(cudaMalloc(reinterpret_cast<void**>(&dst), n * sizeof(T)), func);
+  if (src) checkCuda(cudaMemcpy(dst, src, n * sizeof(T), cudaMemcpyHostToDevice), func);
+}
+
+template <class T>
+void release(T*& ptr) {
+  if (ptr) cudaFree(ptr);
+  ptr = nullptr;
+}
+
+/*!
+ * \brief Block-CSR product, one thread per scalar row (row of a block row).
+ */
+template <class T>
+__global__ void bsrProductKernel(unsigned long nPointDomain, unsigned long nVar, unsigned long nEqn,
+                                 const su2localindex* rowPtr, const su2localindex* colInd, const T* values,
+                                 const T* vec, T* prod) {
+  const unsigned long i = blockIdx.x * static_cast<unsigned long>(blockDim.x) + threadIdx.x;
+  if (i >= nPointDomain * nVar) return;
+
+  const auto iPoint = i / nVar;
+  const auto iVar = i % nVar;
+
+  T sum = 0;
+  for (auto k = rowPtr[iPoint]; k < rowPtr[iPoint + 1]; ++k) {
+    const T* block = values + (k * nVar + iVar) * nEqn;
+    const T* x = vec + colInd[k] * nEqn;
+    for (unsigned long jVar = 0; jVar < nEqn; ++jVar) sum += block[jVar] * x[jVar];
+  }
+  prod[i] = sum;
+}
+
+/*!
+ * \brief Block-diagonal product, one thread per scalar row.
+ */
+template <class T>
+__global__ void blockDiagProductKernel(unsigned long nPointDomain, unsigned long nVar, const T* invDiag,
+                                       const T* vec, T* prod) {
+  const unsigned long i = blockIdx.x * static_cast<unsigned long>(blockDim.x) + threadIdx.x;
+  if (i >= nPointDomain * nVar) return;
+
+  const auto iPoint = i / nVar;
+  const auto iVar = i % nVar;
+
+  const T* block = invDiag + (iPoint * nVar + iVar) * nVar;
+  const T* x = vec + iPoint * nVar;
+  T sum = 0;
+  for (unsigned long jVar = 0; jVar < nVar; ++jVar) sum += block[jVar] * x[jVar];
+  prod[i] = sum;
+}
+
+}  // namespace
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::Clean() {
+  release(d_rowPtr);
+  release(d_colInd);
+  release(d_values);
+  release(d_invDiag);
+  release(d_vec);
+  release(d_prod);
+}
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::Initialize(unsigned long npoint, unsigned long npointdomain, unsigned long nvar,
+                                               unsigned long neqn, const su2localindex* rowPtr,
+                                               const su2localindex* colInd) {
+  Clean();
+
+  nPoint = npoint;
+  nPointDomain = npointdomain;
+  nVar = nvar;
+  nEqn = neqn;
+  nnz = rowPtr[nPointDomain];
+
+  allocAndCopy(d_rowPtr, rowPtr, nPointDomain + 1, CURRENT_FUNCTION);
+  allocAndCopy(d_colInd, colInd, nnz, CURRENT_FUNCTION);
+  allocAndCopy(d_values, static_cast<const ScalarType*>(nullptr), nnz * nVar * nEqn, CURRENT_FUNCTION);
+  allocAndCopy(d_vec, static_cast<const ScalarType*>(nullptr), nPoint * nEqn, CURRENT_FUNCTION);
+  allocAndCopy(d_prod, static_cast<const ScalarType*>(nullptr), nPointDomain * nVar, CURRENT_FUNCTION);
+}
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::SetValues(const ScalarType* values) {
+  checkCuda(cudaMemcpy(d_values, values, nnz * nVar * nEqn * sizeof(ScalarType), cudaMemcpyHostToDevice),
+            CURRENT_FUNCTION);
+}
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::SetInvDiagonal(const ScalarType* invDiag) {
+  const auto size = nPointDomain * nVar * nVar;
+  if (!d_invDiag) allocAndCopy(d_invDiag, static_cast<const ScalarType*>(nullptr), size, CURRENT_FUNCTION);
+  checkCuda(cudaMemcpy(d_invDiag, invDiag, size * sizeof(ScalarType), cudaMemcpyHostToDevice), CURRENT_FUNCTION);
+}
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::MatrixVectorProduct(const ScalarType* vec, ScalarType* prod) const {
+  checkCuda(cudaMemcpy(d_vec, vec, nPoint * nEqn * sizeof(ScalarType), cudaMemcpyHostToDevice), CURRENT_FUNCTION);
+
+  bsrProductKernel<<<numBlocks(nPointDomain * nVar), BLOCK_SIZE>>>(nPointDomain, nVar, nEqn, d_rowPtr, d_colInd,
+                                                                   d_values, d_vec, d_prod);
+  checkCuda(cudaGetLastError(), CURRENT_FUNCTION);
+
+  checkCuda(cudaMemcpy(prod, d_prod, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyDeviceToHost),
+            CURRENT_FUNCTION);
+}
+
+template <class ScalarType>
+void CGPUMatrixWrapper<ScalarType>::JacobiProduct(const ScalarType* vec, ScalarType* prod) const {
+  checkCuda(cudaMemcpy(d_vec, vec, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyHostToDevice),
+            CURRENT_FUNCTION);
+
+  blockDiagProductKernel<<<numBlocks(nPointDomain * nVar), BLOCK_SIZE>>>(nPointDomain, nVar, d_invDiag, d_vec,
+                                                                         d_prod);
+  checkCuda(cudaGetLastError(), CURRENT_FUNCTION);
+
+  checkCuda(cudaMemcpy(prod, d_prod, nPointDomain * nVar * sizeof(ScalarType), cudaMemcpyDeviceToHost),
+            CURRENT_FUNCTION);
+}
+
+/*--- Explicit instantiations, the CUDA backend is only available for passive types. ---*/
+template class CGPUMatrixWrapper<float>;
+template class CGPUMatrixWrapper<double>;
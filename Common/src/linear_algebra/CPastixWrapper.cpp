@@ -42,6 +42,23 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
 
   if (isinitialized) return;  // only need to do this once
 
+  /*--- Ranks that factorize the same block of the matrix, the entire matrix or a block-Jacobi approximation. ---*/
+
+#ifdef HAVE_MPI
+  switch (config->GetPastixBlocks()) {
+    case PASTIX_BLOCKS::GLOBAL:
+      comm = SU2_MPI::GetComm();
+      break;
+    case PASTIX_BLOCKS::RANK:
+      comm = MPI_COMM_SELF;
+      break;
+    case PASTIX_BLOCKS::NODE:
+      if (!owncomm) MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, mpi_rank, MPI_INFO_NULL, &comm);
+      owncomm = true;
+      break;
+  }
+#endif
+
   unsigned long nVar = matrix.nVar, nPoint = matrix.nPoint, nPointDomain = matrix.nPointDomain;
   const unsigned long *row_ptr = matrix.rowptr, *col_ind = matrix.colidx;
 
@@ -53,7 +70,8 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
   colptr.resize(nPointDomain + 1);
   rowidx.clear();
   rowidx.reserve(nNonZero);
-  values.resize(nNonZero * nVar * nVar);
+  sort_rows.clear();
+  sort_order.clear();
   loc2glb.resize(nPointDomain);
   perm.resize(nPointDomain);
   workvec.resize(nPointDomain * nVar);
@@ -105,20 +123,30 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
      indices in Fortran-style numbering (start at 1), effectively the matrix is copied.
      Here we prepare the pointer and index part, and map the required swaps. ---*/
 
-    /*--- 1 - Determine position in the linear partitioning ---*/
+    /*--- 1 - Determine position in the linear partitioning (of the ranks of the block) ---*/
 
 #ifdef HAVE_MPI
-  vector<unsigned long> domain_sizes(mpi_size);
-  MPI_Allgather(&nPointDomain, 1, MPI_UNSIGNED_LONG, domain_sizes.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-  for (int i = 0; i < mpi_rank; ++i) offset += domain_sizes[i];
+  int comm_size = 1, comm_rank = 0;
+  MPI_Comm_size(comm, &comm_size);
+  MPI_Comm_rank(comm, &comm_rank);
+
+  vector<unsigned long> domain_sizes(comm_size);
+  MPI_Allgather(&nPointDomain, 1, MPI_UNSIGNED_LONG, domain_sizes.data(), 1, MPI_UNSIGNED_LONG, comm);
+  for (int i = 0; i < comm_rank; ++i) offset += domain_sizes[i];
+
+  /*--- The blocks are identified by their lowest rank, halo points of other blocks are not coupled. ---*/
+  int group = 0;
+  MPI_Allreduce(&mpi_rank, &group, 1, MPI_INT, MPI_MIN, comm);
+  vector<int> groups(mpi_size);
+  MPI_Allgather(&group, 1, MPI_INT, groups.data(), 1, MPI_INT, SU2_MPI::GetComm());
 #endif
 
   iota(loc2glb.begin(), loc2glb.end(), offset + 1);
 
   /*--- 2 - Communicate global indices of halo points to then renumber
-   column indices from local to global when unpacking halos. ---*/
+   column indices from local to global when unpacking halos (-1 for halos of other blocks). ---*/
 
-  vector<pastix_int_t> map(nPoint - nPointDomain, 0);
+  vector<pastix_int_t> map(nPoint - nPointDomain, -1);
 
 #ifdef HAVE_MPI
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -143,8 +171,9 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
                    MPI_UNSIGNED_LONG, recver, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
 
       /*--- Store received data---*/
+      if (groups[recver] != group) continue;
       for (unsigned long iVertex = 0; iVertex < nVertexR; iVertex++)
-        map[geometry->vertex[MarkerR][iVertex]->GetNode() - nPointDomain] = Buffer_Recv[iVertex];
+        map[geometry->vertex[MarkerR][iVertex]->GetNode() - nPointDomain] = pastix_int_t(Buffer_Recv[iVertex]);
     }
   }
 #endif
@@ -152,7 +181,7 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
   /*--- 3 - Copy, map the sparsity, and put it in Fortran numbering ---*/
 
   for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
-    colptr[iPoint] = pastix_int_t(row_ptr[iPoint] + 1);
+    colptr[iPoint] = pastix_int_t(rowidx.size() + 1);
 
     unsigned long begin = row_ptr[iPoint], end = row_ptr[iPoint + 1], j;
 
@@ -160,25 +189,24 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
     bool sort_required = (col_ind[end - 1] >= nPointDomain);
 
     if (sort_required) {
-      unsigned long nnz_row = end - begin;
-
-      sort_rows.push_back(iPoint);
-      sort_order.push_back(vector<unsigned long>(nnz_row));
-
       /*--- Sort mapped indices ("first") and keep track of source ("second")
             for when we later need to swap blocks for these rows. ---*/
 
-      vector<pair<pastix_int_t, unsigned long> > aux(nnz_row);
+      vector<pair<pastix_int_t, unsigned long> > aux;
+      aux.reserve(end - begin);
 
       for (j = begin; j < end; ++j) {
         if (col_ind[j] < nPointDomain)
-          aux[j - begin].first = pastix_int_t(offset + col_ind[j] + 1);
-        else
-          aux[j - begin].first = pastix_int_t(map[col_ind[j] - nPointDomain] + 1);
-        aux[j - begin].second = j;
+          aux.emplace_back(pastix_int_t(offset + col_ind[j] + 1), j);
+        else if (map[col_ind[j] - nPointDomain] >= 0)
+          aux.emplace_back(map[col_ind[j] - nPointDomain] + 1, j);
       }
       sort(aux.begin(), aux.end());
 
+      const unsigned long nnz_row = aux.size();
+      sort_rows.push_back(iPoint);
+      sort_order.push_back(vector<unsigned long>(nnz_row));
+
       for (j = 0; j < nnz_row; ++j) {
         rowidx.push_back(aux[j].first);
         sort_order.back()[j] = aux[j].second;
@@ -188,9 +216,11 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig*
       for (j = begin; j < end; ++j) rowidx.push_back(pastix_int_t(offset + col_ind[j] + 1));
     }
   }
-  colptr[nPointDomain] = pastix_int_t(nNonZero + 1);
+  colptr[nPointDomain] = pastix_int_t(rowidx.size() + 1);
+
+  if (rowidx.size() > nNonZero) SU2_MPI::Error("Error during preparation of PaStiX data", CURRENT_FUNCTION);
 
-  if (rowidx.size() != nNonZero) SU2_MPI::Error("Error during preparation of PaStiX data", CURRENT_FUNCTION);
+  values.resize(rowidx.size() * nVar * nVar);
 
   /*--- 4 - Perform ordering, symbolic factorization, and analysis steps ---*/
 
@@ -260,21 +290,22 @@ void CPastixWrapper<ScalarType>::Factorize(CGeometry* geometry, const CConfig* c
     cout << " +--------------------------------------------------------------------+" << endl;
   }
 
-  unsigned long i, j, k, iRow, begin, target, source, szBlk = matrix.nVar * matrix.nVar, nNonZero = values.size();
+  unsigned long i = 0, j, k, iRow, target, source, szBlk = matrix.nVar * matrix.nVar;
 
-  /*--- Copy matrix values and swap blocks as required ---*/
+  /*--- Copy matrix values, swap and drop (halo) blocks as required ---*/
 
-  for (i = 0; i < nNonZero; ++i) values[i] = SU2_TYPE::GetValue(matrix.values[i]);
+  for (iRow = 0; iRow < matrix.nPointDomain; ++iRow) {
+    target = (colptr[iRow] - 1) * szBlk;
 
-  for (i = 0; i < sort_rows.size(); ++i) {
-    iRow = sort_rows[i];
-    begin = matrix.rowptr[iRow];
-
-    for (j = 0; j < sort_order[i].size(); ++j) {
-      target = (begin + j) * szBlk;
-      source = sort_order[i][j] * szBlk;
-
-      for (k = 0; k < szBlk; ++k) values[target + k] = SU2_TYPE::GetValue(matrix.values[source + k]);
+    if (i < sort_rows.size() && sort_rows[i] == iRow) {
+      for (j = 0; j < sort_order[i].size(); ++j) {
+        source = sort_order[i][j] * szBlk;
+        for (k = 0; k < szBlk; ++k) values[target++] = SU2_TYPE::GetValue(matrix.values[source + k]);
+      }
+      ++i;
+    } else {
+      for (k = matrix.rowptr[iRow] * szBlk; k < matrix.rowptr[iRow + 1] * szBlk; ++k)
+        values[target++] = SU2_TYPE::GetValue(matrix.values[k]);
     }
   }
 
@@ -316,5 +347,8 @@ template class CPastixWrapper<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CPastixWrapper<passivedouble>;
 #endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+template class CPastixWrapper<su2singlefloat>;
+#endif
 #endif
 #endif
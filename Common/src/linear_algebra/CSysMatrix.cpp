@@ -29,8 +29,14 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CPhaseTimers.hpp"
+#include "../../include/toolboxes/CKernelCounters.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <cmath>
+#include <limits>
+#include <unordered_map>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
@@ -67,6 +73,11 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(sell.val);
+  MemoryAllocation::aligned_free(sell.invDiag);
+  MemoryAllocation::aligned_free(edge_fmt.dia);
+  MemoryAllocation::aligned_free(edge_fmt.val);
+  MemoryAllocation::aligned_free(edge_fmt.pivot);
 
 #ifdef USE_MKL
   mkl_jit_destroy(MatrixMatrixProductJitter);
@@ -79,7 +90,8 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npointdomain, unsigned short nvar,
                                         unsigned short neqn, bool EdgeConnect, CGeometry* geometry,
-                                        const CConfig* config, bool needTranspPtr, bool grad_mode) {
+                                        const CConfig* config, bool needTranspPtr, bool grad_mode,
+                                        bool assemblyOnly) {
   assert(omp_get_thread_num() == 0 && "Only the master thread is allowed to initialize the matrix.");
 
   if (npoint == 0) return;
@@ -95,25 +107,29 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   /*--- Application of this matrix, FVM or FEM. ---*/
   const auto type = EdgeConnect ? ConnectivityType::FiniteVolume : ConnectivityType::FiniteElement;
 
-  /*--- Type of preconditioner the matrix will be asked to build. ---*/
+  /*--- Type of preconditioner the matrix will be asked to build, and of the linear solver. ---*/
   auto prec = config->GetKind_Linear_Solver_Prec();
+  auto solver = config->GetKind_Linear_Solver();
 
   if ((!EdgeConnect && !config->GetStructuralProblem()) || (config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) ||
       (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT)) {
     /*--- FEM-type connectivity in non-structural context implies mesh deformation. ---*/
     prec = config->GetKind_Deform_Linear_Solver_Prec();
+    solver = config->GetKind_Deform_Linear_Solver();
   } else if (config->GetDiscrete_Adjoint() && (prec != ILU)) {
     /*--- Else "upgrade" primal solver settings. ---*/
     prec = config->GetKind_DiscAdj_Linear_Prec();
+    solver = config->GetKind_DiscAdj_Linear_Solver();
   }
 
   /*--- No else if, but separat if case! ---*/
   if (config->GetSmoothGradient() && grad_mode) {
     prec = config->GetKind_Grad_Linear_Solver_Prec();
+    solver = config->GetKind_Grad_Linear_Solver();
   }
 
-  const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  const bool ilu_needed = !assemblyOnly && (prec == ILU);
+  const bool diag_needed = !assemblyOnly && (ilu_needed || (prec == JACOBI) || (prec == LINELET));
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -121,6 +137,12 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- FEM-type systems with one variable per dimension are elasticity systems. ---*/
+  if (!assemblyOnly && (prec == AMG) && (type == ConnectivityType::FiniteElement) && !grad_mode &&
+      (nVar == geometry->GetnDim()) && (nEqn == nVar) && config->GetLinear_Solver_AMG_RigidBodyModes()) {
+    SetAMGRigidBodyModes(geometry);
+  }
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -149,11 +171,17 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    ilu_levels.enabled = config->GetLinear_Solver_ILU_Level_Scheduling();
+    if (ilu_levels.enabled) BuildILULevels();
   }
 
-  /*--- Allocate data. ---*/
+  /*--- Allocate data, zeroed by all threads in contiguous parts as in SetValZero, which roughly
+   * correspond to the row partitions of the products and preconditioners (NUMA first touch). ---*/
   auto allocAndInit = [](ScalarType*& ptr, unsigned long num) {
-    ptr = MemoryAllocation::aligned_alloc<ScalarType, true>(64, num * sizeof(ScalarType));
+    SU2_MEMORY_SCOPE(SPARSE_MATRIX);
+    ptr = MemoryAllocation::aligned_alloc<ScalarType>(64, num * sizeof(ScalarType));
+    firstTouchZero(num, ptr, roundUpDiv(num, omp_get_max_threads()));
   };
 
   allocAndInit(matrix, nnz * nVar * nEqn);
@@ -162,7 +190,31 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
 
-  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+  /*--- Restricted additive Schwarz, not for AD types (the exchanges and the coarse system are passive). ---*/
+
+  const bool schwarzPossible = ilu_needed && (size > 1) && std::is_arithmetic<ScalarType>::value;
+  schwarz.enabled = schwarzPossible && (config->GetLinear_Solver_Schwarz_Overlap() > 0);
+  schwarz.coarse = schwarzPossible && config->GetLinear_Solver_Schwarz_Coarse() && (nVar == nEqn);
+  if (schwarz.coarse && size * nVar > MAX_COARSE_SIZE) {
+    schwarz.coarse = false;
+    if (rank == MASTER_NODE)
+      cout << "WARNING: The coarse correction of the ILU preconditioner is disabled, the coarse system would be too "
+              "large (number of ranks x number of variables > " << MAX_COARSE_SIZE << ")." << endl;
+  }
+
+  /*--- With overlap the halo rows are also factorized. ---*/
+  if (diag_needed) allocAndInit(invM, (schwarz.enabled ? nPoint : nPointDomain) * nVar * nEqn);
+
+  /*--- Vectorized copy of the matrix, not for AD types since the padding would only make the tape larger. ---*/
+
+  sell.enabled = !assemblyOnly && (config->GetKind_Matrix_Format() == MATRIX_FORMAT::SELL) &&
+                 std::is_arithmetic<ScalarType>::value;
+
+  if (sell.enabled) {
+    BuildSELLPattern();
+    allocAndInit(sell.val, sell.srcIdx.size() * nVar * nEqn);
+    if (prec == JACOBI && nVar == nEqn) allocAndInit(sell.invDiag, sell.nSlice * SELL_C * nVar * nEqn);
+  }
 
   /*--- Thread parallel initialization. ---*/
 
@@ -202,6 +254,31 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     }
   }
 
+  if (schwarz.enabled || schwarz.coarse) SetupSchwarz(geometry, config);
+
+  /*--- Edge-based copy of the matrix, it depends on the thread partitions. As for SELL, not for AD types.
+   * The symmetric flavor is used for CG, if requested via the format or needed by the IC preconditioner. ---*/
+
+  const auto format = config->GetKind_Matrix_Format();
+  const bool symmetric = (solver == CONJUGATE_GRADIENT) && (prec == IC || format == MATRIX_FORMAT::SYMMETRIC);
+
+  edge_fmt.enabled = !assemblyOnly && (format == MATRIX_FORMAT::EDGE || symmetric) && (nVar == nEqn) &&
+                     std::is_arithmetic<ScalarType>::value;
+  edge_fmt.symmetric = edge_fmt.enabled && symmetric;
+
+  if (edge_fmt.enabled) {
+    BuildEdgePattern();
+    allocAndInit(edge_fmt.dia, nPointDomain * nVar * nEqn);
+    allocAndInit(edge_fmt.val, (edge_fmt.symmetric ? 1 : 2) * edge_fmt.col.size() * nVar * nEqn);
+  }
+  if (edge_fmt.symmetric) {
+    edge_fmt.mask.resize(nPointDomain * nVar);
+    if (prec == IC) {
+      allocAndInit(edge_fmt.pivot, nPointDomain * nVar * nEqn);
+      edge_fmt.work.resize(nPointDomain * nVar);
+    }
+  }
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -228,6 +305,7 @@ template <class T>
 void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, const CConfig* config,
                                unsigned short commType) {
   if (geometry->nP2PSend == 0) return;
+  SU2_PHASE_TIMER(HALO_COMMS);
 
   /*--- Local variables ---*/
 
@@ -343,6 +421,7 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
 template <class T>
 void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CConfig* config, unsigned short commType) {
   if (geometry->nP2PRecv == 0) return;
+  SU2_PHASE_TIMER(HALO_COMMS);
 
   /*--- Local variables ---*/
 
@@ -437,30 +516,976 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
         END_SU2_OMP_FOR
         break;
       }
-
-      default:
-        SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.", CURRENT_FUNCTION);
-        break;
+
+      default:
+        SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+
+  /*--- Verify that all non-blocking point-to-point sends have finished.
+   Note that this should be satisfied, as we have received all of the
+   data in the loop above at this point. ---*/
+
+#ifdef HAVE_MPI
+  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
+#endif
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetValZero() {
+  const auto size = nnz * nVar * nEqn;
+  const auto chunk = roundUpDiv(size, omp_get_num_threads());
+  const auto begin = chunk * omp_get_thread_num();
+  const auto mySize = min(chunk, size - begin) * sizeof(ScalarType);
+  memset(&matrix[begin], 0, mySize);
+  SU2_OMP_MASTER
+  sell.valid = false;
+  edge_fmt.valid = false;
+  gpu.valid = false;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetGalerkinProduct(const CSysMatrix& fine, const CGeometry* geometry_fine,
+                                                const CGeometry* geometry_coarse) {
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Each coarse row only gathers from the rows of its children, no write conflicts. ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = row_ptr[iPoint] * blkSize; k < row_ptr[iPoint + 1] * blkSize; ++k) matrix[k] = 0.0;
+
+    for (auto iChild = 0u; iChild < geometry_coarse->nodes->GetnChildren_CV(iPoint); ++iChild) {
+      const auto iFine = geometry_coarse->nodes->GetChildren_CV(iPoint, iChild);
+
+      for (auto k = fine.row_ptr[iFine]; k < fine.row_ptr[iFine + 1]; ++k) {
+        const auto jPoint = geometry_fine->nodes->GetParent_CV(fine.col_ind[k]);
+        auto block = GetBlock(iPoint, jPoint);
+        if (!block) continue;
+        for (auto i = 0ul; i < blkSize; ++i) block[i] += fine.matrix[k * blkSize + i];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  sell.valid = false;
+  edge_fmt.valid = false;
+  gpu.valid = false;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildILULevels() {
+  vector<unsigned long> level(nPointDomain);
+
+  /*--- Bucket sort of the rows by level, i.e. a CSR structure, the rows of each level remain sorted. ---*/
+
+  auto sortByLevel = [&](vector<unsigned long>& ptr, vector<unsigned long>& rows) {
+    const auto nLevel = nPointDomain ? *max_element(level.begin(), level.end()) + 1 : 0ul;
+    ptr.assign(nLevel + 1, 0);
+    for (const auto l : level) ++ptr[l + 1];
+    for (auto l = 0ul; l < nLevel; ++l) ptr[l + 1] += ptr[l];
+
+    rows.resize(nPointDomain);
+    auto pos = ptr;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) rows[pos[level[iPoint]]++] = iPoint;
+  };
+
+  /*--- Lower levels, a row depends on the rows of its lower part (j < i), which have lower levels. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    level[iPoint] = 0;
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      level[iPoint] = max(level[iPoint], level[col_ind_ilu[index]] + 1);
+  }
+  sortByLevel(ilu_levels.lowerPtr, ilu_levels.lowerRows);
+
+  /*--- Upper levels, a row depends on the domain rows of its upper part (j > i). ---*/
+
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    iPoint--;  // unsigned type
+    level[iPoint] = 0;
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; ++index) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      level[iPoint] = max(level[iPoint], level[jPoint] + 1);
+    }
+  }
+  sortByLevel(ilu_levels.upperPtr, ilu_levels.upperRows);
+}
+
+namespace {
+/*!
+ * \brief Exchange variable size messages with the neighbors of the P2P comms (blocking).
+ * \note Message "i" is in [ptr[i], ptr[i+1]) times "stride" of the respective buffer.
+ */
+template <class T>
+void ExchangeWithNeighbors(const vector<int>& sendRank, const unsigned long* sendPtr, const T* sendBuf,
+                           const vector<int>& recvRank, const unsigned long* recvPtr, T* recvBuf,
+                           unsigned long stride, SU2_MPI::Datatype type) {
+  const auto nRecv = recvRank.size();
+  vector<SU2_MPI::Request> req(sendRank.size() + nRecv);
+  for (auto i = 0ul; i < nRecv; ++i) {
+    SU2_MPI::Irecv(recvBuf + recvPtr[i] * stride, (recvPtr[i + 1] - recvPtr[i]) * stride, type, recvRank[i],
+                   recvRank[i], SU2_MPI::GetComm(), &req[i]);
+  }
+  for (auto i = 0ul; i < sendRank.size(); ++i) {
+    SU2_MPI::Isend(sendBuf + sendPtr[i] * stride, (sendPtr[i + 1] - sendPtr[i]) * stride, type, sendRank[i],
+                   SU2_MPI::GetRank(), SU2_MPI::GetComm(), &req[nRecv + i]);
+  }
+  SU2_MPI::Waitall(req.size(), req.data(), MPI_STATUS_IGNORE);
+}
+
+/*!
+ * \brief LU factorization with partial pivoting of a dense (row-major) matrix, in place.
+ */
+void DenseLUFactorize(unsigned long n, passivedouble* A, unsigned long* piv) {
+  for (auto k = 0ul; k < n; ++k) {
+    auto p = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(A[i * n + k]) > fabs(A[p * n + k])) p = i;
+    piv[k] = p;
+    if (p != k) swap_ranges(&A[k * n], &A[(k + 1) * n], &A[p * n]);
+
+    /*--- Aggregates without couplings (e.g. empty ranks) would make the system singular. ---*/
+    if (A[k * n + k] == 0) A[k * n + k] = 1;
+
+    const auto inv = 1 / A[k * n + k];
+    for (auto i = k + 1; i < n; ++i) {
+      const auto w = A[i * n + k] *= inv;
+      if (w == 0) continue;
+      for (auto j = k + 1; j < n; ++j) A[i * n + j] -= w * A[k * n + j];
+    }
+  }
+}
+
+/*!
+ * \brief Solve with the factors of DenseLUFactorize, in place.
+ */
+void DenseLUSolve(unsigned long n, const passivedouble* A, const unsigned long* piv, passivedouble* b) {
+  for (auto k = 0ul; k < n; ++k) {
+    swap(b[k], b[piv[k]]);
+    for (auto i = k + 1; i < n; ++i) b[i] -= A[i * n + k] * b[k];
+  }
+  for (auto k = n; k > 0;) {
+    k--;  // unsigned type
+    for (auto j = k + 1; j < n; ++j) b[k] -= A[k * n + j] * b[j];
+    b[k] /= A[k * n + k];
+  }
+}
+}  // namespace
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetupSchwarz(CGeometry* geometry, const CConfig* config) {
+  const auto nHalo = nPoint - nPointDomain;
+  const auto nSend = geometry->nP2PSend;
+  const auto nRecv = geometry->nP2PRecv;
+
+  /*--- Owners of the halo points, from the receive pattern of the P2P comms. ---*/
+
+  schwarz.owner.assign(nHalo, -1);
+  schwarz.coarseSlot.assign(nHalo, -1);
+  for (int iMsg = 0; iMsg < nRecv; ++iMsg) {
+    for (auto k = geometry->nPoint_P2PRecv[iMsg]; k < geometry->nPoint_P2PRecv[iMsg + 1]; ++k) {
+      const auto iPoint = geometry->Local_Point_P2PRecv[k];
+      if (iPoint < nPointDomain) continue;
+      schwarz.owner[iPoint - nPointDomain] = geometry->Neighbors_P2PRecv[iMsg];
+      schwarz.coarseSlot[iPoint - nPointDomain] = 1 + iMsg;
+    }
+  }
+
+  if (schwarz.enabled) {
+    /*--- Layer of each halo point, i.e. its distance to the domain in the sparse pattern. ---*/
+
+    const auto overlap = config->GetLinear_Solver_Schwarz_Overlap();
+    const auto unreached = std::numeric_limits<unsigned long>::max();
+    vector<unsigned long> layer(nHalo, unreached);
+
+    for (bool changed = true; changed;) {
+      changed = false;
+      for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint) {
+        auto& iLayer = layer[iPoint - nPointDomain];
+        for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+          const auto jPoint = col_ind[index];
+          const auto jLayer = (jPoint < nPointDomain) ? 0ul : layer[jPoint - nPointDomain];
+          if (jLayer != unreached && jLayer + 1 < iLayer) {
+            iLayer = jLayer + 1;
+            changed = true;
+          }
+        }
+      }
+    }
+
+    auto inOverlap = [&](unsigned long iPoint) {
+      if (iPoint < nPointDomain) return true;
+      return layer[iPoint - nPointDomain] <= overlap && schwarz.owner[iPoint - nPointDomain] >= 0;
+    };
+
+    schwarz.haloRows.clear();
+    for (auto iPoint = nPointDomain; iPoint < nPoint; ++iPoint)
+      if (inOverlap(iPoint)) schwarz.haloRows.push_back(iPoint);
+
+    schwarz.dropPos.clear();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint + 1]; ++index)
+        if (!inOverlap(col_ind_ilu[index])) schwarz.dropPos.push_back(index);
+    }
+
+    /*--- The owners send the rows of the points they send in the P2P comms, first the lengths of the rows
+     *    and the global indices of the columns, which are mapped to the ILU copy by the receivers. ---*/
+
+    schwarz.sendRank.assign(geometry->Neighbors_P2PSend, geometry->Neighbors_P2PSend + nSend);
+    schwarz.recvRank.assign(geometry->Neighbors_P2PRecv, geometry->Neighbors_P2PRecv + nRecv);
+
+    vector<unsigned long> sendPointPtr(nSend + 1), recvPointPtr(nRecv + 1);
+    for (int iMsg = 0; iMsg < nSend; ++iMsg) sendPointPtr[iMsg + 1] = geometry->nPoint_P2PSend[iMsg + 1];
+    for (int iMsg = 0; iMsg < nRecv; ++iMsg) recvPointPtr[iMsg + 1] = geometry->nPoint_P2PRecv[iMsg + 1];
+
+    vector<unsigned long> sendLength, sendCol;
+    schwarz.sendPos.clear();
+    schwarz.sendPtr.assign(1, 0);
+    for (int iMsg = 0; iMsg < nSend; ++iMsg) {
+      for (auto k = sendPointPtr[iMsg]; k < sendPointPtr[iMsg + 1]; ++k) {
+        const auto iPoint = geometry->Local_Point_P2PSend[k];
+        sendLength.push_back(row_ptr[iPoint + 1] - row_ptr[iPoint]);
+        for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+          schwarz.sendPos.push_back(index);
+          sendCol.push_back(geometry->nodes->GetGlobalIndex(col_ind[index]));
+        }
+      }
+      schwarz.sendPtr.push_back(schwarz.sendPos.size());
+    }
+
+    vector<unsigned long> recvLength(recvPointPtr[nRecv]);
+    ExchangeWithNeighbors(schwarz.sendRank, sendPointPtr.data(), sendLength.data(), schwarz.recvRank,
+                          recvPointPtr.data(), recvLength.data(), 1, MPI_UNSIGNED_LONG);
+
+    schwarz.recvPtr.assign(1, 0);
+    for (int iMsg = 0; iMsg < nRecv; ++iMsg) {
+      auto num = schwarz.recvPtr.back();
+      for (auto k = recvPointPtr[iMsg]; k < recvPointPtr[iMsg + 1]; ++k) num += recvLength[k];
+      schwarz.recvPtr.push_back(num);
+    }
+
+    vector<unsigned long> recvCol(schwarz.recvPtr.back());
+    ExchangeWithNeighbors(schwarz.sendRank, schwarz.sendPtr.data(), sendCol.data(), schwarz.recvRank,
+                          schwarz.recvPtr.data(), recvCol.data(), 1, MPI_UNSIGNED_LONG);
+
+    unordered_map<unsigned long, unsigned long> globalToLocal;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) globalToLocal[geometry->nodes->GetGlobalIndex(iPoint)] = iPoint;
+
+    auto positionILU = [&](unsigned long iPoint, unsigned long jPoint) {
+      for (auto index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint + 1]; ++index)
+        if (col_ind_ilu[index] == jPoint) return long(index);
+      return -1l;
+    };
+
+    schwarz.recvPos.resize(recvCol.size());
+    for (auto k = 0ul, iBlk = 0ul; k < recvPointPtr[nRecv]; ++k) {
+      const auto iPoint = geometry->Local_Point_P2PRecv[k];
+      const bool keepRow = (iPoint >= nPointDomain) && inOverlap(iPoint);
+      for (auto iCol = 0ul; iCol < recvLength[k]; ++iCol, ++iBlk) {
+        schwarz.recvPos[iBlk] = -1;
+        const auto it = globalToLocal.find(recvCol[iBlk]);
+        if (keepRow && it != globalToLocal.end() && inOverlap(it->second))
+          schwarz.recvPos[iBlk] = positionILU(iPoint, it->second);
+      }
+    }
+
+    schwarz.sendBuf.resize(schwarz.sendPos.size() * nVar * nEqn);
+    schwarz.recvBuf.resize(schwarz.recvPos.size() * nVar * nEqn);
+  }
+
+  if (schwarz.coarse) {
+    /*--- The coarse row of each rank has blocks for itself and its receive neighbors. ---*/
+
+    const int nSlot = 1 + nRecv;
+    schwarz.coarseCount.resize(size);
+    SU2_MPI::Allgather(&nSlot, 1, MPI_INT, schwarz.coarseCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    schwarz.coarseDispl.assign(size, 0);
+    for (int iRank = 1; iRank < size; ++iRank)
+      schwarz.coarseDispl[iRank] = schwarz.coarseDispl[iRank - 1] + schwarz.coarseCount[iRank - 1];
+
+    vector<int> slotRank(nSlot, rank);
+    for (int iMsg = 0; iMsg < nRecv; ++iMsg) slotRank[1 + iMsg] = geometry->Neighbors_P2PRecv[iMsg];
+
+    schwarz.coarseCol.resize(schwarz.coarseDispl.back() + schwarz.coarseCount.back());
+    SU2_MPI::Allgatherv(slotRank.data(), nSlot, MPI_INT, schwarz.coarseCol.data(), schwarz.coarseCount.data(),
+                        schwarz.coarseDispl.data(), MPI_INT, SU2_MPI::GetComm());
+
+    const auto nCoarse = size * nVar;
+    schwarz.coarseLU.resize(nCoarse * nCoarse);
+    schwarz.coarsePiv.resize(nCoarse);
+    schwarz.coarseSol.resize(nCoarse);
+    schwarz.coarseRow.resize(nSlot * nVar * nEqn);
+    schwarz.coarseRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSchwarz() {
+  const auto blkSize = nVar * nEqn;
+
+  if (schwarz.enabled) {
+    /*--- Clear the halo rows and the couplings to the halo points outside the overlap. ---*/
+
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto k = row_ptr_ilu[nPointDomain] * blkSize; k < row_ptr_ilu[nPoint] * blkSize; ++k) ILU_matrix[k] = 0;
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto i = 0ul; i < schwarz.dropPos.size(); ++i)
+      for (auto k = 0ul; k < blkSize; ++k) ILU_matrix[schwarz.dropPos[i] * blkSize + k] = 0;
+    END_SU2_OMP_FOR
+
+    /*--- Send the rows and set the received blocks. ---*/
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto i = 0ul; i < schwarz.sendPos.size(); ++i)
+      for (auto k = 0ul; k < blkSize; ++k) schwarz.sendBuf[i * blkSize + k] = matrix[schwarz.sendPos[i] * blkSize + k];
+    END_SU2_OMP_FOR
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      ExchangeWithNeighbors(schwarz.sendRank, schwarz.sendPtr.data(), schwarz.sendBuf.data(), schwarz.recvRank,
+                            schwarz.recvPtr.data(), schwarz.recvBuf.data(), blkSize, MPI_DOUBLE);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto i = 0ul; i < schwarz.recvPos.size(); ++i) {
+      if (schwarz.recvPos[i] < 0) continue;
+      for (auto k = 0ul; k < blkSize; ++k)
+        ILU_matrix[schwarz.recvPos[i] * blkSize + k] = PassiveAssign(schwarz.recvBuf[i * blkSize + k]);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  if (schwarz.coarse) {
+    /*--- Coarse row of this rank, sum of the blocks of the domain rows by owner of the column. ---*/
+
+    const auto nSlot = schwarz.coarseCount[rank];
+    SU2_OMP_MASTER
+    schwarz.coarseRow.assign(nSlot * blkSize, 0.0);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    vector<passivedouble> partial(nSlot * blkSize, 0.0);
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+        const auto jPoint = col_ind[index];
+        const auto slot = (jPoint < nPointDomain) ? 0 : schwarz.coarseSlot[jPoint - nPointDomain];
+        if (slot < 0) continue;
+        for (auto k = 0ul; k < blkSize; ++k)
+          partial[slot * blkSize + k] += SU2_TYPE::GetValue(matrix[index * blkSize + k]);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    for (auto k = 0ul; k < partial.size(); ++k) schwarz.coarseRow[k] += partial[k];
+    END_SU2_OMP_CRITICAL
+
+    /*--- Gather the coarse rows and factorize the coarse matrix (every rank). ---*/
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      vector<int> count(size), displ(size);
+      for (int iRank = 0; iRank < size; ++iRank) {
+        count[iRank] = schwarz.coarseCount[iRank] * blkSize;
+        displ[iRank] = schwarz.coarseDispl[iRank] * blkSize;
+      }
+      vector<su2double> allRows(schwarz.coarseCol.size() * blkSize);
+      SU2_MPI::Allgatherv(schwarz.coarseRow.data(), nSlot * blkSize, MPI_DOUBLE, allRows.data(), count.data(),
+                          displ.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+      const auto nCoarse = size * nVar;
+      auto& A = schwarz.coarseLU;
+      A.assign(nCoarse * nCoarse, 0.0);
+
+      for (int iRank = 0; iRank < size; ++iRank) {
+        for (int iSlot = 0; iSlot < schwarz.coarseCount[iRank]; ++iSlot) {
+          const auto pos = schwarz.coarseDispl[iRank] + iSlot;
+          const auto jRank = schwarz.coarseCol[pos];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nEqn; ++jVar)
+              A[(iRank * nVar + iVar) * nCoarse + jRank * nVar + jVar] +=
+                  SU2_TYPE::GetValue(allRows[pos * blkSize + iVar * nEqn + jVar]);
+        }
+      }
+      DenseLUFactorize(nCoarse, A.data(), schwarz.coarsePiv.data());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeHaloRowsILU() {
+  if (schwarz.haloRows.empty()) return;
+
+  /*--- The halo rows depend on the domain rows of all the partitions, and on each other. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    for (const auto iPoint : schwarz.haloRows) {
+      FactorizeILURow(iPoint, 0, nPoint);
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SubstituteHaloRowsILU(CSysVector<ScalarType>& prod) const {
+  if (schwarz.haloRows.empty()) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    for (const auto iPoint : schwarz.haloRows) ForwardSubstitutionILU(iPoint, 0, prod);
+    for (auto it = schwarz.haloRows.rbegin(); it != schwarz.haloRows.rend(); ++it)
+      BackwardSubstitutionILU(*it, nPoint, prod);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+const CSysVector<ScalarType>& CSysMatrix<ScalarType>::ComputeCoarseCorrection(
+    const CSysVector<ScalarType>& vec) const {
+  /*--- Restriction, sum of the residual over the aggregate (domain) of each rank. ---*/
+
+  SU2_OMP_MASTER
+  schwarz.coarseSol.assign(schwarz.coarseSol.size(), 0.0);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  passivedouble localSum[MAXNVAR] = {0.0};
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) localSum[iVar] += SU2_TYPE::GetValue(vec(iPoint, iVar));
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) schwarz.coarseSol[rank * nVar + iVar] += localSum[iVar];
+  END_SU2_OMP_CRITICAL
+
+  /*--- Solve the coarse system (every rank). ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto nCoarse = size * nVar;
+    vector<su2double> sendSum(nVar), allSum(nCoarse);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) sendSum[iVar] = schwarz.coarseSol[rank * nVar + iVar];
+    SU2_MPI::Allgather(sendSum.data(), nVar, MPI_DOUBLE, allSum.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
+
+    vector<passivedouble> sol(nCoarse);
+    for (auto i = 0ul; i < nCoarse; ++i) sol[i] = SU2_TYPE::GetValue(allSum[i]);
+    DenseLUSolve(nCoarse, schwarz.coarseLU.data(), schwarz.coarsePiv.data(), sol.data());
+    for (auto i = 0ul; i < nCoarse; ++i) schwarz.coarseSol[i] = sol[i];
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Residual after the correction (prolongation to the points of each aggregate). ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    auto res = &schwarz.coarseRes[iPoint * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = vec(iPoint, iVar);
+
+    for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+      const auto owner = PointOwner(col_ind[index]);
+      if (owner < 0) continue;
+      MatrixVectorProductSub(&matrix[index * nVar * nEqn], &schwarz.coarseSol[owner * nVar], res);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  return schwarz.coarseRes;
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSELLPattern() {
+  const auto C = static_cast<unsigned long>(SELL_C);
+  sell.nSlice = roundUpDiv(nPointDomain, C);
+
+  auto rowLength = [this](unsigned long iPoint) -> unsigned long { return row_ptr[iPoint + 1] - row_ptr[iPoint]; };
+
+  /*--- Sort the rows by decreasing length within windows of sigma rows, this reduces
+   *    the padding while keeping the locality of the original ordering. ---*/
+
+  sell.row.assign(sell.nSlice * C, nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) sell.row[iPoint] = iPoint;
+
+  for (auto begin = 0ul; begin < nPointDomain; begin += SELL_SIGMA) {
+    const auto end = min(begin + SELL_SIGMA, nPointDomain);
+    std::stable_sort(sell.row.begin() + begin, sell.row.begin() + end,
+                     [&](unsigned long a, unsigned long b) { return rowLength(a) > rowLength(b); });
+  }
+
+  /*--- The width of a slice is the length of its longest row. ---*/
+
+  sell.slicePtr.resize(sell.nSlice + 1);
+  sell.slicePtr[0] = 0;
+  for (auto iSlice = 0ul; iSlice < sell.nSlice; ++iSlice) {
+    unsigned long width = 0;
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iPoint = sell.row[iSlice * C + iLane];
+      if (iPoint < nPointDomain) width = max(width, rowLength(iPoint));
+    }
+    sell.slicePtr[iSlice + 1] = sell.slicePtr[iSlice] + width;
+  }
+
+  /*--- Map the columns of each lane to the blocks of the CSR matrix, padding
+   *    blocks point to the diagonal column to keep the gathers in cache. ---*/
+
+  const auto nCol = sell.slicePtr[sell.nSlice];
+  sell.colInd.resize(nCol * C);
+  sell.srcIdx.resize(nCol * C);
+
+  for (auto iSlice = 0ul; iSlice < sell.nSlice; ++iSlice) {
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iPoint = sell.row[iSlice * C + iLane];
+      const bool padRow = (iPoint >= nPointDomain);
+
+      for (auto k = sell.slicePtr[iSlice]; k < sell.slicePtr[iSlice + 1]; ++k) {
+        const auto index = padRow ? nnz : row_ptr[iPoint] + k - sell.slicePtr[iSlice];
+        const bool pad = padRow || (index >= row_ptr[iPoint + 1]);
+
+        sell.srcIdx[k * C + iLane] = pad ? nnz : index;
+        sell.colInd[k * C + iLane] = pad ? (padRow ? 0 : iPoint) : col_ind[index];
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildEdgePattern() {
+  /*--- The edges are the lower part of the CSR pattern, the upper block of each edge is found in the row
+   * of its lower endpoint. Edges with two halo endpoints are kept to simplify the copy of the values. ---*/
+
+  edge_fmt.rowPtr.resize(nPoint + 1);
+  edge_fmt.rowPtr[0] = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    edge_fmt.rowPtr[iPoint + 1] = edge_fmt.rowPtr[iPoint] + dia_ptr[iPoint] - row_ptr[iPoint];
+
+  const auto nEdge = edge_fmt.rowPtr[nPoint];
+  edge_fmt.col.resize(nEdge);
+  edge_fmt.upperSrc.resize(nEdge);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto index = row_ptr[iPoint]; index < dia_ptr[iPoint]; ++index) {
+      const auto jPoint = col_ind[index];
+      const auto iEdge = edge_fmt.rowPtr[iPoint] + index - row_ptr[iPoint];
+      edge_fmt.col[iEdge] = jPoint;
+
+      auto upper = dia_ptr[jPoint] + 1;
+      while (upper < row_ptr[jPoint + 1] && col_ind[upper] != iPoint) ++upper;
+      if (upper == row_ptr[jPoint + 1]) {
+        SU2_MPI::Error("The EDGE matrix format requires a structurally symmetric sparse pattern.", CURRENT_FUNCTION);
+      }
+      edge_fmt.upperSrc[iEdge] = upper;
+    }
+  }
+
+  /*--- Interface edges of each thread partition, i.e. with the lower endpoint in the partition and the
+   * upper endpoint in a later partition or in the halos. Sorted by row within each partition. ---*/
+
+  vector<unsigned long> part(nPoint, omp_num_parts);
+  for (auto iPart = 0ul; iPart < omp_num_parts; ++iPart)
+    for (auto iPoint = omp_partitions[iPart]; iPoint < omp_partitions[iPart + 1]; ++iPoint) part[iPoint] = iPart;
+
+  edge_fmt.ifacePtr.assign(omp_num_parts + 1, 0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+      const auto jPart = part[edge_fmt.col[iEdge]];
+      if (jPart < omp_num_parts && jPart != part[iPoint]) ++edge_fmt.ifacePtr[jPart + 1];
+    }
+  }
+  for (auto iPart = 0ul; iPart < omp_num_parts; ++iPart) edge_fmt.ifacePtr[iPart + 1] += edge_fmt.ifacePtr[iPart];
+
+  edge_fmt.ifaceEdge.resize(edge_fmt.ifacePtr[omp_num_parts]);
+  edge_fmt.ifaceRow.resize(edge_fmt.ifacePtr[omp_num_parts]);
+  auto pos = edge_fmt.ifacePtr;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+      const auto jPart = part[edge_fmt.col[iEdge]];
+      if (jPart < omp_num_parts && jPart != part[iPoint]) {
+        edge_fmt.ifaceEdge[pos[jPart]] = iEdge;
+        edge_fmt.ifaceRow[pos[jPart]++] = iPoint;
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::EnableGPU() {
+#ifdef HAVE_CUDA
+  gpu_wrapper.Initialize(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind);
+  gpu.enabled = true;
+#else
+  SU2_MPI::Error("SU2 was not compiled with CUDA support (-Denable-cuda=true).", CURRENT_FUNCTION);
+#endif
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::FinalizeStorage() {
+#ifdef HAVE_CUDA
+  if (gpu.enabled) {
+    SU2_OMP_MASTER {
+      gpu_wrapper.SetValues(matrix);
+      gpu.valid = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+#endif
+  if (edge_fmt.symmetric) {
+    FinalizeSymmetricStorage();
+  } else if (edge_fmt.enabled) {
+    const auto blkSize = nVar * nEqn;
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      if (iPoint < nPointDomain) MatrixCopy(&matrix[dia_ptr[iPoint] * blkSize], &edge_fmt.dia[iPoint * blkSize]);
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto lower = row_ptr[iPoint] + iEdge - edge_fmt.rowPtr[iPoint];
+        MatrixCopy(&matrix[lower * blkSize], &edge_fmt.val[2 * iEdge * blkSize]);
+        MatrixCopy(&matrix[edge_fmt.upperSrc[iEdge] * blkSize], &edge_fmt.val[(2 * iEdge + 1) * blkSize]);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_MASTER
+    edge_fmt.valid = true;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  if (!sell.enabled) return;
+
+  const auto C = static_cast<unsigned long>(SELL_C);
+  const auto blkSize = nVar * nEqn;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_heavy_size, C))
+  for (auto iSlice = 0ul; iSlice < sell.nSlice; ++iSlice) {
+    for (auto k = sell.slicePtr[iSlice]; k < sell.slicePtr[iSlice + 1]; ++k) {
+      for (auto iLane = 0ul; iLane < C; ++iLane) {
+        const auto src = sell.srcIdx[k * C + iLane];
+        auto dst = &sell.val[k * blkSize * C + iLane];
+        for (auto ij = 0ul; ij < blkSize; ++ij) dst[ij * C] = (src < nnz) ? matrix[src * blkSize + ij] : ScalarType(0);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  sell.valid = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SELLProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  const auto C = static_cast<unsigned long>(SELL_C);
+  const auto blkSize = nVar * nEqn;
+
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_heavy_size, C))
+  for (auto iSlice = 0ul; iSlice < sell.nSlice; ++iSlice) {
+    SellArray sum[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) sum[iVar] = ScalarType(0);
+
+    for (auto k = sell.slicePtr[iSlice]; k < sell.slicePtr[iSlice + 1]; ++k) {
+      unsigned long offset[SELL_C];
+      for (auto iLane = 0ul; iLane < C; ++iLane) offset[iLane] = sell.colInd[k * C + iLane] * nEqn;
+
+      const auto block = &sell.val[k * blkSize * C];
+
+      for (auto jVar = 0ul; jVar < nEqn; ++jVar) {
+        const SellArray x(&vec[jVar], offset);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          SellArray a;
+          a.loada(&block[(iVar * nEqn + jVar) * C]);
+          sum[iVar] += a * x;
+        }
+      }
+    }
+
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iPoint = sell.row[iSlice * C + iLane];
+      if (iPoint >= nPointDomain) continue;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) prod[iPoint * nVar + iVar] = sum[iVar][iLane];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::EdgeProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Rows of each partition, the upper blocks are scattered to the rows of the same partition. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      auto prod_i = &prod[iPoint * nVar];
+      const auto vec_i = &vec[iPoint * nEqn];
+      MatrixVectorProduct(&edge_fmt.dia[iPoint * blkSize], vec_i, prod_i);
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        const auto block = &edge_fmt.val[2 * iEdge * blkSize];
+        MatrixVectorProductAdd(block, &vec[jPoint * nEqn], prod_i);
+        if (jPoint >= begin) MatrixVectorProductAdd(block + blkSize, vec_i, &prod[jPoint * nVar]);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Upper blocks of the interface edges, after all rows were initialized. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    for (auto k = edge_fmt.ifacePtr[thread]; k < edge_fmt.ifacePtr[thread + 1]; ++k) {
+      const auto iEdge = edge_fmt.ifaceEdge[k];
+      const auto block = &edge_fmt.val[(2 * iEdge + 1) * blkSize];
+      MatrixVectorProductAdd(block, &vec[edge_fmt.ifaceRow[k] * nEqn], &prod[edge_fmt.col[iEdge] * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::EdgeLU_SGS(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                        CGeometry* geometry, const CConfig* config) const {
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Forward sweep, (D+L).x* = b, row-oriented over the lower part of each row. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    ScalarType block[MAXNVAR * MAXNVAR];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      auto prod_i = &prod[iPoint * nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) prod_i[iVar] = vec[iPoint * nVar + iVar];
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        if (jPoint >= begin) MatrixVectorProductSub(&edge_fmt.val[2 * iEdge * blkSize], &prod[jPoint * nVar], prod_i);
+      }
+      MatrixCopy(&edge_fmt.dia[iPoint * blkSize], block);
+      Gauss_Elimination(block, prod_i);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Backward sweep, (D+U).x = D.x*, in place and column-oriented, the upper blocks of each edge are used
+   * to update the rows of the lower part. Same partitioning of the rows and halo treatment as with BCSR. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    ScalarType block[MAXNVAR * MAXNVAR], tmp[MAXNVAR];
+
+    /*--- Start from D.x*, minus the halo columns (the other partitions are not considered). ---*/
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = prod[iPoint * nVar + iVar];
+      MatrixVectorProduct(&edge_fmt.dia[iPoint * blkSize], tmp, &prod[iPoint * nVar]);
+    }
+    for (auto k = edge_fmt.ifacePtr[thread]; k < edge_fmt.ifacePtr[thread + 1]; ++k) {
+      const auto iPoint = edge_fmt.ifaceRow[k];
+      if (iPoint < nPointDomain) continue;
+      const auto iEdge = edge_fmt.ifaceEdge[k];
+      MatrixVectorProductSub(&edge_fmt.val[(2 * iEdge + 1) * blkSize], &prod[iPoint * nVar],
+                             &prod[edge_fmt.col[iEdge] * nVar]);
+    }
+
+    /*--- Once row i is solved, its contribution to the rows of its lower part (through the upper blocks)
+     * is subtracted, therefore rows are complete when they are reached. ---*/
+
+    for (auto iPoint = end; iPoint > begin;) {
+      iPoint--;  // unsigned type
+      auto prod_i = &prod[iPoint * nVar];
+      MatrixCopy(&edge_fmt.dia[iPoint * blkSize], block);
+      Gauss_Elimination(block, prod_i);
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        if (jPoint >= begin)
+          MatrixVectorProductSub(&edge_fmt.val[(2 * iEdge + 1) * blkSize], prod_i, &prod[jPoint * nVar]);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
+template <class ScalarType>
+bool CSysMatrix<ScalarType>::FinalizeSymmetricStorage() {
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Mask the domain DOFs whose row has no non-zero entries outside of the diagonal block, these rows
+   * are allowed to break the symmetry (e.g. Dirichlet conditions by DeleteValsRowi). ---*/
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      bool fixed = true;
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; ++index) {
+        if (index == dia_ptr[iPoint]) continue;
+        for (auto jVar = 0ul; jVar < nEqn; ++jVar) fixed &= (matrix[index * blkSize + iVar * nEqn + jVar] == 0.0);
+      }
+      edge_fmt.mask[iPoint * nVar + iVar] = fixed ? 0 : 1;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER {
+    edge_fmt.fixedDofs.clear();
+    for (auto iDof = 0ul; iDof < nPointDomain * nVar; ++iDof)
+      if (edge_fmt.mask[iDof] == 0.0) edge_fmt.fixedDofs.push_back(iDof);
+  }
+  END_SU2_OMP_MASTER
+
+  /*--- Copy the lower block of each edge, comparing it with the transpose of the upper block. Unless the DOFs
+   * are masked, in which case the value from the unmasked row is kept (to compute exact products). The lower
+   * blocks of halo rows are not assembled consistently, the transpose of the upper blocks is used. ---*/
+
+  const ScalarType tol = 1e-6;
+  unsigned long numAsym = 0;
+
+  SU2_OMP_FOR_STAT(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto dia_i = &matrix[dia_ptr[iPoint] * blkSize];
+
+    if (iPoint < nPointDomain) {
+      MatrixCopy(dia_i, &edge_fmt.dia[iPoint * blkSize]);
+
+      const auto mask_i = &edge_fmt.mask[iPoint * nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < iVar; ++jVar) {
+          const auto l = dia_i[iVar * nVar + jVar], u = dia_i[jVar * nVar + iVar];
+          const auto scale = fabs(dia_i[iVar * (nVar + 1)]) + fabs(dia_i[jVar * (nVar + 1)]);
+          if (mask_i[iVar] * mask_i[jVar] != 0.0) numAsym += (fabs(l - u) > tol * scale);
+        }
+      }
+    }
+
+    for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+      const auto jPoint = edge_fmt.col[iEdge];
+      const auto lower = &matrix[(row_ptr[iPoint] + iEdge - edge_fmt.rowPtr[iPoint]) * blkSize];
+      const auto upper = &matrix[edge_fmt.upperSrc[iEdge] * blkSize];
+      const auto dia_j = &matrix[dia_ptr[jPoint] * blkSize];
+      auto block = &edge_fmt.val[iEdge * blkSize];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          const auto l = lower[iVar * nVar + jVar], u = upper[jVar * nVar + iVar];
+          auto& val = block[iVar * nVar + jVar];
+
+          if (jPoint >= nPointDomain) {
+            val = 0.0;  // Both endpoints are halos, the edge is not used.
+          } else if (iPoint >= nPointDomain || edge_fmt.mask[iPoint * nVar + iVar] == 0.0) {
+            val = u;
+          } else if (edge_fmt.mask[jPoint * nVar + jVar] == 0.0) {
+            val = l;
+          } else {
+            const auto scale = fabs(l) + fabs(u) + fabs(dia_i[iVar * (nVar + 1)]) + fabs(dia_j[jVar * (nVar + 1)]);
+            numAsym += (fabs(l - u) > tol * scale);
+            val = l;
+          }
+        }
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  atomicAdd(numAsym, edge_fmt.numAsym);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    unsigned long totalAsym = 0;
+    SU2_MPI::Allreduce(&edge_fmt.numAsym, &totalAsym, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    edge_fmt.numAsym = 0;
+    edge_fmt.valid = (totalAsym == 0);
+
+    if (!edge_fmt.valid && !edge_fmt.warned && rank == MASTER_NODE) {
+      cout << "WARNING: The matrix is not symmetric (" << totalAsym << " entries), the symmetric storage is not used"
+           << " and the IC preconditioner falls back to LU_SGS." << endl;
+    }
+    edge_fmt.warned |= !edge_fmt.valid;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  return edge_fmt.valid;
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SymmetricEdgeProduct(const CSysVector<ScalarType>& vec,
+                                                  CSysVector<ScalarType>& prod) const {
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Same as EdgeProduct but the upper blocks are the transpose of the lower. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      auto prod_i = &prod[iPoint * nVar];
+      const auto vec_i = &vec[iPoint * nEqn];
+      MatrixVectorProduct(&edge_fmt.dia[iPoint * blkSize], vec_i, prod_i);
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        const auto block = &edge_fmt.val[iEdge * blkSize];
+        MatrixVectorProductAdd(block, &vec[jPoint * nEqn], prod_i);
+        if (jPoint >= begin) gemv_impl<ScalarType, true, true, true>(nVar, nEqn, block, vec_i, &prod[jPoint * nVar]);
+      }
     }
   }
+  END_SU2_OMP_FOR
 
-  /*--- Verify that all non-blocking point-to-point sends have finished.
-   Note that this should be satisfied, as we have received all of the
-   data in the loop above at this point. ---*/
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    for (auto k = edge_fmt.ifacePtr[thread]; k < edge_fmt.ifacePtr[thread + 1]; ++k) {
+      const auto iEdge = edge_fmt.ifaceEdge[k];
+      gemv_impl<ScalarType, true, true, true>(nVar, nEqn, &edge_fmt.val[iEdge * blkSize],
+                                              &vec[edge_fmt.ifaceRow[k] * nEqn], &prod[edge_fmt.col[iEdge] * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
 
-#ifdef HAVE_MPI
-  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
-#endif
-}
+  /*--- The rows of the masked DOFs only have the diagonal block. ---*/
 
-template <class ScalarType>
-void CSysMatrix<ScalarType>::SetValZero() {
-  const auto size = nnz * nVar * nEqn;
-  const auto chunk = roundUpDiv(size, omp_get_num_threads());
-  const auto begin = chunk * omp_get_thread_num();
-  const auto mySize = min(chunk, size - begin) * sizeof(ScalarType);
-  memset(&matrix[begin], 0, mySize);
-  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto k = 0ul; k < edge_fmt.fixedDofs.size(); ++k) {
+    const auto iDof = edge_fmt.fixedDofs[k];
+    const auto iPoint = iDof / nVar, iVar = iDof % nVar;
+    const auto row = &edge_fmt.dia[iPoint * blkSize + iVar * nEqn];
+    ScalarType sum = 0.0;
+    for (auto jVar = 0ul; jVar < nEqn; ++jVar) sum += row[jVar] * vec[iPoint * nEqn + jVar];
+    prod[iDof] = sum;
+  }
+  END_SU2_OMP_FOR
 }
 
 template <class ScalarType>
@@ -565,6 +1590,8 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
+  SU2_KERNEL_COUNTER(SPMV);
+
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
 #ifndef NDEBUG
   if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
@@ -581,11 +1608,26 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  if (gpu.valid) {
+#ifdef HAVE_CUDA
+    SU2_OMP_MASTER
+    gpu_wrapper.MatrixVectorProduct(&vec[0], &prod[0]);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+#endif
+  } else if (sell.valid) {
+    SELLProduct(vec, prod);
+  } else if (edge_fmt.valid && edge_fmt.symmetric) {
+    SymmetricEdgeProduct(vec, prod);
+  } else if (edge_fmt.valid) {
+    EdgeProduct(vec, prod);
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -600,6 +1642,35 @@ void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
     InverseDiagonalBlock(iPoint, &(invM[iPoint * nVar * nVar]));
   END_SU2_OMP_FOR
+
+#ifdef HAVE_CUDA
+  if (gpu.enabled) {
+    SU2_OMP_MASTER {
+      gpu_wrapper.SetInvDiagonal(invM);
+      gpu.invDiagValid = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+#endif
+
+  if (sell.invDiag == nullptr) return;
+
+  /*--- Interleave the inverses of groups of C consecutive rows for the vectorized application. ---*/
+
+  const auto C = static_cast<unsigned long>(SELL_C);
+  const auto blkSize = nVar * nVar;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_heavy_size, C))
+  for (auto iGroup = 0ul; iGroup < sell.nSlice; ++iGroup) {
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto iPoint = iGroup * C + iLane;
+      auto dst = &sell.invDiag[iGroup * blkSize * C + iLane];
+      for (auto ij = 0ul; ij < blkSize; ++ij)
+        dst[ij * C] = (iPoint < nPointDomain) ? invM[iPoint * blkSize + ij] : ScalarType(0);
+    }
+  }
+  END_SU2_OMP_FOR
 }
 
 template <class ScalarType>
@@ -608,10 +1679,48 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
                                                          const CConfig* config) const {
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
-  END_SU2_OMP_FOR
+  if (gpu.invDiagValid) {
+#ifdef HAVE_CUDA
+    SU2_OMP_MASTER
+    gpu_wrapper.JacobiProduct(&vec[0], &prod[0]);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+#endif
+  } else if (sell.invDiag != nullptr) {
+    /*--- Vectorized across groups of C rows. ---*/
+    const auto C = static_cast<unsigned long>(SELL_C);
+    const auto blkSize = nVar * nVar;
+
+    SU2_OMP_FOR_DYN(roundUpDiv(omp_heavy_size, C))
+    for (auto iGroup = 0ul; iGroup < sell.nSlice; ++iGroup) {
+      const auto begin = iGroup * C;
+      const auto nLane = min(C, nPointDomain - begin);
+
+      unsigned long offset[SELL_C];
+      for (auto iLane = 0ul; iLane < C; ++iLane) offset[iLane] = (begin + min(iLane, nLane - 1)) * nVar;
+
+      SellArray x[MAXNVAR];
+      for (auto jVar = 0ul; jVar < nVar; ++jVar) x[jVar].gather(&vec[jVar], offset);
+
+      const auto block = &sell.invDiag[iGroup * blkSize * C];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        SellArray y = ScalarType(0);
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          SellArray a;
+          a.loada(&block[(iVar * nVar + jVar) * C]);
+          y += a * x[jVar];
+        }
+        for (auto iLane = 0ul; iLane < nLane; ++iLane) prod[(begin + iLane) * nVar + iVar] = y[iLane];
+      }
+    }
+    END_SU2_OMP_FOR
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+    END_SU2_OMP_FOR
+  }
 
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -645,8 +1754,33 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
     END_SU2_OMP_FOR
   }
 
+  /*--- Rows of the overlap and coarse system (restricted additive Schwarz). ---*/
+
+  if (schwarz.enabled || schwarz.coarse) BuildSchwarz();
+
   /*--- Transform system in Upper Matrix ---*/
 
+  if (ilu_levels.enabled) {
+    /*--- Level scheduling, the rows of each level are independent, all the rows
+     *    they depend on have been eliminated, and their diagonal inverted. ---*/
+
+    const auto nLevel = ilu_levels.lowerPtr.size() - 1;
+    for (auto iLevel = 0ul; iLevel < nLevel; ++iLevel) {
+      const auto begin = ilu_levels.lowerPtr[iLevel];
+      const auto end = ilu_levels.lowerPtr[iLevel + 1];
+
+      SU2_OMP_FOR_DYN(computeStaticChunkSize(end - begin, omp_get_num_threads(), OMP_MIN_SIZE))
+      for (auto k = begin; k < end; ++k) {
+        const auto iPoint = ilu_levels.lowerRows[k];
+        FactorizeILURow(iPoint, 0, nPointDomain);
+        InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+      }
+      END_SU2_OMP_FOR
+    }
+    FactorizeHaloRowsILU();
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -661,112 +1795,356 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
-
     for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
       /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
 
       InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+      FactorizeILURow(iPoint, begin, end);
+    }
+    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+  }
+  END_SU2_OMP_FOR
+
+  FactorizeHaloRowsILU();
+}
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+template <class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
 
-        auto jPoint = col_ind_ilu[index];
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-        if (jPoint < begin) continue;
+    auto jPoint = col_ind_ilu[index];
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+    if (jPoint < begin) continue;
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
 
-          auto kPoint = col_ind_ilu[index_];
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-          if (kPoint >= end) break;
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+      auto kPoint = col_ind_ilu[index_];
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+      /*--- With overlap the halo columns (after the domain ones) are also part of the factorization. ---*/
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+      if (kPoint >= end) {
+        if (schwarz.haloRows.empty()) break;
+        if (kPoint < nPointDomain) continue;
+      }
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
       }
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
   }
-  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ForwardSubstitutionILU(unsigned long iPoint, unsigned long begin,
+                                                    CSysVector<ScalarType>& prod) const {
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BackwardSubstitutionILU(unsigned long iPoint, unsigned long end,
+                                                     CSysVector<ScalarType>& prod) const {
+  ScalarType aux_vec[MAXNVAR];
+  for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+
+  for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint >= end) {
+      /*--- See FactorizeILURow. ---*/
+      if (schwarz.haloRows.empty()) break;
+      if (jPoint < nPointDomain) continue;
+    }
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
+  }
+
+  MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
 }
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                       CGeometry* geometry, const CConfig* config) const {
+  SU2_KERNEL_COUNTER(ILU);
+
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
+  /*--- The coarse correction is applied first, the ILU then acts on the updated residual. ---*/
+
+  const auto& rhs = schwarz.coarse ? ComputeCoarseCorrection(vec) : vec;
+
+  /*--- With overlap, the sweeps of the halo rows need the right hand side of their owners. ---*/
+
+  if (schwarz.enabled) {
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++) prod(iPoint, iVar) = rhs(iPoint, iVar);
+    END_SU2_OMP_FOR
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+  }
+
+  if (ilu_levels.enabled) {
+    /*--- Level scheduling, see BuildILUPreconditioner. ---*/
+
+    if (!schwarz.enabled) {
+      SU2_OMP_FOR_STAT(omp_heavy_size)
+      for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod(iPoint, iVar) = rhs(iPoint, iVar);
+      END_SU2_OMP_FOR
+    }
+
+    auto sweep = [&](const vector<unsigned long>& ptr, const vector<unsigned long>& rows, bool forward) {
+      for (auto iLevel = 0ul; iLevel + 1 < ptr.size(); ++iLevel) {
+        const auto begin = ptr[iLevel];
+        const auto end = ptr[iLevel + 1];
+
+        SU2_OMP_FOR_DYN(computeStaticChunkSize(end - begin, omp_get_num_threads(), OMP_MIN_SIZE))
+        for (auto k = begin; k < end; ++k) {
+          if (forward)
+            ForwardSubstitutionILU(rows[k], 0, prod);
+          else
+            BackwardSubstitutionILU(rows[k], nPointDomain, prod);
+        }
+        END_SU2_OMP_FOR
+      }
+    };
+    sweep(ilu_levels.lowerPtr, ilu_levels.lowerRows, true);
+    SubstituteHaloRowsILU(prod);
+    sweep(ilu_levels.upperPtr, ilu_levels.upperRows, false);
+  } else if (!schwarz.enabled) {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
+
+      /*--- Copy vector to then work on prod in place ---*/
+
+      for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = rhs[iVar];
+
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
+
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) ForwardSubstitutionILU(iPoint, begin, prod);
+
+      /*--- Backwards substitution (starts at the last row) ---*/
+
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        BackwardSubstitutionILU(iPoint, end, prod);
+      }
+    }
+    END_SU2_OMP_FOR
+  } else {
+    /*--- As above but the halo rows are substituted between the forward and backward sweeps. ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) ForwardSubstitutionILU(iPoint, begin, prod);
+    }
+    END_SU2_OMP_FOR
+
+    SubstituteHaloRowsILU(prod);
+
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        BackwardSubstitutionILU(iPoint, end, prod);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Add the coarse correction, the halo values are then the restriction of the owners' results. ---*/
+
+  if (schwarz.coarse) {
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++) prod(iPoint, iVar) += schwarz.coarseSol[rank * nVar + iVar];
+    END_SU2_OMP_FOR
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildICPreconditioner() {
+  /*--- Without the symmetric copy of the matrix the preconditioner falls back to LU_SGS. ---*/
+
+  if (!edge_fmt.valid || !edge_fmt.symmetric || !edge_fmt.pivot) {
+    SU2_OMP_MASTER
+    edge_fmt.factorized = false;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Zero fill factorization (P+L).P^-1.(P+L^T) of each thread partition (as for LU_SGS, the couplings
+   * between partitions and with the halos are ignored), P_i = D_i - sum_j L_ij.P_j^-1.L_ij^T for j < i.
+   * The masked DOFs are decoupled from the others to keep the preconditioner symmetric. ---*/
+
   SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
 
-    ScalarType aux_vec[MAXNVAR];
+    ScalarType block[MAXNVAR * MAXNVAR], lower[MAXNVAR * MAXNVAR], tmp[MAXNVAR * MAXNVAR];
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      const auto mask_i = &edge_fmt.mask[iPoint * nVar];
+      const auto dia_i = &edge_fmt.dia[iPoint * blkSize];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          block[iVar * nVar + jVar] = dia_i[iVar * nVar + jVar] * (iVar == jVar ? 1 : mask_i[iVar] * mask_i[jVar]);
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        if (jPoint < begin) continue;
+        const auto mask_j = &edge_fmt.mask[jPoint * nVar];
+        const auto pivot_j = &edge_fmt.pivot[jPoint * blkSize];
+        const auto val = &edge_fmt.val[iEdge * blkSize];
+
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            lower[iVar * nVar + jVar] = mask_i[iVar] * val[iVar * nVar + jVar] * mask_j[jVar];
+
+        /*--- tmp = P_j^-1.L_ij^T, block -= L_ij.tmp ---*/
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+            tmp[iVar * nVar + jVar] = 0.0;
+            for (auto kVar = 0ul; kVar < nVar; ++kVar)
+              tmp[iVar * nVar + jVar] += pivot_j[iVar * nVar + kVar] * lower[jVar * nVar + kVar];
+          }
+        }
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            for (auto kVar = 0ul; kVar < nVar; ++kVar)
+              block[iVar * nVar + jVar] -= lower[iVar * nVar + kVar] * tmp[kVar * nVar + jVar];
+      }
+      MatrixInverse(block, &edge_fmt.pivot[iPoint * blkSize]);
+    }
+  }
+  END_SU2_OMP_FOR
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+  SU2_OMP_MASTER
+  edge_fmt.factorized = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeICPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                     CGeometry* geometry, const CConfig* config) const {
+  if (!edge_fmt.valid || !edge_fmt.factorized) {
+    ComputeLU_SGSPreconditioner(vec, prod, geometry, config);
+    return;
+  }
+  const auto blkSize = nVar * nEqn;
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- Forward sweep, (P+L).y = b, row-oriented. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    ScalarType sum[MAXNVAR], tmp[MAXNVAR];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      const auto mask_i = &edge_fmt.mask[iPoint * nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum[iVar] = 0.0;
+
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
         if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          tmp[jVar] = edge_fmt.mask[jPoint * nVar + jVar] * prod[jPoint * nVar + jVar];
+        MatrixVectorProductAdd(&edge_fmt.val[iEdge * blkSize], tmp, sum);
       }
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = vec[iPoint * nVar + iVar] - mask_i[iVar] * sum[iVar];
+      MatrixVectorProduct(&edge_fmt.pivot[iPoint * blkSize], tmp, &prod[iPoint * nVar]);
     }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Backward sweep, (P+L^T).z = P.y, in place and column-oriented, the contributions of each row to the rows
+   * of its lower part are accumulated in the working memory. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto thread = 0ul; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread + 1];
+
+    auto acc = edge_fmt.work.data();
+    for (auto iDof = begin * nVar; iDof < end * nVar; ++iDof) acc[iDof] = 0.0;
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    ScalarType tmp[MAXNVAR];
 
     for (auto iPoint = end; iPoint > begin;) {
       iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      const auto mask_i = &edge_fmt.mask[iPoint * nVar];
+      auto prod_i = &prod[iPoint * nVar];
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = mask_i[iVar] * acc[iPoint * nVar + iVar];
+      MatrixVectorProductSub(&edge_fmt.pivot[iPoint * blkSize], tmp, prod_i);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = mask_i[iVar] * prod_i[iVar];
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      for (auto iEdge = edge_fmt.rowPtr[iPoint]; iEdge < edge_fmt.rowPtr[iPoint + 1]; ++iEdge) {
+        const auto jPoint = edge_fmt.col[iEdge];
+        if (jPoint >= begin)
+          gemv_impl<ScalarType, true, true, true>(nVar, nEqn, &edge_fmt.val[iEdge * blkSize], tmp, &acc[jPoint * nVar]);
+      }
     }
   }
   END_SU2_OMP_FOR
 
-  /*--- MPI Parallelization ---*/
-
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
 }
@@ -780,6 +2158,11 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  if (edge_fmt.valid && !edge_fmt.symmetric) {
+    EdgeLU_SGS(vec, prod, geometry, config);
+    return;
+  }
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
@@ -840,27 +2223,43 @@ template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry* geometry, const CConfig* config) {
   BuildJacobiPreconditioner();
 
-  /*--- Allocate working vectors if not done yet. ---*/
+  /*--- Batch the linelets and allocate working vectors if not done yet. ---*/
   if (!LineletUpper.empty()) return;
 
   const auto nThreads = omp_get_max_threads();
+  const auto C = static_cast<unsigned long>(LINELET_C);
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
     const auto& li = geometry->GetLineletInfo(config);
-    if (!li.linelets.empty()) {
+    const auto nLinelet = li.linelets.size();
+    if (nLinelet > 0) {
       LineletUpper.resize(nThreads);
       LineletVector.resize(nThreads);
       LineletInvDiag.resize(nThreads);
+      LineletWork.resize(nThreads);
+
+      /*--- Longest linelets first, such that the linelets of a batch have similar lengths, and for better
+       * load balancing of the dynamic schedule. ---*/
+      vector<unsigned long> order(nLinelet);
+      iota(order.begin(), order.end(), 0ul);
+      stable_sort(order.begin(), order.end(), [&li](unsigned long a, unsigned long b) {
+        return li.linelets[a].size() > li.linelets[b].size();
+      });
+      LineletBatch.assign(roundUpDiv(nLinelet, C) * C, nLinelet);
+      copy(order.begin(), order.end(), LineletBatch.begin());
     }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
+  if (LineletUpper.empty()) return;
+
   SU2_OMP_FOR_STAT(1)
   for (int iThread = 0; iThread < nThreads; ++iThread) {
-    const auto size = CGeometry::CLineletInfo::MAX_LINELET_POINTS;
-    LineletUpper[iThread].resize(size, nullptr);
+    const auto size = CGeometry::CLineletInfo::MAX_LINELET_POINTS * C;
+    LineletUpper[iThread].resize(size * nVar * nVar, 0.0);
     LineletVector[iThread].resize(size * nVar, 0.0);
     LineletInvDiag[iThread].resize(size * nVar * nVar, 0.0);
+    LineletWork[iThread].resize((3 * nVar + 1) * nVar * C, 0.0);
   }
   END_SU2_OMP_FOR
 }
@@ -882,84 +2281,185 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
       MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
   END_SU2_OMP_FOR
 
-  /*--- Solve the tridiagonal systems for the linelets. ---*/
+  /*--- Small dense operations for all the lanes of a batch, the values of the lanes are interleaved and the
+   * innermost loops are over the lanes. Same algorithms as MatrixInverse and MatrixVectorProduct. ---*/
+
+  const auto C = static_cast<unsigned long>(LINELET_C);
+  const auto blkSize = nVar * nVar;
+
+#define A(I, J) a[((I)*nVar + (J)) * C + k]
+#define M(I, J) m[((I)*nVar + (J)) * C + k]
+
+  /*--- m = inverse(a), a is modified. ---*/
+  auto batchInverse = [&](ScalarType* a, ScalarType* m) {
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        for (auto k = 0ul; k < C; k++) M(iVar, jVar) = ScalarType(iVar == jVar);
+
+    for (auto iVar = 1ul; iVar < nVar; iVar++) {
+      for (auto jVar = 0ul; jVar < iVar; jVar++) {
+        ScalarType weight[LINELET_C];
+        SU2_OMP_SIMD
+        for (auto k = 0ul; k < C; k++) weight[k] = A(iVar, jVar) / A(jVar, jVar);
+
+        for (auto kVar = jVar; kVar < nVar; kVar++) {
+          SU2_OMP_SIMD
+          for (auto k = 0ul; k < C; k++) A(iVar, kVar) -= weight[k] * A(jVar, kVar);
+        }
+        for (auto kVar = 0ul; kVar <= jVar; kVar++) {
+          SU2_OMP_SIMD
+          for (auto k = 0ul; k < C; k++) M(iVar, kVar) -= weight[k] * M(jVar, kVar);
+        }
+      }
+    }
+    for (auto iVar = nVar; iVar > 0ul;) {
+      iVar--;  // unsigned type
+      for (auto jVar = iVar + 1; jVar < nVar; jVar++) {
+        for (auto kVar = 0ul; kVar < nVar; kVar++) {
+          SU2_OMP_SIMD
+          for (auto k = 0ul; k < C; k++) M(iVar, kVar) -= A(iVar, jVar) * M(jVar, kVar);
+        }
+      }
+      for (auto kVar = 0ul; kVar < nVar; kVar++) {
+        SU2_OMP_SIMD
+        for (auto k = 0ul; k < C; k++) M(iVar, kVar) /= A(iVar, iVar);
+      }
+    }
+  };
+#undef A
+#undef M
+
+  /*--- c = a * b, or c -= a * b. ---*/
+  auto batchProduct = [&](const ScalarType* a, const ScalarType* b, ScalarType* c, bool subtract) {
+    const ScalarType sign = subtract ? -1 : 1;
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      for (auto jVar = 0ul; jVar < nVar; jVar++) {
+        auto c_ij = &c[(iVar * nVar + jVar) * C];
+        if (!subtract)
+          for (auto k = 0ul; k < C; k++) c_ij[k] = 0.0;
+        for (auto kVar = 0ul; kVar < nVar; kVar++) {
+          const auto a_ik = &a[(iVar * nVar + kVar) * C];
+          const auto b_kj = &b[(kVar * nVar + jVar) * C];
+          SU2_OMP_SIMD
+          for (auto k = 0ul; k < C; k++) c_ij[k] += sign * a_ik[k] * b_kj[k];
+        }
+      }
+    }
+  };
+
+  /*--- y = a * x, or y -= a * x. ---*/
+  auto batchMatVec = [&](const ScalarType* a, const ScalarType* x, ScalarType* y, bool subtract) {
+    const ScalarType sign = subtract ? -1 : 1;
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      auto y_i = &y[iVar * C];
+      if (!subtract)
+        for (auto k = 0ul; k < C; k++) y_i[k] = 0.0;
+      for (auto jVar = 0ul; jVar < nVar; jVar++) {
+        const auto a_ij = &a[(iVar * nVar + jVar) * C];
+        SU2_OMP_SIMD
+        for (auto k = 0ul; k < C; k++) y_i[k] += sign * a_ij[k] * x[jVar * C + k];
+      }
+    }
+  };
+
+  /*--- Solve the tridiagonal systems for the batches of linelets. ---*/
+
+  const auto nLinelet = li.linelets.size();
 
   SU2_OMP_FOR_DYN(1)
-  for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
-    /*--- Get references to the working vectors allocated for this thread. ---*/
+  for (auto iBatch = 0ul; iBatch < LineletBatch.size() / C; iBatch++) {
+    /*--- Get pointers to the working vectors allocated for this thread. ---*/
 
     const int thread = omp_get_thread_num();
-    auto& lineletUpper = LineletUpper[thread];
-    auto& lineletInvDiag = LineletInvDiag[thread];
-    auto& lineletVector = LineletVector[thread];
+    auto* upper = LineletUpper[thread].data();
+    auto* invDiag = LineletInvDiag[thread].data();
+    auto* rhs = LineletVector[thread].data();
+    auto* lower = LineletWork[thread].data();
+    auto* weight = lower + blkSize * C;
+    auto* block = weight + blkSize * C;
+    auto* aux = block + blkSize * C;
 
-    /*--- Initialize the solution vector with the rhs ---*/
+    const auto* lanes = &LineletBatch[iBatch * C];
 
-    const auto nElem = li.linelets[iLinelet].size();
+    /*--- The first lane has the longest linelet. Shorter linelets (and padding lanes) are extended with
+     * identity diagonal blocks, zero off-diagonal blocks, and zero rhs. ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++) lineletVector[iElem * nVar + iVar] = vec[iPoint * nVar + iVar];
-    }
+    const auto nElem = li.linelets[lanes[0]].size();
 
-    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
+    auto lineletSize = [&](unsigned long k) { return lanes[k] < nLinelet ? li.linelets[lanes[k]].size() : 0ul; };
 
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR * MAXNVAR], aux_vector[MAXNVAR];
+    /*--- Gather the diagonal and upper blocks, and initialize the solution vector with the rhs. ---*/
 
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[li.linelets[iLinelet][0]] * nVar * nVar], lineletInvDiag.data());
+    for (auto k = 0ul; k < C; k++) {
+      const auto size = lineletSize(k);
+      for (auto iElem = 0ul; iElem < nElem; iElem++) {
+        const bool valid = iElem < size;
+        const auto iPoint = valid ? li.linelets[lanes[k]][iElem] : 0ul;
+        const auto ip1Point = (iElem + 1 < size) ? li.linelets[lanes[k]][iElem + 1] : 0ul;
+        const auto* d = valid ? &matrix[dia_ptr[iPoint] * blkSize] : nullptr;
+        const auto* u = (iElem + 1 < size) ? GetBlock(iPoint, ip1Point) : nullptr;
 
-    for (auto iElem = 1ul; iElem < nElem; iElem++) {
-      /*--- Setup pointers to required matrices and vectors ---*/
-      const auto im1Point = li.linelets[iLinelet][iElem - 1];
-      const auto iPoint = li.linelets[iLinelet][iElem];
+        for (auto ij = 0ul; ij < blkSize; ij++) {
+          invDiag[(iElem * blkSize + ij) * C + k] = d ? d[ij] : ScalarType(ij % (nVar + 1) == 0);
+          upper[(iElem * blkSize + ij) * C + k] = u ? u[ij] : ScalarType(0.0);
+        }
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          rhs[(iElem * nVar + iVar) * C + k] = valid ? vec[iPoint * nVar + iVar] : ScalarType(0.0);
+      }
+    }
 
-      const auto* d = &matrix[dia_ptr[iPoint] * nVar * nVar];
-      const auto* l = GetBlock(iPoint, im1Point);
-      const auto* u = GetBlock(im1Point, iPoint);
+    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
 
-      auto* inv_dm1 = &lineletInvDiag[(iElem - 1) * nVar * nVar];
-      auto* d_prime = &lineletInvDiag[iElem * nVar * nVar];
-      auto* b_prime = &lineletVector[iElem * nVar];
+    for (auto iElem = 1ul; iElem < nElem; iElem++) {
+      /*--- Gather the lower blocks. ---*/
+      for (auto k = 0ul; k < C; k++) {
+        const bool valid = iElem < lineletSize(k);
+        const auto* l = valid ? GetBlock(li.linelets[lanes[k]][iElem], li.linelets[lanes[k]][iElem - 1]) : nullptr;
+        for (auto ij = 0ul; ij < blkSize; ij++) lower[ij * C + k] = l ? l[ij] : ScalarType(0.0);
+      }
 
-      /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
+      auto* inv_dm1 = &invDiag[(iElem - 1) * blkSize * C];
+      auto* d_prime = &invDiag[iElem * blkSize * C];
 
-      /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
+      /*--- Invert previous modified diagonal. ---*/
+      for (auto i = 0ul; i < blkSize * C; i++) block[i] = inv_dm1[i];
+      batchInverse(block, inv_dm1);
 
-      /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
+      /*--- Left-multiply by lower block to obtain the weight. ---*/
+      batchProduct(lower, inv_dm1, weight, false);
 
-      /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem - 1) * nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
+      /*--- Multiply weight by upper block to modify current diagonal. ---*/
+      batchProduct(weight, &upper[(iElem - 1) * blkSize * C], d_prime, true);
 
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem - 1] = u;
+      /*--- Update the rhs. ---*/
+      batchMatVec(weight, &rhs[(iElem - 1) * nVar * C], &rhs[iElem * nVar * C], true);
     }
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+    /*--- Backwards substitution, the rhs becomes the solution. ---*/
 
     /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem - 1) * nVar * nVar], &lineletVector[(nElem - 1) * nVar]);
+    auto* inv_dn = &invDiag[(nElem - 1) * blkSize * C];
+    for (auto i = 0ul; i < blkSize * C; i++) block[i] = inv_dn[i];
+    batchInverse(block, inv_dn);
+    for (auto i = 0ul; i < nVar * C; i++) aux[i] = rhs[(nElem - 1) * nVar * C + i];
+    batchMatVec(inv_dn, aux, &rhs[(nElem - 1) * nVar * C], false);
 
     /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
     for (auto iElem = nElem - 1; iElem > 0; --iElem) {
-      const auto* inv_dm1 = &lineletInvDiag[(iElem - 1) * nVar * nVar];
-      MatrixVectorProduct(lineletUpper[iElem - 1], &lineletVector[iElem * nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem - 1) * nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem - 1) * nVar]);
+      auto* x_im1 = &rhs[(iElem - 1) * nVar * C];
+      batchMatVec(&upper[(iElem - 1) * blkSize * C], &rhs[iElem * nVar * C], x_im1, true);
+      for (auto i = 0ul; i < nVar * C; i++) aux[i] = x_im1[i];
+      batchMatVec(&invDiag[(iElem - 1) * blkSize * C], aux, x_im1, false);
     }
 
-    /*--- Copy results to product vector ---*/
+    /*--- Copy results to product vector. ---*/
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = lineletVector[iElem * nVar + iVar];
+    for (auto k = 0ul; k < C; k++) {
+      const auto size = lineletSize(k);
+      for (auto iElem = 0ul; iElem < size; iElem++) {
+        const auto iPoint = li.linelets[lanes[k]][iElem];
+        for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iPoint * nVar + iVar] = rhs[(iElem * nVar + iVar) * C + k];
+      }
     }
   }
   END_SU2_OMP_FOR
@@ -1093,6 +2593,12 @@ void CSysMatrix<ScalarType>::TransposeInPlace() {
     }
   };
 
+  SU2_OMP_MASTER
+  sell.valid = false;
+  edge_fmt.valid = false;
+  gpu.valid = false;
+  END_SU2_OMP_MASTER
+
   /*--- Swap ij with ji and transpose them. ---*/
 
   if (edge_ptr) {
@@ -1160,6 +2666,12 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
     SU2_MPI::Error("Matrices do not have compatible sparsity.", CURRENT_FUNCTION);
   }
 
+  SU2_OMP_MASTER
+  sell.valid = false;
+  edge_fmt.valid = false;
+  gpu.valid = false;
+  END_SU2_OMP_MASTER
+
   SU2_OMP_FOR_STAT(omp_light_size)
   for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix[i] += alpha * B.matrix[i];
   END_SU2_OMP_FOR
@@ -1194,6 +2706,64 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetAMGRigidBodyModes(const CGeometry* geometry) {
+  const auto nDim = geometry->GetnDim();
+  const unsigned long nModes = (nDim == 2) ? 3 : 6;
+
+  /*--- Relative to the centroid of the rank, for the conditioning of the local QR factorizations. ---*/
+  su2double center[3] = {0.0};
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iDim = 0u; iDim < nDim; ++iDim) center[iDim] += geometry->nodes->GetCoord(iPoint, iDim) / nPointDomain;
+
+  std::vector<ScalarType> modes(nPointDomain * nVar * nModes, 0);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    su2double x[3] = {0.0};
+    for (auto iDim = 0u; iDim < nDim; ++iDim) x[iDim] = geometry->nodes->GetCoord(iPoint, iDim) - center[iDim];
+
+    auto mode = [&](unsigned long iVar, unsigned long iMode) -> ScalarType& {
+      return modes[(iPoint * nVar + iVar) * nModes + iMode];
+    };
+    /*--- Translations. ---*/
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) mode(iVar, iVar) = 1;
+
+    /*--- Rotations about z, and for 3D about x and y. ---*/
+    mode(0, nDim) = SU2_TYPE::GetValue(-x[1]);
+    mode(1, nDim) = SU2_TYPE::GetValue(x[0]);
+    if (nDim == 3) {
+      mode(1, 4) = SU2_TYPE::GetValue(-x[2]);
+      mode(2, 4) = SU2_TYPE::GetValue(x[1]);
+      mode(0, 5) = SU2_TYPE::GetValue(x[2]);
+      mode(2, 5) = SU2_TYPE::GetValue(-x[0]);
+    }
+  }
+  amg_hierarchy.SetNearNullSpace(nModes, std::move(modes));
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig* config) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    amg_hierarchy.SetParameters(config->GetLinear_Solver_AMG_Levels(), config->GetLinear_Solver_AMG_Smooth());
+    amg_hierarchy.Build(nVar, nPointDomain, row_ptr, col_ind, matrix);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  amg_hierarchy.Apply(vec, prod);
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 /*--- Explicit instantiations ---*/
 
 #define INSTANTIATE_COMMS(TYPE)                                                                                       \
@@ -1217,6 +2787,10 @@ INSTANTIATE_MATRIX(su2mixedfloat)
 #ifdef USE_MIXED_PRECISION
 INSTANTIATE_MATRIX(passivedouble)
 #endif
+/*--- Single precision copies of the matrices of solvers that opt in at runtime. ---*/
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+INSTANTIATE_MATRIX(su2singlefloat)
+#endif
 #ifdef CODI_REVERSE_TYPE
 INSTANTIATE_COMMS(su2double)
 #endif
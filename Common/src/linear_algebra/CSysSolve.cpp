@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CPhaseTimers.hpp"
 
 #include <limits>
 
@@ -49,6 +50,30 @@ template <>
 constexpr float linSolEpsilon<float>() {
   return 1e-12;
 }
+
+/*!
+ * \brief Deflated product (I - C*C^T)*A, for C with orthonormal columns, used by RECYCLED_FGMRES.
+ */
+template <class ScalarType>
+class CDeflatedProduct final : public CMatrixVectorProduct<ScalarType> {
+ private:
+  const CMatrixVectorProduct<ScalarType>& product;
+  const std::vector<CSysVector<ScalarType>>& C;
+  const std::vector<unsigned long>& basis;
+
+ public:
+  CDeflatedProduct(const CMatrixVectorProduct<ScalarType>& product_, const std::vector<CSysVector<ScalarType>>& C_,
+                   const std::vector<unsigned long>& basis_)
+      : product(product_), C(C_), basis(basis_) {}
+
+  void operator()(const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v) const override {
+    product(u, v);
+    for (const auto j : basis) {
+      const ScalarType proj = v.dot(C[j]);
+      v -= proj * C[j];
+    }
+  }
+};
 }  // namespace
 
 template <class ScalarType>
@@ -172,6 +197,57 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg,
+                                                 vector<CSysVector<ScalarType> >& w) const {
+  const auto thread = omp_get_thread_num();
+  const auto n = static_cast<unsigned long>(i + 1);
+
+  /*--- Projections on the first n vectors, followed by the squared norm of w[i+1]. ---*/
+
+  vector<ScalarType> h(n + 1, 0.0), c(n + 1, 0.0);
+
+  /*--- First pass, the norm of the vector is reduced together with the projections. ---*/
+
+  w[i + 1].localMultiDot(n, w.data(), h.data(), true);
+  CSysVector<ScalarType>::reduceSums(n + 1, h.data());
+
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
+
+  if ((h[n] <= 0.0) || (h[n] != h[n])) {
+    /*--- nrm is the result of a dot product, communications are implicitly handled. ---*/
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  w[i + 1].subtractLinComb(n, h.data(), w.data());
+
+  /*--- Second pass (reorthogonalization), "twice is enough". ---*/
+
+  w[i + 1].localMultiDot(n, w.data(), c.data(), true);
+  CSysVector<ScalarType>::reduceSums(n + 1, c.data());
+
+  w[i + 1].subtractLinComb(n, c.data(), w.data());
+
+  /*--- Norm of the resulting vector by Pythagoras, unless there is too much cancellation. ---*/
+
+  ScalarType nrm = c[n];
+  for (auto k = 0ul; k < n; ++k) nrm -= pow(c[k], 2);
+  if (nrm < 0.5 * c[n]) nrm = w[i + 1].squaredNorm();
+  nrm = sqrt(nrm);
+
+  /*--- If Hsbg is shared by multiple threads calling this function, only one
+   * thread can write into it. If Hsbg is private, all threads need to write. ---*/
+
+  if (!shared_hsbg || thread == 0) {
+    for (auto k = 0ul; k < n; ++k) Hsbg(k, i) = h[k] + c[k];
+    Hsbg(i + 1, i) = nrm;
+  }
+
+  /*--- Scale the resulting vector ---*/
+
+  w[i + 1] /= nrm;
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -250,7 +326,7 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType>&
 
     /*--- Set the norm to the initial initial residual value ---*/
 
-    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = (tolRefNorm > 0) ? tolRefNorm : norm_r;
 
     if ((norm_r < tol * norm0) || (norm_r < eps)) {
       if (masterRank && (lin_sol_mode != LINEAR_SOLVER_MODE::MESH_DEFORM)) {
@@ -290,20 +366,27 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType>&
     /*--- Update solution and residual: ---*/
 
     x += alpha * p;
-    r -= alpha * A_x;
 
     /*--- Only compute the residuals in full communication mode. ---*/
 
     if (config->GetComm_Level() == COMM_FULL) {
+      /*--- The norm is computed in the same pass as the update of the residual. ---*/
+
+      ScalarType sumSq = 0.0;
+      r.localAxpyMultiDot(-alpha, A_x, 0, nullptr, &sumSq);
+      CSysVector<ScalarType>::reduceSums(1, &sumSq);
+
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
+      norm_r = sqrt(sumSq);
       if (norm_r < tol * norm0) break;
       if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
         SU2_OMP_MASTER
         WriteHistory(i + 1, norm_r / norm0);
         END_SU2_OMP_MASTER
       }
+    } else {
+      r -= alpha * A_x;
     }
 
     precond(r, z);
@@ -352,7 +435,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
                                                       unsigned long m, ScalarType& residual, bool monitoring,
-                                                      const CConfig* config) const {
+                                                      const CConfig* config, bool classical_gs) const {
   const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
   const bool flexible = !precond.IsIdentity();
   /*--- If we call the solver outside of a parallel region, but the number of threads allows,
@@ -412,7 +495,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   /*--- Set the norm to the initial initial residual value ---*/
 
-  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = (tolRefNorm > 0) ? tolRefNorm : beta;
 
   if ((beta < tol * norm0) || (beta < eps)) {
     /*--- System is already solved ---*/
@@ -465,15 +548,22 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       mat_vec(W[i], W[i + 1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified (or classical) Gram-Schmidt orthogonalization ---*/
+
+    auto Orthogonalize = [&](bool shared_hsbg) {
+      if (classical_gs)
+        ClassicalGramSchmidt(shared_hsbg, i, H, W);
+      else
+        ModGramSchmidt(shared_hsbg, i, H, W);
+    };
 
     if (nestedParallel) {
       /*--- "omp parallel if" does not work well here ---*/
       SU2_OMP_PARALLEL
-      ModGramSchmidt(true, i, H, W);
+      Orthogonalize(true);
       END_SU2_OMP_PARALLEL
     } else {
-      ModGramSchmidt(false, i, H, W);
+      Orthogonalize(false);
     }
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
@@ -504,10 +594,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   if (nestedParallel) {
     SU2_OMP_PARALLEL
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+    x.addLinComb(i, y.data(), basis.data());
     END_SU2_OMP_PARALLEL
   } else {
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+    x.addLinComb(i, y.data(), basis.data());
   }
 
   /*---  Recalculate final (neg.) residual (this should be optional) ---*/
@@ -564,6 +654,361 @@ unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarTy
   return 0;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::RecycledFGMRES_LinSolver(const CSysVector<ScalarType>& b,
+                                                              CSysVector<ScalarType>& x,
+                                                              const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                              const CPreconditioner<ScalarType>& precond,
+                                                              ScalarType tol, unsigned long m, ScalarType& residual,
+                                                              bool monitoring, const CConfig* config) {
+  const auto maxRecycle = config->GetLinear_Solver_Recycle_Size();
+
+  if (maxRecycle == 0) return FGMRES_LinSolver(b, x, mat_vec, precond, tol, m, residual, monitoring, config);
+
+  /*--- Allocate, or discard the subspace if the system size changed. ---*/
+
+  if (RecycleU.size() != maxRecycle || RecycleDx.GetLocSize() != x.GetLocSize()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      RecycleU.resize(maxRecycle);
+      RecycleC.resize(maxRecycle);
+      for (auto& u : RecycleU) u.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto& c : RecycleC) c.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      RecycleR.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      RecycleDx.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      recycleSize = 0;
+      recycleNext = 0;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- The inner FGMRES works on the correction, with an absolute tolerance (w.r.t. the deflated residual). ---*/
+
+  const bool xWasZero = xIsZero;
+  const auto tolTypeIn = tol_type;
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    xIsZero = true;
+    tol_type = LinearToleranceType::ABSOLUTE;
+  }
+  END_SU2_OMP_MASTER
+
+  /*--- Products of the recycled directions with the current matrix, orthonormalized by modified Gram-Schmidt,
+   * the same operations are applied to the directions to keep C = A*U. Directions that became (numerically)
+   * dependent are skipped. All threads have the same (reduced) dot products and therefore the same basis. ---*/
+
+  std::vector<unsigned long> basis;
+  basis.reserve(recycleSize);
+
+  for (auto j = 0ul; j < recycleSize; ++j) {
+    mat_vec(RecycleU[j], RecycleC[j]);
+    const ScalarType norm = RecycleC[j].norm();
+    for (const auto k : basis) {
+      const ScalarType proj = RecycleC[j].dot(RecycleC[k]);
+      RecycleC[j] -= proj * RecycleC[k];
+      RecycleU[j] -= proj * RecycleU[k];
+    }
+    const ScalarType normOrth = RecycleC[j].norm();
+    if (normOrth <= 1e-6 * norm || normOrth < eps) continue;
+    RecycleC[j] /= normOrth;
+    RecycleU[j] /= normOrth;
+    basis.push_back(j);
+  }
+
+  /*--- Initial residual and its projection onto span(C), which improves the initial guess. ---*/
+
+  if (xWasZero) {
+    RecycleR = b;
+  } else {
+    mat_vec(x, RecycleR);
+    RecycleR = b - RecycleR;
+  }
+  ScalarType normRef = (tolTypeIn == LinearToleranceType::ABSOLUTE) ? b.norm() : RecycleR.norm();
+  if (tolTypeIn == LinearToleranceType::RELATIVE && tolRefNorm > 0) normRef = tolRefNorm;
+
+  for (const auto j : basis) {
+    const ScalarType proj = RecycleC[j].dot(RecycleR);
+    x += proj * RecycleU[j];
+    RecycleR -= proj * RecycleC[j];
+  }
+  const ScalarType normR = RecycleR.norm();
+
+  unsigned long iter = 0;
+  RecycleDx = ScalarType(0);
+
+  if (normR < tol * normRef || normR < eps) {
+    residual = normR / normRef;
+  } else {
+    /*--- FGMRES on the deflated operator, its residual is the true residual of x + dx - U*C^T*A*dx. ---*/
+
+    const CDeflatedProduct<ScalarType> deflated(mat_vec, RecycleC, basis);
+    iter = FGMRES_LinSolver(RecycleR, RecycleDx, deflated, precond, tol * normRef / normR, m, residual, monitoring,
+                            config);
+    residual *= normR / normRef;
+
+    /*--- Complete the correction with the recycled directions and update the solution. ---*/
+
+    mat_vec(RecycleDx, RecycleR);
+    for (const auto j : basis) {
+      const ScalarType proj = RecycleC[j].dot(RecycleR);
+      RecycleDx -= proj * RecycleU[j];
+    }
+    x += RecycleDx;
+
+    /*--- Keep the correction, replacing the oldest direction. ---*/
+
+    RecycleU[recycleNext] = RecycleDx;
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      recycleSize = min(recycleSize + 1, maxRecycle);
+      recycleNext = (recycleNext + 1) % maxRecycle;
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  SU2_OMP_MASTER {
+    xIsZero = xWasZero;
+    tol_type = tolTypeIn;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  return iter;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long m, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. The Z basis is always needed, even without preconditioner,
+   * because the directions are not exactly the (delayed) orthonormalized W vectors. ---*/
+
+  if (W.size() <= m || Z.size() <= m) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      Z.resize(m + 1);
+      for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Define various arrays, see FGMRES_LinSolver. "sums" holds the results of the single reduction
+   * of each iteration, [W[0:i-1]^T W[i], |W[i]|^2, W[0:i-1]^T W[i+1], W[i]^T W[i+1]]. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m);
+  H = ScalarType(0);
+  vector<ScalarType> sums(2 * m + 2), h(m + 1);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = (tolRefNorm > 0) ? tolRefNorm : beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  /*--- Normalize residual to get w_{0} (the negative sign is because w[0]
+        holds the negative residual, as mentioned above). ---*/
+
+  W[0] /= -beta;
+
+  /*--- Initialize the RHS of the reduced system ---*/
+
+  g[0] = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PFGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Reorthogonalize W[j] (given its partial sums "s" and "alpha", the sum of its squared coefficients "ss")
+   * and return its norm. The norm is not computed explicitly unless there is too much cancellation. ---*/
+
+  auto Reorthogonalize = [&](unsigned long j, const ScalarType* s, ScalarType alpha, ScalarType ss) {
+    W[j].subtractLinComb(j, s, W.data());
+    ScalarType nu2 = alpha - ss;
+    if (nu2 < 0.5 * alpha) nu2 = W[j].squaredNorm();
+
+    if ((nu2 <= 0.0) || (nu2 != nu2)) {
+      /*--- nu2 is the result of dot products, communications are implicitly handled. ---*/
+      SU2_MPI::Error("PFGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+    return sqrt(nu2);
+  };
+
+  /*--- Complete column j of the Hessenberg matrix, apply the Givens rotations, and update the residual. ---*/
+
+  auto FinalizeColumn = [&](unsigned long j, const ScalarType* s, ScalarType nu) {
+    for (unsigned long k = 0; k <= j; k++) H[k][j] += s[k];
+    H[j + 1][j] = nu;
+
+    for (unsigned long k = 0; k < j; k++) ApplyGivens(sn[k], cs[k], H[k][j], H[k + 1][j]);
+    GenerateGivens(H[j][j], H[j + 1][j], sn[j], cs[j]);
+    ApplyGivens(sn[j], cs[j], g[j], g[j + 1]);
+
+    beta = fabs(g[j + 1]);
+
+    if ((((monitoring) && (masterRank)) && ((j + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(j + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  };
+
+  /*---  Loop over all search directions. On entry to iteration i, W[0:i-1] are orthonormal and
+   W[i] was projected once on them (it is neither reorthogonalized nor normalized). ---*/
+
+  for (i = 0; i < m; i++) {
+    /*---  Precondition W[i] and add to Krylov subspace ---*/
+
+    precond(W[i], Z[i]);
+    mat_vec(Z[i], W[i + 1]);
+
+    /*--- Single global reduction for the delayed reorthogonalization and normalization of W[i],
+     and the first projection of W[i+1]. ---*/
+
+    ScalarType* s = sums.data();
+    ScalarType* t = s + i + 1;
+    for (unsigned long k = 0; k < 2 * i + 2; k++) sums[k] = 0.0;
+
+    W[i].localMultiDot(i, W.data(), s, true);
+    W[i + 1].localMultiDot(i + 1, W.data(), t);
+    CSysVector<ScalarType>::reduceSums(2 * i + 2, s);
+
+    ScalarType nu = 1.0, nu2 = 1.0, st = 0.0;
+
+    if (i > 0) {
+      ScalarType ss = 0.0;
+      for (unsigned long k = 0; k < i; k++) {
+        ss += s[k] * s[k];
+        st += s[k] * t[k];
+      }
+      nu = Reorthogonalize(i, s, s[i], ss);
+      nu2 = nu * nu;
+
+      /*--- Normalize, Z[i] and W[i+1] are scaled to keep A * Z[i] = W[i+1]. ---*/
+
+      W[i] /= nu;
+      Z[i] /= nu;
+      W[i + 1] /= nu;
+
+      /*--- The previous column is now complete. ---*/
+
+      FinalizeColumn(i - 1, s, nu);
+
+      /*---  Check if solution has converged ---*/
+
+      if (beta < tol * norm0) break;
+    }
+
+    /*--- First (classical) projection of W[i+1], correcting the coefficients for the scaling and
+     reorthogonalization of W[i]. ---*/
+
+    for (unsigned long k = 0; k < i; k++) h[k] = t[k] / nu;
+    h[i] = (t[i] - st) / nu2;
+
+    W[i + 1].subtractLinComb(i + 1, h.data(), W.data());
+    for (unsigned long k = 0; k <= i; k++) H[k][i] = h[k];
+  }
+
+  /*--- If all directions were used, the last column still needs its delayed correction. ---*/
+
+  if (i == m) {
+    ScalarType* s = sums.data();
+    for (unsigned long k = 0; k <= m; k++) sums[k] = 0.0;
+
+    W[m].localMultiDot(m, W.data(), s, true);
+    CSysVector<ScalarType>::reduceSums(m + 1, s);
+
+    ScalarType ss = 0.0;
+    for (unsigned long k = 0; k < m; k++) ss += s[k] * s[k];
+    const ScalarType nu = Reorthogonalize(m, s, s[m], ss);
+
+    FinalizeColumn(m - 1, s, nu);
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  x.addLinComb(i, y.data(), Z.data());
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PFGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -617,7 +1062,7 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
     /*--- Set the norm to the initial initial residual value ---*/
 
-    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = (tolRefNorm > 0) ? tolRefNorm : norm_r;
 
     if ((norm_r < tol * norm0) || (norm_r < eps)) {
       if (masterRank) {
@@ -645,6 +1090,7 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   p = ScalarType(0.0);
   v = ScalarType(0.0);
   r_0 = r;
+  ScalarType r_dot_r0 = r.dot(r_0);
 
   /*--- Loop over all search directions ---*/
 
@@ -653,9 +1099,9 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
     rho_prime = rho;
 
-    /*--- Compute rho_i ---*/
+    /*--- Compute rho_i, (r, r_0) was computed with the last update of the residual. ---*/
 
-    rho = r.dot(r_0);
+    rho = r_dot_r0;
 
     /*--- Compute beta ---*/
 
@@ -685,23 +1131,31 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
     precond(r, z);
     mat_vec(z, A_x);
 
-    /*--- Calculate step-length omega, avoid division by 0. ---*/
+    /*--- Calculate step-length omega, avoid division by 0. Both products with a single reduction. ---*/
 
-    omega = A_x.squaredNorm();
-    if (omega == ScalarType(0)) break;
-    omega = A_x.dot(r) / omega;
+    ScalarType sums[2] = {0.0, 0.0};
+    A_x.localMultiDot(1, &r, sums, true);
+    CSysVector<ScalarType>::reduceSums(2, sums);
 
-    /*--- Update solution and residual ---*/
+    if (sums[1] == ScalarType(0)) break;
+    omega = sums[0] / sums[1];
+
+    /*--- Update solution and residual, (r, r_0) for the next iteration and
+     *    the norm of the residual are computed in the same pass. ---*/
 
     x += omega * z;
-    r -= omega * A_x;
+
+    sums[0] = sums[1] = 0.0;
+    r.localAxpyMultiDot(-omega, A_x, 1, &r_0, sums);
+    CSysVector<ScalarType>::reduceSums(2, sums);
+    r_dot_r0 = sums[0];
 
     /*--- Only compute the residuals in full communication mode. ---*/
 
     if (config->GetComm_Level() == COMM_FULL) {
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
+      norm_r = sqrt(sums[1]);
       if (norm_r < tol * norm0) break;
       if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
         SU2_OMP_MASTER
@@ -790,7 +1244,7 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 
     /*--- Set the norm to the initial initial residual value ---*/
 
-    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = (tolRefNorm > 0) ? tolRefNorm : norm_r;
 
     if ((norm_r < tol * norm0) || (norm_r < eps)) {
       if (masterRank) {
@@ -862,10 +1316,36 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   return i;
 }
 
+template <class ScalarType>
+ScalarType CSysSolve<ScalarType>::ForcingTerm(ScalarType resNorm, ScalarType minTol, const CConfig* config) {
+  const auto& param = config->GetLinear_Solver_Forcing_Param();
+  const ScalarType gamma = SU2_TYPE::GetValue(param[0]);
+  const ScalarType alpha = SU2_TYPE::GetValue(param[1]);
+  const ScalarType maxTol = SU2_TYPE::GetValue(param[2]);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    /*--- The first solve uses the maximum tolerance. The safeguard prevents the tolerance from
+     * decreasing much faster than the nonlinear residual, e.g. after one lucky iteration. ---*/
+    ScalarType eta = maxTol;
+    if (forcingResOld > 0) {
+      eta = gamma * pow(resNorm / forcingResOld, alpha);
+      const ScalarType safe = gamma * pow(forcingTol, alpha);
+      if (safe > 0.1) eta = max(eta, safe);
+    }
+    forcingTol = min(max(eta, minTol), maxTol);
+    forcingResOld = resNorm;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  return forcingTol;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                            CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                            const CConfig* config) {
+  SU2_PHASE_TIMER(LINEAR_SOLVER);
+
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -946,15 +1426,40 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     HandleTemporariesIn(LinSysRes, LinSysSol);
 
+    Jacobian.FinalizeStorage();
+
     auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
     const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(KindPrecond);
 
     auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-    /*--- Build preconditioner. ---*/
+    /*--- Build the preconditioner, or reuse the factors of the last build if the user allows it, they are not
+     * too old, and the linear iterations have not grown too much. The reused factors remain valid because
+     * they are stored separately from the matrix. In mesh deformation mode the stiffness matrix is reused for
+     * as many solves (see DEFORM_STIFFNESS_REUSE). Never reused when recording or in the other modes.
+     * If the caller guarantees the matrix did not change, the factors are exact and always kept. ---*/
 
-    precond->Build();
+    auto maxReuse = 0ul;
+    if (!TapeActive) {
+      if (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD) maxReuse = config->GetLinear_Solver_Prec_Reuse();
+      if (lin_sol_mode == LINEAR_SOLVER_MODE::MESH_DEFORM) maxReuse = config->GetDeform_Stiffness_Reuse();
+    }
+    const auto maxIter = SU2_TYPE::GetValue(config->GetLinear_Solver_Prec_Reuse_Growth()) * precondBuildIter;
+    const bool keep = matrixUnchanged && !TapeActive;
+    const bool rebuild = (precondAge == 0) || (!keep && ((precondAge > maxReuse) || (Iterations > maxIter)));
+
+    if (rebuild) precond->Build();
+
+    /*--- Inexact Newton, the tolerance follows the reduction of the nonlinear residual (the right hand side).
+     * The final residual is scaled back to what it would be w.r.t. the fixed tolerance, to keep the CFL
+     * adaptation (which compares it with LINEAR_SOLVER_ERROR) consistent, as in CNewtonIntegration. ---*/
+
+    const ScalarType fixedTol = SolverTol;
+    if (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD && !TapeActive &&
+        config->GetKind_Linear_Solver_Forcing() == LINEAR_SOLVER_FORCING::EISENSTAT_WALKER) {
+      SolverTol = ForcingTerm(LinSysRes_ptr->norm(), SolverTol, config);
+    }
 
     /*--- Solve system. ---*/
 
@@ -973,6 +1478,18 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case FGMRES_CGS:
+        IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config, true);
+        break;
+      case PIPELINED_FGMRES:
+        IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                       ScreenOutput, config);
+        break;
+      case RECYCLED_FGMRES:
+        IterLinSol = RecycledFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                              residual, ScreenOutput, config);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
@@ -993,8 +1510,13 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     }
 
     SU2_OMP_MASTER {
-      Residual = residual;
+      Residual = residual * fixedTol / SolverTol;
       Iterations = IterLinSol;
+      if (rebuild) {
+        precondAge = 0;
+        precondBuildIter = IterLinSol;
+      }
+      ++precondAge;
     }
     END_SU2_OMP_MASTER
 
@@ -1026,6 +1548,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+          break;
+        case IC:
+          if (RequiresTranspose) Jacobian.BuildICPreconditioner();
+          break;
         case LU_SGS:
           /*--- Nothing to build. ---*/
           break;
@@ -1059,6 +1587,8 @@ template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                              CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                              const CConfig* config, const bool directCall) {
+  SU2_PHASE_TIMER(LINEAR_SOLVER);
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, IterLinSol = 0;
   ScalarType SolverTol;
@@ -1110,6 +1640,8 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
     precond->Build();
   }
 
+  Jacobian.FinalizeStorage();
+
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
   /*--- Solve the system ---*/
@@ -1128,6 +1660,18 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                    ScreenOutput, config, true);
+      break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                     ScreenOutput, config);
+      break;
+    case RECYCLED_FGMRES:
+      IterLinSol = RecycledFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                            residual, ScreenOutput, config);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
@@ -1174,4 +1718,7 @@ template class CSysSolve<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CSysSolve<passivedouble>;
 #endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+template class CSysSolve<su2singlefloat>;
+#endif
 #endif
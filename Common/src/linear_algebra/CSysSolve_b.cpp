@@ -76,4 +76,7 @@ template class CSysSolve_b<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CSysSolve_b<passivedouble>;
 #endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+template class CSysSolve_b<su2singlefloat>;
+#endif
 #endif
@@ -50,7 +50,12 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
 
   omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
 
-  if (vec_val == nullptr) vec_val = MemoryAllocation::aligned_alloc<ScalarType, true>(64, nElm * sizeof(ScalarType));
+  /*--- Zeroed by all threads with the schedule of the vector operations (NUMA first touch). ---*/
+  if (vec_val == nullptr) {
+    SU2_MEMORY_SCOPE(LINEAR_SYSTEM);
+    vec_val = MemoryAllocation::aligned_alloc<ScalarType>(64, nElm * sizeof(ScalarType));
+    firstTouchZero(nElm, vec_val, omp_chunk_size);
+  }
 
   if (val != nullptr) {
     if (!valIsArray) {
@@ -78,3 +83,6 @@ template class CSysVector<su2mixedfloat>;
 #ifdef CODI_REVERSE_TYPE
 template class CSysVector<passivedouble>;
 #endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+template class CSysVector<su2singlefloat>;
+#endif
@@ -0,0 +1,170 @@
+/*!
+ * \file CDistributedNearestNeighbor.cpp
+ * \brief Implementation of the distributed nearest neighbor search (see hpp).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CDistributedNearestNeighbor.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <limits>
+#include <numeric>
+
+CDistributedNearestNeighbor::CDistributedNearestNeighbor(unsigned short nDim_, unsigned long nTarget,
+                                                         const su2double* coord)
+    : nDim(nDim_), targetCoord(nTarget, nDim_) {
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget)
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      targetCoord(iTarget, iDim) = SU2_TYPE::GetValue(coord[iTarget * nDim + iDim]);
+}
+
+void CDistributedNearestNeighbor::Search(unsigned long nDonor, unsigned long nValue, const passivedouble* donorData,
+                                         su2passivematrix& targetData, vector<passivedouble>& targetDist) const {
+  using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+  const int size = SU2_MPI::GetSize();
+  const auto big = numeric_limits<passivedouble>::max();
+  const auto nTarget = targetCoord.rows();
+
+  targetData.resize(nTarget, nValue);
+  targetData = passivedouble(0.0);
+  targetDist.assign(nTarget, big);
+
+  /*--- Bounding box of the local targets, empty ranks have min > max and do not receive donors. ---*/
+
+  vector<passivedouble> localBox(2 * nDim);
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    localBox[iDim] = big;
+    localBox[nDim + iDim] = -big;
+  }
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      localBox[iDim] = min(localBox[iDim], targetCoord(iTarget, iDim));
+      localBox[nDim + iDim] = max(localBox[nDim + iDim], targetCoord(iTarget, iDim));
+    }
+  }
+
+  su2passivematrix boxes(size, 2 * nDim), prevBoxes;
+
+  auto gatherBoxes = [&]() {
+    MPIWrapper::Allgather(localBox.data(), 2 * nDim, MPI_DOUBLE, boxes.data(), 2 * nDim, MPI_DOUBLE,
+                          SU2_MPI::GetComm());
+  };
+
+  auto inBox = [&](const su2passivematrix& box, int iRank, const passivedouble* coord) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      if (coord[iDim] < box(iRank, iDim) || coord[iDim] > box(iRank, nDim + iDim)) return false;
+    }
+    return true;
+  };
+
+  /*--- Send the donors to the ranks whose box contains them (and that did not receive them before), then
+   * keep the nearest of the received donors for each target. ---*/
+
+  auto exchange = [&](bool secondRound) {
+    auto sendTo = [&](int iRank, const passivedouble* coord) {
+      return inBox(boxes, iRank, coord) && !(secondRound && inBox(prevBoxes, iRank, coord));
+    };
+
+    vector<int> sendCount(size, 0), recvCount(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+    for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+      for (int iRank = 0; iRank < size; ++iRank) sendCount[iRank] += sendTo(iRank, &donorData[iDonor * nValue]);
+    }
+    SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendDispl[iRank + 1] = sendDispl[iRank] + sendCount[iRank];
+      recvDispl[iRank + 1] = recvDispl[iRank] + recvCount[iRank];
+    }
+
+    su2passivematrix sendBuf(sendDispl[size], nValue), recvBuf(recvDispl[size], nValue);
+    auto pos = sendDispl;
+    for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+      const auto row = &donorData[iDonor * nValue];
+      for (int iRank = 0; iRank < size; ++iRank) {
+        if (!sendTo(iRank, row)) continue;
+        for (auto iValue = 0ul; iValue < nValue; ++iValue) sendBuf(pos[iRank], iValue) = row[iValue];
+        ++pos[iRank];
+      }
+    }
+
+    auto scaled = [&](const vector<int>& v) {
+      vector<int> w(v.size());
+      for (auto i = 0ul; i < v.size(); ++i) w[i] = nValue * v[i];
+      return w;
+    };
+    MPIWrapper::Alltoallv(sendBuf.data(), scaled(sendCount).data(), scaled(sendDispl).data(), MPI_DOUBLE,
+                          recvBuf.data(), scaled(recvCount).data(), scaled(recvDispl).data(), MPI_DOUBLE,
+                          SU2_MPI::GetComm());
+
+    const unsigned long nRecv = recvDispl[size];
+    if (nRecv == 0) return;
+
+    /*--- ADT of the received donors. ---*/
+
+    vector<su2double> coord(nRecv * nDim);
+    for (auto iRecv = 0ul; iRecv < nRecv; ++iRecv)
+      for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iRecv * nDim + iDim] = recvBuf(iRecv, iDim);
+
+    vector<unsigned long> index(nRecv);
+    iota(index.begin(), index.end(), 0ul);
+
+    CADTPointsOnlyClass adt(nDim, nRecv, coord.data(), index.data(), false);
+
+    SU2_OMP_PARALLEL_(for schedule(dynamic,128))
+    for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+      su2double coor[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) coor[iDim] = targetCoord(iTarget, iDim);
+
+      su2double dist;
+      unsigned long iDonor;
+      int iRank;
+      adt.DetermineNearestNode(coor, dist, iDonor, iRank);
+
+      if (SU2_TYPE::GetValue(dist) < targetDist[iTarget]) {
+        targetDist[iTarget] = SU2_TYPE::GetValue(dist);
+        for (auto iValue = 0ul; iValue < nValue; ++iValue) targetData(iTarget, iValue) = recvBuf(iDonor, iValue);
+      }
+    }
+    END_SU2_OMP_PARALLEL
+  };
+
+  gatherBoxes();
+  exchange(false);
+
+  /*--- The nearest donor of a target is at most as far as the one found, enlarge the boxes by the largest
+   * distance and send the donors that fall in the enlarged part. Targets without donors make it infinite. ---*/
+
+  if (nTarget > 0) {
+    const auto radius = *max_element(targetDist.begin(), targetDist.end());
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      localBox[iDim] = (radius < big) ? localBox[iDim] - radius : -big;
+      localBox[nDim + iDim] = (radius < big) ? localBox[nDim + iDim] + radius : big;
+    }
+  }
+  prevBoxes = boxes;
+
+  gatherBoxes();
+  exchange(true);
+}
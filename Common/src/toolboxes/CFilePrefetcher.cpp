@@ -0,0 +1,88 @@
+/*!
+ * \file CFilePrefetcher.cpp
+ * \brief Background reading of input files (meshes, restarts) to have them in the page cache when needed.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/toolboxes/CFilePrefetcher.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+
+void CFilePrefetcher::Add(const std::string& fileName) {
+  assert(!worker.Active() && "Files cannot be added while reading.");
+  if (fileName.empty() || std::find(files.begin(), files.end(), fileName) != files.end()) return;
+  files.push_back(fileName);
+}
+
+bool CFilePrefetcher::ReadChunk() {
+  while (iFile < files.size()) {
+    if (!stream.is_open()) {
+      stream.open(files[iFile], std::ios::in | std::ios::binary);
+      if (!stream.is_open()) {
+        ++iFile;
+        continue;
+      }
+    }
+    stream.read(buffer.data(), buffer.size());
+    bytesRead += stream.gcount();
+    if (stream) return false;
+    stream.close();
+    stream.clear();
+    ++iFile;
+    return iFile == files.size();
+  }
+  return true;
+}
+
+void CFilePrefetcher::Start() {
+  /*--- The page cache is shared by the ranks of a node, one of them is enough. ---*/
+
+  bool reader = (SU2_MPI::GetRank() == MASTER_NODE);
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, SU2_MPI::GetRank(), MPI_INFO_NULL, &nodeComm);
+  int nodeRank = 0;
+  MPI_Comm_rank(nodeComm, &nodeRank);
+  MPI_Comm_free(&nodeComm);
+  reader = (nodeRank == 0);
+#endif
+  if (!reader || files.empty()) return;
+
+  iFile = 0;
+  bytesRead = 0;
+  buffer.resize(CHUNK_SIZE);
+  worker.Start([this]() { return ReadChunk(); });
+}
+
+unsigned long CFilePrefetcher::Stop() {
+  worker.Stop();
+  if (stream.is_open()) stream.close();
+  stream.clear();
+  buffer.clear();
+  buffer.shrink_to_fit();
+  return bytesRead;
+}
@@ -0,0 +1,244 @@
+/*!
+ * \file CKernelCounters.cpp
+ * \brief Implementation of the kernel counters.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CKernelCounters.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#ifdef HAVE_PAPI
+#include <papi.h>
+#endif
+#ifdef HAVE_LIKWID
+#include <likwid-marker.h>
+#endif
+
+bool CKernelCounters::initialized = false;
+int CKernelCounters::eventCodes[NEVENT] = {0, 0};
+std::vector<CKernelCounters::ThreadData> CKernelCounters::threads;
+
+void CKernelCounters::Initialize() {
+  if (initialized) return;
+
+#ifdef HAVE_PAPI
+  if (PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT ||
+      PAPI_thread_init([]() { return static_cast<unsigned long>(omp_get_thread_num()); }) != PAPI_OK) {
+    if (SU2_MPI::GetRank() == MASTER_NODE)
+      std::cout << "WARNING: PAPI could not be initialized, the kernel counters are disabled." << std::endl;
+    return;
+  }
+  /*--- Preferred events first, not all are available on all machines. ---*/
+  const int flopEvents[] = {PAPI_DP_OPS, PAPI_FP_OPS};
+  const int missEvents[] = {PAPI_L3_TCM, PAPI_L2_TCM};
+  for (auto code : flopEvents) {
+    if (PAPI_query_event(code) == PAPI_OK) { eventCodes[0] = code; break; }
+  }
+  for (auto code : missEvents) {
+    if (PAPI_query_event(code) == PAPI_OK) { eventCodes[1] = code; break; }
+  }
+#endif
+#ifdef HAVE_LIKWID
+  LIKWID_MARKER_INIT;
+#endif
+
+  threads.resize(omp_get_max_threads());
+  initialized = true;
+}
+
+void CKernelCounters::InitializeThread(ThreadData& data) {
+  data.ready = true;
+#ifdef HAVE_PAPI
+  int eventSet = PAPI_NULL;
+  if (PAPI_register_thread() != PAPI_OK || PAPI_create_eventset(&eventSet) != PAPI_OK) return;
+  int nAdded = 0;
+  for (int iEvent = 0; iEvent < NEVENT; ++iEvent) {
+    if (eventCodes[iEvent] != 0 && PAPI_add_event(eventSet, eventCodes[iEvent]) == PAPI_OK) {
+      data.slot[iEvent] = nAdded++;
+    }
+  }
+  if (nAdded > 0 && PAPI_start(eventSet) == PAPI_OK) data.eventSet = eventSet;
+#endif
+#ifdef HAVE_LIKWID
+  LIKWID_MARKER_THREADINIT;
+  for (unsigned short iKernel = 0; iKernel < NKERNEL; ++iKernel) LIKWID_MARKER_REGISTER(GetName(iKernel));
+#endif
+}
+
+void CKernelCounters::ReadEvents(const ThreadData& data, long long* events) {
+#ifdef HAVE_PAPI
+  if (data.eventSet < 0) return;
+  long long values[NEVENT] = {};
+  if (PAPI_read(data.eventSet, values) != PAPI_OK) return;
+  for (int iEvent = 0; iEvent < NEVENT; ++iEvent) {
+    if (data.slot[iEvent] >= 0) events[iEvent] = values[data.slot[iEvent]];
+  }
+#endif
+}
+
+const char* CKernelCounters::GetName(unsigned short kernel) {
+  static const char* names[NKERNEL] = {"EDGE_LOOP", "SPMV", "ILU", "GRADIENTS", "PRIMITIVES"};
+  return names[kernel];
+}
+
+CKernelCounters::Sample CKernelCounters::Start(HW_KERNEL kernel) {
+  Sample start;
+  const auto iThread = omp_get_thread_num();
+  if (!initialized || iThread >= static_cast<int>(threads.size())) return start;
+
+  auto& data = threads[iThread];
+  if (!data.ready) InitializeThread(data);
+
+#ifdef HAVE_LIKWID
+  LIKWID_MARKER_START(GetName(static_cast<unsigned short>(kernel)));
+#endif
+  ReadEvents(data, start.events);
+  start.time = SU2_MPI::Wtime();
+  start.active = true;
+  return start;
+}
+
+void CKernelCounters::Stop(HW_KERNEL kernel, const Sample& start) {
+  if (!start.active) return;
+
+  const passivedouble elapsed = SU2_MPI::Wtime() - start.time;
+  auto& data = threads[omp_get_thread_num()];
+  long long events[NEVENT] = {};
+  ReadEvents(data, events);
+
+  const auto iKernel = static_cast<unsigned short>(kernel);
+#ifdef HAVE_LIKWID
+  LIKWID_MARKER_STOP(GetName(iKernel));
+#endif
+  data.time[iKernel] += elapsed;
+  data.calls[iKernel] += 1;
+  for (int iEvent = 0; iEvent < NEVENT; ++iEvent) data.events[iKernel][iEvent] += events[iEvent] - start.events[iEvent];
+}
+
+void CKernelCounters::Report(const std::string& fileName) {
+  if (!initialized) return;
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Per rank values: calls, time, GFLOP/s, GB/s. The threads run the kernels concurrently, the time is that of
+   * the slowest thread and the events are summed over threads. Rates are negative if the events were not counted. ---*/
+
+  enum : int { NVAL = 4 };
+  std::vector<passivedouble> local(NKERNEL * NVAL, 0.0);
+
+  for (unsigned short iKernel = 0; iKernel < NKERNEL; ++iKernel) {
+    passivedouble time = 0.0;
+    unsigned long calls = 0;
+    long long events[NEVENT] = {};
+    bool counted[NEVENT] = {};
+    for (const auto& data : threads) {
+      time = std::max(time, data.time[iKernel]);
+      calls = std::max(calls, data.calls[iKernel]);
+      for (int iEvent = 0; iEvent < NEVENT; ++iEvent) {
+        events[iEvent] += data.events[iKernel][iEvent];
+        counted[iEvent] |= (data.slot[iEvent] >= 0);
+      }
+    }
+    auto* val = &local[iKernel * NVAL];
+    val[0] = calls;
+    val[1] = time;
+    val[2] = (counted[0] && time > 0) ? 1e-9 * events[0] / time : -1.0;
+    val[3] = (counted[1] && time > 0) ? 1e-9 * LINE_SIZE * events[1] / time : -1.0;
+  }
+
+  std::vector<passivedouble> global(rank == MASTER_NODE ? size * NKERNEL * NVAL : 0);
+  SelectMPIWrapper<passivedouble>::W::Gather(local.data(), NKERNEL * NVAL, MPI_DOUBLE, global.data(), NKERNEL * NVAL,
+                                             MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+#ifdef HAVE_LIKWID
+  LIKWID_MARKER_CLOSE;
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Screen output, statistics over the ranks. ---*/
+
+  std::cout << "\n---------------------------- Kernel Counters ----------------------------" << std::endl;
+#ifdef HAVE_LIKWID
+  std::cout << "Times over " << size << " rank(s), the rates are reported by likwid-perfctr." << std::endl;
+#else
+  std::cout << "Rates per rank over " << size << " rank(s), memory traffic estimated from last level cache misses."
+            << std::endl;
+#endif
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Kernel", 12);
+  table.AddColumn("Calls", 9);
+  table.AddColumn("Avg. (s)", 10);
+  table.AddColumn("GFLOP/s", 10);
+  table.AddColumn("Min.", 9);
+  table.AddColumn("GB/s", 10);
+  table.AddColumn("Min.", 9);
+  table.AddColumn("FLOP/B", 8);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+
+  for (unsigned short iKernel = 0; iKernel < NKERNEL; ++iKernel) {
+    passivedouble calls = 0.0, time = 0.0, flops = 0.0, bytes = 0.0;
+    passivedouble minFlops = std::numeric_limits<passivedouble>::max(), minBytes = minFlops;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      const auto* val = &global[(iRank * NKERNEL + iKernel) * NVAL];
+      calls = std::max(calls, val[0]);
+      time += val[1] / size;
+      flops += val[2] / size;
+      bytes += val[3] / size;
+      minFlops = std::min(minFlops, val[2]);
+      minBytes = std::min(minBytes, val[3]);
+    }
+    if (calls == 0) continue;
+    table << GetName(iKernel) << static_cast<unsigned long>(calls) << time << flops << minFlops << bytes << minBytes
+          << (bytes > 0 && flops > 0 ? flops / bytes : 0.0);
+  }
+  table.PrintFooter();
+
+  /*--- CSV file with the values of each rank. ---*/
+
+  std::ofstream file(fileName);
+  if (!file.is_open()) {
+    std::cout << "WARNING: Could not open " << fileName << " to write the kernel counters." << std::endl;
+    return;
+  }
+  file.precision(9);
+  file << "\"Rank\",\"Kernel\",\"Calls\",\"Time\",\"GFLOP/s\",\"GB/s\"\n";
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (unsigned short iKernel = 0; iKernel < NKERNEL; ++iKernel) {
+      const auto* val = &global[(iRank * NKERNEL + iKernel) * NVAL];
+      file << iRank << ",\"" << GetName(iKernel) << "\"," << static_cast<unsigned long>(val[0]) << ',' << val[1] << ','
+           << val[2] << ',' << val[3] << '\n';
+    }
+  }
+  std::cout << "Kernel counters of each rank written to " << fileName << "." << std::endl;
+}
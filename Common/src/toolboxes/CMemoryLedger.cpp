@@ -0,0 +1,158 @@
+/*!
+ * \file CMemoryLedger.cpp
+ * \brief Reports of the memory ledger.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/toolboxes/CMemoryLedger.hpp"
+#include "../../include/toolboxes/CTapeStatistics.hpp"
+#include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#ifdef HAVE_MEMORY_LEDGER
+std::atomic<bool> CMemoryLedger::enabled{true};
+#else
+std::atomic<bool> CMemoryLedger::enabled{false};
+#endif
+
+namespace {
+/*--- Values of one rank, in MB: current and peak of each category and of the total, then the tape of
+ * the AD tool, the resident memory, and the peak resident memory of the process. ---*/
+enum : size_t { NROW = CMemoryLedger::NCAT + 4, NVAL = 2 * NROW };
+
+void LocalValues(passivedouble* val) {
+  constexpr passivedouble MB = 1.0 / (1ul << 20);
+  size_t current[CMemoryLedger::NCAT + 1], peak[CMemoryLedger::NCAT + 1];
+  CMemoryLedger::GetUsage(current, peak);
+  for (auto i = 0ul; i <= CMemoryLedger::NCAT; ++i) {
+    val[2 * i] = current[i] * MB;
+    val[2 * i + 1] = peak[i] * MB;
+  }
+  auto* extra = val + 2 * (CMemoryLedger::NCAT + 1);
+  extra[0] = CTapeStatistics::UsedMemory();
+  extra[1] = -1.0;
+  extra[2] = MemoryAllocation::ResidentMemory() * MB;
+  extra[3] = MemoryAllocation::PeakResidentMemory() * MB;
+}
+
+const char* RowName(size_t iRow) {
+  static const char* extraNames[] = {"TOTAL", "AD_TAPE", "RESIDENT"};
+  if (iRow < CMemoryLedger::NCAT) return CMemoryLedger::Name(iRow);
+  return extraNames[iRow - CMemoryLedger::NCAT];
+}
+}  // namespace
+
+const char* CMemoryLedger::Name(size_t iCat) {
+  static const char* names[NCAT] = {"GEOMETRY", "SOLVER", "SPARSE_MATRIX", "LINEAR_SYSTEM", "INTERFACE", "OTHER"};
+  return iCat < NCAT ? names[iCat] : "";
+}
+
+std::map<std::string, double> CMemoryLedger::Summary() {
+  passivedouble val[NVAL];
+  LocalValues(val);
+
+  std::map<std::string, double> summary;
+  for (auto iRow = 0ul; iRow < NROW; ++iRow) {
+    summary[RowName(iRow)] = val[2 * iRow];
+    if (val[2 * iRow + 1] >= 0) summary[std::string(RowName(iRow)) + "_PEAK"] = val[2 * iRow + 1];
+  }
+  return summary;
+}
+
+void CMemoryLedger::Report(const std::string& stage, const std::string& fileName) {
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  passivedouble local[NVAL];
+  LocalValues(local);
+
+  std::vector<passivedouble> global(rank == MASTER_NODE ? size * NVAL : 0);
+  SelectMPIWrapper<passivedouble>::W::Gather(local, NVAL, MPI_DOUBLE, global.data(), NVAL, MPI_DOUBLE, MASTER_NODE,
+                                             SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Screen output, statistics over the ranks. ---*/
+
+  std::cout << "\n-------------------------- Memory Ledger (MB) ---------------------------" << std::endl;
+  std::cout << stage << ", " << size << " rank(s). Peak is the high-water-mark of each rank." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Category", 15);
+  table.AddColumn("Rank 0", 10);
+  table.AddColumn("Min.", 10);
+  table.AddColumn("Max.", 10);
+  table.AddColumn("Peak rank 0", 12);
+  table.AddColumn("Peak max.", 10);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(5);
+  table.PrintHeader();
+
+  for (auto iRow = 0ul; iRow < NROW; ++iRow) {
+    passivedouble minVal = std::numeric_limits<passivedouble>::max(), maxVal = 0.0, maxPeak = 0.0;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      const auto* val = &global[iRank * NVAL + 2 * iRow];
+      minVal = std::min(minVal, val[0]);
+      maxVal = std::max(maxVal, val[0]);
+      maxPeak = std::max(maxPeak, val[1]);
+    }
+    /*--- Nothing to show for categories never used. ---*/
+    if (maxVal == 0 && maxPeak <= 0) continue;
+    const auto* val = &global[2 * iRow];
+    if (val[1] >= 0) {
+      table << RowName(iRow) << val[0] << minVal << maxVal << val[1] << maxPeak;
+    } else {
+      table << RowName(iRow) << val[0] << minVal << maxVal << "-" << "-";
+    }
+  }
+  table.PrintFooter();
+
+  /*--- CSV file with the values of each rank. ---*/
+
+  static bool firstCall = true;
+  std::ofstream file(fileName, firstCall ? std::ios::out : std::ios::app);
+  if (!file.is_open()) {
+    std::cout << "WARNING: Could not open " << fileName << " to write the memory ledger." << std::endl;
+    return;
+  }
+  if (firstCall) file << "\"Stage\",\"Rank\",\"Category\",\"Current\",\"Peak\"\n";
+  firstCall = false;
+
+  file.precision(9);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (auto iRow = 0ul; iRow < NROW; ++iRow) {
+      const auto* val = &global[iRank * NVAL + 2 * iRow];
+      file << '"' << stage << "\"," << iRank << ",\"" << RowName(iRow) << "\"," << val[0] << ',' << val[1] << '\n';
+    }
+  }
+  std::cout << "Memory ledger of each rank written to " << fileName << "." << std::endl;
+}
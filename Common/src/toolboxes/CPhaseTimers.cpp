@@ -0,0 +1,193 @@
+/*!
+ * \file CPhaseTimers.cpp
+ * \brief Implementation of the phase timers.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/toolboxes/CPhaseTimers.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+
+bool CPhaseTimers::enabled = false;
+bool CPhaseTimers::tracing = false;
+passivedouble CPhaseTimers::origin = 0.0;
+unsigned short CPhaseTimers::depth = 0;
+unsigned short CPhaseTimers::stack[MAX_DEPTH] = {0};
+passivedouble CPhaseTimers::totalTime[NPHASE + 1][NPHASE] = {{0.0}};
+unsigned long CPhaseTimers::numCalls[NPHASE + 1][NPHASE] = {{0}};
+std::vector<CPhaseTimers::Event> CPhaseTimers::events;
+
+void CPhaseTimers::Enable(bool trace) {
+  enabled = true;
+  tracing = trace;
+  origin = SU2_MPI::Wtime();
+  if (tracing) events.reserve(MAX_EVENTS / 16);
+}
+
+const char* CPhaseTimers::GetName(unsigned short phase) {
+  static const char* names[NPHASE] = {"Iteration", "Integration", "Preprocessing", "Convective residual",
+                                      "Viscous residual", "Source residual", "Gradients", "Limiters",
+                                      "Linear solver", "Halo comms", "Output"};
+  return phase < NPHASE ? names[phase] : "Total";
+}
+
+passivedouble CPhaseTimers::Start(TIMER_PHASE phase) {
+  if (depth < MAX_DEPTH) stack[depth] = static_cast<unsigned short>(phase);
+  ++depth;
+  return SU2_MPI::Wtime();
+}
+
+void CPhaseTimers::Stop(TIMER_PHASE phase, passivedouble startTime) {
+  const passivedouble elapsed = SU2_MPI::Wtime() - startTime;
+
+  --depth;
+  if (depth >= MAX_DEPTH) return;
+
+  const auto iPhase = static_cast<unsigned short>(phase);
+  const auto parent = (depth > 0) ? stack[depth - 1] : static_cast<unsigned short>(ROOT);
+
+  totalTime[parent][iPhase] += elapsed;
+  numCalls[parent][iPhase] += 1;
+
+  if (tracing && events.size() < MAX_EVENTS) {
+    events.push_back({startTime - origin, elapsed, iPhase, depth});
+  }
+}
+
+passivedouble CPhaseTimers::GetTotalTime(TIMER_PHASE phase) {
+  const auto iPhase = static_cast<unsigned short>(phase);
+  passivedouble total = 0.0;
+  for (unsigned short parent = 0; parent <= ROOT; ++parent) {
+    if (parent != iPhase) total += totalTime[parent][iPhase];
+  }
+  return total;
+}
+
+void CPhaseTimers::Report(const std::string& fileName) {
+  if (!enabled) return;
+
+  using MPI_Wrapper = typename SelectMPIWrapper<passivedouble>::W;
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+  constexpr int N = (NPHASE + 1) * NPHASE;
+
+  /*--- Reduce the times over all ranks. ---*/
+
+  passivedouble minTime[NPHASE + 1][NPHASE], maxTime[NPHASE + 1][NPHASE], sumTime[NPHASE + 1][NPHASE];
+  unsigned long maxCalls[NPHASE + 1][NPHASE];
+
+  MPI_Wrapper::Allreduce(totalTime, minTime, N, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  MPI_Wrapper::Allreduce(totalTime, maxTime, N, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPI_Wrapper::Allreduce(totalTime, sumTime, N, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(numCalls, maxCalls, N, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Flatten the hierarchy, depth first. The children of a phase are aggregated over all the
+   * occurrences of that phase, phases already in the current path are not revisited. ---*/
+
+  struct Row {
+    std::string name, path;
+    unsigned long calls;
+    passivedouble avg, min, max;
+  };
+  std::vector<Row> rows;
+  std::vector<unsigned short> path;
+
+  passivedouble totalAvg = 0.0;
+  for (auto iPhase = 0u; iPhase < NPHASE; ++iPhase) totalAvg += sumTime[ROOT][iPhase] / size;
+
+  std::function<void(unsigned short, const std::string&)> addChildren;
+  addChildren = [&](unsigned short parent, const std::string& parentPath) {
+    for (unsigned short iPhase = 0; iPhase < NPHASE; ++iPhase) {
+      if (maxCalls[parent][iPhase] == 0) continue;
+      if (std::find(path.begin(), path.end(), iPhase) != path.end()) continue;
+
+      const std::string name = GetName(iPhase);
+      const auto fullPath = parentPath.empty() ? name : parentPath + "/" + name;
+      rows.push_back({std::string(2 * path.size(), ' ') + name, fullPath, maxCalls[parent][iPhase],
+                      sumTime[parent][iPhase] / size, minTime[parent][iPhase], maxTime[parent][iPhase]});
+      path.push_back(iPhase);
+      addChildren(iPhase, fullPath);
+      path.pop_back();
+    }
+  };
+  addChildren(ROOT, "");
+
+  /*--- Screen output. ---*/
+
+  std::cout << "\n------------------------------ Phase Timers -----------------------------" << std::endl;
+  std::cout << "Inclusive wall-clock times over " << size << " rank(s), (%) of the average total." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Phase", 28);
+  table.AddColumn("Calls", 9);
+  table.AddColumn("Avg. (s)", 10);
+  table.AddColumn("Min. (s)", 10);
+  table.AddColumn("Max. (s)", 10);
+  table.AddColumn("(%)", 8);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+  for (const auto& row : rows) {
+    table << row.name << row.calls << row.avg << row.min << row.max
+          << (totalAvg > 0 ? 100 * row.avg / totalAvg : 0.0);
+  }
+  table.PrintFooter();
+
+  if (fileName.empty()) return;
+
+  /*--- JSON file in Chrome trace format, the summary is stored as metadata. ---*/
+
+  std::ofstream file(fileName);
+  if (!file.is_open()) {
+    std::cout << "WARNING: Could not open " << fileName << " to write the phase timers." << std::endl;
+    return;
+  }
+  file.precision(9);
+
+  file << "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [";
+  for (auto iEvent = 0ul; iEvent < events.size(); ++iEvent) {
+    const auto& event = events[iEvent];
+    file << (iEvent ? ",\n" : "\n") << "{\"name\": \"" << GetName(event.phase) << "\", \"ph\": \"X\", \"pid\": 0, "
+         << "\"tid\": 0, \"ts\": " << 1e6 * event.start << ", \"dur\": " << 1e6 * event.duration << "}";
+  }
+  file << "\n],\n\"nRanks\": " << size << ",\n\"phaseTimers\": [";
+  for (auto iRow = 0ul; iRow < rows.size(); ++iRow) {
+    const auto& row = rows[iRow];
+    file << (iRow ? ",\n" : "\n") << "{\"path\": \"" << row.path << "\", \"calls\": " << row.calls
+         << ", \"avg\": " << row.avg << ", \"min\": " << row.min << ", \"max\": " << row.max << "}";
+  }
+  file << "\n]\n}" << std::endl;
+
+  std::cout << "Phase timers written to " << fileName;
+  if (events.size() == MAX_EVENTS) std::cout << " (the trace was truncated)";
+  std::cout << "." << std::endl;
+}
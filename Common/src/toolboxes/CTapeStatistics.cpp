@@ -0,0 +1,96 @@
+/*!
+ * \file CTapeStatistics.cpp
+ * \brief Implementation of the tape statistics per kernel.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/toolboxes/CTapeStatistics.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+bool CTapeStatistics::enabled = false;
+passivedouble CTapeStatistics::memory[NKERNEL] = {0.0};
+unsigned long CTapeStatistics::numCalls[NKERNEL] = {0};
+
+void CTapeStatistics::Enable() {
+  enabled = true;
+  for (auto iKernel = 0u; iKernel < NKERNEL; ++iKernel) {
+    memory[iKernel] = 0.0;
+    numCalls[iKernel] = 0;
+  }
+}
+
+passivedouble CTapeStatistics::UsedMemory() {
+#ifdef CODI_REVERSE_TYPE
+  return AD::getTape().getTapeValues().getUsedMemorySize();
+#else
+  return 0.0;
+#endif
+}
+
+void CTapeStatistics::Report() {
+  if (!enabled) return;
+
+  using MPI_Wrapper = typename SelectMPIWrapper<passivedouble>::W;
+
+  static const char* names[NKERNEL] = {"Primitives",      "Convective residual", "Viscous residual",
+                                       "Source residual", "Turb. source residual", "Gradients", "Limiters"};
+
+  /*--- Reduce over all ranks, the last entry is the total memory of the tape. ---*/
+
+  passivedouble myMem[NKERNEL + 1], totMem[NKERNEL + 1];
+  for (auto iKernel = 0u; iKernel < NKERNEL; ++iKernel) myMem[iKernel] = memory[iKernel];
+  myMem[NKERNEL] = UsedMemory();
+  unsigned long maxCalls[NKERNEL];
+
+  MPI_Wrapper::Allreduce(myMem, totMem, NKERNEL + 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(numCalls, maxCalls, NKERNEL, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  const passivedouble total = totMem[NKERNEL];
+  passivedouble other = total;
+
+  std::cout << "\n----------------------- Tape Memory per Kernel --------------------------" << std::endl;
+  std::cout << "Memory recorded by the master thread of " << SU2_MPI::GetSize() << " rank(s)." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Kernel", 28);
+  table.AddColumn("Calls", 9);
+  table.AddColumn("Memory (MB)", 14);
+  table.AddColumn("(%)", 8);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+  for (auto iKernel = 0u; iKernel < NKERNEL; ++iKernel) {
+    if (maxCalls[iKernel] == 0) continue;
+    other -= totMem[iKernel];
+    table << names[iKernel] << maxCalls[iKernel] << totMem[iKernel]
+          << (total > 0 ? 100 * totMem[iKernel] / total : 0.0);
+  }
+  table << "Other" << "-" << other << (total > 0 ? 100 * other / total : 0.0);
+  table << "Total" << "-" << total << 100.0;
+  table.PrintFooter();
+}
@@ -62,6 +62,8 @@ protected:
 
   unsigned long numberOfProfiles;  /*!< \brief Auxiliary structure for holding the number of markers in a profile file. */
 
+  bool distributed;  /*!< \brief Whether each rank stores only its linear partition of the rows of each profile. */
+
   string filename;  /*!< \brief File name of the marker profile file. */
 
   vector<string> columnNames; /*!< \brief string containing all the names of the columns, one for each marker */
@@ -103,6 +105,7 @@ public:
    * \param[in] val_filename    - Name of the profile file to be read
    * \param[in] val_kind_marker - Type of marker where profile will be applied
    * \param[in] val_number_vars - Number of columns of profile data to be written to template file (excluding coordinates)
+   * \param[in] val_distributed - Store only a linear partition of the rows of each profile on each rank.
    */
   CMarkerProfileReaderFVM(CGeometry      *val_geometry,
                           CConfig        *val_config,
@@ -110,7 +113,8 @@ public:
                           unsigned short val_kind_marker,
                           unsigned short val_number_vars,
                           vector<string> val_columnNames,
-                          vector<string> val_columnValues);
+                          vector<string> val_columnValues,
+                          bool           val_distributed = false);
 
   /*!
    * \brief Destructor of the CMeshReaderFVM class.
@@ -136,6 +140,7 @@ public:
 
   /*!
    * \brief Get the number of rows of data in a profile.
+   * \note In distributed mode this is the number of rows stored on this rank.
    * \param[in] val_iProfile - current profile index.
    * \returns Number of rows of data in a profile.
    */
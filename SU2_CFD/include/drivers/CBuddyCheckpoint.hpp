@@ -0,0 +1,114 @@
+/*!
+ * \file CBuddyCheckpoint.hpp
+ * \brief In-memory (buddy) checkpoints of the solution for fast recovery after failures.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include <string>
+#include <vector>
+
+class CConfig;
+class CSolver;
+
+/*!
+ * \class CBuddyCheckpoint
+ * \ingroup Drivers
+ * \brief Periodic checkpoints of the state of the solvers of a zone that do not touch the parallel file system.
+ * \details The state is the solution and the solution at the previous time levels of all the solvers on all grid
+ * levels. Each rank packs its state and exchanges it with its buddies, it sends it to the next rank and keeps the
+ * state of the previous rank. Both are written to a node-local, memory backed, directory (BUDDY_CHECKPOINT_DIR).
+ * When the same case is relaunched after a failure, Recover() loads the last checkpoint, the ranks whose state was
+ * lost (e.g. their node was replaced) receive it from the rank that holds their copy. This requires the same
+ * number of ranks and partitioning, which is the case for a relaunch with the same mesh and configuration.
+ * Recovery is all-or-nothing, if any state is missing or the checkpoints are inconsistent nothing is loaded.
+ * \note Only for time-domain primal problems without mesh deformation (the coordinates are not checkpointed),
+ * the state is stored in passive (double) precision.
+ */
+class CBuddyCheckpoint {
+ private:
+  bool enabled = false;          /*!< \brief Whether checkpoints are stored and recovered. */
+  unsigned long frequency = 0;   /*!< \brief Number of time iterations between checkpoints. */
+  std::string prefix;            /*!< \brief Directory and name prefix (identifies the case) of the files. */
+  passivedouble caseTag = 0;     /*!< \brief Identifies the case in the header of the data. */
+  int rank = 0, size = 1;        /*!< \brief MPI rank and size. */
+  bool warnedWrite = false;      /*!< \brief To warn only once about failed writes. */
+  std::vector<passivedouble> ownData, buddyData; /*!< \brief Packed state of this rank and of the previous rank. */
+
+  enum : unsigned long { HEADER_SIZE = 3 }; /*!< \brief Case tag, time iteration, and number of values. */
+
+  /*!
+   * \brief Name of the file with the state of a rank.
+   * \param[in] owner - Rank whose state is in the file.
+   * \param[in] copy - Whether it is the copy kept by the buddy.
+   */
+  std::string FileName(int owner, bool copy) const;
+
+  /*!
+   * \brief Write a packed state to file (atomically, via a temporary file).
+   */
+  bool WriteFile(const std::string& fileName, const std::vector<passivedouble>& data) const;
+
+  /*!
+   * \brief Read a packed state from file, returns false if the file does not exist or is not a valid checkpoint of this case.
+   */
+  bool ReadFile(const std::string& fileName, std::vector<passivedouble>& data) const;
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   */
+  explicit CBuddyCheckpoint(const CConfig& config);
+
+  /*!
+   * \brief Whether a checkpoint should be stored at the end of a time iteration.
+   * \param[in] timeIter - Time iteration.
+   */
+  bool IsDue(unsigned long timeIter) const { return enabled && ((timeIter + 1) % frequency == 0); }
+
+  /*!
+   * \brief Store a checkpoint (collective).
+   * \param[in] solvers - Solvers of the zone, indexed [iMesh][iSol].
+   * \param[in] nMesh - Number of grid levels.
+   * \param[in] timeIter - Time iteration that was just completed.
+   */
+  void Store(CSolver*** solvers, unsigned short nMesh, unsigned long timeIter);
+
+  /*!
+   * \brief Load the last checkpoint of the case if there is one (collective).
+   * \param[in] solvers - Solvers of the zone, indexed [iMesh][iSol].
+   * \param[in] nMesh - Number of grid levels.
+   * \param[out] timeIter - Time iteration of the checkpoint.
+   * \return True if the state of all the ranks was recovered.
+   */
+  bool Recover(CSolver*** solvers, unsigned short nMesh, unsigned long& timeIter);
+
+  /*!
+   * \brief Remove the checkpoint files of this rank, e.g. after the run finished normally.
+   */
+  void Clear();
+};
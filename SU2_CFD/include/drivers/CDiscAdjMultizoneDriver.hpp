@@ -93,6 +93,8 @@ protected:
   };
 
   RECORDING RecordingState = RECORDING::CLEAR_INDICES;      /*!< \brief The kind of recording that the tape currently holds. */
+  RECORDING MainVariables = RECORDING::SOLUTION_VARIABLES;  /*!< \brief Recording of the adjoint iterations, SOLUTION_AND_MESH
+                                                                        if the tape is also used for OF gradient and sensitivities. */
 
   bool eval_transfer = false;     /*!< \brief Evaluate the transfer section of the tape. */
   su2double ObjFunc;              /*!< \brief Value of the objective function. */
@@ -28,6 +28,9 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -38,6 +41,42 @@
  */
 class CDiscAdjSinglezoneDriver : public CSinglezoneDriver {
 protected:
+#ifdef CODI_FORWARD_TYPE
+  using Scalar = su2double;
+#else
+  using Scalar = passivedouble;
+#endif
+
+  /*!
+   * \brief Product with the operator of the adjoint fixed-point problem, (G^T - I) u, where the tape gives G^T u + b.
+   */
+  class AdjointProduct : public CMatrixVectorProduct<Scalar> {
+  public:
+    CDiscAdjSinglezoneDriver* const driver;
+    const CSysVector<Scalar>& minusB; /*!< \brief -b, i.e. minus the tape evaluated at 0. */
+
+    AdjointProduct(CDiscAdjSinglezoneDriver* d, const CSysVector<Scalar>& rhs) : driver(d), minusB(rhs) {}
+
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override {
+      driver->SetAllSolutions(ZONE_0, true, u);
+      driver->EvaluateAdjointTape();
+      driver->GetAllSolutions(ZONE_0, true, v);
+      v += minusB;
+      v -= u;
+    }
+  };
+
+  class Identity : public CPreconditioner<Scalar> {
+  public:
+    inline bool IsIdentity() const override { return true; }
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override { v = u; }
+  };
+
+  /*!< \brief Members to use FGMRES instead of the fixed-point iteration (NEWTON_KRYLOV). */
+  static constexpr unsigned long KrylovMinIters = 3;
+  const Scalar KrylovTol = 1e-3;  /*!< \brief Per restart, convergence is monitored between restarts. */
+  CSysSolve<Scalar> LinSolver;
+  CSysVector<Scalar> AdjRHS, AdjSol;
 
   unsigned long nAdjoint_Iter;                  /*!< \brief The number of adjoint iterations that are run on the fixed-point solver.*/
   RECORDING RecordingState;                     /*!< \brief The kind of recording the tape currently holds.*/
@@ -45,6 +84,8 @@ protected:
   RECORDING SecondaryVariables;                 /*!< \brief The kind of recording linked to the secondary variables of the problem.*/
   int MainSolver;                               /*!< \brief Index of the main adjoint solver. */
   su2double ObjFunc;                            /*!< \brief The value of the objective function.*/
+  vector<su2double> BatchObjFunc;               /*!< \brief Values of the separate objectives (BATCH_OBJECTIVES_DISC). */
+  vector<CSysVector<Scalar> > BatchAdjSol;      /*!< \brief Adjoint solution of each separate objective. */
   CIteration* direct_iteration;                 /*!< \brief A pointer to the direct iteration.*/
 
   CConfig *config;                              /*!< \brief Definition of the particular problem. */
@@ -77,6 +118,34 @@ protected:
    */
   void SetAdjObjFunction(void);
 
+  /*!
+   * \brief Whether each objective function has its own adjoint (BATCH_OBJECTIVES_DISC with more than one objective).
+   */
+  inline bool BatchObjectives() const { return config->GetBatch_Objectives_Disc() && config->GetnObj() > 1; }
+
+  /*!
+   * \brief Select the objective that is seeded, and the output filenames of its adjoint.
+   * \param[in] iObj - Index of the objective function.
+   */
+  void SetBatchObjective(unsigned short iObj);
+
+  /*!
+   * \brief Solve the adjoint problem of the current recording and seeding (fixed-point or Krylov).
+   */
+  void RunAdjoint();
+
+  /*!
+   * \brief Evaluate the tape once, i.e. one fixed-point iteration of the adjoint solution, without monitoring.
+   */
+  void EvaluateAdjointTape();
+
+  /*!
+   * \brief Solve the adjoint fixed-point problem with restarted FGMRES, the tape is the matrix-free operator.
+   * \note The restart frequency is "QUASI_NEWTON_NUM_SAMPLES", between restarts one fixed-point iteration
+   *       is used to monitor the convergence and write output.
+   */
+  void KrylovRun();
+
   /*!
    * \brief Record the main computational path.
    */
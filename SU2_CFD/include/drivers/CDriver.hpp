@@ -37,6 +37,7 @@
 
 using namespace std;
 
+class CFilePrefetcher;
 class CInterpolator;
 class CIteration;
 class COutput;
@@ -120,6 +121,13 @@ class CDriver : public CDriverBase {
    */
   void InitializeGeometry(CConfig* config, CGeometry**& geometry, bool dummy);
 
+  /*!
+   * \brief Start reading, in the background, the mesh files of the zones after the first and the restart
+   *        files of all zones (see PREFETCH_INPUT_FILES).
+   * \param[in] prefetcher - Reader of the files.
+   */
+  void PrefetchInputFiles(CFilePrefetcher& prefetcher) const;
+
   /*!
    * \brief Do the geometrical preprocessing for the DG FEM solver.
    * \param[in] config - Definition of the particular problem.
@@ -166,6 +174,15 @@ class CDriver : public CDriverBase {
    */
   void RestartSolver(CSolver*** solver, CGeometry** geometry, CConfig* config, bool update_geo);
 
+  /*!
+   * \brief Time iteration of the restart files read by RestartSolver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] dt_step_2nd - Whether the solution is restarted for dual time stepping (2nd order), in which case
+   *             the mesh solver reads the file of the next iteration.
+   * \return The iteration.
+   */
+  static int GetRestartIter(const CConfig* config, bool& dt_step_2nd);
+
   /*!
    * \brief Definition and allocation of all solution classes.
    * \param[in] solver - Container vector with all the solutions.
@@ -617,11 +634,10 @@ class CHBDriver : public CFluidDriver {
   su2double** D; /*!< \brief Harmonic Balance operator. */
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms of all time instances.
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance();
 
   /*!
    * \brief Precondition Harmonic Balance source term for stability
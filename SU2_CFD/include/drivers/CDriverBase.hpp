@@ -155,6 +155,14 @@ class CDriverBase {
     return 0;
   }
 
+  /*!
+   * \brief Get the memory ledger of this rank, current and peak (suffix _PEAK) memory in MB of each subsystem,
+   *        of the AD tape, and of the process (RESIDENT).
+   * \note The subsystems are only recorded with WRT_PERFORMANCE= YES (or the build option enable-memory-ledger).
+   * \return Map of memory categories to their size.
+   */
+  map<string, passivedouble> GetMemoryLedger() const;
+
   /*!
    * \brief Get the number of design variables.
    * \return Number of design variables.
@@ -354,6 +362,14 @@ class CDriverBase {
   vector<passivedouble> GetMarkerVertexNormals(unsigned short iMarker, unsigned long iVertex,
                                                bool normalize = false) const;
 
+  /*!
+   * \brief Get the normal vectors of all the vertices of a marker in one call.
+   * \param[in] iMarker - Marker index.
+   * \param[in] normalize - If true, the unit (i.e. normalized) normal vectors are returned.
+   * \return Node normal vectors (nVertex x nDim, row-major).
+   */
+  vector<passivedouble> GetMarkerNormals(unsigned short iMarker, bool normalize = false) const;
+
   /*!
    * \brief Get the displacements currently imposed of a marker vertex.
    * \param[in] iMarker - Marker index.
@@ -387,6 +403,24 @@ class CDriverBase {
     }
   }
 
+  /*!
+   * \brief Set the mesh displacements of all the vertices of a marker in one call.
+   * \param[in] iMarker - Marker index.
+   * \param[in] values - Node displacements (nVertex x nDim, row-major).
+   */
+  inline void SetMarkerCustomDisplacements(unsigned short iMarker, const vector<passivedouble>& values) {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = CheckMarkerValues(iMarker, values.size(), nDim);
+    auto* nodes = GetSolverAndCheckMarker(MESH_SOL)->GetNodes();
+
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      const auto iPoint = main_geometry->vertex[iMarker][iVertex]->GetNode();
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        nodes->SetBound_Disp(iPoint, iDim, values[iVertex * nDim + iDim]);
+      }
+    }
+  }
+
   /*!
    * \brief Get the mesh velocities currently imposed on a marker vertex.
    * \param[in] iMarker - Marker index.
@@ -456,6 +490,7 @@ class CDriverBase {
 
   /*!
    * \brief Get a read/write view of the solution at time N on all mesh nodes of a solver.
+   * \note The storage of the time levels is swapped when they advance, get a new view after each time step.
    */
   inline CPyWrapperMatrixView SolutionTimeN(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
@@ -465,6 +500,7 @@ class CDriverBase {
 
   /*!
    * \brief Get a read/write view of the solution at time N on the mesh nodes of a marker.
+   * \note See SolutionTimeN.
    */
   inline CPyWrapperMarkerMatrixView MarkerSolutionTimeN(unsigned short iSolver, unsigned short iMarker) {
     auto* solver = GetSolverAndCheckMarker(iSolver, iMarker);
@@ -538,6 +574,18 @@ class CDriverBase {
     main_geometry->SetCustomBoundaryTemperature(iMarker, iVertex, WallTemp);
   }
 
+  /*!
+   * \brief Set the temperature of all the vertices of a marker (MARKER_PYTHON_CUSTOM) in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] WallTemp - Values of the temperature (nVertex).
+   */
+  inline void SetMarkerCustomTemperatures(unsigned short iMarker, const vector<passivedouble>& WallTemp) {
+    const auto nVertex = CheckMarkerValues(iMarker, WallTemp.size(), 1);
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      main_geometry->SetCustomBoundaryTemperature(iMarker, iVertex, WallTemp[iVertex]);
+    }
+  }
+
   /*!
    * \brief Set the wall normal heat flux at a vertex on a specified marker (MARKER_PYTHON_CUSTOM).
    * \note This can be the input of a heat or flow solver in a CHT setting.
@@ -549,6 +597,18 @@ class CDriverBase {
     main_geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex, WallHeatFlux);
   }
 
+  /*!
+   * \brief Set the wall normal heat flux of all the vertices of a marker (MARKER_PYTHON_CUSTOM) in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] WallHeatFlux - Values of the normal heat flux (nVertex).
+   */
+  inline void SetMarkerCustomNormalHeatFluxes(unsigned short iMarker, const vector<passivedouble>& WallHeatFlux) {
+    const auto nVertex = CheckMarkerValues(iMarker, WallHeatFlux.size(), 1);
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      main_geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex, WallHeatFlux[iVertex]);
+    }
+  }
+
   /*!
    * \brief Selects zone to be used for python driver operations.
    * \param[in] iZone - Zone identifier.
@@ -595,6 +655,23 @@ class CDriverBase {
     solver->GetNodes()->Set_FlowTraction(iPoint, load.data());
   }
 
+  /*!
+   * \brief Sets the nodal forces for the structural solver at all the vertices of a marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] force - Force vectors (nVertex x nDim, row-major).
+   */
+  inline void SetMarkerCustomFEALoads(unsigned short iMarker, const vector<passivedouble>& force) {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = CheckMarkerValues(iMarker, force.size(), nDim);
+    auto* nodes = GetSolverAndCheckMarker(FEA_SOL, iMarker)->GetNodes();
+
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      std::array<su2double, 3> load{};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) load[iDim] = force[iVertex * nDim + iDim];
+      nodes->Set_FlowTraction(main_geometry->vertex[iMarker][iVertex]->GetNode(), load.data());
+    }
+  }
+
   /*!
    * \brief Get the fluid force at a vertex of a solid wall marker of the flow solver.
    * \note This can be the output of the flow solver in an FSI setting to then apply it to a structural solver.
@@ -614,6 +691,27 @@ class CDriverBase {
     return FlowLoad;
   }
 
+  /*!
+   * \brief Get the fluid forces at all the vertices of a solid wall marker of the flow solver in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Vectors of loads (nVertex x nDim, row-major).
+   */
+  inline vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker) const {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = GetNumberMarkerNodes(iMarker);
+    vector<passivedouble> FlowLoad(nVertex * nDim, 0.0);
+    const auto* solver = GetSolverAndCheckMarker(FLOW_SOL, iMarker);
+
+    if (main_config->GetSolid_Wall(iMarker)) {
+      for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          FlowLoad[iVertex * nDim + iDim] = SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim));
+        }
+      }
+    }
+    return FlowLoad;
+  }
+
   /*!
    * \brief Set the adjoint of the flow tractions of the flow solver.
    * \note This can be the input of the flow solver in an adjoint FSI setting.
@@ -717,6 +815,16 @@ class CDriverBase {
     return solver;
   }
 
+  /*!
+   * \brief Checks the size of the values passed to the marker-wide (bulk) functions of the python wrapper.
+   * \return Number of vertices of the marker.
+   */
+  inline unsigned long CheckMarkerValues(unsigned short iMarker, size_t nValues, unsigned short nCols) const {
+    const auto nVertex = GetNumberMarkerNodes(iMarker);
+    if (nValues != nVertex * nCols) SU2_MPI::Error("Wrong number of values for the marker.", CURRENT_FUNCTION);
+    return nVertex;
+  }
+
   /*!
    * \brief Initialize containers.
    */
@@ -57,6 +57,8 @@ protected:
 
   bool *prefixed_motion;     /*!< \brief Determines if a fixed motion is imposed in the config file. */
 
+  vector<bool> zoneActive;   /*!< \brief Whether each zone is iterated in the current outer iteration. */
+
   /*!
    * \brief Perform a dynamic mesh deformation, including grid velocity computation and update of the multigrid structure.
    */
@@ -67,6 +69,14 @@ protected:
    */
   void Corrector(unsigned short val_iZone);
 
+  /*!
+   * \brief Determine which zones are iterated in an outer iteration, based on their ZONE_UPDATE_FREQ.
+   * \param[in] OuterIter - Current outer iteration.
+   * \param[in] allZones - Force the iteration of all zones.
+   * \return True if all zones are iterated.
+   */
+  bool SetActiveZones(unsigned long OuterIter, bool allZones);
+
   /*!
    * \brief Run a Block Gauss-Seidel iteration in all physical zones.
    */
@@ -74,14 +84,24 @@ protected:
 
   /*!
    * \brief Run a Block-Jacobi iteration in all physical zones.
+   * \param[in] overlapTransfers - Start the interface transfers of all zones before completing them, such that
+   *            their communication overlaps. Mesh updates due to the transfers are done after all transfers.
    */
-  void RunJacobi();
+  void RunJacobi(bool overlapTransfers = false);
 
   /*!
    * \brief Routine to provide all the desired physical transfers between the different zones during one iteration.
+   * \param[in] donorZone - Index of the donor zone.
+   * \param[in] targetZone - Index of the target zone.
+   * \param[in] startOnly - Only start the transfers, they are completed by FinishTransfers.
    * \return Boolean that determines whether the mesh needs to be updated for this particular transfer
    */
-  bool TransferData(unsigned short donorZone, unsigned short targetZone);
+  bool TransferData(unsigned short donorZone, unsigned short targetZone, bool startOnly = false);
+
+  /*!
+   * \brief Complete the transfers started with TransferData(..., startOnly=true).
+   */
+  void FinishTransfers();
 
   /*!
    * \brief Set Mixing Plane interface within multiple zones.
@@ -141,6 +161,7 @@ public:
     switch (driver_config->GetKind_MZSolver()){
       case ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL: RunGaussSeidel(); break;  // Block Gauss-Seidel iteration
       case ENUM_MULTIZONE::MZ_BLOCK_JACOBI: RunJacobi(); break;             // Block-Jacobi iteration
+      case ENUM_MULTIZONE::MZ_BLOCK_JACOBI_ASYNC: RunJacobi(true); break;   // Block-Jacobi, overlapped transfers
     }
   }
 
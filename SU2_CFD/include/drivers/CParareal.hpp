@@ -0,0 +1,103 @@
+/*!
+ * \file CParareal.hpp
+ * \brief Parareal iteration of the states at the boundaries of the time slices (parallel in time).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include <functional>
+#include <vector>
+
+/*!
+ * \class CParareal
+ * \ingroup Drivers
+ * \brief Parareal iteration, the time interval is split into slices that are solved concurrently.
+ * \details Each rank of the time communicator owns one slice (in the order of the ranks) and its part of the state
+ * (e.g. the solution on the points of a spatial partition, the same partition on all slices). Propagators advance a
+ * state over one slice, the fine propagator is accurate but expensive, the coarse one cheap (e.g. a large time step).
+ * The start states U_s of the slices are corrected iteratively:
+ *   U_{s+1}^{k+1} = G(U_s^{k+1}) + F(U_s^k) - G(U_s^k),
+ * where the fine propagations F run concurrently and the (cheap) coarse propagations G are a sweep over the slices.
+ * After k iterations the first k slices have the start state of the serial fine solution, the iteration stops when
+ * the relative change of the states sent to the next slices is below a tolerance.
+ */
+class CParareal {
+ public:
+  using State = std::vector<passivedouble>;
+  using Propagator = std::function<void(State&)>;
+
+ private:
+  SU2_Comm spaceComm, timeComm; /*!< \brief Ranks of a slice, and ranks that own the same part of all slices. */
+  int iSlice = 0, nSlices = 1;  /*!< \brief Slice of this rank, and number of slices. */
+  unsigned long maxIter;        /*!< \brief Maximum number of iterations. */
+  passivedouble tolerance;      /*!< \brief Relative change of the states that stops the iteration. */
+  passivedouble change = 0;     /*!< \brief Relative change of the last iteration (max over the slices). */
+
+  /*!
+   * \brief Receive the start state of this slice from the previous slice.
+   */
+  void ReceiveStart(State& start, int tag) const;
+
+  /*!
+   * \brief Send the start state of the next slice.
+   */
+  void SendEnd(const State& end, int tag) const;
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] spaceComm - Communicator of the ranks that solve the same slice.
+   * \param[in] timeComm - Communicator of the ranks that own the same part of the state, one per slice.
+   * \param[in] maxIter - Maximum number of iterations.
+   * \param[in] tolerance - Relative change of the states at which the iteration stops.
+   */
+  CParareal(SU2_Comm spaceComm, SU2_Comm timeComm, unsigned long maxIter, passivedouble tolerance);
+
+  /*!
+   * \brief Slice of this rank.
+   */
+  int GetSlice() const { return iSlice; }
+
+  /*!
+   * \brief Number of slices.
+   */
+  int GetnSlices() const { return nSlices; }
+
+  /*!
+   * \brief Relative change of the states in the last iteration.
+   */
+  passivedouble GetChange() const { return change; }
+
+  /*!
+   * \brief Iterate the start states of the slices (collective over both communicators).
+   * \note The solution inside the slices is obtained afterwards by a fine propagation from the start state.
+   * \param[in,out] start - Initial condition (only used by the first slice), start state of the slice on exit.
+   * \param[in] coarse - Coarse propagator.
+   * \param[in] fine - Fine propagator.
+   * \return Number of iterations.
+   */
+  unsigned long Solve(State& start, const Propagator& coarse, const Propagator& fine);
+};
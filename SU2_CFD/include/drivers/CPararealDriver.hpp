@@ -0,0 +1,87 @@
+/*!
+ * \file CPararealDriver.hpp
+ * \brief Parallel-in-time (Parareal) driver for unsteady single-zone problems.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSinglezoneDriver.hpp"
+#include "CParareal.hpp"
+
+/*!
+ * \class CPararealDriver
+ * \ingroup Drivers
+ * \brief Solves the time slices of an unsteady single-zone problem concurrently with the Parareal iteration.
+ * \details The ranks are split into PARAREAL_SLICES groups, each group solves one slice of the time iterations with
+ * the usual spatial (MPI and OpenMP) parallelization. The fine propagator is the dual time stepping of the problem, the
+ * coarse propagator takes backward Euler steps PARAREAL_COARSE_FACTOR times larger. The state exchanged between the
+ * slices is the solution at the current and previous time levels of all solvers, on all grid levels. When the
+ * iteration stops, each slice is propagated once more with the fine time step to write the output.
+ * Only for dual time stepping with a fixed time step and without mesh motion.
+ */
+class CPararealDriver : public CSinglezoneDriver {
+ protected:
+  CParareal parareal;             /*!< \brief Parareal iteration of the states at the boundaries of the slices. */
+  unsigned long firstIter = 0;    /*!< \brief First time iteration of the simulation. */
+  unsigned long nSliceIter = 0;   /*!< \brief Number of (fine) time iterations of a slice. */
+  unsigned long coarseFactor = 1; /*!< \brief Ratio of the coarse and fine time steps. */
+  su2double fineTimeStep = 0.0;   /*!< \brief Time step of the problem (non-dimensional). */
+  unsigned long historyFreq = 0, screenFreq = 0; /*!< \brief Time output frequencies of the configuration. */
+
+  /*!
+   * \brief Pack the state of the solvers.
+   * \param[out] state - Solution at the current and previous time levels of all solvers on all grid levels.
+   */
+  void GetState(CParareal::State& state) const;
+
+  /*!
+   * \brief Unpack the state of the solvers.
+   * \param[in] state - State packed by GetState.
+   */
+  void SetState(const CParareal::State& state);
+
+  /*!
+   * \brief Advance a state over the slice of this rank.
+   * \param[in,out] state - Start state on entry, end state on exit.
+   * \param[in] coarse - Use the coarse propagator instead of the fine one.
+   * \param[in] output - Write the history, screen, and solution files.
+   */
+  void Propagate(CParareal::State& state, bool coarse, bool output);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator of the ranks that solve the same slice.
+   * \param[in] timeCommunicator - MPI communicator of the ranks with the same rank in all slices.
+   */
+  CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator, SU2_Comm timeCommunicator);
+
+  /*!
+   * \brief Solve the problem with the Parareal iteration.
+   */
+  void StartSolver() override;
+};
@@ -0,0 +1,127 @@
+/*!
+ * \file CPreciceAdapter.hpp
+ * \brief Coupling of SU2 with other codes (structural or heat solvers) through the preCICE library.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_PRECICE
+#include <precice/precice.hpp>
+#endif
+
+class CConfig;
+class CGeometry;
+class CSolver;
+
+/*!
+ * \class CPreciceAdapter
+ * \ingroup Drivers
+ * \brief Couples a single-zone time-domain simulation with other codes through preCICE.
+ * \details Each marker in MARKER_PRECICE is a preCICE mesh named "<PRECICE_MESH_PREFIX>-<marker tag>", whose
+ * vertices are the vertices of the marker owned by the rank (halos are not coupled). The data depends on the kind
+ * of coupling (PRECICE_COUPLING):
+ * - FSI: reads "Displacement" into the boundary displacements of the mesh solver, writes the fluid "Force".
+ * - CHT_TEMPERATURE: reads "Temperature" (MARKER_PYTHON_CUSTOM wall temperature), writes "Heat-Flux".
+ * - CHT_HEATFLUX: reads "Heat-Flux" (MARKER_PYTHON_CUSTOM wall heat flux), writes "Temperature".
+ * The values are exchanged in the same units as with the python wrapper. The vertex ids and the staging buffers
+ * of each marker are set up once, the data of a marker is read and written with one call per time step.
+ * For implicit coupling the driver saves and restores the state of the solvers when preCICE requires it.
+ */
+class CPreciceAdapter {
+ private:
+#ifdef HAVE_PRECICE
+  /*!
+   * \brief A coupled marker and its preCICE mesh.
+   */
+  struct CoupledMarker {
+    std::string mesh;                     /*!< \brief Name of the preCICE mesh. */
+    short iMarker = -1;                   /*!< \brief Index of the marker on this rank (-1 if not present). */
+    std::vector<unsigned long> vertices;  /*!< \brief Vertices of the marker that are owned by this rank. */
+    std::vector<precice::VertexID> ids;   /*!< \brief preCICE ids of the vertices. */
+    std::vector<double> readBuf, writeBuf; /*!< \brief Staging buffers of the read and written data. */
+  };
+
+  std::unique_ptr<precice::Participant> participant; /*!< \brief The preCICE participant. */
+  std::vector<CoupledMarker> markers;  /*!< \brief Coupled markers. */
+  std::string readName, writeName;     /*!< \brief Names of the read and written data. */
+  unsigned short nReadVar = 0, nWriteVar = 0; /*!< \brief Number of components of the read and written data. */
+#endif
+  CConfig* config = nullptr;        /*!< \brief Definition of the problem. */
+  CGeometry* geometry = nullptr;    /*!< \brief Geometry of the zone (finest grid). */
+  CSolver** solvers = nullptr;      /*!< \brief Solvers of the zone (finest grid). */
+
+ public:
+  /*!
+   * \brief Creates the participant, defines the meshes, and initializes the coupling (collective).
+   * \param[in] config - Definition of the problem.
+   * \param[in] geometry - Geometry of the zone (finest grid).
+   * \param[in] solvers - Solvers of the zone (finest grid).
+   */
+  CPreciceAdapter(CConfig* config, CGeometry* geometry, CSolver** solvers);
+
+  /*!
+   * \brief Finalizes the coupling.
+   */
+  ~CPreciceAdapter();
+
+  CPreciceAdapter(const CPreciceAdapter&) = delete;
+  CPreciceAdapter& operator=(const CPreciceAdapter&) = delete;
+
+  /*!
+   * \brief Read the coupling data for the next time step into the boundary conditions.
+   */
+  void ReadData();
+
+  /*!
+   * \brief Write the coupling data computed in the time step.
+   */
+  void WriteData();
+
+  /*!
+   * \brief Advance the coupling by one time step (collective, exchanges the data with the other participants).
+   */
+  void Advance();
+
+  /*!
+   * \brief Whether the state must be saved before the time step (implicit coupling).
+   */
+  bool RequiresWritingCheckpoint() const;
+
+  /*!
+   * \brief Whether the state must be restored and the time step repeated (implicit coupling not converged).
+   */
+  bool RequiresReadingCheckpoint() const;
+
+  /*!
+   * \brief Whether the coupled simulation continues.
+   */
+  bool IsCouplingOngoing() const;
+};
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <limits>
 #include <vector>
 #include "../../../Common/include/containers/CLookUpTable.hpp"
 #if defined(HAVE_MLPCPP)
@@ -62,6 +63,9 @@ class CDataDrivenFluid final : public CFluidModel {
       rho_min, rho_max,        /*!< \brief Minimum and maximum density values in data set. */
       e_min, e_max;            /*!< \brief Minimum and maximum energy values in data set. */
 
+  su2double rho_last = std::numeric_limits<passivedouble>::quiet_NaN(), /*!< \brief Density of the last query. */
+      e_last = std::numeric_limits<passivedouble>::quiet_NaN();         /*!< \brief Energy of the last query. */
+
   unsigned long MaxIter_Newton; /*!< \brief Maximum number of iterations for Newton solvers. */
 
   su2double dsde_rho, /*!< \brief Entropy derivative w.r.t. density. */
@@ -94,7 +98,8 @@ class CDataDrivenFluid final : public CFluidModel {
 #endif
   vector<su2double> MLP_inputs; /*!< \brief Inputs for the multi-layer perceptron look-up operation. */
 
-  CLookUpTable* lookup_table; /*!< \brief Look-up table regression object. */
+  std::shared_ptr<CLookUpTable> lookup_table; /*!< \brief Look-up table regression object, shared within a rank. */
+  std::vector<unsigned long> lookup_hints;    /*!< \brief Last triangle found in the table, starts the next search. */
 
   unsigned long outside_dataset, /*!< \brief Density-energy combination lies outside data set. */
       nIter_Newton;              /*!< \brief Number of Newton solver iterations. */
@@ -121,7 +126,7 @@ class CDataDrivenFluid final : public CFluidModel {
   unsigned long Predict_LUT(su2double rho, su2double e);
 
   /*!
-   * \brief Evaluate the data set.
+   * \brief Evaluate the data set, skipped if rho and e are those of the previous evaluation (primal builds).
    * \param[in] rho - Density value.
    * \param[in] e - Static energy value.
    */
@@ -58,7 +58,8 @@ class CFluidFlamelet final : public CFluidModel {
   su2double mass_diffusivity, /*!< \brief local mass diffusivity of the mixture */
       molar_weight;           /*!< \brief local molar weight of the mixture */
 
-  CLookUpTable* look_up_table;
+  std::shared_ptr<CLookUpTable> look_up_table; /*!< \brief Look-up table, shared by the fluid models of a rank. */
+  std::vector<unsigned long> lookup_hints;     /*!< \brief Last triangle found on each table level, starts the next search. */
 
   /*--- Class variables for the multi-layer perceptron method ---*/
 #ifdef USE_MLPCPP
@@ -92,9 +92,15 @@ private:
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
   RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
+  MW_A, MW_B,                    /*!< \brief Millikan & White coefficients of each pair of species. */
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
 
+  vector<su2activematrix> RxnEquilTables; /*!< \brief Equilibrium reaction constants of each reaction. */
+
+  su2matrix<int> ReactantOrder,  /*!< \brief Stoichiometric coefficient of each species as reactant of each reaction. */
+  ProductOrder;                  /*!< \brief Stoichiometric coefficient of each species as product of each reaction. */
+
   C3DDoubleMatrix Omega11,       /*!< \brief Collision integrals (Omega^(1,1)) */
   Omega22;                       /*!< \brief Collision integrals (Omega^(2,2)) */
 
@@ -112,10 +118,8 @@ private:
   vector<su2double>
   dkf, dkb,
   dRfok, dRbok,
-  eve, eve_eq, cvve, cvve_eq;
-
-  vector<int>
-  alphak, betak;
+  eve, eve_eq, cvve, cvve_eq,
+  Conc;                         /*!< \brief Species concentrations (mol/cm^3) of the current state. */
 
 public:
 
@@ -222,10 +226,23 @@ public:
 
   /*!
    * \brief Calculates constants used for Keq correlation.
-   * \param[out] A - Reference to coefficient array.
    * \param[in] val_reaction - Reaction number indicator.
+   * \param[in] N - Mixture number density (1/cm^3).
+   */
+  void ComputeKeqConstants(unsigned short val_Reaction, su2double N);
+
+  /*!
+   * \brief Derivatives of the forward (or backward) reaction rate over the rate coefficient w.r.t. the species
+   *        densities, using the concentrations of the current state.
+   * \param[in] order - Stoichiometric coefficients of the reactants (or products) of the reaction.
+   * \param[out] dRok - Derivatives.
+   */
+  void ReactionRateDerivatives(const int* order, vector<su2double>& dRok) const;
+
+  /*!
+   * \brief Compute the point-independent reaction and relaxation data (called once by the constructor).
    */
-  void ComputeKeqConstants(unsigned short val_Reaction);
+  void SetReactionConstants();
 
   /*!
    * \brief Calculate species diffusion coefficients with Wilke/Blottner/Eucken transport model.
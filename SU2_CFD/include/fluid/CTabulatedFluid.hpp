@@ -0,0 +1,160 @@
+/*!
+ * \file CTabulatedFluid.hpp
+ * \brief Defines a fluid model that interpolates another fluid model from a table.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CFluidModel.hpp"
+
+/*!
+ * \class CTabulatedFluid
+ * \brief Evaluates a (real gas) fluid model by interpolation on a structured (log(rho), e) table.
+ * \details Pressure, temperature, entropy, and Cp are tabulated with their derivatives and interpolated with
+ * bicubic Hermite polynomials, the partial derivatives of P and T are those of the interpolant. States outside
+ * the table, or in cells with invalid nodes, are evaluated with the tabulated model, which is also used to
+ * convert the other pairs of inputs to (rho, e). The table is shared by all instances with the same settings
+ * (threads and multigrid levels of a rank) and can be cached on disk.
+ * \author SU2 Contributors
+ */
+class CTabulatedFluid final : public CFluidModel {
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] eos - Fluid model to tabulate, the new object takes ownership of it.
+   * \param[in] config - Definition of the problem (ranges, size, and file of the table).
+   */
+  CTabulatedFluid(CFluidModel* eos, const CConfig* config);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe(su2double rho, su2double e) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT(su2double P, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless Internal Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs(su2double h, su2double s) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT(su2double rho, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps(su2double P, su2double s) override;
+
+  /*!
+   * \brief Compute some derivatives of enthalpy and entropy needed for subsonic inflow BC (with the tabulated model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+
+ private:
+  enum : unsigned short {
+    I_P = 0,  /*!< \brief Index of pressure in the table. */
+    I_T = 1,  /*!< \brief Index of temperature in the table. */
+    I_S = 2,  /*!< \brief Index of entropy in the table. */
+    I_CP = 3, /*!< \brief Index of Cp in the table. */
+    N_VARS = 4,
+    N_COEFFS = 4, /*!< \brief Value, x, y, and xy derivatives at each node. */
+  };
+
+  /*!
+   * \brief Table data, nodes are numbered i_rho * n_e + i_e and store [coefficient][variable], the
+   * derivatives are w.r.t. the normalized coordinates (i.e. scaled by the grid spacing).
+   */
+  struct CTable {
+    unsigned long n_rho = 0, n_e = 0;
+    passivedouble logrho_min = 0, dlogrho = 0, e_min = 0, de = 0;
+    std::vector<passivedouble> coeffs;
+    std::vector<char> valid_cell; /*!< \brief Whether all coefficients of a cell are finite. */
+  };
+
+  std::unique_ptr<CFluidModel> eos;   /*!< \brief Tabulated fluid model. */
+  std::shared_ptr<const CTable> table; /*!< \brief Table, shared by the instances with the same settings. */
+
+  /*!
+   * \brief Get the table for the settings in config, read it from file, or build it with eos.
+   */
+  static std::shared_ptr<const CTable> GetTable(CFluidModel& eos, const CConfig* config);
+
+  /*!
+   * \brief Evaluate the tabulated model at the nodes of the table and compute the interpolation coefficients.
+   */
+  static void BuildTable(CFluidModel& eos, su2double rho_min, su2double rho_max, su2double T_min, su2double T_max,
+                         CTable& table);
+
+  /*!
+   * \brief Read a cached table, returns false if the file does not exist or was written with other settings.
+   */
+  static bool ReadTable(const std::string& file_name, const std::string& key, CTable& table);
+
+  /*!
+   * \brief Write the table to file, together with the settings used to build it.
+   */
+  static void WriteTable(const std::string& file_name, const std::string& key, const CTable& table);
+
+  /*!
+   * \brief Set the state of this object from (rho, e) with the tabulated model.
+   */
+  void SetTDState_rhoe_EOS(su2double rho, su2double e);
+};
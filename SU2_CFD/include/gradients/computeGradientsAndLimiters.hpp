@@ -0,0 +1,117 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Fused computation of reconstruction gradients and limiters.
+ * \note The min/max over the neighbors of each point, needed by the limiters, are
+ *       computed in the gradient loop, which avoids a second pass over the neighbor
+ *       values of the field, and the gradients and limiters are communicated together.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "computeGradientsGreenGauss.hpp"
+#include "computeGradientsLeastSquares.hpp"
+#include "../limiters/computeLimiters.hpp"
+
+/*!
+ * \brief Compute gradients (Green-Gauss or least-squares) and limiters for a field in one
+ *        pass over the neighbors, followed by a single halo exchange of both quantities.
+ * \ingroup FvmAlgos
+ * \note Periodic boundaries are not supported, use the separate functions in that case.
+ *       The results are the same as those of the separate functions.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication for gradients and limiters together.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] kindLimiter - Type of limiter.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim), only for least-squares.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field.
+ */
+template<class FieldType, class GradientType, class RMatrixType>
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiComm,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 unsigned short kindGradient,
+                                 LIMITER kindLimiter,
+                                 const FieldType& field,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 GradientType& gradient,
+                                 RMatrixType& Rmatrix,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter) {
+
+  /*--- Gradients and min/max, without communications (no solver). ---*/
+  {
+  SU2_PHASE_TIMER(GRADIENTS);
+  SU2_TAPE_PROBE(GRADIENTS);
+  SU2_KERNEL_COUNTER(GRADIENTS);
+
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+  switch (kindGradient) {
+  case GREEN_GAUSS:
+    if (geometry.GetnDim() == 2)
+      detail::computeGradientsGreenGauss<2>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config, field,
+                                            varBegin, varEnd, gradient, &fieldMin, &fieldMax);
+    else
+      detail::computeGradientsGreenGauss<3>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config, field,
+                                            varBegin, varEnd, gradient, &fieldMin, &fieldMax);
+    break;
+  case LEAST_SQUARES:
+  case WEIGHTED_LEAST_SQUARES:
+    if (geometry.GetnDim() == 2)
+      detail::computeGradientsLeastSquares<2>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config, weighted,
+                                              field, varBegin, varEnd, gradient, Rmatrix, &fieldMin, &fieldMax);
+    else
+      detail::computeGradientsLeastSquares<3>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config, weighted,
+                                              field, varBegin, varEnd, gradient, Rmatrix, &fieldMin, &fieldMax);
+    break;
+  default:
+    SU2_MPI::Error("Unsupported gradient method.", CURRENT_FUNCTION);
+    break;
+  }
+  }
+
+  /*--- Limiters using the min/max computed above, also without communications. ---*/
+
+  computeLimiters(kindLimiter, nullptr, kindMpiComm, PERIODIC_NONE, PERIODIC_NONE, geometry, config,
+                  varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, false);
+
+  /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them. ---*/
+
+  if (solver == nullptr) return;
+
+  solver->InitiateComms(&geometry, &config, kindMpiComm);
+  solver->CompleteComms(&geometry, &config, kindMpiComm);
+}
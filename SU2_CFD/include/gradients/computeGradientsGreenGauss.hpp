@@ -27,7 +27,13 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
+#include "neighborMinMax.hpp"
 
 namespace detail {
 
@@ -35,6 +41,8 @@ namespace detail {
  * \brief Compute the gradient of a field using the Green-Gauss theorem.
  * \ingroup FvmAlgos
  * \note Template nDim to allow efficient unrolling of inner loops.
+ * \note nVar > 0 fixes the number of variables at compile time (it must then be equal
+ *       to varEnd-varBegin), the default (0) uses the runtime range.
  * \note Gradients can be computed only for a contiguous range of variables, defined
  *       by [varBegin, varEnd[ (e.g. 0,1 computes the gradient of the 1st variable).
  *       This can be used, for example, to compute only velocity gradients.
@@ -50,8 +58,11 @@ namespace detail {
  * \param[in] varBegin - Index of first variable for which to compute the gradient.
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] fieldMin - Optional, pointer to object implementing operator (iPoint, iVar), to store the
+ *             minimum field values over direct neighbors of each (non-halo) point, see neighborMinMax.hpp.
+ * \param[out] fieldMax - As above but maximum values.
  */
-template<size_t nDim, class FieldType, class GradientType>
+template<size_t nDim, size_t nVar = 0, class FieldType, class GradientType, class MinMaxType = std::nullptr_t>
 void computeGradientsGreenGauss(CSolver* solver,
                                 MPI_QUANTITIES kindMpiComm,
                                 PERIODIC_QUANTITIES kindPeriodicComm,
@@ -60,8 +71,13 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 const FieldType& field,
                                 size_t varBegin,
                                 size_t varEnd,
-                                GradientType& gradient)
+                                GradientType& gradient,
+                                MinMaxType fieldMin = nullptr,
+                                MinMaxType fieldMax = nullptr)
 {
+  /*--- Constant trip count for the loops over variables. ---*/
+  if (nVar != 0) varEnd = varBegin + nVar;
+
   const size_t nPointDomain = geometry.GetnPointDomain();
 
 #ifdef HAVE_OMP
@@ -82,8 +98,10 @@ void computeGradientsGreenGauss(CSolver* solver,
     AD::SetPreaccIn(nodes->GetVolume(iPoint));
     AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
       AD::SetPreaccIn(field(iPoint,iVar));
+      initMinMax(iPoint, iVar, field, fieldMin, fieldMax);
+    }
 
     /*--- Clear the gradient. --*/
 
@@ -114,6 +132,7 @@ void computeGradientsGreenGauss(CSolver* solver,
       for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
       {
         AD::SetPreaccIn(field(jPoint,iVar));
+        updateMinMax(iPoint, jPoint, iVar, field, fieldMin, fieldMax);
 
         su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
 
@@ -123,9 +142,11 @@ void computeGradientsGreenGauss(CSolver* solver,
 
     }
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+      preaccOutMinMax(iPoint, iVar, fieldMin, fieldMax);
+    }
 
     AD::EndPreacc();
   }
@@ -174,11 +195,7 @@ void computeGradientsGreenGauss(CSolver* solver,
 
   /*--- Account for periodic contributions. ---*/
 
-  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-  {
-    solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-  }
+  solver->PeriodicComms(&geometry, &config, kindPeriodicComm);
 
   /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
@@ -189,7 +206,8 @@ void computeGradientsGreenGauss(CSolver* solver,
 } // end namespace
 
 /*!
- * \brief Instantiations for 2D and 3D.
+ * \brief Instantiations for 2D and 3D, and for the common numbers of variables
+ *        (1 and 2 for scalar and turbulence solvers, nDim+4 for flow primitives).
  * \ingroup FvmAlgos
  */
 template<class FieldType, class GradientType>
@@ -202,17 +220,36 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+  SU2_PHASE_TIMER(GRADIENTS);
+  SU2_TAPE_PROBE(GRADIENTS);
+  SU2_KERNEL_COUNTER(GRADIENTS);
+
+  const size_t nVar = varEnd - varBegin;
+
+#define COMPUTE_GG(NDIM, NVAR) detail::computeGradientsGreenGauss<NDIM, NVAR>(solver, kindMpiComm, \
+  kindPeriodicComm, geometry, config, field, varBegin, varEnd, gradient)
+
   switch (geometry.GetnDim()) {
   case 2:
-    detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+    switch (nVar) {
+      case 1: COMPUTE_GG(2, 1); break;
+      case 2: COMPUTE_GG(2, 2); break;
+      case 6: COMPUTE_GG(2, 6); break;
+      default: COMPUTE_GG(2, 0); break;
+    }
     break;
   case 3:
-    detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+    switch (nVar) {
+      case 1: COMPUTE_GG(3, 1); break;
+      case 2: COMPUTE_GG(3, 2); break;
+      case 7: COMPUTE_GG(3, 7); break;
+      default: COMPUTE_GG(3, 0); break;
+    }
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
     break;
   }
+
+#undef COMPUTE_GG
 }
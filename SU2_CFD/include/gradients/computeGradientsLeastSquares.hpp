@@ -26,8 +26,14 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
+#include "neighborMinMax.hpp"
 
 namespace detail {
 
@@ -66,29 +72,17 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
 }
 
 /*!
- * \brief Solve the least-squares problem for one point.
+ * \brief Compute the upper triangular part of Smatrix := inv(R)*transpose(inv(R)) for one point.
  * \ingroup FvmAlgos
- * \note See detail::computeGradientsLeastSquares for the
- *       purpose of template "nDim" and "periodic".
+ * \note Smatrix is left unchanged (zero) if R is singular.
  */
-template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
-FORCEINLINE void solveLeastSquares(size_t iPoint,
-                                   size_t varBegin,
-                                   size_t varEnd,
-                                   const RMatrixType& Rmatrix,
-                                   GradientType& gradient)
-{
+template<size_t nDim, class RMatrixType>
+FORCEINLINE void computeSmatrix(size_t iPoint, const RMatrixType& Rmatrix, su2double Smatrix[][nDim]) {
+
   const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
 
   /*--- Entries of upper triangular matrix R. ---*/
 
-  if (periodic) {
-    AD::StartPreacc();
-    AD::SetPreaccIn(Rmatrix(iPoint,0,0));
-    AD::SetPreaccIn(Rmatrix(iPoint,0,1));
-    AD::SetPreaccIn(Rmatrix(iPoint,1,1));
-  }
-
   su2double r11 = Rmatrix(iPoint,0,0);
   su2double r12 = Rmatrix(iPoint,0,1);
   su2double r22 = Rmatrix(iPoint,1,1);
@@ -99,13 +93,6 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   r22 = sqrt(max(r22 - r12*r12, eps));
 
   if (nDim == 3) {
-    if (periodic) {
-      AD::SetPreaccIn(Rmatrix(iPoint,0,2));
-      AD::SetPreaccIn(Rmatrix(iPoint,1,2));
-      AD::SetPreaccIn(Rmatrix(iPoint,2,1));
-      AD::SetPreaccIn(Rmatrix(iPoint,2,2));
-    }
-
     r13 = Rmatrix(iPoint,0,2);
     r33 = Rmatrix(iPoint,2,2);
     const auto r23_a = Rmatrix(iPoint,1,2);
@@ -120,15 +107,44 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
 
   const su2double detR2 = pow(r11*r22*r33, 2);
 
-  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-
-  su2double Smatrix[nDim][nDim] = {{0.0}};
-
   /*--- Detect singular matrix ---*/
 
   if (detR2 > eps) {
     computeSmatrix(r11, r12, r13, r22, r23, r33, detR2, Smatrix);
   }
+}
+
+/*!
+ * \brief Solve the least-squares problem for one point.
+ * \ingroup FvmAlgos
+ * \note See detail::computeGradientsLeastSquares for the
+ *       purpose of template "nDim" and "periodic".
+ */
+template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
+FORCEINLINE void solveLeastSquares(size_t iPoint,
+                                   size_t varBegin,
+                                   size_t varEnd,
+                                   const RMatrixType& Rmatrix,
+                                   GradientType& gradient)
+{
+  if (periodic) {
+    AD::StartPreacc();
+    AD::SetPreaccIn(Rmatrix(iPoint,0,0));
+    AD::SetPreaccIn(Rmatrix(iPoint,0,1));
+    AD::SetPreaccIn(Rmatrix(iPoint,1,1));
+    if (nDim == 3) {
+      AD::SetPreaccIn(Rmatrix(iPoint,0,2));
+      AD::SetPreaccIn(Rmatrix(iPoint,1,2));
+      AD::SetPreaccIn(Rmatrix(iPoint,2,1));
+      AD::SetPreaccIn(Rmatrix(iPoint,2,2));
+    }
+  }
+
+  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+  su2double Smatrix[nDim][nDim] = {{0.0}};
+
+  computeSmatrix<nDim>(iPoint, Rmatrix, Smatrix);
 
   if (periodic) {
     /*--- Stop preacc here as gradient is in/out. ---*/
@@ -161,6 +177,84 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   }
 }
 
+/*!
+ * \brief Compute the least-squares weights of each point-neighbour pair, see CGeometry::CLeastSquaresWeights.
+ * \ingroup FvmAlgos
+ * \note The weights only depend on the grid, they are computed once and reused until the dual grid is
+ *       updated. Must be called by all threads of a parallel region.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \return The weights, nnz x nDim in the CSR order of the point neighbours.
+ */
+template<size_t nDim>
+const su2activematrix& computeLeastSquaresWeights(CGeometry& geometry, bool weighted) {
+
+  auto& lsq = geometry.GetLeastSquaresWeights();
+  auto& weights = lsq.weights[weighted];
+
+  /*--- The flag is only modified in safe global access blocks, all threads see the same value. ---*/
+
+  if (lsq.valid[weighted]) return weights;
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(weights.resize(geometry.nodes->GetPoints().getNumNonZeros(), nDim);)
+
+  const auto& neighbors = geometry.nodes->GetPoints();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain, 2*omp_get_max_threads()))
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const auto coord_i = geometry.nodes->GetCoord(iPoint);
+
+    auto distanceAndWeight = [&](size_t jPoint, su2double* dist_ij) {
+      GeometryToolbox::Distance(nDim, geometry.nodes->GetCoord(jPoint), coord_i, dist_ij);
+      su2double weight = 1.0;
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+      return weight > 0.0 ? 1.0 / weight : su2double(0.0);
+    };
+
+    /*--- Same R as the point-by-point algorithm, see detail::computeGradientsLeastSquares. ---*/
+
+    struct {
+      su2double R[nDim][nDim] = {{0.0}};
+      su2double operator() (size_t, size_t iDim, size_t jDim) const { return R[iDim][jDim]; }
+    } Rmatrix;
+
+    for (auto jPoint : neighbors.getInnerIter(iPoint)) {
+      su2double dist_ij[nDim] = {0.0};
+      const su2double weight = distanceAndWeight(jPoint, dist_ij);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Rmatrix.R[iDim][jDim] += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+      if (nDim == 3)
+        Rmatrix.R[2][1] += dist_ij[0]*dist_ij[nDim-1]*weight;
+    }
+
+    su2double Smatrix[nDim][nDim] = {{0.0}};
+    computeSmatrix<nDim>(iPoint, Rmatrix, Smatrix);
+
+    /*--- w_ij = S * d_ij * weight_ij ---*/
+
+    for (auto k = neighbors.outerPtr()[iPoint]; k < neighbors.outerPtr()[iPoint+1]; ++k) {
+      su2double dist_ij[nDim] = {0.0};
+      const su2double weight = distanceAndWeight(neighbors.innerIdx()[k], dist_ij);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        weights(k, iDim) = 0.0;
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          weights(k, iDim) += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * dist_ij[jDim] * weight;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(lsq.valid[weighted] = true;)
+
+  return weights;
+}
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -177,8 +271,14 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[out] fieldMin - Optional, see detail::computeGradientsGreenGauss.
+ * \param[out] fieldMax - Optional, see detail::computeGradientsGreenGauss.
+ * \note Without periodic boundaries the precomputed weights (see computeLeastSquaresWeights) are used and
+ *       Rmatrix is not computed. They are not used in reverse AD, where the weights would not be recorded as
+ *       functions of the coordinates, nor with periodicity, where R is only complete after the periodic comms.
  */
-template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+template<size_t nDim, size_t nVar = 0, class FieldType, class GradientType, class RMatrixType,
+         class MinMaxType = std::nullptr_t>
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -189,8 +289,13 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  MinMaxType fieldMin = nullptr,
+                                  MinMaxType fieldMax = nullptr)
 {
+  /*--- Constant trip count for the loops over variables, see computeGradientsGreenGauss. ---*/
+  if (nVar != 0) varEnd = varBegin + nVar;
+
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
   const size_t nPointDomain = geometry.GetnPointDomain();
@@ -202,6 +307,48 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
+#ifndef CODI_REVERSE_TYPE
+  if (!periodic) {
+    /*--- Static stencil, the gradient is a sparse product of the weights and the differences U_j - U_i. ---*/
+
+    const auto& weights = computeLeastSquaresWeights<nDim>(geometry, weighted);
+    const auto& neighbors = geometry.nodes->GetPoints();
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        initMinMax(iPoint, iVar, field, fieldMin, fieldMax);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+      }
+
+      for (auto k = neighbors.outerPtr()[iPoint]; k < neighbors.outerPtr()[iPoint+1]; ++k)
+      {
+        const auto jPoint = neighbors.innerIdx()[k];
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          updateMinMax(iPoint, jPoint, iVar, field, fieldMin, fieldMax);
+
+          const su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += weights(k, iDim) * delta_ij;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+
+    if (solver != nullptr)
+    {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
+    return;
+  }
+#endif
+
   /*--- First loop over non-halo points of the grid. ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
@@ -214,8 +361,10 @@ void computeGradientsLeastSquares(CSolver* solver,
     if (omp_get_num_threads() == 1) AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
       AD::SetPreaccIn(field(iPoint,iVar));
+      initMinMax(iPoint, iVar, field, fieldMin, fieldMax);
+    }
 
     /*--- Clear gradient and Rmatrix. ---*/
 
@@ -239,6 +388,9 @@ void computeGradientsLeastSquares(CSolver* solver,
       su2double dist_ij[nDim] = {0.0};
       GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
 
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        updateMinMax(iPoint, jPoint, iVar, field, fieldMin, fieldMax);
+
 
       /*--- Compute inverse weight, default 1 (unweighted). ---*/
 
@@ -272,6 +424,9 @@ void computeGradientsLeastSquares(CSolver* solver,
       }
     }
 
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      preaccOutMinMax(iPoint, iVar, fieldMin, fieldMax);
+
     if (periodic)
     {
       /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
@@ -298,11 +453,7 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   if (periodic)
   {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    }
+    solver->PeriodicComms(&geometry, &config, kindPeriodicComm);
 
     /*--- Second loop over points of the grid to compute final gradient. ---*/
 
@@ -326,7 +477,7 @@ void computeGradientsLeastSquares(CSolver* solver,
 } // end namespace
 
 /*!
- * \brief Instantiations for 2D and 3D.
+ * \brief Instantiations for 2D and 3D, and for the common numbers of variables.
  * \ingroup FvmAlgos
  */
 template<class FieldType, class GradientType, class RMatrixType>
@@ -341,17 +492,36 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  SU2_PHASE_TIMER(GRADIENTS);
+  SU2_TAPE_PROBE(GRADIENTS);
+  SU2_KERNEL_COUNTER(GRADIENTS);
+
+  const size_t nVar = varEnd - varBegin;
+
+#define COMPUTE_LS(NDIM, NVAR) detail::computeGradientsLeastSquares<NDIM, NVAR>(solver, kindMpiComm, \
+  kindPeriodicComm, geometry, config, weighted, field, varBegin, varEnd, gradient, Rmatrix)
+
   switch (geometry.GetnDim()) {
   case 2:
-    detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    switch (nVar) {
+      case 1: COMPUTE_LS(2, 1); break;
+      case 2: COMPUTE_LS(2, 2); break;
+      case 6: COMPUTE_LS(2, 6); break;
+      default: COMPUTE_LS(2, 0); break;
+    }
     break;
   case 3:
-    detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    switch (nVar) {
+      case 1: COMPUTE_LS(3, 1); break;
+      case 2: COMPUTE_LS(3, 2); break;
+      case 7: COMPUTE_LS(3, 7); break;
+      default: COMPUTE_LS(3, 0); break;
+    }
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
     break;
   }
+
+#undef COMPUTE_LS
 }
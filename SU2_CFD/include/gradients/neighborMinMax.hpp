@@ -0,0 +1,76 @@
+/*!
+ * \file neighborMinMax.hpp
+ * \brief Helpers to compute the min/max of a field over the direct neighbors of each
+ *        point, as part of the gradient loops (see computeGradientsAndLimiters.hpp).
+ * \note The functions do nothing when the min/max objects are nullptr_t, which is
+ *       the default for the gradient functions, i.e. no overhead when not fused.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace detail {
+
+/*!
+ * \brief Initialize the min/max of iPoint with its own value.
+ * \ingroup FvmAlgos
+ */
+template<class FieldType, class MinMaxType>
+FORCEINLINE void initMinMax(size_t iPoint, size_t iVar, const FieldType& field,
+                            MinMaxType* fieldMin, MinMaxType* fieldMax) {
+  (*fieldMin)(iPoint,iVar) = (*fieldMax)(iPoint,iVar) = field(iPoint,iVar);
+}
+
+template<class FieldType>
+FORCEINLINE void initMinMax(size_t, size_t, const FieldType&, std::nullptr_t, std::nullptr_t) {}
+
+/*!
+ * \brief Update the min/max of iPoint with the value of a neighbor (jPoint).
+ * \ingroup FvmAlgos
+ */
+template<class FieldType, class MinMaxType>
+FORCEINLINE void updateMinMax(size_t iPoint, size_t jPoint, size_t iVar, const FieldType& field,
+                              MinMaxType* fieldMin, MinMaxType* fieldMax) {
+  (*fieldMin)(iPoint,iVar) = min((*fieldMin)(iPoint,iVar), field(jPoint,iVar));
+  (*fieldMax)(iPoint,iVar) = max((*fieldMax)(iPoint,iVar), field(jPoint,iVar));
+}
+
+template<class FieldType>
+FORCEINLINE void updateMinMax(size_t, size_t, size_t, const FieldType&, std::nullptr_t, std::nullptr_t) {}
+
+/*!
+ * \brief Register the min/max of iPoint as outputs of the preaccumulation.
+ * \ingroup FvmAlgos
+ */
+template<class MinMaxType>
+FORCEINLINE void preaccOutMinMax(size_t iPoint, size_t iVar, MinMaxType* fieldMin, MinMaxType* fieldMax) {
+  AD::SetPreaccOut((*fieldMin)(iPoint,iVar));
+  AD::SetPreaccOut((*fieldMax)(iPoint,iVar));
+}
+
+FORCEINLINE void preaccOutMinMax(size_t, size_t, std::nullptr_t, std::nullptr_t) {}
+
+} // end namespace
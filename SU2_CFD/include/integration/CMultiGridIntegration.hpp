@@ -72,6 +72,8 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \note The restriction of the fine residual is done by SetRestricted_Solution (same sweep over the children),
+   *       this subtracts the coarse residual from it.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
@@ -157,7 +159,8 @@ private:
                                     unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config);
 
   /*!
-   * \brief Restrict solution from fine grid to a coarse grid.
+   * \brief Restrict solution from fine grid to a coarse grid, and the fine residual to the truncation error
+   *        of the coarse grid (first part of the forcing term, see SetForcing_Term).
    * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[out] sol_coarse - Pointer to the solution on the coarse grid.
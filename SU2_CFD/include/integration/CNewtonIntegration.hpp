@@ -47,7 +47,8 @@
  * \class CNewtonIntegration
  * \ingroup Drivers
  * \brief Class for time integration using a Newton-Krylov method, based
- * on matrix-free products with the true Jacobian via finite differences.
+ * on matrix-free products with the true Jacobian via finite differences,
+ * or forward AD (tangent mode) in SU2_CFD_DIRECTDIFF builds.
  * \author P. Gomes
  */
 class CNewtonIntegration final : public CIntegration {
@@ -67,6 +68,7 @@ private:
   enum class ResEvalType {EXPLICIT, DEFAULT};
 
   bool setup = false;
+  bool forwardAD = false; /*!< \brief Use forward AD instead of finite differences for the products. */
   Scalar finDiffStepND = 0.0;
   Scalar finDiffStep = 0.0; /*!< \brief Based on RMS(solution), used in matrix-free products. */
   unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
@@ -90,6 +92,13 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- The solvers of the system, the flow and optionally the turbulence model (NEWTON_KRYLOV_COUPLED_TURB),
+   * the variables of each point are stored one solver after the other. ---*/
+  static constexpr unsigned short MaxBlocks = 2;
+  const unsigned short BlockSolver[MaxBlocks] = {FLOW_SOL, TURB_SOL};
+  unsigned short nBlock = 1;
+  unsigned short BlockOffset[MaxBlocks] = {0};
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -103,10 +112,16 @@ private:
   CSysVector<Scalar> LinSysSol;
 
   template<class T, su2enable_if<std::is_same<T,Scalar>::value> = 0>
-  inline CSysVector<Scalar>& GetSolutionVec(CSysVector<T>& x) { return x; }
+  inline CSysVector<Scalar>& GetSolutionVec(CSysVector<T>& x) {
+    if (nBlock == 1) return x;
+    LinSysSol = Scalar(0.0);
+    return LinSysSol;
+  }
 
   template<class T, su2enable_if<std::is_same<T,Scalar>::value> = 0>
-  inline void SetSolutionResult(CSysVector<T>&) const { }
+  inline void SetSolutionResult(CSysVector<T>&) {
+    if (nBlock > 1) ScatterSolution();
+  }
 
   template<class T, su2enable_if<!std::is_same<T,Scalar>::value> = 0>
   inline CSysVector<Scalar>& GetSolutionVec(CSysVector<T>&) {
@@ -115,17 +130,29 @@ private:
   }
 
   template<class T, su2enable_if<!std::is_same<T,Scalar>::value> = 0>
-  inline void SetSolutionResult(CSysVector<T>& x) const {
+  inline void SetSolutionResult(CSysVector<T>& x) {
+    if (nBlock > 1) {
+      ScatterSolution();
+      return;
+    }
     CNEWTON_PARFOR
     for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = LinSysSol[i];
     END_CNEWTON_PARFOR
   }
 
+  /*!
+   * \brief Copy the solution of the coupled system (LinSysSol) to the LinSysSol of each solver.
+   */
+  void ScatterSolution();
+
   /*--- Preconditioner objects for each active solver. ---*/
   CPreconditioner<MixedScalar>* preconditioner = nullptr;
+  CPreconditioner<MixedScalar>* turbPreconditioner = nullptr;
 
-  /*--- If mixed precision is used, these temporaries are used to interface with the preconditioner. ---*/
+  /*--- If mixed precision is used, or the system is coupled, these temporaries
+   * are used to interface with the preconditioners of the solvers. ---*/
   mutable CSysVector<MixedScalar> precondIn, precondOut;
+  mutable CSysVector<MixedScalar> turbPrecondIn, turbPrecondOut;
 
   template<class T, su2enable_if<!std::is_same<T,MixedScalar>::value> = 0>
   inline unsigned long Preconditioner_impl(const CSysVector<T>& u, CSysVector<T>& v,
@@ -148,18 +175,42 @@ private:
   template<class T, su2enable_if<std::is_same<T,MixedScalar>::value> = 0>
   inline unsigned long Preconditioner_impl(const CSysVector<T>& u, CSysVector<T>& v,
                                            unsigned long iters, Scalar& eps) const {
+    return SolveBlock(*preconditioner, solvers[FLOW_SOL], u, v, iters, eps);
+  }
+
+  /*!
+   * \brief Apply the linear preconditioner of a solver, or iterate on its (approximate) Jacobian.
+   */
+  inline unsigned long SolveBlock(const CPreconditioner<MixedScalar>& precond, CSolver* solver,
+                                  const CSysVector<MixedScalar>& u, CSysVector<MixedScalar>& v,
+                                  unsigned long iters, Scalar& eps) const {
     if (iters == 0) {
-      (*preconditioner)(u, v);
+      precond(u, v);
       return 0;
     }
-    auto product = CSysMatrixVectorProduct<MixedScalar>(solvers[FLOW_SOL]->Jacobian, geometry, config);
+    auto product = CSysMatrixVectorProduct<MixedScalar>(solver->Jacobian, geometry, config);
     v = MixedScalar(0.0);
     MixedScalar eps_t = eps;
-    iters = solvers[FLOW_SOL]->System.FGMRES_LinSolver(u, v, product, *preconditioner, eps, iters, eps_t, false, config);
+    iters = solver->System.FGMRES_LinSolver(u, v, product, precond, eps, iters, eps_t, false, config);
     eps = eps_t;
     return iters;
   }
 
+  /*!
+   * \brief Block diagonal preconditioner of the coupled system, each solver preconditions its variables.
+   */
+  unsigned long CoupledPreconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v,
+                                      unsigned long iters, Scalar& eps) const;
+
+  /*!
+   * \brief Entry point for linear preconditioning, of the flow system or of the coupled system.
+   */
+  inline unsigned long ApplyPreconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v,
+                                           unsigned long iters, Scalar& eps) const {
+    if (nBlock > 1) return CoupledPreconditioner(u, v, iters, eps);
+    return Preconditioner_impl(u, v, iters, eps);
+  }
+
   /*!
    * \brief Gather solver info, etc..
    */
@@ -181,6 +232,12 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Exact Jacobian-vector product via forward AD, the direction is set as the tangent of the
+   * solution and the product is the tangent of the (explicit) residual, i.e. no perturbation or step.
+   */
+  void ForwardADProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
+
 public:
   /*!
    * \brief Constructor.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -38,6 +39,8 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
+#include <list>
 
 class CConfig;
 class CGeometry;
@@ -73,6 +76,50 @@ protected:
   unsigned short nVar = 0;
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*!
+   * \brief Point-to-point communication plan of BroadcastData for one interface marker. The ranks (this one
+   *        included, its data is copied) and their offsets refer to the send and receive buffers of donor values.
+   */
+  struct CTransferPlan {
+    vector<int> sendRanks, recvRanks;             /*!< \brief Ranks to send to and receive from. */
+    vector<unsigned long> sendStart, recvStart;   /*!< \brief Start of the data of each rank in the buffers. */
+    vector<unsigned long> donorVertex;            /*!< \brief Donor vertices (unique) whose values are sent. */
+    vector<unsigned long> sendDonor;              /*!< \brief Index in donorVertex of each send buffer entry. */
+    vector<unsigned long> targetSlot;             /*!< \brief Receive buffer entry of each donor of each target vertex. */
+  };
+  vector<CTransferPlan> transferPlans;            /*!< \brief Plan for each interface marker. */
+  const CInterpolator* planInterpolator = nullptr; /*!< \brief Interpolator from which the plans were built. */
+  unsigned long planVersion = 0;                  /*!< \brief Version of its coefficients when the plans were built. */
+
+  /*!
+   * \brief Broadcast whose messages were posted by StartBroadcastData but not yet completed.
+   */
+  struct CPendingBroadcast {
+    const CInterpolator* interpolator;
+    CSolver *target_solution;
+    CGeometry *target_geometry;
+    const CConfig *target_config;
+    vector<int> markTarget;                 /*!< \brief Target marker of each interface marker (negative if none). */
+    vector<su2activematrix> sendVar;        /*!< \brief Send buffer of each interface marker. */
+    vector<su2activematrix> recvVar;        /*!< \brief Receive buffer of each interface marker. */
+    vector<SU2_MPI::Request> requests;      /*!< \brief Requests of all the messages. */
+  };
+  list<CPendingBroadcast> pendingBroadcasts; /*!< \brief A list, the buffers must not move while in use by MPI. */
+
+  /*!
+   * \brief Build the communication plan of an interface marker from the donor information of the interpolator,
+   *        such that each rank only receives the donor values its target vertices need.
+   * \note Collective, the ranks exchange the global indices of the donors they need with their owners.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] markDonor - Donor marker on this rank (negative if none).
+   * \param[in] markTarget - Target marker on this rank (negative if none).
+   * \param[out] plan - The communication plan.
+   */
+  void BuildTransferPlan(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                         const CGeometry *target_geometry, int markDonor, int markTarget, CTransferPlan& plan) const;
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -104,7 +151,34 @@ public:
   void BroadcastData(const CInterpolator& interpolator,
                      CSolver *donor_solution, CSolver *target_solution,
                      CGeometry *donor_geometry, CGeometry *target_geometry,
-                     const CConfig *donor_config, const CConfig *target_config);
+                     const CConfig *donor_config, const CConfig *target_config) {
+    StartBroadcastData(interpolator, donor_solution, target_solution, donor_geometry, target_geometry,
+                       donor_config, target_config);
+    FinishBroadcastData();
+  }
+
+  /*!
+   * \brief Evaluate the donor data and post the (non-blocking) messages of BroadcastData, such that the
+   *        communication of several interfaces can overlap. The target data is only set by FinishBroadcastData.
+   * \note All ranks must start the broadcasts of all interfaces in the same order.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] target_solution - Solution from the target mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void StartBroadcastData(const CInterpolator& interpolator,
+                          CSolver *donor_solution, CSolver *target_solution,
+                          CGeometry *donor_geometry, CGeometry *target_geometry,
+                          const CConfig *donor_config, const CConfig *target_config);
+
+  /*!
+   * \brief Complete the broadcasts started by StartBroadcastData (in the order they were started) and set the
+   *        target data. Does nothing if there are no broadcasts in progress.
+   */
+  void FinishBroadcastData();
 
 protected:
   /*!
@@ -196,13 +270,15 @@ public:
                          const CConfig *donor_config, const CConfig *target_config, unsigned short iMarkerInt);
 
   /*!
-   * \brief Interpolate data and scatter it into different processors, for matching meshes.
+   * \brief Make the span-wise averages of the donor available to all ranks (one reduction of all the
+   *        quantities) and interpolate them to the span-wise levels of the target, for mixing planes.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
    * \param[in] donor_geometry - Geometry of the donor mesh.
    * \param[in] target_geometry - Geometry of the target mesh.
    * \param[in] donor_config - Definition of the problem at the donor mesh.
    * \param[in] target_config - Definition of the problem at the target mesh.
+   * \param[in] iMarkerInt - Index of the mixing plane interface.
    */
   void AllgatherAverage(CSolver *donor_solution, CSolver *target_solution,
                         CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -29,8 +29,10 @@
 #pragma once
 
 #include "CIteration.hpp"
+#include "CFluidIteration.hpp"
+#include "../../../Common/include/toolboxes/CCompressedMatrix.hpp"
 
-class CFluidIteration;
+#include <memory>
 
 /*!
  * \class CDiscAdjFluidIteration
@@ -42,6 +44,18 @@ class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
 
+  /*!
+   * \brief Primal solutions (all primal solvers and grid levels) of a time step, and of the previous
+   *        one for second order dual time, kept in memory to avoid recomputing the step. They are
+   *        compressed with the tolerance UNST_ADJOINT_CHECKPOINT_TOL.
+   */
+  struct PrimalCheckpoint {
+    int iter = -1;
+    vector<CCompressedMatrix> solution, solution_n;
+  };
+  vector<PrimalCheckpoint> checkpoints;         /*!< \brief Slots for the recomputed primal time steps. */
+  std::unique_ptr<CFluidIteration> primalIteration; /*!< \brief To recompute steps for which there is no restart. */
+
   /*!
    * \brief load unsteady solution for unsteady problems
    * \param[in] geometry - Geometrical definition of the problem.
@@ -54,13 +68,33 @@ class CDiscAdjFluidIteration final : public CIteration {
   void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short val_iZone,
                              unsigned short val_iInst, int val_DirectIter);
 
+  /*!
+   * \brief Check if the primal solution of a time step is available, either from a restart file
+   *        or from the checkpoints in memory.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Direct iteration.
+   * \param[in] checkFile - Only check the restart file.
+   */
+  bool PrimalSolutionAvailable(const CConfig* config, int iter, bool checkFile = false) const;
+
+  /*!
+   * \brief Recompute the primal solution of a time step from the closest earlier restart file or
+   *        checkpoint, intermediate steps are kept in the free checkpoint slots such that the
+   *        following (earlier) steps of the reverse sweep can be recomputed from them.
+   * \note The primal solution of the current adjoint time step is not modified.
+   * \param[in] target - Direct iteration to recompute.
+   */
+  void RecomputePrimalSolution(COutput* output, CIntegration**** integration, CGeometry**** geometry,
+                               CSolver***** solver, CNumerics****** numerics, CConfig** config,
+                               CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
+                               CFreeFormDefBox*** FFDBox, unsigned short iZone, unsigned short iInst, int target);
+
  public:
   /*!
    * \brief Constructor of the class.
    * \param[in] config - Definition of the particular problem.
    */
-  explicit CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
-    turbulent(config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_RANS || config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_INC_RANS) {}
+  explicit CDiscAdjFluidIteration(const CConfig *config);
 
   /*!
    * \brief Preprocessing to prepare for an iteration of the physics.
@@ -29,6 +29,8 @@
 #pragma once
 
 #include "CIteration.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../solvers/CResidualReduction.hpp"
 
 /*!
  * \class CFluidIteration
@@ -37,6 +39,25 @@
  * \author T. Economon
  */
 class CFluidIteration : public CIteration {
+ private:
+  /*--- Quasi-Newton acceleration of the steady fixed-point iterations (QUASI_NEWTON_PRIMAL). ---*/
+  CQuasiNewtonInvLeastSquares<passivedouble> QNAccelerator; /*!< \brief History of the iterations. */
+  su2double QNMinResidual = 0.0; /*!< \brief Lowest residual since the history was (re)started. */
+
+  CResidualReduction ResidualReduction; /*!< \brief Packed reduction of the residuals (DEFERRED_RESIDUAL_REDUCTION). */
+
+  /*!
+   * \brief Correct the solution of all solvers with the quasi-Newton method, the history is discarded
+   *        if the residuals increase too much (also ending the correction of the current iteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance.
+   */
+  void QuasiNewtonCorrection(CGeometry**** geometry, CSolver***** solver, CConfig** config,
+                             unsigned short val_iZone, unsigned short val_iInst);
+
  public:
   /*!
    * \brief Constructor of the class.
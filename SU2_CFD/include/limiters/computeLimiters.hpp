@@ -25,8 +25,12 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -49,18 +53,22 @@ void computeLimiters(LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     bool computeMinMax = true)
 {
+  SU2_PHASE_TIMER(LIMITERS);
+  SU2_TAPE_PROBE(LIMITERS);
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
 #define INSTANTIATE(KIND)\
 if (geometry.GetnDim() == 2) {\
   computeLimiters_impl<2,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, computeMinMax);\
 } else {\
   computeLimiters_impl<3,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, computeMinMax);\
 }
   switch (LimiterKind) {
     case LIMITER::NONE:
@@ -54,6 +54,8 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] computeMinMax - False if fieldMin/fieldMax were computed with the gradient
+ *            (see computeGradientsAndLimiters.hpp), no periodicity is assumed in that case.
  *
  * Template parameters:
  * \param nDim - Number of dimensions.
@@ -74,7 +76,8 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool computeMinMax)
 {
   constexpr size_t MAXNVAR = 32;
 
@@ -118,11 +121,7 @@ void computeLimiters_impl(CSolver* solver,
         fieldMax(iPoint,iVar) = fieldMin(iPoint,iVar) = field(iPoint,iVar);
     END_SU2_OMP_FOR
 
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm1);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm1);
-    }
+    solver->PeriodicComms(&geometry, &config, kindPeriodicComm1);
   }
 
   /*--- Compute limiter for each point. ---*/
@@ -141,7 +140,7 @@ void computeLimiters_impl(CSolver* solver,
     {
       AD::SetPreaccIn(field(iPoint,iVar));
 
-      if (periodic) {
+      if (periodic || !computeMinMax) {
         /*--- Started outside loop, so counts as input. ---*/
         AD::SetPreaccIn(fieldMax(iPoint,iVar));
         AD::SetPreaccIn(fieldMin(iPoint,iVar));
@@ -189,6 +188,8 @@ void computeLimiters_impl(CSolver* solver,
         projMax[iVar] = max(projMax[iVar], proj);
         projMin[iVar] = min(projMin[iVar], proj);
 
+        if (!computeMinMax) continue;
+
         AD::SetPreaccIn(field(jPoint,iVar));
 
         fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
@@ -223,11 +224,7 @@ void computeLimiters_impl(CSolver* solver,
   /*--- Account for periodic effects, take the minimum limiter on each periodic pair. ---*/
   if (periodic)
   {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
-    }
+    solver->PeriodicComms(&geometry, &config, kindPeriodicComm2);
   }
 
   /*--- Obtain the limiters at halo points from the MPI ranks that own them.
@@ -82,6 +82,20 @@ private:
    */
   void Compute_Constitutive_Matrix(CElement *element_container, const CConfig *config) final;
 
+  /*!
+   * \brief Add the stiffness of 3D tetrahedra and hexahedra with the batched element kernels.
+   * \param[in,out] element - The finite element, with the gradients in the reference frame.
+   * \return False if there is no batched kernel for the element.
+   */
+  bool Compute_Stiffness_Batched(CElement *element) const;
+
+  /*!
+   * \brief Batched stiffness for a particular number of nodes and Gauss points.
+   * \param[in,out] element - The finite element, with the gradients in the reference frame.
+   */
+  template <size_t NNODE, size_t NGAUSS>
+  void Compute_Stiffness_Batched(CElement *element) const;
+
 };
 
 
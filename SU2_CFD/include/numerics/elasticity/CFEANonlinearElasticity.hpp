@@ -173,4 +173,31 @@ protected:
    */
   void Assign_cijkl_D_Mat(void);
 
+  /*!
+   * \brief Compute the deformation gradient, its determinant, and the left Cauchy-Green tensor at a Gauss point.
+   * \param[in] element_container - The finite element, with the gradients in both frames.
+   * \param[in] iGauss - Index of the Gauss point.
+   * \param[in] config - Definition of the problem.
+   */
+  void Compute_Kinematics(CElement *element_container, unsigned short iGauss, const CConfig *config);
+
+  /*!
+   * \brief Build the tangent matrix of 3D tetrahedra and hexahedra with the batched element kernels.
+   * \param[in,out] element_container - The finite element, with the gradients in both frames.
+   * \param[in] config - Definition of the problem.
+   * \param[in] stressTermOnly - Compute only the nodal stress term (Compute_NodalStress_Term).
+   * \return False if there is no batched kernel for the element.
+   */
+  bool Compute_Tangent_Matrix_Batched(CElement *element_container, const CConfig *config, bool stressTermOnly);
+
+  /*!
+   * \brief Batched tangent matrix for a particular number of nodes and Gauss points, the material
+   *        model is evaluated per Gauss point, the integration over the nodes uses SIMD lanes.
+   * \param[in,out] element_container - The finite element, with the gradients in both frames.
+   * \param[in] config - Definition of the problem.
+   * \param[in] stressTermOnly - Compute only the nodal stress term.
+   */
+  template <size_t NNODE, size_t NGAUSS>
+  void Compute_Tangent_Matrix_Batched(CElement *element_container, const CConfig *config, bool stressTermOnly);
+
 };
@@ -111,6 +111,7 @@ class CSourceBase_TurbSA : public CNumerics {
     AD::SetPreaccIn(Vorticity_i, 3);
     AD::SetPreaccIn(PrimVar_Grad_i + idx.Velocity(), nDim, nDim);
     AD::SetPreaccIn(ScalarVar_Grad_i[0], nDim);
+    if (transition_LM) AD::SetPreaccIn(intermittency_eff_i, intermittency_i);
 
     /*--- Common auxiliary variables and constants of the model. ---*/
     CSAVariables var;
@@ -220,6 +221,8 @@ class CSourceBase_TurbSA : public CNumerics {
       Jacobian_i[0] *= Volume;
     }
 
+    /*--- The BC model computes the intermittency, which is stored by the solver. ---*/
+    if (options.bc && dist_i > 1e-10) AD::SetPreaccOut(intermittency_eff_i);
     AD::SetPreaccOut(Residual);
     AD::EndPreacc();
 
@@ -601,6 +604,7 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
   const FlowIndices idx; /*!< \brief Object to manage the access to the flow primitives. */
   const bool sustaining_terms = false;
   const bool axisymmetric = false;
+  const bool transition_LM = false;
 
   /*--- Closure constants ---*/
   const su2double sigma_k_1, sigma_k_2, sigma_w_1, sigma_w_2, beta_1, beta_2, beta_star, a1, alfa_1, alfa_2;
@@ -678,6 +682,7 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
       : CNumerics(val_nDim, 2, config),
         idx(val_nDim, config->GetnSpecies()),
         axisymmetric(config->GetAxisymmetric()),
+        transition_LM(config->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM),
         sigma_k_1(constants[0]),
         sigma_k_2(constants[1]),
         sigma_w_1(constants[2]),
@@ -759,7 +764,7 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
 
     su2double eff_intermittency = 1.0;
 
-    if (config->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
+    if (transition_LM) {
       AD::SetPreaccIn(intermittency_eff_i);
       eff_intermittency = intermittency_eff_i;
     }
@@ -0,0 +1,133 @@
+/*!
+ * \file CEdgeGeometryCache.hpp
+ * \brief Geometric properties of the edges stored in the order of the edge loops.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CNumericsSIMD.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CEdgeGeometryCache
+ * \brief Node indices, normal, area, and i-j vector of the edges, grouped in packs of SIMD length in the order
+ *        in which the edge colors are visited. The flux kernels then load each property of a pack with one
+ *        contiguous read, instead of gathering it from the edge and point data.
+ * \note The padding lanes of the last pack of a color repeat the first edge of the pack, as in the edge loops.
+ *       The cache is only valid for static grids.
+ */
+class CEdgeGeometryCache {
+ private:
+  enum : size_t { SIMDLEN = Double::Size };
+  enum : size_t { MAX_CHUNK = 512 }; /*!< \brief Maximum number of packs per chunk of the parallel loops. */
+
+  unsigned long nDim = 0;           /*!< \brief Number of dimensions. */
+  unsigned long nPack = 0;          /*!< \brief Number of packs of edges. */
+  su2vector<unsigned long> nodes;   /*!< \brief Rows [i, j] of each pack. */
+  su2activevector geometry;         /*!< \brief Rows [normal (nDim), area, vector_ij (nDim)] of each pack. */
+
+  unsigned long RowsPerPack() const { return 2 * nDim + 1; }
+
+ public:
+  /*!
+   * \brief Number of packs of edges of a set of colors.
+   */
+  template <class ColorsType>
+  static unsigned long NumPacks(const ColorsType& colors) {
+    unsigned long n = 0;
+    for (const auto& color : colors) n += (color.size + SIMDLEN - 1) / SIMDLEN;
+    return n;
+  }
+
+  /*!
+   * \brief Allocate the cache (not thread-safe).
+   * \param[in] nDim_ - Number of dimensions.
+   * \param[in] nPack_ - Total number of packs of all the colors that are cached.
+   */
+  void Allocate(unsigned short nDim_, unsigned long nPack_) {
+    nDim = nDim_;
+    nPack = nPack_;
+    nodes.resize(2 * nPack * SIMDLEN);
+    geometry.resize(RowsPerPack() * nPack * SIMDLEN);
+  }
+
+  /*!
+   * \brief Store the edges of a set of colors, in parallel.
+   * \param[in] geo - Geometrical definition of the problem.
+   * \param[in] colors - Colors in the order they are visited by the edge loop.
+   * \param[in] firstPack - Index of the first pack of the colors in the cache.
+   * \return Index of the pack after the last one of the colors.
+   */
+  template <class ColorsType>
+  unsigned long Set(const CGeometry& geo, const ColorsType& colors, unsigned long firstPack) {
+    for (const auto& color : colors) {
+      const auto nPackColor = (color.size + SIMDLEN - 1) / SIMDLEN;
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nPackColor, omp_get_num_threads(), MAX_CHUNK))
+      for (auto iPack = 0ul; iPack < nPackColor; ++iPack) {
+        auto* packNodes = &nodes(2 * (firstPack + iPack) * SIMDLEN);
+        auto* packGeo = &geometry(RowsPerPack() * (firstPack + iPack) * SIMDLEN);
+
+        const auto k = iPack * SIMDLEN;
+        for (auto j = 0ul; j < SIMDLEN; ++j) {
+          const bool in = (k + j < color.size);
+          const auto iEdge = color.indices[k + j * in];
+          const auto iPoint = geo.edges->GetNode(iEdge, 0);
+          const auto jPoint = geo.edges->GetNode(iEdge, 1);
+          packNodes[j] = iPoint;
+          packNodes[SIMDLEN + j] = jPoint;
+
+          const auto normal = geo.edges->GetNormal(iEdge);
+          su2double area = 0.0;
+          for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+            packGeo[iDim * SIMDLEN + j] = normal[iDim];
+            area += pow(normal[iDim], 2);
+            packGeo[(nDim + 1 + iDim) * SIMDLEN + j] =
+                geo.nodes->GetCoord(jPoint, iDim) - geo.nodes->GetCoord(iPoint, iDim);
+          }
+          packGeo[nDim * SIMDLEN + j] = sqrt(area);
+        }
+      }
+      END_SU2_OMP_FOR
+      firstPack += nPackColor;
+    }
+    return firstPack;
+  }
+
+  /*!
+   * \brief Whether the cache was allocated.
+   */
+  bool empty() const { return nPack == 0; }
+
+  /*!
+   * \brief Node indices of a pack, SIMD-length rows i and j.
+   */
+  const unsigned long* GetNodes(unsigned long iPack) const { return &nodes(2 * iPack * SIMDLEN); }
+
+  /*!
+   * \brief Geometry of a pack, SIMD-length rows of normal (nDim), area, and i-j vector (nDim).
+   */
+  const su2double* GetGeometry(unsigned long iPack) const { return &geometry(RowsPerPack() * iPack * SIMDLEN); }
+};
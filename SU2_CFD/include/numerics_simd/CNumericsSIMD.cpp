@@ -29,8 +29,16 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "flow/boundary/farfield.hpp"
+#include "NEMO/convection/ausm.hpp"
+#include "turbulent/turb_convection.hpp"
+#include "turbulent/turb_diffusion.hpp"
+#include "heat/heat_diffusion.hpp"
 
 namespace {
 
@@ -44,6 +52,17 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -126,6 +145,74 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Incompressible flow factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createIncNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  /*--- Only the FDS scheme (the upwind scheme of the incompressible solver) is implemented. ---*/
+  if ((config.GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) ||
+      (config.GetKind_Upwind_Flow() != UPWIND::FDS)) return nullptr;
+
+  if (config.GetViscous())
+    return new CFDSIncScheme<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+  return new CFDSIncScheme<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+}
+
+/*!
+ * \brief Turbulence factory implementation.
+ */
+template<int nDim, bool incompressible>
+CNumericsSIMD* createTurbNumerics(const CConfig& config, const CVariable* flowVars, const su2double* constants) {
+  using FlowIndices = CTurbFlowIndices<nDim, incompressible>;
+  CNumericsSIMD* obj = nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA:
+      if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+        obj = new CUpwScalarTurbScheme<CSADiffusion<FlowIndices, true> >(config, flowVars, constants);
+      else
+        obj = new CUpwScalarTurbScheme<CSADiffusion<FlowIndices, false> >(config, flowVars, constants);
+      break;
+    case TURB_MODEL::SST:
+      obj = new CUpwScalarTurbScheme<CSSTDiffusion<FlowIndices> >(config, flowVars, constants);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief NEMO factory implementation.
+ */
+template<int nDim, int nSpecies>
+CNumericsSIMD* createNEMONumerics(const CConfig& config, CNEMOGas& fluidModel) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case UPWIND::AUSM:
+      obj = new CAUSMNEMOScheme<nDim,nSpecies>(config, fluidModel);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Instantiate the NEMO numerics for the mixtures of the SU2TC library (1, 2, 5, and 7 species).
+ */
+template<int nDim>
+CNumericsSIMD* createNEMONumerics(const CConfig& config, int nSpecies, CNEMOGas& fluidModel) {
+  switch (nSpecies) {
+    case 1: return createNEMONumerics<nDim,1>(config, fluidModel);
+    case 2: return createNEMONumerics<nDim,2>(config, fluidModel);
+    case 5: return createNEMONumerics<nDim,5>(config, fluidModel);
+    case 7: return createNEMONumerics<nDim,7>(config, fluidModel);
+    default: return nullptr;
+  }
+}
+
 } // namespace
 
 /*!
@@ -140,8 +227,70 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
             "         see https://su2code.github.io/docs_v7/Build-SU2-Linux-MacOS/#compiler-optimizations" << endl;
   }
 #endif
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (nDim == 2) return createIncNumerics<2>(config, iMesh, turbVars);
+    if (nDim == 3) return createIncNumerics<3>(config, iMesh, turbVars);
+    return nullptr;
+  }
   if (nDim == 2) return createNumerics<2>(config, iMesh, turbVars);
   if (nDim == 3) return createNumerics<3>(config, iMesh, turbVars);
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                                 const su2double* constants) {
+  /*--- Only the (first order) scalar upwind scheme is implemented, with the same MUSCL options. ---*/
+  if (config.GetNEMOProblem() || (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND)) return nullptr;
+
+  const bool incompressible = (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
+
+  if (nDim == 2) {
+    if (incompressible) return createTurbNumerics<2,true>(config, flowVars, constants);
+    return createTurbNumerics<2,false>(config, flowVars, constants);
+  }
+  if (nDim == 3) {
+    if (incompressible) return createTurbNumerics<3,true>(config, flowVars, constants);
+    return createTurbNumerics<3,false>(config, flowVars, constants);
+  }
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateNEMONumerics(const CConfig& config, int nDim, int nSpecies,
+                                                 CNEMOGas& fluidModel) {
+  /*--- Only the first order AUSM scheme is implemented. ---*/
+  if (config.GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) return nullptr;
+
+  if (nDim == 2) return createNEMONumerics<2>(config, nSpecies, fluidModel);
+  if (nDim == 3) return createNEMONumerics<3>(config, nSpecies, fluidModel);
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateHeatNumerics(const CConfig& config, int nDim) {
+  if (nDim == 2) return new CHeatDiffusion<2>(config);
+  if (nDim == 3) return new CHeatDiffusion<3>(config);
+  return nullptr;
+}
+
+CBoundaryNumericsSIMD* CBoundaryNumericsSIMD::CreateFarfieldNumerics(const CConfig& config, int nDim) {
+#ifdef CODI_REVERSE_TYPE
+  /*--- The vertex geometry cache would hide the dependence of the fluxes on the grid. ---*/
+  return nullptr;
+#else
+  if ((config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) || config.GetNEMOProblem() ||
+      config.GetDynamic_Grid()) return nullptr;
+
+  /*--- Only the Roe scheme is implemented, it is the boundary scheme of the centered schemes,
+   * and of the Roe scheme for ideal gas (see CDriver::NumericsPreprocessing). ---*/
+  const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config.GetKind_FluidModel() == IDEAL_GAS);
+  const bool roeBoundary = (config.GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) ||
+                           ((config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+                            (config.GetKind_Upwind_Flow() == UPWIND::ROE) && ideal_gas);
+  if (!roeBoundary) return nullptr;
+
+  if (nDim == 2) return new CFarfieldRoeScheme<2>(config);
+  if (nDim == 3) return new CFarfieldRoeScheme<3>(config);
+  return nullptr;
+#endif
+}
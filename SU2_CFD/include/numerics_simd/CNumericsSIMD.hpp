@@ -28,14 +28,17 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 /*!
  * \enum UpdateType
  * \brief Ways to update vectors and system matrices.
  * COLORING is the typical i/j update, whereas for REDUCTION
  * the fluxes are stored and the matrix diagonal is not modified.
+ * ROW_I and ROW_J only update the rows of point i or j respectively
+ * (owner computes strategy, the other row is updated by another thread).
  */
-enum class UpdateType {COLORING, REDUCTION};
+enum class UpdateType {COLORING, REDUCTION, ROW_I, ROW_J};
 
 /*!
  * \brief Define Double and Int SIMD types.
@@ -49,6 +52,9 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CEdgeGeometryCache;
+class CVertexGeometryCache;
+class CNEMOGas;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -74,6 +80,8 @@ public:
    * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
    * \param[in,out] vector - Target for the fluxes.
    * \param[in,out] matrix - Target for the flux Jacobians.
+   * \param[in] edgeCache - Geometry of the edges in loop order, nullptr to read it from the geometry.
+   * \param[in] iPack - Index of the pack of edges in edgeCache.
    * \note The update mask is used to handle "remainder" edges (nEdge mod simdSize).
    */
   virtual void ComputeFlux(Int iEdge,
@@ -83,13 +91,15 @@ public:
                            UpdateType updateType,
                            Double updateMask,
                            CSysVector<su2double>& vector,
-                           SparseMatrixType& matrix) const = 0;
+                           SparseMatrixType& matrix,
+                           const CEdgeGeometryCache* edgeCache,
+                           unsigned long iPack) const = 0;
 
   /*! \brief Destructor of the class. */
   virtual ~CNumericsSIMD(void) = default;
 
   /*!
-   * \brief Factory method.
+   * \brief Factory method, for compressible or incompressible flow depending on the regime.
    * \param[in] config - Problem definitions.
    * \param[in] nDim - 2D or 3D.
    * \param[in] iMesh - Grid index.
@@ -97,4 +107,76 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the convection and diffusion of turbulence models (SA and SST).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Model constants (SST).
+   * \return nullptr if the combination of model and schemes is not supported.
+   */
+  static CNumericsSIMD* CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                           const su2double* constants = nullptr);
+
+  /*!
+   * \brief Factory method for the convective fluxes of the two-temperature (NEMO) solver.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] nSpecies - Number of species of the mixture.
+   * \param[in] fluidModel - Mixture properties.
+   * \return nullptr if the scheme or the number of species is not supported.
+   */
+  static CNumericsSIMD* CreateNEMONumerics(const CConfig& config, int nDim, int nSpecies, CNEMOGas& fluidModel);
+
+  /*!
+   * \brief Factory method for the diffusion of the heat equation in solids.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   */
+  static CNumericsSIMD* CreateHeatNumerics(const CConfig& config, int nDim);
+
+};
+
+/*!
+ * \class CBoundaryNumericsSIMD
+ * \ingroup ConvDiscr
+ * \brief Interface of the vectorized boundary conditions, which compute the (weak) boundary fluxes of a pack of
+ *        vertices of a marker, see CVertexGeometryCache.
+ */
+class CBoundaryNumericsSIMD {
+public:
+  /*!
+   * \brief Interface for boundary flux computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] solution - Solution variables.
+   * \param[in] vertexCache - Vertices of the marker.
+   * \param[in] iPack - Index of the pack of vertices in vertexCache.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in] refState - Reference primitive variables of the boundary (e.g. free-stream), temperature,
+   *                       velocity (nDim), pressure, and density.
+   * \param[out] bcState - Primitive variables of the boundary state of each vertex of the marker.
+   * \param[in,out] vector - Target for the fluxes.
+   * \param[in,out] matrix - Target for the flux Jacobians.
+   */
+  virtual void ComputeFlux(const CConfig& config,
+                           const CVariable& solution,
+                           const CVertexGeometryCache& vertexCache,
+                           unsigned long iPack,
+                           Double updateMask,
+                           const su2double* refState,
+                           su2activematrix& bcState,
+                           CSysVector<su2double>& vector,
+                           SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CBoundaryNumericsSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the far-field boundary condition of compressible flow.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \return nullptr if the scheme used by the boundary conditions is not supported.
+   */
+  static CBoundaryNumericsSIMD* CreateFarfieldNumerics(const CConfig& config, int nDim);
+
 };
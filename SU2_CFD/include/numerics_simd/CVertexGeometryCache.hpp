@@ -0,0 +1,113 @@
+/*!
+ * \file CVertexGeometryCache.hpp
+ * \brief Geometric properties of the vertices of a marker stored in packs of SIMD length.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "CNumericsSIMD.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CVertexGeometryCache
+ * \brief Point and vertex indices, normal, and area of the domain vertices of one marker, grouped in packs of SIMD
+ *        length (structure of arrays). The boundary flux kernels then load each property of a pack with one
+ *        contiguous read, instead of gathering it from the vertex objects.
+ * \note The padding lanes of the last pack repeat the first vertex of the pack, they must be masked out with
+ *       the number of vertices. The cache is only valid for static grids.
+ */
+class CVertexGeometryCache {
+ private:
+  enum : size_t { SIMDLEN = Double::Size };
+
+  unsigned long nDim = 0;           /*!< \brief Number of dimensions. */
+  unsigned long nVertex = 0;        /*!< \brief Number of (domain) vertices. */
+  unsigned long nPack = 0;          /*!< \brief Number of packs of vertices. */
+  su2vector<unsigned long> nodes;   /*!< \brief Rows [point, vertex] of each pack. */
+  su2activevector geometry;         /*!< \brief Rows [normal (nDim), area] of each pack. */
+
+  unsigned long RowsPerPack() const { return nDim + 1; }
+
+ public:
+  /*!
+   * \brief Store the vertices of a marker that belong to the domain, i.e. not halo points (not thread-safe).
+   * \param[in] geo - Geometrical definition of the problem.
+   * \param[in] iMarker - Index of the marker.
+   */
+  void Set(const CGeometry& geo, unsigned short iMarker) {
+    nDim = geo.GetnDim();
+
+    vector<unsigned long> vertices;
+    for (auto iVertex = 0ul; iVertex < geo.nVertex[iMarker]; ++iVertex) {
+      if (geo.nodes->GetDomain(geo.vertex[iMarker][iVertex]->GetNode())) vertices.push_back(iVertex);
+    }
+    nVertex = vertices.size();
+    nPack = (nVertex + SIMDLEN - 1) / SIMDLEN;
+    nodes.resize(2 * nPack * SIMDLEN);
+    geometry.resize(RowsPerPack() * nPack * SIMDLEN);
+
+    for (auto iPack = 0ul; iPack < nPack; ++iPack) {
+      auto* packNodes = &nodes(2 * iPack * SIMDLEN);
+      auto* packGeo = &geometry(RowsPerPack() * iPack * SIMDLEN);
+
+      const auto k = iPack * SIMDLEN;
+      for (auto j = 0ul; j < SIMDLEN; ++j) {
+        const bool in = (k + j < nVertex);
+        const auto iVertex = vertices[k + j * in];
+        const auto* vertex = geo.vertex[iMarker][iVertex];
+        packNodes[j] = vertex->GetNode();
+        packNodes[SIMDLEN + j] = iVertex;
+
+        su2double area = 0.0;
+        for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+          packGeo[iDim * SIMDLEN + j] = vertex->GetNormal(iDim);
+          area += pow(vertex->GetNormal(iDim), 2);
+        }
+        packGeo[nDim * SIMDLEN + j] = sqrt(area);
+      }
+    }
+  }
+
+  /*!
+   * \brief Number of (domain) vertices.
+   */
+  unsigned long GetNumVertex() const { return nVertex; }
+
+  /*!
+   * \brief Number of packs of vertices.
+   */
+  unsigned long GetNumPack() const { return nPack; }
+
+  /*!
+   * \brief Point and vertex indices of a pack, SIMD-length rows.
+   */
+  const unsigned long* GetNodes(unsigned long iPack) const { return &nodes(2 * iPack * SIMDLEN); }
+
+  /*!
+   * \brief Geometry of a pack, SIMD-length rows of normal (nDim, as stored by the vertices) and area.
+   */
+  const su2double* GetGeometry(unsigned long iPack) const { return &geometry(RowsPerPack() * iPack * SIMDLEN); }
+};
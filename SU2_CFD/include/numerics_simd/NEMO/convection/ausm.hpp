@@ -0,0 +1,333 @@
+﻿/*!
+ * \file hllc.hpp
+ * \brief AUSM convective scheme for the two-temperature (NEMO) solver.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "../../../fluid/CNEMOGas.hpp"
+#include "../../../variables/CNEMOEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMNEMOScheme
+ * \ingroup ConvDiscr
+ * \brief Vectorized version of CUpwAUSM_NEMO (first order, flux and analytic Jacobians).
+ * The number of species is a template parameter to keep all the edge arrays on the stack.
+ * \note As in the scalar implementation, the grid velocity is not considered.
+ * The MUSCL reconstruction is not supported since the secondary variables of the reconstructed
+ * states must be computed by the fluid model, the solver uses the scalar numerics in that case.
+ */
+template<size_t nDim_, size_t nSpecies>
+class CAUSMNEMOScheme : public CNumericsSIMD {
+private:
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nSpecies+nDim+2;
+  static constexpr size_t iEnergy = nSpecies+nDim;
+  static constexpr size_t iEnergyVe = nSpecies+nDim+1;
+  using PrimVarType = CNEMOPrimitives<nDim,nSpecies>;
+
+  /*--- Mixture properties needed by the derivatives of the speed of sound. ---*/
+  su2double molarMass[nSpecies];
+  su2double cvTraRot[nSpecies];
+  const size_t nEl;
+
+  /*!
+   * \brief Convective flux vector (without the mass flux factor).
+   */
+  FORCEINLINE static VectorDbl<nVar> convectiveVector(const PrimVarType& V, const VectorDbl<nSpecies>& eve) {
+    VectorDbl<nVar> Fc;
+    Double rhoEve = 0.0;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      Fc(iSpecies) = V.rhos(iSpecies);
+      rhoEve += V.rhos(iSpecies) * eve(iSpecies);
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      Fc(nSpecies+iDim) = V.density() * V.velocity(iDim);
+    }
+    Fc(iEnergy) = V.density() * V.enthalpy();
+    Fc(iEnergyVe) = rhoEve;
+    return Fc;
+  }
+
+  /*!
+   * \brief Derivatives of the speed of sound w.r.t. the conservative variables.
+   */
+  FORCEINLINE VectorDbl<nVar> soundSpeedDerivatives(const PrimVarType& V, const VectorDbl<nVar>& dPdU) const {
+    const su2double Ru = 1000.0 * UNIVERSAL_GAS_CONSTANT;
+    const Double& rho = V.density();
+    const Double& a = V.speedSound();
+    const Double pOnRho = V.pressure() / rho;
+    const Double onePlusdPdE = 1.0 + dPdU(iEnergy);
+    const Double factor = 1 / (2 * rho * a);
+
+    VectorDbl<nVar> da;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      da(iSpecies) = factor * onePlusdPdE * (dPdU(iSpecies) - pOnRho);
+      if (iSpecies >= nEl) {
+        da(iSpecies) += (Ru / molarMass[iSpecies] - cvTraRot[iSpecies] * dPdU(iEnergy)) * pOnRho / (2 * a * V.rhoCvtr());
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      da(nSpecies+iDim) = -factor * onePlusdPdE * dPdU(iEnergy) * V.velocity(iDim);
+    }
+    da(iEnergy) = factor * onePlusdPdE * dPdU(iEnergy);
+    da(iEnergyVe) = factor * onePlusdPdE * dPdU(iEnergyVe);
+    return da;
+  }
+
+  /*!
+   * \brief Contribution of the upwind convective vector to the Jacobian, "coeff" is the interface
+   * Mach number if this side is upwind and 0 otherwise.
+   */
+  FORCEINLINE static void convectiveJacobian(Double coeff, const PrimVarType& V, const VectorDbl<nVar>& dPdU,
+                                             const VectorDbl<nVar>& Fc, const VectorDbl<nVar>& da,
+                                             MatrixDbl<nVar>& jac) {
+    const Double& a = V.speedSound();
+    const Double rhoH = V.density() * V.enthalpy();
+
+    for (size_t iVar = 0; iVar < nSpecies+nDim; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac(iVar,jVar) += coeff * Fc(iVar) * da(jVar);
+      }
+      jac(iVar,iVar) += coeff * a;
+    }
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      jac(iEnergy,iSpecies) += coeff * (dPdU(iSpecies) * a + rhoH * da(iSpecies));
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(iEnergy,nSpecies+iDim) += coeff * (-dPdU(iEnergy) * V.velocity(iDim) * a + rhoH * da(nSpecies+iDim));
+    }
+    jac(iEnergy,iEnergy) += coeff * ((1.0 + dPdU(iEnergy)) * a + rhoH * da(iEnergy));
+    jac(iEnergy,iEnergyVe) += coeff * (dPdU(iEnergyVe) * a + rhoH * da(iEnergyVe));
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      jac(iEnergyVe,jVar) += coeff * Fc(iEnergyVe) * da(jVar);
+    }
+    jac(iEnergyVe,iEnergyVe) += coeff * a;
+  }
+
+  /*!
+   * \brief Contribution of the split Mach number and pressure to the Jacobian, "sign" is 1 for
+   * the left (plus) state and -1 for the right (minus) state, "coeff" is 0 or 1 depending on
+   * the interface Mach number.
+   */
+  FORCEINLINE static void splitJacobian(su2double sign, Double coeff, const PrimVarType& V, Double mach,
+                                        Double projVel, const VectorDbl<nDim>& unitNormal,
+                                        const VectorDbl<nVar>& dPdU, const VectorDbl<nVar>& da,
+                                        const VectorDbl<nVar>& FcUpw, Double aUpw, MatrixDbl<nVar>& jac) {
+    const Double& rho = V.density();
+    const Double& a = V.speedSound();
+    const Double qOnA2 = projVel / (a * a);
+    const Double sub = abs(mach) <= 1.0;
+
+    /*--- Derivatives of the Mach number (dM) and of the pressure (dp). ---*/
+    VectorDbl<nVar> dM, dp;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      dM(iSpecies) = -projVel / (rho * a) - qOnA2 * da(iSpecies);
+      dp(iSpecies) = dPdU(iSpecies);
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dM(nSpecies+iDim) = -qOnA2 * da(nSpecies+iDim) + unitNormal(iDim) / (rho * a);
+      dp(nSpecies+iDim) = -V.velocity(iDim) * dPdU(iEnergy);
+    }
+    for (size_t iVar = iEnergy; iVar < nVar; ++iVar) {
+      dM(iVar) = -qOnA2 * da(iVar);
+      dp(iVar) = dPdU(iVar);
+    }
+
+    /*--- Subsonic polynomials, the supersonic derivatives are dM and dp. ---*/
+    const Double mPlusS = mach + sign;
+    const Double fM = sub * 0.5 * sign * mPlusS + (1 - sub);
+    const Double fP1 = sub * 0.25 * mPlusS * mPlusS * (2 - sign * mach) + (1 - sub);
+    const Double fP2 = sub * 0.75 * mPlusS * (1 - sign * mach) * V.pressure();
+
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      const Double dMj = coeff * fM * dM(jVar);
+      const Double dPj = coeff * (fP1 * dp(jVar) + fP2 * dM(jVar));
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac(iVar,jVar) += dMj * FcUpw(iVar) * aUpw;
+      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(nSpecies+iDim,jVar) += dPj * unitNormal(iDim);
+      }
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store the mixture properties.
+   */
+  CAUSMNEMOScheme(const CConfig& config, CNEMOGas& fluidModel) :
+    nEl(config.GetIonization() ? 1 : 0) {
+    const auto& Ms = fluidModel.GetSpeciesMolarMass();
+    const auto& Cvtr = fluidModel.GetSpeciesCvTraRot();
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      molarMass[iSpecies] = Ms[iSpecies];
+      cvTraRot[iSpecies] = Cvtr[iSpecies];
+    }
+  }
+
+  /*!
+   * \brief Implementation of the base class method.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CNEMOEulerVariable&>(solution_);
+
+    /*--- Geometric properties. ---*/
+
+    const auto edge = edgeGeometry<nDim,false>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& area = edge.area;
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = edge.normal(iDim) / area;
+    }
+
+    /*--- Primitive and secondary variables. ---*/
+
+    CPair<PrimVarType> V;
+    V.i.all = gatherVariables<PrimVarType::nVar>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<PrimVarType::nVar>(jPoint, solution.GetPrimitive());
+
+    CPair<VectorDbl<nVar> > dPdU;
+    dPdU.i = gatherVariables<nVar>(iPoint, solution.GetdPdU());
+    dPdU.j = gatherVariables<nVar>(jPoint, solution.GetdPdU());
+
+    const auto Fc_i = convectiveVector(V.i, gatherVariables<nSpecies>(iPoint, solution.GetEve()));
+    const auto Fc_j = convectiveVector(V.j, gatherVariables<nSpecies>(jPoint, solution.GetEve()));
+
+    /*--- Split Mach numbers and pressures. ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double mL = projVel_i / V.i.speedSound();
+    const Double mR = projVel_j / V.j.speedSound();
+
+    const Double subL = abs(mL) <= 1.0;
+    const Double subR = abs(mR) <= 1.0;
+    const Double mLP = subL*0.25*(mL+1)*(mL+1) + (1-subL)*0.5*(mL + abs(mL));
+    const Double mRM = -subR*0.25*(mR-1)*(mR-1) + (1-subR)*0.5*(mR - abs(mR));
+    /*--- In the supersonic branches p*(M +/- |M|)/(2M) is written without the division. ---*/
+    const Double pLP = V.i.pressure() * (subL*0.25*(mL+1)*(mL+1)*(2-mL) + (1-subL)*(mL > 0.0));
+    const Double pRM = V.j.pressure() * (subR*0.25*(mR-1)*(mR-1)*(2+mR) + (1-subR)*(mR < 0.0));
+
+    const Double mF = mLP + mRM;
+    const Double pF = pLP + pRM;
+
+    /*--- Flux. ---*/
+
+    const Double mdot_i = mF * V.i.speedSound();
+    const Double mdot_j = mF * V.j.speedSound();
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * area * ((mdot_i + abs(mdot_i)) * Fc_i(iVar) + (mdot_j - abs(mdot_j)) * Fc_j(iVar));
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(nSpecies+iDim) += area * pF * unitNormal(iDim);
+    }
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) = 0.0;
+          jac_j(iVar,jVar) = 0.0;
+        }
+      }
+      const Double upwL = mF >= 0.0;
+      const Double upwR = 1 - upwL;
+      const Double subF = abs(mF) <= 1.0;
+
+      const auto da_i = soundSpeedDerivatives(V.i, dPdU.i);
+      const auto da_j = soundSpeedDerivatives(V.j, dPdU.j);
+
+      convectiveJacobian(upwL * mF, V.i, dPdU.i, Fc_i, da_i, jac_i);
+      convectiveJacobian(upwR * mF, V.j, dPdU.j, Fc_j, da_j, jac_j);
+
+      VectorDbl<nVar> Fc_upw;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        Fc_upw(iVar) = upwL * Fc_i(iVar) + upwR * Fc_j(iVar);
+      }
+      const Double a_upw = upwL * V.i.speedSound() + upwR * V.j.speedSound();
+
+      splitJacobian(1, upwL + upwR*subF, V.i, mL, projVel_i, unitNormal, dPdU.i, da_i, Fc_upw, a_upw, jac_i);
+      splitJacobian(-1, upwR + upwL*subF, V.j, mR, projVel_j, unitNormal, dPdU.j, da_j, Fc_upw, a_upw, jac_j);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) *= area;
+          jac_j(iVar,jVar) *= area;
+        }
+      }
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Edges with NaN fluxes are not applied (see CNumerics::CheckResidualNaNs). ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      bool err = false;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        err |= std::isnan(SU2_TYPE::GetValue(flux(iVar)[k]));
+        if (implicit) {
+          for (size_t jVar = 0; jVar < nVar; ++jVar) {
+            err |= std::isnan(SU2_TYPE::GetValue(jac_i(iVar,jVar)[k]));
+            err |= std::isnan(SU2_TYPE::GetValue(jac_j(iVar,jVar)[k]));
+          }
+        }
+      }
+      if (err) updateMask[k] = 0.0;
+    }
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,64 @@
+﻿/*!
+ * \file variables.hpp
+ * \brief Type to access the two-temperature (NEMO) primitive variables by name.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+
+/*!
+ * \brief Type to store the NEMO primitive variables and access them by name, the layout is
+ * [rho_1,...,rho_nSpecies, T, Tve, u, v, w, P, rho, h, a, rhoCvtr, rhoCvve] (see CNEMOEulerVariable).
+ */
+template<size_t nDim_, size_t nSpecies_>
+struct CNEMOPrimitives {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nSpecies = nSpecies_;
+  static constexpr size_t nVar = nSpecies+nDim+8;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& rhos(size_t iSpecies) { return all(iSpecies); }
+  FORCEINLINE Double& temperature() { return all(nSpecies); }
+  FORCEINLINE Double& temperatureVe() { return all(nSpecies+1); }
+  FORCEINLINE Double& velocity(size_t iDim) { return all(nSpecies+2+iDim); }
+  FORCEINLINE Double& pressure() { return all(nSpecies+nDim+2); }
+  FORCEINLINE Double& density() { return all(nSpecies+nDim+3); }
+  FORCEINLINE Double& enthalpy() { return all(nSpecies+nDim+4); }
+  FORCEINLINE Double& speedSound() { return all(nSpecies+nDim+5); }
+  FORCEINLINE Double& rhoCvtr() { return all(nSpecies+nDim+6); }
+  FORCEINLINE Double& rhoCvve() { return all(nSpecies+nDim+7); }
+  FORCEINLINE const Double& rhos(size_t iSpecies) const { return all(iSpecies); }
+  FORCEINLINE const Double& temperature() const { return all(nSpecies); }
+  FORCEINLINE const Double& temperatureVe() const { return all(nSpecies+1); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(nSpecies+2+iDim); }
+  FORCEINLINE const Double* velocity() const { return &velocity(0); }
+  FORCEINLINE const Double& pressure() const { return all(nSpecies+nDim+2); }
+  FORCEINLINE const Double& density() const { return all(nSpecies+nDim+3); }
+  FORCEINLINE const Double& enthalpy() const { return all(nSpecies+nDim+4); }
+  FORCEINLINE const Double& speedSound() const { return all(nSpecies+nDim+5); }
+  FORCEINLINE const Double& rhoCvtr() const { return all(nSpecies+nDim+6); }
+  FORCEINLINE const Double& rhoCvve() const { return all(nSpecies+nDim+7); }
+};
@@ -0,0 +1,233 @@
+/*!
+ * \file farfield.hpp
+ * \brief Vectorized far-field boundary condition.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../CVertexGeometryCache.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "../convection/common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+
+/*!
+ * \class CFarfieldRoeScheme
+ * \ingroup ConvDiscr
+ * \brief Far-field boundary condition of compressible flow (ideal gas), the boundary state is constructed from the
+ * Riemann invariants of the interior and free-stream states, and the flux between the boundary points and that
+ * state is computed with the Roe scheme (no MUSCL, no low dissipation), as in CEulerSolver::BC_Far_Field.
+ */
+template<size_t nDim>
+class CFarfieldRoeScheme final : public CBoundaryNumericsSIMD {
+private:
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVar = nDim+4;
+  using PrimVarType = CCompressiblePrimitives<nDim,nPrimVar>;
+
+  const su2double kappa;
+  const su2double gamma;
+  const su2double gasConstant;
+  const su2double entropyFix;
+  const su2double tkeInf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants.
+   */
+  CFarfieldRoeScheme(const CConfig& config) :
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    gasConstant(config.GetGas_ConstantND()),
+    entropyFix(config.GetEntropyFix_Coeff()),
+    tkeInf(config.GetKind_Turb_Model() == TURB_MODEL::SST ? config.GetTke_FreeStreamND() : 0.0) {
+  }
+
+  /*!
+   * \brief Implementation of the far-field flux.
+   */
+  void ComputeFlux(const CConfig& config,
+                   const CVariable& solution_,
+                   const CVertexGeometryCache& vertexCache,
+                   unsigned long iPack,
+                   Double updateMask,
+                   const su2double* refState,
+                   su2activematrix& bcState,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const override {
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+    const su2double gamma_m_1 = gamma - 1;
+
+    /*--- Geometric properties, the normal is negated for the outward convention. ---*/
+
+    const auto* nodes = vertexCache.GetNodes(iPack);
+    const auto* geo = vertexCache.GetGeometry(iPack);
+    const Int iPoint(nodes);
+    const Int iVertex(nodes + Double::Size);
+    const Double area(geo + nDim * Double::Size);
+    VectorDbl<nDim> normal, unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      normal(iDim) = -Double(geo + iDim * Double::Size);
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Interior state (i) and free-stream quantities. ---*/
+
+    CPair<PrimVarType> V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+
+    const Double vnBound = dot(V.i.velocity(), unitNormal);
+    const Double soundBound = sqrt(gamma * V.i.pressure() / V.i.density());
+    const Double entropyBound = pow(V.i.density(), gamma) / V.i.pressure();
+
+    const su2double densityInf = refState[nDim+2];
+    const su2double pressureInf = refState[nDim+1];
+    const su2double soundInf = sqrt(gamma * pressureInf / densityInf);
+    const su2double entropyInf = pow(densityInf, gamma) / pressureInf;
+    const Double vnInf = dot<nDim>(unitNormal.data(), refState + 1);
+
+    /*--- Acoustic Riemann invariants, each is taken from the free-stream if its characteristic is incoming,
+     * and from the interior otherwise. The tangential velocity and the entropy are taken from the free-stream
+     * at inflows, and from the interior at outflows. ---*/
+
+    const Double plusFromBound = vnInf > -soundInf;
+    const Double minusFromBound = vnInf > soundInf;
+    const Double outflow = vnInf > 0.0;
+
+    const Double riemannPlus = plusFromBound * (vnBound + 2 * soundBound / gamma_m_1) +
+                               (1 - plusFromBound) * (vnInf + 2 * soundInf / gamma_m_1);
+    const Double riemannMinus = minusFromBound * (vnBound - 2 * soundBound / gamma_m_1) +
+                                (1 - minusFromBound) * (vnInf - 2 * soundInf / gamma_m_1);
+
+    const Double vn = 0.5 * (riemannPlus + riemannMinus);
+    const Double soundSpeed = 0.25 * (riemannPlus - riemannMinus) * gamma_m_1;
+
+    /*--- Boundary state (j). ---*/
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      V.j.velocity(iDim) = outflow * (V.i.velocity(iDim) + (vn - vnBound) * unitNormal(iDim)) +
+                           (1 - outflow) * (refState[iDim+1] + (vn - vnInf) * unitNormal(iDim));
+    }
+    const Double entropy = outflow * entropyBound + (1 - outflow) * entropyInf;
+    const Double soundSpeed2OnGamma = soundSpeed * soundSpeed / gamma;
+
+    V.j.density() = pow(entropy * soundSpeed2OnGamma, 1 / gamma_m_1);
+    V.j.pressure() = V.j.density() * soundSpeed2OnGamma;
+    V.j.temperature() = V.j.pressure() / (gasConstant * V.j.density());
+    V.j.enthalpy() = gamma / gamma_m_1 * V.j.pressure() / V.j.density() +
+                     0.5 * squaredNorm<nDim>(V.j.velocity()) + tkeInf;
+
+    /*--- Store the boundary state, it is used by the viscous terms and by other solvers. ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (updateMask[k] == 0) continue;
+      for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+        bcState(iVertex[k], iVar) = V.j.all(iVar)[k];
+      }
+    }
+
+    /*--- Roe flux, compute conservative and Roe-averaged variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    /*--- Non-physical Roe-averaged state (negative speed of sound squared), there is no flux
+     * for that vertex, as in the scalar scheme. ---*/
+
+    Double mask = updateMask;
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (roeAvg.speedSound[k] > 0.0) continue;
+      mask[k] = 0.0;
+      roeAvg.speedSound[k] = 1.0;
+    }
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity, roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity, roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = roeAvg.projVel;
+    }
+    lambda(nDim) = roeAvg.projVel + roeAvg.speedSound;
+    lambda(nDim+1) = roeAvg.projVel - roeAvg.speedSound;
+
+    const Double maxLambda = abs(roeAvg.projVel) + roeAvg.speedSound;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambda(iVar) = fmax(abs(lambda(iVar)), entropyFix*maxLambda);
+    }
+
+    /*--- Inviscid fluxes and Jacobian of the interior state. ---*/
+
+    auto flux_i = inviscidProjFlux(V.i, U.i, normal);
+    auto flux_j = inviscidProjFlux(V.j, U.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i;
+    if (implicit) {
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    }
+
+    /*--- Roe dissipation. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        /*--- Compute |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+
+        const Double dDdU = projModJacTensor * (1-kappa) * area;
+
+        flux(iVar) -= dDdU * (U.j.all(jVar) - U.i.all(jVar));
+
+        if (implicit) jac_i(iVar,jVar) += dDdU;
+      }
+    }
+
+    /*--- Update the vector and the diagonal of the system matrix. ---*/
+
+    vector.AddBlock(iPoint, flux, mask);
+    if (implicit) {
+      auto wasActive = AD::BeginPassive();
+      matrix.AddBlock2Diag(iPoint, jac_i, mask);
+      AD::EndPassive(wasActive);
+    }
+  }
+};
@@ -0,0 +1,501 @@
+﻿/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM and SLAU families of convective schemes.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMSLAUBase
+ * \ingroup ConvDiscr
+ * \brief Base class for the AUSM and SLAU families, these have the form
+ * F = ||A|| (0.5*mdot*(psi_i+psi_j) + 0.5*|mdot|*(psi_i-psi_j) + n*p), with psi = (1, u, H)^T.
+ * Derived classes implement the interface mass flux (mdot) and pressure (p) in a const
+ * "massAndPressureFluxes" method, they may also define a "dissipationCoefficient" method.
+ * A base class implementing "viscousTerms" is accepted as template parameter (see CRoeBase).
+ * \note As in the scalar implementation, the grid velocity is not considered.
+ */
+template<class Derived, class Base>
+class CAUSMSLAUBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+  /*! \brief Velocity, pressure, density, and enthalpy, the variables mdot and p depend on. */
+  static constexpr size_t nPrimVarFlux = nDim+3;
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+  const bool accurateJacobian;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMSLAUBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    accurateJacobian(config.GetUse_Accurate_Jacobians()) {
+  }
+
+  /*!
+   * \brief Default coefficient of the pressure dissipation term (no low dissipation).
+   */
+  FORCEINLINE Double dissipationCoefficient(Int, Int, const CEulerVariable&) const { return 1.0; }
+
+  /*!
+   * \brief Approximate Jacobians, central part plus Roe dissipation (no entropy fix).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void approximateJacobians(const CPair<PrimVarType>& V,
+                                        const VectorDbl<nDim>& normal,
+                                        const VectorDbl<nDim>& unitNormal,
+                                        Double area,
+                                        MatrixDbl<nVar>& jac_i,
+                                        MatrixDbl<nVar>& jac_j) const {
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+        jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+      }
+    }
+  }
+
+  /*!
+   * \brief Chain rule, derivatives w.r.t. the conservative variables given the derivatives w.r.t.
+   * velocity, pressure, density, and enthalpy.
+   */
+  template<class PrimVarType>
+  FORCEINLINE VectorDbl<nVar> derivativesWrtConservatives(const PrimVarType& V,
+                                                          const VectorDbl<nPrimVarFlux>& dF_dV) const {
+    const Double gm1 = gamma - 1;
+    const Double oneOnRho = 1 / V.density();
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+    const Double dH_drho = 0.5*(gamma-2)*sqVel - gamma*V.pressure()/(gm1*V.density());
+
+    VectorDbl<nVar> dF_dU;
+    dF_dU(0) = 0.5*gm1*sqVel*dF_dV(nDim) + dF_dV(nDim+1) + dH_drho*oneOnRho*dF_dV(nDim+2);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dF_dU(0) -= V.velocity(iDim)*oneOnRho*dF_dV(iDim);
+      dF_dU(iDim+1) = oneOnRho*dF_dV(iDim) - gm1*V.velocity(iDim)*(dF_dV(nDim) + oneOnRho*dF_dV(nDim+2));
+    }
+    dF_dU(nDim+1) = gm1*dF_dV(nDim) + gamma*oneOnRho*dF_dV(nDim+2);
+    return dF_dU;
+  }
+
+  /*!
+   * \brief Contribution of the upwind state (psi) to the Jacobian, mdotHat is area*mdot/rho.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void psiJacobian(const PrimVarType& V, Double mdotHat, MatrixDbl<nVar>& jac) const {
+    const Double gm1 = gamma - 1;
+    const Double sqVel = squaredNorm<nDim>(V.velocity());
+    const Double dH_drho = 0.5*(gamma-2)*sqVel - gamma*V.pressure()/(gm1*V.density());
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(iDim+1,0) -= mdotHat*V.velocity(iDim);
+      jac(iDim+1,iDim+1) += mdotHat;
+      jac(nVar-1,iDim+1) -= mdotHat*gm1*V.velocity(iDim);
+    }
+    jac(nVar-1,0) += mdotHat*dH_drho;
+    jac(nVar-1,nVar-1) += mdotHat*gamma;
+  }
+
+  /*!
+   * \brief "Accurate" Jacobians, the derivatives of mdot and p are computed by finite differences
+   * of the primitive variables, as in the scalar implementation of the SLAU schemes.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobians(const CPair<PrimVarType>& V,
+                                     const VectorDbl<nDim>& normal,
+                                     const VectorDbl<nDim>& unitNormal,
+                                     Double area,
+                                     Double dissipation,
+                                     Double mdot,
+                                     Double pressure,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+
+    VectorDbl<nPrimVarFlux> dmdot_dVi, dmdot_dVj, dp_dVi, dp_dVj;
+    auto Vp = V;
+
+    for (size_t iVar = 0; iVar < nPrimVarFlux; ++iVar) {
+      Double mdotPert, pressurePert;
+
+      Double& var_i = Vp.i.all(iVar+1);
+      Double eps = 1e-4 * fmax(1.0, abs(var_i));
+      var_i += eps;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdotPert, pressurePert);
+      dmdot_dVi(iVar) = (mdotPert - mdot) / eps;
+      dp_dVi(iVar) = (pressurePert - pressure) / eps;
+      var_i = V.i.all(iVar+1);
+
+      Double& var_j = Vp.j.all(iVar+1);
+      eps = 1e-4 * fmax(1.0, abs(var_j));
+      var_j += eps;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdotPert, pressurePert);
+      dmdot_dVj(iVar) = (mdotPert - mdot) / eps;
+      dp_dVj(iVar) = (pressurePert - pressure) / eps;
+      var_j = V.j.all(iVar+1);
+    }
+
+    const auto dmdot_dUi = derivativesWrtConservatives(V.i, dmdot_dVi);
+    const auto dmdot_dUj = derivativesWrtConservatives(V.j, dmdot_dVj);
+    const auto dp_dUi = derivativesWrtConservatives(V.i, dp_dVi);
+    const auto dp_dUj = derivativesWrtConservatives(V.j, dp_dVj);
+
+    /*--- Upwind state, mdot * psi_upwind. ---*/
+
+    const Double upwind = mdot > 0.0;
+    VectorDbl<nVar> psiHat;
+    psiHat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psiHat(iDim+1) = area * (upwind*V.i.velocity(iDim) + (1-upwind)*V.j.velocity(iDim));
+    }
+    psiHat(nVar-1) = area * (upwind*V.i.enthalpy() + (1-upwind)*V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psiHat(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psiHat(iVar) * dmdot_dUj(jVar);
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dp_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dp_dUj(jVar);
+      }
+    }
+
+    psiJacobian(V.i, upwind * area * mdot / V.i.density(), jac_i);
+    psiJacobian(V.j, (1-upwind) * area * mdot / V.j.density(), jac_j);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base AUSM/SLAU flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT) && !config.GetLagged_Jacobian_Iter();
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    /*--- Geometric properties. ---*/
+
+    const auto edge = edgeGeometry<nDim>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& vector_ij = edge.vector_ij;
+    const auto& normal = edge.normal;
+    const auto& area = edge.area;
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Interface mass flux and pressure. ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+    const Double dissipation = derived->dissipationCoefficient(iPoint, jPoint, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    /*--- Flux. ---*/
+
+    const Double absMdot = abs(mdot);
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim)+V.j.velocity(iDim)) +
+                             0.5*absMdot*(V.i.velocity(iDim)-V.j.velocity(iDim)) + unitNormal(iDim)*pressure);
+    }
+    flux(nVar-1) = area * (0.5*mdot*(V.i.enthalpy()+V.j.enthalpy()) +
+                           0.5*absMdot*(V.i.enthalpy()-V.j.enthalpy()));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (accurateJacobian) {
+        accurateJacobians(V, normal, unitNormal, area, dissipation, mdot, pressure, jac_i, jac_j);
+      } else {
+        approximateJacobians(V, normal, unitNormal, area, jac_i, jac_j);
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up and AUSM+up2 schemes, Liou (2006) and Kitamura & Shima (2013).
+ * \note The branches of the scalar implementation are replaced by masks.
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const bool up2;
+  const su2double Minf;
+  static constexpr passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    up2(config.GetKind_Upwind_Flow() == UPWIND::AUSMPLUSUP2),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Interface mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound. ---*/
+
+    const Double aStar_i = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double aStar_j = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+    const Double aHat_i = pow(aStar_i,2) / fmax(aStar_i, projVel_i);
+    const Double aHat_j = pow(aStar_j,2) / fmax(aStar_j, -projVel_j);
+    const Double aF = fmin(aHat_i, aHat_j);
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double mF2 = 0.5*(mL*mL + mR*mR);
+    const Double mRef2 = fmin(1.0, fmax(mF2, Minf*Minf));
+    const Double fa = 2*sqrt(mRef2) - mRef2;
+    const Double alpha = 3.0/16.0 * (-4 + 5*fa*fa);
+    const passivedouble beta = 1.0/8.0;
+
+    /*--- Split Mach numbers and pressure functions. ---*/
+
+    const Double subL = abs(mL) <= 1.0;
+    const Double p1L = 0.25*pow(mL+1,2);
+    const Double p2L = pow(mL*mL-1,2);
+    const Double mLP = subL*(p1L + beta*p2L) + (1-subL)*0.5*(mL + abs(mL));
+    const Double betaLP = subL*(p1L*(2-mL) + alpha*mL*p2L) + (1-subL)*(mL > 0.0);
+
+    const Double subR = abs(mR) <= 1.0;
+    const Double p1R = 0.25*pow(mR-1,2);
+    const Double p2R = pow(mR*mR-1,2);
+    const Double mRM = subR*(-p1R - beta*p2R) + (1-subR)*0.5*(mR - abs(mR));
+    const Double betaRM = subR*(p1R*(2+mR) - alpha*mR*p2R) + (1-subR)*(mR < 0.0);
+
+    /*--- Pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double mP = -(Kp/fa) * fmax(1-sigma*mF2, 0.0) * (V.j.pressure()-V.i.pressure()) / (rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + mP;
+    mdot = aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+
+    if (!up2) {
+      /*--- Velocity diffusion term. ---*/
+      const Double pU = -Ku*fa*betaLP*betaRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = betaLP*V.i.pressure() + betaRM*V.j.pressure() + pU;
+    } else {
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaLP-betaRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(betaLP+betaRM-1)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU and SLAU2 schemes, Shima & Kitamura (2011) and Kitamura & Shima (2013),
+ * with the optional low dissipation of the Roe schemes.
+ * \note The branches of the scalar implementation are replaced by masks.
+ */
+template<class Decorator>
+class CSLAUScheme : public CAUSMSLAUBase<CSLAUScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CSLAUScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const bool slau2;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    slau2(config.GetKind_Upwind_Flow() == UPWIND::SLAU2),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Coefficient of the pressure dissipation term.
+   */
+  FORCEINLINE Double dissipationCoefficient(Int iPoint, Int jPoint, const CEulerVariable& solution) const {
+    return roeDissipation(iPoint, jPoint, typeDissip, solution);
+  }
+
+  /*!
+   * \brief Interface mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    /*--- Speed of sound from the internal energy. ---*/
+
+    const Double a_i = sqrt(abs(gamma*(gamma-1)*(V.i.enthalpy() - V.i.pressure()/V.i.density() - 0.5*sqVel_i)));
+    const Double a_j = sqrt(abs(gamma*(gamma-1)*(V.j.enthalpy() - V.j.pressure()/V.j.density() - 0.5*sqVel_j)));
+    const Double aF = 0.5*(a_i + a_j);
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double betaL = subL*0.25*(2-mL)*pow(mL+1,2) + (1-subL)*(mL >= 0.0);
+    const Double subR = abs(mR) < 1.0;
+    const Double betaR = subR*0.25*(2+mR)*pow(mR-1,2) + (1-subR)*(mR < 0.0);
+
+    const Double sqVel = 0.5*(sqVel_i + sqVel_j);
+    const Double machTilde = fmin(1.0, sqrt(sqVel)/aF);
+    const Double chi = pow(1-machTilde, 2);
+
+    const Double pMean = 0.5*(V.i.pressure() + V.j.pressure());
+    pressure = pMean + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+    if (!slau2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*pMean;
+    } else {
+      pressure += dissipation*sqrt(sqVel)*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    }
+
+    /*--- Mass flux. ---*/
+
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+    const Double vnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double vnMagL = (1-fRho)*vnMag + fRho*abs(projVel_i);
+    const Double vnMagR = (1-fRho)*vnMag + fRho*abs(projVel_j);
+
+    mdot = 0.5*(V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                (chi/aF)*(V.j.pressure()-V.i.pressure()));
+  }
+};
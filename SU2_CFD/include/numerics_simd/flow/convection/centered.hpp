@@ -87,22 +87,24 @@ public:
                    UpdateType updateType,
                    Double updateMask,
                    CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
 
     /*--- Start preaccumulation, inputs are registered
      *    automatically in "gatherVariables". ---*/
     AD::StartPreacc();
 
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT) && !config.GetLagged_Jacobian_Iter();
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
 
-    const auto iPoint = geometry.edges->GetNode(iEdge,0);
-    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+    /*--- Geometric properties, the i-j vector is only needed for the viscous terms. ---*/
 
-    /*--- Geometric properties. ---*/
-
-    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
-    const auto area = norm(normal);
+    const auto edge = edgeGeometry<nDim, false>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& normal = edge.normal;
+    const auto& area = edge.area;
     VectorDbl<nDim> unitNormal;
     for (size_t iDim = 0; iDim < nDim; ++iDim) {
       unitNormal(iDim) = normal(iDim) / area;
@@ -0,0 +1,240 @@
+/*!
+ * \file centered_adjoint.hpp
+ * \brief Hand-differentiated (reverse mode) JST flux, used as an external
+ *        function of the AD tape instead of taping the edge loop.
+ * \note The kernels are templates on the scalar type, to run with passive
+ *       SIMD types (simd::Array) in the reverse sweep.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+/*!
+ * \class CJSTAdjointKernel
+ * \ingroup ConvDiscr
+ * \brief Primal and reverse-mode derivative of the edge flux of the scalar JST scheme (CJSTScheme)
+ *        without viscous terms or grid motion.
+ * \note The inputs of an edge are the primitives (T, vel, P, rho, h, c) and the undivided Laplacian,
+ *       sensor, and spectral radius of both points, and the edge normal. The number of neighbors is passive.
+ */
+template<size_t nDim_>
+struct CJSTAdjointKernel {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVar = nDim+5;
+
+  /*!
+   * \brief Constants of the scheme.
+   */
+  struct Coefficients {
+    double kappa2, kappa4, stretchParam;
+  };
+
+  /*!
+   * \brief Inputs of an edge, or their adjoints.
+   */
+  template<class T>
+  struct Data {
+    T V[2][nPrimVar];
+    T lapl[2][nVar];
+    T sensor[2];
+    T lambda[2];
+    T normal[nDim];
+  };
+
+ private:
+  /*--- Indices of the primitives. ---*/
+  static constexpr size_t VEL = 1, PRES = nDim+1, RHO = nDim+2, ENTH = nDim+3, SOUND = nDim+4;
+
+  /*!
+   * \brief Intermediate values of the flux, shared by the primal and reverse passes.
+   */
+  template<class T>
+  struct Intermediates {
+    T avgV[nPrimVar];
+    T diffU[nVar];
+    T projVel, area, mdot, lambda0, phi[2], lambda;
+    T sc2, sc4, eps2, eps4;
+  };
+
+  template<class T>
+  static void forward(const Coefficients& coefs, const Data<T>& in, const T* nNeighbor,
+                      Intermediates<T>& w, T* flux) {
+    using std::sqrt; using std::pow; using std::abs; using std::fmax;
+
+    const auto& Vi = in.V[0];
+    const auto& Vj = in.V[1];
+
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) w.avgV[iVar] = 0.5 * (Vi[iVar] + Vj[iVar]);
+
+    w.projVel = 0.0;
+    w.area = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      w.projVel += w.avgV[VEL+iDim] * in.normal[iDim];
+      w.area += in.normal[iDim] * in.normal[iDim];
+    }
+    w.area = sqrt(w.area);
+
+    /*--- Central flux with the averaged variables. ---*/
+
+    w.mdot = w.avgV[RHO] * w.projVel;
+    flux[0] = w.mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux[iDim+1] = w.mdot * w.avgV[VEL+iDim] + in.normal[iDim] * w.avgV[PRES];
+    }
+    flux[nDim+1] = w.mdot * w.avgV[ENTH];
+
+    /*--- Difference of conservatives (rho*h instead of rho*E). ---*/
+
+    w.diffU[0] = Vi[RHO] - Vj[RHO];
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      w.diffU[iDim+1] = Vi[RHO] * Vi[VEL+iDim] - Vj[RHO] * Vj[VEL+iDim];
+    }
+    w.diffU[nDim+1] = Vi[RHO] * Vi[ENTH] - Vj[RHO] * Vj[ENTH];
+
+    /*--- Corrected spectral radius. ---*/
+
+    w.lambda0 = abs(w.projVel) + w.avgV[SOUND] * w.area;
+    for (int k = 0; k < 2; ++k) w.phi[k] = pow(0.25 * in.lambda[k] / w.lambda0, coefs.stretchParam);
+    w.lambda = 4 * w.phi[0] * w.phi[1] / (w.phi[0] + w.phi[1]) * w.lambda0;
+
+    /*--- Dissipation coefficients. ---*/
+
+    w.sc2 = 3 * (nNeighbor[0] + nNeighbor[1]) / (nNeighbor[0] * nNeighbor[1]);
+    w.sc4 = 0.25 * w.sc2 * w.sc2;
+    w.eps2 = coefs.kappa2 * 0.5 * (in.sensor[0] + in.sensor[1]) * w.sc2;
+    w.eps4 = fmax(T(0.0), coefs.kappa4 - w.eps2) * w.sc4;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux[iVar] += (w.eps2 * w.diffU[iVar] - w.eps4 * (in.lapl[0][iVar] - in.lapl[1][iVar])) * w.lambda;
+    }
+  }
+
+ public:
+  /*!
+   * \brief Flux of an edge (same as CJSTScheme).
+   * \param[in] nNeighbor - Number of neighbors of the two points.
+   */
+  template<class T>
+  static void Flux(const Coefficients& coefs, const Data<T>& in, const T* nNeighbor, T* flux) {
+    Intermediates<T> w;
+    forward(coefs, in, nNeighbor, w, flux);
+  }
+
+  /*!
+   * \brief Reverse mode of Flux, the adjoints of the inputs (in_b) are incremented.
+   * \param[in] flux_b - Adjoint of the flux.
+   */
+  template<class T>
+  static void Reverse(const Coefficients& coefs, const Data<T>& in, const T* nNeighbor,
+                      const T* flux_b, Data<T>& in_b) {
+    Intermediates<T> w;
+    T flux[nVar];
+    forward(coefs, in, nNeighbor, w, flux);
+
+    const auto& Vi = in.V[0];
+    const auto& Vj = in.V[1];
+    auto& Vi_b = in_b.V[0];
+    auto& Vj_b = in_b.V[1];
+
+    /*--- Dissipation terms. ---*/
+
+    T lambda_b = 0.0, eps2_b = 0.0, eps4_b = 0.0;
+    T diffU_b[nVar];
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const T deltaLapl = in.lapl[0][iVar] - in.lapl[1][iVar];
+      lambda_b += flux_b[iVar] * (w.eps2 * w.diffU[iVar] - w.eps4 * deltaLapl);
+      const T dissip_b = flux_b[iVar] * w.lambda;
+      eps2_b += dissip_b * w.diffU[iVar];
+      eps4_b -= dissip_b * deltaLapl;
+      diffU_b[iVar] = dissip_b * w.eps2;
+      in_b.lapl[0][iVar] -= dissip_b * w.eps4;
+      in_b.lapl[1][iVar] += dissip_b * w.eps4;
+    }
+    const T eps4Active = (coefs.kappa4 - w.eps2 > T(0.0));
+    eps2_b -= eps4_b * w.sc4 * eps4Active;
+    for (int k = 0; k < 2; ++k) in_b.sensor[k] += eps2_b * coefs.kappa2 * 0.5 * w.sc2;
+
+    /*--- Spectral radius. ---*/
+
+    const T phiSum = w.phi[0] + w.phi[1];
+    const T H = 4 * w.phi[0] * w.phi[1] / phiSum;
+    const T H_b = lambda_b * w.lambda0;
+    T lambda0_b = lambda_b * H;
+
+    for (int k = 0; k < 2; ++k) {
+      const T phi_b = H_b * 4 * w.phi[1-k] * w.phi[1-k] / (phiSum * phiSum);
+      const T dPhi = phi_b * coefs.stretchParam * w.phi[k];
+      in_b.lambda[k] += dPhi / in.lambda[k];
+      lambda0_b -= dPhi / w.lambda0;
+    }
+
+    const T signProjVel = (w.projVel > T(0.0)) - (w.projVel < T(0.0));
+    T projVel_b = lambda0_b * signProjVel;
+    T avgV_b[nPrimVar] = {};
+    avgV_b[SOUND] = lambda0_b * w.area;
+    const T area_b = lambda0_b * w.avgV[SOUND];
+
+    /*--- Central flux. ---*/
+
+    T mdot_b = flux_b[0] + flux_b[nDim+1] * w.avgV[ENTH];
+    avgV_b[ENTH] += flux_b[nDim+1] * w.mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      mdot_b += flux_b[iDim+1] * w.avgV[VEL+iDim];
+      avgV_b[VEL+iDim] += flux_b[iDim+1] * w.mdot;
+      avgV_b[PRES] += flux_b[iDim+1] * in.normal[iDim];
+      in_b.normal[iDim] += flux_b[iDim+1] * w.avgV[PRES];
+    }
+    avgV_b[RHO] += mdot_b * w.projVel;
+    projVel_b += mdot_b * w.avgV[RHO];
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      avgV_b[VEL+iDim] += projVel_b * in.normal[iDim];
+      in_b.normal[iDim] += projVel_b * w.avgV[VEL+iDim] + area_b * in.normal[iDim] / w.area;
+    }
+
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+      Vi_b[iVar] += 0.5 * avgV_b[iVar];
+      Vj_b[iVar] += 0.5 * avgV_b[iVar];
+    }
+
+    /*--- Difference of conservatives. ---*/
+
+    Vi_b[RHO] += diffU_b[0];
+    Vj_b[RHO] -= diffU_b[0];
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      Vi_b[RHO] += diffU_b[iDim+1] * Vi[VEL+iDim];
+      Vi_b[VEL+iDim] += diffU_b[iDim+1] * Vi[RHO];
+      Vj_b[RHO] -= diffU_b[iDim+1] * Vj[VEL+iDim];
+      Vj_b[VEL+iDim] -= diffU_b[iDim+1] * Vj[RHO];
+    }
+    Vi_b[RHO] += diffU_b[nDim+1] * Vi[ENTH];
+    Vi_b[ENTH] += diffU_b[nDim+1] * Vi[RHO];
+    Vj_b[RHO] -= diffU_b[nDim+1] * Vj[ENTH];
+    Vj_b[ENTH] -= diffU_b[nDim+1] * Vj[RHO];
+  }
+};
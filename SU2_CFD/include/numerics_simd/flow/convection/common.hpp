@@ -91,6 +91,52 @@ FORCEINLINE void musclEdgeLimited(Int iPoint,
   }
 }
 
+/*!
+ * \brief MUSCL reconstruction of the variables of points i/j with a given type of limiter.
+ */
+template<size_t nDim, class VarType, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclReconstruction(Int iPoint, Int jPoint,
+                                     LIMITER limiterType,
+                                     const VectorDbl<nDim>& vector_ij,
+                                     const Limiter_t& limiters,
+                                     const Gradient_t& gradients,
+                                     CPair<VarType>& V) {
+  switch (limiterType) {
+  case LIMITER::NONE:
+    musclUnlimited(iPoint, vector_ij, 0.5, gradients, V.i.all);
+    musclUnlimited(jPoint, vector_ij,-0.5, gradients, V.j.all);
+    break;
+  case LIMITER::VAN_ALBADA_EDGE:
+    musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, V);
+    break;
+  default:
+    musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
+    musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
+    break;
+  }
+}
+
+/*!
+ * \brief MUSCL reconstruction of flow primitives with the gradients and limiters of the solution.
+ */
+template<size_t nDim, class VarType, class VariableType>
+FORCEINLINE void musclFlowPrimitives(Int iPoint, Int jPoint,
+                                     LIMITER limiterType,
+                                     const VectorDbl<nDim>& vector_ij,
+                                     const VariableType& solution,
+                                     CPair<VarType>& V) {
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  /*--- Read the single precision copy of the gradients and limiters if there is one (MUSCL_FLOW_SINGLE_PREC). ---*/
+  if (solution.GetReconstructionSinglePrec()) {
+    musclReconstruction(iPoint, jPoint, limiterType, vector_ij, solution.GetLimiter_PrimitiveSP(),
+                        solution.GetGradient_ReconstructionSP(), V);
+    return;
+  }
+#endif
+  musclReconstruction(iPoint, jPoint, limiterType, vector_ij, solution.GetLimiter_Primitive(),
+                      solution.GetGradient_Reconstruction(), V);
+}
+
 /*!
  * \brief Retrieve primitive variables for points i/j, reconstructing them if needed.
  * \param[in] iEdge, iPoint, jPoint - Edge and its nodes.
@@ -108,9 +154,6 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
                                                       const VariableType& solution) {
   static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
 
-  const auto& gradients = solution.GetGradient_Reconstruction();
-  const auto& limiters = solution.GetLimiter_Primitive();
-
   CPair<ReconVarType> V;
 
   for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
@@ -119,19 +162,7 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
   }
 
   if (muscl) {
-    switch (limiterType) {
-    case LIMITER::NONE:
-      musclUnlimited(iPoint, vector_ij, 0.5, gradients, V.i.all);
-      musclUnlimited(jPoint, vector_ij,-0.5, gradients, V.j.all);
-      break;
-    case LIMITER::VAN_ALBADA_EDGE:
-      musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, V);
-      break;
-    default:
-      musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
-      musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
-      break;
-    }
+    musclFlowPrimitives(iPoint, jPoint, limiterType, vector_ij, solution, V);
     /*--- Detect a non-physical reconstruction based on negative pressure or density. ---*/
     const Double neg_p_or_rho = fmax(fmin(V.i.pressure(), V.j.pressure()) < 0.0,
                                      fmin(V.i.density(), V.j.density()) < 0.0);
@@ -0,0 +1,429 @@
+﻿/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting scheme for incompressible flow.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Retrieve incompressible primitive variables for points i/j, reconstructing them if needed.
+ * \note Only the first ReconVarType::nVar variables are reconstructed, and only the temperature and
+ *       density are checked for non-physical values since the pressure is the dynamic pressure.
+ */
+template<class ReconVarType, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<PrimVarType> reconstructIncPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                        bool muscl, bool energy, LIMITER limiterType,
+                                                        const CPair<PrimVarType>& V1st,
+                                                        const VectorDbl<nDim>& vector_ij,
+                                                        const VariableType& solution) {
+  static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
+
+  CPair<PrimVarType> V = V1st;
+  if (!muscl) return V;
+
+  CPair<ReconVarType> Vr;
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    Vr.i.all(iVar) = V1st.i.all(iVar);
+    Vr.j.all(iVar) = V1st.j.all(iVar);
+  }
+  musclFlowPrimitives(iPoint, jPoint, limiterType, vector_ij, solution, Vr);
+
+  /*--- Revert to first order if the state is non-physical. ---*/
+  Double bad_recon = 0.0;
+  if (energy) {
+    bad_recon = fmax(fmin(Vr.i.temperature(), Vr.j.temperature()) < 0.0,
+                     fmin(Vr.i.density(), Vr.j.density()) < 0.0);
+    /*--- Handle SIMD dimensions 1 by 1. ---*/
+    for (size_t k = 0; k < Double::Size; ++k) {
+      bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
+    }
+  }
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * Vr.i.all(iVar);
+    V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * Vr.j.all(iVar);
+  }
+  return V;
+}
+
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(const PrimVarType& V,
+                                                  const VectorDbl<nDim>& normal) {
+  const Double mdot = V.density() * dot<nDim>(V.velocity(), normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*V.velocity(iDim) + normal(iDim)*V.pressure();
+  }
+  flux(nDim+1) = mdot * V.cp() * V.temperature();
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux w.r.t. the primitive variables (incompressible flow).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(const PrimVarType& V,
+                                                 Double dRhodT,
+                                                 const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  const Double projVel = dot<nDim>(V.velocity(), normal);
+  const Double projVelOnBeta = projVel / V.betaInc2();
+  const Double enthalpy = V.cp() * V.temperature();
+
+  jac(0,0) = scale * projVelOnBeta;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(0,jDim+1) = scale * normal(jDim) * V.density();
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + V.velocity(iDim) * projVelOnBeta);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * normal(jDim) * V.density() * V.velocity(iDim);
+    }
+    jac(iDim+1,iDim+1) += scale * V.density() * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * V.velocity(iDim) * projVel;
+  }
+
+  jac(nDim+1,0) = scale * enthalpy * projVelOnBeta;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(nDim+1,jDim+1) = scale * enthalpy * normal(jDim) * V.density();
+  }
+  jac(nDim+1,nDim+1) = scale * V.cp() * (V.temperature() * dRhodT + V.density()) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Low-Mach preconditioning matrix of the incompressible system.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density, const VectorDbl<nDim>& velocity,
+                                                Double betaInc2, Double cp, Double temperature,
+                                                Double dRhodT) {
+  MatrixDbl<nDim+2> precon;
+
+  precon(0,0) = 1 / betaInc2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity(iDim) / betaInc2;
+  }
+  precon(nDim+1,0) = cp * temperature / betaInc2;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precon(0,jDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,jDim+1) = (iDim == jDim)? density : Double(0.0);
+    }
+    precon(nDim+1,jDim+1) = 0.0;
+  }
+
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,nDim+1) = velocity(iDim) * dRhodT;
+  }
+  precon(nDim+1,nDim+1) = cp * (dRhodT * temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Absolute value of the preconditioned Jacobian, P x |Lambda| x inv(P),
+ *        where P diagonalizes inv(Precon) x dF/dV (see CNumerics::GetPreconditionedProjJac).
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density, const VectorDbl<nDim+2>& lambda,
+                                                       Double betaInc2, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> invPreconA;
+
+  const Double sqrtBeta = sqrt(betaInc2);
+  const Double sumLambda = lambda(nDim) + lambda(nDim+1);
+  const Double diffLambda = lambda(nDim+1) - lambda(nDim);
+
+  invPreconA(0,0) = 0.5 * sumLambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    invPreconA(iDim+1,0) = normal(iDim) * diffLambda / (2*sqrtBeta*density);
+  }
+  invPreconA(nDim+1,0) = 0.0;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    invPreconA(0,jDim+1) = 0.5 * sqrtBeta * normal(jDim) * density * diffLambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      if (iDim == jDim) {
+        invPreconA(iDim+1,jDim+1) = 0.5 * sumLambda * pow(normal(iDim),2);
+        for (size_t kDim = 0; kDim < nDim; ++kDim) {
+          if (kDim != iDim) invPreconA(iDim+1,jDim+1) += 2*lambda(0) * pow(normal(kDim),2);
+        }
+      }
+      else {
+        invPreconA(iDim+1,jDim+1) = 0.5 * normal(iDim) * normal(jDim) * (sumLambda - 2*lambda(0));
+      }
+    }
+    invPreconA(nDim+1,jDim+1) = 0.0;
+  }
+
+  for (size_t iDim = 0; iDim < nDim+1; ++iDim) {
+    invPreconA(iDim,nDim+1) = 0.0;
+  }
+  invPreconA(nDim+1,nDim+1) = lambda(nDim-1);
+
+  return invPreconA;
+}
+
+/*!
+ * \class CFDSIncScheme
+ * \ingroup ConvDiscr
+ * \brief Flux difference splitting scheme with low-Mach preconditioning for incompressible
+ * flow (pressure, velocity, temperature variables), vectorized version of CUpwFDSInc_Flow.
+ * A base class implementing "viscousTerms" is accepted as template parameter (see CRoeBase).
+ */
+template<class Base>
+class CFDSIncScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool energy;
+  const bool variableDensity;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    energy(config.GetEnergy_Equation()),
+    variableDensity(config.GetVariable_Density_Model()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    /*--- Geometric properties. ---*/
+
+    const auto edge = edgeGeometry<nDim>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& vector_ij = edge.vector_ij;
+    const auto& normal = edge.normal;
+    const auto& area = edge.area;
+    VectorDbl<nDim> unitNormal, dissipNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+      /*--- As in the scalar scheme, small components are replaced by EPS for the dissipation. ---*/
+      const Double small = abs(unitNormal(iDim)) < EPS;
+      dissipNormal(iDim) = small * EPS + (1-small) * unitNormal(iDim);
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    const auto V = reconstructIncPrimitives<CIncompressiblePrimitives<nDim,nPrimVarGrad> >(
+                       iEdge, iPoint, jPoint, muscl, energy, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mean variables, the projected velocity is not normalized. ---*/
+
+    VectorDbl<nDim> meanVelocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      meanVelocity(iDim) = 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim));
+    }
+    Double projVel = dot(meanVelocity, normal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+      projVel -= projGridVel;
+    }
+
+    const Double meanDensity = 0.5 * (V.i.density() + V.j.density());
+    const Double meanBetaInc2 = 0.5 * (V.i.betaInc2() + V.j.betaInc2());
+    const Double meanCp = 0.5 * (V.i.cp() + V.j.cp());
+    const Double meanTemperature = 0.5 * (V.i.temperature() + V.j.temperature());
+
+    /*--- Artificial sound speed based on eigs of preconditioned system. ---*/
+
+    const Double meanSoundSpeed = sqrt(meanBetaInc2 * area * area);
+
+    /*--- Derivative of the equation of state for the preconditioner (only ideal gas for now). ---*/
+
+    Double meandRhodT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      meandRhodT = -meanDensity / meanTemperature;
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Absolute eigenvalues of the preconditioned system. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(projVel);
+    }
+    lambda(nDim) = abs(projVel - meanSoundSpeed);
+    lambda(nDim+1) = abs(projVel + meanSoundSpeed);
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    const auto flux_i = inviscidIncProjFlux(V.i, normal);
+    const auto flux_j = inviscidIncProjFlux(V.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(V.i, dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j, dRhodT_j, normal, 0.5);
+    }
+
+    /*--- Dissipation, Precon x |A_precon| x dV. ---*/
+
+    const auto precon = incPreconditioner(meanDensity, meanVelocity, meanBetaInc2,
+                                          meanCp, meanTemperature, meandRhodT);
+    const auto invPreconA = incPreconditionedProjJac(meanDensity, lambda, meanBetaInc2, dissipNormal);
+
+    VectorDbl<nVar> deltaV;
+    deltaV(0) = V.j.pressure() - V.i.pressure();
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      deltaV(iDim+1) = V.j.velocity(iDim) - V.i.velocity(iDim);
+    }
+    deltaV(nDim+1) = V.j.temperature() - V.i.temperature();
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dDdV = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dDdV += precon(iVar,kVar) * invPreconA(kVar,jVar);
+        }
+        dDdV *= 0.5;
+
+        flux(iVar) -= dDdV * deltaV(jVar);
+
+        if (implicit) {
+          jac_i(iVar,jVar) += dDdV;
+          jac_j(iVar,jVar) -= dDdV;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion, with density, momentum, and density times enthalpy. ---*/
+
+    if (dynamicGrid) {
+      const Double rhoH_i = V.i.density() * V.i.cp() * V.i.temperature();
+      const Double rhoH_j = V.j.density() * V.j.cp() * V.j.temperature();
+
+      flux(0) -= projGridVel * 0.5 * (V.i.density() + V.j.density());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        flux(iDim+1) -= projGridVel * 0.5 * (V.i.density()*V.i.velocity(iDim) + V.j.density()*V.j.velocity(iDim));
+      }
+      flux(nDim+1) -= projGridVel * 0.5 * (rhoH_i + rhoH_j);
+
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= 0.5 * projGridVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= 0.5 * projGridVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= 0.5 * projGridVel * V.i.density() * V.i.cp();
+        jac_j(nDim+1,nDim+1) -= 0.5 * projGridVel * V.j.density() * V.j.cp();
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Decouple the temperature if the energy equation is not solved. ---*/
+
+    if (!energy) {
+      flux(nDim+1) = 0.0;
+      if (implicit) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_i(iVar,nDim+1) = 0.0;
+          jac_j(iVar,nDim+1) = 0.0;
+          jac_i(nDim+1,iVar) = 0.0;
+          jac_j(nDim+1,iVar) = 0.0;
+        }
+      }
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,335 @@
+﻿/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme, Toro (1994), for ideal gas. A base class implementing "viscousTerms"
+ * is accepted as template parameter (see CRoeBase).
+ * \note The four branches of the scalar implementation are evaluated for the "upwind" side K
+ * of the contact surface (i if sM > 0, j otherwise) and its "other" side O, in each case the fluxes
+ * and Jacobians of the supersonic and star states are blended with masks.
+ */
+template<class Base>
+class CHLLCScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT) && !config.GetLagged_Jacobian_Iter();
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    /*--- Geometric properties. ---*/
+
+    const auto edge = edgeGeometry<nDim>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& vector_ij = edge.vector_ij;
+    const auto& normal = edge.normal;
+    const auto& area = edge.area;
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    const Double gm1 = gamma - 1;
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+    Double a_i = sqrt((V.i.enthalpy() - 0.5*sqVel_i) * gm1);
+    Double a_j = sqrt((V.j.enthalpy() - 0.5*sqVel_j) * gm1);
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      a_i -= projGridVel;
+      a_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averaged variables (with the same sign conventions as the scalar version). ---*/
+
+    const Double sqrtRho_i = sqrt(V.i.density());
+    const Double sqrtRho_j = sqrt(V.j.density());
+    const Double oneOnRrho = 1 / (sqrtRho_i + sqrtRho_j);
+
+    Double sqVelRoe = 0.0, projVelRoe = -projGridVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double velRoe = (V.i.velocity(iDim)*sqrtRho_i + V.j.velocity(iDim)*sqrtRho_j) * oneOnRrho;
+      sqVelRoe += velRoe * velRoe;
+      projVelRoe += velRoe * unitNormal(iDim);
+    }
+    const Double enthalpyRoe = (sqrtRho_i*V.i.enthalpy() + sqrtRho_j*V.j.enthalpy()) * oneOnRrho;
+    const Double aRoe = sqrt(gm1 * (enthalpyRoe - 0.5*sqVelRoe)) - projGridVel;
+
+    /*--- Wave speeds, contact speed, and star pressure. ---*/
+
+    const Double sL = fmin(projVelRoe - aRoe, projVel_i - a_i);
+    const Double sR = fmax(projVelRoe + aRoe, projVel_j + a_j);
+
+    const Double RHO = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / RHO;
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- Upwind (K) and other (O) sides, iK = 1 if K is i, supersonic = 1 if the flux
+     *    is that of the state K itself rather than of its star state. ---*/
+
+    const Double iK = sM > 0.0;
+    const Double jK = 1 - iK;
+    const Double supersonic = iK*(sL > 0.0) + jK*(sR < 0.0);
+    const Double subsonic = 1 - supersonic;
+
+    const Double rho_K = iK*V.i.density() + jK*V.j.density();
+    const Double p_K = iK*V.i.pressure() + jK*V.j.pressure();
+    const Double h_K = iK*V.i.enthalpy() + jK*V.j.enthalpy();
+    const Double sqVel_K = iK*sqVel_i + jK*sqVel_j;
+    const Double projVel_K = iK*projVel_i + jK*projVel_j;
+    const Double s_K = iK*sL + jK*sR;
+    VectorDbl<nDim> vel_K;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      vel_K(iDim) = iK*V.i.velocity(iDim) + jK*V.j.velocity(iDim);
+    }
+    const Double energy_K = h_K - p_K / rho_K;
+
+    /*--- Star state. ---*/
+
+    const Double rhoS = (s_K-projVel_K) / (s_K-sM);
+    const Double dpS = (pStar-p_K) / (s_K-projVel_K);
+
+    VectorDbl<nVar> starState;
+    starState(0) = rhoS * rho_K;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      starState(iDim+1) = rhoS * (rho_K*vel_K(iDim) + dpS*unitNormal(iDim));
+    }
+    starState(nVar-1) = rhoS * (rho_K*energy_K - (p_K*projVel_K - pStar*sM)/(s_K-projVel_K));
+
+    /*--- Flux. ---*/
+
+    const Double mdot_K = rho_K * projVel_K;
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * (supersonic*mdot_K + subsonic*sM*starState(0));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (supersonic*(mdot_K*vel_K(iDim) + p_K*unitNormal(iDim)) +
+                             subsonic*(sM*starState(iDim+1) + pStar*unitNormal(iDim)));
+    }
+    flux(nVar-1) = area * (supersonic*mdot_K*h_K +
+                           subsonic*(sM*(starState(nVar-1)+pStar) + pStar*projGridVel));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      /*--- Sign of the derivatives of sM w.r.t. the K state. ---*/
+      const Double sign = iK - jK;
+
+      const Double rho_O = jK*V.i.density() + iK*V.j.density();
+      const Double sqVel_O = jK*sqVel_i + iK*sqVel_j;
+      const Double projVel_O = jK*projVel_i + iK*projVel_j;
+      const Double s_O = jK*sL + iK*sR;
+      VectorDbl<nDim> vel_O;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        vel_O(iDim) = jK*V.i.velocity(iDim) + iK*V.j.velocity(iDim);
+      }
+
+      const Double eStar = starState(nVar-1);
+      const Double omega = 1 / (s_K-sM);
+      const Double omegaSM = omega * sM;
+
+      VectorDbl<nVar> dPI_dU, dSm_dU, drhoStar_dU, dpStar_dU, dEStar_dU;
+      MatrixDbl<nVar> jac_K, jac_O;
+
+      /*--- Jacobian w.r.t. the K state. ---*/
+
+      dPI_dU(0) = 0.5 * gm1 * sqVel_K;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dPI_dU(iDim+1) = -gm1 * vel_K(iDim);
+      }
+      dPI_dU(nVar-1) = gm1;
+
+      dSm_dU(0) = sign * (-projVel_K*projVel_K + sM*s_K + dPI_dU(0)) / RHO;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dSm_dU(iDim+1) = sign * (unitNormal(iDim)*(2*projVel_K - s_K - sM) + dPI_dU(iDim+1)) / RHO;
+      }
+      dSm_dU(nVar-1) = sign * dPI_dU(nVar-1) / RHO;
+
+      drhoStar_dU(0) = omega * (s_K + starState(0)*dSm_dU(0));
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        drhoStar_dU(iDim+1) = omega * (-unitNormal(iDim) + starState(0)*dSm_dU(iDim+1));
+      }
+      drhoStar_dU(nVar-1) = omega * starState(0) * dSm_dU(nVar-1);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        dpStar_dU(iVar) = rho_K * (s_O-projVel_O) * dSm_dU(iVar);
+        dEStar_dU(iVar) = omega * (sM*dpStar_dU(iVar) + (eStar+pStar)*dSm_dU(iVar));
+      }
+      dEStar_dU(0) += omega * projVel_K * (h_K - dPI_dU(0));
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dEStar_dU(iDim+1) += omega * (-unitNormal(iDim)*h_K - projVel_K*dPI_dU(iDim+1));
+      }
+      dEStar_dU(nVar-1) += omega * (s_K - projVel_K - projVel_K*dPI_dU(nVar-1));
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_K(0,iVar) = sM*drhoStar_dU(iVar) + starState(0)*dSm_dU(iVar);
+      }
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_K(jDim+1,iVar) = (omegaSM+1) * (unitNormal(jDim)*dpStar_dU(iVar) + starState(jDim+1)*dSm_dU(iVar)) -
+                               omegaSM * dPI_dU(iVar) * unitNormal(jDim);
+        }
+        jac_K(jDim+1,0) += omegaSM * vel_K(jDim) * projVel_K;
+        jac_K(jDim+1,jDim+1) += omegaSM * (s_K-projVel_K);
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_K(jDim+1,iDim+1) -= omegaSM * vel_K(jDim) * unitNormal(iDim);
+        }
+      }
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_K(nVar-1,iVar) = sM*(dEStar_dU(iVar)+dpStar_dU(iVar)) + (eStar+pStar)*dSm_dU(iVar);
+      }
+
+      /*--- Jacobian w.r.t. the O state. ---*/
+
+      dSm_dU(0) = -sign * (-projVel_O*projVel_O + sM*s_O + 0.5*gm1*sqVel_O) / RHO;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dSm_dU(iDim+1) = -sign * (unitNormal(iDim)*(2*projVel_O - s_O - sM) - gm1*vel_O(iDim)) / RHO;
+      }
+      dSm_dU(nVar-1) = -sign * gm1 / RHO;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        dpStar_dU(iVar) = rho_O * (s_K-projVel_K) * dSm_dU(iVar);
+        dEStar_dU(iVar) = omega * (sM*dpStar_dU(iVar) + (eStar+pStar)*dSm_dU(iVar));
+      }
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_O(0,iVar) = starState(0) * (omegaSM+1) * dSm_dU(iVar);
+      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_O(iDim+1,iVar) = (omegaSM+1) * (starState(iDim+1)*dSm_dU(iVar) + unitNormal(iDim)*dpStar_dU(iVar));
+        }
+      }
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_O(nVar-1,iVar) = sM*(dEStar_dU(iVar)+dpStar_dU(iVar)) + (eStar+pStar)*dSm_dU(iVar);
+      }
+
+      /*--- Blend with the supersonic Jacobian (of the K state) and assign to i/j,
+       *    scale = kappa because Flux ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+
+      const auto jac_sup = inviscidProjJac(gamma, vel_K.data(), energy_K, unitNormal, 1.0);
+      const Double scale = area * kappa;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          const Double dFdU_K = scale * (supersonic*jac_sup(iVar,jVar) + subsonic*jac_K(iVar,jVar));
+          const Double dFdU_O = scale * subsonic * jac_O(iVar,jVar);
+          jac_i(iVar,jVar) = iK*dFdU_K + jK*dFdU_O;
+          jac_j(iVar,jVar) = jK*dFdU_K + iK*dFdU_O;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
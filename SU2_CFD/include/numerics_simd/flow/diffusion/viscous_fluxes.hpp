@@ -31,6 +31,7 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "common.hpp"
+#include "../../../variables/CIncNSVariable.hpp"
 
 /*!
  * \class CNoViscousFlux
@@ -371,3 +372,149 @@ public:
     return dEdU;
   }
 };
+
+/*!
+ * \class CIncompressibleViscousFlux
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add viscous fluxes (incompressible flow), vectorized
+ * version of CAvgGradInc_Flow. The energy equation is written for the temperature,
+ * and the Jacobians are w.r.t. the primitive variables (pressure, velocity, temperature).
+ */
+template<size_t NDIM>
+class CIncompressibleViscousFlux : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nPrimVar = nDim+7;
+  static constexpr size_t nPrimVarGrad = nDim+2;
+
+  const bool correct;
+  const bool useSA_QCR;
+  const bool wallFun;
+  const bool uq;
+  const bool uq_permute;
+  const size_t uq_eigval_comp;
+  const su2double uq_delta_b;
+  const su2double uq_urlx;
+
+  const CVariable* turbVars;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  template<class... Ts>
+  CIncompressibleViscousFlux(const CConfig& config, int iMesh,
+                             const CVariable* turbVars_, Ts&...) :
+    correct(iMesh == MESH_0),
+    useSA_QCR(config.GetSAParsedOptions().qcr2000),
+    wallFun(config.GetWall_Functions()),
+    uq(config.GetSSTParsedOptions().uq),
+    uq_permute(config.GetUQ_Permute()),
+    uq_eigval_comp(config.GetEig_Val_Comp()),
+    uq_delta_b(config.GetUQ_Delta_B()),
+    uq_urlx(config.GetUQ_URLX()),
+    turbVars(turbVars_) {
+  }
+
+  /*!
+   * \brief Add viscous contributions to flux and jacobians.
+   */
+  template<class PrimVarType, size_t nVar>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const PrimVarType& avgV,
+                                const CPair<PrimVarType>& V,
+                                const CVariable& solution_,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CGeometry& geometry,
+                                const CConfig& config,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    static_assert(PrimVarType::nVar >= nPrimVar,"");
+
+    const auto& solution = static_cast<const CIncNSVariable&>(solution_);
+    const auto& gradient = solution.GetGradient_Primitive();
+
+    /*--- Compute distance and handle zero without "ifs" by making it large. ---*/
+
+    auto dist2_ij = squaredNorm(vector_ij);
+    Double mask = dist2_ij < EPS*EPS;
+    dist2_ij += mask / (EPS*EPS);
+
+    /*--- Compute the corrected mean gradient (pressure, velocity, temperature). ---*/
+
+    auto avgGrad = averageGradient<nPrimVarGrad,nDim>(iPoint, jPoint, gradient);
+    if(correct) correctGradient(V, vector_ij, dist2_ij, avgGrad);
+
+    /*--- Stress tensor. ---*/
+
+    auto tau = stressTensor(avgV.laminarVisc() + (uq? Double(0.0) : avgV.eddyVisc()), avgGrad);
+    if(useSA_QCR) addQCR(avgGrad, tau);
+    if(uq) {
+      Double turb_ke = 0.5*(gatherVariables(iPoint, turbVars->GetSolution()) +
+                            gatherVariables(jPoint, turbVars->GetSolution()));
+      addPerturbedRSM(avgV, avgGrad, turb_ke, tau,
+                      uq_eigval_comp, uq_permute, uq_delta_b, uq_urlx);
+    }
+
+    if(wallFun) addTauWall(iPoint, jPoint, solution.GetTau_Wall(), unitNormal, tau);
+
+    /*--- Projected flux, there is no work of the viscous forces in the temperature equation. ---*/
+
+    VectorDbl<nVar> viscFlux;
+    viscFlux(0) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      /*--- Using the symmetry of the tensor. ---*/
+      viscFlux(iDim+1) = area * dot(tau[iDim], unitNormal);
+    }
+    viscFlux(nDim+1) = area * avgV.thermalCond() * dot(avgGrad[nDim+1], unitNormal);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= viscFlux(iVar);
+    }
+
+    if (!implicit) return;
+
+    /*--- Flux Jacobians (the viscous flux is subtracted), momentum w.r.t. velocity
+     *    and temperature w.r.t. temperature. ---*/
+
+    const Double xi = area * (avgV.laminarVisc() + avgV.eddyVisc()) / sqrt(dist2_ij);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        const Double dtau = (1/3.0) * xi * unitNormal(iDim) * unitNormal(jDim);
+        jac_i(iDim+1,jDim+1) += dtau;
+        jac_j(iDim+1,jDim+1) -= dtau;
+      }
+      jac_i(iDim+1,iDim+1) += xi;
+      jac_j(iDim+1,iDim+1) -= xi;
+    }
+
+    const Double dqdT = area * avgV.thermalCond() * dot(vector_ij, unitNormal) / dist2_ij;
+    jac_i(nDim+1,nDim+1) += dqdT;
+    jac_j(nDim+1,nDim+1) -= dqdT;
+  }
+
+  /*!
+   * \overload Average primitives if not provided yet.
+   */
+  template<class PrimVarType, class... Ts>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const CPair<PrimVarType>& V,
+                                Ts&... args) const {
+    PrimVarType avgV;
+    for (size_t iVar = 0; iVar < PrimVarType::nVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+
+    /*--- Continue calculation. ---*/
+    viscousTerms(iEdge, iPoint, jPoint, avgV, V, args...);
+  }
+};
@@ -0,0 +1,123 @@
+/*!
+ * \file heat_diffusion.hpp
+ * \brief Vectorized diffusion of the heat equation in solids.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHeatDiffusion
+ * \ingroup ViscDiscr
+ * \brief Heat conduction with constant diffusivity (see CAvgGrad_Heat with gradient correction).
+ * \details The corrected projection of the mean gradient, 0.5*(grad_i+grad_j).(n - p*d_ij) + p*(T_j-T_i),
+ * with p = d_ij.n/|d_ij|^2, only needs the geometry of the edge, which comes from the edge geometry cache
+ * if there is one. Thin shear layer Jacobians, as in the scalar numerics.
+ */
+template<size_t NDIM>
+class CHeatDiffusion final : public CNumericsSIMD {
+private:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = 1;
+
+  const su2double diffusivity;
+
+public:
+  /*!
+   * \brief Constructor, store the thermal diffusivity.
+   */
+  CHeatDiffusion(const CConfig& config) : diffusivity(config.GetThermalDiffusivity()) {}
+
+  /*!
+   * \brief Implementation of the diffusive flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    /*--- Geometric properties, the distance is floored by EPS as in the scalar code. ---*/
+
+    const auto edge = edgeGeometry<nDim>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+
+    const Double projVector = dot(edge.vector_ij, edge.normal) / fmax(squaredNorm(edge.vector_ij), EPS);
+
+    VectorDbl<nDim> corrNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      corrNormal(iDim) = edge.normal(iDim) - projVector * edge.vector_ij(iDim);
+    }
+
+    /*--- Corrected projection of the mean gradient. ---*/
+
+    const Double T_i = gatherVariables(iPoint, solution.GetSolution());
+    const Double T_j = gatherVariables(jPoint, solution.GetSolution());
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, solution.GetGradient());
+
+    Double projGrad = projVector * (T_j - T_i);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projGrad += 0.5 * (grad_i.data()[iDim] + grad_j.data()[iDim]) * corrNormal(iDim);
+    }
+
+    /*--- Flux and Jacobians, the sign convention is that of the convective fluxes (see updateLinearSystem). ---*/
+
+    VectorDbl<nVar> flux;
+    flux(0) = -diffusivity * projGrad;
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i.data()[0] = diffusivity * projVector;
+      jac_j.data()[0] = -diffusivity * projVector;
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
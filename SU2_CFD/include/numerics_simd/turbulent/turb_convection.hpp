@@ -0,0 +1,207 @@
+﻿/*!
+ * \file turb_convection.hpp
+ * \brief Vectorized scalar upwind convection of turbulence variables.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "variables.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../variables/CVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CUpwScalarTurbScheme
+ * \ingroup ConvDiscr
+ * \brief Scalar upwind convection of turbulence variables (see CUpwSca_TurbSA/SST), with optional
+ * MUSCL reconstruction of the turbulence and flow variables. The diffusion terms of the model are
+ * added by the decorator via its "viscousTerms" method, the decorator also defines the sizes (nDim,
+ * nVar), the flow indices (FlowIndices), and whether the variables are "conservative" (multiplied by
+ * density in the convective flux, e.g. SST).
+ */
+template<class Decorator>
+class CUpwScalarTurbScheme : public Decorator {
+private:
+  using Decorator::nDim;
+  using Decorator::nVar;
+  using Decorator::conservative;
+  using FlowIndices = typename Decorator::FlowIndices;
+  using FlowPrimVarType = CTurbFlowPrimitives<FlowIndices>;
+
+  const CVariable& flowVars;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool musclFlow;
+  const bool limiterFlow;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Reconstruct the flow variables (up to density) with the flow gradients and limiters.
+   */
+  FORCEINLINE void reconstructFlow(Int iPoint, Int jPoint, const VectorDbl<nDim>& vector_ij,
+                                   CPair<FlowPrimVarType>& V) const {
+    constexpr size_t nVarRecon = FlowIndices::nVarRecon;
+    const auto& gradients = flowVars.GetGradient_Reconstruction();
+    const auto& limiters = flowVars.GetLimiter_Primitive();
+
+    VectorDbl<nVarRecon> V_i, V_j;
+    for (size_t iVar = 0; iVar < nVarRecon; ++iVar) {
+      V_i(iVar) = V.i.all(iVar);
+      V_j(iVar) = V.j.all(iVar);
+    }
+    if (limiterFlow) {
+      musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V_i);
+      musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V_j);
+    } else {
+      musclUnlimited(iPoint, vector_ij, 0.5, gradients, V_i);
+      musclUnlimited(jPoint, vector_ij,-0.5, gradients, V_j);
+    }
+    for (size_t iVar = 0; iVar < nVarRecon; ++iVar) {
+      V.i.all(iVar) = V_i(iVar);
+      V.j.all(iVar) = V_j(iVar);
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to the decorator.
+   */
+  template<class... Ts>
+  CUpwScalarTurbScheme(const CConfig& config, const CVariable* flowVars_, Ts&... args) :
+    Decorator(config, args...),
+    flowVars(*flowVars_),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(config.GetMUSCL_Turb()),
+    musclFlow(muscl && config.GetMUSCL_Flow() && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE)),
+    typeLimiter(config.GetKind_SlopeLimit_Turb()) {
+  }
+
+  /*!
+   * \brief Implementation of the convective and diffusive fluxes.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix,
+                   const CEdgeGeometryCache* edgeCache,
+                   unsigned long iPack) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool limiter = (typeLimiter != LIMITER::NONE) && (config.GetInnerIter() <= config.GetLimiterIter());
+
+    /*--- Geometric properties. ---*/
+
+    const auto edge = edgeGeometry<nDim>(iEdge, geometry, edgeCache, iPack);
+    const auto& iPoint = edge.iPoint;
+    const auto& jPoint = edge.jPoint;
+    const auto& vector_ij = edge.vector_ij;
+    const auto& normal = edge.normal;
+
+    /*--- Flow primitives and turbulence variables. ---*/
+
+    CPair<FlowPrimVarType> V1st;
+    V1st.i.all = gatherVariables<FlowPrimVarType::nVar>(iPoint, flowVars.GetPrimitive());
+    V1st.j.all = gatherVariables<FlowPrimVarType::nVar>(jPoint, flowVars.GetPrimitive());
+
+    CPair<VectorDbl<nVar> > T1st;
+    T1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    T1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    auto V = V1st;
+    auto T = T1st;
+
+    if (muscl) {
+      if (musclFlow) reconstructFlow(iPoint, jPoint, vector_ij, V);
+
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      musclTurb(iPoint, vector_ij, 0.5, limiter, solution.GetLimiter(), gradients, T.i);
+      musclTurb(jPoint, vector_ij,-0.5, limiter, solution.GetLimiter(), gradients, T.j);
+    }
+
+    /*--- Face-normal velocity, relative to the grid. ---*/
+
+    Double q_ij = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      q_ij += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      q_ij -= 0.5 * (dot(gatherVariables<nDim>(iPoint,gridVel), normal) +
+                     dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double a0 = fmax(0.0, q_ij);
+    const Double a1 = fmin(0.0, q_ij);
+
+    /*--- Upwind flux and Jacobians. ---*/
+
+    const Double rho_i = conservative? V.i.density() : Double(1.0);
+    const Double rho_j = conservative? V.j.density() : Double(1.0);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0*rho_i*T.i(iVar) + a1*rho_j*T.j(iVar);
+    }
+
+    /*--- The Jacobians are diagonal, flat indexing is used because 1x1 matrices are vectors. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      for (size_t k = 0; k < nVar*nVar; ++k) {
+        jac_i.data()[k] = 0.0;
+        jac_j.data()[k] = 0.0;
+      }
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_i.data()[iVar*(nVar+1)] = a0;
+        jac_j.data()[iVar*(nVar+1)] = a1;
+      }
+    }
+
+    /*--- Add the diffusion terms, based on the non-reconstructed variables (static decorator). ---*/
+
+    Decorator::viscousTerms(iPoint, jPoint, V1st, T1st, solution, vector_ij, normal,
+                            implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
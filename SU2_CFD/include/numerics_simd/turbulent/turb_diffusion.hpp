@@ -0,0 +1,215 @@
+﻿/*!
+ * \file turb_diffusion.hpp
+ * \brief Vectorized diffusion terms of the SA and SST turbulence models.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "variables.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \class CTurbDiffusionBase
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add the diffusion fluxes of turbulence models (see CAvgGrad_Scalar).
+ * The mean gradient is always corrected (these numerics are only used on the finest grid), the
+ * model specific part (effective diffusivity and Jacobians) is implemented by the derived class.
+ */
+template<class FlowIndices_, size_t NVAR, class Derived>
+class CTurbDiffusionBase : public CNumericsSIMD {
+protected:
+  using FlowIndices = FlowIndices_;
+  using FlowPrimVarType = CTurbFlowPrimitives<FlowIndices>;
+  static constexpr size_t nDim = FlowIndices::nDim;
+  static constexpr size_t nVar = NVAR;
+
+  template<class... Ts>
+  CTurbDiffusionBase(Ts&...) {}
+
+  /*!
+   * \brief Add diffusion contributions to flux and jacobians.
+   */
+  FORCEINLINE void viscousTerms(Int iPoint,
+                                Int jPoint,
+                                const CPair<FlowPrimVarType>& V,
+                                const CPair<VectorDbl<nVar> >& T,
+                                const CVariable& solution,
+                                const VectorDbl<nDim>& vector_ij,
+                                const VectorDbl<nDim>& normal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    /*--- Projection of the edge vector on the normal, the distance is floored by EPS as in the scalar code. ---*/
+
+    const Double projVector = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+    /*--- Corrected projection of the mean gradient. ---*/
+
+    const auto& gradient = solution.GetGradient();
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+    const auto projNormal_i = projectGradient(grad_i, normal);
+    const auto projNormal_j = projectGradient(grad_j, normal);
+    const auto projEdge_i = projectGradient(grad_i, vector_ij);
+    const auto projEdge_j = projectGradient(grad_j, vector_ij);
+
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double edgeProj = 0.5 * (projEdge_i(iVar) + projEdge_j(iVar));
+      projGrad(iVar) = 0.5 * (projNormal_i(iVar) + projNormal_j(iVar)) -
+                       (edgeProj - (T.j(iVar) - T.i(iVar))) * projVector;
+    }
+
+    static_cast<const Derived*>(this)->modelTerms(iPoint, jPoint, V, T, solution, projVector,
+                                                  projGrad, implicit, flux, jac_i, jac_j);
+  }
+};
+
+/*!
+ * \class CSADiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the SA model (see CAvgGrad_TurbSA), or SA-neg if "negative" is true
+ * (see CAvgGrad_TurbSA_Neg).
+ */
+template<class FlowIndices, bool negative>
+class CSADiffusion : public CTurbDiffusionBase<FlowIndices, 1, CSADiffusion<FlowIndices, negative> > {
+protected:
+  using Base = CTurbDiffusionBase<FlowIndices, 1, CSADiffusion<FlowIndices, negative> >;
+  using typename Base::FlowPrimVarType;
+  using Base::nVar;
+  friend Base;
+
+  static constexpr bool conservative = false;
+  const su2double sigma = 2.0/3.0;
+  const su2double cn1 = 16.0;
+
+  template<class... Ts>
+  CSADiffusion(Ts&... args) : Base(args...) {}
+
+  FORCEINLINE void modelTerms(Int, Int,
+                              const CPair<FlowPrimVarType>& V,
+                              const CPair<VectorDbl<nVar> >& T,
+                              const CVariable&,
+                              Double projVector,
+                              const VectorDbl<nVar>& projGrad,
+                              bool implicit,
+                              VectorDbl<nVar>& flux,
+                              MatrixDbl<nVar>& jac_i,
+                              MatrixDbl<nVar>& jac_j) const {
+
+    const Double nu_ij = 0.5 * (V.i.laminarVisc() / V.i.density() + V.j.laminarVisc() / V.j.density());
+    const Double nu_tilde_ij = 0.5 * (T.i(0) + T.j(0));
+
+    Double nu_e = nu_ij + nu_tilde_ij;
+    if (negative) {
+      /*--- fn = 1 for positive values, which avoids branching. ---*/
+      const Double xi = fmin(nu_tilde_ij, 0.0) / nu_ij;
+      const Double xi3 = xi * xi * xi;
+      const Double fn = (cn1 + xi3) / (cn1 - xi3);
+      nu_e = nu_ij + fn * nu_tilde_ij;
+    }
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    if (implicit) {
+      jac_i.data()[0] -= (0.5 * projGrad(0) - nu_e * projVector) / sigma;
+      jac_j.data()[0] -= (0.5 * projGrad(0) + nu_e * projVector) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the SST model (see CAvgGrad_TurbSST).
+ */
+template<class FlowIndices>
+class CSSTDiffusion : public CTurbDiffusionBase<FlowIndices, 2, CSSTDiffusion<FlowIndices> > {
+protected:
+  using Base = CTurbDiffusionBase<FlowIndices, 2, CSSTDiffusion<FlowIndices> >;
+  using typename Base::FlowPrimVarType;
+  using Base::nVar;
+  friend Base;
+
+  static constexpr bool conservative = true;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  template<class... Ts>
+  CSSTDiffusion(const CConfig& config, const su2double* constants, Ts&...) :
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+  FORCEINLINE void modelTerms(Int iPoint, Int jPoint,
+                              const CPair<FlowPrimVarType>& V,
+                              const CPair<VectorDbl<nVar> >&,
+                              const CVariable& solution,
+                              Double projVector,
+                              const VectorDbl<nVar>& projGrad,
+                              bool implicit,
+                              VectorDbl<nVar>& flux,
+                              MatrixDbl<nVar>& jac_i,
+                              MatrixDbl<nVar>& jac_j) const {
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    /*--- Blended constants and mean effective dynamic viscosities. ---*/
+
+    const Double sigma_k_i = F1_i * sigma_k1 + (1.0 - F1_i) * sigma_k2;
+    const Double sigma_k_j = F1_j * sigma_k1 + (1.0 - F1_j) * sigma_k2;
+    const Double sigma_om_i = F1_i * sigma_om1 + (1.0 - F1_i) * sigma_om2;
+    const Double sigma_om_j = F1_j * sigma_om1 + (1.0 - F1_j) * sigma_om2;
+
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (V.i.laminarVisc() + sigma_k_i * V.i.eddyVisc() +
+                     V.j.laminarVisc() + sigma_k_j * V.j.eddyVisc());
+    diff(1) = 0.5 * (V.i.laminarVisc() + sigma_om_i * V.i.eddyVisc() +
+                     V.j.laminarVisc() + sigma_om_j * V.j.eddyVisc());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+
+    /*--- Thin shear layer approximation of the Jacobians. ---*/
+
+    if (implicit) {
+      const Double proj_on_rho_i = projVector / V.i.density();
+      const Double proj_on_rho_j = projVector / V.j.density();
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_i.data()[iVar*(nVar+1)] += diff(iVar) * proj_on_rho_i;
+        jac_j.data()[iVar*(nVar+1)] -= diff(iVar) * proj_on_rho_j;
+      }
+    }
+  }
+};
@@ -0,0 +1,98 @@
+﻿/*!
+ * \file variables.hpp
+ * \brief Flow variables used by the vectorized numerics of the turbulence models.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+
+/*!
+ * \brief Compile-time indices of the flow primitives used by the turbulence numerics,
+ * equivalent to the CIndices of CEulerVariable and CIncEulerVariable.
+ * \note Velocity and density have the same index in both cases.
+ */
+template<size_t nDim_, bool incompressible>
+struct CTurbFlowIndices {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t density = nDim+2;
+  static constexpr size_t laminarVisc = incompressible? nDim+4 : nDim+5;
+  static constexpr size_t eddyVisc = laminarVisc+1;
+  /*! \brief Number of variables to fetch, and number that can be reconstructed (up to density). */
+  static constexpr size_t nVar = eddyVisc+1;
+  static constexpr size_t nVarRecon = density+1;
+};
+
+/*!
+ * \brief Type to store the flow primitives used by the turbulence numerics.
+ */
+template<class FlowIndices>
+struct CTurbFlowPrimitives {
+  static constexpr size_t nVar = FlowIndices::nVar;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& density() { return all(FlowIndices::density); }
+  FORCEINLINE Double& velocity(size_t iDim) { return all(iDim+1); }
+  FORCEINLINE const Double& density() const { return all(FlowIndices::density); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(iDim+1); }
+  FORCEINLINE const Double& laminarVisc() const { return all(FlowIndices::laminarVisc); }
+  FORCEINLINE const Double& eddyVisc() const { return all(FlowIndices::eddyVisc); }
+};
+
+/*!
+ * \brief Projection of the gradients of nVar variables onto a vector.
+ * \note Flat indexing is used since nVar may be 1, in which case the gradient is a row vector.
+ */
+template<size_t nVar, size_t nDim>
+FORCEINLINE VectorDbl<nVar> projectGradient(const MatrixDbl<nVar,nDim>& grad, const VectorDbl<nDim>& vector) {
+  VectorDbl<nVar> proj;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    proj(iVar) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      proj(iVar) += grad.data()[iVar*nDim+iDim] * vector(iDim);
+    }
+  }
+  return proj;
+}
+
+/*!
+ * \brief MUSCL reconstruction of turbulence variables, optionally limited.
+ */
+template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclTurb(Int iPoint,
+                           const VectorDbl<nDim>& vector_ij,
+                           Double scale,
+                           bool limiter,
+                           const Limiter_t& limiters,
+                           const Gradient_t& gradients,
+                           VectorDbl<nVar>& vars) {
+  const auto proj = projectGradient(gatherVariables<nVar,nDim>(iPoint, gradients), vector_ij);
+  if (limiter) {
+    const auto lim = gatherVariables<nVar>(iPoint, limiters);
+    for (size_t iVar = 0; iVar < nVar; ++iVar) vars(iVar) += lim(iVar) * scale * proj(iVar);
+  } else {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) vars(iVar) += scale * proj(iVar);
+  }
+}
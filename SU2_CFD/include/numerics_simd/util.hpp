@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CNumericsSIMD.hpp"
+#include "CEdgeGeometryCache.hpp"
 #include "../../../Common/include/containers/C2DContainer.hpp"
 #include "../../../Common/include/linear_algebra/CSysVector.hpp"
 #include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
@@ -197,7 +198,7 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
     for (size_t j=0; j<nCols; ++j) {
       for (size_t k=0; k<Double::Size; ++k) {
         AD::SetPreaccIn(vars(iPoint[k],i,j));
-        x(i,j)[k] = vars(iPoint[k],i,j);
+        x.data()[i*nCols+j][k] = vars(iPoint[k],i,j);
       }
     }
   }
@@ -229,6 +230,45 @@ FORCEINLINE VectorDbl<nDim> distanceVector(Int iPoint, Int jPoint,
   return vector_ij;
 }
 
+/*!
+ * \brief Node indices and geometric properties of a pack of edges.
+ */
+template<size_t nDim>
+struct CEdgeGeometry {
+  Int iPoint, jPoint;
+  VectorDbl<nDim> normal, vector_ij;
+  Double area;
+};
+
+/*!
+ * \brief Get the geometry of a pack of edges, from the cache if there is one, otherwise from the grid.
+ * \note Without cache, the i-j vector is only computed if "withVector" is true.
+ */
+template<size_t nDim, bool withVector = true>
+FORCEINLINE CEdgeGeometry<nDim> edgeGeometry(Int iEdge, const CGeometry& geometry,
+                                             const CEdgeGeometryCache* edgeCache,
+                                             unsigned long iPack) {
+  CEdgeGeometry<nDim> edge;
+  if (edgeCache) {
+    const auto* nodes = edgeCache->GetNodes(iPack);
+    const auto* geo = edgeCache->GetGeometry(iPack);
+    edge.iPoint = Int(nodes);
+    edge.jPoint = Int(nodes + Int::Size);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      edge.normal(iDim) = Double(geo + iDim * Double::Size);
+      edge.vector_ij(iDim) = Double(geo + (nDim + 1 + iDim) * Double::Size);
+    }
+    edge.area = Double(geo + nDim * Double::Size);
+    return edge;
+  }
+  edge.iPoint = geometry.edges->GetNode(iEdge,0);
+  edge.jPoint = geometry.edges->GetNode(iEdge,1);
+  if (withVector) edge.vector_ij = distanceVector<nDim>(edge.iPoint, edge.jPoint, geometry.nodes->GetCoord());
+  edge.normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+  edge.area = norm(edge.normal);
+  return edge;
+}
+
 /*!
  * \brief Update the matrix and right-hand-side of a linear system.
  */
@@ -252,6 +292,15 @@ FORCEINLINE void updateLinearSystem(Int iEdge,
       AD::EndPassive(wasActive);
     }
   }
+  else if (updateType == UpdateType::ROW_I || updateType == UpdateType::ROW_J) {
+    const bool rowOfJ = (updateType == UpdateType::ROW_J);
+    vector.AddBlock(rowOfJ ? jPoint : iPoint, flux, rowOfJ ? Double(-updateMask) : updateMask);
+    if(implicit) {
+      auto wasActive = AD::BeginPassive();
+      matrix.UpdateRowBlocks(iEdge, iPoint, jPoint, rowOfJ, jac_i, jac_j, updateMask);
+      AD::EndPassive(wasActive);
+    }
+  }
   else {
     vector.SetBlock(iEdge, flux, updateMask);
     if(implicit) {
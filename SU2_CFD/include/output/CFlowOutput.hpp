@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CFVMOutput.hpp"
+#include "tools/CTimeStatistics.hpp"
 #include "../variables/CVariable.hpp"
 
 /*--- Forward declare to avoid including here. ---*/
@@ -38,6 +39,13 @@ class CFlowOutput : public CFVMOutput{
 protected:
   unsigned long lastInnerIter;
 
+  CTimeStatistics timeStatistics;       /*!< \brief Statistics of density, velocity, and pressure (unsteady). */
+  bool timeStatisticsChecked = false;   /*!< \brief Whether the need for time statistics was checked. */
+  vector<string> phaseAverageFields;    /*!< \brief Names of the phase average fields (phase major). */
+  vector<string> spectrumFields;        /*!< \brief Names of the amplitude fields (frequency major). */
+  vector<su2double> adaptIndicator;     /*!< \brief Error indicator of the mesh adaptation (domain points). */
+  vector<short> adaptFlag;              /*!< \brief Adaptation flags, 1 refine, -1 coarsen, 0 keep. */
+
   /*!
    * \brief Constructor of the class
    * \param[in] config - Definition of the particular problem.
@@ -242,6 +250,20 @@ protected:
   void ConvertVariableSymbolsToIndices(const CPrimitiveIndices<unsigned long>& idx, bool allowSkip,
                                        CustomOutput& output) const;
 
+  /*!
+   * \brief Add the point-wise custom outputs (type "Volume") to the available volume output fields.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetCustomVolumeOutputFields(const CConfig *config) override;
+
+  /*!
+   * \brief Evaluate the point-wise custom outputs for all the points of the domain, in batches of points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  void LoadCustomVolumeData(const CConfig *config, const CGeometry *geometry, const CSolver* const* solver) override;
+
   /*!
    * \brief Compute value of the Q criteration for vortex idenfitication
    * \param[in] VelocityGradient - Velocity gradients
@@ -330,16 +352,57 @@ protected:
   void WriteForcesBreakdown(const CConfig *config, const CSolver *flow_solver) const;
 
   /*!
-   * \brief Set the time averaged output fields.
+   * \brief Set the time averaged output fields, and the phase averages and spectra (amplitudes) if configured.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetTimeAveragedFields(const CConfig *config);
+
+  /*!
+   * \brief Load the time averaged output fields from the time statistics.
+   * \param[in] iPoint - Index of the point.
+   */
+  void LoadTimeAveragedData(unsigned long iPoint);
+
+  /*!
+   * \brief Add the current time step to the time statistics, they are allocated (and read from the restart)
+   *        the first time, if some of their fields are part of the volume output.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  void UpdateTimeStatistics(CConfig *config, CGeometry* geometry, CSolver** solver) override;
+
+  /*!
+   * \brief Compute the error indicator (ADAPT_INDICATOR) from the primitive gradients of the flow solver, and
+   *        mark the fractions of points with the largest/smallest indicator over all ranks for refinement/coarsening.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  void ComputeAdaptationIndicator(CConfig *config, CGeometry* geometry, CSolver** solver) override;
+
+  /*!
+   * \brief Save the time statistics next to the restart file.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void WriteTimeStatistics(CConfig *config, CGeometry* geometry) override;
+
+  /*!
+   * \brief Read the time statistics saved with the restart, if they continue at the restart iteration.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
    */
-  void SetTimeAveragedFields();
+  void ReadTimeStatistics(const CConfig *config, CGeometry* geometry, CSolver** solver);
 
   /*!
-   * \brief Load the time averaged output fields.
-   * \param iPoint
-   * \param node_flow
+   * \brief Name of the file of the time statistics (without extension), the same for all time iterations.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] restartName - Name of the restart file.
+   * \param[in] timeIter - Time iteration of the restart.
    */
-  void LoadTimeAveragedData(unsigned long iPoint, const CVariable *node_flow);
+  static string TimeStatisticsFileName(const CConfig *config, const string& restartName, unsigned long timeIter);
 
   /*!
    * \brief Write additional output for fixed CL mode.
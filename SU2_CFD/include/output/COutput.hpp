@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <cstdio>
 #include <fstream>
 #include <cmath>
 #include <map>
@@ -34,9 +35,11 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <thread>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
+#include "tools/CCompiledExpression.hpp"
 #include "../../../Common/include/option_structure.hpp"
 
 /*--- AD workaround for a cmath function not defined in CoDi. ---*/
@@ -52,6 +55,8 @@ inline su2double hypot(const su2double& a, const su2double& b) {
 class CGeometry;
 class CSolver;
 class CFileWriter;
+class CADIOS2FileWriter;
+class CSU2TimeSeriesFileWriter;
 class CParallelDataSorter;
 class CConfig;
 
@@ -175,11 +180,16 @@ protected:
   /*! \brief Struct to hold a parsed user-defined expression. */
   struct CustomHistoryOutput {
     mel::ExpressionTree<passivedouble> expression;
+    /*--- Flat form of the expression, used instead of the tree when it could be compiled. ---*/
+    CCompiledExpression compiled;
     /*--- Pointers to values in the history output maps, to avoid key lookup every time. ---*/
     std::vector<const su2double*> symbolValues;
     bool ready = false;
 
     su2double Eval() const {
+      if (compiled.Valid()) {
+        return compiled.Eval<su2double>([&](unsigned i) {return *symbolValues[i];});
+      }
       return mel::Eval<su2double>(expression, [&](int i) {return *symbolValues[i];});
     }
   };
@@ -187,7 +197,7 @@ protected:
   CustomHistoryOutput customObjFunc;  /*!< \brief User-defined expression for a custom objective. */
 
   /*! \brief Type of operation for custom outputs. */
-  enum class OperationType { MACRO, FUNCTION, AREA_AVG, AREA_INT, MASSFLOW_AVG, MASSFLOW_INT, PROBE };
+  enum class OperationType { MACRO, FUNCTION, AREA_AVG, AREA_INT, MASSFLOW_AVG, MASSFLOW_INT, PROBE, VOLUME };
 
   /*! \brief Struct to hold a parsed custom output function. */
   struct CustomOutput {
@@ -199,6 +209,7 @@ protected:
 
     /*--- Second level, func into expression, and acceleration structures. ---*/
     mel::ExpressionTree<passivedouble> expression;
+    CCompiledExpression compiled;
     std::vector<std::string> varSymbols;
     std::vector<unsigned short> markerIndices;
     static constexpr long PROBE_NOT_SETUP = -2;
@@ -232,8 +243,24 @@ protected:
      with primitive indices. ---*/
     template <class Variables>
     su2double Eval(const Variables& vars) const {
+      if (compiled.Valid()) {
+        return compiled.Eval<su2double>([&](unsigned iSymbol) {return vars(varIndices[iSymbol]);});
+      }
       return mel::Eval<su2double>(expression, [&](int iSymbol) {return vars(varIndices[iSymbol]);});
     }
+
+    /*--- Batched version of Eval for n points, "vars(index, k)" returns the value of a variable at the k-th point.
+     "work" must have CCompiledExpression::MAX_DEPTH * stride values (stride >= n), the results are its first n. ---*/
+    template <class Variables>
+    void EvalBatch(size_t n, size_t stride, const Variables& vars, su2double* work) const {
+      if (compiled.Valid()) {
+        compiled.EvalBatch(n, stride, [&](unsigned iSymbol, size_t k) {return vars(varIndices[iSymbol], k);}, work);
+        return;
+      }
+      for (size_t k = 0; k < n; ++k) {
+        work[k] = mel::Eval<su2double>(expression, [&](int iSymbol) {return vars(varIndices[iSymbol], k);});
+      }
+    }
   };
 
   std::vector<CustomOutput> customOutputs;  /*!< \brief User-defined outputs. */
@@ -243,6 +270,39 @@ protected:
   CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
   CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+  bool asyncOutput = false;               //!< Write the volume files that only use MPI-IO in a background thread.
+  std::thread asyncWriter;                //!< Thread writing the last asynchronous file.
+  SU2_MPI::Comm asyncComm{};              //!< Communicator for the collective I/O of the background thread.
+  passivedouble asyncBandwidth = 0.0;     //!< Bandwidth of the last asynchronous restart file (0 if none).
+
+  CADIOS2FileWriter* adios2Writer = nullptr; //!< Persistent writer of the ADIOS2 stream (one step per output).
+  CSU2TimeSeriesFileWriter* timeSeriesWriter = nullptr; //!< Persistent writer of the restart time series.
+
+  /*----------------------------- Sampling ----------------------------*/
+
+  /*! \brief Interpolation stencils of the locations sampled with the SAMPLE_* options, computed once. */
+  struct SamplingData {
+    static constexpr int MAGIC = 535534;    /*!< \brief Magic number of the output file. */
+    static constexpr unsigned long NOT_FOUND = std::numeric_limits<unsigned long>::max(); /*!< \brief Not owned/found. */
+
+    bool prepared = false;                 /*!< \brief Whether the stencils were computed. */
+    unsigned long nSamples = 0;            /*!< \brief Number of samples of all ranks. */
+    unsigned long maxOwned = 0;            /*!< \brief Maximum number of samples owned by a rank. */
+    vector<short> fieldOffsets;            /*!< \brief Offsets of the sampled fields in the volume output. */
+    vector<unsigned long> points;          /*!< \brief Local points whose volume output is evaluated. */
+    vector<std::pair<unsigned short, unsigned long> > wallVertices; /*!< \brief Sampled solid wall vertices. */
+    vector<unsigned long> wallPoints;      /*!< \brief Position in "points" of the sampled solid wall vertices. */
+    vector<unsigned long> ids;             /*!< \brief Global indices of the samples owned by this rank. */
+    vector<unsigned long> stencilStart;    /*!< \brief Start of the stencil of each owned sample. */
+    vector<unsigned long> stencilPoints;   /*!< \brief Position in "points" of the stencil entries. */
+    vector<passivedouble> stencilWeights;  /*!< \brief Interpolation weights of the stencil entries. */
+    vector<su2double> pointValues;         /*!< \brief Volume output at the points (point-major). */
+    vector<unsigned long> gatherIndex;     /*!< \brief Position of each sample in the gathered values (master). */
+    FILE* file = nullptr;                  /*!< \brief Output file (master). */
+  } sampling;
+
+  su2double* sampleRow = nullptr; //!< When set, the volume output values are stored here instead of in the sorter.
+
   vector<string> volumeFieldNames;     //!< Vector containing the volume field names
   unsigned short nVolumeFields;        //!< Number of fields in the volume output
 
@@ -590,6 +650,13 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName = "");
 
+  /*!
+   * \brief Wait for the asynchronous writing of a file to complete, the data sorters can then be modified.
+   * \note Must be called by all ranks, before anything modifies the sorted data or the connectivity.
+   * \param[in] config - Definition of the particular problem, can be nullptr (the bandwidth is then not stored).
+   */
+  void WaitForAsyncOutput(CConfig *config);
+
 protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
@@ -744,12 +811,21 @@ protected:
   void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
   /*!
-   * \brief Set the value of a volume output field
-   * \param[in] name - Name of the field.
-   * \param[in] iPoint - The point location in the field.
-   * \param[in] value - The new value of this field.
+   * \brief Compute the interpolation stencils of the sampled locations (probes, lines, planes, and markers)
+   *        and open the output file of the samples.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void PrepareSampling(CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Evaluate the sampled fields at the sampled locations and append them to the output file.
+   * \note Only the points of the stencils are evaluated, the volume data is neither loaded nor sorted.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
    */
-  void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
+  void WriteSamples(CConfig *config, CGeometry *geometry, CSolver **solver_container);
 
   /*!
    * \brief CheckHistoryOutput
@@ -887,6 +963,15 @@ protected:
    */
   inline virtual void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){}
 
+  /*!
+   * \brief Set the values of the point-wise custom outputs (type "Volume") for all the points of the domain.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  inline virtual void LoadCustomVolumeData(const CConfig *config, const CGeometry *geometry,
+                                           const CSolver* const* solver) {}
+
   /*!
    * \brief Set the values of the volume output fields for a point.
    * \param[in] config - Definition of the particular problem.
@@ -924,6 +1009,12 @@ protected:
    */
   inline virtual void SetVolumeOutputFields(CConfig *config){}
 
+  /*!
+   * \brief Add the point-wise custom outputs (type "Volume") to the available volume output fields.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetCustomVolumeOutputFields(const CConfig *config){}
+
 
   /*!
    * \brief Load the history output field values
@@ -960,6 +1051,29 @@ protected:
    */
   inline virtual void WriteAdditionalFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
 
+  /*!
+   * \brief Add the current time step to the time statistics (e.g. time averages) of the solver.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  inline virtual void UpdateTimeStatistics(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
+
+  /*!
+   * \brief Compute the error indicator and the refinement/coarsening flags of the mesh adaptation.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  inline virtual void ComputeAdaptationIndicator(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
+
+  /*!
+   * \brief Save the time statistics of the solver next to the restart file.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  inline virtual void WriteTimeStatistics(CConfig *config, CGeometry* geometry){}
+
   /*!
    * \brief Write any additional output defined for the current solver.
    * \param[in] config - Definition of the particular problem per zone.
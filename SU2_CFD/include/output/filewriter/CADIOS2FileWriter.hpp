@@ -0,0 +1,84 @@
+/*!
+ * \file CADIOS2FileWriter.hpp
+ * \brief Headers for the ADIOS2 writer class, for in-situ processing (streams) or BP files.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_ADIOS2
+#include <adios2.h>
+#include <memory>
+#endif
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CADIOS2FileWriter
+ * \brief Publishes the sorted data as the steps of an ADIOS2 stream, with the engine (e.g. BP4 files, or SST
+ * to couple analysis running on other nodes) set by ADIOS2_ENGINE or by an ADIOS2 XML configuration file.
+ * \details Unlike the other writers, one object is kept for the whole simulation. The connectivity (in the
+ * VTK layout of the Paraview XML writer) is only sent in the first step, the later steps only contain the
+ * point data, which is handed to ADIOS2 directly from the buffer of the data sorter without copies.
+ */
+class CADIOS2FileWriter final : public CFileWriter {
+ private:
+#ifdef HAVE_ADIOS2
+  std::unique_ptr<adios2::ADIOS> adios; /*!< \brief ADIOS2 context. */
+  adios2::IO io;                        /*!< \brief Definition of the variables of the stream. */
+  adios2::Engine engine;                /*!< \brief Engine of the open stream. */
+#endif
+  unsigned long timeIter = 0; /*!< \brief Time iteration of the next step. */
+  bool meshWritten = false;   /*!< \brief Whether the connectivity was already sent. */
+
+ public:
+  /*!
+   * \brief File extension (for file based engines).
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a writer for the data of a sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write, it must live as long as the writer.
+   * \param[in] engineType - ADIOS2 engine (BP4, BP5, SST, ...), used if the XML file does not set one.
+   * \param[in] xmlFile - ADIOS2 XML configuration file (engine parameters, operators), can be empty.
+   */
+  CADIOS2FileWriter(CParallelDataSorter* valDataSorter, const string& engineType, const string& xmlFile);
+
+  /*!
+   * \brief Destructor, closes the stream.
+   */
+  ~CADIOS2FileWriter() override;
+
+  /*!
+   * \brief Set the time iteration stored with the next step.
+   */
+  void SetTimeIter(unsigned long iter) { timeIter = iter; }
+
+  /*!
+   * \brief Write the sorted data as a new step, the stream is opened with this name on the first call.
+   * \param[in] val_filename - The name of the stream (without extension).
+   */
+  void WriteData(string val_filename) override;
+};
@@ -35,6 +35,7 @@ class CFVMDataSorter final: public CParallelDataSorter{
 private:
 
   vector<int> Local_Halo; //!< Array containing the flag whether a point is a halo node
+  bool linearSortedConn = false; //!< Whether the connectivity was sorted into the linear partitioning
 
 public:
   /*!
@@ -47,6 +48,7 @@ public:
 
   /*!
    * \brief Sort the connectivities (volume and surface) into data structures used for output file writing.
+   * Nothing is done if the connectivity is already sorted in the same way, it does not change for a fixed mesh.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
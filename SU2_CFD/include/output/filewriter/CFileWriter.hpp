@@ -39,8 +39,25 @@
 using namespace std;
 
 class CFileWriter{
+public:
+
+  /*!
+   * \brief Settings of the MPI-IO of the binary file writers, see ::SetMPIIOSettings.
+   */
+  struct MPIIOSettings {
+    unsigned long cbNodes = 0;      /*!< \brief Number of collective buffering aggregators (0 for the MPI default). */
+    unsigned long stripeCount = 0;  /*!< \brief Number of stripes of new files (0 for the file system default). */
+    unsigned long stripeSize = 0;   /*!< \brief Size of the stripes in bytes (0 for the file system default). */
+    unsigned long nSubfiles = 0;    /*!< \brief Number of subfiles (0 or 1 for one shared file). */
+  };
+
 protected:
 
+  /*!
+   * \brief The MPI-IO settings, common to all writers.
+   */
+  static MPIIOSettings ioSettings;
+
   /*!
    * \brief The MPI rank
    */
@@ -78,6 +95,11 @@ protected:
    */
   CParallelDataSorter* dataSorter;
 
+  /*!
+   * \brief The communicator used to open, write, and close the files.
+   */
+  SU2_MPI::Comm comm;
+
 #ifdef HAVE_MPI
   /*!
    * \brief The displacement that every process has in the current file view
@@ -88,6 +110,36 @@ protected:
    * \brief The file handle for writing
    */
   MPI_File fhw;
+
+  /*!
+   * \brief With subfiling, the communicator of the (consecutive) ranks that write the same subfile.
+   */
+  MPI_Comm fileComm;
+
+  /*!
+   * \brief Index of the subfile written by this rank, -1 without subfiling.
+   */
+  int subfile = -1;
+
+  /*!
+   * \brief Number of subfiles and of ranks of the communicator of the file.
+   */
+  int nSubfile = 0, nCommRank = 1;
+
+  /*!
+   * \brief Displacement in the subfile.
+   */
+  MPI_Offset subfileDisp;
+
+  /*!
+   * \brief Blocks of the subfile (on its first rank), triplets of offset in the file, size, and offset in the subfile.
+   */
+  vector<unsigned long> subfileBlocks;
+
+  /*!
+   * \brief Name of the (logical) file being written in subfiles.
+   */
+  string subfileName;
 #else
 
   /*!
@@ -137,6 +189,21 @@ public:
    */
   su2double GetUsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Set the communicator used for the MPI-IO (by default that of SU2_MPI).
+   * \note Allows writing from a thread other than the one running the solver (see COutput::WriteToFile).
+   */
+  void SetComm(SU2_MPI::Comm valComm) {comm = valComm;}
+
+  /*!
+   * \brief Set the MPI-IO settings of the binary writers (all the writers that use the functions of this class).
+   * \note With stripe settings the collective buffer of the aggregators is one stripe, i.e. their file domains are
+   *       stripe aligned. With subfiles, the ranks are split in groups of consecutive ranks, each group writes its
+   *       blocks of the file to "<file>.<group>", and the first rank writes the index "<file>.idx" of the blocks
+   *       (see merge_subfiles.py).
+   */
+  static void SetMPIIOSettings(const MPIIOSettings& settings) {ioSettings = settings;}
+
 protected:
 
   /*!
@@ -181,5 +248,27 @@ protected:
    */
   bool CloseMPIFile();
 
+#ifdef HAVE_MPI
+private:
+  /*!
+   * \brief Get the subfile written by a rank (of the communicator of the file).
+   */
+  inline int GetSubfileOfRank(int iRank) const {
+    return static_cast<int>((static_cast<long>(iRank) * nSubfile) / nCommRank);
+  }
+
+  /*!
+   * \brief Add a block written to the subfile of this rank, collective on the ranks of the subfile.
+   * \param[in] offset - Offset of the block in the (logical) file.
+   * \param[in] sizeInBytes - Size of the block.
+   */
+  void AddSubfileBlock(unsigned long offset, unsigned long sizeInBytes);
+
+  /*!
+   * \brief Write the index of the blocks of the subfiles, collective.
+   */
+  void WriteSubfileIndex();
+#endif
+
 };
 
@@ -353,4 +353,17 @@ public:
    */
   void SetTotalElements();
 
+  /*!
+   * \brief Get the nodes referenced by the local elements that are sorted to other ranks.
+   * \return Sorted (1-based) global node numbers, i.e. the same numbering as the connectivity.
+   */
+  vector<unsigned long> GetHaloNodes() const;
+
+  /*!
+   * \brief Gather the sorted data of nodes owned by other ranks, collective (all ranks must call it).
+   * \param[in] haloNodes - Sorted (1-based) global node numbers, see ::GetHaloNodes.
+   * \return The data of the nodes, node after node, with all the fields of each node.
+   */
+  vector<passivedouble> GatherHaloData(const vector<unsigned long>& haloNodes) const;
+
 };
@@ -52,6 +52,16 @@ private:
    */
   unsigned long dataOffset;
 
+  /*!
+   * \brief Whether each rank writes its own file (piece) instead of all ranks writing one file
+   */
+  const bool rankPiece;
+
+  /*!
+   * \brief The rank that writes the XML and the sizes of the data arrays
+   */
+  unsigned short headerRank = MASTER_NODE;
+
 public:
 
   /*!
@@ -69,8 +79,10 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valRankPiece - Each rank writes its elements and the nodes they use to its own file,
+   *            see ::GetPieceFilename (ignored when running on one rank).
    */
-  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter);
+  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter, bool valRankPiece = false);
 
   /*!
    * \brief Destructor
@@ -82,6 +94,15 @@ public:
    */
   void WriteData(string val_filename) override ;
 
+  /*!
+   * \brief Get the name (without extension) of the file of the piece of a rank.
+   * \param[in] val_filename - The name of the file
+   * \param[in] iRank - The rank
+   */
+  static string GetPieceFilename(const string& val_filename, int iRank) {
+    return val_filename + "_" + to_string(iRank);
+  }
+
 private:
 
   /*!
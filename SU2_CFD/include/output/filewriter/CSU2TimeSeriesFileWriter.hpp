@@ -0,0 +1,167 @@
+/*!
+ * \file CSU2TimeSeriesFileWriter.hpp
+ * \brief Headers for the time series restart file writer (and reader) class.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2TimeSeriesFileWriter
+ * \brief Appends the unsteady restarts of a simulation to a single file (.dts), as compressed steps.
+ * \details Instead of "restart_00010.dat", "restart_00011.dat", ... the steps are records of "restart.dts".
+ * Layout of the file:
+ *  - Header: the 5 ints of the binary restart (with a different magic number), the field names,
+ *    the offset of the index, and the number of records (both uint64).
+ *  - Records: the number of blocks, a table of {first point, number of points, offset, size} per block,
+ *    and the compressed blocks. Each rank compresses blocks of its points independently.
+ *  - Index: {time iteration, reference record, offset, size} per record, rewritten after each step.
+ * The values of a step are XOR'ed with those of the reference record (the previous step, or zeros for the
+ * full frames written every "key frame interval" steps), the leading zero bytes of the result are not stored.
+ * Compression is lossless, reading a step decodes the chain of records from the previous full frame.
+ */
+class CSU2TimeSeriesFileWriter final : public CFileWriter {
+ public:
+  /*!
+   * \brief File extension.
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Magic number of the file, that of the binary restart ("SU2") + 1.
+   */
+  static constexpr int MAGIC = 535533;
+
+  /*!
+   * \brief Maximum number of points in a compressed block.
+   */
+  static constexpr unsigned long BLOCK_SIZE = 4096;
+
+  /*!
+   * \brief Reference of full frames (they are not encoded as deltas).
+   */
+  static constexpr uint64_t NO_REF = ~uint64_t(0);
+
+ private:
+  /*!
+   * \brief Entry of the index (all uint64 to keep the layout of the file simple).
+   */
+  struct IndexEntry {
+    uint64_t step, ref, offset, size;
+  };
+
+  const unsigned long keyFrameInterval; /*!< \brief Steps between full frames. */
+  unsigned long stepsSinceKey = 0;      /*!< \brief Steps written since the last full frame. */
+  string seriesName;                    /*!< \brief Name of the open series (without extension). */
+  vector<passivedouble> previous;       /*!< \brief Values of the last step (reference of the next). */
+  vector<IndexEntry> index;             /*!< \brief Index of the series (only on the master rank). */
+  uint64_t appendOffset = 0;            /*!< \brief Where the next record is written. */
+
+ public:
+  /*!
+   * \brief Construct a writer for the (restart) data of a sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write, it must live as long as the writer.
+   * \param[in] keyFrames - Number of steps between full frames (1 means no deltas).
+   */
+  CSU2TimeSeriesFileWriter(CParallelDataSorter* valDataSorter, unsigned long keyFrames);
+
+  /*!
+   * \brief Append the sorted data as a new step of a series.
+   * \param[in] val_filename - Name of the step as for the binary restart (with the time iteration suffix),
+   *            the name of the series is obtained by removing the suffix.
+   */
+  void WriteData(string val_filename) override;
+
+  /*!
+   * \brief Split the name of a step into the name of the series and the time iteration.
+   * \param[in] name - Name of the step, e.g. "restart_flow_00010".
+   * \param[out] series - Name of the series, e.g. "restart_flow".
+   * \param[out] step - Time iteration, e.g. 10.
+   * \return False if the name has no time iteration suffix.
+   */
+  static bool SplitStepName(const string& name, string& series, unsigned long& step);
+
+  /*!
+   * \brief Read the field names of a series (collective).
+   * \param[in] fileName - Name of the series (with extension).
+   * \param[out] nPointFile - Number of points of each step.
+   * \param[out] fieldNames - Names of the fields.
+   */
+  static void ReadHeader(const string& fileName, unsigned long& nPointFile, vector<string>& fieldNames);
+
+  /*!
+   * \brief Read a step of a series at some of its points (collective).
+   * \param[in] fileName - Name of the series (with extension).
+   * \param[in] step - Time iteration of the step.
+   * \param[in] points - Sorted indices of the points required by this rank.
+   * \param[out] nFields - Number of fields.
+   * \param[out] data - Values of the fields at the points (point-major).
+   */
+  static void ReadStep(const string& fileName, unsigned long step, const vector<unsigned long>& points,
+                       unsigned long& nFields, vector<passivedouble>& data);
+
+  /*!
+   * \brief Compress the XOR of values and reference values.
+   * \param[in] data - Values.
+   * \param[in] ref - Reference values, nullptr for zeros.
+   * \param[in] nVal - Number of values.
+   * \param[in,out] out - The compressed values are appended.
+   */
+  static void EncodeBlock(const passivedouble* data, const passivedouble* ref, unsigned long nVal,
+                          vector<uint8_t>& out);
+
+  /*!
+   * \brief Decompress a block and XOR it into the values.
+   * \param[in] in - Compressed values.
+   * \param[in] size - Size of the compressed values.
+   * \param[in] nVal - Number of values.
+   * \param[in,out] data - Reference values on entry (zeros for full frames), values on exit.
+   * \return False if the block is corrupt.
+   */
+  static bool DecodeBlock(const uint8_t* in, unsigned long size, unsigned long nVal, passivedouble* data);
+
+ private:
+  /*!
+   * \brief Open the file of a series, appending to it if it is compatible with the data (collective).
+   * \param[in] fileName - Name of the file.
+   */
+  void OpenSeries(const string& fileName);
+
+  /*!
+   * \brief Move the position of the next write.
+   * \param[in] offset - New position in bytes.
+   */
+  void SeekFile(uint64_t offset);
+
+  /*!
+   * \brief Size of the header of the file.
+   * \param[in] nFields - Number of fields.
+   */
+  static inline uint64_t HeaderSize(unsigned long nFields) {
+    return 5 * sizeof(int) + nFields * CGNS_STRING_SIZE + 2 * sizeof(uint64_t);
+  }
+};
@@ -33,6 +33,9 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   const CFVMDataSorter* volumeSorter;               //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+  vector<unsigned long> surfPointIndex;             //!< Index of each local surface point in the sorted volume data
+  vector<string> sortedMarkers;                     //!< Markers of the sorted connectivity
+  bool surfaceRenumbered = false;                   //!< Whether the connectivity was renumbered for the surface points
 public:
 
   /*!
@@ -45,8 +48,8 @@ public:
 
   /*!
    * \brief Sort the output data for each grid node into a linear partitioning across all processors.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] geometry - Geometrical definition of the problem.
+   * \note The first call after sorting the connectivity finds the surface points and renumbers the
+   *       connectivity, further calls only extract the data of those points.
    */
   void SortOutputData() override;
 
@@ -61,7 +64,8 @@ public:
 
   /*!
    * \brief Sort the connectivities (volume and surface) into data structures used for output file writing.
-   * Only markers in the markerList argument will be sorted.
+   * Only markers in the markerList argument will be sorted. Nothing is done if the connectivity of the
+   * same markers is already sorted.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] markerList - List of markers to sort.
@@ -30,6 +30,7 @@
 #include "CFileWriter.hpp"
 
 #include <assert.h>
+#include <algorithm>
 
 class CTecplotBinaryFileWriter final: public CFileWriter{
 
@@ -71,24 +72,18 @@ public:
   class NodePartitioner {
   public:
     /*!
-     * \param[in] global_num_nodes - The total number of nodes being output
+     * \param[in] data_sorter - The sorted data being output, the nodes of each rank are globally consecutive
+     *            (a linear partitioning for volume data, the renumbered points of each rank for surface data).
      * \param[in] num_ranks - The number of MPI ranks involved in the output
      */
-    NodePartitioner(unsigned long global_num_nodes, int num_ranks)
+    NodePartitioner(const CParallelDataSorter* data_sorter, int num_ranks)
       : m_num_ranks(num_ranks) {
       /* rank i has (1-based) global nodes m_node_range[i] + 1 through m_node_range[i + 1] */
-      unsigned long nodes_per_rank = global_num_nodes / num_ranks;
-      unsigned long num_extra_nodes = global_num_nodes - nodes_per_rank * num_ranks;
       m_node_range.resize(num_ranks + 1);
-      m_node_range[0] = 0;
-      for (int ii = 1; ii <= num_ranks; ii++) {
-        m_node_range[ii] = m_node_range[ii - 1] + nodes_per_rank;
-        if (num_extra_nodes > 0) {
-          ++m_node_range[ii];
-          --num_extra_nodes;
-        }
+      for (int ii = 0; ii < num_ranks; ii++) {
+        m_node_range[ii] = data_sorter->GetNodeBegin(ii);
       }
-      assert(m_node_range[num_ranks] == global_num_nodes);
+      m_node_range[num_ranks] = data_sorter->GetnPointsGlobal();
     }
 
     /*!
@@ -99,13 +94,10 @@ public:
      */
     void GetOwningRankAndNodeNumber(unsigned long global_node_number, int &owning_rank, unsigned long &node_number)
     {
-      owning_rank = static_cast<int>(global_node_number / m_node_range[1]);
-      if (owning_rank >= m_num_ranks)
-        owning_rank = m_num_ranks - 1;
-      while(global_node_number > m_node_range[owning_rank + 1])
-        ++owning_rank;
-      while(global_node_number <= m_node_range[owning_rank])
-        --owning_rank;
+      /* The ranges of the ranks are not uniform in general (some may even be empty). */
+      auto it = lower_bound(m_node_range.begin() + 1, m_node_range.end(), global_node_number);
+      assert(it != m_node_range.end());
+      owning_rank = static_cast<int>(distance(m_node_range.begin(), it)) - 1;
       node_number = global_node_number - m_node_range[owning_rank];
     }
 
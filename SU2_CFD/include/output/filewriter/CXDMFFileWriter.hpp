@@ -0,0 +1,120 @@
+/*!
+ * \file CXDMFFileWriter.hpp
+ * \brief Headers for the XDMF file writer class, the data is stored in HDF5 format.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_HDF5
+#include "hdf5.h"
+#endif
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CXDMFFileWriter
+ * \brief Writes the sorted data as an XDMF descriptor (.xmf) and an HDF5 file (.h5) with the coordinates,
+ * the (mixed) connectivity, and the point data. All ranks write their part of each dataset collectively, the
+ * datasets can be chunked and compressed with the filters of HDF5 (lossless deflate, lossy scale-offset).
+ */
+class CXDMFFileWriter final : public CFileWriter {
+ private:
+  const unsigned short compressionLevel; /*!< \brief Deflate level, 0 for no compression. */
+  const int lossyDigits;                 /*!< \brief Decimal digits kept for the fields, negative for lossless. */
+
+#ifdef HAVE_HDF5
+  hid_t fileID = -1; /*!< \brief HDF5 file identifier. */
+  hid_t xferID = -1; /*!< \brief Data transfer property list (collective with MPI). */
+#endif
+
+ public:
+  /*!
+   * \brief File extension (of the descriptor).
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Chunk size (number of tuples) of compressed datasets.
+   */
+  static constexpr unsigned long CHUNK_SIZE = 65536;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write.
+   * \param[in] compression - Deflate level (0-9), 0 for no compression.
+   * \param[in] digits - Decimal digits kept by the lossy compression of the fields, negative for lossless.
+   */
+  CXDMFFileWriter(CParallelDataSorter* valDataSorter, unsigned short compression = 0, int digits = -1);
+
+  /*!
+   * \brief Write sorted data to file in XDMF (HDF5) format.
+   * \param[in] val_filename - The name of the file (without extension).
+   */
+  void WriteData(string val_filename) override;
+
+ private:
+#ifdef HAVE_HDF5
+  /*!
+   * \brief Collectively write a dataset of nGlobal tuples of nComp values, each rank writes nLocal tuples.
+   * \param[in] name - Name of the dataset.
+   * \param[in] memType - HDF5 type of the data, float or int.
+   * \param[in] data - Local data.
+   * \param[in] nLocal - Number of local tuples.
+   * \param[in] nGlobal - Number of tuples of all ranks.
+   * \param[in] offset - Position of the first local tuple in the dataset.
+   * \param[in] nComp - Number of components of each tuple.
+   * \param[in] lossy - Whether the lossy compression can be applied to this dataset.
+   */
+  void WriteDataset(const string& name, hid_t memType, const void* data, unsigned long nLocal, unsigned long nGlobal,
+                    unsigned long offset, unsigned short nComp, bool lossy) const;
+
+  /*!
+   * \brief Check the return value of an HDF5 call.
+   * \param[in] ier - Return value of the call.
+   */
+  static inline void CallHDF5(herr_t ier) {
+    if (ier < 0) SU2_MPI::Error("Error in an HDF5 call.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Return the XDMF type of an element for mixed topologies.
+   * \param[in] type - GEO_TYPE.
+   */
+  static inline int GetXDMFType(unsigned short type) {
+    switch (type) {
+      case LINE:          return 2;
+      case TRIANGLE:      return 4;
+      case QUADRILATERAL: return 5;
+      case TETRAHEDRON:   return 6;
+      case PYRAMID:       return 7;
+      case PRISM:         return 8;
+      case HEXAHEDRON:    return 9;
+      default:
+        assert(false && "Invalid element type.");
+        return 0;
+    }
+  }
+#endif
+};
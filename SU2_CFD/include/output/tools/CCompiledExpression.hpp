@@ -0,0 +1,301 @@
+/*!
+ * \file CCompiledExpression.hpp
+ * \brief Compilation of user-defined expressions (custom outputs) to a flat program evaluated by a stack machine.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/*!
+ * \class CCompiledExpression
+ * \brief User expression (custom output syntax) compiled once to a postfix program for a stack machine.
+ * \details Evaluation is a single loop over the instructions, without recursion or per-node dispatch on symbols.
+ * A batch of points can be evaluated at once, each instruction is then applied to the whole batch (vectorizable).
+ * Symbols are numbered by their position in the list given to Compile (the list produced by the MEL parser).
+ * Compile returns false for any syntax it does not know, in which case the caller keeps using the expression tree.
+ */
+class CCompiledExpression {
+ public:
+  enum : size_t { MAX_DEPTH = 32 }; /*!< \brief Maximum size of the evaluation stack. */
+
+ private:
+  enum class Op : unsigned char {
+    CONST, SYMBOL, ADD, SUB, MUL, DIV, NEG, POW, MIN, MAX, ATAN2,
+    SQRT, EXP, LOG, LOG10, SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH, ABS
+  };
+  struct Instruction {
+    Op op;
+    unsigned arg;  /*!< \brief Index of the constant or of the symbol. */
+  };
+
+  std::vector<Instruction> program;
+  std::vector<double> constants;
+
+  /*--- Recursive descent parser, emits the instructions in postfix order and tracks the stack depth. ---*/
+  class Parser {
+    const std::string& str;
+    const std::vector<std::string>& symbols;
+    CCompiledExpression& out;
+    size_t pos = 0, depth = 0;
+
+   public:
+    bool ok = true;
+    size_t maxDepth = 0;
+
+    Parser(const std::string& s, const std::vector<std::string>& sym, CCompiledExpression& o)
+      : str(s), symbols(sym), out(o) {}
+
+    bool AtEnd() {
+      Skip();
+      return pos == str.size();
+    }
+
+    void Expression() {
+      Term();
+      while (ok) {
+        if (Accept('+')) { Term(); Emit(Op::ADD); }
+        else if (Accept('-')) { Term(); Emit(Op::SUB); }
+        else break;
+      }
+    }
+
+   private:
+    void Skip() { while (pos < str.size() && std::isspace(static_cast<unsigned char>(str[pos]))) ++pos; }
+
+    bool Accept(char c) {
+      Skip();
+      if (pos < str.size() && str[pos] == c) { ++pos; return true; }
+      return false;
+    }
+
+    void Emit(Op op, unsigned arg = 0) {
+      switch (op) {
+        case Op::CONST: case Op::SYMBOL: ++depth; break;
+        case Op::ADD: case Op::SUB: case Op::MUL: case Op::DIV:
+        case Op::POW: case Op::MIN: case Op::MAX: case Op::ATAN2: --depth; break;
+        default: break;
+      }
+      maxDepth = std::max(maxDepth, depth);
+      out.program.push_back({op, arg});
+    }
+
+    void Term() {
+      Unary();
+      while (ok) {
+        if (Accept('*')) { Unary(); Emit(Op::MUL); }
+        else if (Accept('/')) { Unary(); Emit(Op::DIV); }
+        else break;
+      }
+    }
+
+    void Unary() {
+      if (Accept('-')) { Unary(); Emit(Op::NEG); }
+      else if (Accept('+')) Unary();
+      else Primary();
+    }
+
+    void Primary() {
+      if (!ok) return;
+      if (Accept('(')) {
+        Expression();
+        ok = ok && Accept(')');
+        return;
+      }
+      Skip();
+      if (pos == str.size()) { ok = false; return; }
+      const char c = str[pos];
+
+      if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+        char* end = nullptr;
+        const double value = std::strtod(str.c_str() + pos, &end);
+        if (end == str.c_str() + pos) { ok = false; return; }
+        pos = end - str.c_str();
+        out.constants.push_back(value);
+        Emit(Op::CONST, out.constants.size() - 1);
+        return;
+      }
+      if (!std::isalpha(static_cast<unsigned char>(c)) && c != '_') { ok = false; return; }
+
+      const auto start = pos;
+      while (pos < str.size() && (std::isalnum(static_cast<unsigned char>(str[pos])) || str[pos] == '_')) ++pos;
+      std::string name(str, start, pos - start);
+
+      if (Accept('(')) {
+        Function(name);
+        ok = ok && Accept(')');
+        return;
+      }
+      /*--- Indexed variables, e.g. "SPECIES[0]", are a single symbol. ---*/
+      if (pos < str.size() && str[pos] == '[') {
+        const auto close = str.find(']', pos);
+        if (close == std::string::npos) { ok = false; return; }
+        name.append(str, pos, close + 1 - pos);
+        pos = close + 1;
+      }
+      const auto it = std::find(symbols.begin(), symbols.end(), name);
+      if (it == symbols.end()) { ok = false; return; }
+      Emit(Op::SYMBOL, it - symbols.begin());
+    }
+
+    void Function(const std::string& name) {
+      struct Entry { const char* name; Op op; int nArgs; };
+      static const Entry table[] = {
+        {"pow", Op::POW, 2}, {"min", Op::MIN, 2}, {"fmin", Op::MIN, 2}, {"max", Op::MAX, 2},
+        {"fmax", Op::MAX, 2}, {"atan2", Op::ATAN2, 2}, {"sqrt", Op::SQRT, 1}, {"exp", Op::EXP, 1},
+        {"log", Op::LOG, 1}, {"log10", Op::LOG10, 1}, {"sin", Op::SIN, 1}, {"cos", Op::COS, 1},
+        {"tan", Op::TAN, 1}, {"asin", Op::ASIN, 1}, {"acos", Op::ACOS, 1}, {"atan", Op::ATAN, 1},
+        {"sinh", Op::SINH, 1}, {"cosh", Op::COSH, 1}, {"tanh", Op::TANH, 1}, {"abs", Op::ABS, 1},
+        {"fabs", Op::ABS, 1}};
+
+      for (const auto& entry : table) {
+        if (name != entry.name) continue;
+        Expression();
+        for (int i = 1; i < entry.nArgs && ok; ++i) {
+          ok = Accept(',');
+          Expression();
+        }
+        Emit(entry.op);
+        return;
+      }
+      ok = false;
+    }
+  };
+
+  template <class T, class F>
+  static void Unary(T* a, size_t n, const F& f) {
+    for (size_t k = 0; k < n; ++k) a[k] = f(a[k]);
+  }
+
+  template <class T, class F>
+  static void Binary(T* a, const T* b, size_t n, const F& f) {
+    for (size_t k = 0; k < n; ++k) a[k] = f(a[k], b[k]);
+  }
+
+ public:
+  /*!
+   * \brief Compile an expression.
+   * \param[in] expression - The expression string.
+   * \param[in] symbols - Names of the variables of the expression, their position is the index passed to the
+   *            evaluation functors.
+   * \return True if the expression could be compiled.
+   */
+  bool Compile(const std::string& expression, const std::vector<std::string>& symbols) {
+    program.clear();
+    constants.clear();
+    Parser parser(expression, symbols, *this);
+    parser.Expression();
+
+    if (!parser.ok || !parser.AtEnd() || parser.maxDepth > MAX_DEPTH) {
+      program.clear();
+      constants.clear();
+    }
+    return Valid();
+  }
+
+  /*!
+   * \brief Whether the expression was compiled successfully.
+   */
+  bool Valid() const { return !program.empty(); }
+
+  /*!
+   * \brief Evaluate the expression for a batch of n points.
+   * \param[in] n - Number of points.
+   * \param[in] stride - Leading dimension of the workspace, at least n.
+   * \param[in] symbol - Functor, symbol(iSymbol, k) returns the value of a symbol for the k-th point.
+   * \param[in,out] work - Workspace of MAX_DEPTH * stride values, on exit the first n contain the results.
+   */
+  template <class T, class Symbols>
+  void EvalBatch(size_t n, size_t stride, const Symbols& symbol, T* work) const {
+    using std::sqrt; using std::exp; using std::log; using std::log10; using std::pow; using std::atan2;
+    using std::sin; using std::cos; using std::tan; using std::asin; using std::acos; using std::atan;
+    using std::sinh; using std::cosh; using std::tanh; using std::fabs;
+
+    size_t top = 0;  // number of values on the stack
+
+    for (const auto& ins : program) {
+      /*--- Next free slot, and operands of unary (a) and binary (b op a) operations. ---*/
+      T* r = work + top * stride;
+      T* a = work + (top > 0 ? top - 1 : 0) * stride;
+      T* b = work + (top > 1 ? top - 2 : 0) * stride;
+
+      switch (ins.op) {
+        case Op::CONST: {
+          const T value = constants[ins.arg];
+          for (size_t k = 0; k < n; ++k) r[k] = value;
+          ++top;
+          break;
+        }
+        case Op::SYMBOL:
+          for (size_t k = 0; k < n; ++k) r[k] = symbol(ins.arg, k);
+          ++top;
+          break;
+
+        case Op::ADD: Binary(b, a, n, [](const T& x, const T& y) { return T(x + y); }); --top; break;
+        case Op::SUB: Binary(b, a, n, [](const T& x, const T& y) { return T(x - y); }); --top; break;
+        case Op::MUL: Binary(b, a, n, [](const T& x, const T& y) { return T(x * y); }); --top; break;
+        case Op::DIV: Binary(b, a, n, [](const T& x, const T& y) { return T(x / y); }); --top; break;
+        case Op::POW: Binary(b, a, n, [](const T& x, const T& y) { return T(pow(x, y)); }); --top; break;
+        case Op::MIN: Binary(b, a, n, [](const T& x, const T& y) { return y < x ? y : x; }); --top; break;
+        case Op::MAX: Binary(b, a, n, [](const T& x, const T& y) { return x < y ? y : x; }); --top; break;
+        case Op::ATAN2: Binary(b, a, n, [](const T& x, const T& y) { return T(atan2(x, y)); }); --top; break;
+
+        case Op::NEG: Unary(a, n, [](const T& x) { return T(-x); }); break;
+        case Op::SQRT: Unary(a, n, [](const T& x) { return T(sqrt(x)); }); break;
+        case Op::EXP: Unary(a, n, [](const T& x) { return T(exp(x)); }); break;
+        case Op::LOG: Unary(a, n, [](const T& x) { return T(log(x)); }); break;
+        case Op::LOG10: Unary(a, n, [](const T& x) { return T(log10(x)); }); break;
+        case Op::SIN: Unary(a, n, [](const T& x) { return T(sin(x)); }); break;
+        case Op::COS: Unary(a, n, [](const T& x) { return T(cos(x)); }); break;
+        case Op::TAN: Unary(a, n, [](const T& x) { return T(tan(x)); }); break;
+        case Op::ASIN: Unary(a, n, [](const T& x) { return T(asin(x)); }); break;
+        case Op::ACOS: Unary(a, n, [](const T& x) { return T(acos(x)); }); break;
+        case Op::ATAN: Unary(a, n, [](const T& x) { return T(atan(x)); }); break;
+        case Op::SINH: Unary(a, n, [](const T& x) { return T(sinh(x)); }); break;
+        case Op::COSH: Unary(a, n, [](const T& x) { return T(cosh(x)); }); break;
+        case Op::TANH: Unary(a, n, [](const T& x) { return T(tanh(x)); }); break;
+        case Op::ABS: Unary(a, n, [](const T& x) { return T(fabs(x)); }); break;
+      }
+    }
+  }
+
+  /*!
+   * \brief Evaluate the expression for one point.
+   * \param[in] symbol - Functor, symbol(iSymbol) returns the value of a symbol.
+   * \return Value of the expression.
+   */
+  template <class T, class Symbols>
+  T Eval(const Symbols& symbol) const {
+    std::array<T, MAX_DEPTH> work;
+    EvalBatch(1, 1, [&](unsigned iSymbol, size_t) { return symbol(iSymbol); }, work.data());
+    return work[0];
+  }
+};
@@ -0,0 +1,206 @@
+/*!
+ * \file CTimeStatistics.hpp
+ * \brief Header of the streaming time statistics (means, fluctuations, phase averages, spectra).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../../../Common/include/containers/C2DContainer.hpp"
+
+/*!
+ * \class CTimeStatistics
+ * \brief Statistics of point quantities updated once per time step: means and (co)variances with Welford's
+ *        algorithm, phase averages over a period, and Fourier coefficients at some frequencies (running DFT).
+ * \details Each statistic of each quantity is a contiguous row (over the points) of one matrix. The whole state,
+ * including the sample counters, can be saved and restored as fields of a restart to continue the statistics.
+ */
+class CTimeStatistics {
+ public:
+  using Pair = std::pair<unsigned short, unsigned short>;
+
+ private:
+  unsigned long nPoint = 0;
+  unsigned short nQuantity = 0;
+  std::vector<std::string> quantityNames;
+  std::vector<Pair> pairs;                     /*!< \brief Quantities of the covariances. */
+  unsigned long nPhase = 0, period = 0;        /*!< \brief Phase bins, and period in time iterations. */
+  std::vector<passivedouble> frequencies;      /*!< \brief Frequencies of the Fourier coefficients. */
+
+  unsigned long nSample = 0;                   /*!< \brief Number of time steps. */
+  unsigned long lastIter = 0;                  /*!< \brief Last time iteration (valid if nSample > 0). */
+  unsigned long phase = 0;                     /*!< \brief Phase bin of the current step. */
+  std::vector<unsigned long> nPhaseSample;     /*!< \brief Number of time steps per phase bin. */
+  std::vector<passivedouble> cosine, sine;     /*!< \brief DFT weights of the current step. */
+
+  /*!
+   * \brief Rows: means, sums of squared deviations, co-moments, phase means (per phase and quantity),
+   *        real and imaginary parts of the DFT (per frequency and quantity). Columns: points.
+   */
+  su2passivematrix state;
+
+  inline unsigned long MeanRow(unsigned short q) const { return q; }
+  inline unsigned long M2Row(unsigned short q) const { return nQuantity + q; }
+  inline unsigned long CoMomentRow(unsigned long c) const { return 2ul * nQuantity + c; }
+  inline unsigned long PhaseRow(unsigned long p, unsigned short q) const {
+    return 2ul * nQuantity + pairs.size() + p * nQuantity + q;
+  }
+  inline unsigned long FourierRow(unsigned long f, unsigned short q) const {
+    return 2ul * nQuantity + pairs.size() + (nPhase + 2 * f) * nQuantity + q;
+  }
+  inline unsigned long nStateRows() const { return FourierRow(frequencies.size(), 0); }
+
+ public:
+  /*!
+   * \brief Allocate the statistics (all set to zero).
+   * \param[in] numPoints - Number of points.
+   * \param[in] names - Names of the quantities (used to name the fields of the state).
+   * \param[in] covariances - Pairs of quantities (indices) whose covariances are needed.
+   * \param[in] numPhases - Number of phase bins (0 for no phase averages).
+   * \param[in] periodIters - Period of the phase averages in time iterations.
+   * \param[in] freqs - Frequencies of the Fourier coefficients.
+   */
+  void Initialize(unsigned long numPoints, std::vector<std::string> names, std::vector<Pair> covariances,
+                  unsigned long numPhases, unsigned long periodIters, std::vector<passivedouble> freqs);
+
+  /*!
+   * \brief Whether the statistics have been allocated.
+   */
+  inline bool IsInitialized() const { return nQuantity > 0; }
+
+  /*!
+   * \brief Start a new time step, the values of all points must then be added with Update.
+   * \param[in] timeIter - Time iteration.
+   * \param[in] time - Physical time (for the Fourier coefficients).
+   * \return False if this time iteration was already added (then Update must not be called).
+   */
+  bool BeginStep(unsigned long timeIter, passivedouble time);
+
+  /*!
+   * \brief Add the values of the quantities at a point to the statistics of the current time step.
+   * \param[in] iPoint - Point.
+   * \param[in] values - Values of the quantities.
+   */
+  template <class T>
+  inline void Update(unsigned long iPoint, const T* values) {
+    const passivedouble scale = passivedouble(nSample - 1) / nSample;
+
+    /*--- Co-moments first, with the deviations from the old means. ---*/
+    for (auto c = 0ul; c < pairs.size(); ++c) {
+      const auto a = pairs[c].first, b = pairs[c].second;
+      state(CoMomentRow(c), iPoint) += scale * (SU2_TYPE::GetValue(values[a]) - state(MeanRow(a), iPoint)) *
+                                               (SU2_TYPE::GetValue(values[b]) - state(MeanRow(b), iPoint));
+    }
+    for (unsigned short q = 0; q < nQuantity; ++q) {
+      const passivedouble x = SU2_TYPE::GetValue(values[q]);
+      const passivedouble delta = x - state(MeanRow(q), iPoint);
+      state(MeanRow(q), iPoint) += delta / nSample;
+      state(M2Row(q), iPoint) += scale * delta * delta;
+
+      if (nPhase > 0) {
+        auto& phaseMean = state(PhaseRow(phase, q), iPoint);
+        phaseMean += (x - phaseMean) / nPhaseSample[phase];
+      }
+      for (auto f = 0ul; f < frequencies.size(); ++f) {
+        state(FourierRow(f, q), iPoint) += x * cosine[f];
+        state(FourierRow(f, q) + nQuantity, iPoint) -= x * sine[f];
+      }
+    }
+  }
+
+  /*!
+   * \brief Number of time steps in the statistics.
+   */
+  inline unsigned long GetnSample() const { return nSample; }
+
+  /*!
+   * \brief Number of covariances.
+   */
+  inline unsigned long GetnCovariance() const { return pairs.size(); }
+
+  /*!
+   * \brief Number of phase bins.
+   */
+  inline unsigned long GetnPhase() const { return nPhase; }
+
+  /*!
+   * \brief Number of frequencies.
+   */
+  inline unsigned long GetnFrequency() const { return frequencies.size(); }
+
+  /*!
+   * \brief Mean of quantity q at a point.
+   */
+  inline passivedouble GetMean(unsigned short q, unsigned long iPoint) const { return state(MeanRow(q), iPoint); }
+
+  /*!
+   * \brief Variance of quantity q at a point (biased, i.e. the mean of the squared fluctuations).
+   */
+  inline passivedouble GetVariance(unsigned short q, unsigned long iPoint) const {
+    return nSample > 0 ? state(M2Row(q), iPoint) / nSample : 0.0;
+  }
+
+  /*!
+   * \brief Covariance c (in the order of the pairs given to Initialize) at a point (biased).
+   */
+  inline passivedouble GetCovariance(unsigned long c, unsigned long iPoint) const {
+    return nSample > 0 ? state(CoMomentRow(c), iPoint) / nSample : 0.0;
+  }
+
+  /*!
+   * \brief Mean of quantity q at a point over the time steps of phase bin p.
+   */
+  inline passivedouble GetPhaseMean(unsigned long p, unsigned short q, unsigned long iPoint) const {
+    return state(PhaseRow(p, q), iPoint);
+  }
+
+  /*!
+   * \brief Amplitude of the (non-zero) frequency f in the signal of quantity q at a point.
+   * \note Exact for harmonic signals when the statistics cover a whole number of periods.
+   */
+  passivedouble GetAmplitude(unsigned long f, unsigned short q, unsigned long iPoint) const;
+
+  /*!
+   * \brief Names of the fields of the state, the last ones are the counters (the same at all points).
+   */
+  std::vector<std::string> GetStateNames() const;
+
+  /*!
+   * \brief Get a field of the state at a point.
+   */
+  passivedouble GetState(unsigned long iField, unsigned long iPoint) const;
+
+  /*!
+   * \brief Set a field of the state at a point (the counters are set by any point).
+   */
+  void SetState(unsigned long iField, unsigned long iPoint, passivedouble value);
+
+  /*!
+   * \brief Last time iteration in the statistics (valid if GetnSample() > 0).
+   */
+  inline unsigned long GetLastIter() const { return lastIter; }
+};
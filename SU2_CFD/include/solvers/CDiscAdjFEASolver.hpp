@@ -39,6 +39,10 @@
 class CDiscAdjFEASolver final : public CSolver {
 private:
   static constexpr size_t MAXNVAR = 9;  /*!< \brief Max number of variables, for static arrays. */
+  static constexpr size_t OMP_MAX_SIZE = 1024; /*!< \brief Max chunk size for light point loops. */
+
+  unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
+
   unsigned short KindDirect_Solver = 0;
   CSolver *direct_solver = nullptr;
 
@@ -188,6 +192,11 @@ public:
    */
   void SetSensitivity(CGeometry *geometry, CConfig *config, CSolver*) override;
 
+  /*!
+   * \brief The adjoint methods are thread-parallel, independently of the direct solver.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
   /*!
    * \brief Provide the total Young's modulus sensitivity
    * \return Value of the total Young's modulus sensitivity
@@ -29,6 +29,7 @@
 
 #include "CFVMFlowSolverBase.hpp"
 #include "../variables/CEulerVariable.hpp"
+#include "CJacobianLag.hpp"
 
 /*!
  * \class CEulerSolver
@@ -105,6 +106,8 @@ protected:
   End_AoA_FD = false,         /*!< \brief Boolean for end of finite differencing for FixedCL mode */
   Update_AoA = false;         /*!< \brief Boolean to signal Angle of Attack Update */
   unsigned long Iter_Update_AoA = 0; /*!< \brief Iteration at which AoA was updated last */
+
+  CJacobianLag JacobianLag;           /*!< \brief Decides when the lagged edge Jacobian is assembled. */
   su2double dCL_dAlpha;              /*!< \brief Value of dCL_dAlpha used to control CL in fixed CL mode */
   unsigned long BCThrust_Counter;
 
@@ -238,6 +241,24 @@ protected:
    */
   void SetCentered_Dissipation_Sensor(CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Compute the max eigenvalue, the dissipation sensor, and optionally the undivided laplacian
+   *        in one loop over the neighbors of the points (JST schemes).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] laplacian - Whether to compute the undivided laplacian.
+   */
+  void SetCentered_Dissipation_Fused(CGeometry *geometry, const CConfig *config, bool laplacian);
+
+  /*!
+   * \brief Decide if the edge Jacobian is lagged (not assembled) in the current iteration, see JACOBIAN_LAG.
+   * \note It is assembled every JACOBIAN_LAG iterations, at the start of time steps, when the residual increases,
+   *       or when the average CFL changes by more than JACOBIAN_LAG_CFL_FACTOR since the last assembly.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the edge loop only computes residuals.
+   */
+  bool LagEdgeJacobian(const CConfig *config);
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition.
@@ -245,14 +266,45 @@ protected:
    */
   inline virtual void SetRoe_Dissipation(CGeometry *geometry, CConfig *config) { }
 
+  /*!
+   * \brief Whether the fluid model is in closed form, then the point-wise closures of SetPrimitive_Variables
+   *        are preaccumulated (models with internal iterations may reuse their state from previous points).
+   */
+  static bool ClosedFormFluidModel(const CConfig* config) {
+    const auto model = config->GetKind_FluidModel();
+    return model == STANDARD_AIR || model == IDEAL_GAS || model == VW_GAS || model == PR_GAS;
+  }
+
+  /*!
+   * \brief Compute the JST residual as an external function of the AD tape, whose reverse uses the
+   *        hand-differentiated flux (CJSTAdjointKernel) instead of the recorded edge loop.
+   * \note Only when requested (ADJOINT_FLUX_KERNEL_DISC), on the fine grid of inviscid problems with static grids,
+   *       and with edge coloring.
+   * \return False if these conditions are not met, then the residual must be computed as usual.
+   */
+  bool CenteredResidualExternal(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                unsigned short iMesh);
+
+#ifdef CODI_REVERSE_TYPE
+  /*!
+   * \brief Reverse of the external function of CenteredResidualExternal.
+   */
+  template<size_t nDim>
+  static void CenteredResidual_b(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                                 const su2double::Real* y, const su2double::Real* y_b, size_t n,
+                                 codi::ExternalFunctionUserData* d);
+#endif
+
   /*!
    * \brief Compute the velocity^2, SoundSpeed, Pressure, Enthalpy, Viscosity.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] zeroResidual - Also zero the residual of the points.
    * \return - The number of non-physical points.
    */
   virtual unsigned long SetPrimitive_Variables(CSolver **solver_container,
-                                               const CConfig *config);
+                                               const CConfig *config,
+                                               bool zeroResidual = false);
 
   /*!
    * \brief Set gradients of coefficients for fixed CL mode
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CFEASolverBase.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 /*!
  * \class CFEASolver
@@ -55,6 +56,8 @@ protected:
   su2double WAitken_Dyn;            /*!< \brief Aitken's dynamic coefficient. */
   su2double WAitken_Dyn_tn1;        /*!< \brief Aitken's dynamic coefficient in the previous iteration. */
 
+  CQuasiNewtonInvLeastSquares<passivedouble> QNRelaxation; /*!< \brief Quasi-Newton accelerator of the FSI coupling. */
+
   su2double PenaltyValue;           /*!< \brief Penalty value to maintain total stiffness constant. */
 
   su2double Total_OFRefGeom;        /*!< \brief Total Objective Function: Reference Geometry. */
@@ -77,6 +80,31 @@ protected:
   CSysVector<su2double> TimeRes;      /*!< \brief Vector for adding mass and damping contributions to the residual */
   CSysVector<su2double> LinSysReact;  /*!< \brief Vector to store the residual before applying the BCs */
 
+  /*--- Reuse of the tangent (MODIFIED_NEWTON_RAPHSON and BFGS), see RequiresTangentUpdate. ---*/
+  static constexpr unsigned long MAX_BFGS_PAIRS = 16;  /*!< \brief Max number of pairs stored by BFGS. */
+
+  bool tangent_updated = false;       /*!< \brief Whether the tangent was computed in the current iteration. */
+  unsigned long tangent_age = 0;      /*!< \brief Number of solves with the current tangent, 0 if never computed. */
+  su2double res_norm_prev = 0.0;      /*!< \brief Norm of the residual of the previous iteration. */
+  su2double res_ratio = 0.0;          /*!< \brief Ratio between the last two residual norms, 0 in the first iteration. */
+
+  unsigned long bfgs_nPairs = 0;      /*!< \brief Number of stored BFGS pairs. */
+  unsigned long bfgs_head = 0;        /*!< \brief Position of the oldest pair in the ring buffer. */
+  vector<CSysVector<su2double> > bfgs_s, bfgs_y;  /*!< \brief Steps and residual changes of previous iterations. */
+  su2double bfgs_rho[MAX_BFGS_PAIRS] = {0.0};     /*!< \brief Inverse of s.y for each pair. */
+  CSysVector<su2double> bfgs_res;     /*!< \brief Residual of the previous iteration. */
+  CSysVector<su2double> bfgs_step;    /*!< \brief Step of the previous iteration. */
+
+  /*--- Modal superposition (MODAL_SUPERPOSITION), see Modal_Iteration. ---*/
+  bool modal = false;                             /*!< \brief Whether the structure is solved with its modes. */
+  vector<CSysVector<su2double> > modeShapes;      /*!< \brief Mass normalized mode shapes. */
+  vector<CSysVector<su2double> > massModes;       /*!< \brief Mass matrix times the mode shapes. */
+  vector<su2double> modeOmega;                    /*!< \brief Angular frequencies of the modes. */
+  vector<su2double> modalDisp, modalVel, modalAccel;       /*!< \brief Modal coordinates and their derivatives. */
+  vector<su2double> modalDisp_n, modalVel_n, modalAccel_n; /*!< \brief Same at the previous time step. */
+  unsigned long modalTimeIter = 0;                /*!< \brief Time iteration of the modal state (_n). */
+  bool modalStateReady = false;                   /*!< \brief Whether the modal state (_n) was set. */
+
 #ifndef CODI_FORWARD_TYPE
   CSysMatrix<su2mixedfloat> MassMatrix;   /*!< \brief Sparse structure for storing the mass matrix. */
 #else
@@ -214,6 +242,37 @@ protected:
    */
   void Compute_OFCompliance(CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Read or compute the structural modes, normalize them with the mass matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetModes(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
+  /*!
+   * \brief Compute the lowest structural modes by subspace iteration, with the essential BCs.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeModes(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
+  /*!
+   * \brief Read the structural modes from MODAL_FILENAME.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the file does not exist.
+   */
+  bool ReadModes(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Write the structural modes to MODAL_FILENAME.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WriteModes(CGeometry *geometry, const CConfig *config) const;
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -324,6 +383,14 @@ public:
                               CNumerics **numerics,
                               const CConfig *config) final;
 
+  /*!
+   * \brief Decide if the tangent stiffness matrix needs to be updated, always for Newton-Raphson, otherwise
+   *        based on its age and on the reduction of the residual (see NONLINEAR_FEM_TANGENT_REUSE/REFRESH).
+   * \param[in] config - Definition of the particular problem.
+   * \return Whether the tangent needs to be updated in this iteration.
+   */
+  bool RequiresTangentUpdate(const CConfig *config) const final;
+
   /*!
    * \brief Compute the stress at the nodes for output purposes.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -489,8 +556,18 @@ public:
    */
   void Postprocessing(CGeometry *geometry, CConfig *config, CNumerics **numerics, bool of_comp_mode) final;
 
+  /*!
+   * \brief Solve the structure by superposition of its modes, instead of the time integration and linear solve.
+   * \note The modes are set in the first call, the loads are then projected on them at each iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Modal_Iteration(CGeometry *geometry, CNumerics **numerics, const CConfig *config) final;
+
   /*!
    * \brief Routine to solve the Jacobian-Residual linearized system.
+   * \note With BFGS the solve with the (reused) tangent is wrapped by the two-loop recursion.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -658,6 +735,13 @@ public:
    */
   void SetAitken_Relaxation(CGeometry *geometry, const CConfig *config) final;
 
+  /*!
+   * \brief Interface quasi-Newton (IQN-ILS) update of the predicted solution, used by SetAitken_Relaxation
+   *        for BGS_RELAXATION= QUASI_NEWTON.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetQuasiNewton_Relaxation(const CConfig *config);
+
   /*!
    * \brief Compute the penalty due to the stiffness increase
    * \param[in] geometry - Geometrical definition of the problem.
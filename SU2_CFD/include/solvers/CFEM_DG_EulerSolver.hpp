@@ -29,6 +29,10 @@
 #pragma once
 
 #include "CSolver.hpp"
+#ifdef HAVE_CUDA
+#include <memory>
+#include "CGPUDGVolumeWrapper.hpp"
+#endif
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -44,6 +48,7 @@ protected:
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
   CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModelThreads; /*!< \brief Copies of the fluid model for the other OpenMP threads. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -176,6 +181,32 @@ protected:
   vector<su2double> VecSolDOFs;    /*!< \brief Vector, which stores the solution variables in the owned DOFs. */
   vector<su2double> VecSolDOFsNew; /*!< \brief Vector, which stores the new solution variables in the owned DOFs (needed for classical RK4 scheme). */
   vector<su2double> VecDeltaTime;  /*!< \brief Vector, which stores the time steps of the owned volume elements. */
+  vector<su2double> VecSpectralRadius; /*!< \brief Vector, which stores the inverse of the time steps for CFL = 1 of the
+                                                   owned volume elements, an estimate of the spectral radius of the
+                                                   spatial Jacobian used to precondition the implicit scheme. */
+
+  /*--- Data of the implicit (BDF) time integration with a Jacobian-free Newton-Krylov method. ---*/
+  bool availableSolTimeNm1 = false;      /*!< \brief Whether the solution of time level n-1 is available (BDF2). */
+  su2double finDiffStepImplicit = 0.0;   /*!< \brief Finite difference step of the matrix-free products. */
+  vector<su2double> VecDeltaTimeNm1;     /*!< \brief Time steps of the owned volume elements for time level n-1. */
+  vector<su2double> VecTimeCoefImplicit; /*!< \brief Diagonal coefficient (a0/dt) of the time derivative of the owned elements. */
+  CSysVector<su2double> ImplicitSolTimeN;   /*!< \brief Solution of the owned DOFs at time level n. */
+  CSysVector<su2double> ImplicitSolTimeNm1; /*!< \brief Solution of the owned DOFs at time level n-1. */
+  CSysVector<su2double> ImplicitResBase;    /*!< \brief Spatial residual (times the inverse mass matrix) of the Newton iterate. */
+  CSysVector<su2double> ImplicitRHS;        /*!< \brief Minus the unsteady residual of the Newton iterate. */
+  CSysVector<su2double> ImplicitDeltaSol;   /*!< \brief Newton update of the solution. */
+  CSysSolve<su2double> ImplicitLinSolver;   /*!< \brief Krylov solver of the Newton iterations. */
+
+  class CImplicitJacobianProduct; /*!< \brief Matrix-free product with the Jacobian of the implicit scheme. */
+  class CImplicitPreconditioner;  /*!< \brief Element-block-Jacobi preconditioner of the implicit scheme. */
+
+  /*--- Data of the p-multigrid cycle for steady problems. The coarse levels use the same elements
+        with a lower polynomial degree, their solutions are stored in the DOFs of the finest level. ---*/
+  vector<vector<vector<su2double> > > PMGProjection; /*!< \brief Projection matrices onto the polynomials of each coarse
+                                                                 level, [level-1][standard element], empty for identity. */
+  vector<vector<su2double> > PMGForcing;    /*!< \brief FAS forcing terms of the coarse levels, [level-1]. */
+  vector<vector<su2double> > PMGSolSaved;   /*!< \brief Solution of the levels before visiting the next coarse level. */
+  vector<su2double> PMGResLevel;            /*!< \brief Residual of the current level. */
 
   vector<su2double> VecSolDOFsPredictorADER; /*!< \brief Vector, which stores the ADER predictor solution in the owned
                                                          DOFs. These are both space and time DOFs. */
@@ -231,6 +262,78 @@ protected:
 
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
+#ifdef HAVE_CUDA
+  std::unique_ptr<CGPUDGVolumeWrapper> gpuVolume; /*!< \brief Device data for the volume residual (FEM_DG_GPU). */
+  vector<su2double> gpuSolDOFs;                   /*!< \brief Host staging array for the solution of the DOFs. */
+  vector<su2double> gpuResDOFs;                   /*!< \brief Host staging array for the volume residual. */
+
+  /*!
+   * \brief Function, which uploads the data of the owned volume elements to the device.
+   */
+  void InitializeGPUVolume();
+
+  /*!
+   * \brief Function, which computes the volume residual of a range of owned elements on the device.
+   * \param[in] elemBeg - Begin index of the element range to be computed.
+   * \param[in] elemEnd - End index (not included) of the element range to be computed.
+   */
+  void Volume_Residual_GPU(const unsigned long elemBeg, const unsigned long elemEnd);
+#endif
+
+  /*!
+   * \brief Function, which computes the projection matrices of the coarse levels of the p-multigrid cycle.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializePMultigrid(CConfig *config);
+
+  /*!
+   * \brief Function, which projects a vector of the owned DOFs onto the polynomials of a p-multigrid level.
+   * \param[in]  iLevel - p-multigrid level, 0 is the finest level (identity).
+   * \param[in]  vecIn  - Vector to be projected.
+   * \param[out] vecOut - Projected vector, it may not be the same as vecIn.
+   * \param[in]  config - Definition of the particular problem.
+   */
+  void PMGProject(const unsigned short iLevel, const su2double *vecIn, su2double *vecOut, const CConfig *config);
+
+  /*!
+   * \brief Function, which computes the residual of a p-multigrid level, i.e. the projection of the
+            residual of the finest level plus the forcing term, for the solution in VecWorkSolDOFs[0].
+            The result is stored in PMGResLevel.
+   * \param[in] iLevel - p-multigrid level.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void PMGResidual(const unsigned short iLevel, CGeometry *geometry, CSolver **solver_container,
+                   CNumerics **numerics, CConfig *config, const unsigned short iMesh);
+
+  /*!
+   * \brief Function, which carries out Runge-Kutta iterations on a p-multigrid level.
+   * \param[in] iLevel - p-multigrid level.
+   * \param[in] nIter - Number of Runge-Kutta iterations.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void PMGSmooth(const unsigned short iLevel, const unsigned short nIter, CGeometry *geometry,
+                 CSolver **solver_container, CNumerics **numerics, CConfig *config, const unsigned short iMesh);
+
+  /*!
+   * \brief Function, which carries out the V-cycle of the p-multigrid method starting at the given level.
+   * \param[in] iLevel - p-multigrid level.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void PMGCycleLevel(const unsigned short iLevel, CGeometry *geometry, CSolver **solver_container,
+                     CNumerics **numerics, CConfig *config, const unsigned short iMesh);
+
 private:
 
 #ifdef HAVE_MPI
@@ -321,10 +424,13 @@ public:
   inline unsigned long GetnDOFsGlobal(void) const final { return nDOFsGlobal; }
 
   /*!
-   * \brief Compute the pressure at the infinity.
-   * \return Value of the pressure at the infinity.
+   * \brief Get the fluid model of the calling OpenMP thread.
+   * \return Pointer to the fluid model.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final {
+    const int thread = omp_get_thread_num();
+    return thread ? FluidModelThreads[thread-1] : FluidModel;
+  }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -463,6 +569,41 @@ public:
                                  unsigned short iMesh,
                                  unsigned short RunTime_EqSystem) final;
 
+  /*!
+   * \brief Function, to carry out one time step of the implicit BDF scheme (first
+            order with local time steps for steady problems). The nonlinear system
+            is solved with a Jacobian-free Newton-Krylov method.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void Implicit_SpaceTimeIntegration(CGeometry      *geometry,
+                                     CSolver        **solver_container,
+                                     CNumerics      **numerics,
+                                     CConfig        *config,
+                                     unsigned short iMesh,
+                                     unsigned short RunTime_EqSystem) final;
+
+  /*!
+   * \brief Function, to carry out one full approximation scheme V-cycle of the
+            p-multigrid method for steady problems. The coarse levels use lower
+            polynomial degrees on the same elements and are smoothed with the
+            Runge-Kutta scheme with local time steps.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void PMultigrid_Cycle(CGeometry      *geometry,
+                        CSolver        **solver_container,
+                        CNumerics      **numerics,
+                        CConfig        *config,
+                        unsigned short iMesh,
+                        unsigned short RunTime_EqSystem) final;
+
   /*!
    * \brief Function, which controls the computation of the spatial Jacobian.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1262,6 +1403,22 @@ protected:
   void Initiate_MPI_ReverseCommunication(CConfig *config,
                                          const unsigned short timeLevel);
 
+  /*!
+   * \brief Function, which carries out a single task of the list of tasks.
+   * \param[in]     task         - Task to be carried out.
+   * \param[in]     config       - Definition of the particular problem.
+   * \param[in]     numerics     - Description of the numerical method (of the calling thread).
+   * \param[in]     waitForComm  - Whether or not a communication must be completed (blocking).
+   * \param[in,out] workArray    - Work array (of the calling thread).
+   * \return  Whether or not the task has been carried out, only the completion of a
+                communication may fail.
+   */
+  bool CarryOutTask_DG(const CTaskDefinition &task,
+                       CConfig               *config,
+                       CNumerics             **numerics,
+                       const bool            waitForComm,
+                       su2double             *workArray);
+
   /*!
    * \brief Routine that completes the non-blocking communication between ranks.
    * \param[in] config              - Definition of the particular problem.
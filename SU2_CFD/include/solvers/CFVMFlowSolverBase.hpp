@@ -28,6 +28,8 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../numerics_simd/CEdgeGeometryCache.hpp"
+#include "../numerics_simd/CVertexGeometryCache.hpp"
 #include "CSolver.hpp"
 
 class CNumericsSIMD;
@@ -198,10 +200,12 @@ class CFVMFlowSolverBase : public CSolver {
 #ifdef HAVE_OMP
   vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
   bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
+  bool OwnerStrategy = false;        /*!< \brief If the vectorized edge loop uses the owner computes strategy. */
 #else
   array<DummyGridColor<>, 1> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
+  static constexpr bool OwnerStrategy = false;
 #endif
 
   /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids.
@@ -212,7 +216,36 @@ class CFVMFlowSolverBase : public CSolver {
 
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  /*--- Owner computes alternative to the reducer strategy for the vectorized edge loop (EDGE_COLORING_FALLBACK).
+   * Each thread owns a contiguous range of points and computes all the edges of its points, updating only
+   * the rows of its points. The edges between points of different threads are computed by both threads.
+   * For each owner there are 3 lists of edges, those with both points owned, and those where only the
+   * point i, or only the point j, is owned. ---*/
+
+  vector<unsigned long> OwnerEdgeIdx; /*!< \brief Edges of the lists of all the owners. */
+  vector<unsigned long> OwnerEdgePtr; /*!< \brief Start of the 3 lists of each owner in OwnerEdgeIdx. */
+
+  /*--- Edges of each color split into those that only touch domain points and those that touch halo points,
+   * to overlap a halo exchange (see CSolver::DeferComms) with the computation of the interior edges.
+   * The split is done at the level of color groups to keep the coloring thread-safe. ---*/
+
+  bool CommOverlap = false;                  /*!< \brief If the halo exchange of the limiters is overlapped. */
+  vector<unsigned long> OverlapEdgeIdx;      /*!< \brief Storage for the split edge colors. */
+  vector<GridColor<> > InteriorEdgeColoring; /*!< \brief Edges that only touch domain points. */
+  vector<GridColor<> > HaloEdgeColoring;     /*!< \brief Edges that touch halo points. */
+
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
+  CEdgeGeometryCache EdgeGeometry;       /*!< \brief Geometry of the edges in the order of the SIMD edge loop. */
+  CBoundaryNumericsSIMD* farfieldNumerics = nullptr; /*!< \brief Object for far-field flux computation. */
+  vector<CVertexGeometryCache> VertexGeometry;       /*!< \brief Vertices of the markers with vectorized BCs. */
+
+  /*--- Multirate time stepping of the explicit time-accurate schemes (LEVELS_TIME_ACCURATE_LTS), see SetTimeLevels.
+   * The time step is divided in sub steps of the smallest local time step, the points of level l are updated every
+   * 2^l sub steps, and the edges are computed at the rate of their finest point. ---*/
+
+  vector<uint8_t> TimeLevel;         /*!< \brief Time level of each point (including halos), empty if not used. */
+  su2activematrix TimeLevelResidual; /*!< \brief Residual accumulated over the current time step of each point. */
+  unsigned long TimeSubStep = 0;     /*!< \brief Current sub step of the time step. */
 
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
@@ -257,12 +290,96 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void HybridParallelInitialization(const CConfig& config, CGeometry& geometry);
 
+  /*!
+   * \brief Split the edge colors into interior and halo-adjacent sets, for COMM_OVERLAP.
+   */
+  void SetupCommOverlap(const CConfig& config, const CGeometry& geometry);
+
+  /*!
+   * \brief Give a contiguous range of points to each thread and build the lists of edges of each one,
+   *        for the owner computes strategy.
+   */
+  void SetupOwnerComputes(const CGeometry& geometry);
+
+  /*!
+   * \brief Sum the force coefficients of all ranks (COMM_FULL only) with a single reduction, instead of one per
+   *        coefficient, and update the efficiencies and figures of merit.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] allBound - Coefficients of all the boundaries.
+   * \param[in,out] surface - Coefficients of the monitored boundaries.
+   * \param[in,out] scalars - Other values of all the boundaries that are also summed.
+   * \param[in,out] surfaceArrays - Other values of the monitored boundaries that are also summed.
+   */
+  static void AllreduceForces(const CConfig* config, AeroCoeffs& allBound, AeroCoeffsArray& surface,
+                              std::initializer_list<su2double*> scalars = {},
+                              std::initializer_list<su2double*> surfaceArrays = {});
+
+  /*!
+   * \brief Call "func(iEdge)" for all edges of a set of colors, in parallel.
+   * \return 0, the first pack is only used by the SIMD version.
+   */
+  template <class ColorsType, class F>
+  static unsigned long ColorLoop(const ColorsType& colors, const F& func, std::false_type, unsigned long = 0) {
+    for (const auto& color : colors) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) func(color.indices[k]);
+      END_SU2_OMP_FOR
+    }
+    return 0;
+  }
+
+  /*!
+   * \brief Call "func(iEdge, mask, iPack)" for all packs of SIMD-length edges of a set of colors, in parallel.
+   * \note The mask is 0 for the padding lanes of the last pack of each color. The packs are numbered
+   *       consecutively from firstPack in the order of the colors (see CEdgeGeometryCache).
+   * \return Index of the pack after the last one of the colors.
+   */
+  template <class ColorsType, class F>
+  static unsigned long ColorLoop(const ColorsType& colors, const F& func, std::true_type, unsigned long firstPack = 0);
+
+  /*!
+   * \brief Loop over the edges (by color) for the computation of residuals. If a halo exchange is in flight
+   *        (see CSolver::DeferComms) the edges that only touch domain points are computed first, then the
+   *        exchange is completed, and finally the edges that touch halo points are computed.
+   * \note With COMM_OVERLAP the edges are always visited in this order, which the edge geometry cache follows.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] func - Called for each edge, or for each pack of edges if SIMD is true.
+   * \param[in] afterComms - Called after the deferred exchange is completed, before the halo edges.
+   */
+  template <bool SIMD = false, class F, class G = void (*)()>
+  void EdgeLoop(CGeometry* geometry, const CConfig* config, const F& func, const G& afterComms = [](){}) {
+    const std::integral_constant<bool, SIMD> simd{};
+
+    if (!CommOverlap) {
+      ColorLoop(EdgeColoring, func, simd);
+      return;
+    }
+    const auto nInteriorPack = ColorLoop(InteriorEdgeColoring, func, simd);
+    if (HasDeferredComms()) {
+      CompleteDeferredComms(geometry, config);
+      afterComms();
+    }
+    ColorLoop(HaloEdgeColoring, func, simd, nInteriorPack);
+  }
+
   /*!
    * \brief Move solution to previous time levels (for restarts).
    */
   void PushSolutionBackInTime(unsigned long TimeIter, bool restart, bool rans, CSolver*** solver_container,
                               CGeometry** geometry, CConfig* config);
 
+  /*!
+   * \brief Set the initial guess of a new time step to the linear extrapolation of time levels n and n-1.
+   * \note Must be called inside a parallel region. The solution at time n is kept in Solution_Old, such that
+   *       non-physical extrapolated states revert to it when the primitive variables are computed.
+   *       The turbulence variables are extrapolated too, except where that would change their sign.
+   * \param[in] rans - Whether the turbulence solver is also extrapolated.
+   * \param[in] solver_container - Container vector with all the solutions.
+   */
+  void ExtrapolateSolutionInTime(bool rans, CSolver*** solver_container);
+
   /*!
    * \brief Evaluate common part of objective function to all solvers.
    */
@@ -271,27 +388,75 @@ class CFVMFlowSolverBase : public CSolver {
   /*!
    * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
    */
-  void EdgeFluxResidual(const CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
    */
   void SumEdgeFluxes(const CGeometry* geometry);
 
+  /*!
+   * \brief Whether the multirate time stepping is used (time accurate local time stepping of the explicit Euler scheme).
+   */
+  static bool MultirateTimeStepping(const CConfig* config) {
+    return (config->GetnLevels_TimeAccurateLTS() > 1) && (config->GetKind_TimeIntScheme() == EULER_EXPLICIT) &&
+           (config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING);
+  }
+
+  /*!
+   * \brief Group the points in time levels for multirate time stepping, the time step of level l is 2^l times the
+   *        smallest local time step, and the levels of neighbor points differ at most by one.
+   * \note The local time steps (Delta_Time) are the input, they are replaced by the time steps of the levels.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetTimeLevels(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Weight the edges of a SIMD pack for the current sub step of the multirate time stepping, the weight of an
+   *        edge is its time step relative to the sub step, or 0 if it is not computed in this sub step.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iEdge - Edges of the pack.
+   * \param[in,out] mask - Update mask of the pack, multiplied by the weights.
+   * \return False if no edge of the pack is computed.
+   */
+  FORCEINLINE bool TimeLevelMask(const CGeometry *geometry, const simd::Array<unsigned long, Double::Size>& iEdge,
+                                 Double& mask) {
+    bool any = false;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      /*--- Padding lanes (mask 0) may repeat an edge of the pack. ---*/
+      if (mask[j] == 0.0) continue;
+      const auto level = min(TimeLevel[geometry->edges->GetNode(iEdge[j], 0)],
+                             TimeLevel[geometry->edges->GetNode(iEdge[j], 1)]);
+      const auto period = 1ul << level;
+      if (TimeSubStep % period == 0) {
+        mask[j] *= period;
+        any = true;
+      } else {
+        mask[j] = 0.0;
+        /*--- The stored flux of an edge that is not computed must not be summed again. ---*/
+        if (ReducerStrategy) EdgeFluxes.SetBlock_Zero(iEdge[j]);
+      }
+    }
+    return any;
+  }
+
   /*!
    * \brief Sums edge fluxes (if required) and computes the global error counter.
    * \param[in] pausePreacc - Whether preaccumulation was paused durin.
    * \param[in] localCounter - Thread-local error counter.
    * \param[in,out] config - Used to set the global error counter.
+   * \param[in] sumEdgeFluxes - False if the loop did not store edge fluxes despite the reducer strategy.
    */
   inline void FinalizeResidualComputation(const CGeometry *geometry, bool pausePreacc,
-                                          unsigned long localCounter, CConfig* config) {
+                                          unsigned long localCounter, CConfig* config,
+                                          bool sumEdgeFluxes = true) {
 
     /*--- Restore preaccumulation and adjoint evaluation state. ---*/
     AD::ResumePreaccumulation(pausePreacc);
     if (!ReducerStrategy) AD::EndNoSharedReading();
 
-    if (ReducerStrategy) {
+    if (ReducerStrategy && sumEdgeFluxes) {
       SumEdgeFluxes(geometry);
       if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
         Jacobian.SetDiagonalAsColumnSum();
@@ -315,6 +480,22 @@ class CFVMFlowSolverBase : public CSolver {
     }
   }
 
+  /*!
+   * \brief Store the Jacobian after the edge loop assembles it, or restore it in the iterations that lag it
+   *        (JACOBIAN_LAG), in which the flux kernels only compute residuals.
+   * \note The other contributions (boundaries, sources, time step) are added to the restored matrix.
+   */
+  inline void StoreOrRestoreEdgeJacobian(const CConfig* config) {
+    if (MGLevel != MESH_0 || config->GetJacobian_Lag() < 2 ||
+        config->GetKind_TimeIntScheme() != EULER_IMPLICIT) return;
+
+    /*--- All the blocks must be complete before they are copied. ---*/
+    SU2_OMP_BARRIER
+
+    if (config->GetLagged_Jacobian_Iter()) Jacobian.CopyValues(JacobianLagged);
+    else JacobianLagged.CopyValues(Jacobian);
+  }
+
   /*!
    * \brief Computes and sets the required auxilliary vars (and gradients) for axisymmetric flow.
    */
@@ -547,6 +728,11 @@ class CFVMFlowSolverBase : public CSolver {
     /*--- For exact time solution use the minimum delta time of the whole mesh. ---*/
     if (time_stepping) {
 
+      /*--- With multirate time stepping the time step is that of the coarsest time level, and
+       *    the points advance with the time step of their level (from the local time step). ---*/
+
+      const bool multirate = MultirateTimeStepping(config) && (iMesh == MESH_0);
+
       /*--- If the unsteady CFL is set to zero, it uses the defined unsteady time step,
        *    otherwise it computes the time step based on the unsteady CFL. ---*/
 
@@ -555,6 +741,9 @@ class CFVMFlowSolverBase : public CSolver {
         if (config->GetUnst_CFL() == 0.0) {
           Global_Delta_Time = config->GetDelta_UnstTime();
         }
+        else if (multirate) {
+          Global_Delta_Time = Min_Delta_Time * (1ul << (config->GetnLevels_TimeAccurateLTS() - 1));
+        }
         else {
           Global_Delta_Time = Min_Delta_Time;
         }
@@ -569,10 +758,11 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
         nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
-        nodes->SetDelta_Time(iPoint, Global_Delta_Time);
+        if (!multirate) nodes->SetDelta_Time(iPoint, Global_Delta_Time);
       }
       END_SU2_OMP_FOR
 
+      if (multirate) SetTimeLevels(geometry, config);
     }
 
     /*--- Recompute the unsteady time step for the dual time strategy if the unsteady CFL is diferent from 0.
@@ -663,6 +853,20 @@ class CFVMFlowSolverBase : public CSolver {
     }
     END_SU2_OMP_FOR
 
+    SetMax_Eigenvalue_Boundary_impl(soundSpeed, geometry, config);
+  }
+
+  /*!
+   * \brief Add the boundary contributions to the max eigenvalue and communicate it, i.e. the part of
+   *        SetMax_Eigenvalue_impl that follows the loop over the neighbors of the domain points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \tparam SoundSpeedFunc - Function object to compute speed of sound, (nodes,iPoint) for vertices.
+   */
+  template<class SoundSpeedFunc>
+  FORCEINLINE void SetMax_Eigenvalue_Boundary_impl(const SoundSpeedFunc& soundSpeed, CGeometry *geometry,
+                                                   const CConfig *config) {
+
     /*--- Loop boundary edges ---*/
 
     for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
@@ -703,10 +907,7 @@ class CFVMFlowSolverBase : public CSolver {
 
     /*--- Correct the eigenvalue values across any periodic boundaries. ---*/
 
-    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-    }
+    PeriodicComms(geometry, config, PERIODIC_MAX_EIG);
 
     /*--- MPI parallelization ---*/
 
@@ -765,10 +966,7 @@ class CFVMFlowSolverBase : public CSolver {
     if (isPeriodic) {
       /*--- Correct the sensor values across any periodic boundaries. ---*/
 
-      for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-        InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-        CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-      }
+      PeriodicComms(geometry, config, PERIODIC_SENSOR);
 
       /*--- Set final pressure switch for each point ---*/
 
@@ -785,6 +983,56 @@ class CFVMFlowSolverBase : public CSolver {
 
   }
 
+  /*!
+   * \brief Central implicit residual smoothing of the explicit schemes, (1 - eps L) R_smooth = R, where L is the
+   *        Laplacian of the mesh graph, approximated with RESIDUAL_SMOOTHING_ITER Jacobi iterations.
+   * \note Uses the Residual_Old/Residual_Sum containers of the nodes, and communicates the residuals of the
+   *       halo points before each iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ImplicitResidualSmoothing(CGeometry *geometry, const CConfig *config) {
+
+    const auto nSmooth = config->GetResidual_Smoothing_Iter();
+    if (nSmooth == 0) return;
+
+    const su2double eps = config->GetResidual_Smoothing_Coeff();
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      nodes->SetResidual_Old(iPoint, LinSysRes.GetBlock(iPoint));
+    }
+    END_SU2_OMP_FOR
+
+    for (auto iSmooth = 0u; iSmooth < nSmooth; iSmooth++) {
+
+      CSysMatrixComms::Initiate(LinSysRes, geometry, config);
+      CSysMatrixComms::Complete(LinSysRes, geometry, config);
+
+      /*--- Sum the current iterate over the neighbors, then update, both loops synchronize the threads. ---*/
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        nodes->SetResidualSumZero(iPoint);
+        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+          nodes->AddResidual_Sum(iPoint, LinSysRes.GetBlock(jPoint));
+        }
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        const su2double factor = 1.0 / (1.0 + eps * geometry->nodes->GetnPoint(iPoint));
+        const su2double* residualOld = nodes->GetResidual_Old(iPoint);
+        const su2double* residualSum = nodes->GetResidual_Sum(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          LinSysRes(iPoint, iVar) = (residualOld[iVar] + eps * residualSum[iVar]) * factor;
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
   /*!
    * \brief Generic implementation of explicit iterations with a preconditioner.
    * \note The preconditioner is a functor implementing the methods:
@@ -808,6 +1056,9 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
     const su2double RK_TimeCoeff[] = {0.5, 0.5, 1.0, 1.0};
 
+    /*--- Multirate time stepping, each call is one sub step, see SetTimeLevels. ---*/
+    const bool multirate = (IntegrationType == EULER_EXPLICIT) && !TimeLevel.empty();
+
     /*--- Local residual variables for current thread ---*/
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
     unsigned long idxMax[MAXNVAR] = {0};
@@ -815,6 +1066,8 @@ class CFVMFlowSolverBase : public CSolver {
     /*--- Update the solution and residuals ---*/
 
     if (!adjoint) {
+      ImplicitResidualSmoothing(geometry, config);
+
       SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
@@ -824,6 +1077,21 @@ class CFVMFlowSolverBase : public CSolver {
         const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
         const su2double* Residual = LinSysRes.GetBlock(iPoint);
 
+        if (multirate) {
+          /*--- Accumulate the residual until the end of the time step of the level of the point,
+           *    and then update with its average (Delta_Time is already the time step of the level). ---*/
+          su2double* accumResidual = TimeLevelResidual[iPoint];
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) accumResidual[iVar] += Residual[iVar];
+
+          const auto period = 1ul << TimeLevel[iPoint];
+          if ((TimeSubStep + 1) % period != 0) continue;
+
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            LinSysRes(iPoint, iVar) = accumResidual[iVar] / period;
+            accumResidual[iVar] = 0.0;
+          }
+        }
+
         preconditioner.compute(config, iPoint);
 
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -867,6 +1135,10 @@ class CFVMFlowSolverBase : public CSolver {
       /*--- Reduce residual information over all threads in this rank. ---*/
       ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
+      if (multirate) {
+        const auto nSubStep = 1ul << (config->GetnLevels_TimeAccurateLTS() - 1);
+        SU2_OMP_SAFE_GLOBAL_ACCESS(TimeSubStep = (TimeSubStep + 1) % nSubStep;)
+      }
     }
 
     /*--- MPI solution ---*/
@@ -945,15 +1217,13 @@ class CFVMFlowSolverBase : public CSolver {
 
       /*--- Multigrid contribution to residual. ---*/
 
-      su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
-
       if (nodes->GetDelta_Time(iPoint) == 0.0) {
-        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-          LinSysRes(iPoint,iVar) = 0.0;
-          local_Res_TruncError[iVar] = 0.0;
-        }
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) LinSysRes(iPoint,iVar) = 0.0;
+        nodes->SetRes_TruncErrorZero(iPoint);
       }
 
+      const su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
+
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
         unsigned long total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
@@ -991,10 +1261,7 @@ class CFVMFlowSolverBase : public CSolver {
       END_SU2_OMP_FOR
     }
 
-    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-    }
+    PeriodicComms(geometry, config, PERIODIC_IMPLICIT);
 
     InitiateComms(geometry, config, SOLUTION);
     CompleteComms(geometry, config, SOLUTION);
@@ -1064,11 +1331,37 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Whether the reconstruction gradient and the limiter of the primitive variables can be
+   *        computed together by SetPrimitive_Gradient_Limiter, which is not possible with periodic
+   *        boundaries or with frozen limiters (discrete adjoint).
+   * \param[in] config - Definition of the particular problem.
+   */
+  static bool CanFuseGradientLimiter(const CConfig* config) {
+    return (config->GetnMarker_Periodic() == 0) &&
+           !(config->GetDiscrete_Adjoint() && config->GetFrozen_Limiter_Disc());
+  }
+
+  /*!
+   * \brief Compute the reconstruction gradient (method of NUM_METHOD_GRAD_RECON) and the limiter of the
+   *        primitive variables in one pass, with a single halo exchange (PRIMITIVE_RECONSTRUCTION).
+   * \note Equivalent to SetPrimitive_Gradient_GG/LS(geometry, config, true) and SetPrimitive_Limiter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
   void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) final;
 
+  /*!
+   * \brief Stage of the ROS2 Rosenbrock-W time integration (time-accurate, global time step).
+   */
+  void RosenbrockW_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                             unsigned short iStage) final;
+
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time Strategy.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -26,9 +26,8 @@
 
 #pragma once
 
-#include "../gradients/computeGradientsGreenGauss.hpp"
-#include "../gradients/computeGradientsLeastSquares.hpp"
-#include "../limiters/computeLimiters.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
+#include "../gradients/computeGradientsAndLimiters.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
@@ -105,8 +104,8 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
-  /*--- LinSysSol will always be init to 0. ---*/
-  System.SetxIsZero(true);
+  /*--- LinSysSol will always be init to 0, unless it is initialized with the projection on a POD basis. ---*/
+  System.SetxIsZero(config.GetKind_ROM_Online() != ROM_ONLINE::INITIAL_GUESS || MGLevel != MESH_0);
 
   /*--- Store the value of the characteristic primitive variables at the boundaries ---*/
 
@@ -255,12 +254,8 @@ void CFVMFlowSolverBase<V, R>::CommunicateInitialState(CGeometry* geometry, cons
   /*--- Communicate and store volume and the number of neighbors for
    any dual CVs that lie on on periodic markers. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_VOLUME);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_VOLUME);
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
-  }
+  PeriodicComms(geometry, config, PERIODIC_VOLUME);
+  PeriodicComms(geometry, config, PERIODIC_NEIGHBORS);
   SetImplicitPeriodic(euler_implicit);
   if (MGLevel == MESH_0) SetRotatePeriodic(true);
 
@@ -315,6 +310,16 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
     int tmp = ReducerStrategy, numRanksUsingReducer = 0;
     SU2_MPI::Reduce(&tmp, &numRanksUsingReducer, 1, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
+    /*--- Locality of the coloring in use, averaged over the ranks. ---*/
+    su2double locality[2] = {0.0}, sumLocality[2] = {0.0};
+    geometry.GetEdgeColoringLocality(locality[0], locality[1]);
+    SU2_MPI::Reduce(locality, sumLocality, 2, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
+    if ((rank == MASTER_NODE) && (MGLevel == MESH_0)) {
+      cout << "Edge coloring: minimum efficiency " << minEff << ", average bandwidth of the groups "
+           << sumLocality[0] / size << " points, " << sumLocality[1] / size << " points read per edge." << endl;
+    }
+
     if (minEff < COLORING_EFF_THRESH) {
       cout << "WARNING: On " << numRanksUsingReducer << " MPI ranks the coloring efficiency was less than "
            << COLORING_EFF_THRESH << " (min value was " << minEff << ").\n"
@@ -329,10 +334,151 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 
   if (ReducerStrategy) EdgeFluxes.Initialize(geometry.GetnEdge(), geometry.GetnEdge(), nVar, nullptr);
 
+  /*--- The edge fluxes are still needed by the loops that are not vectorized. ---*/
+  OwnerStrategy = ReducerStrategy && (config.GetEdgeColoringFallback() == EDGE_FALLBACK::OWNER_COMPUTES);
+  if (OwnerStrategy) SetupOwnerComputes(geometry);
+
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 #else
   EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
 #endif
+
+  SetupCommOverlap(config, geometry);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetupCommOverlap(const CConfig& config, const CGeometry& geometry) {
+  /*--- Only the limiters of the finest grid are exchanged right before the edge loop. ---*/
+  CommOverlap = config.GetComm_Overlap() && (MGLevel == MESH_0) && (size > 1);
+  if (!CommOverlap) return;
+
+  /*--- The progress thread calls MPI concurrently with the master thread. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  if (config.GetComm_Progress_Thread()) {
+    int provided = 0;
+    SU2_MPI::Query_thread(&provided);
+    CommProgressThread = (provided == MPI_THREAD_MULTIPLE);
+    if (!CommProgressThread && (rank == MASTER_NODE)) {
+      cout << "WARNING: COMM_PROGRESS_THREAD requires MPI_THREAD_MULTIPLE (--thread_multiple), it will be ignored." << endl;
+    }
+  }
+#endif
+
+  const auto nPointDomain = geometry.GetnPointDomain();
+  auto touchesHalo = [&](unsigned long iEdge) {
+    return (geometry.edges->GetNode(iEdge, 0) >= nPointDomain) || (geometry.edges->GetNode(iEdge, 1) >= nPointDomain);
+  };
+
+  /*--- Sort whole color groups (a thread processes all edges of a group) into interior and halo sets.
+   * Only the last group of a color can be incomplete, since groups are visited in order it also
+   * ends up last in its set, which keeps the other groups aligned with the chunks of the loops. ---*/
+  vector<unsigned long> offsets(1, 0), groupSizes;
+  OverlapEdgeIdx.clear();
+  OverlapEdgeIdx.reserve(geometry.GetnEdge());
+
+  for (const auto& color : EdgeColoring) {
+#ifdef HAVE_OMP
+    const auto groupSize = color.groupSize;
+#else
+    const auto groupSize = 1ul;
+#endif
+    vector<unsigned long> halo;
+    for (auto iGroup = 0ul; iGroup < color.size; iGroup += groupSize) {
+      const auto end = min(iGroup + groupSize, color.size);
+      bool isHalo = false;
+      for (auto k = iGroup; k < end; ++k) isHalo |= touchesHalo(color.indices[k]);
+
+      for (auto k = iGroup; k < end; ++k) {
+        if (isHalo) halo.push_back(color.indices[k]);
+        else OverlapEdgeIdx.push_back(color.indices[k]);
+      }
+    }
+    offsets.push_back(OverlapEdgeIdx.size());
+    OverlapEdgeIdx.insert(OverlapEdgeIdx.end(), halo.begin(), halo.end());
+    offsets.push_back(OverlapEdgeIdx.size());
+    groupSizes.push_back(groupSize);
+  }
+
+  /*--- Views of the storage (it no longer changes). ---*/
+  InteriorEdgeColoring.clear();
+  HaloEdgeColoring.clear();
+
+  for (auto iColor = 0ul; iColor < groupSizes.size(); ++iColor) {
+    const auto begin = offsets[2 * iColor], mid = offsets[2 * iColor + 1], end = offsets[2 * iColor + 2];
+    InteriorEdgeColoring.emplace_back(OverlapEdgeIdx.data() + begin, mid - begin, groupSizes[iColor]);
+    HaloEdgeColoring.emplace_back(OverlapEdgeIdx.data() + mid, end - mid, groupSizes[iColor]);
+  }
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetupOwnerComputes(const CGeometry& geometry) {
+  const auto nEdge = geometry.GetnEdge();
+  const unsigned long nOwner = omp_get_max_threads();
+
+  /*--- Contiguous ranges of points with a similar number of edges. ---*/
+  vector<unsigned long> owner(nPoint);
+  const auto edgesPerOwner = 2 * nEdge / nOwner + 1;
+  unsigned long iOwner = 0, count = 0;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    if (count >= edgesPerOwner && iOwner + 1 < nOwner) {
+      ++iOwner;
+      count = 0;
+    }
+    owner[iPoint] = iOwner;
+    count += geometry.nodes->GetnPoint(iPoint);
+  }
+
+  /*--- Lists (both points owned, only i owned, only j owned) of each owner, counted and then filled. ---*/
+  auto listsOfEdge = [&](unsigned long iEdge, unsigned long* lists) {
+    const auto ownerI = owner[geometry.edges->GetNode(iEdge, 0)];
+    const auto ownerJ = owner[geometry.edges->GetNode(iEdge, 1)];
+    if (ownerI == ownerJ) {
+      lists[0] = 3 * ownerI;
+      return 1;
+    }
+    lists[0] = 3 * ownerI + 1;
+    lists[1] = 3 * ownerJ + 2;
+    return 2;
+  };
+
+  OwnerEdgePtr.assign(3 * nOwner + 1, 0);
+  unsigned long lists[2];
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto n = listsOfEdge(iEdge, lists);
+    for (auto k = 0; k < n; ++k) ++OwnerEdgePtr[lists[k] + 1];
+  }
+  for (auto k = 0ul; k < 3 * nOwner; ++k) OwnerEdgePtr[k + 1] += OwnerEdgePtr[k];
+
+  OwnerEdgeIdx.resize(OwnerEdgePtr.back());
+  auto next = OwnerEdgePtr;
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto n = listsOfEdge(iEdge, lists);
+    for (auto k = 0; k < n; ++k) OwnerEdgeIdx[next[lists[k]]++] = iEdge;
+  }
+}
+
+template <class V, ENUM_REGIME R>
+template <class ColorsType, class F>
+unsigned long CFVMFlowSolverBase<V, R>::ColorLoop(const ColorsType& colors, const F& func, std::true_type,
+                                                 unsigned long firstPack) {
+  for (const auto& color : colors) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k+j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k+j*in];
+      }
+      func(iEdge, mask, firstPack + k / Double::Size);
+    }
+    END_SU2_OMP_FOR
+    firstPack += (color.size + Double::Size - 1) / Double::Size;
+  }
+  return firstPack;
 }
 
 template <class V, ENUM_REGIME R>
@@ -344,6 +490,7 @@ CFVMFlowSolverBase<V, R>::~CFVMFlowSolverBase() {
 
   delete nodes;
   delete edgeNumerics;
+  delete farfieldNumerics;
 }
 
 template <class V, ENUM_REGIME R>
@@ -395,6 +542,21 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config) {
+  const auto kindGradient = config->GetKind_Gradient_Method_Recon();
+  const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = nodes->GetGradient_Reconstruction();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  computeGradientsAndLimiters(this, PRIMITIVE_RECONSTRUCTION, *geometry, *config, kindGradient, kindLimiter,
+                              primitives, 0, nPrimVarGrad, gradient, rmatrix, primMin, primMax, limiter);
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                                      CNumerics *numerics, CConfig *config) {
@@ -572,13 +734,80 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
   }
   END_SU2_OMP_FOR
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  /*--- With a POD basis the projected step replaces the solution of the system, or initializes it. ---*/
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
+  const bool reducedStep = !PODBasis.empty();
+
+  if (reducedStep) SolveReducedSystem(geometry, config);
+
+  if (!reducedStep || config->GetKind_ROM_Online() == ROM_ONLINE::INITIAL_GUESS) SolveLinearSystem(geometry, config);
+
+  CompleteImplicitIteration(geometry, nullptr, config);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::RosenbrockW_Iteration(CGeometry *geometry, CSolver**, CConfig *config,
+                                                     unsigned short iStage) {
+
+  /*--- ROS2 (Verwer et al. 1999), with W = V/(gamma dt) + dR/dU:
+   *   W d1 = -R(U^n),  W d2 = -R(U^n + d1/gamma) - 2 V/(gamma dt) d1,  U^(n+1) = U^n + (3 d1 + d2)/(2 gamma).
+   * It is second order for any approximation of dR/dU, as long as all stages use the same W, the second stage
+   * therefore discards the Jacobian assembled with its residual and solves with the matrix of the first. ---*/
+
+  const su2double gamma = 1.0 + 1.0 / sqrt(2.0);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    nodes->SetDelta_Time(iPoint, gamma * nodes->GetDelta_Time(iPoint));
+  END_SU2_OMP_FOR
+
+  PrepareImplicitIteration(geometry, nullptr, config);
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    nodes->SetDelta_Time(iPoint, nodes->GetDelta_Time(iPoint) / gamma);
+  END_SU2_OMP_FOR
+
+  if (iStage == 0) {
+    JacobianStage.CopyValues(Jacobian);
+  } else {
+    Jacobian.CopyValues(JacobianStage);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (nodes->GetDelta_Time(iPoint) == 0.0) continue;
+      const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+      const su2double factor = 2.0 * Vol / (gamma * nodes->GetDelta_Time(iPoint));
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint, iVar) -= factor * LinSysSolStage(iPoint, iVar);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
+  }
+  END_SU2_OMP_FOR
+
+  SolveLinearSystem(geometry, config);
+
+  /*--- The first stage moves the solution to U^n + d1/gamma, the second completes the step from there. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      if (iStage == 0) {
+        LinSysSolStage(iPoint, iVar) = LinSysSol(iPoint, iVar);
+        LinSysSol(iPoint, iVar) /= gamma;
+      } else {
+        LinSysSol(iPoint, iVar) = (LinSysSolStage(iPoint, iVar) + LinSysSol(iPoint, iVar)) / (2.0 * gamma);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
 
   CompleteImplicitIteration(geometry, nullptr, config);
 }
@@ -1005,6 +1234,9 @@ void CFVMFlowSolverBase<V, R>::SetInitialCondition(CGeometry **geometry, CSolver
   if (dual_time && TimeIter == config->GetRestart_Iter()) {
     PushSolutionBackInTime(TimeIter, restart, rans, solver_container, geometry, config);
   }
+  else if (dual_time && config->GetTime_Step_Extrapolation() && !config->GetDiscrete_Adjoint()) {
+    ExtrapolateSolutionInTime(rans, solver_container);
+  }
 
   }
   END_SU2_OMP_PARALLEL
@@ -1059,6 +1291,43 @@ void CFVMFlowSolverBase<V, R>::PushSolutionBackInTime(unsigned long TimeIter, bo
   }
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::ExtrapolateSolutionInTime(bool rans, CSolver*** solver_container) {
+
+  /*--- Only time levels n and n-1 are used, which makes this idempotent within a time step.
+   * The coarse grids get the extrapolated solution by restriction. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double U_n = nodes->GetSolution_time_n(iPoint, iVar);
+      const su2double U_nM1 = nodes->GetSolution_time_n1(iPoint, iVar);
+      nodes->SetSolution_Old(iPoint, iVar, U_n);
+      nodes->SetSolution(iPoint, iVar, 2.0 * U_n - U_nM1);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Otherwise the inner iterations start with the eddy viscosity of time n, the turbulence
+   * variables are only extrapolated while they keep their sign (positivity of k, omega, nu_tilde). ---*/
+
+  if (!rans) return;
+
+  auto* turbNodes = solver_container[MESH_0][TURB_SOL]->GetNodes();
+  const auto nVarTurb = solver_container[MESH_0][TURB_SOL]->GetnVar();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVarTurb; iVar++) {
+      const su2double U_n = turbNodes->GetSolution_time_n(iPoint, iVar);
+      const su2double U_pred = 2.0 * U_n - turbNodes->GetSolution_time_n1(iPoint, iVar);
+      turbNodes->SetSolution_Old(iPoint, iVar, U_n);
+      turbNodes->SetSolution(iPoint, iVar, (U_pred * U_n > 0.0) ? U_pred : U_n);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solver_container, CNumerics* conv_numerics,
                                             CNumerics* visc_numerics, CConfig* config, unsigned short val_marker) {
@@ -1314,10 +1583,7 @@ void CFVMFlowSolverBase<V, R>::BC_Periodic(CGeometry* geometry, CSolver** solver
    accumulated correctly during the communications. For implicit calculations,
    the Jacobians and linear system are also correctly adjusted here. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-  }
+  PeriodicComms(geometry, config, PERIODIC_RESIDUAL);
 }
 
 template <class V, ENUM_REGIME FlowRegime>
@@ -1548,7 +1814,7 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
+void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
   if (!edgeNumerics) {
@@ -1558,8 +1824,39 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
                      "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
     }
     InstantiateEdgeNumerics(solvers, config);
+
+    /*--- Store the geometry of the edges in the order they are visited by EdgeLoop. ---*/
+    if (config->GetEdgeGeometryCache() && !OwnerStrategy) {
+      /*--- The colorings have different types without OpenMP. ---*/
+      const auto nInteriorPack = CommOverlap ? CEdgeGeometryCache::NumPacks(InteriorEdgeColoring)
+                                             : CEdgeGeometryCache::NumPacks(EdgeColoring);
+      const auto nHaloPack = CommOverlap ? CEdgeGeometryCache::NumPacks(HaloEdgeColoring) : 0ul;
+
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+      EdgeGeometry.Allocate(nDim, nInteriorPack + nHaloPack);
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+      if (CommOverlap) {
+        const auto nPack = EdgeGeometry.Set(*geometry, InteriorEdgeColoring, 0);
+        EdgeGeometry.Set(*geometry, HaloEdgeColoring, nPack);
+      } else {
+        EdgeGeometry.Set(*geometry, EdgeColoring, 0);
+      }
+    }
+
+    /*--- Store the vertices of the markers whose boundary conditions are vectorized. ---*/
+    if (farfieldNumerics) {
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+      VertexGeometry.resize(nMarker);
+      for (auto iMarker = 0u; iMarker < nMarker; ++iMarker) {
+        if (config->GetMarker_All_KindBC(iMarker) == FAR_FIELD) VertexGeometry[iMarker].Set(*geometry, iMarker);
+      }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    }
   }
 
+  SU2_KERNEL_COUNTER(EDGE_LOOP);
+
   /*--- Non-physical counter. ---*/
   unsigned long counterLocal = 0;
   SU2_OMP_MASTER
@@ -1572,33 +1869,82 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
-    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-    for(auto k = 0ul; k < color.size; k += Double::Size) {
-      Int iEdge;
-      Double mask;
-      for (auto j = 0ul; j < Double::Size; ++j) {
-        bool in = (k+j < color.size);
-        mask[j] = in;
-        iEdge[j] = color.indices[k+j*in];
-      }
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  /*--- Copy the reconstruction data to single precision before the edges read it, the halo
+   * points are copied after their exchange if it is overlapped with the interior edges. ---*/
+  const bool singlePrecRecon = (MGLevel == MESH_0) && nodes->GetReconstructionSinglePrec();
+  if (singlePrecRecon) nodes->CopyReconstructionSinglePrec(0, HasDeferredComms() ? nPointDomain : nPoint);
+  auto CopyHaloReconstruction = [&]() {
+    if (singlePrecRecon) nodes->CopyReconstructionSinglePrec(nPointDomain, nPoint);
+  };
+#else
+  auto CopyHaloReconstruction = []() {};
+#endif
 
-      if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
-      } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
-      }
-      if (MGLevel == MESH_0) {
-        for (auto j = 0ul; j < Double::Size; ++j)
-          counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+  /*--- Loop over edge colors, in packs of SIMD length. ---*/
+  const auto* edgeCache = EdgeGeometry.empty() ? nullptr : &EdgeGeometry;
+
+  const bool multirate = !TimeLevel.empty() && (MGLevel == MESH_0);
+
+  auto ComputePack = [&](const Int& iEdge, const Double& packMask, unsigned long iPack) {
+    Double mask = packMask;
+    if (multirate && !TimeLevelMask(geometry, iEdge, mask)) return;
+    if (ReducerStrategy) {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian,
+                                edgeCache, iPack);
+    } else {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian,
+                                edgeCache, iPack);
+    }
+    if (MGLevel == MESH_0) {
+      for (auto j = 0ul; j < Double::Size; ++j)
+        counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+    }
+  };
+
+  if (!OwnerStrategy) {
+    EdgeLoop<true>(geometry, config, ComputePack, CopyHaloReconstruction);
+    FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
+    StoreOrRestoreEdgeJacobian(config);
+    return;
+  }
+
+  /*--- Owner computes, each thread updates the rows of the points it owns, all halo data is needed. ---*/
+  if (HasDeferredComms()) {
+    CompleteDeferredComms(geometry, config);
+    CopyHaloReconstruction();
+  }
+  const UpdateType listUpdate[] = {UpdateType::COLORING, UpdateType::ROW_I, UpdateType::ROW_J};
+  const unsigned long nOwner = OwnerEdgePtr.size() / 3;
+
+  for (unsigned long iOwner = omp_get_thread_num(); iOwner < nOwner; iOwner += omp_get_num_threads()) {
+    for (auto iList = 0ul; iList < 3; ++iList) {
+      const auto begin = OwnerEdgePtr[3 * iOwner + iList], end = OwnerEdgePtr[3 * iOwner + iList + 1];
+
+      for (auto k = begin; k < end; k += Double::Size) {
+        Int iEdge;
+        Double mask;
+        for (auto j = 0ul; j < Double::Size; ++j) {
+          bool in = (k+j < end);
+          mask[j] = in;
+          iEdge[j] = OwnerEdgeIdx[k+j*in];
+        }
+        if (multirate && !TimeLevelMask(geometry, iEdge, mask)) continue;
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, listUpdate[iList], mask, LinSysRes, Jacobian,
+                                  nullptr, 0);
+
+        /*--- The edges of the ROW_J lists are also in a ROW_I list. ---*/
+        if ((MGLevel == MESH_0) && (listUpdate[iList] != UpdateType::ROW_J)) {
+          for (auto j = 0ul; j < Double::Size; ++j)
+            counterLocal += (k+j < end) && (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+        }
       }
     }
-    END_SU2_OMP_FOR
   }
+  SU2_OMP_BARRIER
 
-  FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
+  FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config, false);
+  StoreOrRestoreEdgeJacobian(config);
 }
 
 template <class V, ENUM_REGIME R>
@@ -1619,6 +1965,59 @@ void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
   END_SU2_OMP_FOR
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetTimeLevels(CGeometry *geometry, const CConfig *config) {
+
+  const int maxLevel = config->GetnLevels_TimeAccurateLTS() - 1;
+  const su2double dt0 = Min_Delta_Time;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    TimeSubStep = 0;
+    TimeLevel.resize(nPoint);
+    /*--- The accumulated residuals are zero at the end of each time step. ---*/
+    if (TimeLevelResidual.rows() != nPointDomain) TimeLevelResidual.resize(nPointDomain, nVar) = su2double(0.0);
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- The time step of level l is dt0 * 2^l, points with zero time step get the finest level. ---*/
+  auto levelOf = [&](su2double dt) {
+    const int level = (dt > 0.0) ? ilogb(SU2_TYPE::GetValue(dt / dt0)) : 0;
+    return static_cast<uint8_t>(max(0, min(level, maxLevel)));
+  };
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    nodes->SetDelta_Time(iPoint, dt0 * (1ul << levelOf(nodes->GetDelta_Time(iPoint))));
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Limit the difference between the levels of neighbors to one, by lowering the levels of points next to finer
+   * levels. The maximum level is reached after at most maxLevel sweeps, the levels of the halos are communicated via
+   * the time steps. ---*/
+
+  for (int iSweep = 0; ; ++iSweep) {
+    InitiateComms(geometry, config, TIME_STEP);
+    CompleteComms(geometry, config, TIME_STEP);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      TimeLevel[iPoint] = levelOf(nodes->GetDelta_Time(iPoint));
+    }
+    END_SU2_OMP_FOR
+
+    if (iSweep == maxLevel) break;
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      auto level = TimeLevel[iPoint];
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        level = min<uint8_t>(level, TimeLevel[jPoint] + 1);
+      }
+      nodes->SetDelta_Time(iPoint, dt0 * (1ul << level));
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
 template <class V, ENUM_REGIME FlowRegime>
 void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container,
                                                              CConfig *config, unsigned short iRKStep, unsigned short iMesh,
@@ -1809,6 +2208,53 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
 
 }
 
+template <class V, ENUM_REGIME FlowRegime>
+void CFVMFlowSolverBase<V, FlowRegime>::AllreduceForces(const CConfig* config, AeroCoeffs& allBound,
+                                                        AeroCoeffsArray& surface,
+                                                        std::initializer_list<su2double*> scalars,
+                                                        std::initializer_list<su2double*> surfaceArrays) {
+#ifdef HAVE_MPI
+  if (config->GetComm_Level() != COMM_FULL) return;
+
+  const int nMarkerMon = config->GetnMarker_Monitoring();
+
+  su2double* const allBoundValues[] = {&allBound.CD,  &allBound.CL,   &allBound.CSF,  &allBound.CFx,  &allBound.CFy,
+                                       &allBound.CFz, &allBound.CMx,  &allBound.CMy,  &allBound.CMz,  &allBound.CoPx,
+                                       &allBound.CoPy, &allBound.CoPz, &allBound.CT,  &allBound.CQ};
+  su2double* const surfaceValues[] = {surface.CL,  surface.CD,  surface.CSF, surface.CFx, surface.CFy,
+                                      surface.CFz, surface.CMx, surface.CMy, surface.CMz};
+
+  /*--- Pack all the values, reduce them, and unpack them in the same order. ---*/
+
+  vector<su2double> local;
+  for (const auto* x : allBoundValues) local.push_back(*x);
+  for (const auto* x : scalars) local.push_back(*x);
+  for (const auto* x : surfaceValues) local.insert(local.end(), x, x + nMarkerMon);
+  for (const auto* x : surfaceArrays) local.insert(local.end(), x, x + nMarkerMon);
+
+  vector<su2double> global(local.size());
+  SU2_MPI::Allreduce(local.data(), global.data(), local.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  auto it = global.cbegin();
+  for (auto* x : allBoundValues) *x = *(it++);
+  for (auto* x : scalars) *x = *(it++);
+  for (auto* x : surfaceValues) {
+    std::copy(it, it + nMarkerMon, x);
+    it += nMarkerMon;
+  }
+  for (auto* x : surfaceArrays) {
+    std::copy(it, it + nMarkerMon, x);
+    it += nMarkerMon;
+  }
+
+  allBound.CEff = allBound.CL / (allBound.CD + EPS);
+  allBound.CMerit = allBound.CT / (allBound.CQ + EPS);
+
+  for (int iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
+    surface.CEff[iMarker_Monitoring] = surface.CL[iMarker_Monitoring] / (surface.CD[iMarker_Monitoring] + EPS);
+#endif
+}
+
 template <class V, ENUM_REGIME FlowRegime>
 void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometry, const CConfig* config) {
   unsigned long iVertex, iPoint;
@@ -2022,75 +2468,9 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
     }
   }
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
-
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
-
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
-
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
-
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
-    AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
-
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
-      SurfaceInvCoeff.CEff[iMarker_Monitoring] =
-          SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete[] buffer;
-  }
-
-#endif
+  AllreduceForces(config, AllBoundInvCoeff, SurfaceInvCoeff, {&AllBound_CNearFieldOF_Inv});
 
   /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
 
@@ -2304,75 +2684,9 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
     }
   }
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
-    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
-
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
-
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
-
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
-
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
-    AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
-
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
-      SurfaceMntCoeff.CEff[iMarker_Monitoring] =
-          SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete[] buffer;
-  }
-
-#endif
+  AllreduceForces(config, AllBoundMntCoeff, SurfaceMntCoeff);
 
   /*--- Update the total coefficients (note that all the nodes have the same value) ---*/
 
@@ -2746,80 +3060,10 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
   AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
   AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
 
-#ifdef HAVE_MPI
-
-  /*--- Add AllBound information using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
-
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
-
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
-    AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = Allreduce(AllBound_MaxHF_Visc);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
-
-    for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
-      SurfaceViscCoeff.CEff[iMarker_Monitoring] =
-          SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc.data());
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc.data());
-
-    delete[] buffer;
-  }
-
-#endif
+  AllreduceForces(config, AllBoundViscCoeff, SurfaceViscCoeff, {&AllBound_HF_Visc, &AllBound_MaxHF_Visc},
+                  {Surface_HF_Visc.data(), Surface_MaxHF_Visc.data()});
 
   /*--- Complete the calculation of maximum heat flux. ---*/
 
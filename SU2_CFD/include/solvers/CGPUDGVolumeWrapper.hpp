@@ -0,0 +1,129 @@
+/*!
+ * \file CGPUDGVolumeWrapper.hpp
+ * \brief Wrapper of the device (CUDA) data of the FEM-DG volume elements, used to
+ *        offload the volume residual of the inviscid FEM-DG solver.
+ * \note The implementation (kernels) is in CGPUDGVolumeWrapper.cu.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_CUDA
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#error Cannot use the CUDA backend with AD
+#endif
+
+#include <vector>
+
+/*!
+ * \class CGPUDGVolumeWrapper
+ * \brief Device-resident copy of the data of the owned FEM-DG volume elements (3D, ideal gas) needed
+ *        to compute the volume residual: basis functions of the standard elements, integration weights,
+ *        metric terms and grid velocities.
+ * \note The data is uploaded once, only the solution and residual of the DOFs are copied per call.
+ *       Elements are numbered as the owned volume elements of the solver, their DOFs are contiguous.
+ *       The methods must be called by one thread.
+ */
+class CGPUDGVolumeWrapper {
+ private:
+  unsigned long nElem = 0, nDOFsTot = 0, nIntTot = 0;
+  double gm1 = 0.0; /*!< \brief Gamma minus one. */
+
+  std::vector<unsigned long> offsetDOFs; /*!< \brief Offset of the DOFs of the elements (nElem+1). */
+  std::vector<unsigned long> offsetInt;  /*!< \brief Offset of the integration points of the elements (nElem+1). */
+
+  unsigned short* d_stdNInt = nullptr;     /*!< \brief Number of integration points of the standard elements. */
+  unsigned short* d_stdNDOFs = nullptr;    /*!< \brief Number of DOFs of the standard elements. */
+  unsigned long* d_stdOffBasis = nullptr;  /*!< \brief Offset of the standard elements in d_basis and d_derBasisTrans. */
+  unsigned long* d_stdOffWeights = nullptr;/*!< \brief Offset of the standard elements in d_weights. */
+  double* d_basis = nullptr;               /*!< \brief Basis functions in the integration points, nInt x nDOFs. */
+  double* d_derBasisTrans = nullptr;       /*!< \brief Transposed parametric derivatives, nDOFs x (nInt*3). */
+  double* d_weights = nullptr;             /*!< \brief Integration weights. */
+
+  unsigned short* d_elemStd = nullptr;     /*!< \brief Standard element of the elements. */
+  unsigned long* d_offsetDOFs = nullptr;   /*!< \brief Device copy of offsetDOFs. */
+  unsigned long* d_offsetInt = nullptr;    /*!< \brief Device copy of offsetInt. */
+  unsigned long* d_pointElem = nullptr;    /*!< \brief Element of each integration point. */
+  unsigned long* d_dofElem = nullptr;      /*!< \brief Element of each DOF. */
+  double* d_metric = nullptr;              /*!< \brief Metric terms in the integration points (10 per point). */
+  double* d_gridVel = nullptr;             /*!< \brief Grid velocities in the integration points. */
+
+  double* d_sol = nullptr;  /*!< \brief Conservative variables in the DOFs. */
+  double* d_flux = nullptr; /*!< \brief Parametric fluxes in the integration points (3 x 5 per point). */
+  double* d_res = nullptr;  /*!< \brief Volume residual in the DOFs. */
+
+  /*!
+   * \brief Release all device memory.
+   */
+  void Clean();
+
+ public:
+  CGPUDGVolumeWrapper() = default;
+
+  /*--- Move or copy is not allowed. ---*/
+  CGPUDGVolumeWrapper(CGPUDGVolumeWrapper&&) = delete;
+  CGPUDGVolumeWrapper(const CGPUDGVolumeWrapper&) = delete;
+  CGPUDGVolumeWrapper& operator=(CGPUDGVolumeWrapper&&) = delete;
+  CGPUDGVolumeWrapper& operator=(const CGPUDGVolumeWrapper&) = delete;
+
+  /*!
+   * \brief Class destructor.
+   */
+  ~CGPUDGVolumeWrapper() { Clean(); }
+
+  /*!
+   * \brief Allocate the device memory and upload the data of the standard and volume elements.
+   * \param[in] stdNInt - Number of integration points of the standard elements.
+   * \param[in] stdNDOFs - Number of DOFs of the standard elements.
+   * \param[in] stdBasis - Basis functions in the integration points of the standard elements (nInt x nDOFs).
+   * \param[in] stdDerBasisTrans - Transposed derivatives of the basis functions (nDOFs x nInt*3).
+   * \param[in] stdWeights - Integration weights of the standard elements.
+   * \param[in] elemStd - Standard element of each volume element.
+   * \param[in] metricTerms - Metric terms in the integration points of the elements (10 per point).
+   * \param[in] gridVelocities - Grid velocities in the integration points of the elements (3 per point).
+   * \param[in] gammaMinusOne - Gamma minus one of the ideal gas.
+   */
+  void Initialize(const std::vector<unsigned short>& stdNInt, const std::vector<unsigned short>& stdNDOFs,
+                  const std::vector<const double*>& stdBasis, const std::vector<const double*>& stdDerBasisTrans,
+                  const std::vector<const double*>& stdWeights, const std::vector<unsigned short>& elemStd,
+                  const std::vector<double>& metricTerms, const std::vector<double>& gridVelocities,
+                  double gammaMinusOne);
+
+  /*!
+   * \brief Offset of the DOFs of an element in the arrays passed to VolumeResidual.
+   */
+  inline unsigned long GetOffsetDOFs(unsigned long iElem) const { return offsetDOFs[iElem]; }
+
+  /*!
+   * \brief Compute the volume residual of a range of elements on the device.
+   * \param[in] elemBeg - First element of the range.
+   * \param[in] elemEnd - End (not included) of the range.
+   * \param[in] sol - Host array with the 5 conservative variables of the DOFs of the range.
+   * \param[out] res - Host array with the 5 residuals of the DOFs of the range.
+   */
+  void VolumeResidual(unsigned long elemBeg, unsigned long elemEnd, const double* sol, double* res);
+};
+
+#endif
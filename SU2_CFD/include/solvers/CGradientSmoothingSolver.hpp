@@ -67,6 +67,8 @@ public:
 
   std::vector<bool> visited;                 /*! <\brief Stores already visited points for surface applications with multiple markers. */
 
+  bool volumeOperatorReady = false;          /*!< \brief The volume smoothing operator (with boundary conditions) is in the Jacobian. */
+
   /*!
    * \brief The highest level in the variable hierarchy all derived solvers can safely use,
    * CVariable is the common denominator between the FEA and Mesh deformationd variables.
@@ -95,6 +97,11 @@ public:
    */
   void ApplyGradientSmoothingVolume(CGeometry* geometry, CNumerics* numerics, const CConfig* config) override;
 
+  /*!
+   * \brief Signal that the geometry changed, the volume smoothing operator is then assembled again on the next call.
+   */
+  inline void ResetSmoothingOperator() { volumeOperatorReady = false; }
+
   /*!
    * \brief Main routine to apply the method only on the surface for mesh sensitivities
    *        Projects and smoothes only in the normal direction!
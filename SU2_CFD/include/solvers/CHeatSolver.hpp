@@ -94,6 +94,12 @@ protected:
     }
   }
 
+  /*!
+   * \brief Instantiate the SIMD numerics of the heat conduction in solids (the weakly coupled energy
+   *        equation of incompressible flows is not vectorized).
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
    * \param[in] iEdge - Edge for which we want to compute the flux
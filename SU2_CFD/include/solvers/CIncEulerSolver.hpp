@@ -113,6 +113,13 @@ protected:
    */
   void SetNondimensionalization(CConfig *config, unsigned short iMesh);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
   /*!
    * \brief Generic implementation of explicit iterations with preconditioner.
    */
@@ -0,0 +1,74 @@
+/*!
+ * \file CJacobianLag.hpp
+ * \brief Decides when the lagged edge Jacobian of the flow solvers is assembled (JACOBIAN_LAG).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../../Common/include/code_config.hpp"
+
+/*!
+ * \class CJacobianLag
+ * \brief Keeps the state of the last assembly of a lagged Jacobian and decides if the next one is needed.
+ * \details The Jacobian is assembled in the first call, at the start of each time step, every "lag" inner
+ * iterations, when the residual increases, or when the average CFL changes by more than a factor since
+ * the last assembly. The time step is compared explicitly, inner iterations restart with each time step
+ * and the last assembly may have been at inner iteration 0.
+ */
+class CJacobianLag {
+ private:
+  bool assembled = false;      /*!< \brief Whether the Jacobian was ever assembled. */
+  unsigned long timeIter = 0;  /*!< \brief Time iteration of the last assembly. */
+  unsigned long innerIter = 0; /*!< \brief Inner iteration of the last assembly. */
+  su2double cfl = 0.0;         /*!< \brief Average CFL at the last assembly. */
+  su2double res = 0.0;         /*!< \brief Residual at the previous call. */
+
+ public:
+  /*!
+   * \brief Decide if the Jacobian is lagged in the current iteration, and update the state accordingly.
+   * \param[in] timeIter_ - Current time iteration.
+   * \param[in] innerIter_ - Current inner iteration.
+   * \param[in] lag - Maximum number of inner iterations between assemblies.
+   * \param[in] cflFactor - Change of the average CFL that triggers an assembly.
+   * \param[in] avgCFL - Current average CFL.
+   * \param[in] res_ - Current residual.
+   * \return True if the Jacobian is lagged (not assembled).
+   */
+  bool Lag(unsigned long timeIter_, unsigned long innerIter_, unsigned long lag, su2double cflFactor,
+           su2double avgCFL, su2double res_) {
+    const bool assemble = !assembled || (timeIter_ != timeIter) || (innerIter_ < innerIter) ||
+                          (innerIter_ - innerIter >= lag) || (avgCFL > cflFactor * cfl) ||
+                          (cflFactor * avgCFL < cfl) || (res_ > res);
+    res = res_;
+    if (assemble) {
+      assembled = true;
+      timeIter = timeIter_;
+      innerIter = innerIter_;
+      cfl = avgCFL;
+    }
+    return !assemble;
+  }
+};
@@ -63,6 +63,14 @@ protected:
 
   CNEMOEulerVariable* node_infty = nullptr;
 
+  su2activematrix SourceJacobian; /*!< \brief Jacobian of the point-implicit sources, nVar x nVar per point. */
+
+  /*!
+   * \brief Generic implementation of explicit iterations, with point-implicit sources if required.
+   */
+  template<ENUM_TIME_INT IntegrationType>
+  void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
+
   /*!
    * \brief Set the maximum value of the eigenvalue.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -70,6 +78,13 @@ protected:
    */
   void SetMax_Eigenvalue(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
   /*!
    * \brief Compute a pressure sensor switch.
    * \param[in] geometry - Geometrical definition of the problem.
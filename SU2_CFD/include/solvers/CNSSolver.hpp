@@ -54,10 +54,12 @@ private:
    * \brief Compute the velocity^2, SoundSpeed, Pressure, Enthalpy, Viscosity.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] zeroResidual - Also zero the residual of the points.
    * \return - The number of non-physical points.
    */
   unsigned long SetPrimitive_Variables(CSolver **solver_container,
-                                       const CConfig *config) override;
+                                       const CConfig *config,
+                                       bool zeroResidual = false) override;
 
   /*!
    * \brief Common code for wall boundaries, add the residual and Jacobian
@@ -0,0 +1,81 @@
+/*!
+ * \file CResidualReduction.hpp
+ * \brief Packed (single collective) reduction of the residuals of the solvers of a zone.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include <vector>
+
+class CSolver;
+
+/*!
+ * \class CResidualReduction
+ * \brief Reduces the RMS and max residuals of several solvers with one (non-blocking) collective.
+ * \details Solvers that have a reduction context do not reduce their residuals in SetResidual_RMS,
+ * instead they register with the context. Start() packs the local values of all the registered solvers
+ * and gathers them with a single MPI_Iallgather, Complete() waits for it and sets the global residuals.
+ * Both are collective, they must be called by all ranks in the same order. Complete() can be called
+ * at any time (it starts the reduction if needed) and does nothing if there is nothing to reduce.
+ * Start() first completes the previous reduction if it is still in flight.
+ * \note In AD builds the gather is blocking.
+ */
+class CResidualReduction {
+ private:
+  struct Entry {
+    CSolver* solver;
+    unsigned long nPointGlobal;
+  };
+  std::vector<Entry> pending;   /*!< \brief Solvers registered since the last Start. */
+  std::vector<Entry> inFlight;  /*!< \brief Solvers whose reduction was started. */
+  std::vector<su2double> sendBuf, recvBuf; /*!< \brief Packed residuals, local and of all ranks. */
+  SU2_MPI::Request request;     /*!< \brief Request of the gather. */
+
+  /*!
+   * \brief Wait for the gather and set the global residuals of the solvers in flight.
+   */
+  void Finish();
+
+ public:
+  /*!
+   * \brief Register a solver whose (local) residuals are ready, later registrations of the same
+   *        solver before Start() replace the earlier ones, e.g. the stages of a RK scheme.
+   * \note Not thread safe, to be called by one thread.
+   * \param[in] solver - The solver.
+   * \param[in] nPointGlobal - Number of points used to compute the RMS.
+   */
+  void Register(CSolver* solver, unsigned long nPointGlobal);
+
+  /*!
+   * \brief Start the reduction of the registered solvers.
+   */
+  void Start();
+
+  /*!
+   * \brief Complete the reductions, setting the global residuals of all the registered solvers.
+   */
+  void Complete();
+};
@@ -33,8 +33,11 @@
 #include "../variables/CScalarVariable.hpp"
 #include "../variables/CFlowVariable.hpp"
 #include "../variables/CPrimitiveIndices.hpp"
+#include "../numerics_simd/CEdgeGeometryCache.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +81,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  CEdgeGeometryCache EdgeGeometry;       /*!< \brief Geometry of the edges in the order of the SIMD edge loop. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -88,6 +94,19 @@ class CScalarSolver : public CSolver {
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Instantiate a SIMD numerics object (convection and diffusion), solvers that support
+   *        vectorization override this method, edgeNumerics remains null otherwise.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous residual contributions using vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, CConfig* config);
+
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
    * \tparam SolverSpecificNumericsFunc - lambda-function, that implements solver specific contributions to numerics.
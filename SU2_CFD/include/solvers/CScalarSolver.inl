@@ -28,6 +28,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
@@ -77,6 +78,7 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
@@ -143,6 +145,15 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Apply scalar advection correction terms for bounded scalar problems ---*/
   const bool bounded_scalar = numerics->GetBoundedScalar();
 
+  /*--- Use the vectorized numerics if the solver supports them, these include the viscous fluxes. ---*/
+  if (config->GetUseVectorization() && !bounded_scalar) {
+    if (!edgeNumerics) InstantiateEdgeNumerics(solver_container, config);
+    if (edgeNumerics) {
+      EdgeFluxResidual(geometry, config);
+      return;
+    }
+  }
+
   /*--- Static arrays of MUSCL-reconstructed flow primitives and turbulence variables (thread safety). ---*/
   su2double solution_i[MAXNVAR] = {0.0}, flowPrimVar_i[MAXNVARFLOW] = {0.0};
   su2double solution_j[MAXNVAR] = {0.0}, flowPrimVar_j[MAXNVARFLOW] = {0.0};
@@ -331,6 +342,70 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   }
 }
 
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(CGeometry* geometry, CConfig* config) {
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
+      (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
+    SU2_MPI::Error("When using vectorization, the EDGE_COLORING_GROUP_SIZE must be divisible "
+                   "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
+  }
+
+  /*--- Store the geometry of the edges in the order they are visited below, on first use. ---*/
+  if (config->GetEdgeGeometryCache() && EdgeGeometry.empty()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    EdgeGeometry.Allocate(nDim, CEdgeGeometryCache::NumPacks(EdgeColoring));
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    EdgeGeometry.Set(*geometry, EdgeColoring, 0);
+  }
+  const auto* edgeCache = EdgeGeometry.empty() ? nullptr : &EdgeGeometry;
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors, in packs of SIMD length. ---*/
+  unsigned long firstPack = 0;
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+      const auto iPack = firstPack + k / Double::Size;
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian,
+                                  edgeCache, iPack);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian,
+                                  edgeCache, iPack);
+      }
+    }
+    END_SU2_OMP_FOR
+    firstPack += (color.size + Double::Size - 1) / Double::Size;
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+  }
+}
+
 template <class VariableType>
 void CScalarSolver<VariableType>::SumEdgeFluxes(CGeometry* geometry) {
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -356,10 +431,7 @@ void CScalarSolver<VariableType>::BC_Periodic(CGeometry* geometry, CSolver** sol
    accumulated corectly during the communications. For implicit calculations
    the Jacobians and linear system are also correctly adjusted here. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-  }
+  PeriodicComms(geometry, config, PERIODIC_RESIDUAL);
 }
 
 template <class VariableType>
@@ -518,10 +590,7 @@ void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry,
     }
   }
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-  }
+  PeriodicComms(geometry, config, PERIODIC_IMPLICIT);
 
   InitiateComms(geometry, config, SOLUTION);
   CompleteComms(geometry, config, SOLUTION);
@@ -541,13 +610,7 @@ void CScalarSolver<VariableType>::ImplicitEuler_Iteration(CGeometry* geometry, C
   }
   END_SU2_OMP_FOR
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  SolveLinearSystem(geometry, config);
 
   CompleteImplicitIteration(geometry, solver_container, config);
 }
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/parallelization/comm_progress.hpp"
 
 #include <cmath>
 #include <cstddef>
@@ -56,6 +57,7 @@
 #include "../../../Common/include/graph_coloring_structure.hpp"
 #include "../../../Common/include/toolboxes/MMS/CVerificationSolution.hpp"
 #include "../variables/CVariable.hpp"
+#include "CResidualReduction.hpp"
 
 #ifdef HAVE_LIBROM
 #include "librom.h"
@@ -73,6 +75,9 @@ protected:
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
+  bool singlePrecSystem = false; /*!< \brief The linear system is solved in single precision. */
+  bool segregatedSystem = false; /*!< \brief The variables are solved one at a time, with one scalar Jacobian for all. */
+  CSysVector<su2double> LinSysSolVar, LinSysResVar; /*!< \brief Scalar vectors of a segregated linear system. */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
@@ -146,6 +151,13 @@ protected:
 
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
+  bool DeferNextComms = false;         /*!< \brief The next exchange of DeferredCommType is not completed by CompleteComms. */
+  bool CommsInFlight = false;          /*!< \brief A deferred exchange is in flight. */
+  unsigned short DeferredCommType = 0; /*!< \brief Quantity of the deferred exchange. */
+  bool CommProgressThread = false;     /*!< \brief Deferred exchanges are progressed and unpacked by a helper thread. */
+  CCommProgressThread CommProgress;    /*!< \brief The helper thread of the deferred exchange in flight. */
+  int nRecvUnpacked = 0;               /*!< \brief Messages of the deferred exchange unpacked by the helper thread. */
+
   vector<su2activematrix> VertexTraction;          /*- Temporary, this will be moved to a new postprocessing structure once in place -*/
   vector<su2activematrix> VertexTractionAdjoint;   /*- Also temporary -*/
 
@@ -186,6 +198,15 @@ private:
    directly instead of calling GetBaseClassPointerToNodes() or doing something equivalent. ---*/
   CVariable* base_nodes;  /*!< \brief Pointer to CVariable to allow polymorphic access to solver nodes. */
 
+  CResidualReduction* ResidualReduction = nullptr; /*!< \brief Context that reduces the residuals with those of other solvers. */
+
+  /*!
+   * \brief Set the RMS residuals from the global sums of squares, checking for divergence.
+   * \param[in] sumRes - Sums of squares of the residuals (nVar).
+   * \param[in] nPointGlobal - Number of points of the sums.
+   */
+  void FinalizeResidual_RMS(const su2double* sumRes, unsigned long nPointGlobal);
+
 public:
 
   CSysVector<su2double> LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
@@ -197,6 +218,28 @@ public:
   CSysMatrix<su2double> Jacobian;
   CSysSolve<su2double>  System;
 #endif
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> JacobianStage; /*!< \brief System matrix of the first Rosenbrock stage, reused by the others. */
+#else
+  CSysMatrix<su2double> JacobianStage;
+#endif
+  CSysVector<su2double> LinSysSolStage;    /*!< \brief Increment of the first Rosenbrock stage. */
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> JacobianLagged; /*!< \brief Edge contributions to the Jacobian, reused while it is lagged. */
+#else
+  CSysMatrix<su2double> JacobianLagged;
+#endif
+#ifndef CODI_FORWARD_TYPE
+  vector<CSysVector<su2mixedfloat> > PODBasis;    /*!< \brief POD basis used online (LIBROM_ONLINE), with halos. */
+  vector<CSysVector<su2mixedfloat> > PODBasisJac; /*!< \brief Product of the Jacobian and the POD basis. */
+#else
+  vector<CSysVector<su2double> > PODBasis;
+  vector<CSysVector<su2double> > PODBasisJac;
+#endif
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+  CSysMatrix<su2singlefloat> JacobianSP; /*!< \brief Single precision copy of the Jacobian (LINEAR_SOLVER_SINGLE_PREC). */
+  CSysSolve<su2singlefloat>  SystemSP;   /*!< \brief Linear solver/smoother for the single precision system. */
+#endif
 
   CSysVector<su2double> OutputVariables;    /*!< \brief vector to store the extra variables to be written. */
   string* OutputHeadingNames;               /*!< \brief vector of strings to store the headings for the exra variables */
@@ -232,6 +275,11 @@ public:
     return base_nodes;
   }
 
+  /*!
+   * \brief Memory (bytes) allocated for the point containers of the solver, see CVariable::GetMemoryUsage.
+   */
+  inline size_t GetMemoryUsage() const { return base_nodes ? base_nodes->GetMemoryUsage() : 0; }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -264,6 +312,50 @@ public:
                      const CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Store the data of one received message in the solver class.
+   * \note Uses a worksharing loop, i.e. to be called by all threads of a team, or by a thread outside parallel regions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commType - Enumerated type for the quantity to be unpacked.
+   * \param[in] jRecv    - Index of the message (neighbor).
+   */
+  void UnpackP2PMessage(CGeometry *geometry,
+                        const CConfig *config,
+                        unsigned short commType,
+                        int jRecv);
+
+  /*!
+   * \brief Start the helper thread that unpacks the messages of the deferred exchange as they arrive.
+   * \note To be called by one thread. The thread runs until CompleteDeferredComms, which stops it.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void StartCommProgress(CGeometry *geometry,
+                         const CConfig *config);
+
+  /*!
+   * \brief Leave the next exchange of a quantity in flight, i.e. CompleteComms will return immediately for it.
+   * \note This allows overlapping the exchange with work that does not need halo data. The exchange must
+   *       be completed with CompleteDeferredComms before its data is used, and before any other exchange
+   *       on the same geometry (other exchanges of this solver complete it automatically).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void DeferComms(unsigned short commType);
+
+  /*!
+   * \brief Complete the exchange that was deferred with DeferComms (if it is in flight).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void CompleteDeferredComms(CGeometry *geometry,
+                             const CConfig *config);
+
+  /*!
+   * \brief Check if a deferred exchange is in flight.
+   */
+  inline bool HasDeferredComms() const { return CommsInFlight; }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -296,7 +388,7 @@ public:
    * \brief Routine to complete the set of non-blocking periodic communications launched by InitiatePeriodicComms() and unpacking of the data in the solver class.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config   - Definition of the particular problem.
-   * \param[in] val_periodic_index - Index for the periodic marker to be treated (first in a pair).
+   * \param[in] val_periodic_index - Index for the periodic marker to be treated (first in a pair), 0 for all pairs.
    * \param[in] commType - Enumerated type for the quantity to be unpacked.
    */
   void CompletePeriodicComms(CGeometry *geometry,
@@ -304,6 +396,18 @@ public:
                              unsigned short val_periodic_index,
                              unsigned short commType);
 
+  /*!
+   * \brief Communicate a quantity across all the pairs of periodic markers.
+   * \note If no point lies on more than one pair (CGeometry::disjointPeriodicPairs), all pairs are updated by a
+   *       single exchange, otherwise the pairs are processed in sequence to accumulate their data correctly.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void PeriodicComms(CGeometry *geometry,
+                     const CConfig *config,
+                     unsigned short commType);
+
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -316,12 +420,79 @@ public:
    */
   inline void SetResLinSolver(su2double val_reslinsolver) { ResLinSolver = val_reslinsolver; }
 
+  /*!
+   * \brief Allocate the Jacobian of an edge-based solver, and its single precision copy if the
+   *        linear systems of this type of solver are solved in single precision.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] system - Type of linear system, see LINEAR_SOLVER_SINGLE_PREC.
+   * \param[in] needTranspPtr - If the transpose pointers are needed (edge reducer strategy).
+   * \param[in] segregated - Allocate a scalar Jacobian, only valid if the Jacobian blocks are diagonal and
+   *            have the same entries, the system is then solved once per variable.
+   */
+  void InitializeJacobian(CGeometry *geometry, const CConfig *config, LINEAR_SYSTEM system, bool needTranspPtr,
+                          bool segregated = false);
+
+  /*!
+   * \brief Solve (or smooth) the linear system Jacobian * LinSysSol = LinSysRes, and store the number
+   *        of iterations and the final residual of the linear solver.
+   * \note When the system is solved in single precision the Jacobian is first copied to JacobianSP.
+   * \note For segregated systems each variable is solved in turn, with the same (scalar) Jacobian.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SolveLinearSystem(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Set the Jacobian of this (coarse) solver to the Galerkin product R*A*P of the Jacobian of the finer level,
+   *        where R and P are the agglomeration (piecewise constant) restriction and prolongation.
+   * \param[in] geo_fine - Geometry of the finer level.
+   * \param[in] geo_coarse - Geometry of this level.
+   * \param[in] sol_fine - Solver of the finer level, its Jacobian must not include the pseudo time term.
+   */
+  inline void SetGalerkin_Jacobian(const CGeometry *geo_fine, const CGeometry *geo_coarse, const CSolver *sol_fine) {
+    Jacobian.SetGalerkinProduct(sol_fine->Jacobian, geo_fine, geo_coarse);
+  }
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   void SetResidual_RMS(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Set the context that reduces the residuals of this solver together with those of other solvers,
+   *        SetResidual_RMS then only registers the local residuals, see CResidualReduction.
+   * \param[in] reduction - The context, nullptr to reduce the residuals immediately.
+   */
+  inline void SetResidualReduction(CResidualReduction* reduction) { ResidualReduction = reduction; }
+
+  /*!
+   * \brief Complete the pending residual reductions of the context of this solver (if any).
+   * \note Collective operation, not thread safe.
+   */
+  inline void CompleteResidualReduction() { if (ResidualReduction) ResidualReduction->Complete(); }
+
+  /*!
+   * \brief Get the number of values packed by PackResiduals.
+   */
+  inline unsigned long GetResidualPackSize() const { return nVar * (3ul + nDim); }
+
+  /*!
+   * \brief Pack the local residuals (sums of squares, max, index and coordinates of the max) for a reduction.
+   * \param[out] buf - Buffer of size GetResidualPackSize().
+   */
+  void PackResiduals(su2double* buf) const;
+
+  /*!
+   * \brief Set the global residuals from the packed local residuals of all ranks.
+   * \param[in] buf - Packed residuals of rank 0, those of the other ranks follow every "stride" values.
+   * \param[in] stride - Distance between the residuals of consecutive ranks.
+   * \param[in] nProc - Number of ranks.
+   * \param[in] nPointGlobal - Number of points used to compute the RMS.
+   */
+  void UnpackResiduals(const su2double* buf, unsigned long stride, int nProc, unsigned long nPointGlobal);
+
   /*!
    * \brief Communicate the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -650,6 +821,36 @@ public:
                                                 unsigned short iMesh,
                                                 unsigned short RunTime_EqSystem) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline virtual void Implicit_SpaceTimeIntegration(CGeometry *geometry,
+                                                    CSolver **solver_container,
+                                                    CNumerics **numerics,
+                                                    CConfig *config,
+                                                    unsigned short iMesh,
+                                                    unsigned short RunTime_EqSystem) {}
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline virtual void PMultigrid_Cycle(CGeometry *geometry,
+                                       CSolver **solver_container,
+                                       CNumerics **numerics,
+                                       CConfig *config,
+                                       unsigned short iMesh,
+                                       unsigned short RunTime_EqSystem) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1404,6 +1605,20 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief Stage of a linearly implicit (Rosenbrock) time integration, by default an implicit Euler iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iStage - Index of the stage.
+   */
+  inline virtual void RosenbrockW_Iteration(CGeometry *geometry,
+                                            CSolver **solver_container,
+                                            CConfig *config,
+                                            unsigned short iStage) {
+    if (iStage == 0) ImplicitEuler_Iteration(geometry, solver_container, config);
+  }
+
   /*!
    * \brief Adapt the CFL number based on the local under-relaxation parameters
    *        computed for each nonlinear iteration.
@@ -3359,6 +3574,21 @@ public:
                         const string& filename,
                         unsigned long skipVars);
 
+  /*!
+   * \brief Read the fields of a file in the binary restart format (e.g. the time statistics of the output),
+   *        the solution of the solver is not modified.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] filename - Name of the file (without extension).
+   * \param[out] names - Names of the fields.
+   * \param[out] data - Values of the fields at the domain points (point-major).
+   */
+  void Read_SU2_Restart_Fields(CGeometry *geometry,
+                               const CConfig *config,
+                               const string& filename,
+                               vector<string>& names,
+                               su2passivematrix& data);
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3393,6 +3623,27 @@ public:
                                const CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read a native SU2 restart file in binary format by mapping it into memory (see READ_RESTART_MMAP).
+   * \note Each rank copies its points from the mapped file, without communication, for node-local storage.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file (with extension).
+   */
+  void Read_SU2_Restart_Binary_MMap(CGeometry *geometry,
+                                    const CConfig *config,
+                                    const string& val_filename);
+
+  /*!
+   * \brief Read a step of a time series of native SU2 restarts (see RESTART_TIME_SERIES).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file of the step, i.e. with the time iteration.
+   */
+  void Read_SU2_Restart_TimeSeries(CGeometry *geometry,
+                                   const CConfig *config,
+                                   const string& val_filename);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3458,9 +3709,9 @@ public:
    * \param[in] rhs - Right hand side.
    * \param[in] nVar - Number of variables.
    */
-  void Gauss_Elimination(su2double** A,
-                         su2double* rhs,
-                         unsigned short nVar);
+  static void Gauss_Elimination(su2double** A,
+                                su2double* rhs,
+                                unsigned short nVar);
 
   /*!
    * \brief Prepares and solves the aeroelastic equations.
@@ -3639,6 +3890,13 @@ public:
                                              CNumerics **numerics,
                                              const CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \return Whether the tangent stiffness matrix needs to be updated in this iteration.
+   */
+  inline virtual bool RequiresTangentUpdate(const CConfig *config) const { return true; }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3665,6 +3923,14 @@ public:
    */
   inline virtual void Solve_System(CGeometry *geometry, CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Modal_Iteration(CGeometry *geometry, CNumerics **numerics, const CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    */
@@ -4291,6 +4557,22 @@ public:
    */
   void SavelibROM(CGeometry *geometry, CConfig *config, bool converged);
 
+  /*!
+   * \brief Read the POD basis saved by libROM for its online use (LIBROM_ONLINE).
+   * \note The basis must have been generated with the same mesh partitioning.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReadlibROMBasis(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Least-squares Petrov-Galerkin projection of the linear system on the POD basis, LinSysSol = V q
+   *        with (JV)^T (JV) q = (JV)^T LinSysRes. The cost is one matrix-vector product per basis vector.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SolveReducedSystem(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Interpolate variables to a coarser grid level.
    * \note Halo values are not communicated in this function.
@@ -4301,20 +4583,21 @@ public:
    */
   inline static void MultigridRestriction(const CGeometry& geoFine, const su2activematrix& varsFine,
                                           const CGeometry& geoCoarse, su2activematrix& varsCoarse) {
+    const auto nVar = varsCoarse.cols();
+
     SU2_OMP_FOR_STAT(roundUpDiv(geoCoarse.GetnPointDomain(), omp_get_num_threads()))
     for (auto iPointCoarse = 0ul; iPointCoarse < geoCoarse.GetnPointDomain(); ++iPointCoarse) {
 
-      for (auto iVar = 0ul; iVar < varsCoarse.cols(); iVar++) {
-        varsCoarse(iPointCoarse, iVar) = 0.0;
-      }
+      su2double* coarse = varsCoarse[iPointCoarse];
+      for (auto iVar = 0ul; iVar < nVar; iVar++) coarse[iVar] = 0.0;
+
       const su2double scale = 1 / geoCoarse.nodes->GetVolume(iPointCoarse);
 
-      for (auto iChildren = 0ul; iChildren < geoCoarse.nodes->GetnChildren_CV(iPointCoarse); ++iChildren) {
-        const auto iPointFine = geoCoarse.nodes->GetChildren_CV(iPointCoarse, iChildren);
+      for (const auto iPointFine : geoCoarse.nodes->GetChildren(iPointCoarse)) {
         const su2double w = geoFine.nodes->GetVolume(iPointFine) * scale;
-        for (auto iVar = 0ul; iVar < varsCoarse.cols(); ++iVar) {
-          varsCoarse(iPointCoarse, iVar) += w * varsFine(iPointFine, iVar);
-        }
+        const su2double* fine = varsFine[iPointFine];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse[iVar] += w * fine[iVar];
       }
     }
     END_SU2_OMP_FOR
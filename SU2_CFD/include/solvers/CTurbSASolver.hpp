@@ -41,6 +41,19 @@ class CTurbSASolver final : public CTurbSolver {
 private:
   su2double nu_tilde_Engine, nu_tilde_ActDisk;
 
+  /*--- Geometric part of the hybrid RANS-LES length scales, computed once per mesh. ---*/
+
+  vector<unsigned long> DES_NeighborPtr; /*!< \brief Start of the neighbors of each point in DES_NeighborDelta. */
+  su2activematrix DES_NeighborDelta;     /*!< \brief Absolute coordinate differences to each neighbor (SA-EDDES). */
+  su2activematrix DES_MaxDelta;          /*!< \brief Largest coordinate differences to the neighbors (SA-ZDES). */
+
+  /*!
+   * \brief Compute the geometric quantities of the DES length scales that only depend on the mesh.
+   * \param[in] geometry - Geometrical definition.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDES_Geometry(const CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Solver container
@@ -65,6 +78,13 @@ private:
                      const CConfig *config,
                      unsigned short val_marker);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability.
@@ -54,6 +54,13 @@ private:
                      const CConfig *config,
                      unsigned short val_marker);
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
 public:
   /*!
    * \brief Constructor.
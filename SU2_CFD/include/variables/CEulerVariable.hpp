@@ -92,6 +92,35 @@ class CEulerVariable : public CFlowVariable {
   CEulerVariable(su2double density, const su2double *velocity, su2double energy,
                  unsigned long npoint, unsigned long ndim, unsigned long nvar, const CConfig *config);
 
+  /*!
+   * \brief Memory (bytes) allocated for the point containers.
+   */
+  size_t GetMemoryUsage() const override;
+
+  /*!
+   * \brief Register the inputs of the point-wise closure (SetPrimVar and SetSecondaryVar) in a
+   *        preaccumulation section, i.e. the current and old (for non-physical states) solution.
+   * \param[in] iPoint - Point index.
+   */
+  inline void SetPrimVarPreaccIn(unsigned long iPoint) const {
+    AD::SetPreaccIn(Solution[iPoint], nVar);
+    AD::SetPreaccIn(Solution_Old[iPoint], nVar);
+  }
+
+  /*!
+   * \brief Register the outputs of the point-wise closure, only the variables it sets, i.e. the
+   *        primitives up to the speed of sound (Euler) or up to Cp (NS), and the secondaries.
+   * \param[in] iPoint - Point index.
+   * \param[in] physical - False if SetPrimVar reverted to the old solution, which is then also an output.
+   */
+  inline void SetPrimVarPreaccOut(unsigned long iPoint, bool physical) {
+    const auto nPrimVarSet = (nSecondaryVar == 2 ? indices.SoundSpeed() : indices.CpTotal()) + 1;
+    AD::SetPreaccOut(Primitive[iPoint], nPrimVarSet);
+    AD::SetPreaccOut(Secondary[iPoint], nSecondaryVar);
+    AD::SetPreaccOut(Velocity2(iPoint));
+    if (!physical) AD::SetPreaccOut(Solution[iPoint], nVar);
+  }
+
   /*!
    * \brief A virtual member.
    */
@@ -286,6 +315,7 @@ class CEulerVariable : public CFlowVariable {
    * \param[in] iPoint - Point index.
    */
   inline void SetVel_ResTruncError_Zero(unsigned long iPoint) final {
+    if (!TruncErrorAllocated()) return;
     for (unsigned long iDim = 0; iDim < nDim; iDim++) Res_TruncError(iPoint,iDim+1) = 0.0;
   }
 
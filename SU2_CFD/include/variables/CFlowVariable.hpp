@@ -42,6 +42,10 @@ class CFlowVariable : public CVariable {
   CVectorOfMatrix
       Gradient_Aux; /*!< \brief Auxiliary structure to store a second gradient for reconstruction, if required. */
   MatrixType Limiter_Primitive; /*!< \brief Limiter of the primitive variables. */
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  C3DSingleMatrix Gradient_ReconstructionSP;   /*!< \brief Single precision copy of Gradient_Reconstruction. */
+  su2matrix<su2singlefloat> Limiter_PrimitiveSP; /*!< \brief Single precision copy of Limiter_Primitive. */
+#endif
   VectorType Velocity2;         /*!< \brief Squared norm of velocity. */
 
   MatrixType Solution_New; /*!< \brief New solution container for Classical RK4. */
@@ -67,6 +71,11 @@ class CFlowVariable : public CVariable {
 
  public:
   mutable su2vector<int8_t> NonPhysicalEdgeCounter;  /*!< \brief Non-physical reconstruction counter for each edge. */
+
+  /*!
+   * \brief Memory (bytes) allocated for the point containers.
+   */
+  size_t GetMemoryUsage() const override;
   /*!
    * \brief Updates the non-physical counter of an edge.
    * \param[in] iEdge - Edge index.
@@ -202,6 +211,31 @@ class CFlowVariable : public CVariable {
   inline MatrixType& GetLimiter_Primitive() final { return Limiter_Primitive; }
   inline const MatrixType& GetLimiter_Primitive() const final { return Limiter_Primitive; }
 
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  /*!
+   * \brief Whether the reconstruction data has a single precision copy (MUSCL_FLOW_SINGLE_PREC).
+   */
+  inline bool GetReconstructionSinglePrec() const { return Gradient_ReconstructionSP.size() > 0; }
+
+  /*!
+   * \brief Copy the reconstruction gradients and limiters of a range of points to single precision.
+   * \note Must be called inside a parallel region, after the gradients and limiters of the points are final.
+   * \param[in] pointBegin - First point of the range.
+   * \param[in] pointEnd - End of the range (one past the last point).
+   */
+  void CopyReconstructionSinglePrec(unsigned long pointBegin, unsigned long pointEnd);
+
+  /*!
+   * \brief Get the single precision copy of the reconstruction gradient.
+   */
+  inline const C3DSingleMatrix& GetGradient_ReconstructionSP() const { return Gradient_ReconstructionSP; }
+
+  /*!
+   * \brief Get the single precision copy of the primitive variables limiter.
+   */
+  inline const su2matrix<su2singlefloat>& GetLimiter_PrimitiveSP() const { return Limiter_PrimitiveSP; }
+#endif
+
   /*!
    * \brief Get the new solution of the problem (Classical RK4).
    * \param[in] iPoint - Point index.
@@ -317,6 +317,11 @@ class CNEMOEulerVariable : public CFlowVariable {
    */
   inline su2double *GetEve(unsigned long iPoint) { return eves[iPoint]; }
 
+  /*!
+   * \brief Get the vib-el energy of the species of all points (vectorized numerics).
+   */
+  inline const MatrixType& GetEve() const { return eves; }
+
   /*!
    * \brief Returns the value of Cvve at the specified node
    */
@@ -327,6 +332,11 @@ class CNEMOEulerVariable : public CFlowVariable {
    */
   inline su2double *GetdPdU(unsigned long iPoint) final { return dPdU[iPoint]; }
 
+  /*!
+   * \brief Get the derivatives of pressure w.r.t. the conservative variables of all points (vectorized numerics).
+   */
+  inline const MatrixType& GetdPdU() const { return dPdU; }
+
   /*!
    * \brief Set partial derivative of temperature w.r.t. density \f$\frac{\partial T}{\partial \rho_s}\f$
    */
@@ -420,6 +430,7 @@ class CNEMOEulerVariable : public CFlowVariable {
    * \param[in] iPoint - Point index.
    */
   inline void SetVel_ResTruncError_Zero(unsigned long iPoint) final {
+    if (!TruncErrorAllocated()) return;
     for (unsigned long iDim = 0; iDim < nDim; iDim++) Res_TruncError(iPoint,nSpecies+iDim) = 0.0;
   }
 
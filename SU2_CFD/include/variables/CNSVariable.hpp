@@ -44,6 +44,10 @@ private:
   VectorType Roe_Dissipation; /*!< \brief Roe low dissipation coefficient. */
   VectorType Vortex_Tilting;  /*!< \brief Value of the vortex tilting variable for DES length scale computation. */
 
+  su2double TransportTol = 0.0;   /*!< \brief Relative change of T and rho below which mu and kt are reused. */
+  MatrixType TransportState;      /*!< \brief T and rho at which mu and kt were last evaluated. */
+  su2vector<bool> TransportReused; /*!< \brief Whether mu and kt were reused in the last update of the point. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -58,6 +62,11 @@ public:
   CNSVariable(su2double density, const su2double *velocity, su2double energy,
               unsigned long npoint, unsigned long ndim, unsigned long nvar, const CConfig *config);
 
+  /*!
+   * \brief Memory (bytes) allocated for the point containers.
+   */
+  size_t GetMemoryUsage() const override;
+
   /*!
    * \brief Set the laminar viscosity.
    */
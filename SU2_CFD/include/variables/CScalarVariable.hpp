@@ -42,6 +42,12 @@ class CScalarVariable : public CVariable {
   CVectorOfMatrix
       Gradient_Aux; /*!< \brief Auxiliary structure to store a second gradient for reconstruction, if required. */
 
+  /*!
+   * \brief Allocate the slope limiter and the auxiliary min/max, if the solver uses a limiter.
+   * \param[in] kindLimiter - Slope limiter of the particular solver.
+   */
+  void AllocateLimiter(LIMITER kindLimiter);
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -52,6 +58,11 @@ class CScalarVariable : public CVariable {
    */
   CScalarVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, const CConfig* config);
 
+  /*!
+   * \brief Memory (bytes) allocated for the point containers.
+   */
+  size_t GetMemoryUsage() const override;
+
   /*!
    * \brief Get the array of the reconstruction variables gradient at a node.
    * \param[in] iPoint - Index of the current node.
@@ -77,6 +77,7 @@ public:
    * \brief Get the first blending function.
    */
   inline su2double GetF1blending(unsigned long iPoint) const override { return F1(iPoint); }
+  inline const VectorType& GetF1blending() const { return F1; }
 
   /*!
    * \brief Get the second blending function.
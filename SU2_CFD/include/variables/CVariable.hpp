@@ -86,7 +86,8 @@ protected:
   VectorType Sensor;               /*!< \brief Pressure sensor for high order central scheme and Roe dissipation. */
   MatrixType Undivided_Laplacian;  /*!< \brief Undivided laplacian of the solution. */
 
-  MatrixType Res_TruncError;  /*!< \brief Truncation error for multigrid cycle. */
+  MatrixType Res_TruncError;  /*!< \brief Truncation error for multigrid cycle (only allocated with multigrid). */
+  VectorType NoTruncError;    /*!< \brief Zero truncation error returned when Res_TruncError is not allocated. */
   MatrixType Residual_Old;    /*!< \brief Auxiliary structure for residual smoothing. */
   MatrixType Residual_Sum;    /*!< \brief Auxiliary structure for residual smoothing. */
 
@@ -137,6 +138,16 @@ protected:
     RegisterContainer(input, variable, &ad_index);
   }
 
+  /*!
+   * \brief Bytes allocated by a number of containers.
+   */
+  inline static size_t MemoryOf() { return 0; }
+
+  template <class Container, class... Containers>
+  inline static size_t MemoryOf(const Container& container, const Containers&... others) {
+    return container.size() * sizeof(typename Container::Scalar) + MemoryOf(others...);
+  }
+
 public:
   /*--- Disable copy and assignment. ---*/
   CVariable(const CVariable&) = delete;
@@ -167,6 +178,12 @@ public:
    */
   virtual ~CVariable() = default;
 
+  /*!
+   * \brief Memory (bytes) allocated for the point containers, to report the footprint of the solvers.
+   * \note Derived classes add the containers they own.
+   */
+  virtual size_t GetMemoryUsage() const;
+
   /*!
    * \brief Get the number of auxiliary variables.
    */
@@ -275,6 +292,13 @@ public:
    */
   void Set_Solution_time_n1();
 
+  /*!
+   * \brief Advance the time levels, the solution at time n becomes n-1 and the current solution becomes n.
+   * \note Same as Set_Solution_time_n1 followed by Set_Solution_time_n, but the storage of the two levels is
+   *       swapped instead of copied, i.e. references to the containers remain valid but not pointers to their data.
+   */
+  void Shift_Solution_time_n();
+
   /*!
    * \brief Set the variable solution at time n.
    * \param[in] iPoint - Point index.
@@ -664,6 +688,7 @@ public:
    * \param[in] iPoint - Point index.
    */
   inline void SetRes_TruncErrorZero(unsigned long iPoint) {
+    if (!TruncErrorAllocated()) return;
     for (unsigned long iVar = 0; iVar < nVar; iVar++) Res_TruncError(iPoint, iVar) = 0.0;
   }
 
@@ -671,7 +696,9 @@ public:
    * \brief Set the truncation error to zero.
    * \param[in] iPoint - Point index.
    */
-  inline void SetVal_ResTruncError_Zero(unsigned long iPoint, unsigned long iVar) {Res_TruncError(iPoint, iVar) = 0.0;}
+  inline void SetVal_ResTruncError_Zero(unsigned long iPoint, unsigned long iVar) {
+    if (TruncErrorAllocated()) Res_TruncError(iPoint, iVar) = 0.0;
+  }
 
   /*!
    * \brief Set the momentum part of the truncation error to zero.
@@ -683,14 +710,18 @@ public:
    * \brief Set the velocity of the truncation error to zero.
    * \param[in] iPoint - Point index.
    */
-  inline void SetEnergy_ResTruncError_Zero(unsigned long iPoint) { Res_TruncError(iPoint,nDim+1) = 0.0;}
+  inline void SetEnergy_ResTruncError_Zero(unsigned long iPoint) {
+    if (TruncErrorAllocated()) Res_TruncError(iPoint,nDim+1) = 0.0;
+  }
 
   /*!
    * \brief Get the truncation error.
    * \param[in] iPoint - Point index.
-   * \return Pointer to the truncation error.
+   * \return Pointer to the truncation error, zeros on single grids.
    */
-  inline su2double *GetResTruncError(unsigned long iPoint) { return Res_TruncError[iPoint]; }
+  inline const su2double *GetResTruncError(unsigned long iPoint) const {
+    return TruncErrorAllocated() ? Res_TruncError[iPoint] : NoTruncError.data();
+  }
 
   /*!
    * \brief Get the truncation error.
@@ -698,10 +729,16 @@ public:
    * \param[in] val_trunc_error - Pointer to the truncation error.
    */
   inline void GetResTruncError(unsigned long iPoint, su2double *val_trunc_error) const {
+    const su2double* truncError = GetResTruncError(iPoint);
     for (unsigned long iVar = 0; iVar < nVar; iVar++)
-      val_trunc_error[iVar] = Res_TruncError(iPoint, iVar);
+      val_trunc_error[iVar] = truncError[iVar];
   }
 
+  /*!
+   * \brief Whether the truncation error is stored, i.e. with multigrid.
+   */
+  inline bool TruncErrorAllocated() const { return Res_TruncError.size() != 0; }
+
   /*!
    * \brief Set the gradient of the solution.
    * \param[in] iPoint - Point index.
@@ -718,6 +755,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -764,6 +802,7 @@ public:
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
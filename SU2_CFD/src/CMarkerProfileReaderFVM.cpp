@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "../include/CMarkerProfileReaderFVM.hpp"
+#include "../../Common/include/toolboxes/CLinearPartitioner.hpp"
 
 CMarkerProfileReaderFVM::CMarkerProfileReaderFVM(CGeometry      *val_geometry,
                                                  CConfig        *val_config,
@@ -35,7 +36,8 @@ CMarkerProfileReaderFVM::CMarkerProfileReaderFVM(CGeometry      *val_geometry,
                                                  unsigned short val_kind_marker,
                                                  unsigned short val_number_vars,
                                                  vector<string> val_columnNames,
-                                                 vector<string> val_columnValues) {
+                                                 vector<string> val_columnValues,
+                                                 bool           val_distributed) {
 
   /*--- Store input values and pointers to class data. ---*/
 
@@ -51,6 +53,7 @@ CMarkerProfileReaderFVM::CMarkerProfileReaderFVM(CGeometry      *val_geometry,
   numberOfVars = val_number_vars;
   columnNames  = std::move(val_columnNames);
   columnValues = std::move(val_columnValues);
+  distributed  = val_distributed;
 
   /* Attempt to open the specified file. */
   ifstream profile_file;
@@ -140,10 +143,18 @@ void CMarkerProfileReaderFVM::ReadMarkerProfile() {
     SU2_MPI::Error("While opening profile file, no \"NMARK=\" specification was found", CURRENT_FUNCTION);
   }
 
-  /*--- Compute array bounds and offsets. Allocate data structure. ---*/
+  /*--- Compute array bounds and offsets. Allocate data structure. In distributed mode each
+   rank only keeps a linear partition of the rows of each profile. ---*/
+
+  vector<unsigned long> firstRow(numberOfProfiles, 0), totalRows = numberOfRowsInProfile;
 
   profileData.resize(numberOfProfiles);
   for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
+    if (distributed) {
+      const CLinearPartitioner partitioner(totalRows[iMarker], 0);
+      firstRow[iMarker] = partitioner.GetFirstIndexOnRank(rank);
+      numberOfRowsInProfile[iMarker] = partitioner.GetSizeOnRank(rank);
+    }
     profileData[iMarker].resize(numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker], 0.0);
   }
 
@@ -170,10 +181,16 @@ void CMarkerProfileReaderFVM::ReadMarkerProfile() {
 
         /*--- Now read the data for each row and store. ---*/
 
-        for (unsigned long iRow = 0; iRow < numberOfRowsInProfile[iMarker]; iRow++) {
+        for (unsigned long jRow = 0; jRow < totalRows[iMarker]; jRow++) {
 
           getline (profile_file, text_line);
 
+          /*--- Skip the rows of other ranks. ---*/
+
+          if (jRow < firstRow[iMarker]) continue;
+          const auto iRow = jRow - firstRow[iMarker];
+          if (iRow >= numberOfRowsInProfile[iMarker]) continue;
+
           istringstream point_line(text_line);
 
           /*--- Store the values (starting with node coordinates) --*/
@@ -43,6 +43,7 @@ int main(int argc, char *argv[]) {
   bool dry_run = false;
   int num_threads = omp_get_max_threads();
   bool use_thread_mult = false;
+  bool report_affinity = false;
   std::string filename = "default.cfg";
 
   /*--- Command line parsing ---*/
@@ -52,6 +53,7 @@ int main(int argc, char *argv[]) {
                                        "Only execute preprocessing steps using a dummy geometry.");
   app.add_option("-t,--threads", num_threads, "Number of OpenMP threads per MPI rank.");
   app.add_flag("--thread_multiple", use_thread_mult, "Request MPI_THREAD_MULTIPLE thread support.");
+  app.add_flag("--affinity", report_affinity, "Report the CPU and NUMA node of each OpenMP thread.");
   app.add_option("configfile", filename, "A config file.")->check(CLI::ExistingFile);
 
   CLI11_PARSE(app, argc, argv)
@@ -71,6 +73,8 @@ int main(int argc, char *argv[]) {
 #endif
   SU2_MPI::Comm MPICommunicator = SU2_MPI::GetComm();
 
+  if (report_affinity) omp_report_affinity();
+
   /*--- Further initializations are placed in the constructor of CDriverBase, to ensure that they are also seen by the
    python wrapper. */
 
@@ -85,6 +89,7 @@ int main(int argc, char *argv[]) {
   /*--- Create a pointer to the main SU2 Driver ---*/
 
   CDriver* driver = nullptr;
+  SU2_Comm sliceComm = MPICommunicator, timeComm = MPICommunicator;
 
   /*--- Load in the number of zones and spatial dimensions in the mesh file (If no config
    file is specified, default.cfg is used) ---*/
@@ -120,6 +125,23 @@ int main(int argc, char *argv[]) {
     if (disc_adj) {
       driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
+    else if (config.GetParareal_Slices() > 1) {
+
+      /*--- Parallel in time, the ranks of a time slice are contiguous, the time communicator connects the ranks
+       with the same position in all slices. ---*/
+#ifdef HAVE_MPI
+      int rank = 0, size = 1;
+      MPI_Comm_rank(MPICommunicator, &rank);
+      MPI_Comm_size(MPICommunicator, &size);
+      const int nSlices = config.GetParareal_Slices();
+      if (size % nSlices != 0)
+        SU2_MPI::Error("The number of MPI ranks must be a multiple of PARAREAL_SLICES.", CURRENT_FUNCTION);
+      const int sliceSize = size / nSlices;
+      MPI_Comm_split(MPICommunicator, rank / sliceSize, rank, &sliceComm);
+      MPI_Comm_split(MPICommunicator, rank % sliceSize, rank, &timeComm);
+#endif
+      driver = new CPararealDriver(config_file_name, nZone, sliceComm, timeComm);
+    }
     else {
       driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
@@ -154,6 +176,13 @@ int main(int argc, char *argv[]) {
 
   delete driver;
 
+#ifdef HAVE_MPI
+  if (sliceComm != MPICommunicator) {
+    MPI_Comm_free(&sliceComm);
+    MPI_Comm_free(&timeComm);
+  }
+#endif
+
   /*---Finalize libxsmm, if supported. ---*/
 #ifdef HAVE_LIBXSMM
   libxsmm_finalize();
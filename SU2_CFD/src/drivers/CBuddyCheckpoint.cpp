@@ -0,0 +1,222 @@
+/*!
+ * \file CBuddyCheckpoint.cpp
+ * \brief In-memory (buddy) checkpoints of the solution for fast recovery after failures.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CBuddyCheckpoint.hpp"
+#include "../../include/solvers/CSolver.hpp"
+#include <cstdio>
+#include <fstream>
+#include <functional>
+
+namespace {
+/*!
+ * \brief Visit the matrices that make up the state of the solvers, in the same order on all ranks.
+ */
+template <class F>
+void ForEachState(CSolver*** solvers, unsigned short nMesh, F&& f) {
+  for (unsigned short iMesh = 0; iMesh < nMesh; ++iMesh) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; ++iSol) {
+      if (solvers[iMesh][iSol] == nullptr) continue;
+      auto* nodes = solvers[iMesh][iSol]->GetNodes();
+      f(nodes->GetSolution());
+      f(nodes->GetSolution_time_n());
+      f(nodes->GetSolution_time_n1());
+    }
+  }
+}
+}  // namespace
+
+CBuddyCheckpoint::CBuddyCheckpoint(const CConfig& config) {
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+  frequency = config.GetBuddy_Checkpoint_Freq();
+  if (frequency == 0) return;
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  const bool supported = false;
+#else
+  const bool supported = config.GetTime_Domain() && !config.GetDiscrete_Adjoint() && !config.GetFEMSolver() &&
+                         !config.GetDeform_Mesh() && !config.GetBuddy_Checkpoint_Dir().empty();
+#endif
+  if (!supported) {
+    if (rank == MASTER_NODE) {
+      cout << "WARNING: Buddy checkpoints are only available for time-domain primal problems without "
+              "mesh deformation, BUDDY_CHECKPOINT_FREQ will be ignored." << endl;
+    }
+    return;
+  }
+  enabled = true;
+
+  /*--- The files are named after the mesh (and number of ranks) to avoid mixing cases that share the directory. ---*/
+  const auto hash = std::hash<std::string>{}(config.GetMesh_FileName()) ^ static_cast<size_t>(size);
+  const auto tag = static_cast<unsigned long>(hash & 0xFFFFFFFFul);
+  caseTag = tag;
+  prefix = config.GetBuddy_Checkpoint_Dir() + "/su2_ckpt_" + std::to_string(tag) + "_";
+}
+
+std::string CBuddyCheckpoint::FileName(int owner, bool copy) const {
+  return prefix + std::to_string(owner) + (copy ? ".buddy" : ".own");
+}
+
+bool CBuddyCheckpoint::WriteFile(const std::string& fileName, const std::vector<passivedouble>& data) const {
+  /*--- A failure while writing cannot corrupt the previous checkpoint. ---*/
+  const auto tmpName = fileName + ".tmp";
+  {
+    std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(passivedouble));
+    if (!file) return false;
+  }
+  return std::rename(tmpName.c_str(), fileName.c_str()) == 0;
+}
+
+bool CBuddyCheckpoint::ReadFile(const std::string& fileName, std::vector<passivedouble>& data) const {
+  std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+  if (!file) return false;
+  const auto bytes = static_cast<size_t>(file.tellg());
+  if (bytes < HEADER_SIZE * sizeof(passivedouble) || bytes % sizeof(passivedouble) != 0) return false;
+
+  data.resize(bytes / sizeof(passivedouble));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(data.data()), bytes);
+
+  return file && (data[0] == caseTag) && (data[2] == static_cast<passivedouble>(data.size() - HEADER_SIZE));
+}
+
+void CBuddyCheckpoint::Store(CSolver*** solvers, unsigned short nMesh, unsigned long timeIter) {
+
+  if (!enabled) return;
+
+  /*--- Pack the state of this rank. ---*/
+
+  ownData.resize(HEADER_SIZE);
+  ForEachState(solvers, nMesh, [&](const su2activematrix& mat) {
+    for (size_t i = 0; i < mat.size(); ++i) ownData.push_back(SU2_TYPE::GetValue(mat.data()[i]));
+  });
+  ownData[0] = caseTag;
+  ownData[1] = timeIter;
+  ownData[2] = ownData.size() - HEADER_SIZE;
+
+  /*--- Send it to the next rank and receive the state of the previous one. ---*/
+
+  const int next = (rank + 1) % size, prev = (rank + size - 1) % size;
+  int sendCount = ownData.size(), recvCount = 0;
+  SU2_MPI::Sendrecv(&sendCount, 1, MPI_INT, next, 0, &recvCount, 1, MPI_INT, prev, 0,
+                    SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+  buddyData.resize(recvCount);
+  SU2_MPI::Sendrecv(ownData.data(), sendCount, MPI_DOUBLE, next, 1, buddyData.data(), recvCount, MPI_DOUBLE, prev, 1,
+                    SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+  if (!(WriteFile(FileName(rank, false), ownData) && WriteFile(FileName(prev, true), buddyData)) && !warnedWrite) {
+    cout << "WARNING: Rank " << rank << " could not write its buddy checkpoint (" << prefix << "*)." << endl;
+    warnedWrite = true;
+  }
+}
+
+bool CBuddyCheckpoint::Recover(CSolver*** solvers, unsigned short nMesh, unsigned long& timeIter) {
+
+  if (!enabled) return false;
+
+  const int next = (rank + 1) % size, prev = (rank + size - 1) % size;
+
+  /*--- Find out which states are available. ---*/
+
+  const bool hasOwn = ReadFile(FileName(rank, false), ownData);
+  const bool hasCopy = ReadFile(FileName(prev, true), buddyData);
+
+  const int flags[] = {hasOwn, hasCopy};
+  std::vector<int> allFlags(2 * size);
+  SU2_MPI::Allgather(flags, 2, MPI_INT, allFlags.data(), 2, MPI_INT, SU2_MPI::GetComm());
+
+  /*--- The copy of the state of rank r is kept by rank r+1. ---*/
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (!allFlags[2 * iRank] && !allFlags[2 * ((iRank + 1) % size) + 1]) return false;
+  }
+
+  /*--- Get the lost states from the buddies. ---*/
+
+  const bool sendCopy = !allFlags[2 * prev];
+  if (size == 1) {
+    if (!hasOwn) ownData.swap(buddyData);
+  } else {
+    int count = buddyData.size();
+    SU2_MPI::Request req[2];
+    int nReq = 0;
+    if (!hasOwn) SU2_MPI::Irecv(&count, 1, MPI_INT, next, 0, SU2_MPI::GetComm(), &req[nReq++]);
+    if (sendCopy) SU2_MPI::Isend(&count, 1, MPI_INT, prev, 0, SU2_MPI::GetComm(), &req[nReq++]);
+    SU2_MPI::Waitall(nReq, req, MPI_STATUS_IGNORE);
+
+    nReq = 0;
+    if (!hasOwn) {
+      ownData.resize(count);
+      SU2_MPI::Irecv(ownData.data(), count, MPI_DOUBLE, next, 1, SU2_MPI::GetComm(), &req[nReq++]);
+    }
+    if (sendCopy) {
+      SU2_MPI::Isend(buddyData.data(), buddyData.size(), MPI_DOUBLE, prev, 1, SU2_MPI::GetComm(), &req[nReq++]);
+    }
+    SU2_MPI::Waitall(nReq, req, MPI_STATUS_IGNORE);
+  }
+
+  /*--- All states must be of the same time iteration and match the current solvers. ---*/
+
+  unsigned long nValues = 0;
+  ForEachState(solvers, nMesh, [&](const su2activematrix& mat) { nValues += mat.size(); });
+
+  const bool valid = (ownData.size() == HEADER_SIZE + nValues) && (ownData[0] == caseTag);
+  const unsigned long localIter = valid ? static_cast<unsigned long>(ownData[1]) : 0;
+
+  /*--- The min of the complement gives the max. ---*/
+  unsigned long iterRange[] = {localIter, ~localIter}, globalRange[2];
+  SU2_MPI::Allreduce(iterRange, globalRange, 2, MPI_UNSIGNED_LONG, MPI_MIN, SU2_MPI::GetComm());
+
+  const int localValid = valid;
+  int allValid = 0;
+  SU2_MPI::Allreduce(&localValid, &allValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (!allValid || (globalRange[0] != ~globalRange[1])) {
+    if (rank == MASTER_NODE) cout << "WARNING: The buddy checkpoints are inconsistent, they will not be used." << endl;
+    return false;
+  }
+
+  /*--- Unpack. ---*/
+
+  auto pos = static_cast<size_t>(HEADER_SIZE);
+  ForEachState(solvers, nMesh, [&](su2activematrix& mat) {
+    for (size_t i = 0; i < mat.size(); ++i) mat.data()[i] = ownData[pos++];
+  });
+  timeIter = localIter;
+
+  if (rank == MASTER_NODE) {
+    cout << "Recovered the state of time iteration " << timeIter << " from the buddy checkpoints." << endl;
+  }
+  return true;
+}
+
+void CBuddyCheckpoint::Clear() {
+  if (!enabled) return;
+  std::remove(FileName(rank, false).c_str());
+  std::remove(FileName((rank + size - 1) % size, true).c_str());
+}
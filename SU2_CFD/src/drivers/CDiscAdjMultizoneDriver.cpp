@@ -30,6 +30,7 @@
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIterationFactory.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
 
 CDiscAdjMultizoneDriver::CDiscAdjMultizoneDriver(char* confFile,
                                                  unsigned short val_nZone,
@@ -144,6 +145,9 @@ void CDiscAdjMultizoneDriver::Preprocess(unsigned long TimeIter) {
                                                    grid_movement, FFDBox, iZone, INST_0);
   }
 
+  /*--- The primal solution changed, the tape needs to be recorded again. ---*/
+  RecordingState = RECORDING::CLEAR_INDICES;
+
   if (TimeIter) {
     /*--- Reset cross-terms before new time iterations. ---*/
     for (auto& matOfMat : Cross_Terms)
@@ -200,6 +204,21 @@ void CDiscAdjMultizoneDriver::StartSolver() {
     }
   }
 
+  /*--- One tape w.r.t. solution and mesh coordinates avoids recording again for the objective function
+   *    gradient and the sensitivities, the mesh deformation and structural recordings are not combined. ---*/
+
+  if (driver_config->GetCombined_Recording_Disc()) {
+    bool combine = true;
+    for (iZone = 0; iZone < nZone; iZone++) {
+      combine &= !config_container[iZone]->GetDeform_Mesh() && !config_container[iZone]->GetStructuralProblem();
+    }
+    if (combine) {
+      MainVariables = RECORDING::SOLUTION_AND_MESH;
+    } else if (rank == MASTER_NODE) {
+      cout << "WARNING: COMBINED_RECORDING_DISC is not available with mesh deformation or structural zones." << endl;
+    }
+  }
+
   /*--- Size and initialize the matrix of cross-terms. ---*/
 
   InitializeCrossTerms();
@@ -342,7 +361,8 @@ void CDiscAdjMultizoneDriver::Run() {
      *    (1) CLEAR_INDICES: All information from a previous recording is removed.
      *    (2) SOLUTION_VARIABLES: State variables of all solvers in a zone as input.
      *    (3) MESH_COORDS / MESH_DEFORM: Mesh coordinates as input.
-     *    (4) SOLUTION_AND_MESH: Mesh coordinates and state variables as input.
+     *    (4) SOLUTION_AND_MESH: Mesh coordinates and state variables as input (COMBINED_RECORDING_DISC),
+     *        the same tape then also gives the objective function gradient and the sensitivities.
      *
      *    By default, all (state and mesh coordinate variables) will be declared as output,
      *    since it does not change the computational effort, just the memory consumption of the tape. ---*/
@@ -351,9 +371,9 @@ void CDiscAdjMultizoneDriver::Run() {
     /*--- If we want to set up zone-specific tapes (retape), we do not need to record
      *    here. Otherwise, the whole tape of a coupled run will be created. ---*/
 
-    if (RecordingState != RECORDING::SOLUTION_VARIABLES) {
+    if (RecordingState != MainVariables) {
       SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
-      SetRecording(RECORDING::SOLUTION_VARIABLES, Kind_Tape::FULL_TAPE, ZONE_0);
+      SetRecording(MainVariables, Kind_Tape::FULL_TAPE, ZONE_0);
     }
 
     /*-- Start loop over zones. ---*/
@@ -463,11 +483,20 @@ void CDiscAdjMultizoneDriver::Run() {
 
 bool CDiscAdjMultizoneDriver::EvaluateObjectiveFunctionGradient() {
 
-  /*--- Evaluate the objective function gradient w.r.t. the solutions of all zones. ---*/
+  /*--- Evaluate the objective function gradient w.r.t. the solutions of all zones. The combined
+   *    recording contains the objective function, otherwise a tape with only that part is recorded. ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::OBJECTIVE_FUNCTION_TAPE, ZONE_0);
-  SetRecording(RECORDING::SOLUTION_VARIABLES, Kind_Tape::OBJECTIVE_FUNCTION_TAPE, ZONE_0);
-  RecordingState = RECORDING::CLEAR_INDICES;
+  if (MainVariables == RECORDING::SOLUTION_AND_MESH) {
+    if (RecordingState != MainVariables) {
+      SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
+      SetRecording(MainVariables, Kind_Tape::FULL_TAPE, ZONE_0);
+    }
+  }
+  else {
+    SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::OBJECTIVE_FUNCTION_TAPE, ZONE_0);
+    SetRecording(RECORDING::SOLUTION_VARIABLES, Kind_Tape::OBJECTIVE_FUNCTION_TAPE, ZONE_0);
+    RecordingState = RECORDING::CLEAR_INDICES;
+  }
 
   AD::ClearAdjoints();
   SetAdjObjFunction();
@@ -497,13 +526,16 @@ bool CDiscAdjMultizoneDriver::EvaluateObjectiveFunctionGradient() {
 void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long Iter, bool force_writing) {
 
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
-   *    as argument ensures that all information from a previous recording is removed. ---*/
+   *    as argument ensures that all information from a previous recording is removed.
+   *    The combined recording already has the mesh coordinates as input. ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
+  if (RecordingState != RECORDING::SOLUTION_AND_MESH) {
+    SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
 
-  /*--- Store the computational graph of one direct iteration with the mesh coordinates as input. ---*/
+    /*--- Store the computational graph of one direct iteration with the mesh coordinates as input. ---*/
 
-  SetRecording(RECORDING::MESH_COORDS, Kind_Tape::FULL_TAPE, ZONE_0);
+    SetRecording(RECORDING::MESH_COORDS, Kind_Tape::FULL_TAPE, ZONE_0);
+  }
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
@@ -589,6 +621,7 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
     case RECORDING::CLEAR_INDICES:      cout << "Clearing the computational graph." << endl; break;
     case RECORDING::MESH_COORDS:        cout << "Storing computational graph wrt MESH COORDINATES." << endl; break;
     case RECORDING::SOLUTION_VARIABLES: cout << "Storing computational graph wrt CONSERVATIVE VARIABLES." << endl; break;
+    case RECORDING::SOLUTION_AND_MESH:  cout << "Storing computational graph wrt CONSERVATIVE VARIABLES and MESH COORDINATES." << endl; break;
     default: break;
     }
   }
@@ -599,6 +632,8 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
 
     AD::StartRecording();
 
+    if (driver_config->GetWrt_AD_Statistics()) CTapeStatistics::Enable();
+
     AD::Push_TapePosition(); /// START
 
     for (iZone = 0; iZone < nZone; iZone++) {
@@ -631,7 +666,11 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
    *    It is necessary to include data transfer and mesh updates in this section as some functions
    *    computed in one zone depend explicitly on the variables of others through that path. --- */
 
-  if ((tape_type == Kind_Tape::OBJECTIVE_FUNCTION_TAPE) || (kind_recording == RECORDING::MESH_COORDS)) {
+  const bool record_obj = (tape_type == Kind_Tape::OBJECTIVE_FUNCTION_TAPE) ||
+                          (kind_recording == RECORDING::MESH_COORDS) ||
+                          (kind_recording == RECORDING::SOLUTION_AND_MESH);
+
+  if (record_obj) {
     HandleDataTransfer();
     for (iZone = 0; iZone < nZone; iZone++) {
       if (Has_Deformation(iZone)) {
@@ -650,7 +689,7 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
      *    For recording w.r.t. mesh coordinates the transfer was included before the
      *    objective function, so we do not repeat it here. ---*/
 
-    if (kind_recording != RECORDING::MESH_COORDS) {
+    if (!record_obj) {
       HandleDataTransfer();
     }
 
@@ -683,6 +722,7 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
       }
     }
 #endif
+    CTapeStatistics::Report();
   }
 
   AD::StopRecording();
@@ -753,7 +793,7 @@ void CDiscAdjMultizoneDriver::SetObjFunction(RECORDING kind_recording) {
   if (rank == MASTER_NODE) {
     AD::RegisterOutput(ObjFunc);
     AD::SetIndex(ObjFunc_Index, ObjFunc);
-    if (kind_recording == RECORDING::SOLUTION_VARIABLES) {
+    if (kind_recording == RECORDING::SOLUTION_VARIABLES || kind_recording == RECORDING::SOLUTION_AND_MESH) {
       cout << " Objective function                   : " << ObjFunc;
       if (driver_config->GetWrt_AD_Statistics()){
         cout << " (" << ObjFunc_Index << ")\n";
@@ -811,8 +851,14 @@ void CDiscAdjMultizoneDriver::ComputeAdjoints(unsigned short iZone, bool eval_tr
    *    on the last inner iteration. Structural problems have some minor issue and we
    *    need to evaluate this section on every iteration. ---*/
 
-  if (eval_transfer || config_container[iZone]->GetStructuralProblem())
-    AD::ComputeAdjoint(TRANSFER, OBJECTIVE_FUNCTION);
+  if (eval_transfer || config_container[iZone]->GetStructuralProblem()) {
+    /*--- In the combined recording the transfer is part of the objective function section,
+     *    whose seed is 0 here, see SetRecording. ---*/
+    if (RecordingState == RECORDING::SOLUTION_AND_MESH)
+      AD::ComputeAdjoint(OBJECTIVE_FUNCTION, DEPENDENCIES);
+    else
+      AD::ComputeAdjoint(TRANSFER, OBJECTIVE_FUNCTION);
+  }
 
   /*--- Adjoints of dependencies, needed if derivatives of variables
    *    are extracted (e.g. AoA, Mach, etc.) ---*/
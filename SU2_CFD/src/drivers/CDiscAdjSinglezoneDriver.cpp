@@ -32,6 +32,7 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -118,6 +119,12 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- The objectives are separated by their weights, i.e. only the surface based objectives of FVM flow solvers. ---*/
+
+  if (BatchObjectives() && (MainSolver != ADJFLOW_SOL || config->GetFEMSolver())) {
+    SU2_MPI::Error("BATCH_OBJECTIVES_DISC is only available for the finite volume flow solvers.", CURRENT_FUNCTION);
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver() {
@@ -153,6 +160,48 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CDiscAdjSinglezoneDriver::Run() {
 
+  if (!BatchObjectives()) {
+    RunAdjoint();
+    return;
+  }
+
+  /*--- All objectives start from the same solution and reuse the main recording. Their solutions
+   * are kept for the sensitivities, since the secondary recording replaces the main one. ---*/
+
+  const auto nObj = config->GetnObj();
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  const auto nPointDomain = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, true);
+
+  BatchAdjSol.resize(nObj);
+  for (auto& adjSol : BatchAdjSol) {
+    if (adjSol.GetLocSize() == 0) adjSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    GetAllSolutions(ZONE_0, true, adjSol);
+  }
+
+  for (auto iObj = 0u; iObj < nObj; ++iObj) {
+    if (rank == MASTER_NODE) {
+      cout << "\nAdjoint of objective function " << iObj+1 << " of " << nObj
+           << " (" << config->GetObjFunc_Suffix().substr(1) << ")." << endl;
+    }
+    SetBatchObjective(iObj);
+    SetAllSolutions(ZONE_0, true, BatchAdjSol[iObj]);
+
+    RunAdjoint();
+
+    GetAllSolutions(ZONE_0, true, BatchAdjSol[iObj]);
+  }
+
+}
+
+void CDiscAdjSinglezoneDriver::RunAdjoint() {
+
+  if (config->GetNewtonKrylov() && config->GetnQuasiNewtonSamples() >= KrylovMinIters &&
+      nAdjoint_Iter >= KrylovMinIters) {
+    KrylovRun();
+    return;
+  }
+
   CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
   if (config->GetnQuasiNewtonSamples() > 1) {
     fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
@@ -216,8 +265,103 @@ void CDiscAdjSinglezoneDriver::Run() {
 
 }
 
+void CDiscAdjSinglezoneDriver::EvaluateAdjointTape() {
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  SetAdjObjFunction();
+
+  AD::ComputeAdjoint();
+
+  iteration->IterateDiscAdj(geometry_container, solver_container, config_container, ZONE_0, INST_0, false);
+
+  AD::ClearAdjoints();
+}
+
+void CDiscAdjSinglezoneDriver::KrylovRun() {
+
+  /*--- The tape gives T(u) = G^T u + b, the fixed point u = T(u) is the solution of (G^T - I) u = -b.
+   * The recorded iteration already contains the primal linear solve, i.e. the operator is preconditioned
+   * by the transposed primal Jacobian (and its preconditioner), no further preconditioning is required. ---*/
+
+  if (AdjSol.GetLocSize() == 0) {
+    const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+    const auto nPointDomain = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain();
+    const auto nVar = GetTotalNumberOfVariables(ZONE_0, true);
+    AdjRHS.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    AdjSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    LinSolver.SetToleranceType(LinearToleranceType::RELATIVE);
+  }
+
+  const auto product = AdjointProduct(this, AdjRHS);
+  const auto restart = config->GetnQuasiNewtonSamples();
+
+  for (auto Adjoint_Iter = 0ul; ; ) {
+
+    /*--- Fixed-point iteration from the current solution to monitor the convergence. This is also the
+     * last evaluation, so that the variables extracted with the solution (e.g. time n terms) are consistent. ---*/
+
+    config->SetInnerIter(Adjoint_Iter);
+
+    EvaluateAdjointTape();
+
+    StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+                                  solver_container, numerics_container, config_container,
+                                  surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+    if (!config->GetTime_Domain()) {
+      iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
+                        config_container, Adjoint_Iter, false, ZONE_0, INST_0);
+    }
+
+    /*--- The RHS and one restart cost at least KrylovMinIters evaluations. ---*/
+
+    ++Adjoint_Iter;
+    if (StopCalc || Adjoint_Iter + KrylovMinIters > nAdjoint_Iter) break;
+
+    /*--- -b is minus the tape evaluated at 0. ---*/
+
+    GetAllSolutions(ZONE_0, true, AdjSol);
+    AdjRHS = Scalar(0);
+    SetAllSolutions(ZONE_0, true, AdjRHS);
+    EvaluateAdjointTape();
+    GetAllSolutions(ZONE_0, true, AdjRHS);
+    AdjRHS *= Scalar(-1);
+    ++Adjoint_Iter;
+
+    /*--- One restart of FGMRES, each iteration and the initial residual are one evaluation. ---*/
+
+    Scalar residual = 0;
+    const auto maxIter = min<unsigned long>(restart, nAdjoint_Iter - Adjoint_Iter - 1);
+    const auto iter = LinSolver.FGMRES_LinSolver(AdjRHS, AdjSol, product, Identity(), KrylovTol, maxIter,
+                                                 residual, false, config);
+    Adjoint_Iter += iter + 1;
+
+    SetAllSolutions(ZONE_0, true, AdjSol);
+  }
+
+}
+
 void CDiscAdjSinglezoneDriver::Postprocess() {
 
+  if (BatchObjectives()) {
+
+    /*--- One secondary recording per objective, the files of the last one are written by the regular output. ---*/
+
+    const auto nObj = config->GetnObj();
+    for (auto iObj = 0u; iObj < nObj; ++iObj) {
+      SetBatchObjective(iObj);
+      SetAllSolutions(ZONE_0, true, BatchAdjSol[iObj]);
+
+      SecondaryRecording();
+
+      if (iObj+1 < nObj) {
+        output_container[ZONE_0]->SetResultFiles(geometry, config, solver, TimeIter, true);
+      }
+    }
+    return;
+  }
+
   switch(config->GetKind_Solver())
   {
     case MAIN_SOLVER::DISC_ADJ_EULER :     case MAIN_SOLVER::DISC_ADJ_NAVIER_STOKES :     case MAIN_SOLVER::DISC_ADJ_RANS :
@@ -278,6 +422,8 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
     AD::StartRecording();
 
+    if (config_container[ZONE_0]->GetWrt_AD_Statistics()) CTapeStatistics::Enable();
+
     iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
   }
 
@@ -316,6 +462,7 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
       }
     }
 #endif
+    CTapeStatistics::Report();
   }
 
   AD::StopRecording();
@@ -337,13 +484,30 @@ void CDiscAdjSinglezoneDriver::SetAdjObjFunction(){
       seeding = 0.0;
     }
   }
+  /*--- Only the objective being solved for is seeded. ---*/
+
+  const auto iObj = config->GetBatch_ObjFunc();
+  auto& objective = (iObj >= 0 && iObj < static_cast<short>(BatchObjFunc.size())) ? BatchObjFunc[iObj] : ObjFunc;
+
   if (rank == MASTER_NODE) {
-    SU2_TYPE::SetDerivative(ObjFunc, SU2_TYPE::GetValue(seeding));
+    SU2_TYPE::SetDerivative(objective, SU2_TYPE::GetValue(seeding));
   } else {
-    SU2_TYPE::SetDerivative(ObjFunc, 0.0);
+    SU2_TYPE::SetDerivative(objective, 0.0);
   }
 }
 
+void CDiscAdjSinglezoneDriver::SetBatchObjective(unsigned short iObj) {
+
+  config->SetBatch_ObjFunc(iObj);
+
+  auto output = output_container[ZONE_0];
+  const auto suffix = config->GetObjFunc_Suffix();
+
+  output->SetRestartFilename(config->GetObjFunc_Extension(config->GetRestart_AdjFileName()));
+  output->SetVolumeFilename(config->GetAdj_FileName() + suffix);
+  output->SetSurfaceFilename(config->GetSurfAdjCoeff_FileName() + suffix);
+}
+
 void CDiscAdjSinglezoneDriver::SetObjFunction(){
 
   ObjFunc = 0.0;
@@ -380,8 +544,27 @@ void CDiscAdjSinglezoneDriver::SetObjFunction(){
     break;
   }
 
+  /*--- For a batched adjoint, each objective is also an output of the tape, obtained by evaluating the
+   * combination with the weight of that objective only (the history output was set with all of them). ---*/
+
+  if (BatchObjectives()) {
+    const auto nObj = config->GetnObj();
+    vector<su2double> weights(nObj);
+    for (auto iObj = 0u; iObj < nObj; ++iObj) weights[iObj] = config->GetWeight_ObjFunc(iObj);
+
+    BatchObjFunc.resize(nObj);
+    for (auto iObj = 0u; iObj < nObj; ++iObj) {
+      for (auto jObj = 0u; jObj < nObj; ++jObj) config->SetWeight_ObjFunc(jObj, (iObj == jObj) ? weights[jObj] : 0.0);
+      solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+      BatchObjFunc[iObj] = solver[FLOW_SOL]->GetTotal_ComboObj();
+    }
+    for (auto iObj = 0u; iObj < nObj; ++iObj) config->SetWeight_ObjFunc(iObj, weights[iObj]);
+    solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+  }
+
   if (rank == MASTER_NODE){
     AD::RegisterOutput(ObjFunc);
+    for (auto& objective : BatchObjFunc) AD::RegisterOutput(objective);
   }
 
 }
@@ -95,6 +95,10 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
+#include "../../../Common/include/toolboxes/CMemoryLedger.hpp"
+#include "../../../Common/include/toolboxes/CFilePrefetcher.hpp"
 
 #include <cassert>
 
@@ -118,6 +122,15 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessInput(config_container, driver_config);
 
+  /*--- Record the memory of the subsystems for the reports, before anything large is allocated. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Performance()) CMemoryLedger::Enable();
+
+  /*--- Handling of large buffers, before any solver data is allocated. ---*/
+
+  MemoryAllocation::LargeBufferPool().Configure(driver_config->GetMemory_Pool(),
+                                                driver_config->GetTransparent_Huge_Pages());
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -127,6 +140,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessOutput(config_container, driver_config, output_container, driver_output);
 
+  /*--- Read the input files in the background while the zones are preprocessed. ---*/
+
+  CFilePrefetcher prefetcher;
+  if (driver_config->GetPrefetch_Input_Files() && !dry_run) PrefetchInputFiles(prefetcher);
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -243,6 +260,14 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     }
   }
 
+  const auto bytesPrefetched = prefetcher.Stop();
+  if (driver_config->GetPrefetch_Input_Files() && !dry_run) {
+    unsigned long bytesGlobal = 0;
+    SU2_MPI::Reduce(&bytesPrefetched, &bytesGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE)
+      cout << "Prefetched " << bytesGlobal / (1ul << 20) << " MB of input files in the background." << endl;
+  }
+
   if (config_container[ZONE_0]->GetBoolTurbomachinery()){
     if (rank == MASTER_NODE)
       cout << endl <<"---------------------- Turbomachinery Preprocessing ---------------------" << endl;
@@ -253,6 +278,11 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessPythonInterface(config_container, geometry_container, solver_container);
 
+  /*--- Memory of the subsystems after preprocessing. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Performance())
+    CMemoryLedger::Report("Preprocessing", "memory_ledger.csv");
+
 
   /*--- Preprocessing time is reported now, but not included in the next compute portion. ---*/
 
@@ -290,6 +320,11 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   StartTime = SU2_MPI::Wtime();
 
+  /*--- Start the phase timers of the compute loop. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Phase_Timers() || config_container[ZONE_0]->GetLoad_Balance_Measure())
+    CPhaseTimers::Enable(config_container[ZONE_0]->GetWrt_Phase_Timers());
+
 }
 
 void CDriver::InitializeContainers(){
@@ -356,6 +391,20 @@ void CDriver::Finalize() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Memory of the subsystems at the end of the run, before anything is deallocated. ---*/
+
+  if (wrt_perf) CMemoryLedger::Report("End of run", "memory_ledger.csv");
+
+  /*--- Weights for the partitioning of later runs, based on the compute time of the ranks, i.e.
+   * the time of the iterations without the (halo) communications. ---*/
+
+  if (config_container[ZONE_0]->GetLoad_Balance_Measure()) {
+    const passivedouble cost = CPhaseTimers::GetTotalTime(TIMER_PHASE::ITERATION) -
+                               CPhaseTimers::GetTotalTime(TIMER_PHASE::HALO_COMMS);
+    for (iZone = 0; iZone < nZone; iZone++)
+      geometry_container[iZone][INST_0][MESH_0]->WriteLoadBalanceWeights(config_container[iZone], cost);
+  }
+
   if (rank == MASTER_NODE)
     cout <<"\n--------------------------- Finalizing Solver ---------------------------" << endl;
 
@@ -459,6 +508,11 @@ void CDriver::Finalize() {
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
 
+  if (config_container[ZONE_0]->GetWrt_Phase_Timers())
+    CPhaseTimers::Report(config_container[ZONE_0]->GetPhase_Timers_FileName());
+
+  CKernelCounters::Report("kernel_counters.csv");
+
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
     for (iZone = 0; iZone < nZone; iZone++)
@@ -493,6 +547,13 @@ void CDriver::Finalize() {
   UsedTime = StopTime-StartTime;
   UsedTimeCompute += UsedTime;
 
+  /*--- Statistics of the large buffer pool, summed over ranks. ---*/
+  unsigned long poolStats[2] = {0}, poolStatsTot[2] = {0};
+  passivedouble cachedMB = 0, cachedMBTot = 0;
+  MemoryAllocation::LargeBufferPool().GetStatistics(poolStats[0], poolStats[1], cachedMB);
+  SU2_MPI::Reduce(poolStats, poolStatsTot, 2, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(&cachedMB, &cachedMBTot, 1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
   if ((rank == MASTER_NODE) && (wrt_perf)) {
     su2double TotalTime = UsedTimePreproc + UsedTimeCompute + UsedTimeOutput;
     cout.precision(6);
@@ -531,6 +592,13 @@ void CDriver::Finalize() {
         cout << setw(20)<< "MB/s/core:" << setw(12)<< BandwidthSum/OutputCount/size << endl;
       }
     } else cout << endl;
+    if (poolStatsTot[0] != 0) {
+      cout << endl;
+      cout << "Large buffer pool:" << endl;
+      cout << setw(25) << "Allocations:" << setw(12) << poolStatsTot[0] << " | ";
+      cout << setw(20) << "Reused (%):" << setw(12) << (100.0 * poolStatsTot[1]) / poolStatsTot[0] << endl;
+      cout << setw(25) << "Cached (MB):" << setw(12) << cachedMBTot << " | " << endl;
+    }
     cout << "-------------------------------------------------------------------------" << endl;
     cout << endl;
   }
@@ -597,6 +665,8 @@ void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
 
 void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  SU2_MEMORY_SCOPE(GEOMETRY);
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -696,6 +766,44 @@ void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool du
   main_geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 }
 
+void CDriver::PrefetchInputFiles(CFilePrefetcher& prefetcher) const {
+
+  /*--- In the order they are needed, the mesh of the first zone is being read already. ---*/
+
+  for (auto jZone = 1u; jZone < nZone; jZone++) {
+    prefetcher.Add(config_container[jZone]->GetMesh_FileName());
+  }
+
+  for (auto jZone = 0u; jZone < nZone; jZone++) {
+    const auto* config = config_container[jZone];
+    if (!config->GetRestart() && !config->GetRestart_Flow()) continue;
+
+    /*--- Time series are read step by step, there is little to gain. ---*/
+    if (config->GetRestart_Time_Series()) continue;
+
+    const string ext = config->GetRead_Binary_Restart() ? ".dat" : ".csv";
+    const bool adjoint = config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint();
+    bool dt_step_2nd = false;
+    const int restartIter = GetRestartIter(config, dt_step_2nd);
+
+    for (auto jInst = 0u; jInst < config->GetnTimeInstances(); jInst++) {
+      /*--- The file names depend on the instance of the config. ---*/
+      config_container[jZone]->SetiInst(jInst);
+
+      prefetcher.Add(config->GetFilename(config->GetSolution_FileName(), "", restartIter) + ext);
+      if (dt_step_2nd) prefetcher.Add(config->GetFilename(config->GetSolution_FileName(), "", restartIter + 1) + ext);
+
+      if (adjoint && config->GetRestart()) {
+        const auto adjFileName = config->GetObjFunc_Extension(config->GetSolution_AdjFileName());
+        prefetcher.Add(config->GetFilename(adjFileName, "", restartIter) + ext);
+      }
+    }
+    config_container[jZone]->SetiInst(INST_0);
+  }
+
+  prefetcher.Start();
+}
+
 void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   unsigned short iZone = config->GetiZone(), iMGlevel;
@@ -739,15 +847,22 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee ordering or a space-filling curve ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (config->GetKind_Point_Ordering() != POINT_ORDERING::NONE) {
+    if (rank == MASTER_NODE) {
+      if (config->GetKind_Point_Ordering() == POINT_ORDERING::RCM)
+        cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      else
+        cout << "Renumbering points (Hilbert Curve Ordering)." << endl;
+    }
+    geometry[MESH_0]->SetPoint_Ordering(config);
 
-  /*--- recompute elements surrounding points, points surrounding points ---*/
+    /*--- recompute elements surrounding points, points surrounding points ---*/
 
-  if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-  geometry[MESH_0]->SetPoint_Connectivity();
+    if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+    geometry[MESH_0]->SetPoint_Connectivity();
+  }
 
   /*--- Compute elements surrounding elements ---*/
 
@@ -841,9 +956,12 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
     /*--- Create the control volume structures ---*/
 
-    geometry[iMGlevel]->SetControlVolume(geometry[iMGlevel-1], ALLOCATE);
-    geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGlevel-1], ALLOCATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    SU2_OMP_PARALLEL {
+      geometry[iMGlevel]->SetControlVolume(geometry[iMGlevel-1], ALLOCATE);
+      geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGlevel-1], ALLOCATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    }
+    END_SU2_OMP_PARALLEL
 
     /*--- Find closest neighbor to a surface point ---*/
 
@@ -1010,6 +1128,8 @@ void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
 
 void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver ***&solver) {
 
+  SU2_MEMORY_SCOPE(SOLVER);
+
   MAIN_SOLVER kindSolver = config->GetKind_Solver();
 
   if (rank == MASTER_NODE)
@@ -1028,6 +1148,21 @@ void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver **
   for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++)
     if (solver[MESH_0][iSol]) DOFsPerPoint += solver[MESH_0][iSol]->GetnVar();
 
+  /*--- Report the memory of the point containers of each solver (all grid levels and ranks). ---*/
+
+  for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+    if (!solver[MESH_0][iSol]) continue;
+    passivedouble myMem = 0, totMem = 0;
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      if (solver[iMesh][iSol]) myMem += solver[iMesh][iSol]->GetMemoryUsage() / 1048576.0;
+    }
+    SU2_MPI::Reduce(&myMem, &totMem, 1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE && totMem > 0) {
+      cout << "Memory of the " << solver[MESH_0][iSol]->GetSolverName() << " solver variables: "
+           << totMem << " MB." << endl;
+    }
+  }
+
   /*--- Restart solvers, for FSI the geometry cannot be updated because the interpolation classes
    * should always use the undeformed mesh (otherwise the results would not be repeatable). ---*/
 
@@ -1120,18 +1255,8 @@ void CDriver::RestartSolver(CSolver ***solver, CGeometry **geometry,
 
   /*--- Adjust iteration number for unsteady restarts. ---*/
 
-  int val_iter = 0;
-
-  const bool adjoint = (config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint());
-  const bool time_domain = config->GetTime_Domain();
-  const bool dt_step_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) &&
-                           !config->GetStructuralProblem() && !config->GetFEMSolver() &&
-                           !adjoint && time_domain;
-
-  if (time_domain) {
-    if (adjoint) val_iter = config->GetUnst_AdjointIter() - 1;
-    else val_iter = config->GetRestart_Iter() - 1 - dt_step_2nd;
-  }
+  bool dt_step_2nd = false;
+  const int val_iter = GetRestartIter(config, dt_step_2nd);
 
   /*--- Restart direct solvers. ---*/
 
@@ -1165,6 +1290,19 @@ void CDriver::RestartSolver(CSolver ***solver, CGeometry **geometry,
 
 }
 
+int CDriver::GetRestartIter(const CConfig* config, bool& dt_step_2nd) {
+
+  const bool adjoint = (config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint());
+  const bool time_domain = config->GetTime_Domain();
+  dt_step_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) &&
+                !config->GetStructuralProblem() && !config->GetFEMSolver() &&
+                !adjoint && time_domain;
+
+  if (!time_domain) return 0;
+  if (adjoint) return config->GetUnst_AdjointIter() - 1;
+  return config->GetRestart_Iter() - 1 - dt_step_2nd;
+}
+
 void CDriver::FinalizeSolver(CSolver ****solver, CGeometry **geometry,
                                     CConfig *config, unsigned short val_iInst) {
 
@@ -2420,6 +2558,8 @@ void CDriver::InitializeInterface(CConfig **config, CSolver***** solver, CGeomet
                                       unsigned short** interface_types, CInterface ***interface,
                                       vector<vector<unique_ptr<CInterpolator> > >& interpolation) {
 
+  SU2_MEMORY_SCOPE(INTERFACE);
+
   /*--- Setup interpolation and transfer for all possible donor/target pairs. ---*/
 
   for (auto target = 0u; target < nZone; target++) {
@@ -2761,7 +2901,8 @@ CDriver::~CDriver() = default;
 
 void CDriver::PrintDirectResidual(RECORDING kind_recording) {
 
-  if (rank != MASTER_NODE || kind_recording != RECORDING::SOLUTION_VARIABLES) return;
+  if (rank != MASTER_NODE ||
+      (kind_recording != RECORDING::SOLUTION_VARIABLES && kind_recording != RECORDING::SOLUTION_AND_MESH)) return;
 
   const bool multizone = config_container[ZONE_0]->GetMultizone_Problem();
 
@@ -3228,11 +3369,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms across all zones ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -3251,127 +3389,68 @@ void CHBDriver::Update() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SetHarmonicBalance() {
 
-  unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
-  bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-  bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
-  if (adjoint) {
-    implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
-  }
-
-  unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
-
-  /*--- Retrieve values from the config file ---*/
-  auto *U = new su2double[nVar];
-  auto *U_old = new su2double[nVar];
-  auto *Psi = new su2double[nVar];
-  auto *Psi_old = new su2double[nVar];
-  auto *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
+  const bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const bool implicit = adjoint ? (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT) :
+                                  (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
-  if (InnerIter == 0)
+  if (config_container[ZONE_0]->GetInnerIter() == 0)
     ComputeHBOperator();
 
-  /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
-  /*--- Loop over all grid levels ---*/
-  for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
-
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
-
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
+  /*--- The adjoint uses the transpose of the operator. ---*/
+  su2activematrix Operator(nInstHB, nInstHB);
+  for (unsigned short iInst = 0; iInst < nInstHB; iInst++)
+    for (unsigned short jInst = 0; jInst < nInstHB; jInst++)
+      Operator(iInst, jInst) = adjoint ? D[jInst][iInst] : D[iInst][jInst];
 
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+  /*--- The sources of all the time instances are computed together, point by point (the solutions of the
+   * instances at a point are read once), and the points are divided among threads. ---*/
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
+  auto ComputeSources = [&](unsigned short iMGlevel, unsigned short iSol, bool withOld) {
+    const auto nVar = solver_container[ZONE_0][INST_0][iMGlevel][iSol]->GetnVar();
+    const auto nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
-
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+    SU2_OMP_PARALLEL_(for schedule(static, computeStaticChunkSize(nPoint, omp_get_max_threads(), 1024)))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iInst = 0; iInst < nInstHB; iInst++) {
+        auto nodes = solver_container[ZONE_0][iInst][iMGlevel][iSol]->GetNodes();
 
-          }
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          su2double Source = 0.0;
 
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+          /*--- Step across the columns ---*/
+          for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
+            const auto jNodes = solver_container[ZONE_0][jInst][iMGlevel][iSol]->GetNodes();
+            const su2double U = jNodes->GetSolution(iPoint, iVar);
+            Source += U * Operator(iInst, jInst);
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
+            if (withOld) {
+              const su2double deltaU = U - jNodes->GetSolution_Old(iPoint, iVar);
+              Source += deltaU * Operator(iInst, jInst);
             }
           }
-        }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
+          /*--- Store sources for current row ---*/
+          nodes->SetHarmonicBalance_Source(iPoint, iVar, Source);
         }
-
       }
     }
+    END_SU2_OMP_PARALLEL
+  };
+
+  /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
+  /*--- Loop over all grid levels ---*/
+  for (unsigned short iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+    ComputeSources(iMGlevel, adjoint ? ADJFLOW_SOL : FLOW_SOL, implicit);
   }
 
-  /*--- Source term for a turbulence model ---*/
+  /*--- Source term for a turbulence model, only on the finest mesh level (turbulence is always solved
+   on the original grid only). ---*/
   if (config_container[ZONE_0]->GetKind_Solver() == MAIN_SOLVER::RANS) {
-
-    /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    auto *U_Turb = new su2double[nVar_Turb];
-    auto *Source_Turb = new su2double[nVar_Turb];
-
-    /*--- Loop over only the finest mesh level (turbulence is always solved
-     on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
-
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
-        }
-      }
-
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
-    }
-
-    delete [] U_Turb;
-    delete [] Source_Turb;
+    ComputeSources(MESH_0, TURB_SOL, false);
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
-
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
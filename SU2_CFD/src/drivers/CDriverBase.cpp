@@ -29,6 +29,8 @@
 
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
+#include "../../../Common/include/toolboxes/CMemoryLedger.hpp"
 #include "../../include/variables/CPrimitiveIndices.hpp"
 
 using namespace std;
@@ -58,6 +60,9 @@ CDriverBase::CDriverBase(char* confFile, unsigned short val_nZone, SU2_Comm MPIC
   /*--- OpenMP initialization ---*/
   omp_initialize();
 
+  /*--- Hardware counters of the main kernels (if enabled at build time). ---*/
+  CKernelCounters::Initialize();
+
   /*--- Initialize AD ---*/
   AD::Initialize();
 }
@@ -283,6 +288,10 @@ map<string, string> CDriverBase::GetMarkerTypes() const {
   return typeMap;
 }
 
+map<string, passivedouble> CDriverBase::GetMemoryLedger() const {
+  return CMemoryLedger::Summary();
+}
+
 vector<string> CDriverBase::GetMarkerTags() const {
   const auto nMarker = main_config->GetnMarker_All();
   vector<string> tags(nMarker);
@@ -390,6 +399,21 @@ vector<passivedouble> CDriverBase::GetMarkerVertexNormals(unsigned short iMarker
   return values;
 }
 
+vector<passivedouble> CDriverBase::GetMarkerNormals(unsigned short iMarker, bool normalize) const {
+  const auto nVertex = GetNumberMarkerNodes(iMarker);
+  vector<passivedouble> values(nVertex * nDim, 0.0);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto* normal = main_geometry->vertex[iMarker][iVertex]->GetNormal();
+    const su2double area = normalize ? GeometryToolbox::Norm(nDim, normal) : 1.0;
+
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      values[iVertex * nDim + iDim] = SU2_TYPE::GetValue(normal[iDim] / area);
+    }
+  }
+  return values;
+}
+
 void CDriverBase::CommunicateMeshDisplacements() {
   solver_container[selected_zone][INST_0][MESH_0][MESH_SOL]->InitiateComms(main_geometry, main_config, MESH_DISPLACEMENTS);
   solver_container[selected_zone][INST_0][MESH_0][MESH_SOL]->CompleteComms(main_geometry, main_config, MESH_DISPLACEMENTS);
@@ -98,6 +98,8 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
   /*- Define if a prefixed motion is imposed in a zone -*/
   /*----------------------------------------------------*/
 
+  zoneActive.resize(nZone, true);
+
   prefixed_motion = new bool[nZone];
   for (iZone = 0; iZone < nZone; iZone++){
     switch (config_container[iZone]->GetKind_GridMovement()){
@@ -283,6 +285,16 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
 }
 
+bool CMultizoneDriver::SetActiveZones(unsigned long OuterIter, bool allZones) {
+
+  bool allActive = true;
+  for (iZone = 0; iZone < nZone; iZone++) {
+    zoneActive[iZone] = allZones || (OuterIter % config_container[iZone]->GetZoneUpdateFreq() == 0);
+    allActive = allActive && zoneActive[iZone];
+  }
+  return allActive;
+}
+
 void CMultizoneDriver::RunGaussSeidel() {
 
   unsigned short UpdateMesh;
@@ -295,6 +307,8 @@ void CMultizoneDriver::RunGaussSeidel() {
     if (mixingplane) SetMixingPlane(iZone);
   }
 
+  bool updateAllZones = true;
+
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++) {
 
@@ -303,6 +317,8 @@ void CMultizoneDriver::RunGaussSeidel() {
       RampTurbomachineryValues(iOuter_Iter);
     }
 
+    const bool allZonesActive = SetActiveZones(iOuter_Iter, updateAllZones);
+
     /*--- Loop over the number of zones (IZONE) ---*/
     for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -314,6 +330,9 @@ void CMultizoneDriver::RunGaussSeidel() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
+      /*--- Lagged zones neither receive data nor iterate in this outer iteration. ---*/
+      if (!zoneActive[iZone]) continue;
+
       /*--- Transfer from all the remaining zones ---*/
       for (auto jZone = 0u; jZone < nZone; jZone++){
         /*--- The target zone is iZone ---*/
@@ -338,21 +357,28 @@ void CMultizoneDriver::RunGaussSeidel() {
 
     }
 
-    if (OuterConvergence(iOuter_Iter)) break;
+    /*--- Convergence is only accepted after all zones were iterated, reaching it with lagged zones
+     * triggers an iteration of all zones. ---*/
+    const bool converged = OuterConvergence(iOuter_Iter);
+    if (converged && allZonesActive) break;
+    updateAllZones = converged;
 
   }
 
 }
 
-void CMultizoneDriver::RunJacobi() {
+void CMultizoneDriver::RunJacobi(bool overlapTransfers) {
 
   unsigned short UpdateMesh;
   bool DeformMesh = false;
+  vector<unsigned short> UpdateMeshZone(nZone);
 
   for (iZone = 0; iZone < nZone; iZone++) {
     config_container[iZone]->SetOuterIter(0ul);
   }
 
+  bool updateAllZones = true;
+
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
@@ -361,30 +387,53 @@ void CMultizoneDriver::RunJacobi() {
       RampTurbomachineryValues(iOuter_Iter);
     }
 
+    const bool allZonesActive = SetActiveZones(iOuter_Iter, updateAllZones);
+
     /*--- Transfer from all zones ---*/
     for (iZone = 0; iZone < nZone; iZone++){
 
       /*--- In principle, the mesh does not need to be updated ---*/
       UpdateMesh = 0;
+      UpdateMeshZone[iZone] = 0;
 
       /*--- Set the OuterIter ---*/
       config_container[iZone]->SetOuterIter(iOuter_Iter);
       driver_config->SetOuterIter(iOuter_Iter);
 
+      /*--- Lagged zones neither receive data nor iterate in this outer iteration. ---*/
+      if (!zoneActive[iZone]) continue;
+
       /*--- Transfer from all the remaining zones ---*/
       for (auto jZone = 0u; jZone < nZone; jZone++){
         /*--- The target zone is iZone ---*/
         if (jZone != iZone && interface_container[iZone][jZone] != nullptr){
-          DeformMesh = TransferData(jZone, iZone);
+          DeformMesh = TransferData(jZone, iZone, overlapTransfers);
           if (DeformMesh) UpdateMesh+=1;
         }
       }
+
+      /*--- With overlapped transfers the mesh updates wait for all transfers to complete ---*/
+      if (overlapTransfers) {
+        UpdateMeshZone[iZone] = UpdateMesh;
+        continue;
+      }
+
       /*--- If a mesh update is required due to the transfer of data ---*/
       if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
       if (mixingplane) SetMixingPlane(iZone);
     }
 
+    if (overlapTransfers) {
+      FinishTransfers();
+
+      for (iZone = 0; iZone < nZone; iZone++) {
+        if (!zoneActive[iZone]) continue;
+        if (UpdateMeshZone[iZone] > 0) DynamicMeshUpdate(iZone, TimeIter);
+        if (mixingplane) SetMixingPlane(iZone);
+      }
+    }
+
       /*--- Loop over the number of zones (IZONE) ---*/
     for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -393,6 +442,8 @@ void CMultizoneDriver::RunJacobi() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
+      if (!zoneActive[iZone]) continue;
+
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
@@ -403,7 +454,11 @@ void CMultizoneDriver::RunJacobi() {
 
     }
 
-    if (OuterConvergence(iOuter_Iter)) break;
+    /*--- Convergence is only accepted after all zones were iterated, reaching it with lagged zones
+     * triggers an iteration of all zones. ---*/
+    const bool converged = OuterConvergence(iOuter_Iter);
+    if (converged && allZonesActive) break;
+    updateAllZones = converged;
 
   }
 
@@ -427,7 +482,9 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
 
-    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++){
+    /*--- The residuals of lagged zones are kept from their last iteration. ---*/
+
+    for (unsigned short iSol = 0; iSol < MAX_SOLS && zoneActive[iZone]; iSol++){
       if (solvers[iSol] != nullptr) {
         solvers[iSol]->ComputeResidual_Multizone(geometry_container[iZone][INST_0][MESH_0], config_container[iZone]);
         solvers[iSol]->GetNodes()->Set_BGSSolution_k();
@@ -552,14 +609,14 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned short val_iZone, unsigned long
   }
 }
 
-bool CMultizoneDriver::TransferData(unsigned short donorZone, unsigned short targetZone) {
+bool CMultizoneDriver::TransferData(unsigned short donorZone, unsigned short targetZone, bool startOnly) {
 
   bool UpdateMesh = false;
 
   /*--- Select the transfer method according to the magnitudes being transferred ---*/
 
   auto BroadcastData = [&](int donorSol, int targetSol) {
-    interface_container[donorZone][targetZone]->BroadcastData(
+    interface_container[donorZone][targetZone]->StartBroadcastData(
       *interpolator_container[donorZone][targetZone].get(),
       solver_container[donorZone][INST_0][MESH_0][donorSol],
       solver_container[targetZone][INST_0][MESH_0][targetSol],
@@ -567,6 +624,7 @@ bool CMultizoneDriver::TransferData(unsigned short donorZone, unsigned short tar
       geometry_container[targetZone][INST_0][MESH_0],
       config_container[donorZone],
       config_container[targetZone]);
+    if (!startOnly) interface_container[donorZone][targetZone]->FinishBroadcastData();
   };
 
   switch (interface_types[donorZone][targetZone]) {
@@ -619,6 +677,16 @@ bool CMultizoneDriver::TransferData(unsigned short donorZone, unsigned short tar
   return UpdateMesh;
 }
 
+void CMultizoneDriver::FinishTransfers() {
+
+  for (auto targetZone = 0u; targetZone < nZone; targetZone++) {
+    for (auto donorZone = 0u; donorZone < nZone; donorZone++) {
+      if (donorZone != targetZone && interface_container[donorZone][targetZone] != nullptr)
+        interface_container[donorZone][targetZone]->FinishBroadcastData();
+    }
+  }
+}
+
 void CMultizoneDriver::SetMixingPlane(unsigned short donorZone) {
 
   const auto nMarkerInt = config_container[donorZone]->GetnMarker_MixingPlaneInterface() / 2;
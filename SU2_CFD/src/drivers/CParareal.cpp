@@ -0,0 +1,99 @@
+/*!
+ * \file CParareal.cpp
+ * \brief Parareal iteration of the states at the boundaries of the time slices (parallel in time).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CParareal.hpp"
+#include <algorithm>
+#include <cmath>
+
+CParareal::CParareal(SU2_Comm spaceComm_, SU2_Comm timeComm_, unsigned long maxIter_, passivedouble tolerance_)
+    : spaceComm(spaceComm_), timeComm(timeComm_), tolerance(tolerance_) {
+  SU2_MPI::Comm_rank(timeComm, &iSlice);
+  SU2_MPI::Comm_size(timeComm, &nSlices);
+
+  /*--- The start states of all slices are exact after nSlices-1 iterations. ---*/
+  maxIter = std::min<unsigned long>(maxIter_, nSlices - 1);
+}
+
+void CParareal::ReceiveStart(State& start, int tag) const {
+  if (iSlice == 0) return;
+  SU2_MPI::Status status;
+  SU2_MPI::Recv(start.data(), start.size(), MPI_DOUBLE, iSlice - 1, tag, timeComm, &status);
+}
+
+void CParareal::SendEnd(const State& end, int tag) const {
+  if (iSlice + 1 == nSlices) return;
+  SU2_MPI::Send(end.data(), end.size(), MPI_DOUBLE, iSlice + 1, tag, timeComm);
+}
+
+unsigned long CParareal::Solve(State& start, const Propagator& coarse, const Propagator& fine) {
+  /*--- Initial guess of the start states, a coarse sweep over the slices. ---*/
+
+  ReceiveStart(start, 0);
+  State coarseEnd = start, end, fineEnd;
+  coarse(coarseEnd);
+  SendEnd(coarseEnd, 0);
+  end = coarseEnd;
+
+  unsigned long iter = 0;
+  change = 0;
+
+  while (iter < maxIter) {
+    ++iter;
+
+    /*--- Fine propagation from the current start state, concurrently on all slices. ---*/
+
+    fineEnd = start;
+    fine(fineEnd);
+
+    /*--- Correction sweep, the coarse propagation from the new start state corrects the fine end state. ---*/
+
+    ReceiveStart(start, iter);
+    State newCoarseEnd = start;
+    coarse(newCoarseEnd);
+
+    passivedouble norms[2] = {0.0, 0.0};  // {change, magnitude}
+    for (size_t i = 0; i < end.size(); ++i) {
+      const passivedouble newEnd = newCoarseEnd[i] + fineEnd[i] - coarseEnd[i];
+      norms[0] += (newEnd - end[i]) * (newEnd - end[i]);
+      norms[1] += newEnd * newEnd;
+      end[i] = newEnd;
+    }
+    SendEnd(end, iter);
+    coarseEnd.swap(newCoarseEnd);
+
+    passivedouble globalNorms[2] = {0.0, 0.0};
+    SU2_MPI::Allreduce(norms, globalNorms, 2, MPI_DOUBLE, MPI_SUM, spaceComm);
+    const passivedouble sliceChange = sqrt(globalNorms[0] / (globalNorms[1] > 0 ? globalNorms[1] : 1.0));
+
+    /*--- The last slice does not send its end state, it does not take part in the convergence check. ---*/
+    const passivedouble myChange = (iSlice + 1 == nSlices) ? 0.0 : sliceChange;
+    SU2_MPI::Allreduce(&myChange, &change, 1, MPI_DOUBLE, MPI_MAX, timeComm);
+
+    if (change < tolerance) break;
+  }
+  return iter;
+}
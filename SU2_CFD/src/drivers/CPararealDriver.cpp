@@ -0,0 +1,206 @@
+/*!
+ * \file CPararealDriver.cpp
+ * \brief Parallel-in-time (Parareal) driver for unsteady single-zone problems.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPararealDriver.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+namespace {
+/*!
+ * \brief Visit the variables of all the solvers on all grid levels, in the same order on all ranks.
+ */
+template <class F>
+void ForEachVariable(CSolver*** solvers, unsigned short nMesh, F&& f) {
+  for (unsigned short iMesh = 0; iMesh < nMesh; ++iMesh) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; ++iSol) {
+      if (solvers[iMesh][iSol] != nullptr) f(*solvers[iMesh][iSol]->GetNodes());
+    }
+  }
+}
+}  // namespace
+
+CPararealDriver::CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator,
+                                 SU2_Comm timeCommunicator)
+    : CSinglezoneDriver(confFile, val_nZone, MPICommunicator),
+      parareal(MPICommunicator, timeCommunicator, config_container[ZONE_0]->GetParareal_Iter(),
+               SU2_TYPE::GetValue(config_container[ZONE_0]->GetParareal_Tol())) {
+  const auto* config = config_container[ZONE_0];
+
+  const bool dualTime = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                        (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  if (!config->GetFluidProblem() || !dualTime || config->GetUnst_CFL() != 0.0) {
+    SU2_MPI::Error("The Parareal driver requires a fluid problem with dual time stepping and a fixed TIME_STEP.",
+                   CURRENT_FUNCTION);
+  }
+  if (config->GetGrid_Movement() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint() ||
+      config->GetPrecice_Coupling() != PRECICE_COUPLING::NONE) {
+    SU2_MPI::Error("The Parareal driver does not support mesh motion, adjoints, or coupling with preCICE.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- The time iterations are split evenly, the coarse steps must not cross the boundaries of the slices. ---*/
+
+  firstIter = config->GetRestart() ? config->GetRestart_Iter() : 0;
+  const auto nSlices = static_cast<unsigned long>(parareal.GetnSlices());
+  const auto nTimeIter = config->GetnTime_Iter() - firstIter;
+  nSliceIter = nTimeIter / nSlices;
+  coarseFactor = config->GetParareal_Coarse_Factor();
+
+  if (nTimeIter % nSlices != 0 || coarseFactor == 0 || nSliceIter % coarseFactor != 0) {
+    SU2_MPI::Error("The number of time iterations (" + to_string(nTimeIter) + ") must be a multiple of PARAREAL_SLICES "
+                   "times PARAREAL_COARSE_FACTOR.", CURRENT_FUNCTION);
+  }
+  fineTimeStep = config->GetDelta_UnstTimeND();
+
+  historyFreq = config->GetHistory_Wrt_Freq(0);
+  screenFreq = config->GetScreen_Wrt_Freq(0);
+
+  /*--- The states are exchanged between the ranks with the same rank in each slice, their partitions must match. ---*/
+
+  const auto* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  unsigned long partition[2] = {geometry->GetnPoint(), 0};
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    partition[1] += (iPoint + 1) * geometry->nodes->GetGlobalIndex(iPoint);
+  }
+  unsigned long minPartition[2], maxPartition[2];
+  SU2_MPI::Allreduce(partition, minPartition, 2, MPI_UNSIGNED_LONG, MPI_MIN, timeCommunicator);
+  SU2_MPI::Allreduce(partition, maxPartition, 2, MPI_UNSIGNED_LONG, MPI_MAX, timeCommunicator);
+  int mismatch = (minPartition[0] != maxPartition[0]) || (minPartition[1] != maxPartition[1]), anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  if (anyMismatch) {
+    SU2_MPI::Error("The mesh partitions of the Parareal time slices differ, the partitioner must be deterministic.",
+                   CURRENT_FUNCTION);
+  }
+}
+
+void CPararealDriver::GetState(CParareal::State& state) const {
+  state.clear();
+  const auto nMesh = config_container[ZONE_0]->GetnMGLevels() + 1;
+  ForEachVariable(solver_container[ZONE_0][INST_0], nMesh, [&](CVariable& nodes) {
+    for (const auto* mat : {&nodes.GetSolution(), &nodes.GetSolution_time_n(), &nodes.GetSolution_time_n1()}) {
+      for (size_t i = 0; i < mat->size(); ++i) state.push_back(SU2_TYPE::GetValue(mat->data()[i]));
+    }
+  });
+}
+
+void CPararealDriver::SetState(const CParareal::State& state) {
+  size_t pos = 0;
+  const auto nMesh = config_container[ZONE_0]->GetnMGLevels() + 1;
+  ForEachVariable(solver_container[ZONE_0][INST_0], nMesh, [&](CVariable& nodes) {
+    for (auto* mat : {&nodes.GetSolution(), &nodes.GetSolution_time_n(), &nodes.GetSolution_time_n1()}) {
+      for (size_t i = 0; i < mat->size(); ++i) mat->data()[i] = state[pos++];
+    }
+  });
+  assert(pos == state.size());
+}
+
+void CPararealDriver::Propagate(CParareal::State& state, bool coarse, bool output) {
+  auto* config = config_container[ZONE_0];
+  auto** solvers = solver_container[ZONE_0][INST_0];
+  const auto nMesh = config->GetnMGLevels() + 1;
+  const unsigned long stride = coarse ? coarseFactor : 1;
+
+  SetState(state);
+
+  /*--- Only the final propagation writes output, and only the first slice writes to the screen. The inner
+   * frequencies are kept, some solvers use them to decide when to evaluate boundary conditions. ---*/
+
+  config->SetHistory_Wrt_Freq(0, output ? historyFreq : 0);
+  config->SetScreen_Wrt_Freq(0, (output && parareal.GetSlice() == 0) ? screenFreq : 0);
+
+  /*--- With 2nd order dual time stepping and equal solutions at time n and n-1, the time derivative is that of
+   * backward Euler with 2/3 of the time step, the coarse propagator is backward Euler for both time marching
+   * schemes. ---*/
+
+  const bool backwardEuler = coarse && (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  config->SetDelta_UnstTimeND(fineTimeStep * stride * (backwardEuler ? 1.5 : 1.0));
+
+  const auto sliceIter = firstIter + parareal.GetSlice() * nSliceIter;
+
+  for (auto iter = sliceIter; iter < sliceIter + nSliceIter; iter += stride) {
+    if (backwardEuler) ForEachVariable(solvers, nMesh, [](CVariable& nodes) { nodes.Set_Solution_time_n1(); });
+
+    TimeIter = iter;
+    config->SetTimeIter(iter);
+    config->SetPhysicalTime(static_cast<su2double>(iter) * fineTimeStep);
+
+    Run();
+    Postprocess();
+    Update();
+
+    if (output) {
+      Monitor(iter);
+      Output(iter);
+    }
+  }
+  config->SetDelta_UnstTimeND(fineTimeStep);
+
+  /*--- The fine propagator continues from the solution at n-1 of the fine time step, interpolated linearly. ---*/
+
+  if (backwardEuler) {
+    const su2double weight = 1.0 / stride;
+    ForEachVariable(solvers, nMesh, [&](CVariable& nodes) {
+      auto& n = nodes.GetSolution_time_n();
+      auto& n1 = nodes.GetSolution_time_n1();
+      for (size_t i = 0; i < n1.size(); ++i) n1.data()[i] = n.data()[i] + weight * (n1.data()[i] - n.data()[i]);
+    });
+  }
+  GetState(state);
+}
+
+void CPararealDriver::StartSolver() {
+  StartTime = SU2_MPI::Wtime();
+  config_container[ZONE_0]->Set_StartTime(StartTime);
+
+  const bool master = (rank == MASTER_NODE) && (parareal.GetSlice() == 0);
+
+  if (master) {
+    cout << endl << "------------------------------ Begin Solver -----------------------------" << endl;
+    cout << endl << "Simulation Run using the Parareal Driver" << endl;
+    cout << "The simulation will run for " << parareal.GetnSlices() * nSliceIter << " time steps in "
+         << parareal.GetnSlices() << " slices, the coarse time step is " << coarseFactor << " times larger." << endl;
+  }
+
+  /*--- Initial condition of the simulation, only that of the first slice is used. ---*/
+
+  Preprocess(firstIter);
+
+  CParareal::State state;
+  GetState(state);
+
+  const auto nIter = parareal.Solve(
+      state, [this](CParareal::State& s) { Propagate(s, true, false); },
+      [this](CParareal::State& s) { Propagate(s, false, false); });
+
+  if (master) {
+    cout << "Parareal iterations: " << nIter << ", relative change of the start states of the slices: "
+         << parareal.GetChange() << "." << endl;
+  }
+
+  /*--- Solution inside the slices. ---*/
+
+  Propagate(state, false, true);
+}
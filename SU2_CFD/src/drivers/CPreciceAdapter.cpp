@@ -0,0 +1,236 @@
+/*!
+ * \file CPreciceAdapter.cpp
+ * \brief Coupling of SU2 with other codes (structural or heat solvers) through the preCICE library.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/drivers/CPreciceAdapter.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../include/solvers/CSolver.hpp"
+#include <algorithm>
+
+#ifdef HAVE_PRECICE
+
+CPreciceAdapter::CPreciceAdapter(CConfig* config_, CGeometry* geometry_, CSolver** solvers_)
+    : config(config_), geometry(geometry_), solvers(solvers_) {
+
+  const auto nDim = geometry->GetnDim();
+  const auto kind = config->GetPrecice_Coupling();
+
+  switch (kind) {
+    case PRECICE_COUPLING::FSI:
+      if (solvers[MESH_SOL] == nullptr) {
+        SU2_MPI::Error("preCICE FSI coupling requires mesh deformation (DEFORM_MESH= YES).", CURRENT_FUNCTION);
+      }
+      readName = "Displacement";
+      writeName = "Force";
+      nReadVar = nWriteVar = nDim;
+      break;
+    case PRECICE_COUPLING::CHT_TEMPERATURE:
+      readName = "Temperature";
+      writeName = "Heat-Flux";
+      nReadVar = nWriteVar = 1;
+      break;
+    case PRECICE_COUPLING::CHT_HEATFLUX:
+      readName = "Heat-Flux";
+      writeName = "Temperature";
+      nReadVar = nWriteVar = 1;
+      break;
+    case PRECICE_COUPLING::NONE:
+      SU2_MPI::Error("No preCICE coupling was requested.", CURRENT_FUNCTION);
+      break;
+  }
+
+#ifdef HAVE_MPI
+  auto comm = SU2_MPI::GetComm();
+  participant.reset(new precice::Participant(config->GetPrecice_Participant(), config->GetPrecice_Config_File(),
+                                             SU2_MPI::GetRank(), SU2_MPI::GetSize(), &comm));
+#else
+  participant.reset(new precice::Participant(config->GetPrecice_Participant(), config->GetPrecice_Config_File(),
+                                             SU2_MPI::GetRank(), SU2_MPI::GetSize()));
+#endif
+
+  /*--- One mesh per marker, only the owned vertices are coupled. Ranks without the marker define an empty mesh. ---*/
+
+  for (auto iMarkerPrecice = 0u; iMarkerPrecice < config->GetnMarker_Precice(); ++iMarkerPrecice) {
+    const auto& tag = config->GetMarker_Precice(iMarkerPrecice);
+
+    CoupledMarker marker;
+    marker.mesh = config->GetPrecice_Mesh_Prefix() + "-" + tag;
+    marker.iMarker = config->GetMarker_All_TagBound(tag);
+
+    int found = (marker.iMarker >= 0), foundAny = 0;
+    SU2_MPI::Allreduce(&found, &foundAny, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+    if (!foundAny) SU2_MPI::Error("Unknown MARKER_PRECICE " + tag + ".", CURRENT_FUNCTION);
+
+    std::vector<double> coords;
+
+    if (marker.iMarker >= 0) {
+      const auto iMarker = marker.iMarker;
+
+      if (kind == PRECICE_COUPLING::FSI && !config->GetSolid_Wall(iMarker)) {
+        SU2_MPI::Error("The preCICE FSI marker " + tag + " must be a solid wall.", CURRENT_FUNCTION);
+      }
+      if (kind != PRECICE_COUPLING::FSI && !config->GetMarker_All_PyCustom(iMarker)) {
+        SU2_MPI::Error("The preCICE CHT marker " + tag + " must also be in MARKER_PYTHON_CUSTOM.", CURRENT_FUNCTION);
+      }
+
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->nodes->GetDomain(iPoint)) continue;
+        marker.vertices.push_back(iVertex);
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          coords.push_back(SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+        }
+      }
+    }
+
+    const auto nVertex = marker.vertices.size();
+    marker.ids.resize(nVertex);
+    marker.readBuf.resize(nVertex * nReadVar);
+    marker.writeBuf.resize(nVertex * nWriteVar);
+
+    participant->setMeshVertices(marker.mesh, coords, marker.ids);
+    markers.push_back(std::move(marker));
+  }
+
+  participant->initialize();
+}
+
+CPreciceAdapter::~CPreciceAdapter() {
+  if (participant) participant->finalize();
+}
+
+void CPreciceAdapter::ReadData() {
+
+  if (!participant->isCouplingOngoing()) return;
+
+  /*--- Read the values at the end of the time step that is about to be solved. ---*/
+  const double dt = std::min<double>(SU2_TYPE::GetValue(config->GetDelta_UnstTime()),
+                                     participant->getMaxTimeStepSize());
+  const auto kind = config->GetPrecice_Coupling();
+
+  for (auto& marker : markers) {
+    participant->readData(marker.mesh, readName, marker.ids, dt, marker.readBuf);
+    if (marker.iMarker < 0) continue;
+    const auto iMarker = marker.iMarker;
+
+    for (auto k = 0ul; k < marker.vertices.size(); ++k) {
+      const auto iVertex = marker.vertices[k];
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+      switch (kind) {
+        case PRECICE_COUPLING::FSI:
+          for (auto iDim = 0u; iDim < nReadVar; ++iDim) {
+            solvers[MESH_SOL]->GetNodes()->SetBound_Disp(iPoint, iDim, marker.readBuf[k * nReadVar + iDim]);
+          }
+          break;
+        case PRECICE_COUPLING::CHT_TEMPERATURE:
+          geometry->SetCustomBoundaryTemperature(iMarker, iVertex, marker.readBuf[k]);
+          break;
+        case PRECICE_COUPLING::CHT_HEATFLUX:
+          geometry->SetCustomBoundaryHeatFlux(iMarker, iVertex, marker.readBuf[k]);
+          break;
+        case PRECICE_COUPLING::NONE:
+          break;
+      }
+    }
+  }
+}
+
+void CPreciceAdapter::WriteData() {
+
+  const auto kind = config->GetPrecice_Coupling();
+  const auto* chtSolver = solvers[HEAT_SOL] ? solvers[HEAT_SOL] : solvers[FLOW_SOL];
+
+  for (auto& marker : markers) {
+    if (marker.iMarker >= 0) {
+      const auto iMarker = marker.iMarker;
+
+      for (auto k = 0ul; k < marker.vertices.size(); ++k) {
+        const auto iVertex = marker.vertices[k];
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+        switch (kind) {
+          case PRECICE_COUPLING::FSI:
+            for (auto iDim = 0u; iDim < nWriteVar; ++iDim) {
+              marker.writeBuf[k * nWriteVar + iDim] =
+                  SU2_TYPE::GetValue(solvers[FLOW_SOL]->GetVertexTractions(iMarker, iVertex, iDim));
+            }
+            break;
+          case PRECICE_COUPLING::CHT_TEMPERATURE:
+            marker.writeBuf[k] = SU2_TYPE::GetValue(chtSolver->GetHeatFlux(iMarker, iVertex));
+            break;
+          case PRECICE_COUPLING::CHT_HEATFLUX:
+            marker.writeBuf[k] = SU2_TYPE::GetValue(chtSolver->GetNodes()->GetTemperature(iPoint));
+            break;
+          case PRECICE_COUPLING::NONE:
+            break;
+        }
+      }
+    }
+    participant->writeData(marker.mesh, writeName, marker.ids, marker.writeBuf);
+  }
+}
+
+void CPreciceAdapter::Advance() {
+
+  const double dt = SU2_TYPE::GetValue(config->GetDelta_UnstTime());
+  if (dt > participant->getMaxTimeStepSize() * (1 + 1e-10)) {
+    SU2_MPI::Error("TIME_STEP is larger than the time window allowed by preCICE, subcycling is not supported.",
+                   CURRENT_FUNCTION);
+  }
+  participant->advance(dt);
+}
+
+bool CPreciceAdapter::RequiresWritingCheckpoint() const { return participant->requiresWritingCheckpoint(); }
+
+bool CPreciceAdapter::RequiresReadingCheckpoint() const { return participant->requiresReadingCheckpoint(); }
+
+bool CPreciceAdapter::IsCouplingOngoing() const { return participant->isCouplingOngoing(); }
+
+#else
+
+CPreciceAdapter::CPreciceAdapter(CConfig* config_, CGeometry* geometry_, CSolver** solvers_)
+    : config(config_), geometry(geometry_), solvers(solvers_) {
+  SU2_MPI::Error("SU2 was not compiled with preCICE support (-Denable-precice=true).", CURRENT_FUNCTION);
+}
+
+CPreciceAdapter::~CPreciceAdapter() = default;
+
+void CPreciceAdapter::ReadData() {}
+
+void CPreciceAdapter::WriteData() {}
+
+void CPreciceAdapter::Advance() {}
+
+bool CPreciceAdapter::RequiresWritingCheckpoint() const { return false; }
+
+bool CPreciceAdapter::RequiresReadingCheckpoint() const { return false; }
+
+bool CPreciceAdapter::IsCouplingOngoing() const { return false; }
+
+#endif
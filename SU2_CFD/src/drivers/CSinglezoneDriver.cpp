@@ -26,6 +26,8 @@
  */
 
 #include "../../include/drivers/CSinglezoneDriver.hpp"
+#include "../../include/drivers/CBuddyCheckpoint.hpp"
+#include "../../include/drivers/CPreciceAdapter.hpp"
 #include "../../include/definition_structure.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
@@ -65,9 +67,35 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  /*--- Resume from the last in-memory checkpoint if this is a relaunch after a failure. ---*/
+
+  CBuddyCheckpoint checkpoint(*config_container[ZONE_0]);
+  const auto nMesh = config_container[ZONE_0]->GetnMGLevels() + 1;
+  unsigned long checkpointIter = 0;
+
+  if (checkpoint.Recover(solver_container[ZONE_0][INST_0], nMesh, checkpointIter))
+    TimeIter = checkpointIter + 1;
+
+  /*--- Coupling with other codes through preCICE, the state of the solvers is saved for implicit coupling. ---*/
+
+  unique_ptr<CPreciceAdapter> precice;
+  su2passivematrix coupledState;
+
+  if (config_container[ZONE_0]->GetPrecice_Coupling() != PRECICE_COUPLING::NONE) {
+    precice.reset(new CPreciceAdapter(config_container[ZONE_0], geometry_container[ZONE_0][INST_0][MESH_0],
+                                      solver_container[ZONE_0][INST_0][MESH_0]));
+    coupledState.resize(geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(),
+                        GetTotalNumberOfVariables(ZONE_0, false));
+  }
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
+    if (precice) {
+      if (precice->RequiresWritingCheckpoint()) GetAllSolutions(ZONE_0, false, coupledState);
+      precice->ReadData();
+    }
+
     /*--- Perform some preprocessing before starting the time-step simulation. ---*/
 
     Preprocess(TimeIter);
@@ -80,6 +108,17 @@ void CSinglezoneDriver::StartSolver() {
 
     Postprocess();
 
+    /*--- Exchange the coupling data, repeat the time step if the implicit coupling did not converge. ---*/
+
+    if (precice) {
+      precice->WriteData();
+      precice->Advance();
+      if (precice->RequiresReadingCheckpoint()) {
+        SetAllSolutions(ZONE_0, false, coupledState);
+        continue;
+      }
+    }
+
     /*--- Update the solution for dual time stepping strategy ---*/
 
     Update();
@@ -96,10 +135,19 @@ void CSinglezoneDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    if (checkpoint.IsDue(TimeIter))
+      checkpoint.Store(solver_container[ZONE_0][INST_0], nMesh, TimeIter);
+
     TimeIter++;
 
+    if (precice && !precice->IsCouplingOngoing()) break;
+
   }
 
+  /*--- The run finished normally, the checkpoints are no longer needed. ---*/
+
+  checkpoint.Clear();
+
 }
 
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
@@ -49,7 +49,9 @@ CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluid
 #endif
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
-      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e);
+      lookup_table = CLookUpTable::GetShared(config->GetDataDriven_FileNames()[0], varname_rho, varname_e,
+                                             config->GetWrite_Binary_LUT());
+      lookup_hints.assign(lookup_table->GetNLevels(), std::numeric_limits<unsigned long>::max());
       break;
     default:
       break;
@@ -76,7 +78,6 @@ CDataDrivenFluid::~CDataDrivenFluid() {
 #endif
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
-      delete lookup_table;
       break;
     default:
       break;
@@ -233,24 +234,19 @@ unsigned long CDataDrivenFluid::Predict_MLP(su2double rho, su2double e) {
 }
 
 unsigned long CDataDrivenFluid::Predict_LUT(su2double rho, su2double e) {
-  unsigned long exit_code;
-  std::vector<std::string> output_names_rhoe_LUT;
-  std::vector<su2double*> outputs_LUT;
-  output_names_rhoe_LUT.resize(output_names_rhoe.size());
-  for (auto iOutput = 0u; iOutput < output_names_rhoe.size(); iOutput++) {
-    output_names_rhoe_LUT[iOutput] = output_names_rhoe[iOutput];
-  }
-
-  outputs_LUT.resize(outputs_rhoe.size());
-  for (auto iOutput = 0u; iOutput < outputs_rhoe.size(); iOutput++) {
-    outputs_LUT[iOutput] = outputs_rhoe[iOutput];
-  }
-
-  exit_code = lookup_table->LookUp_XY(output_names_rhoe_LUT, outputs_LUT, rho, e);
-  return exit_code;
+  /*--- The output names and pointers are used directly, without per-query copies. ---*/
+  return lookup_table->LookUp_XY(output_names_rhoe, outputs_rhoe, rho, e, 0, lookup_hints.data());
 }
 
 void CDataDrivenFluid::Evaluate_Dataset(su2double rho, su2double e) {
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  /*--- Repeated queries reuse the outputs of the last evaluation, e.g. the final state of the Newton solvers.
+   * With AD the outputs need to be recomputed to depend on the current inputs. ---*/
+  if ((rho == rho_last) && (e == e_last)) return;
+  rho_last = rho;
+  e_last = e;
+#endif
+
   /*--- Evaluate dataset based on regression method. ---*/
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
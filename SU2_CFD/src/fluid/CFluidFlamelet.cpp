@@ -72,8 +72,9 @@ CFluidFlamelet::CFluidFlamelet(CConfig* config, su2double value_pressure_operati
         cout << "***   initializing the lookup table   ***" << endl;
         cout << "*****************************************" << endl;
       }
-      look_up_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], table_scalar_names[I_PROGVAR],
-                                       table_scalar_names[I_ENTH]);
+      look_up_table = CLookUpTable::GetShared(config->GetDataDriven_FileNames()[0], table_scalar_names[I_PROGVAR],
+                                              table_scalar_names[I_ENTH], config->GetWrite_Binary_LUT());
+      lookup_hints.assign(look_up_table->GetNLevels(), std::numeric_limits<unsigned long>::max());
       break;
     default:
       if (rank == MASTER_NODE) {
@@ -98,7 +99,6 @@ CFluidFlamelet::CFluidFlamelet(CConfig* config, su2double value_pressure_operati
 CFluidFlamelet::~CFluidFlamelet() {
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
-      delete look_up_table;
       break;
     case ENUM_DATADRIVEN_METHOD::MLP:
 #ifdef USE_MLPCPP
@@ -236,9 +236,10 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
       if (include_mixture_fraction) {
-        extrapolation = look_up_table->LookUp_XYZ(varnames, output_refs, val_prog, val_enth, val_mixfrac);
+        extrapolation = look_up_table->LookUp_XYZ(varnames, output_refs, val_prog, val_enth, val_mixfrac,
+                                                   lookup_hints.data());
       } else {
-        extrapolation = look_up_table->LookUp_XY(varnames, output_refs, val_prog, val_enth);
+        extrapolation = look_up_table->LookUp_XY(varnames, output_refs, val_prog, val_enth, 0, lookup_hints.data());
       }
       break;
     case ENUM_DATADRIVEN_METHOD::MLP:
@@ -1158,6 +1158,39 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  SetReactionConstants();
+}
+
+void CSU2TCLib::SetReactionConstants() {
+
+  /*--- Equilibrium constants and stoichiometric coefficients of each reaction ---*/
+  RxnEquilTables.resize(nReactions);
+  ReactantOrder.resize(nReactions, nSpecies) = 0;
+  ProductOrder.resize(nReactions, nSpecies) = 0;
+
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    RxnEquilTables[iReaction] = RxnConstantTable;
+
+    for (unsigned short ii = 0; ii < 3; ii++) {
+      if (Reactions(iReaction,0,ii) != nSpecies) ReactantOrder(iReaction, Reactions(iReaction,0,ii))++;
+      if (Reactions(iReaction,1,ii) != nSpecies) ProductOrder(iReaction, Reactions(iReaction,1,ii))++;
+    }
+  }
+
+  /*--- Millikan & White coefficients, only T and P of the relaxation times depend on the state ---*/
+  MW_A.resize(nSpecies,nSpecies);
+  MW_B.resize(nSpecies,nSpecies);
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+      const su2double mu = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
+      MW_A(iSpecies,jSpecies) = 1.16 * 1E-3 * sqrt(mu) * pow(CharVibTemp[iSpecies], 4.0/3.0);
+      MW_B(iSpecies,jSpecies) = 0.015 * pow(mu, 0.25);
+    }
+  }
+
+  Conc.resize(nSpecies,0.0);
 }
 
 CSU2TCLib::~CSU2TCLib()= default;
@@ -1358,6 +1391,16 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
+  /*--- Quantities common to all reactions: concentrations, mixture number density (1/cm^3), log of temperatures ---*/
+  su2double N = 0.0;
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    Conc[iSpecies] = 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+  }
+  N *= 1E-6;
+  const su2double logT = log(T);
+  const su2double logTve = log(Tve);
+
   /*--- Loop over all reactions ---*/
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -1366,15 +1409,15 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     bf = Tcf_b[iReaction];
     ab = Tcb_a[iReaction];
     bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
+    Trxnf = exp(af*logT + bf*logTve);
+    Trxnb = exp(ab*logT + bb*logTve);
 
     /*--- Calculate the modified temperature ---*/
     Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
     Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
 
     /*--- Get the Keq & Arrhenius coefficients ---*/
-    ComputeKeqConstants(iReaction);
+    ComputeKeqConstants(iReaction, N);
 
     /*--- Calculate Keq ---*/
     const su2double Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
@@ -1393,12 +1436,12 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
       /*--- Reactants ---*/
       iSpecies = Reactions(iReaction,0,ii);
       if ( iSpecies != nSpecies)
-        fwdRxn *= 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+        fwdRxn *= Conc[iSpecies];
 
       /*--- Products ---*/
       jSpecies = Reactions(iReaction,1,ii);
       if (jSpecies != nSpecies) {
-        bkwRxn *= 0.001*rhos[jSpecies]/MolarMass[jSpecies];
+        bkwRxn *= Conc[jSpecies];
       }
     }
 
@@ -1441,17 +1484,12 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   /*--- Initializing derivative variables ---*/
   dkf.resize(nVar,0.0);      dkb.resize(nVar,0.0);
   dRfok.resize(nVar,0.0);    dRbok.resize(nVar,0.0);
-  alphak.resize(nSpecies,0); betak.resize(nSpecies,0);
 
   for (iVar=0;iVar<nVar;iVar++){
    dkf[iVar]=0.0; dRfok[iVar]=0.0;
    dkb[iVar]=0.0; dRbok[iVar]=0.0;
   }
 
-  for (iSpecies=0;iSpecies<nSpecies;iSpecies++){
-   alphak[iSpecies]=0; betak[iSpecies]=0;
-  }
-
   /*--- Extract additional Arrhenius information ---*/
   su2double eta   = ArrheniusEta[iReaction];
   su2double theta = ArrheniusTheta[iReaction];
@@ -1479,43 +1517,8 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   }
 
   /*--- Rxn rate derivatives ---*/
-  for (ii = 0; ii < 3; ii++) {
-
-    /*--- Products ---*/
-    iSpecies = Reactions(iReaction,1,ii);
-    if (iSpecies != nSpecies)
-      betak[iSpecies]++;
-
-    /*--- Reactants ---*/
-    iSpecies = Reactions(iReaction,0,ii);
-    if (iSpecies != nSpecies)
-      alphak[iSpecies]++;
-  }
-
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
-
-    // Fwd
-    dRfok[iSpecies] =  0.001*alphak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, alphak[iSpecies]-1));
-
-    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
-      if (jSpecies != iSpecies)
-        dRfok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                       alphak[jSpecies]);
-    dRfok[iSpecies] *= 1000.0;
-
-    // Bkw
-    dRbok[iSpecies] =  0.001*betak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, betak[iSpecies]-1));
-
-    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
-      if (jSpecies != iSpecies)
-        dRbok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                        betak[jSpecies]);
-    dRbok[iSpecies] *= 1000.0;
-  }
+  ReactionRateDerivatives(ReactantOrder[iReaction], dRfok);
+  ReactionRateDerivatives(ProductOrder[iReaction], dRbok);
 
   for (ii = 0; ii < 3; ii++) {
 
@@ -1555,21 +1558,30 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   } // ii
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+void CSU2TCLib::ReactionRateDerivatives(const int* order, vector<su2double>& dRok) const {
 
-  unsigned short ii;
+  /*--- Derivatives of 1000 * prod_j (0.001 rho_j/M_j)^order_j, the powers are small integers ---*/
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    dRok[iSpecies] = 0.0;
+    if (order[iSpecies] == 0) continue;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
+    su2double val = 1000.0 * 0.001*order[iSpecies]/MolarMass[iSpecies];
+    for (int k = 1; k < order[iSpecies]; k++) val *= Conc[iSpecies];
 
-  /*--- Calculate mixture number density ---*/
-  su2double N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+    for (unsigned short jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+      if (jSpecies == iSpecies) continue;
+      for (int k = 0; k < order[jSpecies]; k++) val *= Conc[jSpecies];
+    }
+    dRok[iSpecies] = val;
   }
+}
 
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction, su2double N) {
+
+  unsigned short ii;
+
+  /*--- Database constants of the reaction ---*/
+  const auto& EquilTable = RxnEquilTables[val_Reaction];
 
   /*--- Determine table index based on mixture N ---*/
   unsigned short tbl_offset = 14;
@@ -1579,11 +1591,11 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
   unsigned short iIndex = int(pwr) - tbl_offset;
   if (iIndex <= 0) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
+      A[ii] = EquilTable(0,ii);
     return;
   } if (iIndex >= 5) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
+      A[ii] = EquilTable(5,ii);
     return;
   }
 
@@ -1598,9 +1610,9 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   /*--- Interpolate ---*/
   for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
+    A[ii] =  (EquilTable(iIndex+1,ii) - EquilTable(iIndex,ii))
         / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
+        + EquilTable(iIndex,ii);
   }
 }
 
@@ -1614,12 +1626,6 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   // Note: Millikan & White relaxation time (requires P in Atm.)
   // Note: Park limiting cross section
 
-  su2activematrix mu;
-  vector<su2double> MolarFrac;
-
-  MolarFrac.resize(nSpecies,0.0);
-  mu.resize(nSpecies,nSpecies)=su2double(0.0);
-
   su2double omegaVT = 0.0;
   su2double omegaCV = 0.0;
 
@@ -1632,12 +1638,16 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   }
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    MolarFrac[iSpecies] = (rhos[iSpecies] / MolarMass[iSpecies]) / conc;
+    MolarFractions[iSpecies] = (rhos[iSpecies] / MolarMass[iSpecies]) / conc;
 
   /*--- Compute Eve and Eve* ---*/
   eve_eq = ComputeSpeciesEve(T, true);
   eve    = ComputeSpeciesEve(Tve, true);
 
+  /*--- State dependent factors of the Millikan & White relaxation times ---*/
+  const su2double T_m13 = pow(T, -1.0/3.0);
+  const su2double P_atm = Pressure / 101325.0;
+
   /*--- Loop over species to calculate source term --*/
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
 
@@ -1645,13 +1655,10 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
     su2double num   = 0.0;
     su2double denom = 0.0;
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
-      mu(iSpecies,jSpecies) = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
-      const su2double A_sr   = 1.16 * 1E-3 * sqrt(mu(iSpecies,jSpecies)) * pow(CharVibTemp[iSpecies], 4.0/3.0);
-      const su2double B_sr   = 0.015 * pow(mu(iSpecies,jSpecies), 0.25);
-      const su2double tau_sr = 101325.0/Pressure * exp(A_sr*(pow(T,-1.0/3.0) - B_sr) - 18.42);
+      const su2double tau_sr = exp(MW_A(iSpecies,jSpecies)*(T_m13 - MW_B(iSpecies,jSpecies)) - 18.42) / P_atm;
 
-      num   += MolarFrac[jSpecies];
-      denom += MolarFrac[jSpecies] / tau_sr;
+      num   += MolarFractions[jSpecies];
+      denom += MolarFractions[jSpecies] / tau_sr;
     }
 
     const su2double tauMW = num / denom;
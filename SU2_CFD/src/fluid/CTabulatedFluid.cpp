@@ -0,0 +1,393 @@
+/*!
+ * \file CTabulatedFluid.cpp
+ * \brief Source of the fluid model that interpolates another fluid model from a table.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid/CTabulatedFluid.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+
+CTabulatedFluid::CTabulatedFluid(CFluidModel* eos_in, const CConfig* config) : CFluidModel(), eos(eos_in) {
+  table = GetTable(*eos, config);
+}
+
+shared_ptr<const CTabulatedFluid::CTable> CTabulatedFluid::GetTable(CFluidModel& eos, const CConfig* config) {
+  /*--- The table is defined in the non-dimensional units of the fluid models. ---*/
+  const auto rho_range = config->GetTabulation_Density_Range();
+  const auto T_range = config->GetTabulation_Temperature_Range();
+  const su2double rho_min = rho_range[0] / config->GetDensity_Ref();
+  const su2double rho_max = rho_range[1] / config->GetDensity_Ref();
+  const su2double T_min = T_range[0] / config->GetTemperature_Ref();
+  const su2double T_max = T_range[1] / config->GetTemperature_Ref();
+
+  /*--- Everything that defines the table, to share it and to check cached files. ---*/
+  ostringstream key;
+  key << setprecision(17) << config->GetKind_FluidModel() << ' ' << config->GetFluid_Name() << ' '
+      << SU2_TYPE::GetValue(config->GetGamma()) << ' ' << SU2_TYPE::GetValue(config->GetGas_Constant()) << ' '
+      << SU2_TYPE::GetValue(config->GetPressure_Critical()) << ' '
+      << SU2_TYPE::GetValue(config->GetTemperature_Critical()) << ' '
+      << SU2_TYPE::GetValue(config->GetAcentric_Factor()) << ' ' << SU2_TYPE::GetValue(config->GetPressure_Ref())
+      << ' ' << SU2_TYPE::GetValue(config->GetDensity_Ref()) << ' '
+      << SU2_TYPE::GetValue(config->GetTemperature_Ref()) << ' ' << SU2_TYPE::GetValue(rho_range[0]) << ' '
+      << SU2_TYPE::GetValue(rho_range[1]) << ' ' << SU2_TYPE::GetValue(T_range[0]) << ' '
+      << SU2_TYPE::GetValue(T_range[1]) << ' ' << config->GetTabulation_Size()[0] << ' '
+      << config->GetTabulation_Size()[1];
+
+  static map<string, weak_ptr<const CTable>> tables;
+
+  shared_ptr<const CTable> table;
+
+  SU2_OMP_CRITICAL {
+    auto& entry = tables[key.str()];
+    table = entry.lock();
+
+    if (!table) {
+      const int rank = SU2_MPI::GetRank();
+      const auto& file_name = config->GetTabulation_FileName();
+      auto new_table = make_shared<CTable>();
+
+      if (!file_name.empty() && ReadTable(file_name, key.str(), *new_table)) {
+        if (rank == MASTER_NODE) cout << "Read the fluid table from " << file_name << "." << endl;
+      } else {
+        if (rank == MASTER_NODE) cout << "Building the fluid table..." << flush;
+        new_table->n_rho = config->GetTabulation_Size()[0];
+        new_table->n_e = config->GetTabulation_Size()[1];
+        BuildTable(eos, rho_min, rho_max, T_min, T_max, *new_table);
+        if (rank == MASTER_NODE) cout << " done." << endl;
+
+        if (!file_name.empty() && rank == MASTER_NODE) WriteTable(file_name, key.str(), *new_table);
+      }
+      table = new_table;
+      entry = table;
+    }
+  }
+  END_SU2_OMP_CRITICAL
+
+  return table;
+}
+
+void CTabulatedFluid::BuildTable(CFluidModel& eos, su2double rho_min, su2double rho_max, su2double T_min,
+                                 su2double T_max, CTable& table) {
+  const auto n_rho = table.n_rho;
+  const auto n_e = table.n_e;
+
+  table.logrho_min = log(SU2_TYPE::GetValue(rho_min));
+  table.dlogrho = (log(SU2_TYPE::GetValue(rho_max)) - table.logrho_min) / (n_rho - 1);
+
+  auto Density = [&](unsigned long i) { return exp(table.logrho_min + i * table.dlogrho); };
+
+  /*--- The energy range covers the temperature range for all the densities of the table. ---*/
+  passivedouble e_min = numeric_limits<passivedouble>::max();
+  passivedouble e_max = numeric_limits<passivedouble>::lowest();
+  for (auto i = 0ul; i < n_rho; ++i) {
+    eos.SetTDState_rhoT(Density(i), T_min);
+    const passivedouble e_low = SU2_TYPE::GetValue(eos.GetStaticEnergy());
+    if (std::isfinite(e_low)) e_min = min(e_min, e_low);
+    eos.SetTDState_rhoT(Density(i), T_max);
+    const passivedouble e_high = SU2_TYPE::GetValue(eos.GetStaticEnergy());
+    if (std::isfinite(e_high)) e_max = max(e_max, e_high);
+  }
+  if (!(e_max > e_min)) {
+    SU2_MPI::Error("Could not determine the energy range of the fluid table, check TABULATION_TEMPERATURE_RANGE.",
+                   CURRENT_FUNCTION);
+  }
+  table.e_min = e_min;
+  table.de = (e_max - e_min) / (n_e - 1);
+
+  table.coeffs.assign(n_rho * n_e * N_COEFFS * N_VARS, numeric_limits<passivedouble>::quiet_NaN());
+
+  auto Coeff = [&](unsigned long i, unsigned long j, unsigned short iCoeff, unsigned short iVar) -> passivedouble& {
+    return table.coeffs[((i * n_e + j) * N_COEFFS + iCoeff) * N_VARS + iVar];
+  };
+
+  /*--- Values at the nodes, and the derivatives that follow from the model (w.r.t. log(rho) and e). ---*/
+  for (auto i = 0ul; i < n_rho; ++i) {
+    const passivedouble rho = Density(i);
+    for (auto j = 0ul; j < n_e; ++j) {
+      eos.SetTDState_rhoe(rho, table.e_min + j * table.de);
+
+      const passivedouble P = SU2_TYPE::GetValue(eos.GetPressure());
+      const passivedouble T = SU2_TYPE::GetValue(eos.GetTemperature());
+
+      Coeff(i, j, 0, I_P) = P;
+      Coeff(i, j, 0, I_T) = T;
+      Coeff(i, j, 0, I_S) = SU2_TYPE::GetValue(eos.GetEntropy());
+      Coeff(i, j, 0, I_CP) = SU2_TYPE::GetValue(eos.GetCp());
+
+      Coeff(i, j, 1, I_P) = rho * SU2_TYPE::GetValue(eos.GetdPdrho_e()) * table.dlogrho;
+      Coeff(i, j, 2, I_P) = SU2_TYPE::GetValue(eos.GetdPde_rho()) * table.de;
+
+      /*--- Gibbs relation, T ds = de - P / rho^2 drho. ---*/
+      Coeff(i, j, 1, I_S) = -P / (rho * T) * table.dlogrho;
+      Coeff(i, j, 2, I_S) = table.de / T;
+    }
+  }
+
+  /*--- The remaining derivatives by finite differences of the nodal data, central where possible. ---*/
+  auto Difference = [](unsigned long k, unsigned long n, const std::function<passivedouble(unsigned long)>& f) {
+    if (k == 0) return f(1) - f(0);
+    if (k == n - 1) return f(n - 1) - f(n - 2);
+    return 0.5 * (f(k + 1) - f(k - 1));
+  };
+
+  for (auto i = 0ul; i < n_rho; ++i) {
+    for (auto j = 0ul; j < n_e; ++j) {
+      for (const auto iVar : {I_T, I_CP}) {
+        Coeff(i, j, 1, iVar) = Difference(i, n_rho, [&](unsigned long k) { return Coeff(k, j, 0, iVar); });
+        Coeff(i, j, 2, iVar) = Difference(j, n_e, [&](unsigned long k) { return Coeff(i, k, 0, iVar); });
+      }
+    }
+  }
+  for (auto i = 0ul; i < n_rho; ++i) {
+    for (auto j = 0ul; j < n_e; ++j) {
+      for (unsigned short iVar = 0; iVar < N_VARS; ++iVar) {
+        Coeff(i, j, 3, iVar) = Difference(i, n_rho, [&](unsigned long k) { return Coeff(k, j, 2, iVar); });
+      }
+    }
+  }
+
+  /*--- Cells with non-finite data (e.g. states where the model fails) are evaluated with the model. ---*/
+  table.valid_cell.assign((n_rho - 1) * (n_e - 1), true);
+  for (auto i = 0ul; i < n_rho - 1; ++i) {
+    for (auto j = 0ul; j < n_e - 1; ++j) {
+      for (auto node : {i * n_e + j, i * n_e + j + 1, (i + 1) * n_e + j, (i + 1) * n_e + j + 1}) {
+        for (auto k = 0ul; k < N_COEFFS * N_VARS; ++k) {
+          if (!std::isfinite(table.coeffs[node * N_COEFFS * N_VARS + k])) table.valid_cell[i * (n_e - 1) + j] = false;
+        }
+      }
+    }
+  }
+}
+
+bool CTabulatedFluid::ReadTable(const string& file_name, const string& key, CTable& table) {
+  ifstream file_stream(file_name, ios::in | ios::binary);
+  if (!file_stream.is_open()) return false;
+
+  auto readUInt = [&]() {
+    uint64_t tmp = 0;
+    file_stream.read(reinterpret_cast<char*>(&tmp), sizeof(tmp));
+    return static_cast<unsigned long>(tmp);
+  };
+
+  const auto key_size = readUInt();
+  if (!file_stream || key_size != key.size()) return false;
+  string file_key(key_size, '\0');
+  file_stream.read(&file_key[0], file_key.size());
+  if (file_key != key) return false;
+
+  table.n_rho = readUInt();
+  table.n_e = readUInt();
+  file_stream.read(reinterpret_cast<char*>(&table.logrho_min), sizeof(passivedouble));
+  file_stream.read(reinterpret_cast<char*>(&table.dlogrho), sizeof(passivedouble));
+  file_stream.read(reinterpret_cast<char*>(&table.e_min), sizeof(passivedouble));
+  file_stream.read(reinterpret_cast<char*>(&table.de), sizeof(passivedouble));
+
+  table.coeffs.resize(table.n_rho * table.n_e * N_COEFFS * N_VARS);
+  table.valid_cell.resize((table.n_rho - 1) * (table.n_e - 1));
+  file_stream.read(reinterpret_cast<char*>(table.coeffs.data()), table.coeffs.size() * sizeof(passivedouble));
+  file_stream.read(table.valid_cell.data(), table.valid_cell.size());
+
+  return static_cast<bool>(file_stream);
+}
+
+void CTabulatedFluid::WriteTable(const string& file_name, const string& key, const CTable& table) {
+  /*--- Write to a temporary file and rename it, other processes never see an incomplete file. ---*/
+  const string tmp_name = file_name + ".tmp";
+  {
+    ofstream file_stream(tmp_name, ios::out | ios::binary);
+    if (!file_stream.is_open()) {
+      SU2_MPI::Error("Could not open " + tmp_name + " to write the fluid table.", CURRENT_FUNCTION);
+    }
+
+    auto writeUInt = [&](unsigned long value) {
+      const auto tmp = static_cast<uint64_t>(value);
+      file_stream.write(reinterpret_cast<const char*>(&tmp), sizeof(tmp));
+    };
+
+    writeUInt(key.size());
+    file_stream.write(key.data(), key.size());
+    writeUInt(table.n_rho);
+    writeUInt(table.n_e);
+    file_stream.write(reinterpret_cast<const char*>(&table.logrho_min), sizeof(passivedouble));
+    file_stream.write(reinterpret_cast<const char*>(&table.dlogrho), sizeof(passivedouble));
+    file_stream.write(reinterpret_cast<const char*>(&table.e_min), sizeof(passivedouble));
+    file_stream.write(reinterpret_cast<const char*>(&table.de), sizeof(passivedouble));
+    file_stream.write(reinterpret_cast<const char*>(table.coeffs.data()), table.coeffs.size() * sizeof(passivedouble));
+    file_stream.write(table.valid_cell.data(), table.valid_cell.size());
+  }
+  if (rename(tmp_name.c_str(), file_name.c_str()) != 0) {
+    SU2_MPI::Error("Could not write the fluid table to " + file_name + ".", CURRENT_FUNCTION);
+  }
+}
+
+void CTabulatedFluid::SetTDState_rhoe_EOS(su2double rho, su2double e) {
+  eos->SetTDState_rhoe(rho, e);
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = eos->GetPressure();
+  Temperature = eos->GetTemperature();
+  Entropy = eos->GetEntropy();
+  SoundSpeed2 = eos->GetSoundSpeed2();
+  Cp = eos->GetCp();
+  Cv = eos->GetCv();
+  dPdrho_e = eos->GetdPdrho_e();
+  dPde_rho = eos->GetdPde_rho();
+  dTdrho_e = eos->GetdTdrho_e();
+  dTde_rho = eos->GetdTde_rho();
+}
+
+void CTabulatedFluid::SetTDState_rhoe(su2double rho, su2double e) {
+  const auto& tab = *table;
+
+  /*--- Normalized coordinates, the comparisons are false for NaN. ---*/
+  const su2double x = (log(rho) - tab.logrho_min) / tab.dlogrho;
+  const su2double y = (e - tab.e_min) / tab.de;
+  const passivedouble x_val = SU2_TYPE::GetValue(x), y_val = SU2_TYPE::GetValue(y);
+
+  if (!(x_val >= 0 && x_val <= tab.n_rho - 1 && y_val >= 0 && y_val <= tab.n_e - 1)) {
+    SetTDState_rhoe_EOS(rho, e);
+    return;
+  }
+  const auto i = min(static_cast<unsigned long>(x_val), tab.n_rho - 2);
+  const auto j = min(static_cast<unsigned long>(y_val), tab.n_e - 2);
+
+  if (!tab.valid_cell[i * (tab.n_e - 1) + j]) {
+    SetTDState_rhoe_EOS(rho, e);
+    return;
+  }
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(rho);
+  AD::SetPreaccIn(e);
+
+  const su2double t = x - passivedouble(i), u = y - passivedouble(j);
+
+  /*--- Cubic Hermite basis, A for the values and B for the derivatives at the start (0) and end (1) nodes. ---*/
+  const su2double At[] = {(1 + 2 * t) * (1 - t) * (1 - t), t * t * (3 - 2 * t)};
+  const su2double Bt[] = {t * (1 - t) * (1 - t), t * t * (t - 1)};
+  const su2double dAt[] = {6 * t * (t - 1), 6 * t * (1 - t)};
+  const su2double dBt[] = {(1 - t) * (1 - 3 * t), t * (3 * t - 2)};
+  const su2double Au[] = {(1 + 2 * u) * (1 - u) * (1 - u), u * u * (3 - 2 * u)};
+  const su2double Bu[] = {u * (1 - u) * (1 - u), u * u * (u - 1)};
+  const su2double dAu[] = {6 * u * (u - 1), 6 * u * (1 - u)};
+  const su2double dBu[] = {(1 - u) * (1 - 3 * u), u * (3 * u - 2)};
+
+  /*--- Values and derivatives w.r.t. the normalized coordinates. The inner loops are over the variables, which
+   * are contiguous in the table, so that all variables are interpolated together with vector instructions. ---*/
+  su2double val[N_VARS] = {0.0}, val_t[N_VARS] = {0.0}, val_u[N_VARS] = {0.0};
+
+  for (int a = 0; a < 2; ++a) {
+    for (int b = 0; b < 2; ++b) {
+      const passivedouble* coeffs = &tab.coeffs[((i + a) * tab.n_e + j + b) * N_COEFFS * N_VARS];
+
+      const su2double w[] = {At[a] * Au[b], Bt[a] * Au[b], At[a] * Bu[b], Bt[a] * Bu[b]};
+      const su2double w_t[] = {dAt[a] * Au[b], dBt[a] * Au[b], dAt[a] * Bu[b], dBt[a] * Bu[b]};
+      const su2double w_u[] = {At[a] * dAu[b], Bt[a] * dAu[b], At[a] * dBu[b], Bt[a] * dBu[b]};
+
+      for (unsigned short iCoeff = 0; iCoeff < N_COEFFS; ++iCoeff) {
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned short iVar = 0; iVar < N_VARS; ++iVar) {
+          const passivedouble c = coeffs[iCoeff * N_VARS + iVar];
+          val[iVar] += w[iCoeff] * c;
+          val_t[iVar] += w_t[iCoeff] * c;
+          val_u[iVar] += w_u[iCoeff] * c;
+        }
+      }
+    }
+  }
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = val[I_P];
+  Temperature = val[I_T];
+  Entropy = val[I_S];
+  Cp = val[I_CP];
+
+  /*--- Chain rule for x = (log(rho) - log(rho_min)) / dlogrho and y = (e - e_min) / de. ---*/
+  dPdrho_e = val_t[I_P] / (tab.dlogrho * rho);
+  dPde_rho = val_u[I_P] / tab.de;
+  dTdrho_e = val_t[I_T] / (tab.dlogrho * rho);
+  dTde_rho = val_u[I_T] / tab.de;
+
+  SoundSpeed2 = dPdrho_e + Pressure / (rho * rho) * dPde_rho;
+  Cv = 1 / dTde_rho;
+
+  AD::SetPreaccOut(Pressure);
+  AD::SetPreaccOut(Temperature);
+  AD::SetPreaccOut(Entropy);
+  AD::SetPreaccOut(Cp);
+  AD::SetPreaccOut(dPdrho_e);
+  AD::SetPreaccOut(dPde_rho);
+  AD::SetPreaccOut(dTdrho_e);
+  AD::SetPreaccOut(dTde_rho);
+  AD::SetPreaccOut(SoundSpeed2);
+  AD::SetPreaccOut(Cv);
+  AD::EndPreacc();
+}
+
+void CTabulatedFluid::SetTDState_PT(su2double P, su2double T) {
+  eos->SetTDState_PT(P, T);
+  SetTDState_rhoe(eos->GetDensity(), eos->GetStaticEnergy());
+}
+
+void CTabulatedFluid::SetTDState_Prho(su2double P, su2double rho) {
+  eos->SetEnergy_Prho(P, rho);
+  SetTDState_rhoe(rho, eos->GetStaticEnergy());
+}
+
+void CTabulatedFluid::SetEnergy_Prho(su2double P, su2double rho) {
+  eos->SetEnergy_Prho(P, rho);
+  StaticEnergy = eos->GetStaticEnergy();
+}
+
+void CTabulatedFluid::SetTDState_hs(su2double h, su2double s) {
+  eos->SetTDState_hs(h, s);
+  SetTDState_rhoe(eos->GetDensity(), eos->GetStaticEnergy());
+}
+
+void CTabulatedFluid::SetTDState_rhoT(su2double rho, su2double T) {
+  eos->SetTDState_rhoT(rho, T);
+  SetTDState_rhoe(rho, eos->GetStaticEnergy());
+}
+
+void CTabulatedFluid::SetTDState_Ps(su2double P, su2double s) {
+  eos->SetTDState_Ps(P, s);
+  SetTDState_rhoe(eos->GetDensity(), eos->GetStaticEnergy());
+}
+
+void CTabulatedFluid::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+  eos->ComputeDerivativeNRBC_Prho(P, rho);
+  dhdrho_P = eos->Getdhdrho_P();
+  dhdP_rho = eos->GetdhdP_rho();
+  dsdrho_P = eos->Getdsdrho_P();
+  dsdP_rho = eos->GetdsdP_rho();
+}
@@ -60,12 +60,16 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
         complicated algorithm must be used to facilitate time accurate
         local time stepping.  Note that we are currently hard-coding
         the classical RK4 scheme. ---*/
-  bool useADER = false;
+  bool useADER = false, useImplicit = false;
   switch (config[iZone]->GetKind_TimeIntScheme()) {
     case RUNGE_KUTTA_EXPLICIT: iLimit = config[iZone]->GetnRKStep(); break;
     case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
     case ADER_DG: iLimit = 1; useADER = true; break;
-    case EULER_EXPLICIT: case EULER_IMPLICIT: iLimit = 1; break; }
+    case EULER_IMPLICIT: iLimit = 1; useImplicit = true; break;
+    case EULER_EXPLICIT: iLimit = 1; break; }
+
+  /*--- The p-multigrid cycle replaces the Runge-Kutta iteration for steady problems. ---*/
+  const bool usePMultigrid = config[iZone]->GetnPMGLevels_DG() > 0;
 
   /*--- In case an unsteady simulation is carried out, it is possible that a
         synchronization time step is specified. If so, set the boolean
@@ -106,6 +110,22 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
                                                                                               numerics_container[iZone][iInst][iMesh][SolContainer_Position],
                                                                                               config[iZone], iMesh, RunTime_EqSystem);
     }
+    else if( useImplicit ) {
+
+      /*--- The implicit scheme computes the new solution with Newton iterations,
+            which evaluate the spatial residual themselves. ---*/
+      solver_container[iZone][iInst][iMesh][SolContainer_Position]->Implicit_SpaceTimeIntegration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                                  numerics_container[iZone][iInst][iMesh][SolContainer_Position],
+                                                                                                  config[iZone], iMesh, RunTime_EqSystem);
+    }
+    else if( usePMultigrid ) {
+
+      /*--- One V-cycle of the p-multigrid method, which smooths all levels with
+            the Runge-Kutta scheme. ---*/
+      solver_container[iZone][iInst][iMesh][SolContainer_Position]->PMultigrid_Cycle(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                     numerics_container[iZone][iInst][iMesh][SolContainer_Position],
+                                                                                     config[iZone], iMesh, RunTime_EqSystem);
+    }
     else {
 
       /*--- Time and space integration can be decoupled. ---*/
@@ -27,6 +27,8 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
 
 
 CIntegration::CIntegration() {
@@ -47,7 +49,9 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
   /*--- Compute inviscid residuals ---*/
-
+  {
+  SU2_PHASE_TIMER(CONVECTIVE_RESIDUAL);
+  SU2_TAPE_PROBE(CONVECTIVE_RESIDUAL);
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -56,12 +60,22 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
       break;
   }
+  }
 
   /*--- Compute viscous residuals ---*/
+  {
+  SU2_PHASE_TIMER(VISCOUS_RESIDUAL);
+  SU2_TAPE_PROBE(VISCOUS_RESIDUAL);
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
+  {
+  SU2_PHASE_TIMER(SOURCE_RESIDUAL);
+  const CScopedTapeProbe tapeProbe(MainSolver == TURB_SOL ? TAPE_KERNEL::TURB_SOURCE_RESIDUAL
+                                                          : TAPE_KERNEL::SOURCE_RESIDUAL);
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -207,7 +221,10 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
       solver_container[MainSolver]->ExplicitEuler_Iteration(geometry, solver_container, config);
       break;
     case (EULER_IMPLICIT):
-      solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
+      if (config->GetKind_Rosenbrock() != ROSENBROCK_SCHEME::NONE)
+        solver_container[MainSolver]->RosenbrockW_Iteration(geometry, solver_container, config, iRKStep);
+      else
+        solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
       break;
   }
 
@@ -218,12 +235,10 @@ void CIntegration::SetDualTime_Geometry(CGeometry *geometry, CSolver *mesh_solve
   SU2_OMP_PARALLEL
   {
 
-  geometry->nodes->SetVolume_nM1();
-  geometry->nodes->SetVolume_n();
+  geometry->nodes->ShiftVolume_n();
 
   if (config->GetGrid_Movement()) {
-    geometry->nodes->SetCoord_n1();
-    geometry->nodes->SetCoord_n();
+    geometry->nodes->ShiftCoord_n();
   }
 
   if ((iMesh==MESH_0) && config->GetDeform_Mesh()) mesh_solver->SetDualTime_Mesh();
@@ -237,8 +252,7 @@ void CIntegration::SetDualTime_Solver(const CGeometry *geometry, CSolver *solver
   SU2_OMP_PARALLEL
   {
   /*--- Store old solution ---*/
-  solver->GetNodes()->Set_Solution_time_n1();
-  solver->GetNodes()->Set_Solution_time_n();
+  solver->GetNodes()->Shift_Solution_time_n();
 
   SU2_OMP_SAFE_GLOBAL_ACCESS(solver->ResetCFLAdapt();)
 
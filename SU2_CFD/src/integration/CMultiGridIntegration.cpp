@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
@@ -39,6 +40,8 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                 unsigned short iZone,
                                                 unsigned short iInst) {
 
+  SU2_PHASE_TIMER(INTEGRATION);
+
   bool direct;
   switch (config[iZone]->GetKind_Solver()) {
     case MAIN_SOLVER::EULER:
@@ -110,10 +113,12 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
+  { SU2_PHASE_TIMER(PREPROCESSING);
   solver_container[iZone][iInst][MESH_0][Solver_Position]->Preprocessing(geometry[iZone][iInst][MESH_0],
                                                                          solver_container[iZone][iInst][MESH_0],
                                                                          config[iZone], MESH_0, NO_RK_ITER,
                                                                          RunTime_EqSystem, true);
+  }
 
   /*--- Compute non-dimensional parameters and the convergence monitor ---*/
 
@@ -141,6 +146,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const bool classical_rk4 = (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT);
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool galerkin = implicit && config->GetMG_GalerkinJacobian();
 
   /*--- Shorter names to refer to fine grid entities. ---*/
 
@@ -149,6 +155,26 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   CSolver* solver_fine = solver_container_fine[Solver_Position];
   CNumerics** numerics_fine = numerics_container[iZone][iInst][iMesh][Solver_Position];
 
+  /*--- With Galerkin coarse operators the coarse levels only assemble their residual, their Jacobian is the
+   * product R*A*P of the Jacobian of the previous level, which does not include the pseudo time term when
+   * this level is being smoothed (see the computation of the forcing term). ---*/
+
+  auto SpaceIntegration = [&](unsigned short iRKStep) {
+    const bool coarseGalerkin = galerkin && (iMesh > 0);
+
+    if (coarseGalerkin) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+    }
+
+    Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
+
+    if (coarseGalerkin) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_IMPLICIT);)
+      solver_fine->SetGalerkin_Jacobian(geometry[iZone][iInst][iMesh-1], geometry_fine,
+                                        solver_container[iZone][iInst][iMesh-1][Solver_Position]);
+    }
+  };
+
   /*--- Number of RK steps. ---*/
 
   unsigned short iRKLimit = 1;
@@ -161,8 +187,11 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
       iRKLimit = 4;
       break;
     case EULER_EXPLICIT:
+      /*--- With multirate time stepping each step is a sub step of the finest time level. ---*/
+      iRKLimit = 1u << (config->GetnLevels_TimeAccurateLTS() - 1);
+      break;
     case EULER_IMPLICIT:
-      iRKLimit = 1;
+      iRKLimit = (config->GetKind_Rosenbrock() == ROSENBROCK_SCHEME::ROS2) ? 2 : 1;
       break;
   }
 
@@ -176,7 +205,9 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Send-Receive boundary conditions, and preprocessing ---*/
 
+      { SU2_PHASE_TIMER(PREPROCESSING);
       solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+      }
 
 
       if (iRKStep == 0) {
@@ -199,7 +230,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Space integration ---*/
 
-      Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
+      SpaceIntegration(iRKStep);
 
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
 
@@ -224,25 +255,40 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     CSolver* solver_coarse = solver_container_coarse[Solver_Position];
     CNumerics** numerics_coarse = numerics_container[iZone][iInst][iMesh+1][Solver_Position];
 
-    /*--- Temporarily disable implicit integration, for what follows we do not need the Jacobian. ---*/
+    /*--- Temporarily disable implicit integration, for what follows we do not need the Jacobian. Except
+     * with Galerkin coarse operators, for which the finest level assembles its Jacobian without the pseudo
+     * time term, and the other levels restore theirs, this is the operator restricted to the coarse level. ---*/
 
-    if (implicit) {
+    if (implicit && !(galerkin && iMesh == 0)) {
       SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
     }
 
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
 
+    { SU2_PHASE_TIMER(PREPROCESSING);
     solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+    }
 
     Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
 
+    if (galerkin) {
+      if (iMesh == 0) {
+        SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+      } else {
+        solver_fine->SetGalerkin_Jacobian(geometry[iZone][iInst][iMesh-1], geometry_fine,
+                                          solver_container[iZone][iInst][iMesh-1][Solver_Position]);
+      }
+    }
+
     SetResidual_Term(geometry_fine, solver_fine);
 
-    /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$ ---*/
+    /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$, the restriction of $r_k$ is done in the same sweep. ---*/
 
     SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
+    { SU2_PHASE_TIMER(PREPROCESSING);
     solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
+    }
 
     Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem);
 
@@ -283,7 +329,9 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
 
+        { SU2_PHASE_TIMER(PREPROCESSING);
         solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+        }
 
         if (iRKStep == 0) {
           solver_fine->Set_OldSolution();
@@ -293,7 +341,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
           solver_fine->SetTime_Step(geometry_fine, solver_container_fine, config, iMesh,  config->GetTimeIter());
         }
 
-        Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, iRKStep, RunTime_EqSystem);
+        SpaceIntegration(iRKStep);
 
         Time_Integration(geometry_fine, solver_container_fine, config, iRKStep, RunTime_EqSystem);
 
@@ -307,57 +355,46 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children;
-  const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
+  auto* nodes_fine = sol_fine->GetNodes();
+  auto* nodes_coarse = sol_coarse->GetNodes();
 
-  auto *Solution = new su2double[nVar];
+  /*--- Correction (stored in Solution_Old) = coarse solution - restricted fine solution. ---*/
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+  for (auto Point_Coarse = 0ul; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
+    const su2double scale = 1 / geo_coarse->nodes->GetVolume(Point_Coarse);
+    const su2double* Solution_Coarse = nodes_coarse->GetSolution(Point_Coarse);
+    su2double* Correction = nodes_coarse->GetSolution_Old(Point_Coarse);
 
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
+    for (auto iVar = 0u; iVar < nVar; iVar++) Correction[iVar] = Solution_Coarse[iVar];
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+    for (const auto Point_Fine : geo_coarse->nodes->GetChildren(Point_Coarse)) {
+      const su2double w = geo_fine->nodes->GetVolume(Point_Fine) * scale;
+      const su2double* Solution_Fine = nodes_fine->GetSolution(Point_Fine);
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iVar = 0u; iVar < nVar; iVar++) Correction[iVar] -= w * Solution_Fine[iVar];
     }
-
-    Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] += Solution_Coarse[iVar];
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
   }
   END_SU2_OMP_FOR
 
-  delete [] Solution;
-
   /*--- Remove any contributions from no-slip walls. ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
 
       SU2_OMP_FOR_STAT(32)
-      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
+      for (auto iVertex = 0ul; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
 
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        const auto Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
 
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
 
         su2double zero[3] = {0.0};
-        sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        nodes_coarse->SetVelocity_Old(Point_Coarse, zero);
 
       }
       END_SU2_OMP_FOR
@@ -369,11 +406,15 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_OLD);
   sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
 
+  /*--- Inject the correction into the children. ---*/
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+  for (auto Point_Coarse = 0ul; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    const su2double* Correction = nodes_coarse->GetSolution_Old(Point_Coarse);
+    for (const auto Point_Fine : geo_coarse->nodes->GetChildren(Point_Coarse)) {
+      su2double* Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iVar = 0u; iVar < nVar; iVar++) Residual_Fine[iVar] = Correction[iVar];
     }
   }
   END_SU2_OMP_FOR
@@ -486,14 +527,18 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
 
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren;
+
+  const unsigned short nVar = sol_coarse->GetnVar();
+  auto* nodes_fine = sol_fine->GetNodes();
+  auto* nodes_coarse = sol_coarse->GetNodes();
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->GetNodes()->SetSolution(Point_Fine, sol_coarse->GetNodes()->GetSolution(Point_Coarse));
+  for (auto Point_Coarse = 0ul; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    const su2double* Solution_Coarse = nodes_coarse->GetSolution(Point_Coarse);
+    for (const auto Point_Fine : geo_coarse->nodes->GetChildren(Point_Coarse)) {
+      su2double* Solution_Fine = nodes_fine->GetSolution(Point_Fine);
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iVar = 0u; iVar < nVar; iVar++) Solution_Fine[iVar] = Solution_Coarse[iVar];
     }
   }
   END_SU2_OMP_FOR
@@ -502,48 +547,24 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
 void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                             CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
 
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
-  const su2double *Residual_Fine;
-
-  const unsigned short nVar = sol_coarse->GetnVar();
-  su2double factor = config->GetDamp_Res_Restric();
-
-  auto *Residual = new su2double[nVar];
-
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-
-    sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
-
-    for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
-      for (iVar = 0; iVar < nVar; iVar++)
-        Residual[iVar] += factor*Residual_Fine[iVar];
-    }
-    sol_coarse->GetNodes()->AddRes_TruncError(Point_Coarse, Residual);
-  }
-  END_SU2_OMP_FOR
+  /*--- The restricted fine residual was stored in the truncation error by SetRestricted_Solution. ---*/
 
-  delete [] Residual;
+  auto* nodes_coarse = sol_coarse->GetNodes();
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetViscous_Wall(iMarker)) {
       SU2_OMP_FOR_STAT(32)
-      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+      for (auto iVertex = 0ul; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
+        const auto Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        nodes_coarse->SetVel_ResTruncError_Zero(Point_Coarse);
       }
       END_SU2_OMP_FOR
     }
   }
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
-  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    sol_coarse->GetNodes()->SubtractRes_TruncError(Point_Coarse, sol_coarse->LinSysRes.GetBlock(Point_Coarse));
+  for (auto Point_Coarse = 0ul; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    nodes_coarse->SubtractRes_TruncError(Point_Coarse, sol_coarse->LinSysRes.GetBlock(Point_Coarse));
   }
   END_SU2_OMP_FOR
 
@@ -566,10 +587,42 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const bool grid_movement = config->GetGrid_Movement();
 
-  /*--- Compute coarse solution from fine solution ---*/
+  const unsigned short nVar = sol_coarse->GetnVar();
+  const su2double factor = config->GetDamp_Res_Restric();
+  auto* nodes_fine = sol_fine->GetNodes();
+  auto* nodes_coarse = sol_coarse->GetNodes();
+
+  /*--- Compute the coarse solution (volume average) and, in the same sweep over the children,
+   * the restriction of the fine residual, i.e. the first part of the forcing term. ---*/
+
+  vector<su2double> Residual(nVar);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  for (auto Point_Coarse = 0ul; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+
+    const su2double scale = 1 / geo_coarse->nodes->GetVolume(Point_Coarse);
+    su2double* Solution_Coarse = nodes_coarse->GetSolution(Point_Coarse);
 
-  CSolver::MultigridRestriction(*geo_fine, sol_fine->GetNodes()->GetSolution(),
-                                *geo_coarse, sol_coarse->GetNodes()->GetSolution());
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      Solution_Coarse[iVar] = 0.0;
+      Residual[iVar] = 0.0;
+    }
+
+    for (const auto Point_Fine : geo_coarse->nodes->GetChildren(Point_Coarse)) {
+      const su2double w = geo_fine->nodes->GetVolume(Point_Fine) * scale;
+      const su2double* Solution_Fine = nodes_fine->GetSolution(Point_Fine);
+      const su2double* Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        Solution_Coarse[iVar] += w * Solution_Fine[iVar];
+        Residual[iVar] += factor * Residual_Fine[iVar];
+      }
+    }
+
+    nodes_coarse->SetRes_TruncErrorZero(Point_Coarse);
+    nodes_coarse->AddRes_TruncError(Point_Coarse, Residual.data());
+  }
+  END_SU2_OMP_FOR
 
   /*--- Update the solution at the no-slip walls ---*/
 
@@ -587,18 +640,18 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
           if (grid_movement) {
             const auto* Grid_Vel = geo_coarse->nodes->GetGridVel(Point_Coarse);
-            sol_coarse->GetNodes()->SetVelSolutionVector(Point_Coarse, Grid_Vel);
+            nodes_coarse->SetVelSolutionVector(Point_Coarse, Grid_Vel);
           }
           else {
             /*--- For stationary no-slip walls, set the velocity to zero. ---*/
             su2double zero[3] = {0.0};
-            sol_coarse->GetNodes()->SetVelSolutionVector(Point_Coarse, zero);
+            nodes_coarse->SetVelSolutionVector(Point_Coarse, zero);
           }
 
         }
 
         if (Solver_Position == ADJFLOW_SOL) {
-          sol_coarse->GetNodes()->SetVelSolutionDVector(Point_Coarse);
+          nodes_coarse->SetVelSolutionDVector(Point_Coarse);
         }
 
       }
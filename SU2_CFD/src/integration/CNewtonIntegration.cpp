@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CNewtonIntegration.hpp"
 #include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 using Scalar = CNewtonIntegration::Scalar;
 
@@ -59,7 +60,10 @@ public:
 };
 }
 
-CNewtonIntegration::~CNewtonIntegration() { delete preconditioner; }
+CNewtonIntegration::~CNewtonIntegration() {
+  delete preconditioner;
+  delete turbPreconditioner;
+}
 
 void CNewtonIntegration::Setup() {
 
@@ -73,18 +77,26 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  forwardAD = config->GetNewtonKrylovForwardAD();
 
-  const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
   const auto nPointDomain = geometry->GetnPointDomain();
 
+  /*--- Layout of the variables of the coupled system. ---*/
+  nBlock = (config->GetNewtonKrylovCoupledTurb() && solvers[TURB_SOL]) ? 2 : 1;
+  unsigned short nVar = 0;
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    BlockOffset[iBlock] = nVar;
+    nVar += solvers[BlockSolver[iBlock]]->GetnVar();
+  }
+
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), 1024);
 
   LinSolver.SetxIsZero(true);
 
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
-  if (!std::is_same<Scalar,su2double>::value) {
+  if (!std::is_same<Scalar,su2double>::value || nBlock > 1) {
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
   }
 
@@ -95,9 +107,17 @@ void CNewtonIntegration::Setup() {
 
   preconditioner = CPreconditioner<MixedScalar>::Create(kindPrec, solvers[FLOW_SOL]->Jacobian, geometry, config);
 
-  if (!std::is_same<Scalar,MixedScalar>::value) {
-    precondIn.Initialize(nPoint, nPointDomain, nVar, nullptr);
-    precondOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  if (!std::is_same<Scalar,MixedScalar>::value || nBlock > 1) {
+    const auto nVarFlow = solvers[FLOW_SOL]->GetnVar();
+    precondIn.Initialize(nPoint, nPointDomain, nVarFlow, nullptr);
+    precondOut.Initialize(nPoint, nPointDomain, nVarFlow, nullptr);
+  }
+
+  if (nBlock > 1) {
+    turbPreconditioner = CPreconditioner<MixedScalar>::Create(kindPrec, solvers[TURB_SOL]->Jacobian, geometry, config);
+    const auto nVarTurb = solvers[TURB_SOL]->GetnVar();
+    turbPrecondIn.Initialize(nPoint, nPointDomain, nVarTurb, nullptr);
+    turbPrecondOut.Initialize(nPoint, nPointDomain, nVarTurb, nullptr);
   }
 
   /*--- Only possible with a preconditioner. ---*/
@@ -107,13 +127,34 @@ void CNewtonIntegration::Setup() {
 
 void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar mag) {
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
-    SU2_OMP_SIMD
-    for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar)
-      solvers[FLOW_SOL]->GetNodes()->AddSolution(iPoint,iVar, mag*dir(iPoint,iVar));
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    auto* nodes = solvers[BlockSolver[iBlock]]->GetNodes();
+    const auto nVar = solvers[BlockSolver[iBlock]]->GetnVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      SU2_OMP_SIMD
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        nodes->AddSolution(iPoint,iVar, mag*dir(iPoint,offset+iVar));
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+void CNewtonIntegration::ScatterSolution() {
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    auto& sol = solvers[BlockSolver[iBlock]]->LinSysSol;
+    const auto nVar = sol.GetNVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        sol(iPoint,iVar) = LinSysSol(iPoint,offset+iVar);
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 }
 
 void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
@@ -124,14 +165,45 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
   }
 
+  /*--- Switch the numerical methods of the config to those of the turbulence model, and back. ---*/
+  const auto mainSolver = config->GetKind_Solver();
+  auto SetTurbParam = [&](bool turb) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      config->SetGlobalParam(mainSolver, turb ? RUNTIME_TURB_SYS : RUNTIME_FLOW_SYS);
+      if (type == ResEvalType::EXPLICIT) config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  };
+
+  { SU2_PHASE_TIMER(PREPROCESSING);
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
 
+  /*--- The residuals must be a function of the current variables only, the eddy viscosity is updated and the
+   * flow is preprocessed again. The gradients of the turbulence variables are also needed by its residual. ---*/
+  if (nBlock > 1) {
+    SetTurbParam(true);
+    solvers[TURB_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+    solvers[TURB_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
+    SetTurbParam(false);
+    solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  }
+  }
+
   if (type == ResEvalType::DEFAULT) {
     solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
   }
 
   Space_Integration(geometry, solvers, numerics[FLOW_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
 
+  if (nBlock > 1) {
+    SetTurbParam(true);
+    if (type == ResEvalType::DEFAULT) {
+      solvers[TURB_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+    }
+    Space_Integration(geometry, solvers, numerics[TURB_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS);
+    SetTurbParam(false);
+  }
+
   /*--- Restore default. ---*/
   if (type == ResEvalType::EXPLICIT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
@@ -148,11 +220,16 @@ void CNewtonIntegration::ComputeFinDiffStep() {
   rmsSol = 0.0;
   END_SU2_OMP_MASTER
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
-    for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar)
-      rmsSol_loc += pow(solvers[FLOW_SOL]->GetNodes()->GetSolution(iPoint,iVar), 2);
-  END_SU2_OMP_FOR
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    const auto* nodes = solvers[BlockSolver[iBlock]]->GetNodes();
+    const auto nVar = solvers[BlockSolver[iBlock]]->GetnVar();
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        rmsSol_loc += pow(nodes->GetSolution(iPoint,iVar), 2);
+    END_SU2_OMP_FOR
+  }
 
   atomicAdd(rmsSol_loc, rmsSol);
 
@@ -168,6 +245,8 @@ void CNewtonIntegration::ComputeFinDiffStep() {
 void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solvers_, CNumerics ******numerics_,
                                              CConfig **config_, unsigned short EqSystem, unsigned short iZone,
                                              unsigned short iInst) {
+  SU2_PHASE_TIMER(INTEGRATION);
+
   config = config_[iZone];
   solvers = solvers_[iZone][iInst][MESH_0];
   geometry = geometry_[iZone][iInst][MESH_0];
@@ -179,7 +258,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   /*--- Save the current solution to be able to perturb it. ---*/
 
-  solvers[FLOW_SOL]->Set_OldSolution();
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) solvers[BlockSolver[iBlock]]->Set_OldSolution();
 
   /*--- Current residual. ---*/
 
@@ -191,14 +270,29 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   if (preconditioner) preconditioner->Build();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
-    LinSysRes[i] = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes[i]);
-  END_SU2_OMP_FOR
+  if (nBlock > 1) {
+    solvers[TURB_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+    if (turbPreconditioner) turbPreconditioner->Build();
+  }
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    const auto& res = solvers[BlockSolver[iBlock]]->LinSysRes;
+    const auto nVar = res.GetNVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        LinSysRes(iPoint,offset+iVar) = SU2_TYPE::GetValue(res(iPoint,iVar));
+    END_SU2_OMP_FOR
+  }
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(solvers[FLOW_SOL]->CompleteResidualReduction();)
 
   su2double residual = 0.0;
-  for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar)
-    residual += log10(solvers[FLOW_SOL]->GetRes_RMS(iVar)) / LinSysRes.GetNVar();
+  const auto nVarFlow = solvers[FLOW_SOL]->GetnVar();
+  for (auto iVar = 0ul; iVar < nVarFlow; ++iVar)
+    residual += log10(solvers[FLOW_SOL]->GetRes_RMS(iVar)) / nVarFlow;
 
   /*--- Check if startup period should end after this iteration. ---*/
 
@@ -231,12 +325,18 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   auto& linSysSol = GetSolutionVec(solvers[FLOW_SOL]->LinSysSol);
 
   if (startupPeriod) {
-    iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
+    iter = ApplyPreconditioner(LinSysRes, linSysSol, iter, eps);
   }
   else {
-    ComputeFinDiffStep();
+    if (!forwardAD) ComputeFinDiffStep();
+
+    /*--- Inexact Newton, the relaxation is replaced by the forcing term (never tighter than eps). ---*/
+    if (config->GetKind_Linear_Solver_Forcing() == LINEAR_SOLVER_FORCING::EISENSTAT_WALKER) {
+      toleranceFactor = LinSolver.ForcingTerm(LinSysRes.norm(), eps, config) / eps;
+    }
 
     eps *= toleranceFactor;
+    SU2_PHASE_TIMER(LINEAR_SOLVER);
     iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, CMatrixFreeProductWrapper(this),
                                       CPreconditionerWrapper(this), eps, iter, eps, false, config);
     /*--- Scale back the residual to trick the CFL adaptation. ---*/
@@ -245,20 +345,29 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   SetSolutionResult(solvers[FLOW_SOL]->LinSysSol);
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    solvers[FLOW_SOL]->SetIterLinSolver(iter);
-    solvers[FLOW_SOL]->SetResLinSolver(eps);
+    for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+      solvers[BlockSolver[iBlock]]->SetIterLinSolver(iter);
+      solvers[BlockSolver[iBlock]]->SetResLinSolver(eps);
+    }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
   /// TODO: Clever back-tracking and CFL adaptation based on residual reduction.
 
-  /*--- Update solution. ---*/
+  /*--- Update solution, the turbulence variables are clipped and relaxed as in the segregated solver. ---*/
 
   solvers[FLOW_SOL]->CompleteImplicitIteration(geometry, solvers, config);
 
+  if (nBlock > 1) solvers[TURB_SOL]->CompleteImplicitIteration(geometry, solvers, config);
+
   /*--- Call the various post processings. ---*/
 
+  { SU2_PHASE_TIMER(PREPROCESSING);
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
+  }
+
+  /*--- Eddy viscosity of the new solution (it is computed again for the next residual). ---*/
+  if (nBlock > 1) solvers[TURB_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
 
   solvers[FLOW_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
 
@@ -289,6 +398,11 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
 void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
 
+  if (forwardAD) {
+    ForwardADProduct(u, v);
+    return;
+  }
+
   Scalar factor = finDiffStep / u.norm();
 
   PerturbSolution(u, factor);
@@ -298,22 +412,85 @@ void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVect
   /*--- Finalize product. ---*/
   factor = 1.0 / factor;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
-    su2double delta = (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint)) /
-                      max(EPS, solvers[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint));
-    SU2_OMP_SIMD
-    for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar) {
-      Scalar perturbRes = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes(iPoint,iVar));
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    const auto* solver = solvers[BlockSolver[iBlock]];
+    const auto nVar = solver->GetnVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      su2double delta = (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint)) /
+                        max(EPS, solver->GetNodes()->GetDelta_Time(iPoint));
+      SU2_OMP_SIMD
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        const auto i = offset + iVar;
+        Scalar perturbRes = SU2_TYPE::GetValue(solver->LinSysRes(iPoint,iVar));
 
-      /*--- The global residual had its sign flipped, so we add to get the difference. ---*/
-      v(iPoint,iVar) = (perturbRes + LinSysRes(iPoint,iVar)) * factor;
+        /*--- The global residual had its sign flipped, so we add to get the difference. ---*/
+        v(iPoint,i) = (perturbRes + LinSysRes(iPoint,i)) * factor;
 
-      /*--- Pseudotime term of the true Jacobian. ---*/
-      v(iPoint,iVar) += SU2_TYPE::GetValue(delta) * u(iPoint,iVar);
+        /*--- Pseudotime term of the true Jacobian. ---*/
+        v(iPoint,i) += SU2_TYPE::GetValue(delta) * u(iPoint,i);
+      }
     }
+    END_SU2_OMP_FOR
+  }
+
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+}
+
+void CNewtonIntegration::ForwardADProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+
+  /*--- Seed the direction, u is communicated by the linear solver so halos are also seeded. ---*/
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    auto& solution = solvers[BlockSolver[iBlock]]->GetNodes()->GetSolution();
+    const auto nVar = solvers[BlockSolver[iBlock]]->GetnVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        SU2_TYPE::SetDerivative(solution(iPoint,iVar), SU2_TYPE::GetValue(u(iPoint,offset+iVar)));
+    END_SU2_OMP_FOR
+  }
+
+  /*--- The tangent of the residual is J*u, the values are the unperturbed residual. ---*/
+
+  ComputeResiduals(ResEvalType::EXPLICIT);
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    const auto* solver = solvers[BlockSolver[iBlock]];
+    const auto nVar = solver->GetnVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      su2double delta = (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint)) /
+                        max(EPS, solver->GetNodes()->GetDelta_Time(iPoint));
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        v(iPoint,offset+iVar) = SU2_TYPE::GetDerivative(solver->LinSysRes(iPoint,iVar));
+
+        /*--- Pseudotime term of the true Jacobian. ---*/
+        v(iPoint,offset+iVar) += SU2_TYPE::GetValue(delta) * SU2_TYPE::GetValue(u(iPoint,offset+iVar));
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Clear the seed, the derivatives of the other variables are
+   *    reset the next time they are computed from the solution. ---*/
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    auto& solution = solvers[BlockSolver[iBlock]]->GetNodes()->GetSolution();
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < solution.cols(); ++iVar)
+        SU2_TYPE::SetDerivative(solution(iPoint,iVar), 0.0);
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   CSysMatrixComms::Initiate(v, geometry, config);
   CSysMatrixComms::Complete(v, geometry, config);
@@ -323,7 +500,7 @@ void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<
 
   if (preconditioner) {
     Scalar eps = SU2_TYPE::GetValue(precondTol);
-    Preconditioner_impl(u, v, precondIters, eps);
+    ApplyPreconditioner(u, v, precondIters, eps);
   }
   else {
     /*--- Approximate diagonal preconditioner. ---*/
@@ -332,17 +509,62 @@ void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<
     const bool dt2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
     const su2double dt = config->GetDelta_UnstTimeND() * (dt1st + 1.5 * dt2nd);
 
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
-      su2double delta = (solvers[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint) + dt) /
-                        (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint));
-      SU2_OMP_SIMD
-      for (auto iVar = 0ul; iVar < u.GetNVar(); ++iVar)
-        v(iPoint,iVar) = SU2_TYPE::GetValue(delta) * u(iPoint,iVar);
+    for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+      const auto* nodes = solvers[BlockSolver[iBlock]]->GetNodes();
+      const auto nVar = solvers[BlockSolver[iBlock]]->GetnVar();
+      const auto offset = BlockOffset[iBlock];
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+        su2double delta = (nodes->GetDelta_Time(iPoint) + dt) /
+                          (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint));
+        SU2_OMP_SIMD
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          v(iPoint,offset+iVar) = SU2_TYPE::GetValue(delta) * u(iPoint,offset+iVar);
+      }
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
 
     CSysMatrixComms::Initiate(v, geometry, config);
     CSysMatrixComms::Complete(v, geometry, config);
   }
 }
+
+unsigned long CNewtonIntegration::CoupledPreconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v,
+                                                        unsigned long iters, Scalar& eps) const {
+
+  const CPreconditioner<MixedScalar>* precond[] = {preconditioner, turbPreconditioner};
+  CSysVector<MixedScalar>* blockIn[] = {&precondIn, &turbPrecondIn};
+  CSysVector<MixedScalar>* blockOut[] = {&precondOut, &turbPrecondOut};
+
+  /*--- Block Jacobi, the coupling between flow and turbulence is only in the matrix-free products. ---*/
+
+  unsigned long maxIters = 0;
+  Scalar maxEps = 0.0;
+
+  for (auto iBlock = 0u; iBlock < nBlock; ++iBlock) {
+    auto& in = *blockIn[iBlock];
+    auto& out = *blockOut[iBlock];
+    const auto nVar = in.GetNVar();
+    const auto offset = BlockOffset[iBlock];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        in(iPoint,iVar) = u(iPoint,offset+iVar);
+    END_SU2_OMP_FOR
+
+    Scalar epsBlock = eps;
+    maxIters = max(maxIters, SolveBlock(*precond[iBlock], solvers[BlockSolver[iBlock]], in, out, iters, epsBlock));
+    maxEps = max(maxEps, epsBlock);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        v(iPoint,offset+iVar) = out(iPoint,iVar);
+    END_SU2_OMP_FOR
+  }
+
+  eps = maxEps;
+  return maxIters;
+}
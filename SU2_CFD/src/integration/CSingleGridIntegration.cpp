@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CSingleGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 
 CSingleGridIntegration::CSingleGridIntegration() : CIntegration() { }
@@ -36,6 +37,8 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
                                                   unsigned short RunTime_EqSystem, unsigned short iZone,
                                                   unsigned short iInst) {
 
+  SU2_PHASE_TIMER(INTEGRATION);
+
   const unsigned short Solver_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
 
   /*--- Start an OpenMP parallel region covering the entire iteration. ---*/
@@ -50,8 +53,10 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   /*--- Preprocessing ---*/
 
+  { SU2_PHASE_TIMER(PREPROCESSING);
   solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
                                                FinestMesh, 0, RunTime_EqSystem, false);
+  }
 
   /*--- Set the old solution ---*/
 
@@ -69,7 +69,6 @@ void CStructuralIntegration::Structural_Iteration(CGeometry ****geometry, CSolve
 void CStructuralIntegration::Space_Integration_FEM(CGeometry *geometry, CSolver **solver_container,
                                                    CNumerics **numerics, CConfig *config,
                                                    unsigned short RunTime_EqSystem) {
-  const bool first_iter = (config->GetInnerIter() == 0);
   const bool linear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::SMALL);
   const auto IterativeScheme = config->GetKind_SpaceIteScheme_FEA();
 
@@ -78,7 +77,10 @@ void CStructuralIntegration::Space_Integration_FEM(CGeometry *geometry, CSolver
 
   /*--- Mass Matrix was computed during preprocessing, see notes therein. ---*/
 
-  if (linear_analysis) {
+  if (config->GetModal_Superposition()) {
+    /*--- With modal superposition the stiffness matrix is only needed to compute the modes. ---*/
+  }
+  else if (linear_analysis) {
     /*--- If the analysis is linear, only a the constitutive term of the stiffness matrix has to be computed. ---*/
     solver->Compute_StiffMatrix(geometry, numerics, config);
   }
@@ -88,11 +90,11 @@ void CStructuralIntegration::Space_Integration_FEM(CGeometry *geometry, CSolver
     if (IterativeScheme == STRUCT_SPACE_ITE::NEWTON) {
       solver->Compute_StiffMatrix_NodalStressRes(geometry, numerics, config);
     }
-
-    /*--- If the method is modified Newton-Raphson, the stiffness matrix is only computed once at the beginning
-     * of the time step, then only the Nodal Stress Term has to be computed on each iteration. ---*/
-    if (IterativeScheme == STRUCT_SPACE_ITE::MOD_NEWTON) {
-      if (first_iter)
+    else {
+      /*--- For modified Newton-Raphson (and BFGS) the stiffness matrix is kept while the residual decreases fast
+       * enough, by default it is updated at the beginning of each time step, then only the Nodal Stress Term has
+       * to be computed on each iteration. The solver decides based on its history, see RequiresTangentUpdate. ---*/
+      if (solver->RequiresTangentUpdate(config))
         solver->Compute_StiffMatrix_NodalStressRes(geometry, numerics, config);
       else
         solver->Compute_NodalStressRes(geometry, numerics, config);
@@ -131,6 +133,13 @@ void CStructuralIntegration::Time_Integration_FEM(CGeometry *geometry, CSolver *
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
+  /*--- The modal equations replace the FE system, the modes satisfy the essential BCs. ---*/
+
+  if (config->GetModal_Superposition()) {
+    solver_container[MainSolver]->Modal_Iteration(geometry, numerics, config);
+    return;
+  }
+
   /*--- Set the Jacobian according to the different time integration methods ---*/
 
   switch (config->GetKind_TimeIntScheme_FEA()) {
@@ -31,6 +31,9 @@
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
+#include <limits>
+#include <unordered_map>
+
 CInterface::CInterface() :
   rank(SU2_MPI::GetRank()),
   size(SU2_MPI::GetSize()) {
@@ -59,18 +62,151 @@ CInterface::~CInterface() {
   delete[] SpanLevelDonor;
 }
 
-void CInterface::BroadcastData(const CInterpolator& interpolator,
-                               CSolver *donor_solution, CSolver *target_solution,
-                               CGeometry *donor_geometry, CGeometry *target_geometry,
-                               const CConfig *donor_config, const CConfig *target_config) {
+void CInterface::BuildTransferPlan(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                                   const CGeometry *target_geometry, int markDonor, int markTarget,
+                                   CTransferPlan& plan) const {
+
+  plan = CTransferPlan();
+
+  /*--- Global indices of the donors needed by this rank, grouped by the rank that owns them. ---*/
+
+  vector<vector<unsigned long> > request(size);
+
+  if (markTarget >= 0) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++)
+        request[targetVertex.processor[iDonor]].push_back(targetVertex.globalPoint[iDonor]);
+    }
+  }
+  for (auto& req : request) {
+    sort(req.begin(), req.end());
+    req.erase(unique(req.begin(), req.end()), req.end());
+  }
+
+  /*--- Exchange the requests with the owners. ---*/
+
+  vector<int> nRequest(size), nRequested(size), displRequest(size, 0), displRequested(size, 0);
+  for (int iRank = 0; iRank < size; ++iRank) nRequest[iRank] = request[iRank].size();
+
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 1; iRank < size; ++iRank) {
+    displRequest[iRank] = displRequest[iRank-1] + nRequest[iRank-1];
+    displRequested[iRank] = displRequested[iRank-1] + nRequested[iRank-1];
+  }
+
+  vector<unsigned long> sendRequest, recvRequest(displRequested.back() + nRequested.back());
+  sendRequest.reserve(displRequest.back() + nRequest.back());
+  for (const auto& req : request) sendRequest.insert(sendRequest.end(), req.begin(), req.end());
+
+  SU2_MPI::Alltoallv(sendRequest.data(), nRequest.data(), displRequest.data(), MPI_UNSIGNED_LONG,
+                     recvRequest.data(), nRequested.data(), displRequested.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  /*--- Donor side, map the requested global indices to local vertices. ---*/
+
+  if (!recvRequest.empty()) {
+    unordered_map<unsigned long, unsigned long> globalToVertex;
+    if (markDonor >= 0) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+        if (donor_geometry->nodes->GetDomain(iPoint))
+          globalToVertex[donor_geometry->nodes->GetGlobalIndex(iPoint)] = iVertex;
+      }
+    }
+
+    vector<unsigned long> requestedVertex(recvRequest.size());
+    for (auto i = 0ul; i < recvRequest.size(); ++i) {
+      const auto it = globalToVertex.find(recvRequest[i]);
+      if (it == globalToVertex.end())
+        SU2_MPI::Error("An interface donor point is not owned by the rank given by the interpolator.",
+                       CURRENT_FUNCTION);
+      requestedVertex[i] = it->second;
+    }
+
+    plan.donorVertex = requestedVertex;
+    sort(plan.donorVertex.begin(), plan.donorVertex.end());
+    plan.donorVertex.erase(unique(plan.donorVertex.begin(), plan.donorVertex.end()), plan.donorVertex.end());
+
+    plan.sendDonor.resize(requestedVertex.size());
+    for (auto i = 0ul; i < requestedVertex.size(); ++i) {
+      plan.sendDonor[i] = lower_bound(plan.donorVertex.begin(), plan.donorVertex.end(), requestedVertex[i]) -
+                          plan.donorVertex.begin();
+    }
+  }
+
+  /*--- Ranks involved, the buffers are ordered by rank. ---*/
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (nRequested[iRank]) {
+      plan.sendRanks.push_back(iRank);
+      plan.sendStart.push_back(displRequested[iRank]);
+    }
+    if (nRequest[iRank]) {
+      plan.recvRanks.push_back(iRank);
+      plan.recvStart.push_back(displRequest[iRank]);
+    }
+  }
+  plan.sendStart.push_back(recvRequest.size());
+  plan.recvStart.push_back(sendRequest.size());
+
+  /*--- Target side, position of each donor in the receive buffer, in the order of BroadcastData. ---*/
+
+  if (markTarget >= 0) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++) {
+        const auto& req = request[targetVertex.processor[iDonor]];
+        const auto pos = lower_bound(req.begin(), req.end(), targetVertex.globalPoint[iDonor]) - req.begin();
+        plan.targetSlot.push_back(displRequest[targetVertex.processor[iDonor]] + pos);
+      }
+    }
+  }
+}
+
+void CInterface::StartBroadcastData(const CInterpolator& interpolator,
+                                    CSolver *donor_solution, CSolver *target_solution,
+                                    CGeometry *donor_geometry, CGeometry *target_geometry,
+                                    const CConfig *donor_config, const CConfig *target_config) {
   static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
 
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
 
+  /*--- The communication plans are (re)built if the interpolation changed, e.g. sliding meshes. ---*/
+
+  const unsigned short nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2;
+  const bool rebuildPlans = (planInterpolator != &interpolator) ||
+                            (planVersion != interpolator.GetTransferCoeffVersion());
+  if (rebuildPlans) {
+    transferPlans.clear();
+    transferPlans.resize(nMarkerInt);
+    planInterpolator = &interpolator;
+    planVersion = interpolator.GetTransferCoeffVersion();
+  }
+
+  pendingBroadcasts.emplace_back();
+  auto& pending = pendingBroadcasts.back();
+  pending.interpolator = &interpolator;
+  pending.target_solution = target_solution;
+  pending.target_geometry = target_geometry;
+  pending.target_config = target_config;
+  pending.markTarget.resize(nMarkerInt, -1);
+  pending.sendVar.resize(nMarkerInt);
+  pending.recvVar.resize(nMarkerInt);
+
   /*--- Loop over interface markers. ---*/
 
-  for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
+  unsigned long nMessages = 0;
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
     /*--- Check if this interface connects the two zones, if not continue. ---*/
 
@@ -79,119 +215,132 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
 
     if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    /*--- Count donor vertices on this rank. ---*/
+    pending.markTarget[iMarkerInt] = markTarget;
 
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
-      }
-    }
+    auto& plan = transferPlans[iMarkerInt];
+    if (rebuildPlans) BuildTransferPlan(interpolator, donor_geometry, target_geometry, markDonor, markTarget, plan);
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+    /*--- Evaluate the donor variables that other ranks (or this one) need, once per vertex. ---*/
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    su2activematrix donorVar(plan.donorVertex.size(), nVar);
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
-    }
+    for (auto iDonor = 0ul; iDonor < plan.donorVertex.size(); iDonor++) {
+      const auto iVertex = plan.donorVertex[iDonor];
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
-    /*--- Fill send buffers. ---*/
-
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+      for (auto iVar = 0u; iVar < nVar; iVar++) donorVar(iDonor, iVar) = Donor_Variable[iVar];
+    }
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    /*--- Fill the send buffer, this rank copies its own data. ---*/
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+    auto& sendVar = pending.sendVar[iMarkerInt];
+    auto& recvVar = pending.recvVar[iMarkerInt];
+    sendVar.resize(plan.sendDonor.size(), nVar);
+    recvVar.resize(plan.recvStart.back(), nVar);
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+    for (auto iSend = 0ul; iSend < plan.sendDonor.size(); iSend++)
+      for (auto iVar = 0u; iVar < nVar; iVar++) sendVar(iSend, iVar) = donorVar(plan.sendDonor[iSend], iVar);
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
+    for (auto iRecv = 0ul; iRecv < plan.recvRanks.size(); iRecv++) {
+      if (plan.recvRanks[iRecv] != rank) {
+        ++nMessages;
+        continue;
       }
+      const auto iSend = find(plan.sendRanks.begin(), plan.sendRanks.end(), rank) - plan.sendRanks.begin();
+      const auto count = plan.recvStart[iRecv+1] - plan.recvStart[iRecv];
+      for (auto i = 0ul; i < count; i++)
+        for (auto iVar = 0u; iVar < nVar; iVar++)
+          recvVar(plan.recvStart[iRecv] + i, iVar) = sendVar(plan.sendStart[iSend] + i, iVar);
     }
+    nMessages += plan.sendRanks.size();
+  }
 
-    /*--- Gather data. ---*/
+  /*--- Post the messages of all markers. The tags are the interface markers, broadcasts of different interfaces
+   * between the same ranks are matched in the order they are started, which is the same on all ranks. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+#ifdef HAVE_MPI
+  pending.requests.reserve(nMessages);
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+    const auto& plan = transferPlans[iMarkerInt];
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    for (auto iRecv = 0ul; iRecv < plan.recvRanks.size(); iRecv++) {
+      if (plan.recvRanks[iRecv] == rank) continue;
+      const int count = (plan.recvStart[iRecv+1] - plan.recvStart[iRecv]) * nVar;
+      pending.requests.emplace_back();
+      SU2_MPI::Irecv(pending.recvVar[iMarkerInt][plan.recvStart[iRecv]], count, MPI_DOUBLE, plan.recvRanks[iRecv],
+                     iMarkerInt, SU2_MPI::GetComm(), &pending.requests.back());
+    }
+    for (auto iSend = 0ul; iSend < plan.sendRanks.size(); iSend++) {
+      if (plan.sendRanks[iSend] == rank) continue;
+      const int count = (plan.sendStart[iSend+1] - plan.sendStart[iSend]) * nVar;
+      pending.requests.emplace_back();
+      SU2_MPI::Isend(pending.sendVar[iMarkerInt][plan.sendStart[iSend]], count, MPI_DOUBLE, plan.sendRanks[iSend],
+                     iMarkerInt, SU2_MPI::GetComm(), &pending.requests.back());
+    }
+  }
+#endif
+}
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+void CInterface::FinishBroadcastData() {
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+  while (!pendingBroadcasts.empty()) {
+    auto& pending = pendingBroadcasts.front();
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+#ifdef HAVE_MPI
+    SU2_MPI::Waitall(pending.requests.size(), pending.requests.data(), MPI_STATUSES_IGNORE);
+#endif
+    const auto& interpolator = *pending.interpolator;
+    auto target_solution = pending.target_solution;
+    auto target_geometry = pending.target_geometry;
+    const auto target_config = pending.target_config;
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+    for (auto iMarkerInt = 0ul; iMarkerInt < pending.markTarget.size(); iMarkerInt++) {
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
-    }
+      /*--- This rank does not need to do more work. ---*/
+      const auto markTarget = pending.markTarget[iMarkerInt];
+      if (markTarget < 0) continue;
 
-    /*--- Loop over target vertices. ---*/
+      const auto& plan = transferPlans[iMarkerInt];
+      const auto& recvVar = pending.recvVar[iMarkerInt];
 
-    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
-      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      /*--- Loop over target vertices. ---*/
 
-      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+      auto iSlot = 0ul;
+
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
-      auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
-      const auto nDonorPoints = targetVertex.nDonor();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
-      InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
+        auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+        const auto nDonorPoints = targetVertex.nDonor();
 
-      /*--- For the number of donor points. ---*/
-      for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
+        InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
 
-        /*--- Get the global index of the donor and the interpolation coefficient. ---*/
+        /*--- For the number of donor points. ---*/
+        for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
 
-        const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
-        const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
+          /*--- Get the interpolation coefficient, and the position of the donor in the received data. ---*/
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
+          const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
+          const auto idx = plan.targetSlot[iSlot++];
 
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
+          /*--- Recover the Target_Variable from the buffer of variables. ---*/
+          RecoverTarget_Variable(recvVar[idx], donorCoeff);
 
-        /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+          /*--- If the value is not directly aggregated in the previous function. ---*/
+          if (!valAggregated)
+            SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
+        }
 
-        /*--- If the value is not directly aggregated in the previous function. ---*/
-        if (!valAggregated)
+        /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
+        if (valAggregated)
           SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
       }
-
-      /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
-      if (valAggregated)
-        SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
     }
+    pendingBroadcasts.pop_front();
   }
 }
 
@@ -328,313 +477,81 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
                                   CGeometry *donor_geometry, CGeometry *target_geometry,
                                   const CConfig *donor_config, const CConfig *target_config, unsigned short iMarkerInt){
 
-  unsigned short  nMarkerDonor, nMarkerTarget;    // Number of markers on the interface, donor and target side
-  unsigned short  iMarkerDonor, iMarkerTarget;    // Variables for iteration over markers
-  unsigned short iSpan, nSpanDonor, nSpanTarget;
-  int Marker_Donor = -1, Marker_Target = -1;
-  su2double *avgPressureDonor = nullptr, *avgDensityDonor = nullptr, *avgNormalVelDonor = nullptr,
-      *avgTangVelDonor = nullptr, *avg3DVelDonor = nullptr, *avgNuDonor = nullptr,
-      *avgOmegaDonor = nullptr, *avgKineDonor = nullptr;
-  su2double *avgPressureTarget = nullptr, *avgDensityTarget = nullptr, *avgNormalVelTarget = nullptr,
-      *avg3DVelTarget = nullptr, *avgTangVelTarget = nullptr, *avgNuTarget = nullptr,
-      *avgOmegaTarget = nullptr, *avgKineTarget = nullptr;
+  /*--- Number of averaged quantities: density, pressure, normal, tangential and 3D velocity, nu, k, omega. ---*/
+  constexpr unsigned short nAvgVar = 8;
 
-#ifdef HAVE_MPI
-  int iSize;
-  su2double *BuffAvgPressureDonor = nullptr, *BuffAvgDensityDonor = nullptr, *BuffAvgNormalVelDonor = nullptr,
-      *BuffAvg3DVelDonor = nullptr, *BuffAvgTangVelDonor = nullptr, *BuffAvgNuDonor = nullptr,
-      *BuffAvgKineDonor = nullptr, *BuffAvgOmegaDonor = nullptr;
-  int nSpanSize, *BuffMarkerDonor;
-#endif
-
-
-  nMarkerTarget  = target_geometry->GetnMarker();
-  nMarkerDonor   = donor_geometry->GetnMarker();
-  nSpanDonor     = donor_config->GetnSpanWiseSections() +1;
-  nSpanTarget    = target_config->GetnSpanWiseSections() +1;
-
-
-  avgDensityDonor                  = new su2double[nSpanDonor];
-  avgPressureDonor                 = new su2double[nSpanDonor];
-  avgNormalVelDonor                = new su2double[nSpanDonor];
-  avgTangVelDonor                  = new su2double[nSpanDonor];
-  avg3DVelDonor                    = new su2double[nSpanDonor];
-  avgNuDonor                       = new su2double[nSpanDonor];
-  avgKineDonor                     = new su2double[nSpanDonor];
-  avgOmegaDonor                    = new su2double[nSpanDonor];
-
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]         = -1.0;
-    avgPressureDonor[iSpan]        = -1.0;
-    avgNormalVelDonor[iSpan]       = -1.0;
-    avgTangVelDonor[iSpan]         = -1.0;
-    avg3DVelDonor[iSpan]           = -1.0;
-    avgNuDonor[iSpan]              = -1.0;
-    avgKineDonor[iSpan]            = -1.0;
-    avgOmegaDonor[iSpan]           = -1.0;
-  }
-
-  avgDensityTarget                 = new su2double[nSpanTarget];
-  avgPressureTarget                = new su2double[nSpanTarget];
-  avgNormalVelTarget               = new su2double[nSpanTarget];
-  avgTangVelTarget                 = new su2double[nSpanTarget];
-  avg3DVelTarget                   = new su2double[nSpanTarget];
-  avgNuTarget                      = new su2double[nSpanTarget];
-  avgKineTarget                    = new su2double[nSpanTarget];
-  avgOmegaTarget                   = new su2double[nSpanTarget];
-
-
-  for (iSpan = 0; iSpan < nSpanTarget; iSpan++){
-    avgDensityTarget[iSpan]        = -1.0;
-    avgPressureTarget[iSpan]       = -1.0;
-    avgNormalVelTarget[iSpan]      = -1.0;
-    avgTangVelTarget[iSpan]        = -1.0;
-    avg3DVelTarget[iSpan]          = -1.0;
-    avgNuTarget[iSpan]             = -1.0;
-    avgKineTarget[iSpan]           = -1.0;
-    avgOmegaTarget[iSpan]          = -1.0;
-  }
-
-  /*--- Outer loop over the markers on the Mixing-Plane interface: compute one by one ---*/
-  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerMixingPlane ---*/
-  Marker_Donor = -1;
-  Marker_Target = -1;
+  const auto nMarkerTarget = target_geometry->GetnMarker();
+  const auto nMarkerDonor = donor_geometry->GetnMarker();
+  const unsigned short nSpanDonor = donor_config->GetnSpanWiseSections() + 1;
+  const unsigned short nSpanTarget = target_config->GetnSpanWiseSections() + 1;
 
   /*--- The donor and target markers are tagged with the same index.
    *--- This is independent of the MPI domain decomposition.
    *--- We need to loop over all markers on both sides  ---*/
 
-  /*--- On the donor side ---*/
+  int Marker_Donor = -1, Marker_Target = -1;
 
-  for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface equals the index we are looping at ---*/
-    if ( donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) == iMarkerInt ){
-      /*--- We have identified the local index of the Donor marker ---*/
-      /*--- Now we are going to store the average values that belong to Marker_Donor on each processor ---*/
-      /*--- Store the identifier for the structural marker ---*/
+  for (auto iMarkerDonor = 0u; iMarkerDonor < nMarkerDonor; iMarkerDonor++) {
+    if (donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) == iMarkerInt) {
       Marker_Donor = iMarkerDonor;
-      /*--- Exit the for loop: we have found the local index for Mixing-Plane interface ---*/
       break;
     }
-          /*--- If the tag hasn't matched any tag within the donor markers ---*/
-      Marker_Donor = -1;
-   
   }
-  /*--- Here we want to make available the quantities for all the processors and collect them in a buffer
-   * for each span of the donor the span-wise height vector also so
-   * that then we can interpolate on the target side  ---*/
-  if (Marker_Donor != -1){
-    for(iSpan = 0; iSpan < nSpanDonor; iSpan++){
-      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iSpan, rank);
-      avgDensityDonor[iSpan]          = Donor_Variable[0];
-      avgPressureDonor[iSpan]         = Donor_Variable[1];
-      avgNormalVelDonor[iSpan]        = Donor_Variable[2];
-      avgTangVelDonor[iSpan]          = Donor_Variable[3];
-      avg3DVelDonor[iSpan]            = Donor_Variable[4];
-      avgNuDonor[iSpan]               = Donor_Variable[5];
-      avgKineDonor[iSpan]             = Donor_Variable[6];
-      avgOmegaDonor[iSpan]            = Donor_Variable[7];
+  for (auto iMarkerTarget = 0u; iMarkerTarget < nMarkerTarget; iMarkerTarget++) {
+    if (target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt) {
+      Marker_Target = iMarkerTarget;
+      break;
     }
   }
 
-#ifdef HAVE_MPI
-  nSpanSize = size*nSpanDonor;
-  BuffAvgDensityDonor                 = new su2double[nSpanSize];
-  BuffAvgPressureDonor                = new su2double[nSpanSize];
-  BuffAvgNormalVelDonor               = new su2double[nSpanSize];
-  BuffAvgTangVelDonor                 = new su2double[nSpanSize];
-  BuffAvg3DVelDonor                   = new su2double[nSpanSize];
-  BuffAvgNuDonor                      = new su2double[nSpanSize];
-  BuffAvgKineDonor                    = new su2double[nSpanSize];
-  BuffAvgOmegaDonor                   = new su2double[nSpanSize];
-  BuffMarkerDonor                     = new int[size];
-
-  for (iSpan=0;iSpan<nSpanSize;iSpan++){
-    BuffAvgDensityDonor[iSpan]        = -1.0;
-    BuffAvgPressureDonor[iSpan]       = -1.0;
-    BuffAvgNormalVelDonor[iSpan]      = -1.0;
-    BuffAvgTangVelDonor[iSpan]        = -1.0;
-    BuffAvg3DVelDonor[iSpan]          = -1.0;
-    BuffAvgNuDonor[iSpan]             = -1.0;
-    BuffAvgKineDonor[iSpan]           = -1.0;
-    BuffAvgOmegaDonor[iSpan]          = -1.0;
-  }
+  /*--- Pack the span-wise averages of the donor (by span, then by variable) followed by a validity flag.
+   * The averages are global, i.e. the same on all the ranks that have the donor marker, therefore a max
+   * reduction (where ranks without valid data contribute the lowest value) makes them available to all
+   * ranks with a single collective. ---*/
 
-  for (iSize=0; iSize<size;iSize++){
-    BuffMarkerDonor[iSize]            = -1;
-  }
-
-  SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
-
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]            = -1.0;
-    avgPressureDonor[iSpan]           = -1.0;
-    avgNormalVelDonor[iSpan]          = -1.0;
-    avgTangVelDonor[iSpan]            = -1.0;
-    avg3DVelDonor[iSpan]              = -1.0;
-    avgNuDonor[iSpan]                 = -1.0;
-    avgKineDonor[iSpan]               = -1.0;
-    avgOmegaDonor[iSpan]              = -1.0;
-  }
+  const auto nAvg = nSpanDonor * nAvgVar;
+  const su2double lowest = std::numeric_limits<passivedouble>::lowest();
+  vector<su2double> sendAvg(nAvg + 1, lowest), avgDonor(nAvg + 1);
 
-  Marker_Donor= -1;
-
-  for (iSize=0; iSize<size;iSize++){
-    if(BuffAvgDensityDonor[nSpanDonor*iSize] > 0.0){
-      for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-        avgDensityDonor[iSpan]        = BuffAvgDensityDonor[nSpanDonor*iSize + iSpan];
-        avgPressureDonor[iSpan]       = BuffAvgPressureDonor[nSpanDonor*iSize + iSpan];
-        avgNormalVelDonor[iSpan]      = BuffAvgNormalVelDonor[nSpanDonor*iSize + iSpan];
-        avgTangVelDonor[iSpan]        = BuffAvgTangVelDonor[nSpanDonor*iSize + iSpan];
-        avg3DVelDonor[iSpan]          = BuffAvg3DVelDonor[nSpanDonor*iSize + iSpan];
-        avgNuDonor[iSpan]             = BuffAvgNuDonor[nSpanDonor*iSize + iSpan];
-        avgKineDonor[iSpan]           = BuffAvgKineDonor[nSpanDonor*iSize + iSpan];
-        avgOmegaDonor[iSpan]          = BuffAvgOmegaDonor[nSpanDonor*iSize + iSpan];
-      }
-      Marker_Donor                    = BuffMarkerDonor[iSize];
-      break;
+  if (Marker_Donor != -1) {
+    for (auto iSpan = 0u; iSpan < nSpanDonor; iSpan++) {
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iSpan, rank);
+      for (auto iVar = 0u; iVar < nAvgVar; iVar++) sendAvg[iSpan * nAvgVar + iVar] = Donor_Variable[iVar];
     }
-  }
-  delete [] BuffAvgDensityDonor;
-  delete [] BuffAvgPressureDonor;
-  delete [] BuffAvgNormalVelDonor;
-  delete [] BuffAvgTangVelDonor;
-  delete [] BuffAvg3DVelDonor;
-  delete [] BuffAvgNuDonor;
-  delete [] BuffAvgKineDonor;
-  delete [] BuffAvgOmegaDonor;
-  delete [] BuffMarkerDonor;
-#endif
-
-  /*--- On the target side we have to identify the marker as well ---*/
-  for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface(iMarkerTarget) equals the index we are looping at ---*/
-    if ( target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt ){
-      /*--- Store the identifier for the fluid marker ---*/
-      Marker_Target = iMarkerTarget;
-      /*--- Exit the for loop: we have found the local index for iMarkerFSI on the FEA side ---*/
-      break;
+    /*--- A positive density indicates valid data (see SetAverageValues). ---*/
+    if (sendAvg[0] > 0.0) {
+      sendAvg[nAvg] = 1.0;
+    } else {
+      for (auto& val : sendAvg) val = lowest;
     }
-          /*--- If the tag hasn't matched any tag within the Flow markers ---*/
-      Marker_Target = -1;
-   
   }
 
+  SU2_MPI::Allreduce(sendAvg.data(), avgDonor.data(), nAvg + 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 
-  if (Marker_Target != -1 && Marker_Donor != -1){
+  if (Marker_Target == -1 || avgDonor[nAvg] < 0.0) return;
 
-    /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
-    for(iSpan = 1; iSpan < nSpanTarget -2 ; iSpan++){
-      avgDensityTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgDensityDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgDensityDonor[SpanLevelDonor[iSpan]]);
-      avgDensityTarget[iSpan]            += avgDensityDonor[SpanLevelDonor[iSpan]];
-      avgPressureTarget[iSpan]            = SpanValueCoeffTarget[iSpan]*(avgPressureDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgPressureDonor[SpanLevelDonor[iSpan]]);
-      avgPressureTarget[iSpan]           += avgPressureDonor[SpanLevelDonor[iSpan]];
-      avgNormalVelTarget[iSpan]           = SpanValueCoeffTarget[iSpan]*(avgNormalVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNormalVelDonor[SpanLevelDonor[iSpan]]);
-      avgNormalVelTarget[iSpan]          += avgNormalVelDonor[SpanLevelDonor[iSpan]];
-      avgTangVelTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgTangVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgTangVelDonor[SpanLevelDonor[iSpan]]);
-      avgTangVelTarget[iSpan]            += avgTangVelDonor[SpanLevelDonor[iSpan]];
-      avg3DVelTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avg3DVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avg3DVelDonor[SpanLevelDonor[iSpan]]);
-      avg3DVelTarget[iSpan]              += avg3DVelDonor[SpanLevelDonor[iSpan]];
-      avgNuTarget[iSpan]                  = SpanValueCoeffTarget[iSpan]*(avgNuDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNuDonor[SpanLevelDonor[iSpan]]);
-      avgNuTarget[iSpan]                 += avgNuDonor[SpanLevelDonor[iSpan]];
-      avgKineTarget[iSpan]                = SpanValueCoeffTarget[iSpan]*(avgKineDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgKineDonor[SpanLevelDonor[iSpan]]);
-      avgKineTarget[iSpan]               += avgKineDonor[SpanLevelDonor[iSpan]];
-      avgOmegaTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avgOmegaDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgOmegaDonor[SpanLevelDonor[iSpan] ]);
-      avgOmegaTarget[iSpan]              += avgOmegaDonor[SpanLevelDonor[iSpan]];
-    }
+  const auto donorAvg = [&](unsigned short iSpan, unsigned short iVar) { return avgDonor[iSpan * nAvgVar + iVar]; };
 
+  /*---finally, the interpolated value is sent  to the target zone ---*/
 
-    /*--- transfer values at the hub ---*/
-    avgDensityTarget[0]                      = avgDensityDonor[0];
-    avgPressureTarget[0]                     = avgPressureDonor[0];
-    avgNormalVelTarget[0]                    = avgNormalVelDonor[0];
-    avgTangVelTarget[0]                      = avgTangVelDonor[0];
-    avg3DVelTarget[0]                        = avg3DVelDonor[0];
-    avgNuTarget[0]                           = avgNuDonor[0];
-    avgKineTarget[0]                         = avgKineDonor[0];
-    avgOmegaTarget[0]                        = avgOmegaDonor[0];
-
-    /*--- transfer values at the shroud ---*/
-    avgDensityTarget[nSpanTarget - 2]        = avgDensityDonor[nSpanDonor - 2];
-    avgPressureTarget[nSpanTarget - 2]       = avgPressureDonor[nSpanDonor - 2];
-    avgNormalVelTarget[nSpanTarget - 2]      = avgNormalVelDonor[nSpanDonor - 2];
-    avgTangVelTarget[nSpanTarget - 2]        = avgTangVelDonor[nSpanDonor - 2];
-    avg3DVelTarget[nSpanTarget - 2]          = avg3DVelDonor[nSpanDonor - 2];
-    avgNuTarget[nSpanTarget - 2]             = avgNuDonor[nSpanDonor - 2];
-    avgKineTarget[nSpanTarget - 2]           = avgKineDonor[nSpanDonor - 2];
-    avgOmegaTarget[nSpanTarget - 2]          = avgOmegaDonor[nSpanDonor - 2];
-
-    /*--- transfer 1D values ---*/
-    avgDensityTarget[nSpanTarget - 1]        = avgDensityDonor[nSpanDonor - 1];
-    avgPressureTarget[nSpanTarget - 1]       = avgPressureDonor[nSpanDonor - 1];
-    avgNormalVelTarget[nSpanTarget - 1]      = avgNormalVelDonor[nSpanDonor - 1];
-    avgTangVelTarget[nSpanTarget - 1]        = avgTangVelDonor[nSpanDonor - 1];
-    avg3DVelTarget[nSpanTarget - 1]          = avg3DVelDonor[nSpanDonor - 1];
-    avgNuTarget[nSpanTarget - 1]             = avgNuDonor[nSpanDonor - 1];
-    avgKineTarget[nSpanTarget - 1]           = avgKineDonor[nSpanDonor - 1];
-    avgOmegaTarget[nSpanTarget - 1]          = avgOmegaDonor[nSpanDonor - 1];
-
-
-    /*---finally, the interpolated value is sent  to the target zone ---*/
-    for(iSpan = 0; iSpan < nSpanTarget ; iSpan++){
-      Target_Variable[0]                     = avgDensityTarget[iSpan];
-      Target_Variable[1]                     = avgPressureTarget[iSpan];
-      Target_Variable[2]                     = avgNormalVelTarget[iSpan];
-      Target_Variable[3]                     = avgTangVelTarget[iSpan];
-      Target_Variable[4]                     = avg3DVelTarget[iSpan];
-      Target_Variable[5]                     = avgNuTarget[iSpan];
-      Target_Variable[6]                     = avgKineTarget[iSpan];
-      Target_Variable[7]                     = avgOmegaTarget[iSpan];
-
-
-      SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
+  for (auto iSpan = 0u; iSpan < nSpanTarget; iSpan++) {
+    for (auto iVar = 0u; iVar < nAvgVar; iVar++) {
+      if (iSpan + 2 >= nSpanTarget) {
+        /*--- transfer values at the shroud, and the 1D values ---*/
+        Target_Variable[iVar] = donorAvg(nSpanDonor - nSpanTarget + iSpan, iVar);
+      } else if (iSpan == 0) {
+        /*--- transfer values at the hub ---*/
+        Target_Variable[iVar] = donorAvg(0, iVar);
+      } else {
+        /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
+        const auto iLevel = SpanLevelDonor[iSpan];
+        Target_Variable[iVar] = SpanValueCoeffTarget[iSpan] * (donorAvg(iLevel + 1, iVar) - donorAvg(iLevel, iVar)) +
+                                donorAvg(iLevel, iVar);
+      }
     }
+    SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
   }
 
-  delete [] avgDensityDonor;
-  delete [] avgPressureDonor;
-  delete [] avgNormalVelDonor;
-  delete [] avgTangVelDonor;
-  delete [] avg3DVelDonor;
-  delete [] avgNuDonor;
-  delete [] avgKineDonor;
-  delete [] avgOmegaDonor;
-
-
-  delete [] avgDensityTarget;
-  delete [] avgPressureTarget;
-  delete [] avgNormalVelTarget;
-  delete [] avgTangVelTarget;
-  delete [] avg3DVelTarget;
-  delete [] avgNuTarget;
-  delete [] avgKineTarget;
-  delete [] avgOmegaTarget;
-
-
 }
 
 void CInterface::GatherAverageValues(CSolver *donor_solution, CSolver *target_solution, unsigned short donorZone){
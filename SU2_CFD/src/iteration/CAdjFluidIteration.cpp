@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CAdjFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 void CAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                     CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -132,6 +133,8 @@ void CAdjFluidIteration::Iterate(COutput* output, CIntegration**** integration,
                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                  CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                                  CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PHASE_TIMER(ITERATION);
+
   const auto kind_solver = config[val_iZone]->GetKind_Solver();
   switch (kind_solver) {
     case MAIN_SOLVER::ADJ_EULER:
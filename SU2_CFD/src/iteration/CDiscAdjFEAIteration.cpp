@@ -90,7 +90,9 @@ void CDiscAdjFEAIteration::Preprocess(COutput* output, CIntegration**** integrat
     StoreDirectSolution();
   }
 
+  SU2_OMP_PARALLEL_(if(solvers0[ADJFEA_SOL]->GetHasHybridParallel()))
   solvers0[ADJFEA_SOL]->Preprocessing(geometry0, solvers0, config[iZone], MESH_0, 0, RUNTIME_ADJFEA_SYS, false);
+  END_SU2_OMP_PARALLEL
 
 }
 
@@ -116,12 +118,18 @@ void CDiscAdjFEAIteration::LoadDynamic_Solution(CGeometry**** geometry, CSolver*
 void CDiscAdjFEAIteration::IterateDiscAdj(CGeometry**** geometry, CSolver***** solver, CConfig** config,
                                           unsigned short iZone, unsigned short iInst, bool CrossTerm) {
 
+  auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+
   /*--- Extract the adjoints of the conservative input variables and store them for the next iteration ---*/
 
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->ExtractAdjoint_Solution(geometry[iZone][iInst][MESH_0], config[iZone],
-                                                                    CrossTerm);
+  SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel())) {
 
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->ExtractAdjoint_Variables(geometry[iZone][iInst][MESH_0], config[iZone]);
+  adj_solver->ExtractAdjoint_Solution(geometry[iZone][iInst][MESH_0], config[iZone], CrossTerm);
+
+  adj_solver->ExtractAdjoint_Variables(geometry[iZone][iInst][MESH_0], config[iZone]);
+
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 void CDiscAdjFEAIteration::RegisterInput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
@@ -275,7 +283,12 @@ void CDiscAdjFEAIteration::InitializeAdjoint(CSolver***** solver, CGeometry****
   /*--- Initialize the adjoints the conservative variables ---*/
 
   AD::ResizeAdjoints();
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->SetAdjoint_Output(geometry[iZone][iInst][MESH_0], config[iZone]);
+
+  auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+
+  SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel()))
+  adj_solver->SetAdjoint_Output(geometry[iZone][iInst][MESH_0], config[iZone]);
+  END_SU2_OMP_PARALLEL
 }
 
 bool CDiscAdjFEAIteration::Monitor(COutput* output, CIntegration**** integration, CGeometry**** geometry,
@@ -28,6 +28,38 @@
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
 
+namespace {
+/*!
+ * \brief Apply f to the nodes of the primal solvers that are part of a checkpoint, on all grid levels,
+ *        f also receives a sequential index (the position in the checkpoint).
+ */
+template <class F>
+void forEachPrimalSolver(CSolver*** solvers, unsigned short nMGLevels, const F& f) {
+  unsigned long k = 0;
+  for (auto iMesh = 0u; iMesh <= nMGLevels; iMesh++) {
+    for (const auto iSol : {FLOW_SOL, TURB_SOL, SPECIES_SOL, HEAT_SOL}) {
+      if (solvers[iMesh][iSol] != nullptr) f(k++, solvers[iMesh][iSol]->GetNodes());
+    }
+  }
+}
+}  // namespace
+
+CDiscAdjFluidIteration::CDiscAdjFluidIteration(const CConfig *config) : CIteration(config),
+  turbulent(config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_RANS || config->GetKind_Solver() == MAIN_SOLVER::DISC_ADJ_INC_RANS) {
+
+  const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                         (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  if (dual_time && config->GetUnst_Adjoint_Checkpoints() > 0) {
+    if (config->GetMultizone_Problem() || config->GetDynamic_Grid() || config->GetBoolTurbomachinery()) {
+      SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is only supported for single zone problems on static grids.",
+                     CURRENT_FUNCTION);
+    }
+    checkpoints.resize(config->GetUnst_Adjoint_Checkpoints());
+    primalIteration.reset(new CFluidIteration(config));
+  }
+}
+
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                         CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                         CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
@@ -59,6 +91,24 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
     const int Direct_Iter = static_cast<int>(config[iZone]->GetUnst_AdjointIter()) -
                             static_cast<int>(TimeIter) - 2 + dual_time;
 
+    /*--- Recompute the direct solutions loaded below that have no restart file. The checkpoints of
+     * later time steps are no longer needed since the adjoint goes backwards in time. ---*/
+
+    if (dual_time && !checkpoints.empty()) {
+      const int first = Direct_Iter - 1 - dual_time_2nd;
+      const int last = (TimeIter == 0) ? Direct_Iter : first;
+
+      for (auto& checkpoint : checkpoints) {
+        if (checkpoint.iter - dual_time_2nd > last) checkpoint.iter = -1;
+      }
+      for (int iter = max(first, 0); iter <= last; ++iter) {
+        if (!PrimalSolutionAvailable(config[iZone], iter)) {
+          RecomputePrimalSolution(output, integration, geometry, solver, numerics, config, surface_movement,
+                                  grid_movement, FFDBox, iZone, iInst, iter);
+        }
+      }
+    }
+
     /*--- For dual-time stepping we want to load the already converged solution at previous timesteps.
      * In general we only load one file and shift the previously loaded solutions, on the first we
      * load one or two more (depending on dual time order). ---*/
@@ -94,16 +144,13 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
 
         for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++) {
           for (auto iSol = 0ul; iSol < nSolvers; ++iSol) {
-            solver[iZone][iInst][iMesh][solversToProcess[iSol]]->GetNodes()->Set_Solution_time_n1();
-            solver[iZone][iInst][iMesh][solversToProcess[iSol]]->GetNodes()->Set_Solution_time_n();
+            solver[iZone][iInst][iMesh][solversToProcess[iSol]]->GetNodes()->Shift_Solution_time_n();
           }
           if (grid_IsMoving) {
-            geometries[iMesh]->nodes->SetCoord_n1();
-            geometries[iMesh]->nodes->SetCoord_n();
+            geometries[iMesh]->nodes->ShiftCoord_n();
           }
           if (config[iZone]->GetDynamic_Grid()) {
-            geometries[iMesh]->nodes->SetVolume_nM1();
-            geometries[iMesh]->nodes->SetVolume_n();
+            geometries[iMesh]->nodes->ShiftVolume_n();
           }
         }
       }
@@ -282,6 +329,36 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
   auto geometries = geometry[iZone][iInst];
   const bool species = config[iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE;
 
+  /*--- Recomputed direct solutions are taken from memory. ---*/
+
+  for (const auto& checkpoint : checkpoints) {
+    const bool current = (checkpoint.iter == DirectIter);
+    const bool previous = !checkpoint.solution_n.empty() && (checkpoint.iter - 1 == DirectIter);
+    if (DirectIter < 0 || !(current || previous)) continue;
+
+    if (rank == MASTER_NODE)
+      cout << " Loading flow solution from checkpoint of direct iteration " << DirectIter << " for zone " << iZone << "." << endl;
+
+    const auto& data = current ? checkpoint.solution : checkpoint.solution_n;
+    forEachPrimalSolver(solvers, config[iZone]->GetnMGLevels(),
+                        [&](unsigned long k, CVariable* nodes) { data[k].Decompress(nodes->GetSolution()); });
+
+    for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++) {
+      solvers[iMesh][FLOW_SOL]->Preprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh,
+                                              NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+      if (turbulent && solvers[iMesh][TURB_SOL]) {
+        solvers[iMesh][TURB_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh);
+      }
+      if (species && solvers[iMesh][SPECIES_SOL]) {
+        solvers[iMesh][SPECIES_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh);
+      }
+      if (config[iZone]->GetWeakly_Coupled_Heat() && solvers[iMesh][HEAT_SOL]) {
+        solvers[iMesh][HEAT_SOL]->Postprocessing(geometries[iMesh], solvers[iMesh], config[iZone], iMesh);
+      }
+    }
+    return;
+  }
+
   if (DirectIter >= 0) {
     if (rank == MASTER_NODE)
       cout << " Loading flow solution from direct iteration " << DirectIter << " for zone " << iZone << "." << endl;
@@ -322,6 +399,151 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
   }
 }
 
+bool CDiscAdjFluidIteration::PrimalSolutionAvailable(const CConfig* config, int iter, bool checkFile) const {
+
+  /*--- Negative iterations are the freestream. ---*/
+  if (iter < 0) return true;
+
+  if (!checkFile) {
+    for (const auto& checkpoint : checkpoints) {
+      if (checkpoint.iter < 0) continue;
+      if (checkpoint.iter == iter || (!checkpoint.solution_n.empty() && checkpoint.iter - 1 == iter)) return true;
+    }
+  }
+
+  int exists = 0;
+  if (rank == MASTER_NODE) {
+    auto filename = config->GetFilename(config->GetSolution_FileName(), "", iter);
+    filename += config->GetRead_Binary_Restart() ? ".dat" : ".csv";
+    exists = ifstream(filename).good();
+  }
+  SU2_MPI::Bcast(&exists, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  return exists != 0;
+}
+
+void CDiscAdjFluidIteration::RecomputePrimalSolution(COutput* output, CIntegration**** integration,
+                                                     CGeometry**** geometry, CSolver***** solver,
+                                                     CNumerics****** numerics, CConfig** config,
+                                                     CSurfaceMovement** surface_movement,
+                                                     CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox,
+                                                     unsigned short iZone, unsigned short iInst, int target) {
+  auto* cfg = config[iZone];
+  auto solvers = solver[iZone][iInst];
+  const auto nMGLevels = cfg->GetnMGLevels();
+  const bool dual_time_2nd = (cfg->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  /*--- Keep the state of the adjoint time step, it is restored at the end. ---*/
+
+  vector<su2activematrix> backup;
+  forEachPrimalSolver(solvers, nMGLevels, [&](unsigned long, CVariable* nodes) {
+    backup.push_back(nodes->GetSolution());
+    backup.push_back(nodes->GetSolution_time_n());
+    if (dual_time_2nd) backup.push_back(nodes->GetSolution_time_n1());
+  });
+  const auto timeIter = cfg->GetTimeIter();
+  const auto innerIter = cfg->GetInnerIter();
+
+  /*--- Start from the closest earlier checkpoint or restart file (the steps n and n-1 for second order),
+   * or from the freestream if there is none. ---*/
+
+  const PrimalCheckpoint* start = nullptr;
+  for (const auto& checkpoint : checkpoints) {
+    if (checkpoint.iter >= 0 && checkpoint.iter < target && (!start || checkpoint.iter > start->iter))
+      start = &checkpoint;
+  }
+
+  int startIter = -1;
+  bool fromFile = false;
+  for (int iter = target - 1; iter > (start ? start->iter : -1); --iter) {
+    if (PrimalSolutionAvailable(cfg, iter, true) && (!dual_time_2nd || PrimalSolutionAvailable(cfg, iter - 1, true))) {
+      startIter = iter;
+      fromFile = true;
+      break;
+    }
+  }
+
+  if (!fromFile && start) {
+    startIter = start->iter;
+    forEachPrimalSolver(solvers, nMGLevels, [&](unsigned long k, CVariable* nodes) {
+      start->solution[k].Decompress(nodes->GetSolution());
+      start->solution[k].Decompress(nodes->GetSolution_time_n());
+      if (dual_time_2nd) start->solution_n[k].Decompress(nodes->GetSolution_time_n1());
+    });
+  } else {
+    if (dual_time_2nd) {
+      LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, startIter - 1);
+      forEachPrimalSolver(solvers, nMGLevels, [](unsigned long, CVariable* nodes) { nodes->Set_Solution_time_n(); });
+    }
+    LoadUnsteady_Solution(geometry, solver, config, iZone, iInst, startIter);
+    forEachPrimalSolver(solvers, nMGLevels, [&](unsigned long, CVariable* nodes) {
+      if (dual_time_2nd) nodes->Set_Solution_time_n1();
+      nodes->Set_Solution_time_n();
+    });
+  }
+
+  if (rank == MASTER_NODE)
+    cout << " Recomputing direct iterations " << startIter + 1 << " to " << target << " for zone " << iZone << "." << endl;
+
+  /*--- Advance in time, the target is always kept, and while there are free slots the remaining
+   * interval is bisected to place checkpoints for the steps that will be needed next. ---*/
+
+  auto nFreeSlots = [&]() {
+    return std::count_if(checkpoints.begin(), checkpoints.end(), [](const PrimalCheckpoint& c) { return c.iter < 0; });
+  };
+  int nextStore = startIter + (target - startIter + 1) / 2;
+
+  for (int iter = startIter + 1; iter <= target; ++iter) {
+    cfg->SetTimeIter(iter);
+
+    primalIteration->Preprocess(output, integration, geometry, solver, numerics, config, surface_movement,
+                                grid_movement, FFDBox, iZone, iInst);
+
+    for (auto iInner = 0ul; iInner < cfg->GetUnst_Adjoint_PrimalIter(); ++iInner) {
+      cfg->SetInnerIter(iInner);
+      primalIteration->Iterate(output, integration, geometry, solver, numerics, config, surface_movement,
+                               grid_movement, FFDBox, iZone, iInst);
+    }
+
+    if (iter == target || (iter == nextStore && nFreeSlots() > 1)) {
+      /*--- Use a free slot, otherwise the earliest step, which is the last one the adjoint will need. ---*/
+      auto slot = checkpoints.begin();
+      for (auto it = checkpoints.begin(); it != checkpoints.end(); ++it) {
+        if (it->iter < 0) { slot = it; break; }
+        if (it->iter < slot->iter) slot = it;
+      }
+      slot->iter = iter;
+      slot->solution.clear();
+      slot->solution_n.clear();
+      const passivedouble tol = SU2_TYPE::GetValue(cfg->GetUnst_Adjoint_Checkpoint_Tol());
+      forEachPrimalSolver(solvers, nMGLevels, [&](unsigned long, CVariable* nodes) {
+        slot->solution.emplace_back();
+        slot->solution.back().Compress(nodes->GetSolution(), tol);
+        if (dual_time_2nd) {
+          slot->solution_n.emplace_back();
+          slot->solution_n.back().Compress(nodes->GetSolution_time_n(), tol);
+        }
+      });
+    }
+    if (iter == nextStore) nextStore = iter + (target - iter + 1) / 2;
+
+    if (iter < target) {
+      primalIteration->Update(output, integration, geometry, solver, numerics, config, surface_movement,
+                              grid_movement, FFDBox, iZone, iInst);
+    }
+  }
+
+  /*--- Restore the state of the adjoint time step. ---*/
+
+  unsigned long k = 0;
+  forEachPrimalSolver(solvers, nMGLevels, [&](unsigned long, CVariable* nodes) {
+    nodes->GetSolution() = backup[k++];
+    nodes->GetSolution_time_n() = backup[k++];
+    if (dual_time_2nd) nodes->GetSolution_time_n1() = backup[k++];
+  });
+  cfg->SetTimeIter(timeIter);
+  cfg->SetInnerIter(innerIter);
+}
+
 void CDiscAdjFluidIteration::IterateDiscAdj(CGeometry**** geometry, CSolver***** solver, CConfig** config,
                                             unsigned short iZone, unsigned short iInst, bool CrossTerm) {
   auto solvers0 = solver[iZone][iInst][MESH_0];
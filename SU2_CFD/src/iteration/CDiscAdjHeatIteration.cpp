@@ -70,8 +70,7 @@ void CDiscAdjHeatIteration::Preprocess(COutput* output, CIntegration**** integra
         LoadUnsteady_Solution(geometry, solver, config, val_iZone, val_iInst, Direct_Iter - 1);
 
         for (auto iMesh = 0u; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
-          solvers[iMesh][HEAT_SOL]->GetNodes()->Set_Solution_time_n1();
-          solvers[iMesh][HEAT_SOL]->GetNodes()->Set_Solution_time_n();
+          solvers[iMesh][HEAT_SOL]->GetNodes()->Shift_Solution_time_n();
         }
       }
 
@@ -174,12 +173,12 @@ void CDiscAdjHeatIteration::RegisterInput(CSolver***** solver, CGeometry**** geo
 
     solvers0[ADJHEAT_SOL]->RegisterVariables(geometry0, config[iZone]);
   }
-  else if (kind_recording == RECORDING::MESH_COORDS) {
+  if (kind_recording == RECORDING::MESH_COORDS || kind_recording == RECORDING::SOLUTION_AND_MESH) {
     /*--- Register node coordinates as input ---*/
 
     geometry0->RegisterCoordinates();
   }
-  else if (kind_recording == RECORDING::MESH_DEFORM) {
+  if (kind_recording == RECORDING::MESH_DEFORM) {
     /*--- Register the variables of the mesh deformation ---*/
     /*--- Undeformed mesh coordinates ---*/
     solvers0[ADJMESH_SOL]->RegisterSolution(geometry0, config[iZone]);
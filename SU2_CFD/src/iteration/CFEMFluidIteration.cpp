@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CFEMFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 void CFEMFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                     CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -45,6 +46,8 @@ void CFEMFluidIteration::Iterate(COutput* output, CIntegration**** integration,
                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                  CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                                  CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PHASE_TIMER(ITERATION);
+
   /*--- Update global parameters ---*/
 
   const auto kind_solver = config[val_iZone]->GetKind_Solver();
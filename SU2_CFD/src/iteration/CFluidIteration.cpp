@@ -27,6 +27,7 @@
 
 #include "../../include/iteration/CFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 void CFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
@@ -56,6 +57,8 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                               CSolver***** solver, CNumerics****** numerics, CConfig** config,
                               CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                               CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PHASE_TIMER(ITERATION);
+
 
   const bool unsteady = (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                         (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
@@ -74,6 +77,19 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   const auto main_solver = config[val_iZone]->GetKind_Solver();
   config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_FLOW_SYS);
 
+  /*--- The solvers register their residuals with the reduction context of the zone, which reduces
+   * them all together, the reduction of the previous iteration must be complete at this point. ---*/
+
+  const bool deferredReduction = config[val_iZone]->GetDeferred_Res_Reduction();
+
+  if (deferredReduction) {
+    ResidualReduction.Complete();
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+      auto* sol = solver[val_iZone][val_iInst][MESH_0][iSol];
+      if (sol != nullptr) sol->SetResidualReduction(&ResidualReduction);
+    }
+  }
+
   /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration) ---*/
 
   integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
@@ -81,7 +97,11 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
 
   /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
 
-  if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE && !frozen_visc) {
+  const bool coupled_turb = config[val_iZone]->GetNewtonKrylovCoupledTurb();
+  auto solvers0 = solver[val_iZone][val_iInst][MESH_0];
+  auto geometry0 = geometry[val_iZone][val_iInst][MESH_0];
+
+  if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE && !frozen_visc && !coupled_turb) {
 
     /*--- Solve transition model ---*/
 
@@ -109,8 +129,12 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
     // Flow-Pre has to be called upfront. The updated eddy-visc are copied into the flow-solver Primitive in another
     // Flow-Pre call which is done at the start of the next iteration.
     if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE) {
-      solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->Preprocessing(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0], config[val_iZone], MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
-      solver[val_iZone][val_iInst][MESH_0][TURB_SOL]->Postprocessing(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0], config[val_iZone], MESH_0);
+      SU2_OMP_PARALLEL_(if(solvers0[FLOW_SOL]->GetHasHybridParallel() && solvers0[TURB_SOL]->GetHasHybridParallel())) {
+        solvers0[FLOW_SOL]->Preprocessing(geometry0, solvers0, config[val_iZone], MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS,
+                                          true);
+        solvers0[TURB_SOL]->Postprocessing(geometry0, solvers0, config[val_iZone], MESH_0);
+      }
+      END_SU2_OMP_PARALLEL
     }
   }
 
@@ -122,14 +146,26 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
 
   /*--- Incorporate a weakly-coupled radiation model to the analysis ---*/
   if (config[val_iZone]->AddRadiation()) {
-    config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_RADIATION_SYS);
-    integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                     RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
+    if (InnerIter % config[val_iZone]->GetRad_Freq() == 0) {
+      config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_RADIATION_SYS);
+      integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
+    } else {
+      /*--- Between radiation solves only the source term follows the temperature of the flow. ---*/
+      SU2_OMP_PARALLEL_(if(solvers0[RAD_SOL]->GetHasHybridParallel()))
+      solvers0[RAD_SOL]->Postprocessing(geometry0, solvers0, config[val_iZone], MESH_0);
+      END_SU2_OMP_PARALLEL
+    }
   }
 
+  /*--- All the residuals of this iteration are available, the reduction is completed when they are needed. ---*/
+
+  if (deferredReduction) ResidualReduction.Start();
+
   /*--- Adapt the CFL number using an exponential progression with under-relaxation approach. ---*/
 
   if ((config[val_iZone]->GetCFL_Adapt() == YES) && (!disc_adj)) {
+    if (deferredReduction) ResidualReduction.Complete();
     SU2_OMP_PARALLEL
     solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->AdaptCFLNumber(geometry[val_iZone][val_iInst],
                                                                    solver[val_iZone][val_iInst], config[val_iZone]);
@@ -213,6 +249,8 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
 
   UsedTime = StopTime - StartTime;
 
+  if (config[val_iZone]->GetDeferred_Res_Reduction()) ResidualReduction.Complete();
+
   output->SetHistoryOutput(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0],
                            config[val_iZone], config[val_iZone]->GetTimeIter(), config[val_iZone]->GetOuterIter(),
                            config[val_iZone]->GetInnerIter());
@@ -285,6 +323,11 @@ void CFluidIteration::Solve(COutput* output, CIntegration**** integration, CGeom
 
     /*--- If the iteration has converged, break the loop ---*/
     if (StopCalc) break;
+
+    /*--- Accelerate the fixed-point iterations, the final solution is the one in the output. ---*/
+    if (steady && config[val_iZone]->GetQuasiNewtonPrimal() && Inner_Iter + 1 < nInner_Iter) {
+      QuasiNewtonCorrection(geometry, solver, config, val_iZone, val_iInst);
+    }
   }
 
   if (multizone && steady) {
@@ -292,6 +335,68 @@ void CFluidIteration::Solve(COutput* output, CIntegration**** integration, CGeom
   }
 }
 
+void CFluidIteration::QuasiNewtonCorrection(CGeometry**** geometry, CSolver***** solver, CConfig** config,
+                                            unsigned short val_iZone, unsigned short val_iInst) {
+  const auto* geo = geometry[val_iZone][val_iInst][MESH_0];
+  auto** solvers = solver[val_iZone][val_iInst][MESH_0];
+  const auto& param = config[val_iZone]->GetQuasiNewtonPrimalParam();
+  const auto nPoint = geo->GetnPoint();
+
+  /*--- The solution vector is the solution of all the (primal) solvers of the zone, one after the other. ---*/
+  vector<CSolver*> primalSolvers;
+  unsigned long nVar = 0;
+  for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+    if (!solvers[iSol] || solvers[iSol]->GetAdjoint()) continue;
+    primalSolvers.push_back(solvers[iSol]);
+    nVar += solvers[iSol]->GetnVar();
+  }
+
+  auto StoreSolution = [&](su2passivematrix& x) {
+    unsigned long offset = 0;
+    for (const auto* sol : primalSolvers) {
+      const auto& solution = sol->GetNodes()->GetSolution();
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+        for (auto iVar = 0ul; iVar < sol->GetnVar(); ++iVar)
+          x(iPoint, offset + iVar) = SU2_TYPE::GetValue(solution(iPoint, iVar));
+      offset += sol->GetnVar();
+    }
+  };
+
+  if (QNAccelerator.size() == 0) {
+    QNAccelerator.resize(config[val_iZone]->GetnQuasiNewtonSamples(), nPoint, nVar, geo->GetnPointDomain());
+    QNAccelerator.setFilterTolerance(SU2_TYPE::GetValue(config[val_iZone]->GetQuasiNewtonFilterTol()));
+  }
+
+  /*--- The safeguard is based on the average (log) residual of the flow, which is the residual of
+   *    the solution of the previous correction. ---*/
+  const auto* flow = solvers[FLOW_SOL];
+  su2double residual = 0.0;
+  for (auto iVar = 0u; iVar < flow->GetnVar(); ++iVar) residual += log10(flow->GetRes_RMS(iVar)) / flow->GetnVar();
+
+  /*--- Until the first accelerated iteration, or after a reset, the history starts with the current solution. ---*/
+  const bool startup = config[val_iZone]->GetInnerIter() < param[0];
+  const bool diverging = residual > QNMinResidual + param[1];
+
+  if (startup || diverging) {
+    QNAccelerator.reset();
+    StoreSolution(QNAccelerator.solution());
+    QNMinResidual = residual;
+    return;
+  }
+  QNMinResidual = min(QNMinResidual, residual);
+
+  StoreSolution(QNAccelerator.FPresult());
+  const auto& x = QNAccelerator.compute();
+
+  unsigned long offset = 0;
+  for (auto* sol : primalSolvers) {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < sol->GetnVar(); ++iVar)
+        sol->GetNodes()->SetSolution(iPoint, iVar, x(iPoint, offset + iVar));
+    offset += sol->GetnVar();
+  }
+}
+
 void CFluidIteration::SetWind_GustField(CConfig* config, CGeometry** geometry, CSolver*** solver) {
   // The gust is imposed on the flow field via the grid velocities. This method called the Field Velocity Method is
   // described in the NASA TM–2012-217771 - Development, Verification and Use of Gust Modeling in the NASA Computational
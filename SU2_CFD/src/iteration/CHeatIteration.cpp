@@ -27,11 +27,14 @@
 
 #include "../../include/iteration/CHeatIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
 
 void CHeatIteration::Iterate(COutput* output, CIntegration**** integration, CGeometry**** geometry, CSolver***** solver,
                              CNumerics****** numerics, CConfig** config, CSurfaceMovement** surface_movement,
                              CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short val_iZone,
                              unsigned short val_iInst) {
+  SU2_PHASE_TIMER(ITERATION);
+
 
   /*--- Update global parameters ---*/
 
@@ -47,6 +47,9 @@ CSource_NEMO::CSource_NEMO(unsigned short val_nDim,
   jacobian = new su2double* [nVar];
   for(auto iVar = 0ul; iVar < nVar; ++iVar)
     jacobian[iVar] = new su2double [nVar]();
+
+  /*--- Point-implicit sources with explicit schemes also need the Jacobians. ---*/
+  if (config->GetPointImplicit_Sources()) implicit = true;
 }
 
 CSource_NEMO::~CSource_NEMO() {
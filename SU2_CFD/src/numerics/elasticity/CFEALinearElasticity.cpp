@@ -26,6 +26,7 @@
  */
 
 #include "../../../include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../../../Common/include/geometry/elements/element_kernels.hpp"
 
 
 CFEALinearElasticity::CFEALinearElasticity(unsigned short val_nDim, unsigned short val_nVar,
@@ -84,89 +85,94 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
   nNode = element->GetnNodes();
   nGauss = element->GetnGaussPoints();
 
-  for (iGauss = 0; iGauss < nGauss; iGauss++) {
+  /*--- 3D tetrahedra and hexahedra use the batched kernels, the Gauss points are
+        processed as SIMD lanes and the sparsity of B is exploited. ---*/
+  if (!Compute_Stiffness_Batched(element)) {
 
-    Weight = element->GetWeight(iGauss);
-    Jac_X = element->GetJ_X(iGauss);
+    for (iGauss = 0; iGauss < nGauss; iGauss++) {
 
-    /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
-    /*--- This avoids repeated operations ---*/
-    for (iNode = 0; iNode < nNode; iNode++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
-      }
-    }
-
-    for (iNode = 0; iNode < nNode; iNode++) {
+      Weight = element->GetWeight(iGauss);
+      Jac_X = element->GetJ_X(iGauss);
 
-      if (nDim == 2) {
-        Ba_Mat[0][0] = GradNi_Ref_Mat[iNode][0];
-        Ba_Mat[1][1] = GradNi_Ref_Mat[iNode][1];
-        Ba_Mat[2][0] = GradNi_Ref_Mat[iNode][1];
-        Ba_Mat[2][1] = GradNi_Ref_Mat[iNode][0];
-      }
-      else {
-        Ba_Mat[0][0] = GradNi_Ref_Mat[iNode][0];
-        Ba_Mat[1][1] = GradNi_Ref_Mat[iNode][1];
-        Ba_Mat[2][2] = GradNi_Ref_Mat[iNode][2];
-        Ba_Mat[3][0] = GradNi_Ref_Mat[iNode][1];
-        Ba_Mat[3][1] = GradNi_Ref_Mat[iNode][0];
-        Ba_Mat[4][0] = GradNi_Ref_Mat[iNode][2];
-        Ba_Mat[4][2] = GradNi_Ref_Mat[iNode][0];
-        Ba_Mat[5][1] = GradNi_Ref_Mat[iNode][2];
-        Ba_Mat[5][2] = GradNi_Ref_Mat[iNode][1];
-      }
-
-      /*--- Compute the BT.D Matrix ---*/
-
-      for (iVar = 0; iVar < nDim; iVar++) {
-        for (jVar = 0; jVar < bDim; jVar++) {
-          AuxMatrix[iVar][jVar] = 0.0;
-          for (kVar = 0; kVar < bDim; kVar++) {
-            AuxMatrix[iVar][jVar] += Ba_Mat[kVar][iVar]*D_Mat[kVar][jVar];
-          }
+      /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
+      /*--- This avoids repeated operations ---*/
+      for (iNode = 0; iNode < nNode; iNode++) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
         }
       }
 
-      /*--- Assumming symmetry ---*/
-      for (jNode = iNode; jNode < nNode; jNode++) {
+      for (iNode = 0; iNode < nNode; iNode++) {
+
         if (nDim == 2) {
-          Bb_Mat[0][0] = GradNi_Ref_Mat[jNode][0];
-          Bb_Mat[1][1] = GradNi_Ref_Mat[jNode][1];
-          Bb_Mat[2][0] = GradNi_Ref_Mat[jNode][1];
-          Bb_Mat[2][1] = GradNi_Ref_Mat[jNode][0];
+          Ba_Mat[0][0] = GradNi_Ref_Mat[iNode][0];
+          Ba_Mat[1][1] = GradNi_Ref_Mat[iNode][1];
+          Ba_Mat[2][0] = GradNi_Ref_Mat[iNode][1];
+          Ba_Mat[2][1] = GradNi_Ref_Mat[iNode][0];
         }
         else {
-          Bb_Mat[0][0] = GradNi_Ref_Mat[jNode][0];
-          Bb_Mat[1][1] = GradNi_Ref_Mat[jNode][1];
-          Bb_Mat[2][2] = GradNi_Ref_Mat[jNode][2];
-          Bb_Mat[3][0] = GradNi_Ref_Mat[jNode][1];
-          Bb_Mat[3][1] = GradNi_Ref_Mat[jNode][0];
-          Bb_Mat[4][0] = GradNi_Ref_Mat[jNode][2];
-          Bb_Mat[4][2] = GradNi_Ref_Mat[jNode][0];
-          Bb_Mat[5][1] = GradNi_Ref_Mat[jNode][2];
-          Bb_Mat[5][2] = GradNi_Ref_Mat[jNode][1];
+          Ba_Mat[0][0] = GradNi_Ref_Mat[iNode][0];
+          Ba_Mat[1][1] = GradNi_Ref_Mat[iNode][1];
+          Ba_Mat[2][2] = GradNi_Ref_Mat[iNode][2];
+          Ba_Mat[3][0] = GradNi_Ref_Mat[iNode][1];
+          Ba_Mat[3][1] = GradNi_Ref_Mat[iNode][0];
+          Ba_Mat[4][0] = GradNi_Ref_Mat[iNode][2];
+          Ba_Mat[4][2] = GradNi_Ref_Mat[iNode][0];
+          Ba_Mat[5][1] = GradNi_Ref_Mat[iNode][2];
+          Ba_Mat[5][2] = GradNi_Ref_Mat[iNode][1];
         }
 
+        /*--- Compute the BT.D Matrix ---*/
+
         for (iVar = 0; iVar < nDim; iVar++) {
-          for (jVar = 0; jVar < nDim; jVar++) {
-            KAux_ab[iVar][jVar] = 0.0;
+          for (jVar = 0; jVar < bDim; jVar++) {
+            AuxMatrix[iVar][jVar] = 0.0;
             for (kVar = 0; kVar < bDim; kVar++) {
-              KAux_ab[iVar][jVar] += Weight * AuxMatrix[iVar][kVar] * Bb_Mat[kVar][jVar] * Jac_X;
+              AuxMatrix[iVar][jVar] += Ba_Mat[kVar][iVar]*D_Mat[kVar][jVar];
             }
           }
         }
 
-        element->Add_Kab(iNode, jNode, KAux_ab);
-        /*--- Symmetric terms --*/
-        if (iNode != jNode) {
-          element->Add_Kab_T(jNode, iNode, KAux_ab);
+        /*--- Assumming symmetry ---*/
+        for (jNode = iNode; jNode < nNode; jNode++) {
+          if (nDim == 2) {
+            Bb_Mat[0][0] = GradNi_Ref_Mat[jNode][0];
+            Bb_Mat[1][1] = GradNi_Ref_Mat[jNode][1];
+            Bb_Mat[2][0] = GradNi_Ref_Mat[jNode][1];
+            Bb_Mat[2][1] = GradNi_Ref_Mat[jNode][0];
+          }
+          else {
+            Bb_Mat[0][0] = GradNi_Ref_Mat[jNode][0];
+            Bb_Mat[1][1] = GradNi_Ref_Mat[jNode][1];
+            Bb_Mat[2][2] = GradNi_Ref_Mat[jNode][2];
+            Bb_Mat[3][0] = GradNi_Ref_Mat[jNode][1];
+            Bb_Mat[3][1] = GradNi_Ref_Mat[jNode][0];
+            Bb_Mat[4][0] = GradNi_Ref_Mat[jNode][2];
+            Bb_Mat[4][2] = GradNi_Ref_Mat[jNode][0];
+            Bb_Mat[5][1] = GradNi_Ref_Mat[jNode][2];
+            Bb_Mat[5][2] = GradNi_Ref_Mat[jNode][1];
+          }
+
+          for (iVar = 0; iVar < nDim; iVar++) {
+            for (jVar = 0; jVar < nDim; jVar++) {
+              KAux_ab[iVar][jVar] = 0.0;
+              for (kVar = 0; kVar < bDim; kVar++) {
+                KAux_ab[iVar][jVar] += Weight * AuxMatrix[iVar][kVar] * Bb_Mat[kVar][jVar] * Jac_X;
+              }
+            }
+          }
+
+          element->Add_Kab(iNode, jNode, KAux_ab);
+          /*--- Symmetric terms --*/
+          if (iNode != jNode) {
+            element->Add_Kab_T(jNode, iNode, KAux_ab);
+          }
+
         }
 
       }
 
     }
-
   }
 
   /*--- Compute residual ---*/
@@ -194,6 +200,37 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
 }
 
 
+bool CFEALinearElasticity::Compute_Stiffness_Batched(CElement *element) const {
+
+  if (nDim != 3) return false;
+
+  const auto nNode = element->GetnNodes();
+  const auto nGauss = element->GetnGaussPoints();
+
+  if (nNode == 4 && nGauss == 1) Compute_Stiffness_Batched<4,1>(element);
+  else if (nNode == 4 && nGauss == 4) Compute_Stiffness_Batched<4,4>(element);
+  else if (nNode == 8 && nGauss == 8) Compute_Stiffness_Batched<8,8>(element);
+  else return false;
+
+  return true;
+}
+
+template <size_t NNODE, size_t NGAUSS>
+void CFEALinearElasticity::Compute_Stiffness_Batched(CElement *element) const {
+
+  ElementKernels::GaussDouble<NGAUSS> gradN[NNODE][3], wJ;
+  ElementKernels::GatherGradients(*element, CElement::REFERENCE, gradN, wJ);
+
+  /*--- The constitutive matrix of 3D problems is isotropic. ---*/
+  ElementKernels::IsotropicStiffness(gradN, wJ, Lambda, Mu,
+    [element](size_t iNode, size_t jNode, su2double Kab[3][3]) {
+      su2double* KabRows[] = {Kab[0], Kab[1], Kab[2]};
+      element->Add_Kab(iNode, jNode, KabRows);
+      /*--- Symmetric terms --*/
+      if (iNode != jNode) element->Add_Kab_T(jNode, iNode, KabRows);
+    });
+}
+
 void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_container, const CConfig *config) {
 
   /*--- Compute the D Matrix (for plane stress and 2-D)---*/
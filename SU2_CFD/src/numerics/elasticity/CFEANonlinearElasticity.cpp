@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/numerics/elasticity/CFEANonlinearElasticity.hpp"
+#include "../../../../Common/include/geometry/elements/element_kernels.hpp"
 
 
 CFEANonlinearElasticity::CFEANonlinearElasticity(unsigned short val_nDim, unsigned short val_nVar,
@@ -222,7 +223,7 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
   unsigned short iVar, jVar, kVar;
   unsigned short iGauss, nGauss;
   unsigned short iNode, jNode, nNode;
-  unsigned short iDim, bDim;
+  unsigned short bDim;
 
   su2double Ks_Aux_ab;
 
@@ -278,6 +279,13 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
   nNode = element->GetnNodes();
   nGauss = element->GetnGaussPoints();
 
+  /*--- 3D tetrahedra and hexahedra use the batched kernels. ---*/
+  if (Compute_Tangent_Matrix_Batched(element, config, false)) {
+    element->SetPreaccOut_Kt_a();
+    AD::EndPreacc();
+    return;
+  }
+
   /*--- Full integration of the constitutive and stress term ---*/
 
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
@@ -285,64 +293,9 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
     Weight = element->GetWeight(iGauss);
     Jac_x = element->GetJ_x(iGauss);
 
-    /*--- Initialize the deformation gradient for each Gauss Point ---*/
-
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        F_Mat[iVar][jVar] = 0.0;
-        b_Mat[iVar][jVar] = 0.0;
-      }
-    }
-
-    /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
-    /*--- This avoids repeated operations ---*/
-
-    for (iNode = 0; iNode < nNode; iNode++) {
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
-        GradNi_Curr_Mat[iNode][iDim] = element->GetGradNi_x(iNode,iGauss,iDim);
-        currentCoord[iNode][iDim] = element->GetCurr_Coord(iNode, iDim);
-      }
-
-      /*--- Compute the deformation gradient ---*/
-
-      for (iVar = 0; iVar < nDim; iVar++) {
-        for (jVar = 0; jVar < nDim; jVar++) {
-          F_Mat[iVar][jVar] += currentCoord[iNode][iVar]*GradNi_Ref_Mat[iNode][jVar];
-        }
-      }
-    }
-
-    if (nDim == 2) {
-      if (plane_stress) {
-        // Compute the value of the term 33 for the deformation gradient
-        Compute_Plane_Stress_Term(element, config);
-        F_Mat[2][2] = f33;
-      }
-      else { // plane strain
-        F_Mat[2][2] = 1.0;
-      }
-    }
-
-    /*--- Determinant of F --> Jacobian of the transformation ---*/
+    /*--- Deformation gradient and left Cauchy-Green tensor. ---*/
 
-    J_F =   F_Mat[0][0]*F_Mat[1][1]*F_Mat[2][2]+
-        F_Mat[0][1]*F_Mat[1][2]*F_Mat[2][0]+
-        F_Mat[0][2]*F_Mat[1][0]*F_Mat[2][1]-
-        F_Mat[0][2]*F_Mat[1][1]*F_Mat[2][0]-
-        F_Mat[1][2]*F_Mat[2][1]*F_Mat[0][0]-
-        F_Mat[2][2]*F_Mat[0][1]*F_Mat[1][0];
-
-    /*--- Compute the left Cauchy deformation tensor ---*/
-
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
-        }
-      }
-    }
+    Compute_Kinematics(element, iGauss, config);
 
     /*--- Compute the constitutive matrix ---*/
 
@@ -468,10 +421,9 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
 
 void CFEANonlinearElasticity::Compute_NodalStress_Term(CElement *element, const CConfig *config) {
 
-  unsigned short iVar, jVar, kVar;
+  unsigned short iVar, jVar;
   unsigned short iGauss, nGauss;
   unsigned short iNode, nNode;
-  unsigned short iDim;
 
   /*--- TODO: Initialize values for the material model considered ---*/
   SetElement_Properties(element, config);
@@ -500,6 +452,13 @@ void CFEANonlinearElasticity::Compute_NodalStress_Term(CElement *element, const
   nNode = element->GetnNodes();
   nGauss = element->GetnGaussPoints();
 
+  /*--- 3D tetrahedra and hexahedra use the batched kernels. ---*/
+  if (Compute_Tangent_Matrix_Batched(element, config, true)) {
+    element->SetPreaccOut_Kt_a();
+    AD::EndPreacc();
+    return;
+  }
+
   /*--- Full integration of the nodal stress ---*/
 
   for (iGauss = 0; iGauss < nGauss; iGauss++) {
@@ -507,91 +466,166 @@ void CFEANonlinearElasticity::Compute_NodalStress_Term(CElement *element, const
     Weight = element->GetWeight(iGauss);
     Jac_x = element->GetJ_x(iGauss);
 
-    /*--- Initialize the deformation gradient for each Gauss Point ---*/
+    /*--- Deformation gradient and left Cauchy-Green tensor. ---*/
 
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        F_Mat[iVar][jVar] = 0.0;
-        b_Mat[iVar][jVar] = 0.0;
-      }
-    }
+    Compute_Kinematics(element, iGauss, config);
 
-    /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
-    /*--- This avoids repeated operations ---*/
+    /*--- Compute the stress tensor ---*/
 
-    for (iNode = 0; iNode < nNode; iNode++) {
+    Compute_Stress_Tensor(element, config);
+//    if (maxwell_stress) Add_MaxwellStress(element, config);
 
-      for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
-        GradNi_Curr_Mat[iNode][iDim] = element->GetGradNi_x(iNode,iGauss,iDim);
-        currentCoord[iNode][iDim] = element->GetCurr_Coord(iNode, iDim);
-      }
+    for (iNode = 0; iNode < nNode; iNode++) {
 
-      /*--- Compute the deformation gradient ---*/
+        /*--- Compute the nodal stress term for each gaussian point and for each node, ---*/
+        /*--- and add it to the element structure to be retrieved from the solver      ---*/
 
       for (iVar = 0; iVar < nDim; iVar++) {
+        KAux_t_a[iVar] = 0.0;
         for (jVar = 0; jVar < nDim; jVar++) {
-          F_Mat[iVar][jVar] += currentCoord[iNode][iVar]*GradNi_Ref_Mat[iNode][jVar];
+          KAux_t_a[iVar] += Weight * Stress_Tensor[iVar][jVar] * GradNi_Curr_Mat[iNode][jVar] * Jac_x;
         }
       }
+
+      element->Add_Kt_a(iNode, KAux_t_a);
+
     }
 
-    if (nDim == 2) {
-      if (plane_stress) {
-        // Compute the value of the term 33 for the deformation gradient
-        Compute_Plane_Stress_Term(element, config);
-        F_Mat[2][2] = f33;
-      }
-      else { // plane strain
-        F_Mat[2][2] = 1.0;
-      }
+  }
+
+  /*--- Register the stress residual as preaccumulation output ---*/
+  element->SetPreaccOut_Kt_a();
+  AD::EndPreacc();
+
+}
+
+void CFEANonlinearElasticity::Compute_Kinematics(CElement *element, unsigned short iGauss, const CConfig *config) {
+
+  unsigned short iVar, jVar, kVar;
+  unsigned short iNode, iDim;
+  const unsigned short nNode = element->GetnNodes();
+
+  /*--- Initialize the deformation gradient for each Gauss Point ---*/
+
+  for (iVar = 0; iVar < 3; iVar++) {
+    for (jVar = 0; jVar < 3; jVar++) {
+      F_Mat[iVar][jVar] = 0.0;
+      b_Mat[iVar][jVar] = 0.0;
     }
+  }
+
+  /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
+  /*--- This avoids repeated operations ---*/
 
-    /*--- Determinant of F --> Jacobian of the transformation ---*/
+  for (iNode = 0; iNode < nNode; iNode++) {
 
-    J_F =   F_Mat[0][0]*F_Mat[1][1]*F_Mat[2][2]+
-        F_Mat[0][1]*F_Mat[1][2]*F_Mat[2][0]+
-        F_Mat[0][2]*F_Mat[1][0]*F_Mat[2][1]-
-        F_Mat[0][2]*F_Mat[1][1]*F_Mat[2][0]-
-        F_Mat[1][2]*F_Mat[2][1]*F_Mat[0][0]-
-        F_Mat[2][2]*F_Mat[0][1]*F_Mat[1][0];
+    for (iDim = 0; iDim < nDim; iDim++) {
+      GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
+      GradNi_Curr_Mat[iNode][iDim] = element->GetGradNi_x(iNode,iGauss,iDim);
+      currentCoord[iNode][iDim] = element->GetCurr_Coord(iNode, iDim);
+    }
 
-    /*--- Compute the left Cauchy deformation tensor ---*/
+    /*--- Compute the deformation gradient ---*/
 
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
-        }
+    for (iVar = 0; iVar < nDim; iVar++) {
+      for (jVar = 0; jVar < nDim; jVar++) {
+        F_Mat[iVar][jVar] += currentCoord[iNode][iVar]*GradNi_Ref_Mat[iNode][jVar];
       }
     }
+  }
 
-    /*--- Compute the stress tensor ---*/
+  if (nDim == 2) {
+    if (plane_stress) {
+      // Compute the value of the term 33 for the deformation gradient
+      Compute_Plane_Stress_Term(element, config);
+      F_Mat[2][2] = f33;
+    }
+    else { // plane strain
+      F_Mat[2][2] = 1.0;
+    }
+  }
 
-    Compute_Stress_Tensor(element, config);
-//    if (maxwell_stress) Add_MaxwellStress(element, config);
+  /*--- Determinant of F --> Jacobian of the transformation ---*/
 
-    for (iNode = 0; iNode < nNode; iNode++) {
+  J_F =   F_Mat[0][0]*F_Mat[1][1]*F_Mat[2][2]+
+      F_Mat[0][1]*F_Mat[1][2]*F_Mat[2][0]+
+      F_Mat[0][2]*F_Mat[1][0]*F_Mat[2][1]-
+      F_Mat[0][2]*F_Mat[1][1]*F_Mat[2][0]-
+      F_Mat[1][2]*F_Mat[2][1]*F_Mat[0][0]-
+      F_Mat[2][2]*F_Mat[0][1]*F_Mat[1][0];
 
-        /*--- Compute the nodal stress term for each gaussian point and for each node, ---*/
-        /*--- and add it to the element structure to be retrieved from the solver      ---*/
+  /*--- Compute the left Cauchy deformation tensor ---*/
 
-      for (iVar = 0; iVar < nDim; iVar++) {
-        KAux_t_a[iVar] = 0.0;
-        for (jVar = 0; jVar < nDim; jVar++) {
-          KAux_t_a[iVar] += Weight * Stress_Tensor[iVar][jVar] * GradNi_Curr_Mat[iNode][jVar] * Jac_x;
-        }
+  for (iVar = 0; iVar < 3; iVar++) {
+    for (jVar = 0; jVar < 3; jVar++) {
+      for (kVar = 0; kVar < 3; kVar++) {
+        b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
       }
+    }
+  }
 
-      element->Add_Kt_a(iNode, KAux_t_a);
+}
 
-    }
+bool CFEANonlinearElasticity::Compute_Tangent_Matrix_Batched(CElement *element, const CConfig *config,
+                                                             bool stressTermOnly) {
+  if (nDim != 3) return false;
+
+  const auto nNode = element->GetnNodes();
+  const auto nGauss = element->GetnGaussPoints();
+
+  if (nNode == 4 && nGauss == 1) Compute_Tangent_Matrix_Batched<4,1>(element, config, stressTermOnly);
+  else if (nNode == 4 && nGauss == 4) Compute_Tangent_Matrix_Batched<4,4>(element, config, stressTermOnly);
+  else if (nNode == 8 && nGauss == 8) Compute_Tangent_Matrix_Batched<8,8>(element, config, stressTermOnly);
+  else return false;
+
+  return true;
+}
+
+template <size_t NNODE, size_t NGAUSS>
+void CFEANonlinearElasticity::Compute_Tangent_Matrix_Batched(CElement *element, const CConfig *config,
+                                                             bool stressTermOnly) {
+  using namespace ElementKernels;
+
+  GaussDouble<NGAUSS> gradN[NNODE][3], wJ, stress[3][3], D[6][6];
+  GatherGradients(*element, CElement::CURRENT, gradN, wJ);
 
+  /*--- Evaluate the material model at each Gauss point. ---*/
+
+  for (unsigned short iGauss = 0; iGauss < NGAUSS; iGauss++) {
+
+    Compute_Kinematics(element, iGauss, config);
+    Compute_Stress_Tensor(element, config);
+    for (unsigned short iVar = 0; iVar < 3; iVar++)
+      for (unsigned short jVar = 0; jVar < 3; jVar++)
+        stress[iVar][jVar][iGauss] = Stress_Tensor[iVar][jVar];
+
+    if (stressTermOnly) continue;
+
+    Compute_Constitutive_Matrix(element, config);
+    for (unsigned short iVar = 0; iVar < DIM_STRAIN_3D; iVar++)
+      for (unsigned short jVar = 0; jVar < DIM_STRAIN_3D; jVar++)
+        D[iVar][jVar][iGauss] = D_Mat[iVar][jVar];
   }
 
-  /*--- Register the stress residual as preaccumulation output ---*/
-  element->SetPreaccOut_Kt_a();
-  AD::EndPreacc();
+  /*--- Integrate the nodal stress term, and the constitutive and stress terms of the tangent matrix. ---*/
+
+  NodalStressTerm(gradN, wJ, stress, [element](size_t iNode, const su2double* Kt_a) {
+    element->Add_Kt_a(iNode, Kt_a);
+  });
+
+  if (stressTermOnly) return;
+
+  ConstitutiveStiffness(gradN, wJ, D, [element](size_t iNode, size_t jNode, su2double Kab[3][3]) {
+    su2double* KabRows[] = {Kab[0], Kab[1], Kab[2]};
+    element->Add_Kab(iNode, jNode, KabRows);
+    /*--- Symmetric terms --*/
+    if (iNode != jNode) element->Add_Kab_T(jNode, iNode, KabRows);
+  });
+
+  StressStiffness(gradN, wJ, stress, [element](size_t iNode, size_t jNode, su2double Ks_ab) {
+    element->Add_Ks_ab(iNode, jNode, Ks_ab);
+    if (iNode != jNode) element->Add_Ks_ab(jNode, iNode, Ks_ab);
+  });
 
 }
 
@@ -743,9 +777,9 @@ void CFEANonlinearElasticity::Assign_cijkl_D_Mat() {
 
 su2double CFEANonlinearElasticity::Compute_Averaged_NodalStress(CElement *element, const CConfig *config) {
 
-  unsigned short iVar, jVar, kVar;
+  unsigned short iVar, jVar;
   unsigned short iGauss, nGauss;
-  unsigned short iDim, iNode, nNode;
+  unsigned short iNode, nNode;
 
   su2double avgStress[DIM_STRAIN_3D] = {0.0};
 
@@ -786,64 +820,9 @@ su2double CFEANonlinearElasticity::Compute_Averaged_NodalStress(CElement *elemen
     Weight = element->GetWeight(iGauss);
     Jac_x = element->GetJ_x(iGauss);
 
-    /*--- Initialize the deformation gradient for each Gauss Point ---*/
-
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        F_Mat[iVar][jVar] = 0.0;
-        b_Mat[iVar][jVar] = 0.0;
-      }
-    }
-
-    /*--- Retrieve the values of the gradients of the shape functions for each node ---*/
-    /*--- This avoids repeated operations ---*/
-
-    for (iNode = 0; iNode < nNode; iNode++) {
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        currentCoord[iNode][iDim] = element->GetCurr_Coord(iNode,iDim);
-        GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
-        GradNi_Curr_Mat[iNode][iDim] = element->GetGradNi_x(iNode,iGauss,iDim);
-      }
-
-      /*--- Compute the deformation gradient ---*/
+    /*--- Deformation gradient and left Cauchy-Green tensor. ---*/
 
-      for (iVar = 0; iVar < nDim; iVar++) {
-        for (jVar = 0; jVar < nDim; jVar++) {
-          F_Mat[iVar][jVar] += currentCoord[iNode][iVar]*GradNi_Ref_Mat[iNode][jVar];
-        }
-      }
-    }
-
-    if (nDim == 2) {
-      if (plane_stress) {
-        // Compute the value of the term 33 for the deformation gradient
-        Compute_Plane_Stress_Term(element, config);
-        F_Mat[2][2] = f33;
-      }
-      else { // plane strain
-        F_Mat[2][2] = 1.0;
-      }
-    }
-
-    /*--- Determinant of F --> Jacobian of the transformation ---*/
-
-    J_F = F_Mat[0][0]*F_Mat[1][1]*F_Mat[2][2]+
-          F_Mat[0][1]*F_Mat[1][2]*F_Mat[2][0]+
-          F_Mat[0][2]*F_Mat[1][0]*F_Mat[2][1]-
-          F_Mat[0][2]*F_Mat[1][1]*F_Mat[2][0]-
-          F_Mat[1][2]*F_Mat[2][1]*F_Mat[0][0]-
-          F_Mat[2][2]*F_Mat[0][1]*F_Mat[1][0];
-
-    /*--- Compute the left Cauchy deformation tensor ---*/
-
-    for (iVar = 0; iVar < 3; iVar++) {
-      for (jVar = 0; jVar < 3; jVar++) {
-        for (kVar = 0; kVar < 3; kVar++) {
-          b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
-        }
-      }
-    }
+    Compute_Kinematics(element, iGauss, config);
 
     /*--- Compute the stress tensor ---*/
 
@@ -194,10 +194,10 @@ CNumerics::ResidualType<> CUpwRoeBase_Flow::ComputeResidual(const CConfig* confi
 
   /*--- Apply Mavriplis' entropy correction to eigenvalues ---*/
 
-  su2double MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
+  const su2double MinLambda = config->GetEntropyFix_Coeff() * (fabs(ProjVelocity) + RoeSoundSpeed);
 
   for (iVar = 0; iVar < nVar; iVar++)
-    Lambda[iVar] = max(fabs(Lambda[iVar]), config->GetEntropyFix_Coeff()*MaxLambda);
+    Lambda[iVar] = max(fabs(Lambda[iVar]), MinLambda);
 
   /*--- Reconstruct conservative variables ---*/
 
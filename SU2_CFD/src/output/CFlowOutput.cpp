@@ -29,6 +29,8 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include <fstream>
+#include <algorithm>
 
 #include "../../include/output/CFlowOutput.hpp"
 
@@ -36,7 +38,11 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CSolver.hpp"
 #include "../../include/variables/CPrimitiveIndices.hpp"
+#include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/fluid/CCoolProp.hpp"
+#include "../../include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
 
 CFlowOutput::CFlowOutput(const CConfig *config, unsigned short nDim, bool fem_output) :
   CFVMOutput(config, nDim, fem_output),
@@ -356,28 +362,33 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver* const*solver, const CGeometry
 
   }
 
-  auto Allreduce = [](const vector<su2double>& src, vector<su2double>& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  };
-
-  auto Allreduce_su2activematrix = [](const su2activematrix& src, su2activematrix& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  };
-
-  Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total);
-  Allreduce(Surface_Mach_Local, Surface_Mach_Total);
-  Allreduce(Surface_Temperature_Local, Surface_Temperature_Total);
-  Allreduce(Surface_Density_Local, Surface_Density_Total);
-  Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total);
-  Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total);
-  Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total);
-  Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total);
-  Allreduce(Surface_Pressure_Local, Surface_Pressure_Total);
-  Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total);
-  Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total);
-  Allreduce(Surface_Area_Local, Surface_Area_Total);
-  Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total);
-  Allreduce_su2activematrix(Surface_Species_Local, Surface_Species_Total);
+  /*--- Sum the values of all ranks with a single reduction of all the quantities. ---*/
+
+  const vector<su2double>* localValues[] = {
+    &Surface_MassFlow_Local, &Surface_Mach_Local, &Surface_Temperature_Local, &Surface_Density_Local,
+    &Surface_Enthalpy_Local, &Surface_NormalVelocity_Local, &Surface_StreamVelocity2_Local,
+    &Surface_TransvVelocity2_Local, &Surface_Pressure_Local, &Surface_TotalTemperature_Local,
+    &Surface_TotalPressure_Local, &Surface_Area_Local, &Surface_MassFlow_Abs_Local};
+  vector<su2double>* totalValues[] = {
+    &Surface_MassFlow_Total, &Surface_Mach_Total, &Surface_Temperature_Total, &Surface_Density_Total,
+    &Surface_Enthalpy_Total, &Surface_NormalVelocity_Total, &Surface_StreamVelocity2_Total,
+    &Surface_TransvVelocity2_Total, &Surface_Pressure_Total, &Surface_TotalTemperature_Total,
+    &Surface_TotalPressure_Total, &Surface_Area_Total, &Surface_MassFlow_Abs_Total};
+
+  vector<su2double> localPacked, totalPacked;
+  for (const auto* values : localValues) localPacked.insert(localPacked.end(), values->begin(), values->end());
+  localPacked.insert(localPacked.end(), Surface_Species_Local.data(),
+                     Surface_Species_Local.data() + Surface_Species_Local.size());
+  totalPacked.resize(localPacked.size());
+
+  SU2_MPI::Allreduce(localPacked.data(), totalPacked.data(), localPacked.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  auto packed = totalPacked.cbegin();
+  for (auto* values : totalValues) {
+    std::copy(packed, packed + values->size(), values->begin());
+    packed += values->size();
+  }
+  std::copy(packed, packed + Surface_Species_Total.size(), Surface_Species_Total.data());
 
   /*--- Compute the value of Surface_Area_Total, and Surface_Pressure_Total, and
    set the value in the config structure for future use ---*/
@@ -869,6 +880,9 @@ void CFlowOutput::SetCustomOutputs(const CSolver* const* solver, const CGeometry
       }
     }
 
+    /*--- Point-wise outputs are evaluated when loading the volume data (see LoadCustomVolumeData). ---*/
+    if (output.type == OperationType::VOLUME) continue;
+
     if (output.type == OperationType::FUNCTION) {
       auto Functor = [&](unsigned long i) {
         /*--- Functions only reference other history outputs. ---*/
@@ -955,6 +969,67 @@ void CFlowOutput::SetCustomOutputs(const CSolver* const* solver, const CGeometry
   }
 }
 
+void CFlowOutput::SetCustomVolumeOutputFields(const CConfig *config) {
+
+  /*--- The FEM output does not have point-wise solver variables. ---*/
+  if (femOutput) return;
+
+  for (const auto& output : customOutputs) {
+    if (output.type != OperationType::VOLUME) continue;
+    AddVolumeOutput(output.name, output.name, "CUSTOM", "Custom volume output");
+  }
+}
+
+void CFlowOutput::LoadCustomVolumeData(const CConfig *config, const CGeometry *geometry,
+                                       const CSolver* const* solver) {
+  if (femOutput) return;
+
+  const auto* flowNodes = su2staticcast_p<const CFlowVariable*>(solver[FLOW_SOL]->GetNodes());
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Each instruction of the compiled expressions is applied to a batch of points, the work space holds the
+   * evaluation stack for the batch (a few kB, the values of the stack entries are contiguous). ---*/
+  constexpr unsigned long BATCH = 64;
+  std::vector<su2double> work(CCompiledExpression::MAX_DEPTH * BATCH);
+
+  for (auto& output : customOutputs) {
+    if (output.type != OperationType::VOLUME) continue;
+
+    const short offset = volumeOutput_Map.at(output.name).offset;
+    if (offset < 0) continue;
+
+    if (output.varIndices.empty()) {
+      const auto primIdx = CPrimitiveIndices<unsigned long>(config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+          config->GetNEMOProblem(), nDim, config->GetnSpecies());
+      ConvertVariableSymbolsToIndices(primIdx, false, output);
+    }
+
+    /*--- Maps symbol indices to values for the k-th point of the batch (see SetCustomOutputs). ---*/
+    unsigned long iPointBegin = 0;
+    auto Variables = [&](unsigned long i, size_t k) -> su2double {
+      if (i < CustomOutput::NOT_A_VARIABLE) {
+        const auto iPoint = iPointBegin + k;
+        const auto solIdx = i / CustomOutput::MAX_VARS_PER_SOLVER;
+        const auto varIdx = i % CustomOutput::MAX_VARS_PER_SOLVER;
+        if (solIdx == FLOW_SOL) {
+          return flowNodes->GetPrimitive(iPoint, varIdx);
+        }
+        return solver[solIdx]->GetNodes()->GetSolution(iPoint, varIdx);
+      }
+      return *output.otherOutputs[i - CustomOutput::NOT_A_VARIABLE];
+    };
+
+    for (iPointBegin = 0; iPointBegin < nPointDomain; iPointBegin += BATCH) {
+      const auto n = std::min(BATCH, nPointDomain - iPointBegin);
+      output.EvalBatch(n, BATCH, Variables, work.data());
+
+      for (auto k = 0ul; k < n; ++k) {
+        volumeDataSorter->SetUnsortedData(iPointBegin + k, offset, work[k]);
+      }
+    }
+  }
+}
+
 // The "AddHistoryOutput(" must not be split over multiple lines to ensure proper python parsing
 // clang-format off
 void CFlowOutput::AddHistoryOutputFields_ScalarRMS_RES(const CConfig* config) {
@@ -1477,6 +1552,12 @@ void CFlowOutput::SetVolumeOutputFieldsScalarMisc(const CConfig* config) {
     AddVolumeOutput("Q_CRITERION", "Q_Criterion", "VORTEX_IDENTIFICATION", "Value of the Q-Criterion");
   }
 
+  // Mesh adaptation
+  if (config->GetKind_Adapt_Indicator() != ADAPT_INDICATOR::NONE) {
+    AddVolumeOutput("ADAPT_INDICATOR", "Adapt_Indicator", "ADAPTATION", "Error indicator of the mesh adaptation");
+    AddVolumeOutput("ADAPT_FLAG", "Adapt_Flag", "ADAPTATION", "Adaptation flag (1 refine, -1 coarsen, 0 keep)");
+  }
+
   // Timestep info
   AddVolumeOutput("DELTA_TIME", "Delta_Time", "TIMESTEP", "Value of the local timestep for the flow variables");
   AddVolumeOutput("CFL", "CFL", "TIMESTEP", "Value of the local CFL for the flow variables");
@@ -1499,6 +1580,11 @@ void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* con
   SetVolumeOutputValue("DELTA_TIME", iPoint, Node_Flow->GetDelta_Time(iPoint));
   SetVolumeOutputValue("CFL", iPoint, Node_Flow->GetLocalCFL(iPoint));
 
+  if (iPoint < adaptIndicator.size()) {
+    SetVolumeOutputValue("ADAPT_INDICATOR", iPoint, adaptIndicator[iPoint]);
+    SetVolumeOutputValue("ADAPT_FLAG", iPoint, adaptFlag[iPoint]);
+  }
+
   if (config->GetViscous()) {
     if (nDim == 3){
       SetVolumeOutputValue("VORTICITY_X", iPoint, Node_Flow->GetVorticity(iPoint)[0]);
@@ -3942,7 +4028,7 @@ bool CFlowOutput::WriteVolumeOutput(CConfig *config, unsigned long Iter, bool fo
   return force_writing;
 }
 
-void CFlowOutput::SetTimeAveragedFields() {
+void CFlowOutput::SetTimeAveragedFields(const CConfig *config) {
   AddVolumeOutput("MEAN_DENSITY", "MeanDensity", "TIME_AVERAGE", "Mean density");
   AddVolumeOutput("MEAN_VELOCITY-X", "MeanVelocity_x", "TIME_AVERAGE", "Mean velocity x-component");
   AddVolumeOutput("MEAN_VELOCITY-Y", "MeanVelocity_y", "TIME_AVERAGE", "Mean velocity y-component");
@@ -3966,47 +4052,351 @@ void CFlowOutput::SetTimeAveragedFields() {
     AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
     AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
   }
+
+  /*--- Phase averages and amplitudes of the same quantities as the time statistics. ---*/
+
+  vector<string> names = {"DENSITY", "VELOCITY-X", "VELOCITY-Y"}, headers = {"Density", "Velocity_x", "Velocity_y"};
+  if (nDim == 3) {
+    names.push_back("VELOCITY-Z");
+    headers.push_back("Velocity_z");
+  }
+  names.push_back("PRESSURE");
+  headers.push_back("Pressure");
+
+  phaseAverageFields.clear();
+  for (auto iPhase = 0u; iPhase < config->GetTimeStatistics_Phases(); iPhase++) {
+    const auto phase = to_string(iPhase);
+    for (auto iVar = 0u; iVar < names.size(); iVar++) {
+      phaseAverageFields.push_back("PHASE" + phase + "_" + names[iVar]);
+      AddVolumeOutput(phaseAverageFields.back(), "Phase" + phase + "_" + headers[iVar], "PHASE_AVERAGE",
+                      "Mean " + headers[iVar] + " over phase bin " + phase + " of TIME_STATISTICS_PERIOD");
+    }
+  }
+  spectrumFields.clear();
+  for (auto iFreq = 0u; iFreq < config->GetnTimeStatistics_Frequencies(); iFreq++) {
+    const auto freq = to_string(iFreq);
+    for (auto iVar = 0u; iVar < names.size(); iVar++) {
+      spectrumFields.push_back("AMPLITUDE" + freq + "_" + names[iVar]);
+      AddVolumeOutput(spectrumFields.back(), "Amplitude" + freq + "_" + headers[iVar], "SPECTRUM",
+                      "Amplitude of " + headers[iVar] + " at frequency " + freq + " of TIME_STATISTICS_FREQUENCIES");
+    }
+  }
 }
 
-void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *Node_Flow){
-  SetAvgVolumeOutputValue("MEAN_DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint,0));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint,1));
+void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint) {
+  if (!timeStatistics.IsInitialized()) return;
+
+  /*--- Quantities of the statistics: density, velocity, pressure. Covariances: uv, (uw, vw). ---*/
+  const auto& stats = timeStatistics;
+  const unsigned short iPres = nDim + 1;
+
+  /*--- The "RMS" fields are the means of the squares (or products), the primes are the (co)variances. ---*/
+  auto MeanSquare = [&](unsigned short iVar) {
+    return stats.GetVariance(iVar, iPoint) + pow(stats.GetMean(iVar, iPoint), 2);
+  };
+  auto MeanProduct = [&](unsigned long iCov, unsigned short iVar, unsigned short jVar) {
+    return stats.GetCovariance(iCov, iPoint) + stats.GetMean(iVar, iPoint) * stats.GetMean(jVar, iPoint);
+  };
+
+  SetVolumeOutputValue("MEAN_DENSITY", iPoint, stats.GetMean(0, iPoint));
+  SetVolumeOutputValue("MEAN_VELOCITY-X", iPoint, stats.GetMean(1, iPoint));
+  SetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, stats.GetMean(2, iPoint));
   if (nDim == 3)
-    SetAvgVolumeOutputValue("MEAN_VELOCITY-Z", iPoint, Node_Flow->GetVelocity(iPoint,2));
+    SetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint, stats.GetMean(3, iPoint));
 
-  SetAvgVolumeOutputValue("MEAN_PRESSURE", iPoint, Node_Flow->GetPressure(iPoint));
+  SetVolumeOutputValue("MEAN_PRESSURE", iPoint, stats.GetMean(iPres, iPoint));
 
-  SetAvgVolumeOutputValue("RMS_U", iPoint, pow(Node_Flow->GetVelocity(iPoint,0),2));
-  SetAvgVolumeOutputValue("RMS_V", iPoint, pow(Node_Flow->GetVelocity(iPoint,1),2));
-  SetAvgVolumeOutputValue("RMS_UV", iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1));
-  SetAvgVolumeOutputValue("RMS_P", iPoint, pow(Node_Flow->GetPressure(iPoint),2));
+  SetVolumeOutputValue("RMS_U", iPoint, MeanSquare(1));
+  SetVolumeOutputValue("RMS_V", iPoint, MeanSquare(2));
+  SetVolumeOutputValue("RMS_UV", iPoint, MeanProduct(0, 1, 2));
+  SetVolumeOutputValue("RMS_P", iPoint, MeanSquare(iPres));
   if (nDim == 3){
-    SetAvgVolumeOutputValue("RMS_W", iPoint, pow(Node_Flow->GetVelocity(iPoint,2),2));
-    SetAvgVolumeOutputValue("RMS_VW", iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1));
-    SetAvgVolumeOutputValue("RMS_UW", iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
-  }
-
-  const su2double umean  = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
-  const su2double uumean = GetVolumeOutputValue("RMS_U", iPoint);
-  const su2double vmean  = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
-  const su2double vvmean = GetVolumeOutputValue("RMS_V", iPoint);
-  const su2double uvmean = GetVolumeOutputValue("RMS_UV", iPoint);
-  const su2double pmean  = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
-  const su2double ppmean = GetVolumeOutputValue("RMS_P", iPoint);
-
-  SetVolumeOutputValue("UUPRIME", iPoint, -(umean*umean - uumean));
-  SetVolumeOutputValue("VVPRIME", iPoint, -(vmean*vmean - vvmean));
-  SetVolumeOutputValue("UVPRIME", iPoint, -(umean*vmean - uvmean));
-  SetVolumeOutputValue("PPRIME",  iPoint, -(pmean*pmean - ppmean));
+    SetVolumeOutputValue("RMS_W", iPoint, MeanSquare(3));
+    SetVolumeOutputValue("RMS_VW", iPoint, MeanProduct(2, 2, 3));
+    SetVolumeOutputValue("RMS_UW", iPoint, MeanProduct(1, 1, 3));
+  }
+
+  SetVolumeOutputValue("UUPRIME", iPoint, stats.GetVariance(1, iPoint));
+  SetVolumeOutputValue("VVPRIME", iPoint, stats.GetVariance(2, iPoint));
+  SetVolumeOutputValue("UVPRIME", iPoint, stats.GetCovariance(0, iPoint));
+  SetVolumeOutputValue("PPRIME",  iPoint, stats.GetVariance(iPres, iPoint));
   if (nDim == 3){
-    const su2double wmean  = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
-    const su2double wwmean = GetVolumeOutputValue("RMS_W", iPoint);
-    const su2double uwmean = GetVolumeOutputValue("RMS_UW", iPoint);
-    const su2double vwmean = GetVolumeOutputValue("RMS_VW", iPoint);
-    SetVolumeOutputValue("WWPRIME", iPoint, -(wmean*wmean - wwmean));
-    SetVolumeOutputValue("UWPRIME", iPoint, -(umean*wmean - uwmean));
-    SetVolumeOutputValue("VWPRIME",  iPoint, -(vmean*wmean - vwmean));
+    SetVolumeOutputValue("WWPRIME", iPoint, stats.GetVariance(3, iPoint));
+    SetVolumeOutputValue("UWPRIME", iPoint, stats.GetCovariance(1, iPoint));
+    SetVolumeOutputValue("VWPRIME",  iPoint, stats.GetCovariance(2, iPoint));
+  }
+
+  const unsigned short nVar = nDim + 2;
+  for (auto iField = 0ul; iField < phaseAverageFields.size(); iField++) {
+    SetVolumeOutputValue(phaseAverageFields[iField], iPoint, stats.GetPhaseMean(iField / nVar, iField % nVar, iPoint));
+  }
+  for (auto iField = 0ul; iField < spectrumFields.size(); iField++) {
+    SetVolumeOutputValue(spectrumFields[iField], iPoint, stats.GetAmplitude(iField / nVar, iField % nVar, iPoint));
+  }
+}
+
+void CFlowOutput::UpdateTimeStatistics(CConfig *config, CGeometry *geometry, CSolver **solver) {
+
+  if (!timeStatistics.IsInitialized()) {
+    if (timeStatisticsChecked) return;
+    timeStatisticsChecked = true;
+
+    /*--- The statistics are only kept if some of their fields are written. ---*/
+
+    bool requested = false;
+    for (const auto& field : volumeOutput_Map) {
+      const auto& group = field.second.outputGroup;
+      requested |= (field.second.offset != -1) &&
+                   (group == "TIME_AVERAGE" || group == "PHASE_AVERAGE" || group == "SPECTRUM");
+    }
+    if (!requested) return;
+
+    vector<string> names = {"Density", "Velocity_x", "Velocity_y"};
+    vector<CTimeStatistics::Pair> covariances = {{1, 2}};
+    if (nDim == 3) {
+      names.push_back("Velocity_z");
+      covariances.push_back({1, 3});
+      covariances.push_back({2, 3});
+    }
+    names.push_back("Pressure");
+
+    vector<passivedouble> frequencies;
+    for (auto iFreq = 0u; iFreq < config->GetnTimeStatistics_Frequencies(); iFreq++) {
+      frequencies.push_back(SU2_TYPE::GetValue(config->GetTimeStatistics_Frequency(iFreq)));
+    }
+    timeStatistics.Initialize(geometry->GetnPoint(), names, covariances, config->GetTimeStatistics_Phases(),
+                              config->GetTimeStatistics_Period(), frequencies);
+
+    if (config->GetRestart()) ReadTimeStatistics(config, geometry, solver);
+  }
+
+  /*--- Once per time step, the halos are updated too since their solution is synchronized. ---*/
+
+  const su2double time = curTimeIter * config->GetDelta_UnstTime();
+  if (!timeStatistics.BeginStep(curTimeIter, SU2_TYPE::GetValue(time))) return;
+
+  const auto* flowNodes = solver[FLOW_SOL]->GetNodes();
+  su2double values[5];
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    values[0] = flowNodes->GetDensity(iPoint);
+    for (auto iDim = 0u; iDim < nDim; iDim++) values[iDim + 1] = flowNodes->GetVelocity(iPoint, iDim);
+    values[nDim + 1] = flowNodes->GetPressure(iPoint);
+    timeStatistics.Update(iPoint, values);
+  }
+}
+
+void CFlowOutput::ComputeAdaptationIndicator(CConfig *config, CGeometry *geometry, CSolver **solver) {
+
+  const auto kind = config->GetKind_Adapt_Indicator();
+  if (kind == ADAPT_INDICATOR::NONE || femOutput) return;
+
+  const auto* flowNodes = solver[FLOW_SOL]->GetNodes();
+  const auto& gradient = flowNodes->GetGradient_Primitive();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Primitive variables of the indicator, the velocity contributes all its components. ---*/
+
+  const auto idx = CPrimitiveIndices<unsigned long>(config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+                                                    config->GetNEMOProblem(), nDim, config->GetnSpecies());
+  vector<unsigned long> vars;
+  switch (config->GetKind_Adapt_Variable()) {
+    case ADAPT_VARIABLE::DENSITY: vars = {idx.Density()}; break;
+    case ADAPT_VARIABLE::PRESSURE: vars = {idx.Pressure()}; break;
+    case ADAPT_VARIABLE::TEMPERATURE: vars = {idx.Temperature()}; break;
+    case ADAPT_VARIABLE::VELOCITY:
+      for (auto iDim = 0u; iDim < nDim; ++iDim) vars.push_back(idx.Velocity() + iDim);
+      break;
+  }
+  for (const auto iVar : vars) {
+    if (iVar >= solver[FLOW_SOL]->GetnPrimVarGrad()) {
+      SU2_MPI::Error("The gradient of ADAPT_VARIABLE is not available in this solver.", CURRENT_FUNCTION);
+    }
+  }
+  const auto nVar = vars.size();
+
+  /*--- The Hessians are the Green-Gauss gradients of the primitive gradients, whose halos are up to date. ---*/
+
+  struct GradientField {
+    const CVectorOfMatrix& gradient;
+    const vector<unsigned long>& vars;
+    unsigned long nDim;
+    const su2double& operator() (unsigned long iPoint, unsigned long iVar) const {
+      return gradient(iPoint, vars[iVar / nDim], iVar % nDim);
+    }
+  };
+
+  CVectorOfMatrix hessian;
+  if (kind == ADAPT_INDICATOR::HESSIAN) {
+    hessian.resize(geometry->GetnPoint(), nVar * nDim, nDim);
+    const GradientField field{gradient, vars, nDim};
+    if (nDim == 2) {
+      detail::computeGradientsGreenGauss<2>(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry,
+                                            *config, field, 0, nVar * nDim, hessian);
+    } else {
+      detail::computeGradientsGreenGauss<3>(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry,
+                                            *config, field, 0, nVar * nDim, hessian);
+    }
+  }
+
+  /*--- Indicator, h |grad(u)| or h^2 |H(u)| with h the size of the dual cell. ---*/
+
+  adaptIndicator.resize(nPointDomain);
+  adaptFlag.assign(nPointDomain, 0);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const su2double volume = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+    const su2double h = pow(volume, 1.0 / nDim);
+    su2double norm = 0.0;
+    if (kind == ADAPT_INDICATOR::HESSIAN) {
+      for (auto iVar = 0ul; iVar < nVar * nDim; ++iVar)
+        for (auto iDim = 0u; iDim < nDim; ++iDim) norm += pow(hessian(iPoint, iVar, iDim), 2);
+      adaptIndicator[iPoint] = h * h * sqrt(norm);
+    } else {
+      for (const auto iVar : vars)
+        for (auto iDim = 0u; iDim < nDim; ++iDim) norm += pow(gradient(iPoint, iVar, iDim), 2);
+      adaptIndicator[iPoint] = h * sqrt(norm);
+    }
+  }
+
+  /*--- Fixed-fraction marking, the global thresholds are found by bisection of the global counts. ---*/
+
+  unsigned long nPointGlobal = 0;
+  SU2_MPI::Allreduce(&nPointDomain, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  passivedouble localMin = std::numeric_limits<passivedouble>::max(), localMax = 0.0;
+  for (const auto& eta : adaptIndicator) {
+    localMin = min(localMin, SU2_TYPE::GetValue(eta));
+    localMax = max(localMax, SU2_TYPE::GetValue(eta));
+  }
+  passivedouble globalMin = 0.0, globalMax = 0.0;
+  SU2_MPI::Allreduce(&localMin, &globalMin, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localMax, &globalMax, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  /*--- Largest (smallest) threshold for which at most nTarget points are above (below) it. ---*/
+  auto findThreshold = [&](unsigned long nTarget, bool above) {
+    auto count = [&](passivedouble threshold) {
+      unsigned long local = 0, global = 0;
+      for (const auto& eta : adaptIndicator) {
+        const auto val = SU2_TYPE::GetValue(eta);
+        local += above ? (val > threshold) : (val < threshold);
+      }
+      SU2_MPI::Allreduce(&local, &global, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      return global;
+    };
+    passivedouble lower = globalMin, upper = globalMax;
+    for (int iter = 0; iter < 64 && upper - lower > 1e-12 * upper; ++iter) {
+      const auto mid = 0.5 * (lower + upper);
+      if ((count(mid) > nTarget) == above) lower = mid;
+      else upper = mid;
+    }
+    return above ? upper : lower;
+  };
+
+  const auto nRefine = static_cast<unsigned long>(config->GetAdapt_Refine_Fraction() * nPointGlobal);
+  const auto nCoarsen = static_cast<unsigned long>(config->GetAdapt_Coarsen_Fraction() * nPointGlobal);
+
+  if (nRefine > 0) {
+    const auto threshold = findThreshold(nRefine, true);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      if (SU2_TYPE::GetValue(adaptIndicator[iPoint]) > threshold) adaptFlag[iPoint] = 1;
+  }
+  if (nCoarsen > 0) {
+    const auto threshold = findThreshold(nCoarsen, false);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      if (SU2_TYPE::GetValue(adaptIndicator[iPoint]) < threshold && adaptFlag[iPoint] == 0) adaptFlag[iPoint] = -1;
+  }
+}
+
+string CFlowOutput::TimeStatisticsFileName(const CConfig *config, const string& restartName, unsigned long timeIter) {
+  const auto fileName = config->GetFilename(restartName, "", timeIter);
+  string series;
+  unsigned long step;
+  if (CSU2TimeSeriesFileWriter::SplitStepName(fileName, series, step)) return series + "_statistics";
+  return fileName + "_statistics";
+}
+
+void CFlowOutput::WriteTimeStatistics(CConfig *config, CGeometry *geometry) {
+
+  if (!timeStatistics.IsInitialized()) return;
+
+  const auto fileName = TimeStatisticsFileName(config, restartFilename, curTimeIter);
+  const auto names = timeStatistics.GetStateNames();
+
+  CFVMDataSorter sorter(config, geometry, names);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (auto iField = 0ul; iField < names.size(); iField++) {
+      sorter.SetUnsortedData(iPoint, iField, timeStatistics.GetState(iField, iPoint));
+    }
+  }
+  sorter.SortOutputData();
+
+  CSU2BinaryFileWriter writer(&sorter);
+  writer.WriteData(fileName);
+
+  if (rank == MASTER_NODE) {
+    (*fileWritingTable) << "Time statistics" << fileName + CSU2BinaryFileWriter::fileExt;
+  }
+}
+
+void CFlowOutput::ReadTimeStatistics(const CConfig *config, CGeometry *geometry, CSolver **solver) {
+
+  const auto restartIter = config->GetRestart_Iter();
+  if (restartIter == 0) return;
+
+  const auto fileName = TimeStatisticsFileName(config, config->GetSolution_FileName(), restartIter - 1);
+
+  int exists = 0;
+  if (rank == MASTER_NODE) exists = ifstream(fileName + CSU2BinaryFileWriter::fileExt).good();
+  SU2_MPI::Bcast(&exists, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (!exists) {
+    if (rank == MASTER_NODE) {
+      cout << "No time statistics to continue (" << fileName << CSU2BinaryFileWriter::fileExt
+           << "), they start at the restart iteration." << endl;
+    }
+    return;
+  }
+
+  vector<string> names;
+  su2passivematrix data;
+  solver[FLOW_SOL]->Read_SU2_Restart_Fields(geometry, config, fileName, names, data);
+
+  /*--- The statistics must have the same layout and end just before the restart iteration. ---*/
+
+  const auto stateNames = timeStatistics.GetStateNames();
+  const auto nFields = stateNames.size();
+  const auto iLastIter = std::find(stateNames.begin(), stateNames.end(), "Stat_LastIter") - stateNames.begin();
+
+  unsigned long localNextIter = 0, nextIter = 0;
+  if (names == stateNames && geometry->GetnPointDomain() > 0) localNextIter = std::lround(data(0, iLastIter)) + 1;
+  SU2_MPI::Allreduce(&localNextIter, &nextIter, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  if (nextIter != restartIter) {
+    if (rank == MASTER_NODE) {
+      cout << "WARNING: The time statistics in " << fileName << CSU2BinaryFileWriter::fileExt
+           << " do not match the configuration or the restart iteration, they start at the restart iteration." << endl;
+    }
+    return;
+  }
+
+  /*--- Set the domain points, and communicate them to the halos. ---*/
+
+  CSysVector<su2double> halo(geometry->GetnPoint(), geometry->GetnPointDomain(), nFields, 0.0);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    for (auto iField = 0ul; iField < nFields; iField++) halo(iPoint, iField) = data(iPoint, iField);
+  }
+  CSysMatrixComms::Initiate(halo, geometry, config);
+  CSysMatrixComms::Complete(halo, geometry, config);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto iField = 0ul; iField < nFields; iField++) {
+      timeStatistics.SetState(iField, iPoint, SU2_TYPE::GetValue(halo(iPoint, iField)));
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Continuing the time statistics of " << timeStatistics.GetnSample() << " time steps." << endl;
   }
 }
 
@@ -26,12 +26,16 @@
  */
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/adt/CADTElemClass.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
+#include "../../include/output/filewriter/CXDMFFileWriter.hpp"
+#include "../../include/output/filewriter/CADIOS2FileWriter.hpp"
+#include "../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
 #include "../../include/output/filewriter/CSurfaceFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CSurfaceFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CParaviewFileWriter.hpp"
@@ -45,6 +49,13 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+constexpr int COutput::SamplingData::MAGIC;
+constexpr unsigned long COutput::SamplingData::NOT_FOUND;
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   rank(SU2_MPI::GetRank()),
@@ -170,14 +181,52 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   headerNeeded = false;
 
+  /*--- The files are written in a separate thread, which also calls MPI (on its own communicator, to
+   *    not interfere with the collectives of the solver), therefore full thread support is required. ---*/
+
+  asyncOutput = config->GetAsync_Output();
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  asyncOutput = false;
+#endif
+#ifdef HAVE_MPI
+  if (asyncOutput) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      asyncOutput = false;
+      if (rank == MASTER_NODE)
+        cout << "WARNING: ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (--thread_multiple), files are written synchronously." << endl;
+    } else {
+      MPI_Comm_dup(SU2_MPI::GetComm(), &asyncComm);
+    }
+  }
+#endif
+
+  /*--- MPI-IO settings of the binary writers. ---*/
+
+  CFileWriter::MPIIOSettings ioSettings;
+  ioSettings.cbNodes = config->GetMPIIO_CbNodes();
+  ioSettings.stripeCount = config->GetMPIIO_StripeCount();
+  ioSettings.stripeSize = config->GetMPIIO_StripeSize();
+  ioSettings.nSubfiles = config->GetMPIIO_Subfiles();
+  CFileWriter::SetMPIIOSettings(ioSettings);
+
 }
 
 COutput::~COutput() {
 
+  WaitForAsyncOutput(nullptr);
+#ifdef HAVE_MPI
+  if (asyncOutput) MPI_Comm_free(&asyncComm);
+#endif
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
   delete historyFileTable;
+  delete adios2Writer;
+  delete timeSeriesWriter;
+  if (sampling.file) fclose(sampling.file);
   delete volumeDataSorter;
   delete surfaceDataSorter;
 
@@ -190,6 +239,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PHASE_TIMER(OUTPUT);
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -229,6 +280,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
 
 void COutput::SetMultizoneHistoryOutput(COutput **output, CConfig **config, CConfig *driver_config, unsigned long TimeIter, unsigned long OuterIter){
 
+  SU2_PHASE_TIMER(OUTPUT);
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - driver_config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -265,6 +318,7 @@ void COutput::OutputScreenAndHistory(CConfig *config) {
 void COutput::SetupCustomHistoryOutput(const std::string& expression, CustomHistoryOutput& output) const {
   std::vector<std::string> symbols;
   output.expression = mel::Parse<passivedouble>(expression, symbols);
+  output.compiled.Compile(expression, symbols);
 
   output.symbolValues.reserve(symbols.size());
   for (const auto& symbol : symbols) {
@@ -329,12 +383,28 @@ void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_co
 
   /*--- Partition and sort the volume output data -- */
 
+  WaitForAsyncOutput(config);
   volumeDataSorter->SortOutputData();
 
 }
 
+void COutput::WaitForAsyncOutput(CConfig *config) {
+
+  if (!asyncWriter.joinable()) return;
+
+  asyncWriter.join();
+
+  if (config != nullptr && asyncBandwidth > 0.0) {
+    config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + asyncBandwidth);
+  }
+  asyncBandwidth = 0.0;
+}
+
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName){
 
+  /*--- The previous file may still be in the process of being written from the sorted data. ---*/
+  WaitForAsyncOutput(config);
+
   /*--- File writer that will later be used to write the file to disk. Created below in the "switch" ---*/
   CFileWriter *fileWriter = nullptr;
 
@@ -402,6 +472,22 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       if (!config->GetWrt_Restart_Overwrite())
         filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
 
+      /*--- Unsteady restarts can be appended to a time series, the writer keeps the last step for the deltas. ---*/
+
+      if (config->GetRestart_Time_Series()) {
+        string series;
+        unsigned long step;
+        if (CSU2TimeSeriesFileWriter::SplitStepName(fileName, series, step)) {
+          if (rank == MASTER_NODE) {
+            (*fileWritingTable) << "SU2 restart time series" << series + CSU2TimeSeriesFileWriter::fileExt;
+          }
+          if (timeSeriesWriter == nullptr)
+            timeSeriesWriter = new CSU2TimeSeriesFileWriter(volumeDataSorter, config->GetRestart_KeyFrame_Interval());
+          fileWriter = timeSeriesWriter;
+          break;
+        }
+      }
+
       LogOutputFiles("SU2 binary restart");
       fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
 
@@ -426,6 +512,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2MeshFileWriter::fileExtBinary;
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2MeshFileWriter(volumeDataSorter, config->GetiZone(), config->GetnZone(), true);
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
@@ -512,9 +617,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         if (!config->GetWrt_Volume_Overwrite())
           filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
 
-        /*--- Sort volume connectivity ---*/
+        /*--- Sort volume connectivity, the pieces of the ranks keep their own elements ---*/
 
-        volumeDataSorter->SortConnectivity(config, geometry, true);
+        volumeDataSorter->SortConnectivity(config, geometry, !config->GetMultiblock_Rank_Pieces());
 
         LogOutputFiles("Paraview Multiblock");
         fileWriter = new CParaviewVTMFileWriter(GetHistoryFieldValue("CUR_TIME"), config->GetiZone(), config->GetnZone());
@@ -706,11 +811,97 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::XDMF:
+
+      extension = CXDMFFileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("XDMF");
+      fileWriter = new CXDMFFileWriter(volumeDataSorter, config->GetXDMF_Compression(), config->GetXDMF_Lossy_Digits());
+
+      break;
+
+    case OUTPUT_TYPE::SURFACE_XDMF:
+
+      extension = CXDMFFileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+
+      if (!config->GetWrt_Surface_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      LogOutputFiles("XDMF surface");
+      fileWriter = new CXDMFFileWriter(surfaceDataSorter, config->GetXDMF_Compression(), config->GetXDMF_Lossy_Digits());
+
+      break;
+
+    case OUTPUT_TYPE::ADIOS2:
+
+      /*--- All outputs are steps of the same stream, opened with the name of the first one, the connectivity
+       *    is only sent once. Therefore the writer is kept and no copy with the iteration number is made. ---*/
+
+      extension = CADIOS2FileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("ADIOS2 (step)");
+      if (adios2Writer == nullptr)
+        adios2Writer = new CADIOS2FileWriter(volumeDataSorter, config->GetADIOS2_Engine(), config->GetADIOS2_Config_File());
+      adios2Writer->SetTimeIter(curTimeIter);
+      fileWriter = adios2Writer;
+
+      break;
+
     default:
       break;
   }
 
-  if (fileWriter != nullptr) {
+  /*--- Formats whose writers communicate only through the MPI-IO functions of CFileWriter can be written in the
+   *    background, from the sorted data, until the next modification of the sorters (see WaitForAsyncOutput). ---*/
+
+  const bool async = asyncOutput && (fileWriter != nullptr) && (fileWriter != timeSeriesWriter) &&
+                     (format == OUTPUT_TYPE::RESTART_BINARY || format == OUTPUT_TYPE::PARAVIEW_XML ||
+                      format == OUTPUT_TYPE::PARAVIEW_LEGACY_BINARY);
+
+  if (async) {
+
+    fileWriter->SetComm(asyncComm);
+    const bool restart = (format == OUTPUT_TYPE::RESTART_BINARY);
+
+    asyncWriter = std::thread([this, fileWriter, fileName, filename_iter, restart]() {
+      fileWriter->WriteData(fileName);
+      passivedouble BandWidth = SU2_TYPE::GetValue(fileWriter->GetBandwidth());
+      if (!filename_iter.empty()) {
+        fileWriter->WriteData(filename_iter);
+        BandWidth = (BandWidth + SU2_TYPE::GetValue(fileWriter->GetBandwidth())) / 2;
+      }
+      if (restart) asyncBandwidth = BandWidth;
+      delete fileWriter;
+    });
+
+    if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+      (*fileWritingTable) << " " << "(asynchronous)";
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    }
+
+  } else if (fileWriter != nullptr) {
 
     /*--- Write data to file ---*/
 
@@ -739,7 +930,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
     }
 
-    delete fileWriter;
+    if (fileWriter != adios2Writer && fileWriter != timeSeriesWriter) delete fileWriter;
 
   }
 
@@ -760,6 +951,8 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
+  SU2_PHASE_TIMER(OUTPUT);
+
   bool isFileWrite = false, dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
@@ -767,21 +960,30 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
   AllocateDataSorters(config, geometry);
 
+  /*--- Advance the time statistics (averages) once per time step, whether or not files are written. ---*/
+  if (config->GetTime_Domain()) {
+    UpdateTimeStatistics(config, geometry, solver_container);
+  }
+
+  /*--- Sample the volume output at probes, lines, planes, and markers, this does not use the sorters. ---*/
+  if (config->GetSampling() && iter % config->GetSample_Frequency() == 0) {
+    WriteSamples(config, geometry, solver_container);
+  }
+
   for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++) {
 
-    /*--- Collect the volume data from the solvers.
-     *  If time-domain is enabled, we also load the data although we don't output it,
-     *  since we might want to do time-averaging. ---*/
+    /*--- Collect the volume data from the solvers. ---*/
     const bool write_file = WriteVolumeOutput(config, iter, force_writing || cauchyTimeConverged, iFile);
+    if (!write_file) continue;
 
-    if ((write_file || config->GetTime_Domain()) && !dataIsLoaded) {
+    if (!dataIsLoaded) {
       LoadDataIntoSorter(config, geometry, solver_container);
       dataIsLoaded = true;
     }
-    if (!write_file) continue;
 
     /*--- Partition and sort the data --- */
 
+    WaitForAsyncOutput(config);
     volumeDataSorter->SortOutputData();
 
     if (rank == MASTER_NODE && !isFileWrite) {
@@ -795,6 +997,12 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
 
     WriteToFile(config, geometry, VolumeFiles[iFile]);
 
+    /*--- The time statistics are saved with the restarts, to continue them when restarting. ---*/
+
+    if (VolumeFiles[iFile] == OUTPUT_TYPE::RESTART_BINARY || VolumeFiles[iFile] == OUTPUT_TYPE::RESTART_ASCII) {
+      WriteTimeStatistics(config, geometry);
+    }
+
     /*--- Write any additonal files defined in the child class ----*/
 
     WriteAdditionalFiles(config, geometry, solver_container);
@@ -1446,6 +1654,8 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
 
   SetVolumeOutputFields(config);
 
+  SetCustomVolumeOutputFields(config);
+
   /*---Coordinates and solution groups must be always in the output.
    * If they are not requested, add them here. ---*/
 
@@ -1575,6 +1785,9 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
+    /*--- Fields that require a global pass over the mesh before they can be loaded point by point. ---*/
+    ComputeAdaptationIndicator(config, geometry, solver);
+
     for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
 
       /*--- Load the volume data into the data sorter. --- */
@@ -1585,6 +1798,9 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
     }
 
+    /*--- Custom outputs are evaluated for batches of points. ---*/
+    LoadCustomVolumeData(config, geometry, solver);
+
     /*--- Reset the offset cache and index --- */
     cachePosition = 0;
     fieldIndexCache.clear();
@@ -1615,39 +1831,336 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   }
 }
 
-void COutput::SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
+void COutput::PrepareSampling(CConfig *config, CGeometry *geometry) {
 
-  if (buildFieldIndexCache){
+  auto& smp = sampling;
+  smp.prepared = true;
 
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
+  /*--- Offsets of the sampled fields, they must be part of the volume output. ---*/
 
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
-        volumeDataSorter->SetUnsortedData(iPoint, Offset, value);
+  for (auto iField = 0u; iField < config->GetnSample_Fields(); iField++) {
+    const auto& name = config->GetSample_Field(iField);
+    const auto it = volumeOutput_Map.find(name);
+    if (it == volumeOutput_Map.end() || it->second.offset == -1) {
+      SU2_MPI::Error("Sampled field " + name + " is not part of the VOLUME_OUTPUT.", CURRENT_FUNCTION);
+    }
+    smp.fieldOffsets.push_back(it->second.offset);
+  }
+
+  /*--- Coordinates of the probes, and of the samples of the lines and planes (the same on all ranks). ---*/
+
+  vector<su2double> coords;
+  unsigned short nValues = 0;
+
+  const su2double* probes = config->GetSample_Probes(nValues);
+  if (nValues % nDim != 0) {
+    SU2_MPI::Error("SAMPLE_PROBES must have " + to_string(nDim) + " coordinates per probe.", CURRENT_FUNCTION);
+  }
+  coords.insert(coords.end(), probes, probes + nValues);
+
+  const su2double* lines = config->GetSample_Lines(nValues);
+  if (nValues % (2 * nDim + 1) != 0) {
+    SU2_MPI::Error("SAMPLE_LINES must have the start and end points, and the number of samples, of each line.",
+                   CURRENT_FUNCTION);
+  }
+  for (auto iLine = 0u; iLine < nValues; iLine += 2 * nDim + 1) {
+    const su2double* start = &lines[iLine];
+    const su2double* end = start + nDim;
+    const int nLine = SU2_TYPE::Int(end[nDim]);
+    if (nLine < 2) SU2_MPI::Error("The lines of SAMPLE_LINES need at least 2 samples.", CURRENT_FUNCTION);
+
+    for (int iSample = 0; iSample < nLine; iSample++) {
+      const su2double t = su2double(iSample) / (nLine - 1);
+      for (auto iDim = 0u; iDim < nDim; iDim++) coords.push_back(start[iDim] + t * (end[iDim] - start[iDim]));
+    }
+  }
+
+  const su2double* planes = config->GetSample_Planes(nValues);
+  if (nValues > 0 && nDim != 3) {
+    SU2_MPI::Error("SAMPLE_PLANES is only available for 3D problems, use SAMPLE_LINES in 2D.", CURRENT_FUNCTION);
+  }
+  if (nValues % 11 != 0) {
+    SU2_MPI::Error("SAMPLE_PLANES must have the origin, the two edge vectors, and the number of samples along "
+                   "each edge, of each plane.", CURRENT_FUNCTION);
+  }
+  for (auto iPlane = 0u; iPlane < nValues; iPlane += 11) {
+    const su2double* origin = &planes[iPlane];
+    const su2double* edgeU = origin + 3;
+    const su2double* edgeV = origin + 6;
+    const int nU = SU2_TYPE::Int(origin[9]);
+    const int nV = SU2_TYPE::Int(origin[10]);
+    if (nU < 2 || nV < 2) SU2_MPI::Error("The planes of SAMPLE_PLANES need at least 2 samples per edge.", CURRENT_FUNCTION);
+
+    for (int iV = 0; iV < nV; iV++) {
+      const su2double v = su2double(iV) / (nV - 1);
+      for (int iU = 0; iU < nU; iU++) {
+        const su2double u = su2double(iU) / (nU - 1);
+        for (auto iDim = 0u; iDim < 3; iDim++) coords.push_back(origin[iDim] + u * edgeU[iDim] + v * edgeV[iDim]);
       }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
     }
-  } else {
+  }
 
-    /*--- Use the offset cache for the access ---*/
+  const unsigned long nInterp = coords.size() / nDim;
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
-      volumeDataSorter->SetUnsortedData(iPoint, Offset, value);
+  /*--- Local points of the stencils, each is evaluated once. ---*/
+
+  vector<unsigned long> pointPosition(geometry->GetnPoint(), SamplingData::NOT_FOUND);
+  auto AddPoint = [&](unsigned long iPoint) {
+    if (pointPosition[iPoint] == SamplingData::NOT_FOUND) {
+      pointPosition[iPoint] = smp.points.size();
+      smp.points.push_back(iPoint);
     }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
+    return pointPosition[iPoint];
+  };
+  smp.stencilStart.push_back(0);
+
+  /*--- Find the elements of this rank that contain the interpolated samples, with an ADT of the local
+   *    elements (halos included, the samples are owned by the lowest rank that contains them). ---*/
+
+  vector<int> localOwner(nInterp, size), owner(nInterp);
+  vector<unsigned long> containingElem(nInterp);
+  vector<su2double> elemWeights(nInterp * 8);
+
+  if (nInterp > 0) {
+    vector<su2double> pointCoor(geometry->GetnPoint() * nDim);
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++) pointCoor[iPoint * nDim + iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+
+    vector<unsigned long> elemConn, elemIDs;
+    vector<unsigned short> VTK_TypeElem, markerIDs;
+    for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+      VTK_TypeElem.push_back(geometry->elem[iElem]->GetVTK_Type());
+      markerIDs.push_back(0);
+      elemIDs.push_back(iElem);
+      for (auto iNode = 0u; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+        elemConn.push_back(geometry->elem[iElem]->GetNode(iNode));
+    }
+    CADTElemClass elemADT(nDim, pointCoor, elemConn, VTK_TypeElem, markerIDs, elemIDs, false);
+
+    if (!elemADT.IsEmpty()) {
+      for (auto iSample = 0ul; iSample < nInterp; iSample++) {
+        unsigned short markerID;
+        int rankID;
+        su2double parCoor[3];
+        if (elemADT.DetermineContainingElement(&coords[iSample * nDim], markerID, containingElem[iSample], rankID,
+                                               parCoor, &elemWeights[iSample * 8])) {
+          localOwner[iSample] = rank;
+        }
+      }
+    }
+    SU2_MPI::Allreduce(localOwner.data(), owner.data(), nInterp, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  }
+
+  vector<passivedouble> ownedCoords;
+
+  for (auto iSample = 0ul; iSample < nInterp; iSample++) {
+    if (owner[iSample] != rank) continue;
+    const auto* elem = geometry->elem[containingElem[iSample]];
+    for (auto iNode = 0u; iNode < elem->GetnNodes(); iNode++) {
+      smp.stencilPoints.push_back(AddPoint(elem->GetNode(iNode)));
+      smp.stencilWeights.push_back(SU2_TYPE::GetValue(elemWeights[iSample * 8 + iNode]));
+    }
+    smp.stencilStart.push_back(smp.stencilPoints.size());
+    smp.ids.push_back(iSample);
+    for (auto iDim = 0u; iDim < nDim; iDim++) ownedCoords.push_back(SU2_TYPE::GetValue(coords[iSample * nDim + iDim]));
+  }
+
+  if (rank == MASTER_NODE) {
+    const auto nMissing = std::count(owner.begin(), owner.end(), size);
+    if (nMissing > 0) {
+      cout << "WARNING: " << nMissing << " sampled locations are outside the mesh, their values are NaN." << endl;
+    }
+  }
+
+  /*--- The vertices of the sampled markers (the domain ones), numbered by rank after the other samples.
+   *    The surface data is also evaluated at the vertices of solid walls. ---*/
+
+  vector<unsigned long> markerSamplePoints;
+  for (auto iSampleMarker = 0u; iSampleMarker < config->GetnSample_Markers(); iSampleMarker++) {
+    const auto& name = config->GetSample_Marker(iSampleMarker);
+    config->GetMarker_CfgFile_TagBound(name);  // Error if the marker does not exist.
+
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_TagBound(iMarker) != name) continue;
+      const bool wall = config->GetSolid_Wall(iMarker);
+
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+        const auto iRow = AddPoint(iPoint);
+        if (wall) {
+          smp.wallVertices.emplace_back(iMarker, iVertex);
+          smp.wallPoints.push_back(iRow);
+        }
+        markerSamplePoints.push_back(iRow);
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          ownedCoords.push_back(SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+      }
     }
   }
 
+  unsigned long nMarkerSamples = markerSamplePoints.size();
+  vector<unsigned long> allMarkerSamples(size);
+  SU2_MPI::Allgather(&nMarkerSamples, 1, MPI_UNSIGNED_LONG, allMarkerSamples.data(), 1, MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  unsigned long markerOffset = nInterp;
+  for (int iRank = 0; iRank < rank; iRank++) markerOffset += allMarkerSamples[iRank];
+
+  for (auto iSample = 0ul; iSample < nMarkerSamples; iSample++) {
+    smp.stencilPoints.push_back(markerSamplePoints[iSample]);
+    smp.stencilWeights.push_back(1.0);
+    smp.stencilStart.push_back(smp.stencilPoints.size());
+    smp.ids.push_back(markerOffset + iSample);
+  }
+
+  smp.nSamples = nInterp;
+  for (auto count : allMarkerSamples) smp.nSamples += count;
+
+  unsigned long nOwned = smp.ids.size();
+  SU2_MPI::Allreduce(&nOwned, &smp.maxOwned, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  if (smp.nSamples == 0) {
+    if (rank == MASTER_NODE) cout << "WARNING: There are no sampled locations, the samples are not written." << endl;
+    return;
+  }
+
+  /*--- The master gathers the owned samples of each rank (padded to the maximum number of owned samples)
+   *    once, to know where each sample is in the gathered values of every record, and writes the header. ---*/
+
+  smp.ids.resize(smp.maxOwned, SamplingData::NOT_FOUND);
+  ownedCoords.resize(smp.maxOwned * nDim, 0.0);
+
+  const bool master = (rank == MASTER_NODE);
+  vector<unsigned long> allIds(master ? size * smp.maxOwned : 0);
+  vector<passivedouble> allCoords(master ? size * smp.maxOwned * nDim : 0);
+
+  SU2_MPI::Gather(smp.ids.data(), smp.maxOwned, MPI_UNSIGNED_LONG, allIds.data(), smp.maxOwned, MPI_UNSIGNED_LONG,
+                  MASTER_NODE, SU2_MPI::GetComm());
+  CBaseMPIWrapper::Gather(ownedCoords.data(), smp.maxOwned * nDim, MPI_DOUBLE, allCoords.data(), smp.maxOwned * nDim,
+                          MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+  smp.ids.resize(nOwned);
+
+  if (!master) return;
+
+  smp.gatherIndex.assign(smp.nSamples, SamplingData::NOT_FOUND);
+  vector<passivedouble> sampleCoords(smp.nSamples * nDim);
+  for (auto iSample = 0ul; iSample < nInterp; iSample++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      sampleCoords[iSample * nDim + iDim] = SU2_TYPE::GetValue(coords[iSample * nDim + iDim]);
+  }
+  for (auto i = 0ul; i < allIds.size(); i++) {
+    if (allIds[i] == SamplingData::NOT_FOUND) continue;
+    smp.gatherIndex[allIds[i]] = i;
+    for (auto iDim = 0u; iDim < nDim; iDim++) sampleCoords[allIds[i] * nDim + iDim] = allCoords[i * nDim + iDim];
+  }
+
+  /*--- Header: magic number, number of fields, dimensions, and samples, the field names, and the coordinates. ---*/
+
+  const auto& fileName = config->GetSample_FileName();
+  smp.file = fopen(fileName.c_str(), "wb");
+  if (!smp.file) SU2_MPI::Error("Unable to open the samples file " + fileName, CURRENT_FUNCTION);
+
+  const int header[] = {SamplingData::MAGIC, static_cast<int>(smp.fieldOffsets.size()), static_cast<int>(nDim)};
+  const uint64_t nSamples = smp.nSamples;
+  fwrite(header, sizeof(int), 3, smp.file);
+  fwrite(&nSamples, sizeof(uint64_t), 1, smp.file);
+
+  for (auto iField = 0u; iField < config->GetnSample_Fields(); iField++) {
+    char name[CGNS_STRING_SIZE] = {};
+    strncpy(name, volumeOutput_Map.at(config->GetSample_Field(iField)).fieldName.c_str(), CGNS_STRING_SIZE - 1);
+    fwrite(name, sizeof(char), CGNS_STRING_SIZE, smp.file);
+  }
+  fwrite(sampleCoords.data(), sizeof(passivedouble), sampleCoords.size(), smp.file);
+  fflush(smp.file);
+
+  cout << "Sampling " << config->GetnSample_Fields() << " fields at " << smp.nSamples << " locations to "
+       << fileName << "." << endl;
 }
 
-su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint){
+void COutput::WriteSamples(CConfig *config, CGeometry *geometry, CSolver **solver_container) {
+
+  if (!sampling.prepared) PrepareSampling(config, geometry);
+
+  auto& smp = sampling;
+  if (smp.nSamples == 0) return;
+
+  /*--- Evaluate the volume (and wall) output at the points of the stencils, SetVolumeOutputValue stores the
+   *    values in the rows of "pointValues" while "sampleRow" is set. Fields that are not set remain NaN. ---*/
+
+  smp.pointValues.assign(smp.points.size() * nVolumeFields, std::numeric_limits<passivedouble>::quiet_NaN());
+
+  cachePosition = 0;
+  fieldIndexCache.clear();
+  curGetFieldIndex = 0;
+  fieldGetIndexCache.clear();
+
+  for (auto iRow = 0ul; iRow < smp.points.size(); iRow++) {
+    sampleRow = &smp.pointValues[iRow * nVolumeFields];
+    buildFieldIndexCache = fieldIndexCache.empty();
+    LoadVolumeData(config, geometry, solver_container, smp.points[iRow]);
+  }
+
+  cachePosition = 0;
+  fieldIndexCache.clear();
+  curGetFieldIndex = 0;
+  fieldGetIndexCache.clear();
+
+  for (auto iWall = 0ul; iWall < smp.wallVertices.size(); iWall++) {
+    const auto iRow = smp.wallPoints[iWall];
+    sampleRow = &smp.pointValues[iRow * nVolumeFields];
+    buildFieldIndexCache = fieldIndexCache.empty();
+    LoadSurfaceData(config, geometry, solver_container, smp.points[iRow], smp.wallVertices[iWall].first,
+                    smp.wallVertices[iWall].second);
+  }
+  sampleRow = nullptr;
+
+  cachePosition = 0;
+  fieldIndexCache.clear();
+  curGetFieldIndex = 0;
+  fieldGetIndexCache.clear();
+
+  /*--- Interpolate the owned samples and gather them on the master. ---*/
+
+  const auto nFields = smp.fieldOffsets.size();
+  vector<passivedouble> values(smp.maxOwned * nFields, 0.0);
+
+  for (auto iSample = 0ul; iSample < smp.ids.size(); iSample++) {
+    for (auto iField = 0ul; iField < nFields; iField++) {
+      su2double value = 0.0;
+      for (auto k = smp.stencilStart[iSample]; k < smp.stencilStart[iSample + 1]; k++) {
+        value += smp.stencilWeights[k] * smp.pointValues[smp.stencilPoints[k] * nVolumeFields + smp.fieldOffsets[iField]];
+      }
+      values[iSample * nFields + iField] = SU2_TYPE::GetValue(value);
+    }
+  }
+
+  vector<passivedouble> allValues(rank == MASTER_NODE ? size * values.size() : 0);
+  CBaseMPIWrapper::Gather(values.data(), values.size(), MPI_DOUBLE, allValues.data(), values.size(), MPI_DOUBLE,
+                          MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Record: time, outer, and inner iterations, physical time, and the fields of each sample. ---*/
+
+  vector<passivedouble> record(smp.nSamples * nFields, std::numeric_limits<passivedouble>::quiet_NaN());
+  for (auto iSample = 0ul; iSample < smp.nSamples; iSample++) {
+    const auto pos = smp.gatherIndex[iSample];
+    if (pos == SamplingData::NOT_FOUND) continue;
+    for (auto iField = 0ul; iField < nFields; iField++)
+      record[iSample * nFields + iField] = allValues[pos * nFields + iField];
+  }
+
+  const uint64_t iters[] = {curTimeIter, curOuterIter, curInnerIter};
+  const passivedouble time = SU2_TYPE::GetValue(GetHistoryFieldValue("CUR_TIME"));
+  fwrite(iters, sizeof(uint64_t), 3, smp.file);
+  fwrite(&time, sizeof(passivedouble), 1, smp.file);
+  fwrite(record.data(), sizeof(passivedouble), record.size(), smp.file);
+  fflush(smp.file);
+}
+
+void COutput::SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
 
   if (buildFieldIndexCache){
 
@@ -1657,9 +2170,10 @@ su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint
 
     if (volumeOutput_Map.count(name) > 0){
       const short Offset = volumeOutput_Map.at(name).offset;
-      fieldGetIndexCache.push_back(Offset);
+      fieldIndexCache.push_back(Offset);
       if (Offset != -1){
-        return volumeDataSorter->GetUnsortedData(iPoint, Offset);
+        if (sampleRow) sampleRow[Offset] = value;
+        else volumeDataSorter->SetUnsortedData(iPoint, Offset, value);
       }
     } else {
       SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
@@ -1668,22 +2182,19 @@ su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint
 
     /*--- Use the offset cache for the access ---*/
 
-    const short Offset = fieldGetIndexCache[curGetFieldIndex++];
-
-    if (curGetFieldIndex == fieldGetIndexCache.size()){
-      curGetFieldIndex = 0;
-    }
+    const short Offset = fieldIndexCache[cachePosition++];
     if (Offset != -1){
-      return volumeDataSorter->GetUnsortedData(iPoint, Offset);
+      if (sampleRow) sampleRow[Offset] = value;
+      else volumeDataSorter->SetUnsortedData(iPoint, Offset, value);
+    }
+    if (cachePosition == fieldIndexCache.size()){
+      cachePosition = 0;
     }
   }
 
-  return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
-
-  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
+su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint){
 
   if (buildFieldIndexCache){
 
@@ -1693,13 +2204,9 @@ void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint,
 
     if (volumeOutput_Map.count(name) > 0){
       const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
+      fieldGetIndexCache.push_back(Offset);
       if (Offset != -1){
-
-        const su2double old_value = volumeDataSorter->GetUnsortedData(iPoint, Offset);
-        const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
-
-        volumeDataSorter->SetUnsortedData(iPoint, Offset, new_value);
+        return sampleRow ? sampleRow[Offset] : volumeDataSorter->GetUnsortedData(iPoint, Offset);
       }
     } else {
       SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
@@ -1708,19 +2215,17 @@ void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint,
 
     /*--- Use the offset cache for the access ---*/
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
-
-      const su2double old_value = volumeDataSorter->GetUnsortedData(iPoint, Offset);
-      const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
+    const short Offset = fieldGetIndexCache[curGetFieldIndex++];
 
-      volumeDataSorter->SetUnsortedData(iPoint, Offset, new_value);
+    if (curGetFieldIndex == fieldGetIndexCache.size()){
+      curGetFieldIndex = 0;
     }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
+    if (Offset != -1){
+      return sampleRow ? sampleRow[Offset] : volumeDataSorter->GetUnsortedData(iPoint, Offset);
     }
   }
 
+  return 0.0;
 }
 
 void COutput::PostprocessHistoryData(CConfig *config){
@@ -2039,6 +2544,7 @@ void COutput::SetCustomOutputs(const CConfig* config) {
     {"MassFlowAvg", OperationType::MASSFLOW_AVG},
     {"MassFlowInt", OperationType::MASSFLOW_INT},
     {"Probe", OperationType::PROBE},
+    {"Volume", OperationType::VOLUME},
   };
   std::stringstream knownOps;
   for (const auto& item : opMap) knownOps << item.first << ", ";
@@ -2114,6 +2620,7 @@ void COutput::SetCustomOutputs(const CConfig* config) {
       output.type = type;
       output.func = std::move(func);
       output.expression = mel::Parse<passivedouble>(output.func, output.varSymbols);
+      output.compiled.Compile(output.func, output.varSymbols);
 #ifndef NDEBUG
       mel::Print(output.expression, output.varSymbols, std::cout);
 #endif
@@ -2122,6 +2629,8 @@ void COutput::SetCustomOutputs(const CConfig* config) {
         AddHistoryOutput(output.name, output.name, ScreenOutputFormat::SCIENTIFIC, "CUSTOM", "Custom output", HistoryFieldType::COEFFICIENT);
         break;
       }
+      /*--- Point-wise outputs are volume fields (see SetCustomVolumeOutputFields), not history outputs. ---*/
+      if (type == OperationType::VOLUME) break;
 
       /*--- Find the marker names. ---*/
       while (it != last && (*it == ' ' || *it == '}' || *it == '[')) ++it;
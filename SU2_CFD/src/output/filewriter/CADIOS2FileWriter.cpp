@@ -0,0 +1,159 @@
+/*!
+ * \file CADIOS2FileWriter.cpp
+ * \brief Filewriter class for ADIOS2 streams and BP files.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CADIOS2FileWriter.hpp"
+
+const string CADIOS2FileWriter::fileExt = ".bp";
+
+CADIOS2FileWriter::CADIOS2FileWriter(CParallelDataSorter* valDataSorter, const string& engineType,
+                                     const string& xmlFile)
+    : CFileWriter(valDataSorter, fileExt) {
+#ifdef HAVE_ADIOS2
+  try {
+#ifdef HAVE_MPI
+    adios.reset(xmlFile.empty() ? new adios2::ADIOS(comm) : new adios2::ADIOS(xmlFile, comm));
+#else
+    adios.reset(xmlFile.empty() ? new adios2::ADIOS() : new adios2::ADIOS(xmlFile));
+#endif
+    io = adios->DeclareIO("SU2");
+    if (!io.InConfigFile()) io.SetEngine(engineType);
+  } catch (const std::exception& e) {
+    SU2_MPI::Error(string("Unable to initialize ADIOS2: ") + e.what(), CURRENT_FUNCTION);
+  }
+#else
+  SU2_MPI::Error("SU2 was not compiled with ADIOS2 support (-Denable-adios2=true).", CURRENT_FUNCTION);
+#endif
+}
+
+CADIOS2FileWriter::~CADIOS2FileWriter() {
+#ifdef HAVE_ADIOS2
+  if (engine) engine.Close();
+#endif
+}
+
+void CADIOS2FileWriter::WriteData(string val_filename) {
+#ifdef HAVE_ADIOS2
+  if (!dataSorter->GetConnectivitySorted()) {
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  const auto& fieldNames = dataSorter->GetFieldNames();
+  const size_t nFields = fieldNames.size();
+  const size_t myPoint = dataSorter->GetnPoints();
+
+  usedTime = 0;
+  startTime = SU2_MPI::Wtime();
+
+  /*--- The variables are defined, and the stream opened, on the first call. The point data has the same
+   *    layout as the buffer of the sorter (point-major) so it is passed without copies. ---*/
+
+  if (!engine) {
+    io.DefineVariable<double>("Data", {dataSorter->GetnPointsGlobal(), nFields},
+                              {dataSorter->GetnPointCumulative(rank), 0}, {myPoint, nFields}, adios2::ConstantDims);
+    io.DefineVariable<uint64_t>("TimeIter");
+    io.DefineAttribute<string>("FieldNames", fieldNames.data(), fieldNames.size());
+    io.DefineAttribute<int>("nDim", dataSorter->GetnDim());
+
+    io.DefineVariable<int64_t>("connectivity", {dataSorter->GetnConnGlobal()},
+                               {dataSorter->GetnElemConnCumulative(rank)}, {dataSorter->GetnConn()});
+    io.DefineVariable<int64_t>("offsets", {dataSorter->GetnElemGlobal()},
+                               {dataSorter->GetnElemCumulative(rank)}, {dataSorter->GetnElem()});
+    io.DefineVariable<uint8_t>("types", {dataSorter->GetnElemGlobal()},
+                               {dataSorter->GetnElemCumulative(rank)}, {dataSorter->GetnElem()});
+
+    try {
+      engine = io.Open(val_filename + fileExt, adios2::Mode::Write);
+    } catch (const std::exception& e) {
+      SU2_MPI::Error("Unable to open the ADIOS2 stream " + val_filename + fileExt + ": " + e.what(), CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The deferred puts are only consumed by EndStep, the buffers must outlive it. ---*/
+
+  vector<int64_t> connBuf, offsetBuf;
+  vector<uint8_t> typeBuf;
+
+  engine.BeginStep();
+
+  engine.Put(io.InquireVariable<double>("Data"), dataSorter->GetData());
+  if (rank == MASTER_NODE) {
+    const uint64_t iter = timeIter;
+    engine.Put(io.InquireVariable<uint64_t>("TimeIter"), iter, adios2::Mode::Sync);
+  }
+  unsigned long myBytes = myPoint * nFields * sizeof(double);
+
+  /*--- The mesh does not change between steps, same layout as the Paraview XML writer. ---*/
+
+  if (!meshWritten) {
+    const unsigned long myElem = dataSorter->GetnElem();
+    connBuf.resize(dataSorter->GetnConn());
+    offsetBuf.resize(myElem);
+    typeBuf.resize(myElem);
+
+    unsigned long iStorage = 0, iElemID = 0;
+
+    auto copyToBuffer = [&](GEO_TYPE type, unsigned short nPoints) {
+      for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); iElem++) {
+        for (unsigned short iNode = 0; iNode < nPoints; iNode++) {
+          connBuf[iStorage + iNode] = int64_t(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1);
+        }
+        iStorage += nPoints;
+        typeBuf[iElemID] = type;
+        offsetBuf[iElemID++] = int64_t(iStorage + dataSorter->GetnElemConnCumulative(rank));
+      }
+    };
+    copyToBuffer(LINE, N_POINTS_LINE);
+    copyToBuffer(TRIANGLE, N_POINTS_TRIANGLE);
+    copyToBuffer(QUADRILATERAL, N_POINTS_QUADRILATERAL);
+    copyToBuffer(TETRAHEDRON, N_POINTS_TETRAHEDRON);
+    copyToBuffer(HEXAHEDRON, N_POINTS_HEXAHEDRON);
+    copyToBuffer(PRISM, N_POINTS_PRISM);
+    copyToBuffer(PYRAMID, N_POINTS_PYRAMID);
+
+    engine.Put(io.InquireVariable<int64_t>("connectivity"), connBuf.data());
+    engine.Put(io.InquireVariable<int64_t>("offsets"), offsetBuf.data());
+    engine.Put(io.InquireVariable<uint8_t>("types"), typeBuf.data());
+
+    myBytes += connBuf.size() * sizeof(int64_t) + myElem * (sizeof(int64_t) + sizeof(uint8_t));
+    meshWritten = true;
+  }
+
+  engine.EndStep();
+
+  stopTime = SU2_MPI::Wtime();
+  usedTime = stopTime - startTime;
+
+  /*--- Bandwidth of the data handed to the engine by all ranks. ---*/
+
+  unsigned long totalBytes = 0;
+  SU2_MPI::Allreduce(&myBytes, &totalBytes, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+  fileSize = totalBytes;
+  bandwidth = fileSize / (1.0e6) / usedTime;
+#else
+  SU2_MPI::Error("SU2 was not compiled with ADIOS2 support (-Denable-adios2=true).", CURRENT_FUNCTION);
+#endif
+}
@@ -103,6 +103,8 @@ void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
 
+  if (connectivitySorted && linearSortedConn == val_sort) return;
+
   nElemPerType.fill(0);
 
   SortVolumetricConnectivity(config, geometry, TRIANGLE,      val_sort);
@@ -115,6 +117,7 @@ void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool
   SetTotalElements();
 
   connectivitySorted = true;
+  linearSortedConn = val_sort;
 
 }
 
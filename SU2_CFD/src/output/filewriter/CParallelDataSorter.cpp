@@ -51,6 +51,8 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   nSends = 0;
   nRecvs = 0;
 
+  connectivitySorted = false;
+
   nLocalPointsBeforeSort  = 0;
   nGlobalPointBeforeSort = 0;
 
@@ -330,6 +332,74 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
 }
 
+vector<unsigned long> CParallelDataSorter::GetHaloNodes() const {
+
+  const unsigned long begNode = GetNodeBegin(rank);
+  const unsigned long endNode = begNode + nPoints;
+
+  vector<unsigned long> haloNodes;
+
+  for (const auto type : {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nodesPerElem = nPointsOfElementType(type);
+    for (unsigned long iElem = 0; iElem < GetnElem(type); ++iElem) {
+      for (unsigned short iNode = 0; iNode < nodesPerElem; ++iNode) {
+        const auto node = GetElemConnectivity(type, iElem, iNode);
+        if (node <= begNode || endNode < node) haloNodes.push_back(node);
+      }
+    }
+  }
+  sort(haloNodes.begin(), haloNodes.end());
+  haloNodes.erase(unique(haloNodes.begin(), haloNodes.end()), haloNodes.end());
+
+  return haloNodes;
+}
+
+vector<passivedouble> CParallelDataSorter::GatherHaloData(const vector<unsigned long>& haloNodes) const {
+
+  const int nFields = GlobalField_Counter;
+
+  /*--- Each rank owns a consecutive range of nodes, hence the sorted halo nodes are grouped by owner. ---*/
+
+  vector<int> nNodeRecv(size, 0), nNodeSend(size, 0);
+  for (auto node : haloNodes) ++nNodeRecv[FindProcessor(node - 1)];
+
+  SU2_MPI::Alltoall(nNodeRecv.data(), 1, MPI_INT, nNodeSend.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> recvDispl(size + 1, 0), sendDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    recvDispl[iRank + 1] = recvDispl[iRank] + nNodeRecv[iRank];
+    sendDispl[iRank + 1] = sendDispl[iRank] + nNodeSend[iRank];
+  }
+
+  /*--- Send the nodes we need, receive the nodes other ranks need from us. ---*/
+
+  vector<unsigned long> requested(max(1, sendDispl[size]));
+  vector<unsigned long> needed(haloNodes);
+  if (needed.empty()) needed.resize(1);
+
+  SU2_MPI::Alltoallv(needed.data(), nNodeRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     requested.data(), nNodeSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<passivedouble> sendData(max(1, sendDispl[size] * nFields));
+  const auto begNode = GetNodeBegin(rank);
+  for (int iNode = 0; iNode < sendDispl[size]; ++iNode) {
+    const auto iPoint = requested[iNode] - begNode - 1;
+    for (int iField = 0; iField < nFields; ++iField) sendData[iNode * nFields + iField] = GetData(iField, iPoint);
+  }
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nNodeRecv[iRank] *= nFields;  recvDispl[iRank] *= nFields;
+    nNodeSend[iRank] *= nFields;  sendDispl[iRank] *= nFields;
+  }
+  vector<passivedouble> haloData(max<size_t>(1, haloNodes.size() * nFields));
+
+  CBaseMPIWrapper::Alltoallv(sendData.data(), nNodeSend.data(), sendDispl.data(), MPI_DOUBLE,
+                             haloData.data(), nNodeRecv.data(), recvDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+  haloData.resize(haloNodes.size() * nFields);
+  return haloData;
+}
+
 unsigned long CParallelDataSorter::GetElemConnectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const {
 
   switch (type) {
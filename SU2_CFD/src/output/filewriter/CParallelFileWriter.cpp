@@ -29,12 +29,15 @@
 
 #include "../../../include/output/filewriter/CFileWriter.hpp"
 
+CFileWriter::MPIIOSettings CFileWriter::ioSettings;
+
 CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(std::move(valFileExt)),
   dataSorter(valDataSorter){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  comm = SU2_MPI::GetComm();
 
   fileSize = 0.0;
   bandwidth = 0.0;
@@ -46,6 +49,7 @@ CFileWriter::CFileWriter(string valFileExt):
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
+  comm = SU2_MPI::GetComm();
 
   fileSize = 0.0;
   bandwidth = 0.0;
@@ -61,6 +65,32 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
   startTime = SU2_MPI::Wtime();
 
+  if (subfile >= 0) {
+
+    /*--- The ranks of a subfile are consecutive, hence their chunks form one block of the file. ---*/
+
+    unsigned long blockOffset = 0, blockSize = 0;
+    MPI_Allreduce(&offsetInBytes, &blockOffset, 1, MPI_UNSIGNED_LONG, MPI_MIN, fileComm);
+    MPI_Allreduce(&sizeInBytes, &blockSize, 1, MPI_UNSIGNED_LONG, MPI_SUM, fileComm);
+
+    MPI_Datatype filetype;
+    MPI_Type_contiguous(int(sizeInBytes), MPI_BYTE, &filetype);
+    MPI_Type_commit(&filetype);
+    MPI_File_set_view(fhw, subfileDisp + offsetInBytes - blockOffset, MPI_BYTE, filetype,
+                      (char*)"native", MPI_INFO_NULL);
+    int ierr = MPI_File_write_all(fhw, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_Type_free(&filetype);
+
+    AddSubfileBlock(disp + blockOffset, blockSize);
+    disp     += totalSizeInBytes;
+    fileSize += sizeInBytes;
+
+    stopTime = SU2_MPI::Wtime();
+    usedTime += stopTime - startTime;
+
+    return (ierr == MPI_SUCCESS);
+  }
+
   MPI_Datatype filetype;
 
   /*--- Prepare to write the actual data ---*/
@@ -117,6 +147,26 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
 
   int ierr = MPI_SUCCESS;
 
+  if (subfile >= 0) {
+
+    /*--- The block goes to the subfile of the group of the writing rank. ---*/
+
+    if (GetSubfileOfRank(processor) == subfile) {
+      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+      if (rank == processor) {
+        ierr = MPI_File_write_at(fhw, subfileDisp, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+        fileSize += sizeInBytes;
+      }
+      AddSubfileBlock(disp, sizeInBytes);
+    }
+    disp += sizeInBytes;
+
+    stopTime = SU2_MPI::Wtime();
+    usedTime += stopTime - startTime;
+
+    return (ierr == MPI_SUCCESS);
+  }
+
   /*--- Reset the file view. ---*/
 
   MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
@@ -157,6 +207,8 @@ bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
 #ifdef HAVE_MPI
 
+  if (subfile >= 0) return WriteMPIBinaryData(str.c_str(), str.size()*sizeof(char), processor);
+
   startTime = SU2_MPI::Wtime();
 
   int ierr = MPI_SUCCESS;
@@ -207,22 +259,63 @@ bool CFileWriter::OpenMPIFile(string val_filename){
   int ierr;
   disp     = 0.0;
 
+  /*--- Hints for the collective buffering and the striping of the file. ---*/
+
+  MPI_Info info;
+  MPI_Info_create(&info);
+  if (ioSettings.cbNodes > 0) {
+    MPI_Info_set(info, (char*)"romio_cb_write", (char*)"enable");
+    MPI_Info_set(info, (char*)"cb_nodes", (char*)to_string(ioSettings.cbNodes).c_str());
+  }
+  if (ioSettings.stripeCount > 0) {
+    MPI_Info_set(info, (char*)"striping_factor", (char*)to_string(ioSettings.stripeCount).c_str());
+  }
+  if (ioSettings.stripeSize > 0) {
+    MPI_Info_set(info, (char*)"striping_unit", (char*)to_string(ioSettings.stripeSize).c_str());
+    MPI_Info_set(info, (char*)"cb_buffer_size", (char*)to_string(ioSettings.stripeSize).c_str());
+  }
+
+  /*--- With subfiling, groups of consecutive ranks write their own file. ---*/
+
+  int commRank = 0;
+  MPI_Comm_rank(comm, &commRank);
+  MPI_Comm_size(comm, &nCommRank);
+  nSubfile = static_cast<int>(min<unsigned long>(ioSettings.nSubfiles, nCommRank));
+  subfile = -1;
+  fileComm = comm;
+
+  if (nSubfile > 1) {
+    subfile = GetSubfileOfRank(commRank);
+    MPI_Comm_split(comm, subfile, commRank, &fileComm);
+    subfileDisp = 0;
+    subfileBlocks.clear();
+    subfileName = val_filename;
+
+    /*--- A previous (complete) file of the same name would be mistaken for the output. ---*/
+    if (commRank == 0) MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
+
+    val_filename += "." + to_string(subfile);
+  }
+
   /*--- All ranks open the file using MPI. Here, we try to open the file with
    exclusive so that an error is generated if the file exists. We always want
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+  ierr = MPI_File_open(fileComm, val_filename.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                       MPI_INFO_NULL, &fhw);
+                       info, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
-    if (rank == 0)
+    int fileRank = 0;
+    MPI_Comm_rank(fileComm, &fileRank);
+    if (fileRank == 0)
       MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+    ierr = MPI_File_open(fileComm, val_filename.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
-                         MPI_INFO_NULL, &fhw);
+                         info, &fhw);
   }
+  MPI_Info_free(&info);
 
   /*--- Error check opening the file. ---*/
 
@@ -252,6 +345,12 @@ bool CFileWriter::CloseMPIFile(){
   /*--- All ranks close the file after writing. ---*/
 
   MPI_File_close(&fhw);
+
+  if (subfile >= 0) {
+    WriteSubfileIndex();
+    MPI_Comm_free(&fileComm);
+    subfile = -1;
+  }
 #else
   fclose(fhw);
 #endif
@@ -260,7 +359,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+                     MPI_DOUBLE, MPI_SUM, comm);
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -269,3 +368,53 @@ bool CFileWriter::CloseMPIFile(){
   return true;
 }
 
+#ifdef HAVE_MPI
+void CFileWriter::AddSubfileBlock(unsigned long offset, unsigned long sizeInBytes) {
+
+  int fileRank = 0;
+  MPI_Comm_rank(fileComm, &fileRank);
+  if (fileRank == 0 && sizeInBytes > 0) {
+    subfileBlocks.push_back(offset);
+    subfileBlocks.push_back(sizeInBytes);
+    subfileBlocks.push_back(subfileDisp);
+  }
+  subfileDisp += sizeInBytes;
+}
+
+void CFileWriter::WriteSubfileIndex() {
+
+  /*--- Gather the blocks of all subfiles on the first rank. ---*/
+
+  int commRank = 0;
+  MPI_Comm_rank(comm, &commRank);
+  const int commSize = nCommRank;
+
+  int nLocal = subfileBlocks.size();
+  vector<int> nBlock(commSize), displ(commSize + 1, 0);
+  MPI_Gather(&nLocal, 1, MPI_INT, nBlock.data(), 1, MPI_INT, 0, comm);
+  for (int iRank = 0; iRank < commSize; ++iRank) displ[iRank + 1] = displ[iRank] + nBlock[iRank];
+
+  vector<unsigned long> blocks(max(1, displ[commSize]));
+  MPI_Gatherv(subfileBlocks.data(), nLocal, MPI_UNSIGNED_LONG, blocks.data(), nBlock.data(),
+              displ.data(), MPI_UNSIGNED_LONG, 0, comm);
+
+  if (commRank != 0) return;
+
+  /*--- Header with the number of subfiles and the size of the file, then one line per block with the
+   *    subfile, the offset in the file, the size, and the offset in the subfile. ---*/
+
+  const auto baseName = subfileName.substr(subfileName.find_last_of('/') + 1);
+
+  ofstream index(subfileName + ".idx");
+  index << "SU2_SUBFILES " << nSubfile << " " << disp << "\n";
+  for (int iRank = 0; iRank < commSize; ++iRank) {
+    for (int i = displ[iRank]; i < displ[iRank + 1]; i += 3) {
+      index << baseName << "." << GetSubfileOfRank(iRank) << " "
+            << blocks[i] << " " << blocks[i + 1] << " " << blocks[i + 2] << "\n";
+    }
+  }
+  if (!index.good()) {
+    SU2_MPI::Error(string("Unable to write the index of the subfiles of ") + subfileName, CURRENT_FUNCTION);
+  }
+}
+#endif
@@ -87,7 +87,8 @@ void CParaviewVTMFileWriter::WriteData(string val_filename){
 
 }
 
-void CParaviewVTMFileWriter::AddDataset(const string& foldername, string name, const string& file, CParallelDataSorter* dataSorter){
+void CParaviewVTMFileWriter::AddDataset(const string& foldername, string name, const string& file,
+                                        CParallelDataSorter* dataSorter, bool rankPieces){
 
   /*--- Construct the full file name incl. folder ---*/
   /*--- Note that the folder name is simply the filename ---*/
@@ -96,12 +97,26 @@ void CParaviewVTMFileWriter::AddDataset(const string& foldername, string name, c
 
   /*--- Create an XML writer and dump data into file ---*/
 
-  CParaviewXMLFileWriter XMLWriter(dataSorter);
-  XMLWriter.WriteData(fullFilename);
+  rankPieces = rankPieces && (size > 1);
 
-  /*--- Add the dataset to the vtm file ---*/
+  CParaviewXMLFileWriter XMLWriter(dataSorter, rankPieces);
+  XMLWriter.WriteData(fullFilename);
 
-  AddDataset(std::move(name), fullFilename + CParaviewXMLFileWriter::fileExt);
+  /*--- Add the dataset to the vtm file, the files of the ranks as the pieces of one dataset ---*/
+
+  if (rankPieces) {
+    if (rank == MASTER_NODE) {
+      output << "<Piece name=\"" << name << "\">" << endl;
+      for (int iRank = 0; iRank < size; iRank++) {
+        output << "<DataSet index=\"" << iRank << "\" file=\""
+               << CParaviewXMLFileWriter::GetPieceFilename(fullFilename, iRank) + CParaviewXMLFileWriter::fileExt
+               << "\"/>" << endl;
+      }
+      output << "</Piece>" << endl;
+    }
+  } else {
+    AddDataset(std::move(name), fullFilename + CParaviewXMLFileWriter::fileExt);
+  }
 
   /*--- Update the bandwidth ---*/
 
@@ -136,7 +151,7 @@ void CParaviewVTMFileWriter::WriteFolderData(const string& foldername, CConfig *
   StartBlock(std::move(multiZoneHeaderString));
 
   StartBlock("Internal");
-  AddDataset(foldername,"Internal", "Internal", volumeDataSorter);
+  AddDataset(foldername,"Internal", "Internal", volumeDataSorter, config->GetMultiblock_Rank_Pieces());
   EndBlock();
 
   /*--- Open a block for the boundary ---*/
@@ -30,8 +30,8 @@
 
 const string CParaviewXMLFileWriter::fileExt = ".vtu";
 
-CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter) :
-  CFileWriter(valDataSorter, fileExt){
+CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter, bool valRankPiece) :
+  CFileWriter(valDataSorter, fileExt), rankPiece(valRankPiece && (size > 1)){
 
   /* Check for big endian. We have to swap bytes otherwise.
    * Since size of character is 1 byte when the character pointer
@@ -66,6 +66,39 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   char str_buf[255];
 
+  /*--- For a rank piece, the nodes of other ranks referenced by the local elements (halo nodes)
+   are appended to the local nodes, and each rank writes its file independently. ---*/
+
+  vector<unsigned long> haloNodes;
+  vector<passivedouble> haloData;
+  const auto globalComm = comm;
+
+  if (rankPiece) {
+    haloNodes = dataSorter->GetHaloNodes();
+    haloData = dataSorter->GatherHaloData(haloNodes);
+    val_filename = GetPieceFilename(val_filename, rank);
+#ifdef HAVE_MPI
+    SetComm(MPI_COMM_SELF);
+#endif
+  }
+  headerRank = rankPiece ? rank : MASTER_NODE;
+
+  const unsigned long nOwnedPoint = dataSorter->GetnPoints();
+  const unsigned long begNode = dataSorter->GetNodeBegin(rank);
+
+  auto getData = [&](unsigned short iField, unsigned long iPoint) {
+    if (iPoint < nOwnedPoint) return dataSorter->GetData(iField, iPoint);
+    return haloData[(iPoint - nOwnedPoint) * fieldNames.size() + iField];
+  };
+
+  /*--- Zero-based index of a (1-based) global node number of the connectivity in this file. ---*/
+
+  auto getIndex = [&](unsigned long node) {
+    if (!rankPiece) return int(node - 1);
+    if (begNode < node && node <= begNode + nOwnedPoint) return int(node - begNode - 1);
+    return int(nOwnedPoint + (lower_bound(haloNodes.begin(), haloNodes.end(), node) - haloNodes.begin()));
+  };
+
   OpenMPIFile(val_filename);
 
   dataOffset = 0;
@@ -77,8 +110,8 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   unsigned long myPoint, GlobalPoint;
 
-  GlobalPoint = dataSorter->GetnPointsGlobal();
-  myPoint     = dataSorter->GetnPoints();
+  myPoint     = nOwnedPoint + haloNodes.size();
+  GlobalPoint = rankPiece ? myPoint : dataSorter->GetnPointsGlobal();
 
   /*--- Compute our local number of elements, the required storage,
    and reduce the total number of elements and storage globally. ---*/
@@ -95,35 +128,41 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   myElem            = dataSorter->GetnElem();
   myElemStorage     = dataSorter->GetnConn();
-  GlobalElem        = dataSorter->GetnElemGlobal();
-  GlobalElemStorage = dataSorter->GetnConnGlobal();
+  GlobalElem        = rankPiece ? myElem : dataSorter->GetnElemGlobal();
+  GlobalElemStorage = rankPiece ? myElemStorage : dataSorter->GetnConnGlobal();
+
+  /*--- Offsets of the data of this rank in the arrays of the file. ---*/
+
+  const unsigned long pointOffset    = rankPiece ? 0 : dataSorter->GetnPointCumulative(rank);
+  const unsigned long elemOffset     = rankPiece ? 0 : dataSorter->GetnElemCumulative(rank);
+  const unsigned long elemConnOffset = rankPiece ? 0 : dataSorter->GetnElemConnCumulative(rank);
 
   /* Write the ASCII XML header. Note that we use the appended format for the data,
   * which means that all data is appended at the end of the file in one binary blob.
   */
 
   if (!bigEndian){
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", headerRank);
   } else {
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", headerRank);
   }
 
-  WriteMPIString("<UnstructuredGrid>\n", MASTER_NODE);
+  WriteMPIString("<UnstructuredGrid>\n", headerRank);
 
   SPRINTF(str_buf, "<Piece NumberOfPoints=\"%i\" NumberOfCells=\"%i\">\n",
           SU2_TYPE::Int(GlobalPoint), SU2_TYPE::Int(GlobalElem));
 
-  WriteMPIString(std::string(str_buf), MASTER_NODE);
-  WriteMPIString("<Points>\n", MASTER_NODE);
+  WriteMPIString(std::string(str_buf), headerRank);
+  WriteMPIString("<Points>\n", headerRank);
   AddDataArray(VTKDatatype::FLOAT32, "", NCOORDS, myPoint*NCOORDS, GlobalPoint*NCOORDS);
-  WriteMPIString("</Points>\n", MASTER_NODE);
-  WriteMPIString("<Cells>\n", MASTER_NODE);
+  WriteMPIString("</Points>\n", headerRank);
+  WriteMPIString("<Cells>\n", headerRank);
   AddDataArray(VTKDatatype::INT32, "connectivity", 1, myElemStorage, GlobalElemStorage);
   AddDataArray(VTKDatatype::INT32, "offsets", 1, myElem, GlobalElem);
   AddDataArray(VTKDatatype::UINT8, "types", 1, myElem, GlobalElem);
-  WriteMPIString("</Cells>\n", MASTER_NODE);
+  WriteMPIString("</Cells>\n", headerRank);
 
-  WriteMPIString("<PointData>\n", MASTER_NODE);
+  WriteMPIString("<PointData>\n", headerRank);
 
   /*--- Adjust container start location to avoid point coords. ---*/
 
@@ -177,13 +216,13 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
     }
 
   }
-  WriteMPIString("</PointData>\n", MASTER_NODE);
-  WriteMPIString("</Piece>\n", MASTER_NODE);
-  WriteMPIString("</UnstructuredGrid>\n", MASTER_NODE);
+  WriteMPIString("</PointData>\n", headerRank);
+  WriteMPIString("</Piece>\n", headerRank);
+  WriteMPIString("</UnstructuredGrid>\n", headerRank);
 
   /*--- Now write all the data we have previously defined into the binary section of the file ---*/
 
-  WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
+  WriteMPIString("<AppendedData encoding=\"raw\">\n_", headerRank);
 
   /*--- Load/write the 1D buffer of point coordinates. Note that we
    always have 3 coordinate dimensions, even for 2D problems. ---*/
@@ -194,14 +233,14 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
       if (nDim == 2 && iDim == 2) {
         dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
       } else {
-        auto val = (float)dataSorter->GetData(iDim, iPoint);
+        auto val = (float)getData(iDim, iPoint);
         dataBufferFloat[iPoint*NCOORDS + iDim] = val;
       }
     }
   }
 
   WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
-                 dataSorter->GetnPointCumulative(rank)*NCOORDS);
+                 pointOffset*NCOORDS);
 
   /*--- Load/write 1D buffers for the connectivity of each element type. ---*/
 
@@ -213,10 +252,10 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
   auto copyToBuffer = [&](GEO_TYPE type, unsigned long nElem, unsigned short nPoints){
     for (iElem = 0; iElem < nElem; iElem++) {
       for (iNode = 0; iNode < nPoints; iNode++){
-        connBuf[iStorage+iNode] = int(dataSorter->GetElemConnectivity(type, iElem, iNode)-1);
+        connBuf[iStorage+iNode] = getIndex(dataSorter->GetElemConnectivity(type, iElem, iNode));
       }
       iStorage += nPoints;
-      offsetBuf[iElemID++] = int(iStorage + dataSorter->GetnElemConnCumulative(rank));
+      offsetBuf[iElemID++] = int(iStorage + elemConnOffset);
     }
   };
 
@@ -228,9 +267,8 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
   copyToBuffer(PRISM,         nParallel_Pris, N_POINTS_PRISM);
   copyToBuffer(PYRAMID,       nParallel_Pyra, N_POINTS_PYRAMID);
 
-  WriteDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
-                 dataSorter->GetnElemConnCumulative(rank));
-  WriteDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  WriteDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage, elemConnOffset);
+  WriteDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, elemOffset);
 
   /*--- Load/write the cell type for all elements in the file. ---*/
 
@@ -245,7 +283,7 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
   std::fill(typeIter, typeIter+nParallel_Pris, PRISM);         typeIter += nParallel_Pris;
   std::fill(typeIter, typeIter+nParallel_Pyra, PYRAMID);       typeIter += nParallel_Pyra;
 
-  WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, elemOffset);
 
   /*--- Loop over all variables that have been registered in the output. ---*/
 
@@ -285,14 +323,14 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
           if (nDim == 2 && iDim == 2) {
             dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
           } else {
-            val = (float)dataSorter->GetData(VarCounter+iDim,iPoint);
+            val = (float)getData(VarCounter+iDim,iPoint);
             dataBufferFloat[iPoint*NCOORDS + iDim] = val;
           }
         }
       }
 
       WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
-                     dataSorter->GetnPointCumulative(rank)*NCOORDS);
+                     pointOffset*NCOORDS);
 
       VarCounter++;
 
@@ -303,23 +341,33 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
        This will be replaced with a derived data type most likely. ---*/
 
       for (iPoint = 0; iPoint < myPoint; iPoint++) {
-        auto val = (float)dataSorter->GetData(VarCounter,iPoint);
+        auto val = (float)getData(VarCounter,iPoint);
         dataBufferFloat[iPoint] = val;
       }
 
-      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
-                     dataSorter->GetnPointCumulative(rank));
+      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint, pointOffset);
 
       VarCounter++;
     }
 
   }
 
-  WriteMPIString("</AppendedData>\n", MASTER_NODE);
-  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+  WriteMPIString("</AppendedData>\n", headerRank);
+  WriteMPIString("</VTKFile>\n", headerRank);
 
   CloseMPIFile();
 
+  if (rankPiece) {
+
+    /*--- Report the total size of the pieces, written in the time of the slowest rank. ---*/
+
+    SetComm(globalComm);
+    su2double myFileSize = fileSize, myTime = usedTime;
+    SU2_MPI::Allreduce(&myFileSize, &fileSize, 1, MPI_DOUBLE, MPI_SUM, comm);
+    SU2_MPI::Allreduce(&myTime, &usedTime, 1, MPI_DOUBLE, MPI_MAX, comm);
+    bandwidth = fileSize/(1.0e6)/usedTime;
+  }
+
 }
 
 void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
@@ -339,7 +387,7 @@ void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsign
 
   /*--- Only the master node writes the total size in bytes as unsigned long in front of the array data ---*/
 
-  if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), MASTER_NODE)){
+  if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), headerRank)){
     SU2_MPI::Error("Writing array size failed", CURRENT_FUNCTION);
   }
 
@@ -381,7 +429,7 @@ void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
                  string(" Name=") + name +
                  string(" NumberOfComponents= ") + nComp +
                  string(" offset=") + offsetStr +
-                 string(" format=\"appended\"/>\n"), MASTER_NODE);
+                 string(" format=\"appended\"/>\n"), headerRank);
 
   dataOffset += totalByteSize + sizeof(size_t);
 
@@ -27,15 +27,23 @@
 
 #include "../../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/geometry/meshreader/SU2BinaryMesh.hpp"
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::fileExtBinary = ".su2b";
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(valDataSorter, valBinary ? fileExtBinary : fileExt), iZone(valiZone), nZone(valnZone),
+   binary(valBinary) {}
 
 void CSU2MeshFileWriter::WriteData(string val_filename) {
 
+  if (binary) {
+    WriteBinaryData(val_filename);
+    return;
+  }
+
   ofstream output_file;
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
@@ -253,3 +261,171 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
 
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 }
+
+void CSU2MeshFileWriter::WriteBinaryData(const string& val_filename) {
+
+  if (nZone > 1) {
+    SU2_MPI::Error("The SU2 binary mesh format does not support multiple zones.", CURRENT_FUNCTION);
+  }
+
+  const uint64_t nDim = dataSorter->GetnDim();
+  const uint64_t nPointGlobal = dataSorter->GetnPointsGlobal();
+
+  /*--- Coordinates of the points of this rank. ---*/
+
+  vector<passivedouble> coords(dataSorter->GetnPoints() * nDim);
+  for (auto iPoint = 0ul; iPoint < dataSorter->GetnPoints(); iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coords[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  /*--- Elements of this rank, [VTK type, nodes...], in the same order as the ASCII format
+   *    (the connectivity of the data sorter is 1-based). ---*/
+
+  vector<uint64_t> elemIndex, elemConn;
+
+  auto addElements = [&](GEO_TYPE type, unsigned short nPoints) {
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elemIndex.push_back(elemConn.size());
+      elemConn.push_back(type);
+      for (auto iNode = 0u; iNode < nPoints; ++iNode)
+        elemConn.push_back(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1);
+    }
+  };
+  addElements(TRIANGLE, N_POINTS_TRIANGLE);
+  addElements(QUADRILATERAL, N_POINTS_QUADRILATERAL);
+  addElements(TETRAHEDRON, N_POINTS_TETRAHEDRON);
+  addElements(HEXAHEDRON, N_POINTS_HEXAHEDRON);
+  addElements(PRISM, N_POINTS_PRISM);
+  addElements(PYRAMID, N_POINTS_PYRAMID);
+
+  /*--- Offsets of this rank in the global element arrays. ---*/
+
+  unsigned long myCounts[2] = {elemIndex.size(), elemConn.size()};
+  vector<unsigned long> allCounts(2 * size);
+  SU2_MPI::Allgather(myCounts, 2, MPI_UNSIGNED_LONG, allCounts.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  uint64_t elemOffset = 0, connOffset = 0, nElemGlobal = 0, connSizeGlobal = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) {
+      elemOffset += allCounts[2 * iRank];
+      connOffset += allCounts[2 * iRank + 1];
+    }
+    nElemGlobal += allCounts[2 * iRank];
+    connSizeGlobal += allCounts[2 * iRank + 1];
+  }
+  for (auto& pos : elemIndex) pos += connOffset;
+
+  /*--- Header, the layout is fully determined by the global sizes. ---*/
+
+  uint64_t header[SU2BinaryMesh::HEADER_SIZE] = {};
+  header[SU2BinaryMesh::MAGIC] = SU2BinaryMesh::MagicNumber;
+  header[SU2BinaryMesh::VERSION] = SU2BinaryMesh::Version;
+  header[SU2BinaryMesh::NDIM] = nDim;
+  header[SU2BinaryMesh::NPOINT] = nPointGlobal;
+  header[SU2BinaryMesh::NELEM] = nElemGlobal;
+  header[SU2BinaryMesh::CONN_SIZE] = connSizeGlobal;
+  header[SU2BinaryMesh::POINT_OFFSET] = sizeof(header);
+  header[SU2BinaryMesh::ELEM_INDEX_OFFSET] = header[SU2BinaryMesh::POINT_OFFSET] + nPointGlobal * nDim * sizeof(passivedouble);
+  header[SU2BinaryMesh::ELEM_CONN_OFFSET] = header[SU2BinaryMesh::ELEM_INDEX_OFFSET] + (nElemGlobal + 1) * sizeof(uint64_t);
+  header[SU2BinaryMesh::MARKER_OFFSET] = header[SU2BinaryMesh::ELEM_CONN_OFFSET] + connSizeGlobal * sizeof(uint64_t);
+
+  /*--- The master reads the markers from the boundary file (see the ASCII format). ---*/
+
+  vector<SU2BinaryMesh::MarkerEntry> markers;
+  vector<uint64_t> markerConn;
+
+  if (rank == MASTER_NODE) {
+
+    const string str = "boundary.dat";
+
+    ifstream input_file(str);
+    if (!input_file.is_open()) {
+      SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+    }
+
+    string text_line;
+    while (getline(input_file, text_line)) {
+
+      if (text_line.find("NMARK=",0) == string::npos) continue;
+
+      text_line.erase(0,6);
+      const auto nMarker_ = atoi(text_line.c_str());
+
+      for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
+
+        string Marker_Tag;
+        getline(input_file, text_line);
+        istringstream(text_line.substr(11)) >> Marker_Tag;
+
+        getline(input_file, text_line);
+        const unsigned long nElem_Bound_ = atoi(text_line.substr(13).c_str());
+
+        /*--- SEND_TO= ---*/
+        getline(input_file, text_line);
+
+        SU2BinaryMesh::MarkerEntry marker{};
+        if (Marker_Tag.size() >= size_t(SU2BinaryMesh::MarkerNameSize)) {
+          SU2_MPI::Error(string("Marker name too long for SU2 binary mesh: ") + Marker_Tag, CURRENT_FUNCTION);
+        }
+        strncpy(marker.name, Marker_Tag.c_str(), SU2BinaryMesh::MarkerNameSize - 1);
+        marker.nElem = nElem_Bound_;
+        marker.connOffset = markerConn.size();
+
+        for (auto iElem_Bound = 0ul; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+
+          unsigned short VTK_Type;
+          bound_line >> VTK_Type;
+          if (VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) {
+            SU2_MPI::Error(string("Unsupported boundary element in marker ") + Marker_Tag, CURRENT_FUNCTION);
+          }
+          markerConn.push_back(VTK_Type);
+
+          for (auto iNode = 0u; iNode < nPointsOfElementType(VTK_Type); iNode++) {
+            unsigned long node;
+            bound_line >> node;
+            markerConn.push_back(node);
+          }
+        }
+        marker.connSize = markerConn.size() - marker.connOffset;
+        markers.push_back(marker);
+      }
+      break;
+    }
+
+    /*--- Convert the offsets of the surface connectivity to absolute positions. ---*/
+
+    for (auto& marker : markers) {
+      marker.connOffset = header[SU2BinaryMesh::MARKER_OFFSET] + markers.size() * sizeof(SU2BinaryMesh::MarkerEntry) +
+                          marker.connOffset * sizeof(uint64_t);
+    }
+  }
+
+  unsigned long nMarker = markers.size();
+  SU2_MPI::Bcast(&nMarker, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  header[SU2BinaryMesh::NMARKER] = nMarker;
+
+  /*--- Write the file, in the order of the layout. ---*/
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  WriteMPIBinaryDataAll(coords.data(), coords.size() * sizeof(passivedouble),
+                        nPointGlobal * nDim * sizeof(passivedouble),
+                        dataSorter->GetnPointCumulative(rank) * nDim * sizeof(passivedouble));
+
+  WriteMPIBinaryDataAll(elemIndex.data(), elemIndex.size() * sizeof(uint64_t), nElemGlobal * sizeof(uint64_t),
+                        elemOffset * sizeof(uint64_t));
+  WriteMPIBinaryData(&connSizeGlobal, sizeof(uint64_t), MASTER_NODE);
+
+  WriteMPIBinaryDataAll(elemConn.data(), elemConn.size() * sizeof(uint64_t), connSizeGlobal * sizeof(uint64_t),
+                        connOffset * sizeof(uint64_t));
+
+  WriteMPIBinaryData(markers.data(), nMarker * sizeof(SU2BinaryMesh::MarkerEntry), MASTER_NODE);
+  WriteMPIBinaryData(markerConn.data(), markerConn.size() * sizeof(uint64_t), MASTER_NODE);
+
+  CloseMPIFile();
+}
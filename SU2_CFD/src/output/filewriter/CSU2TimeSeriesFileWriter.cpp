@@ -0,0 +1,403 @@
+/*!
+ * \file CSU2TimeSeriesFileWriter.cpp
+ * \brief Filewriter class for time series of SU2 restarts.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
+#include <algorithm>
+#include <cstdio>
+
+const string CSU2TimeSeriesFileWriter::fileExt = ".dts";
+
+CSU2TimeSeriesFileWriter::CSU2TimeSeriesFileWriter(CParallelDataSorter* valDataSorter, unsigned long keyFrames)
+    : CFileWriter(valDataSorter, fileExt), keyFrameInterval(std::max(keyFrames, 1ul)) {}
+
+bool CSU2TimeSeriesFileWriter::SplitStepName(const string& name, string& series, unsigned long& step) {
+  const auto pos = name.find_last_of('_');
+  if (pos == string::npos || pos + 1 == name.size()) return false;
+  if (name.find_first_not_of("0123456789", pos + 1) != string::npos) return false;
+  series = name.substr(0, pos);
+  step = std::stoul(name.substr(pos + 1));
+  return true;
+}
+
+void CSU2TimeSeriesFileWriter::EncodeBlock(const passivedouble* data, const passivedouble* ref, unsigned long nVal,
+                                           vector<uint8_t>& out) {
+  /*--- Number of significant bytes of each value as nibbles, followed by those bytes (low to high). ---*/
+
+  const auto nibbles = out.size();
+  out.resize(nibbles + (nVal + 1) / 2, 0);
+
+  for (auto iVal = 0ul; iVal < nVal; ++iVal) {
+    uint64_t x, r = 0;
+    memcpy(&x, &data[iVal], sizeof(uint64_t));
+    if (ref) memcpy(&r, &ref[iVal], sizeof(uint64_t));
+    x ^= r;
+
+    unsigned short nBytes = 8;
+    while (nBytes > 0 && (x >> (8 * (nBytes - 1))) == 0) --nBytes;
+
+    out[nibbles + iVal / 2] |= uint8_t(nBytes << (4 * (iVal % 2)));
+    for (unsigned short iByte = 0; iByte < nBytes; ++iByte) out.push_back(uint8_t(x >> (8 * iByte)));
+  }
+}
+
+bool CSU2TimeSeriesFileWriter::DecodeBlock(const uint8_t* in, unsigned long size, unsigned long nVal,
+                                           passivedouble* data) {
+  unsigned long pos = (nVal + 1) / 2;
+  if (pos > size) return false;
+
+  for (auto iVal = 0ul; iVal < nVal; ++iVal) {
+    const unsigned short nBytes = (in[iVal / 2] >> (4 * (iVal % 2))) & 0xF;
+    if (nBytes > 8 || pos + nBytes > size) return false;
+
+    uint64_t x = 0, r;
+    for (unsigned short iByte = 0; iByte < nBytes; ++iByte) x |= uint64_t(in[pos++]) << (8 * iByte);
+
+    memcpy(&r, &data[iVal], sizeof(uint64_t));
+    x ^= r;
+    memcpy(&data[iVal], &x, sizeof(uint64_t));
+  }
+  return pos == size;
+}
+
+void CSU2TimeSeriesFileWriter::SeekFile(uint64_t offset) {
+#ifdef HAVE_MPI
+  disp = offset;
+#else
+  fseek(fhw, offset, SEEK_SET);
+#endif
+}
+
+void CSU2TimeSeriesFileWriter::OpenSeries(const string& fileName) {
+  const auto& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nFields = fieldNames.size();
+
+  /*--- The master checks if the file can be appended to, i.e. if it is a series of the same data. ---*/
+
+  unsigned long state[2] = {0, 0};  // {append, offset of the index}
+
+  if (rank == MASTER_NODE) {
+    index.clear();
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file) {
+      int header[5] = {0};
+      uint64_t info[2] = {0, 0};
+      bool ok = fread(header, sizeof(int), 5, file) == 5 && header[0] == MAGIC &&
+                static_cast<unsigned long>(header[1]) == nFields &&
+                static_cast<unsigned long>(header[2]) == dataSorter->GetnPointsGlobal();
+      if (ok) {
+        fseek(file, HeaderSize(nFields) - sizeof(info), SEEK_SET);
+        ok = fread(info, sizeof(uint64_t), 2, file) == 2;
+      }
+      if (ok) {
+        index.resize(info[1]);
+        fseek(file, info[0], SEEK_SET);
+        ok = fread(index.data(), sizeof(IndexEntry), index.size(), file) == index.size();
+      }
+      fclose(file);
+      if (ok) {
+        state[0] = 1;
+        state[1] = info[0];
+      } else {
+        index.clear();
+        cout << "WARNING: " << fileName << " is not a compatible time series, it is replaced." << endl;
+      }
+    }
+    if (!state[0]) remove(fileName.c_str());
+  }
+  SU2_MPI::Bcast(state, 2, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+
+  appendOffset = state[0] ? state[1] : HeaderSize(nFields);
+  previous.clear();
+  stepsSinceKey = 0;
+
+  if (state[0]) return;
+
+  /*--- New file, write the header. ---*/
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(comm, fileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw))
+    SU2_MPI::Error("Unable to open file " + fileName, CURRENT_FUNCTION);
+#else
+  fhw = fopen(fileName.c_str(), "wb");
+  if (!fhw) SU2_MPI::Error("Unable to open file " + fileName, CURRENT_FUNCTION);
+#endif
+  SeekFile(0);
+
+  const int header[5] = {MAGIC, int(nFields), int(dataSorter->GetnPointsGlobal()), 0, 0};
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (const auto& name : fieldNames) {
+    strncpy(str_buf, name.c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE, MASTER_NODE);
+  }
+  const uint64_t info[2] = {appendOffset, 0};
+  WriteMPIBinaryData(info, sizeof(info), MASTER_NODE);
+
+  CloseMPIFile();
+}
+
+void CSU2TimeSeriesFileWriter::WriteData(string val_filename) {
+  string series;
+  unsigned long step = 0;
+  if (!SplitStepName(val_filename, series, step)) {
+    SU2_MPI::Error("The name " + val_filename + " has no time iteration, it cannot be a step of a time series.",
+                   CURRENT_FUNCTION);
+  }
+  const string fileName = series + fileExt;
+
+  if (series != seriesName) {
+    OpenSeries(fileName);
+    seriesName = series;
+  }
+
+  const unsigned long nFields = dataSorter->GetFieldNames().size();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const passivedouble* data = dataSorter->GetData();
+
+  /*--- Deltas with respect to the previous step, except for the full frames. ---*/
+
+  const bool full = previous.empty() || ++stepsSinceKey >= keyFrameInterval;
+  if (full) stepsSinceKey = 0;
+
+  vector<uint8_t> buffer;
+  vector<uint64_t> table;
+  const auto firstPoint = dataSorter->GetnPointCumulative(rank);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint += BLOCK_SIZE) {
+    const auto nBlockPoint = std::min(BLOCK_SIZE, nPoint - iPoint);
+    const auto start = buffer.size();
+    EncodeBlock(&data[iPoint * nFields], full ? nullptr : &previous[iPoint * nFields], nBlockPoint * nFields, buffer);
+    table.insert(table.end(), {firstPoint + iPoint, nBlockPoint, start, buffer.size() - start});
+  }
+  const unsigned long myBlocks = table.size() / 4, myBytes = buffer.size();
+
+  /*--- Offsets of the table and data of each rank, the offsets of the blocks are made relative to the record. ---*/
+
+  unsigned long mySizes[2] = {myBlocks, myBytes};
+  vector<unsigned long> sizes(2 * size);
+  SU2_MPI::Allgather(mySizes, 2, MPI_UNSIGNED_LONG, sizes.data(), 2, MPI_UNSIGNED_LONG, comm);
+
+  unsigned long blockOffset = 0, byteOffset = 0, nBlocks = 0, totalBytes = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank < rank) {
+      blockOffset += sizes[2 * iRank];
+      byteOffset += sizes[2 * iRank + 1];
+    }
+    nBlocks += sizes[2 * iRank];
+    totalBytes += sizes[2 * iRank + 1];
+  }
+  const uint64_t tableBytes = nBlocks * 4 * sizeof(uint64_t);
+  for (auto iBlock = 0ul; iBlock < myBlocks; ++iBlock) table[4 * iBlock + 2] += sizeof(uint64_t) + tableBytes + byteOffset;
+
+  const uint64_t recordSize = sizeof(uint64_t) + tableBytes + totalBytes;
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(comm, fileName.c_str(), MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw))
+    SU2_MPI::Error("Unable to open file " + fileName, CURRENT_FUNCTION);
+#else
+  fhw = fopen(fileName.c_str(), "r+b");
+  if (!fhw) SU2_MPI::Error("Unable to open file " + fileName, CURRENT_FUNCTION);
+#endif
+  fileSize = 0.0;
+  usedTime = 0;
+
+  /*--- The record replaces the old index, which is written again after it. ---*/
+
+  SeekFile(appendOffset);
+  const uint64_t nBlocksRecord = nBlocks;
+  bool ok = WriteMPIBinaryData(&nBlocksRecord, sizeof(uint64_t), MASTER_NODE);
+  ok &= WriteMPIBinaryDataAll(table.data(), table.size() * sizeof(uint64_t), tableBytes,
+                              blockOffset * 4 * sizeof(uint64_t));
+  ok &= WriteMPIBinaryDataAll(buffer.data(), myBytes, totalBytes, byteOffset);
+
+  if (rank == MASTER_NODE) {
+    index.push_back({step, full ? NO_REF : index.size() - 1, appendOffset, recordSize});
+  }
+  const uint64_t indexOffset = appendOffset + recordSize;
+
+  SeekFile(indexOffset);
+  ok &= WriteMPIBinaryData(index.data(), index.size() * sizeof(IndexEntry), MASTER_NODE);
+
+  /*--- Finally the header is updated to point to the new index. ---*/
+
+  SeekFile(HeaderSize(nFields) - 2 * sizeof(uint64_t));
+  const uint64_t info[2] = {indexOffset, index.size()};
+  ok &= WriteMPIBinaryData(info, sizeof(info), MASTER_NODE);
+
+  if (!ok) SU2_MPI::Error("Writing " + fileName + " failed.", CURRENT_FUNCTION);
+
+  CloseMPIFile();
+
+  appendOffset = indexOffset;
+  previous.assign(data, data + nPoint * nFields);
+}
+
+void CSU2TimeSeriesFileWriter::ReadHeader(const string& fileName, unsigned long& nPointFile,
+                                          vector<string>& fieldNames) {
+  const int rank = SU2_MPI::GetRank();
+  int header[5] = {0};
+  vector<char> names;
+
+  if (rank == MASTER_NODE) {
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file) SU2_MPI::Error("Unable to open SU2 restart time series " + fileName, CURRENT_FUNCTION);
+    if (fread(header, sizeof(int), 5, file) != 5 || header[0] != MAGIC)
+      SU2_MPI::Error("File " + fileName + " is not an SU2 restart time series.", CURRENT_FUNCTION);
+    names.resize(header[1] * CGNS_STRING_SIZE);
+    if (fread(names.data(), 1, names.size(), file) != names.size())
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    fclose(file);
+  }
+  SU2_MPI::Bcast(header, 5, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  names.resize(header[1] * CGNS_STRING_SIZE);
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  nPointFile = header[2];
+  fieldNames.clear();
+  for (int iField = 0; iField < header[1]; ++iField) {
+    char str_buf[CGNS_STRING_SIZE];
+    memcpy(str_buf, &names[iField * CGNS_STRING_SIZE], CGNS_STRING_SIZE);
+    str_buf[CGNS_STRING_SIZE - 1] = '\0';
+    fieldNames.emplace_back(str_buf);
+  }
+}
+
+void CSU2TimeSeriesFileWriter::ReadStep(const string& fileName, unsigned long step,
+                                        const vector<unsigned long>& points, unsigned long& nFields,
+                                        vector<passivedouble>& data) {
+  const int rank = SU2_MPI::GetRank();
+
+  /*--- The master finds the chain of records (from the full frame to the step), {offset, size} of each. ---*/
+
+  unsigned long header[2] = {0, 0};  // {number of fields, length of the chain}
+  vector<unsigned long> chain;
+
+  if (rank == MASTER_NODE) {
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file) SU2_MPI::Error("Unable to open SU2 restart time series " + fileName, CURRENT_FUNCTION);
+
+    int fileHeader[5] = {0};
+    uint64_t info[2] = {0, 0};
+    bool ok = fread(fileHeader, sizeof(int), 5, file) == 5 && fileHeader[0] == MAGIC;
+    if (ok) {
+      fseek(file, HeaderSize(fileHeader[1]) - sizeof(info), SEEK_SET);
+      ok = fread(info, sizeof(uint64_t), 2, file) == 2;
+    }
+    vector<IndexEntry> fileIndex(ok ? info[1] : 0);
+    if (ok) {
+      fseek(file, info[0], SEEK_SET);
+      ok = fread(fileIndex.data(), sizeof(IndexEntry), fileIndex.size(), file) == fileIndex.size();
+    }
+    fclose(file);
+    if (!ok) SU2_MPI::Error("Error reading the index of " + fileName, CURRENT_FUNCTION);
+
+    /*--- The last record of a step is the valid one (steps can be written again after a restart). ---*/
+
+    auto iRecord = NO_REF;
+    for (auto i = fileIndex.size(); i > 0; --i) {
+      if (fileIndex[i - 1].step == step) {
+        iRecord = i - 1;
+        break;
+      }
+    }
+    if (iRecord == NO_REF) {
+      SU2_MPI::Error("Time iteration " + std::to_string(step) + " is not in " + fileName, CURRENT_FUNCTION);
+    }
+    for (; iRecord != NO_REF; iRecord = fileIndex[iRecord].ref) {
+      chain.insert(chain.begin(), {fileIndex[iRecord].offset, fileIndex[iRecord].size});
+    }
+    header[0] = fileHeader[1];
+    header[1] = chain.size() / 2;
+  }
+  SU2_MPI::Bcast(header, 2, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  chain.resize(2 * header[1]);
+  SU2_MPI::Bcast(chain.data(), chain.size(), MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  nFields = header[0];
+
+  /*--- Each rank decodes the blocks that contain its points. ---*/
+
+  FILE* file = fopen(fileName.c_str(), "rb");
+  if (!file) SU2_MPI::Error("Unable to open SU2 restart time series " + fileName, CURRENT_FUNCTION);
+
+  vector<uint64_t> table, blockTable;
+  vector<unsigned long> blocks;
+  vector<vector<passivedouble> > values;
+  vector<uint8_t> buffer;
+
+  for (auto iRecord = 0ul; iRecord < header[1]; ++iRecord) {
+    const auto offset = chain[2 * iRecord];
+    uint64_t nBlocks = 0;
+    fseek(file, offset, SEEK_SET);
+    bool ok = fread(&nBlocks, sizeof(uint64_t), 1, file) == 1;
+    blockTable.resize(4 * nBlocks);
+    ok = ok && fread(blockTable.data(), sizeof(uint64_t), blockTable.size(), file) == blockTable.size();
+    if (!ok) SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+
+    if (iRecord == 0) {
+      /*--- Blocks are sorted by their first point. ---*/
+      table = blockTable;
+      for (const auto iPoint : points) {
+        unsigned long lo = 0, hi = nBlocks;
+        while (hi - lo > 1) {
+          const auto mid = (lo + hi) / 2;
+          if (table[4 * mid] <= iPoint) lo = mid; else hi = mid;
+        }
+        if (blocks.empty() || blocks.back() != lo) blocks.push_back(lo);
+      }
+      values.resize(blocks.size());
+      for (auto i = 0ul; i < blocks.size(); ++i) values[i].assign(table[4 * blocks[i] + 1] * nFields, 0.0);
+    } else {
+      /*--- All records of a chain are written by the same ranks. ---*/
+      for (auto iBlock = 0ul; iBlock < nBlocks && blockTable.size() == table.size(); ++iBlock) {
+        ok = ok && blockTable[4 * iBlock] == table[4 * iBlock] && blockTable[4 * iBlock + 1] == table[4 * iBlock + 1];
+      }
+      if (!ok || blockTable.size() != table.size())
+        SU2_MPI::Error("Inconsistent records in " + fileName, CURRENT_FUNCTION);
+    }
+
+    for (auto i = 0ul; i < blocks.size(); ++i) {
+      const auto* entry = &blockTable[4 * blocks[i]];
+      buffer.resize(entry[3]);
+      fseek(file, offset + entry[2], SEEK_SET);
+      ok = fread(buffer.data(), 1, buffer.size(), file) == buffer.size() &&
+           DecodeBlock(buffer.data(), buffer.size(), values[i].size(), values[i].data());
+      if (!ok) SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+  }
+  fclose(file);
+
+  /*--- Gather the values of the points. ---*/
+
+  data.resize(points.size() * nFields);
+  unsigned long i = 0;
+  for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) {
+    while (points[iPoint] >= table[4 * blocks[i]] + table[4 * blocks[i] + 1]) ++i;
+    const auto* src = &values[i][(points[iPoint] - table[4 * blocks[i]]) * nFields];
+    std::copy(src, src + nFields, &data[iPoint * nFields]);
+  }
+}
@@ -57,6 +57,18 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   int *Local_Halo = nullptr;
   int iNode, count;
 
+  /*--- The surface points and the renumbered connectivity only depend on the mesh, once they
+   are known only the data of the surface points is extracted from the sorted volume data. ---*/
+
+  if (surfaceRenumbered) {
+    for (iPoint = 0; iPoint < nPoints; iPoint++) {
+      for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+        dataBuffer[iPoint*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfPointIndex[iPoint]);
+      }
+    }
+    return;
+  }
+
 #ifdef HAVE_MPI
   SU2_MPI::Request *send_req, *recv_req;
   SU2_MPI::Status status;
@@ -393,13 +405,16 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfPointIndex.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
 
-      /*--- Save the global index values for CSV output. ---*/
+      /*--- Save the global index values for CSV output, and the local
+       index for extracting the data in later calls. ---*/
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
+      surfPointIndex.push_back(iPoint);
 
       /*--- Increment total number of surface points found locally. ---*/
 
@@ -1065,6 +1080,8 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] nElem_Flag;
   delete [] Local_Halo;
 
+  surfaceRenumbered = true;
+
 }
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
@@ -1089,6 +1106,11 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
 
+  /*--- The connectivity of these markers is already sorted (and renumbered), it does not
+   change for a fixed mesh. ---*/
+
+  if (connectivitySorted && markerList == sortedMarkers) return;
+
   /*--- Sort volumetric grid connectivity. ---*/
 
   nElemPerType.fill(0);
@@ -1100,6 +1122,8 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
   SetTotalElements();
 
   connectivitySorted = true;
+  surfaceRenumbered = false;
+  sortedMarkers = markerList;
 
 }
 
@@ -91,7 +91,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   if (err) cout << "Error initializing Tecplot parallel output." << endl;
 #endif
 
-  /*--- Define the zone(s). For 2D, and for 3D surfaces, each rank outputs a separate zone. ---*/
+  /*--- Define the zone. In parallel it is partitioned, each rank outputs the partition of its sorted data. ---*/
 
   int64_t num_nodes;
   int64_t num_cells;
@@ -140,16 +140,20 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   unsigned long nParallel_Line = dataSorter->GetnElem(LINE);
 
   unsigned short iVar;
-  NodePartitioner node_partitioner(num_nodes, size);
+  NodePartitioner node_partitioner(dataSorter, size);
   std::set<unsigned long> halo_nodes;
   vector<unsigned long> sorted_halo_nodes;
   vector<passivedouble> halo_var_data;
   vector<int> num_nodes_to_receive(size, 0);
   vector<int> values_to_receive_displacements(size);
 
-  if (zone_type == ZONETYPE_FEBRICK) {
+  /*--- This rank outputs the (1-based) global nodes beg_node + 1 through end_node. ---*/
+  const unsigned long beg_node = dataSorter->GetNodeBegin(rank);
+  const unsigned long end_node = beg_node + dataSorter->GetnPoints();
 
-    /* We output a single, partitioned zone where each rank outputs one partition. */
+  {
+    /* We output a single, partitioned zone where each rank outputs one partition, i.e. the data of
+       every zone type (volume, 2D, and surfaces) is written in parallel without gathering it on MASTER_NODE. */
     vector<int32_t> partition_owners;
     partition_owners.reserve(size);
     for (int32_t iRank = 0; iRank < size; ++iRank)
@@ -159,42 +163,26 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
 
     /* Gather a list of nodes we refer to but are not outputting. */
 
-    for (unsigned long i = 0; i < nParallel_Tria * N_POINTS_TRIANGLE; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(TRIANGLE, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(TRIANGLE, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(TRIANGLE, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Quad * N_POINTS_QUADRILATERAL; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Tetr * N_POINTS_TETRAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Hexa * N_POINTS_HEXAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pris * N_POINTS_PRISM; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(PRISM, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(PRISM, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(PRISM, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pyra * N_POINTS_PYRAMID; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(PYRAMID, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(PYRAMID, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(PYRAMID, 0, i));
+    auto add_halo_nodes = [&](GEO_TYPE type, unsigned long nElem, unsigned short nPoints) {
+      for (unsigned long i = 0; i < nElem * nPoints; ++i) {
+        const auto node = static_cast<unsigned long>(dataSorter->GetElemConnectivity(type, 0, i));
+        if (node <= beg_node || end_node < node) halo_nodes.insert(node);
+      }
+    };
+    add_halo_nodes(LINE,          nParallel_Line, N_POINTS_LINE);
+    add_halo_nodes(TRIANGLE,      nParallel_Tria, N_POINTS_TRIANGLE);
+    add_halo_nodes(QUADRILATERAL, nParallel_Quad, N_POINTS_QUADRILATERAL);
+    add_halo_nodes(TETRAHEDRON,   nParallel_Tetr, N_POINTS_TETRAHEDRON);
+    add_halo_nodes(HEXAHEDRON,    nParallel_Hexa, N_POINTS_HEXAHEDRON);
+    add_halo_nodes(PRISM,         nParallel_Pris, N_POINTS_PRISM);
+    add_halo_nodes(PYRAMID,       nParallel_Pyra, N_POINTS_PYRAMID);
 
     /* Sorted list of halo nodes for this MPI rank. */
     sorted_halo_nodes.assign(halo_nodes.begin(), halo_nodes.end());
 
     /* Have to include all nodes our cells refer to or TecIO will barf, so add the halo node count to the number of local nodes. */
-    int64_t partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(halo_nodes.size());
-    int64_t partition_num_cells = nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
+    int64_t partition_num_nodes = end_node - beg_node + static_cast<int64_t>(halo_nodes.size());
+    int64_t partition_num_cells = dataSorter->GetnElem();
 
     /*--- We effectively tack the halo nodes onto the end of the node list for this partition.
       TecIO will later replace them with references to nodes in neighboring partitions. */
@@ -203,7 +191,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
     vector<int32_t> neighbor_partitions(max((size_t)1, num_halo_nodes));
     vector<int64_t> neighbor_nodes(max((size_t)1, num_halo_nodes));
     for(int64_t i = 0; i < static_cast<int64_t>(num_halo_nodes); ++i) {
-      halo_node_local_numbers[i] = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + i + 1;
+      halo_node_local_numbers[i] = end_node - beg_node + i + 1;
       int owning_rank;
       unsigned long node_number;
       node_partitioner.GetOwningRankAndNodeNumber(sorted_halo_nodes[i], owning_rank, node_number);
@@ -266,76 +254,22 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
                        halo_var_data.data(), num_values_to_receive.data(), values_to_receive_displacements.data(), MPI_DOUBLE,
                        SU2_MPI::GetComm());
   }
-  else {
-    /* Zone will be gathered to and output by MASTER_NODE */
-    int32_t partition_owner = MASTER_NODE;
-    err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, 1, &partition_owner);
-  }
 
   /*--- Write surface and volumetric solution data. ---*/
 
-  if (zone_type == ZONETYPE_FEBRICK) {
-    std::vector<passivedouble> values_to_write(dataSorter->GetnPoints());
-    for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-      for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-        values_to_write[i] = dataSorter->GetData(iVar, i);
-      err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, dataSorter->GetnPoints(), values_to_write.data());
-      if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
-      for (int iRank = 0; err == 0 && iRank < size; ++iRank) {
-        if (num_nodes_to_receive[iRank] > 0) {
-          int var_data_offset = values_to_receive_displacements[iRank] + num_nodes_to_receive[iRank] * iVar;
-          err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, static_cast<int64_t>(num_nodes_to_receive[iRank]), &halo_var_data[var_data_offset]);
-          if (err) cout << rank << ": Error outputting Tecplot halo values." << endl;
-        }
-      }
-    }
-  } else {
-    if (rank == MASTER_NODE) {
-      vector<passivedouble> var_data;
-      unsigned long nPoint = dataSorter->GetnPoints();
-      vector<unsigned long> num_points(size);
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, num_points.data(), 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-
-      for(int iRank = 0; iRank < size; ++iRank) {
-        int64_t rank_num_points = num_points[iRank];
-
-        if (rank_num_points > 0) {
-          if (iRank == rank) { /* Output local data. */
-            std::vector<passivedouble> values_to_write;
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              values_to_write.resize(rank_num_points);
-              for(unsigned long i = 0; i < (unsigned long)rank_num_points; ++i)
-                values_to_write[i] = dataSorter->GetData(iVar,i);
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, values_to_write.data());
-              if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
-            }
-          }
-          else { /* Receive data from other rank. */
-            var_data.resize(max((int64_t)1, (int64_t)fieldNames.size() * rank_num_points));
-            CBaseMPIWrapper::Recv(var_data.data(), fieldNames.size() * rank_num_points, MPI_DOUBLE, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, &var_data[iVar * rank_num_points]);
-              if (err) cout << rank << ": Error outputting Tecplot surface variable values." << endl;
-            }
-          }
-        }
+  std::vector<passivedouble> values_to_write(dataSorter->GetnPoints());
+  for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
+    for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
+      values_to_write[i] = dataSorter->GetData(iVar, i);
+    err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, dataSorter->GetnPoints(), values_to_write.data());
+    if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
+    for (int iRank = 0; err == 0 && iRank < size; ++iRank) {
+      if (num_nodes_to_receive[iRank] > 0) {
+        int var_data_offset = values_to_receive_displacements[iRank] + num_nodes_to_receive[iRank] * iVar;
+        err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, static_cast<int64_t>(num_nodes_to_receive[iRank]), &halo_var_data[var_data_offset]);
+        if (err) cout << rank << ": Error outputting Tecplot halo values." << endl;
       }
     }
-    else { /* Send data to MASTER_NODE */
-      unsigned long nPoint = dataSorter->GetnPoints();
-
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, nullptr, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-
-      vector<passivedouble> var_data;
-      size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
-      var_data.reserve(var_data_size);
-      for (iVar = 0; err == 0 && iVar < fieldNames.size() ; iVar++)
-          for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-            var_data.push_back(dataSorter->GetData(iVar,i));
-
-      if (!var_data.empty())
-        CBaseMPIWrapper::Send(var_data.data(), static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, SU2_MPI::GetComm());
-    }
   }
 
 #else
@@ -362,8 +296,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   unsigned long iElem;
 
 #ifdef HAVE_MPI
-  if (zone_type == ZONETYPE_FEBRICK) {
-
+  {
     int64_t nodes[8];
 
     /**
@@ -371,9 +304,34 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
      *  Ghost (halo) nodes identified above are numbered sequentially just beyond the end of the actual, local nodes.
      *  Note that beg_node and end_node refer to zero-based node numbering, but Conn_* contain one-based node numbers.
      */
-#define MAKE_LOCAL(n) dataSorter->GetNodeBegin(rank) < (unsigned long)n && (unsigned long)n <= dataSorter->GetNodeEnd(rank) \
-  ? (int64_t)((unsigned long)n - dataSorter->GetNodeBegin(rank)) \
-  : GetHaloNodeNumber(n, dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank), sorted_halo_nodes)
+#define MAKE_LOCAL(n) beg_node < (unsigned long)n && (unsigned long)n <= end_node \
+  ? (int64_t)((unsigned long)n - beg_node) \
+  : GetHaloNodeNumber(n, end_node - beg_node, sorted_halo_nodes)
+
+    for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
+      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(LINE, iElem, 0));
+      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(LINE, iElem, 1));
+      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 2, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
+
+    for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
+      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0));
+      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1));
+      nodes[2] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2));
+      nodes[3] = nodes[2];
+      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 4, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
+
+    for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
+      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0));
+      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1));
+      nodes[2] = MAKE_LOCAL(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2));
+      nodes[3] = MAKE_LOCAL(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3));
+      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 4, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
     for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
       nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 0));
@@ -426,82 +384,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
       err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
       if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
     }
-  } else {
-    if (rank == MASTER_NODE) {
-
-      /* Non-hexahedral output by the master node. Output local data directly, and gather other data from the other ranks. */
-
-      int64_t nodes[4];
-
-      vector<unsigned long> connectivity_sizes(size);
-      unsigned long unused = 0;
-      SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, connectivity_sizes.data(), 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      for(int iRank = 0; iRank < size; ++iRank) {
-        if (iRank == rank) {
-          for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(LINE, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(LINE, iElem, 1);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 2, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-          for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1);
-            nodes[2] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-            nodes[3] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-          for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1);
-            nodes[2] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2);
-            nodes[3] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-        } else { /* Receive node map and write out. */
-          connectivity.resize(max((unsigned long)1, connectivity_sizes[iRank]));
-          SU2_MPI::Recv(connectivity.data(), connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-          err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, connectivity_sizes[iRank], connectivity.data());
-          if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-        }
-      }
-    } else {
-
-      /* Non-hexahedral output by non-master node. Send what we've got to the master node. */
-
-      unsigned long connectivity_size;
-      connectivity_size = 2 * nParallel_Line + 4 * (nParallel_Tria + nParallel_Quad);
-      SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, nullptr, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      connectivity.reserve(connectivity_size);
-      for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(LINE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(LINE, iElem, 0));
-      }
-
-      for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2));
-      }
-
-      for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3));
-      }
-
-      if (connectivity.empty()) connectivity.resize(1); /* Avoid crash */
-      SU2_MPI::Send(connectivity.data(), connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, SU2_MPI::GetComm());
-    }
+#undef MAKE_LOCAL
   }
 #else
 
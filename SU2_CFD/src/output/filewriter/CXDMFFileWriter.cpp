@@ -0,0 +1,270 @@
+/*!
+ * \file CXDMFFileWriter.cpp
+ * \brief Filewriter class for XDMF format, the data is stored in HDF5 format.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CXDMFFileWriter.hpp"
+
+const string CXDMFFileWriter::fileExt = ".xmf";
+constexpr unsigned long CXDMFFileWriter::CHUNK_SIZE;
+
+CXDMFFileWriter::CXDMFFileWriter(CParallelDataSorter* valDataSorter, unsigned short compression, int digits)
+    : CFileWriter(valDataSorter, fileExt), compressionLevel(compression), lossyDigits(digits) {}
+
+void CXDMFFileWriter::WriteData(string val_filename) {
+
+#ifdef HAVE_HDF5
+
+  if (!dataSorter->GetConnectivitySorted()) {
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  /*--- We always have 3 coords, independent of the actual value of nDim. ---*/
+
+  const unsigned short NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const string dataFileName = val_filename + ".h5";
+  val_filename.append(fileExt);
+
+  /*--- The descriptor refers to the data file by its name, relative to the descriptor. ---*/
+
+  const auto slash = dataFileName.find_last_of("/\\");
+  const string dataFileRef = (slash == string::npos) ? dataFileName : dataFileName.substr(slash + 1);
+
+  usedTime = 0;
+  startTime = SU2_MPI::Wtime();
+
+  /*--- Create the HDF5 file, with the MPI-IO driver the metadata and data are written collectively. ---*/
+
+  hid_t faplID = H5Pcreate(H5P_FILE_ACCESS);
+  xferID = H5Pcreate(H5P_DATASET_XFER);
+#ifdef H5_HAVE_PARALLEL
+  CallHDF5(H5Pset_fapl_mpio(faplID, comm, MPI_INFO_NULL));
+  CallHDF5(H5Pset_all_coll_metadata_ops(faplID, true));
+  CallHDF5(H5Pset_coll_metadata_write(faplID, true));
+  CallHDF5(H5Pset_dxpl_mpio(xferID, H5FD_MPIO_COLLECTIVE));
+#else
+  if (size > 1) {
+    SU2_MPI::Error("XDMF output with more than one rank requires HDF5 built with MPI support.", CURRENT_FUNCTION);
+  }
+#endif
+  fileID = H5Fcreate(dataFileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, faplID);
+  CallHDF5(H5Pclose(faplID));
+  if (fileID < 0) SU2_MPI::Error("Unable to create " + dataFileName, CURRENT_FUNCTION);
+
+  const unsigned long myPoint = dataSorter->GetnPoints();
+  const unsigned long GlobalPoint = dataSorter->GetnPointsGlobal();
+  const unsigned long pointOffset = dataSorter->GetnPointCumulative(rank);
+
+  /*--- Point coordinates. ---*/
+
+  vector<float> dataBufferFloat(myPoint * NCOORDS);
+  for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++) {
+    for (unsigned short iDim = 0; iDim < NCOORDS; iDim++) {
+      dataBufferFloat[iPoint * NCOORDS + iDim] = (iDim < nDim) ? float(dataSorter->GetData(iDim, iPoint)) : 0.0f;
+    }
+  }
+  WriteDataset("Coordinates", H5T_NATIVE_FLOAT, dataBufferFloat.data(), myPoint, GlobalPoint, pointOffset, NCOORDS,
+               false);
+
+  /*--- Connectivity as a mixed topology, each element is stored as its XDMF type followed by its nodes,
+   *    lines (polylines) also need their number of nodes. ---*/
+
+  const GEO_TYPE elemTypes[] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short elemNodes[] = {N_POINTS_LINE,        N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL,
+                                      N_POINTS_TETRAHEDRON, N_POINTS_HEXAHEDRON, N_POINTS_PRISM,
+                                      N_POINTS_PYRAMID};
+
+  const unsigned long myElem = dataSorter->GetnElem();
+  const unsigned long myConn = dataSorter->GetnConn() + myElem + dataSorter->GetnElem(LINE);
+
+  vector<unsigned long> nConnRank(size);
+  SU2_MPI::Allgather(&myConn, 1, MPI_UNSIGNED_LONG, nConnRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  unsigned long connOffset = 0, GlobalConn = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) connOffset += nConnRank[iRank];
+    GlobalConn += nConnRank[iRank];
+  }
+
+  vector<int> connBuf;
+  connBuf.reserve(myConn);
+  for (unsigned short iType = 0; iType < 7; iType++) {
+    const auto type = elemTypes[iType];
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); iElem++) {
+      connBuf.push_back(GetXDMFType(type));
+      if (type == LINE) connBuf.push_back(N_POINTS_LINE);
+      for (unsigned short iNode = 0; iNode < elemNodes[iType]; iNode++) {
+        connBuf.push_back(int(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1));
+      }
+    }
+  }
+  WriteDataset("Topology", H5T_NATIVE_INT, connBuf.data(), myConn, GlobalConn, connOffset, 1, false);
+
+  /*--- Point data, the "_x" "_y" "_z" components of a field are written as a vector. ---*/
+
+  struct CAttribute {
+    string name;
+    unsigned short nComp;
+  };
+  vector<CAttribute> attributes;
+
+  auto endsWith = [](const string& str, const string& suffix) {
+    return (str.size() > suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
+  };
+
+  for (unsigned long iField = nDim; iField < fieldNames.size(); iField++) {
+
+    string fieldName = fieldNames[iField];
+    fieldName.erase(remove(fieldName.begin(), fieldName.end(), '"'), fieldName.end());
+    replace(fieldName.begin(), fieldName.end(), '/', '_');
+
+    const bool isVector = endsWith(fieldName, "_x") && (iField + nDim <= fieldNames.size()) &&
+                          endsWith(fieldNames[iField + 1], "_y");
+
+    if (isVector) {
+      fieldName.erase(fieldName.size() - 2);
+      for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++) {
+        for (unsigned short iDim = 0; iDim < NCOORDS; iDim++) {
+          dataBufferFloat[iPoint * NCOORDS + iDim] =
+              (iDim < nDim) ? float(dataSorter->GetData(iField + iDim, iPoint)) : 0.0f;
+        }
+      }
+      WriteDataset(fieldName, H5T_NATIVE_FLOAT, dataBufferFloat.data(), myPoint, GlobalPoint, pointOffset,
+                   NCOORDS, true);
+      attributes.push_back({fieldName, NCOORDS});
+      iField += nDim - 1;
+    } else {
+      for (unsigned long iPoint = 0; iPoint < myPoint; iPoint++) {
+        dataBufferFloat[iPoint] = float(dataSorter->GetData(iField, iPoint));
+      }
+      WriteDataset(fieldName, H5T_NATIVE_FLOAT, dataBufferFloat.data(), myPoint, GlobalPoint, pointOffset, 1, true);
+      attributes.push_back({fieldName, 1});
+    }
+  }
+
+  CallHDF5(H5Pclose(xferID));
+  CallHDF5(H5Fclose(fileID));
+  fileID = xferID = -1;
+
+  /*--- The master writes the descriptor. ---*/
+
+  if (rank == MASTER_NODE) {
+    ofstream file(val_filename);
+    if (!file.is_open()) SU2_MPI::Error("Unable to open " + val_filename, CURRENT_FUNCTION);
+
+    auto dataItem = [&](const string& dims, const string& numberType, const string& dataset) {
+      file << "        <DataItem Dimensions=\"" << dims << "\" NumberType=\"" << numberType
+           << "\" Precision=\"4\" Format=\"HDF\">" << dataFileRef << ":/" << dataset << "</DataItem>\n";
+    };
+    const string points = to_string(GlobalPoint);
+
+    file << "<?xml version=\"1.0\" ?>\n";
+    file << "<Xdmf Version=\"3.0\">\n  <Domain>\n    <Grid Name=\"SU2\" GridType=\"Uniform\">\n";
+    file << "      <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << dataSorter->GetnElemGlobal() << "\">\n";
+    dataItem(to_string(GlobalConn), "Int", "Topology");
+    file << "      </Topology>\n";
+    file << "      <Geometry GeometryType=\"XYZ\">\n";
+    dataItem(points + " 3", "Float", "Coordinates");
+    file << "      </Geometry>\n";
+    for (const auto& attribute : attributes) {
+      const bool isVec = (attribute.nComp == NCOORDS);
+      file << "      <Attribute Name=\"" << attribute.name << "\" AttributeType=\"" << (isVec ? "Vector" : "Scalar")
+           << "\" Center=\"Node\">\n";
+      dataItem(isVec ? points + " 3" : points, "Float", attribute.name);
+      file << "      </Attribute>\n";
+    }
+    file << "    </Grid>\n  </Domain>\n</Xdmf>\n";
+  }
+  SU2_MPI::Barrier(comm);
+
+  stopTime = SU2_MPI::Wtime();
+  usedTime = stopTime - startTime;
+
+  /*--- Compute and store the bandwidth, the (compressed) data file dominates the size. ---*/
+
+  fileSize = DetermineFilesize(dataFileName);
+  bandwidth = fileSize / (1.0e6) / usedTime;
+
+#endif
+}
+
+#ifdef HAVE_HDF5
+void CXDMFFileWriter::WriteDataset(const string& name, hid_t memType, const void* data, unsigned long nLocal,
+                                   unsigned long nGlobal, unsigned long offset, unsigned short nComp,
+                                   bool lossy) const {
+
+  const int nDims = (nComp > 1) ? 2 : 1;
+  const hsize_t globalDims[] = {hsize_t(nGlobal), hsize_t(nComp)};
+  const hsize_t localDims[] = {hsize_t(max(nLocal, 1ul)), hsize_t(nComp)};
+  const hsize_t start[] = {hsize_t(offset), 0};
+  const hsize_t count[] = {hsize_t(nLocal), hsize_t(nComp)};
+
+  /*--- Compressed datasets must be chunked, the filters are applied to each chunk. The lossy filter
+   *    (scale-offset) is applied before the lossless ones, shuffle improves the ratio of deflate. ---*/
+
+  const bool scaleOffset = lossy && (lossyDigits >= 0);
+  hid_t dcplID = H5Pcreate(H5P_DATASET_CREATE);
+
+  if ((compressionLevel > 0 || scaleOffset) && nGlobal > 0) {
+    const hsize_t chunkDims[] = {hsize_t(min(nGlobal, CHUNK_SIZE)), hsize_t(nComp)};
+    CallHDF5(H5Pset_chunk(dcplID, nDims, chunkDims));
+
+    if (scaleOffset) CallHDF5(H5Pset_scaleoffset(dcplID, H5Z_SO_FLOAT_DSCALE, lossyDigits));
+
+    if (compressionLevel > 0) {
+      if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+        SU2_MPI::Error("XDMF_COMPRESSION_LEVEL > 0 but HDF5 was built without deflate (zlib).", CURRENT_FUNCTION);
+      }
+      CallHDF5(H5Pset_shuffle(dcplID));
+      CallHDF5(H5Pset_deflate(dcplID, compressionLevel));
+    }
+  }
+
+  hid_t fileSpace = H5Screate_simple(nDims, globalDims, nullptr);
+  hid_t memSpace = H5Screate_simple(nDims, localDims, nullptr);
+  const hid_t fileType = (memType == H5T_NATIVE_INT) ? H5T_STD_I32LE : H5T_IEEE_F32LE;
+
+  hid_t dsetID = H5Dcreate2(fileID, name.c_str(), fileType, fileSpace, H5P_DEFAULT, dcplID, H5P_DEFAULT);
+  if (dsetID < 0) SU2_MPI::Error("Unable to create the dataset " + name, CURRENT_FUNCTION);
+
+  /*--- Each rank selects its part of the dataset, ranks without data still take part in the collective write. ---*/
+
+  if (nLocal > 0) {
+    CallHDF5(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, count, nullptr));
+  } else {
+    CallHDF5(H5Sselect_none(fileSpace));
+    CallHDF5(H5Sselect_none(memSpace));
+  }
+  CallHDF5(H5Dwrite(dsetID, memType, memSpace, fileSpace, xferID, data));
+
+  CallHDF5(H5Dclose(dsetID));
+  CallHDF5(H5Sclose(memSpace));
+  CallHDF5(H5Sclose(fileSpace));
+  CallHDF5(H5Pclose(dcplID));
+}
+#endif
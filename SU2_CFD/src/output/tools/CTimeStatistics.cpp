@@ -0,0 +1,118 @@
+/*!
+ * \file CTimeStatistics.cpp
+ * \brief Implementation of the streaming time statistics.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CTimeStatistics.hpp"
+#include <cmath>
+
+void CTimeStatistics::Initialize(unsigned long numPoints, std::vector<std::string> names,
+                                 std::vector<Pair> covariances, unsigned long numPhases,
+                                 unsigned long periodIters, std::vector<passivedouble> freqs) {
+  nPoint = numPoints;
+  nQuantity = names.size();
+  quantityNames = std::move(names);
+  pairs = std::move(covariances);
+  nPhase = (periodIters > 0) ? numPhases : 0;
+  period = periodIters;
+  frequencies = std::move(freqs);
+
+  nSample = 0;
+  lastIter = 0;
+  phase = 0;
+  nPhaseSample.assign(nPhase, 0);
+  cosine.assign(frequencies.size(), 1.0);
+  sine.assign(frequencies.size(), 0.0);
+
+  state.resize(nStateRows(), nPoint) = 0.0;
+}
+
+bool CTimeStatistics::BeginStep(unsigned long timeIter, passivedouble time) {
+  if (nSample > 0 && timeIter == lastIter) return false;
+
+  lastIter = timeIter;
+  ++nSample;
+
+  if (nPhase > 0) {
+    phase = (timeIter % period) * nPhase / period;
+    ++nPhaseSample[phase];
+  }
+  for (auto f = 0ul; f < frequencies.size(); ++f) {
+    const passivedouble arg = 2 * std::acos(-1.0) * frequencies[f] * time;
+    cosine[f] = std::cos(arg);
+    sine[f] = std::sin(arg);
+  }
+  return true;
+}
+
+passivedouble CTimeStatistics::GetAmplitude(unsigned long f, unsigned short q, unsigned long iPoint) const {
+  if (nSample == 0) return 0.0;
+  const passivedouble re = state(FourierRow(f, q), iPoint);
+  const passivedouble im = state(FourierRow(f, q) + nQuantity, iPoint);
+  return 2 * std::sqrt(re * re + im * im) / nSample;
+}
+
+std::vector<std::string> CTimeStatistics::GetStateNames() const {
+  std::vector<std::string> names;
+  names.reserve(nStateRows() + 2 + nPhase);
+
+  for (const auto& name : quantityNames) names.push_back("Mean_" + name);
+  for (const auto& name : quantityNames) names.push_back("M2_" + name);
+  for (const auto& pair : pairs) {
+    names.push_back("C2_" + quantityNames[pair.first] + "_" + quantityNames[pair.second]);
+  }
+  for (auto p = 0ul; p < nPhase; ++p) {
+    for (const auto& name : quantityNames) names.push_back("Phase" + std::to_string(p) + "_" + name);
+  }
+  for (auto f = 0ul; f < frequencies.size(); ++f) {
+    for (const auto& name : quantityNames) names.push_back("DFT" + std::to_string(f) + "Re_" + name);
+    for (const auto& name : quantityNames) names.push_back("DFT" + std::to_string(f) + "Im_" + name);
+  }
+  names.push_back("Stat_Samples");
+  names.push_back("Stat_LastIter");
+  for (auto p = 0ul; p < nPhase; ++p) names.push_back("Stat_Phase" + std::to_string(p) + "_Samples");
+
+  return names;
+}
+
+passivedouble CTimeStatistics::GetState(unsigned long iField, unsigned long iPoint) const {
+  const auto nRows = nStateRows();
+  if (iField < nRows) return state(iField, iPoint);
+  if (iField == nRows) return nSample;
+  if (iField == nRows + 1) return lastIter;
+  return nPhaseSample[iField - nRows - 2];
+}
+
+void CTimeStatistics::SetState(unsigned long iField, unsigned long iPoint, passivedouble value) {
+  const auto nRows = nStateRows();
+  if (iField < nRows) {
+    state(iField, iPoint) = value;
+    return;
+  }
+  const auto count = static_cast<unsigned long>(std::lround(value));
+  if (iField == nRows) nSample = count;
+  else if (iField == nRows + 1) lastIter = count;
+  else nPhaseSample[iField - nRows - 2] = count;
+}
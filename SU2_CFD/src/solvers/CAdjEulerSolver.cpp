@@ -1363,7 +1363,8 @@ void CAdjEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfi
 
 void CAdjEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                            CConfig *config, unsigned short iRKStep) {
-  su2double *Residual, *Res_TruncError, Vol, Delta, Res;
+  const su2double *Residual, *Res_TruncError;
+  su2double Vol, Delta, Res;
   unsigned short iVar;
   unsigned long iPoint;
 
@@ -1399,7 +1400,8 @@ void CAdjEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CAdjEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
-  su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
+  const su2double *local_Residual, *local_Res_TruncError;
+  su2double Vol, Delta, Res;
   unsigned short iVar;
   unsigned long iPoint;
 
@@ -1436,7 +1438,8 @@ void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
 
   unsigned short iVar;
   unsigned long iPoint, total_index;
-  su2double Delta, *local_Res_TruncError, Vol;
+  su2double Delta, Vol;
+  const su2double *local_Res_TruncError;
 
   /*--- Set maximum residual to zero ---*/
 
@@ -1465,8 +1468,8 @@ void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
       for (iVar = 0; iVar < nVar; iVar++) {
         total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = 0.0;
-        local_Res_TruncError[iVar] = 0.0;
       }
+      nodes->SetRes_TruncErrorZero(iPoint);
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
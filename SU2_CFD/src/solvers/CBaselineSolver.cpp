@@ -30,6 +30,7 @@
 
 #include "../../include/solvers/CBaselineSolver.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
 
 CBaselineSolver::CBaselineSolver() : CSolver() { }
 
@@ -95,7 +96,23 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
 
   /*--- Read only the number of variables in the restart file. ---*/
 
-  if (config->GetRead_Binary_Restart()) {
+  if (config->GetRestart_Time_Series()) {
+
+    /*--- The steps are stored in one file, named as the restarts without the time iteration. ---*/
+
+    filename = config->GetFilename(filename, "", config->GetTimeIter());
+
+    string series;
+    unsigned long step, nPointFile;
+    vector<string> fieldNames;
+    CSU2TimeSeriesFileWriter::SplitStepName(filename, series, step);
+    CSU2TimeSeriesFileWriter::ReadHeader(series + CSU2TimeSeriesFileWriter::fileExt, nPointFile, fieldNames);
+
+    nVar = fieldNames.size();
+    fields.emplace_back("Point_ID");
+    for (const auto& name : fieldNames) fields.emplace_back("\"" + name + "\"");
+
+  } else if (config->GetRead_Binary_Restart()) {
 
     /*--- Multizone problems require the number of the zone to be appended. ---*/
 
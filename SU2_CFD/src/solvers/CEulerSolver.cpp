@@ -29,12 +29,16 @@
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
 #include "../../include/fluid/CDataDrivenFluid.hpp"
 #include "../../include/fluid/CCoolProp.hpp"
+#include "../../include/fluid/CTabulatedFluid.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
+#include "../../include/numerics_simd/flow/convection/centered_adjoint.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
 
 
@@ -161,7 +165,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::FLOW, ReducerStrategy);
   }
   else {
     if (rank == MASTER_NODE)
@@ -358,6 +362,10 @@ void CEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_containe
     SU2_MPI::Error("The numerical scheme + gas model in use do not "
                    "support vectorization.", CURRENT_FUNCTION);
 
+  /*--- Vectorized boundary conditions are used on request, the scalar ones are used if not supported. ---*/
+  if (config->GetUseVectorization())
+    farfieldNumerics = CBoundaryNumericsSIMD::CreateFarfieldNumerics(*config, nDim);
+
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
@@ -1100,6 +1108,10 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
         break;
     }
 
+    if (config->GetTabulate_FluidModel()) {
+      FluidModel[thread] = new CTabulatedFluid(FluidModel[thread], config);
+    }
+
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
     if (viscous) {
       GetFluidModel()->SetLaminarViscosityModel(config);
@@ -1558,8 +1570,11 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   ompMasterAssignBarrier(ErrorCounter, 0);
 
+  /*--- The residual is zeroed in the same loop, not needed for the reducer strategy
+   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
+
   SU2_OMP_ATOMIC
-  ErrorCounter += SetPrimitive_Variables(solver_container, config);
+  ErrorCounter += SetPrimitive_Variables(solver_container, config, !ReducerStrategy && !Output);
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
   { /*--- Ops that are not OpenMP parallel go in this block. ---*/
@@ -1570,6 +1585,14 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
       config->SetNonphysical_Points(ErrorCounter);
     }
 
+    /*--- Assemble the edge Jacobian or lag it, only for vectorized schemes (without them edgeNumerics is null). ---*/
+
+    if (!Output) {
+      const bool lagged = implicit && (iMesh == MESH_0) && (config->GetJacobian_Lag() > 1) &&
+                          (edgeNumerics != nullptr) && LagEdgeJacobian(config);
+      config->SetLagged_Jacobian_Iter(lagged);
+    }
+
     /*--- Update the angle of attack at the far-field for fixed CL calculations (only direct problem). ---*/
 
     if (fixed_cl && !disc_adjoint && !cont_adjoint) {
@@ -1594,10 +1617,16 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
   /*--- Artificial dissipation ---*/
 
   if (center && !Output) {
-    if (!center_jst_mat) SetMax_Eigenvalue(geometry, config);
-    if (center_jst || center_jst_ke || center_jst_mat) {
-      SetCentered_Dissipation_Sensor(geometry, config);
-      if (!center_jst_ke) SetUndivided_Laplacian(geometry, config);
+    if (center_jst || center_jst_ke) {
+      /*--- Eigenvalue, sensor, and Laplacian share the loop over the neighbors of each point. ---*/
+      SetCentered_Dissipation_Fused(geometry, config, center_jst);
+    }
+    else {
+      if (!center_jst_mat) SetMax_Eigenvalue(geometry, config);
+      if (center_jst_mat) {
+        SetCentered_Dissipation_Sensor(geometry, config);
+        SetUndivided_Laplacian(geometry, config);
+      }
     }
   }
 
@@ -1610,14 +1639,10 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
     }
   }
 
-  /*--- Initialize the Jacobian matrix and residual, not needed for the reducer strategy
-   *    as we set blocks (including diagonal ones) and completely overwrite. ---*/
+  /*--- Initialize the Jacobian matrix (the residual was zeroed with the primitives),
+   *    a lagged Jacobian is overwritten by the stored one after the edge loop. ---*/
 
-  if(!ReducerStrategy && !Output) {
-    LinSysRes.SetValZero();
-    if (implicit) Jacobian.SetValZero();
-    else {SU2_OMP_BARRIER} // because of "nowait" in LinSysRes
-  }
+  if(!ReducerStrategy && !Output && implicit && !config->GetLagged_Jacobian_Iter()) Jacobian.SetValZero();
 
 }
 
@@ -1637,29 +1662,46 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient and limiter computation in one pass if possible, then the halo exchange
+     *    can complete during the edge loop (see Upwind_Residual). ---*/
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    if (limiter && !van_albada && CanFuseGradientLimiter(config)) {
+      if (CommOverlap) DeferComms(PRIMITIVE_RECONSTRUCTION);
+      SetPrimitive_Gradient_Limiter(geometry, config);
     }
+    else {
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
+
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
 
-    /*--- Limiter computation ---*/
+      /*--- Limiter computation, the halo exchange can complete during the edge loop. ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+      if (limiter && !van_albada) {
+        if (CommOverlap) DeferComms(PRIMITIVE_LIMITER);
+        SetPrimitive_Limiter(geometry, config);
+      }
+    }
   }
 }
 
-unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
+unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config,
+                                                   bool zeroResidual) {
 
   /*--- Number of non-physical points, local to the thread, needs
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  const bool preacc = ClosedFormFluidModel(config);
+  SU2_TAPE_PROBE(PRIMITIVES);
+  SU2_KERNEL_COUNTER(PRIMITIVES);
+
   AD::StartNoSharedReading();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -1667,12 +1709,24 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
     /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
+    if (preacc) {
+      AD::StartPreacc();
+      nodes->SetPrimVarPreaccIn(iPoint);
+    }
+
     bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
     nodes->SetSecondaryVar(iPoint, GetFluidModel());
 
+    if (preacc) {
+      nodes->SetPrimVarPreaccOut(iPoint, physical);
+      AD::EndPreacc();
+    }
+
     /* Check for non-realizable states for reporting. */
 
     if (!physical) nonPhysicalPoints++;
+
+    if (zeroResidual) LinSysRes.SetBlock_Zero(iPoint);
   }
   END_SU2_OMP_FOR
 
@@ -1734,9 +1788,151 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
+  if (CenteredResidualExternal(geometry, solver_container, config, iMesh)) return;
+
   EdgeFluxResidual(geometry, solver_container, config);
 }
 
+bool CEulerSolver::CenteredResidualExternal(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                            unsigned short iMesh) {
+#ifndef CODI_REVERSE_TYPE
+  return false;
+#else
+  if (!config->GetAdjoint_Flux_Kernel_Disc() || !config->GetDiscrete_Adjoint() || !AD::TapeActive() ||
+      config->GetKind_Centered_Flow() != CENTERED::JST || iMesh != MESH_0 || config->GetViscous() ||
+      dynamic_grid || ReducerStrategy) {
+    return false;
+  }
+
+  /*--- The halo values must be final before they are declared as inputs. ---*/
+  CompleteDeferredComms(geometry, config);
+
+  /*--- Inputs: the residual (it is incremented), the point data and the normals of the edges.
+   * The layout must match the reverse (CenteredResidual_b). ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    AD::SetExtFuncIn(&LinSysRes[0], LinSysRes.GetLocSize());
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      AD::SetExtFuncIn(nodes->GetPrimitive(iPoint), nDim+5);
+      AD::SetExtFuncIn(nodes->GetUndivided_Laplacian(iPoint), nVar);
+      AD::SetExtFuncIn(nodes->GetSensor()(iPoint));
+      AD::SetExtFuncIn(nodes->GetLambda()(iPoint));
+    }
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      AD::SetExtFuncIn(geometry->edges->GetNormal(iEdge), nDim);
+    }
+    AD::SetExtFuncOut(&LinSysRes[0], LinSysRes.GetLocSize());
+    AD::FuncHelper.addUserData(this);
+    AD::FuncHelper.addUserData(geometry);
+    AD::FuncHelper.addUserData(config);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  AD::FuncHelper.callPrimalFuncWithADType([&]() { EdgeFluxResidual(geometry, solver_container, config); });
+
+  AD::FuncHelper.addToTape(nDim == 2 ? &CenteredResidual_b<2> : &CenteredResidual_b<3>);
+
+  return true;
+#endif
+}
+
+#ifdef CODI_REVERSE_TYPE
+template<size_t nDim>
+void CEulerSolver::CenteredResidual_b(const su2double::Real* x, su2double::Real* x_b, size_t m,
+                                      const su2double::Real* y, const su2double::Real* y_b, size_t n,
+                                      codi::ExternalFunctionUserData* d) {
+  CEulerSolver* solver = nullptr;
+  d->getDataByIndex(solver, 0);
+
+  CGeometry* geometry = nullptr;
+  d->getDataByIndex(geometry, 1);
+
+  CConfig* config = nullptr;
+  d->getDataByIndex(config, 2);
+
+  using Kernel = CJSTAdjointKernel<nDim>;
+  using Dbl = simd::Array<passivedouble>;
+  constexpr size_t nVar = Kernel::nVar, nPrimVar = Kernel::nPrimVar;
+
+  /*--- Layout of the inputs (see CenteredResidualExternal). ---*/
+  constexpr size_t nPointVar = nPrimVar + nVar + 2;
+  const auto nPoint = geometry->GetnPoint();
+  const auto* pointData = x + nPoint * nVar;
+  auto* pointData_b = x_b + nPoint * nVar;
+  const auto* normals = pointData + nPoint * nPointVar;
+  auto* normals_b = pointData_b + nPoint * nPointVar;
+
+  /*--- The residual is incremented, its adjoint goes through. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(roundUpDiv(m, omp_get_num_threads()))
+  for (auto i = 0ul; i < m; ++i) x_b[i] = (i < n) ? y_b[i] : 0.0;
+  END_SU2_OMP_FOR
+
+  const typename Kernel::Coefficients coefs{SU2_TYPE::GetValue(config->GetKappa_2nd_Flow()),
+                                            SU2_TYPE::GetValue(config->GetKappa_4th_Flow()),
+                                            0.3 /*--- Same as CCenteredBase. ---*/};
+
+  /*--- Edges of the same color do not share points, the packs of SIMD length can be scattered in parallel. ---*/
+
+  for (const auto& color : solver->EdgeColoring) {
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Dbl::Size) {
+      unsigned long iEdge[Dbl::Size], iPoint[2][Dbl::Size];
+      bool active[Dbl::Size];
+
+      typename Kernel::template Data<Dbl> in, in_b;
+      Dbl nNeighbor[2], flux_b[nVar];
+
+      for (auto j = 0ul; j < Dbl::Size; ++j) {
+        active[j] = (k+j < color.size);
+        iEdge[j] = color.indices[k + j*active[j]];
+
+        for (int p = 0; p < 2; ++p) {
+          iPoint[p][j] = geometry->edges->GetNode(iEdge[j], p);
+          nNeighbor[p][j] = geometry->nodes->GetnNeighbor(iPoint[p][j]);
+
+          const auto* data = pointData + iPoint[p][j] * nPointVar;
+          for (auto iVar = 0ul; iVar < nPrimVar; ++iVar) in.V[p][iVar][j] = data[iVar];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) in.lapl[p][iVar][j] = data[nPrimVar + iVar];
+          in.sensor[p][j] = data[nPrimVar + nVar];
+          in.lambda[p][j] = data[nPrimVar + nVar + 1];
+        }
+        for (auto iDim = 0ul; iDim < nDim; ++iDim) in.normal[iDim][j] = normals[iEdge[j] * nDim + iDim];
+
+        /*--- The flux is added to the residual of i and subtracted from j. ---*/
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          flux_b[iVar][j] = active[j] * (y_b[iPoint[0][j] * nVar + iVar] - y_b[iPoint[1][j] * nVar + iVar]);
+        }
+      }
+
+      for (int p = 0; p < 2; ++p) {
+        for (auto& v : in_b.V[p]) v = 0.0;
+        for (auto& v : in_b.lapl[p]) v = 0.0;
+        in_b.sensor[p] = 0.0;
+        in_b.lambda[p] = 0.0;
+      }
+      for (auto& v : in_b.normal) v = 0.0;
+
+      Kernel::Reverse(coefs, in, nNeighbor, flux_b, in_b);
+
+      for (auto j = 0ul; j < Dbl::Size; ++j) {
+        if (!active[j]) continue;
+
+        for (int p = 0; p < 2; ++p) {
+          auto* data_b = pointData_b + iPoint[p][j] * nPointVar;
+          for (auto iVar = 0ul; iVar < nPrimVar; ++iVar) data_b[iVar] += in_b.V[p][iVar][j];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) data_b[nPrimVar + iVar] += in_b.lapl[p][iVar][j];
+          data_b[nPrimVar + nVar] += in_b.sensor[p][j];
+          data_b[nPrimVar + nVar + 1] += in_b.lambda[p][j];
+        }
+        for (auto iDim = 0ul; iDim < nDim; ++iDim) normals_b[iEdge[j] * nDim + iDim] += in_b.normal[iDim][j];
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+#endif
+
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
@@ -1744,12 +1940,25 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                          (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool low_mach_corr = config->Low_Mach_Correction();
 
-  /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  /*--- Use vectorization if the scheme supports it, always for Roe, on request for the others. ---*/
+  const auto kind_upwind = config->GetKind_Upwind_Flow();
+  const bool simd_scheme = (kind_upwind == UPWIND::ROE) ||
+                           (config->GetUseVectorization() &&
+                            (kind_upwind == UPWIND::HLLC || kind_upwind == UPWIND::AUSMPLUSUP ||
+                             kind_upwind == UPWIND::AUSMPLUSUP2 || kind_upwind == UPWIND::SLAU ||
+                             kind_upwind == UPWIND::SLAU2));
+
+  if (simd_scheme && ideal_gas && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
 
+  if (MultirateTimeStepping(config)) {
+    SU2_MPI::Error("Multirate time stepping (LEVELS_TIME_ACCURATE_LTS) requires a vectorized upwind scheme\n"
+                   "(ROE, or HLLC, AUSMPLUSUP(2), SLAU(2) with USE_VECTORIZATION= YES), an ideal gas,\n"
+                   "and no low Mach correction.", CURRENT_FUNCTION);
+  }
+
   const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
   const bool roe_turkel       = (config->GetKind_Upwind_Flow() == UPWIND::TURKEL);
@@ -1778,14 +1987,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-  for(auto k = 0ul; k < color.size; ++k) {
-
-    auto iEdge = color.indices[k];
+  /*--- Convective (and viscous) residual of one edge. ---*/
+  auto ComputeEdge = [&](unsigned long iEdge) {
 
     unsigned short iDim, iVar;
 
@@ -1950,9 +2153,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     Viscous_Residual(iEdge, geometry, solver_container,
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
-  }
-  END_SU2_OMP_FOR
-  } // end color loop
+  };
+
+  /*--- Loop over edge colors. ---*/
+  EdgeLoop(geometry, config, ComputeEdge);
 
   FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
 }
@@ -2330,10 +2534,7 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
 
   /*--- Correct the Laplacian across any periodic boundaries. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-  }
+  PeriodicComms(geometry, config, PERIODIC_LAPLACIAN);
 
   /*--- MPI parallelization ---*/
 
@@ -2355,6 +2556,121 @@ void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, const CCo
   SetCentered_Dissipation_Sensor_impl(sensVar, geometry, config);
 }
 
+void CEulerSolver::SetCentered_Dissipation_Fused(CGeometry *geometry, const CConfig *config, bool laplacian) {
+
+  /*--- We can access memory more efficiently if there are no periodic boundaries. ---*/
+
+  const bool isPeriodic = (config->GetnMarker_Periodic() > 0);
+
+  /*--- Loop domain points, the neighbors of each point are visited once for the three quantities, the
+   *    operations and their order are those of SetMax_Eigenvalue, SetCentered_Dissipation_Sensor, and
+   *    SetUndivided_Laplacian, the results are the same. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+
+    const bool boundary_i = geometry->nodes->GetPhysicalBoundary(iPoint);
+    const su2double Pressure_i = nodes->GetPressure(iPoint);
+    const su2double SoundSpeed_i = nodes->GetSoundSpeed(iPoint);
+
+    su2double Lambda = 0.0, PressDiff = 0.0, PressSum = 0.0;
+    su2double UndLapl[MAXNVAR] = {0.0};
+
+    /*--- Loop over the neighbors of point i. ---*/
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh) {
+
+      const auto jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+      const auto iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
+      const auto Normal = geometry->edges->GetNormal(iEdge);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
+
+      /*--- Spectral radius, with adjustment for grid movement. ---*/
+
+      su2double Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+      const su2double Mean_SoundSpeed = 0.5 * (SoundSpeed_i + nodes->GetSoundSpeed(jPoint)) * Area;
+
+      if (dynamic_grid) {
+        const su2double *GridVel_i = geometry->nodes->GetGridVel(iPoint);
+        const su2double *GridVel_j = geometry->nodes->GetGridVel(jPoint);
+
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+      }
+
+      Lambda += fabs(Mean_ProjVel) + Mean_SoundSpeed;
+
+      /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
+
+      const bool boundary_j = geometry->nodes->GetPhysicalBoundary(jPoint);
+      if (boundary_i && !boundary_j) continue;
+
+      /*--- Pressure sensor, add pressure difference and pressure sum. ---*/
+
+      const su2double Pressure_j = nodes->GetPressure(jPoint);
+      PressDiff += Pressure_j - Pressure_i;
+      PressSum += Pressure_j + Pressure_i;
+
+      /*--- Add solution differences, with correction for compressible flows which use the enthalpy. ---*/
+
+      if (laplacian) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          UndLapl[iVar] += nodes->GetSolution(jPoint,iVar) - nodes->GetSolution(iPoint,iVar);
+        UndLapl[nVar-1] += Pressure_j - Pressure_i;
+      }
+    }
+
+    nodes->SetLambda(iPoint, Lambda);
+
+    iPoint_UndLapl[iPoint] = PressDiff;
+    jPoint_UndLapl[iPoint] = PressSum;
+    if (!isPeriodic) nodes->SetSensor(iPoint, fabs(PressDiff) / PressSum);
+
+    if (laplacian) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nodes->SetUnd_Lapl(iPoint, iVar, UndLapl[iVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Boundary contributions to the eigenvalue, periodic correction, and MPI. ---*/
+
+  struct SoundSpeed {
+    FORCEINLINE su2double operator() (const CEulerVariable& nodes, unsigned long iPoint) const {
+      return nodes.GetSoundSpeed(iPoint);
+    }
+  } soundSpeed;
+
+  SetMax_Eigenvalue_Boundary_impl(soundSpeed, geometry, config);
+
+  /*--- Finish the sensor and the Laplacian as SetCentered_Dissipation_Sensor and SetUndivided_Laplacian. ---*/
+
+  if (isPeriodic) {
+    PeriodicComms(geometry, config, PERIODIC_SENSOR);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
+    END_SU2_OMP_FOR
+  }
+
+  InitiateComms(geometry, config, SENSOR);
+  CompleteComms(geometry, config, SENSOR);
+
+  if (laplacian) {
+    PeriodicComms(geometry, config, PERIODIC_LAPLACIAN);
+
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  }
+
+}
+
+bool CEulerSolver::LagEdgeJacobian(const CConfig *config) {
+
+  return JacobianLag.Lag(config->GetTimeIter(), config->GetInnerIter(), config->GetJacobian_Lag(),
+                         config->GetJacobian_Lag_CFL_Factor(), Avg_CFL_Local, GetRes_RMS(0));
+}
+
 void CEulerSolver::SetUpwind_Ducros_Sensor(CGeometry *geometry, CConfig *config){
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -4302,6 +4618,31 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   bool viscous        = config->GetViscous();
   bool tkeNeeded = config->GetKind_Turb_Model() == TURB_MODEL::SST;
 
+  /*--- Vectorized convective fluxes, packs of vertices of the marker are processed together.
+   * The scalar loop below then only adds the viscous terms (with the stored boundary state). ---*/
+
+  const bool vectorized = (farfieldNumerics != nullptr) && !VertexGeometry.empty();
+
+  if (vectorized) {
+    const auto& vertexCache = VertexGeometry[val_marker];
+    su2double refState[MAXNDIM+4] = {0.0};
+    for (iDim = 0; iDim < nDim; iDim++) refState[iDim+1] = GetVelocity_Inf(iDim);
+    refState[nDim+1] = GetPressure_Inf();
+    refState[nDim+2] = GetDensity_Inf();
+
+    SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, Double::Size))
+    for (auto iPack = 0ul; iPack < vertexCache.GetNumPack(); ++iPack) {
+      Double mask;
+      for (auto k = 0ul; k < Double::Size; ++k) mask[k] = (iPack * Double::Size + k < vertexCache.GetNumVertex());
+
+      farfieldNumerics->ComputeFlux(*config, *nodes, vertexCache, iPack, mask, refState, CharacPrimVar[val_marker],
+                                    LinSysRes, Jacobian);
+    }
+    END_SU2_OMP_FOR
+
+    if (!viscous) return;
+  }
+
   auto *Normal = new su2double[nDim];
 
   /*--- Loop over all the vertices on this boundary marker ---*/
@@ -4472,18 +4813,20 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
                                   geometry->nodes->GetGridVel(iPoint));
       }
 
-      /*--- Compute the convective residual using an upwind scheme ---*/
+      /*--- Compute the convective residual using an upwind scheme, unless it was vectorized ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+      if (!vectorized) {
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
+        /*--- Update residual value ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Convective Jacobian contribution for implicit integration ---*/
+        /*--- Convective Jacobian contribution for implicit integration ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+      }
 
       /*--- Viscous residual contribution ---*/
 
@@ -5572,11 +5915,13 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
 }
 
 void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNumerics *conv_numerics, unsigned short marker_flag) {
-  /* Implementation of Fuorier Transformations for non-regfelcting BC will come soon */
+  /*--- Spatial Fourier transform, along the pitch, of the characteristic jumps of the turbomachinery boundaries.
+   * The jumps are computed once per vertex, the phasors of consecutive frequencies by recurrence, and the
+   * coefficients of all the spans and frequencies are reduced with a single collective. ---*/
   su2double cj_inf,cj_out1, cj_out2, Density_i, Pressure_i, *turboNormal, *turboVelocity, *Velocity_i, AverageSoundSpeed;
-  su2double *deltaprim, *cj, TwoPiThetaFreq_Pitch, pitch, theta, deltaTheta;
+  su2double *deltaprim, *cj, pitch, theta, deltaTheta, ThetaPitch, weight;
   unsigned short iMarker, iSpan, iMarkerTP, iDim;
-  unsigned long  iPoint, kend_max, k, iVertex;
+  unsigned long  iPoint, kend_max, nFreq, k, iVertex;
   long freq;
   unsigned short  iZone     = config->GetiZone();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(marker_flag);
@@ -5585,149 +5930,143 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
   Velocity_i    = new su2double[nDim];
   deltaprim     = new su2double[nVar];
   cj            = new su2double[nVar];
-  complex<su2double> I, expArg;
-  static complex<su2double> cktemp_inf, cktemp_out1, cktemp_out2;
-  I = complex<su2double>(0.0,1.0);
+  complex<su2double> expArg, expStep;
 
   kend_max = geometry->GetnFreqSpanMax(marker_flag);
+  nFreq = 2*kend_max+1;
+
+  /*--- Real and imaginary parts of the inflow, outflow1, and outflow2 coefficients, for each span and frequency. ---*/
+  static su2activematrix localCoeff, totalCoeff;
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    localCoeff.resize(nSpanWiseSections*nFreq, 6) = su2double(0.0);
+    totalCoeff.resize(nSpanWiseSections*nFreq, 6);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  vector<complex<su2double> > ck_inf(nFreq), ck_out1(nFreq), ck_out2(nFreq);
+
   for (iSpan= 0; iSpan < nSpanWiseSections ; iSpan++){
-    for(k=0; k < 2*kend_max+1; k++){
-      freq = k - kend_max;
-      SU2_OMP_MASTER
-      {
-        cktemp_inf = complex<su2double>(0.0,0.0);
-        cktemp_out1 = complex<su2double>(0.0,0.0);
-        cktemp_out2 = complex<su2double>(0.0,0.0);
-      } END_SU2_OMP_MASTER
-      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-        for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-          if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-            if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
-              complex<su2double> cktemp_inf_local{0.,0.},cktemp_out1_local{0.,0.}, cktemp_out2_local{0.,0.};
-              SU2_OMP_FOR_DYN(roundUpDiv(geometry->GetnVertexSpan(iMarker,iSpan), 2*omp_get_max_threads()))
-              for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+            for (k = 0; k < nFreq; k++) {
+              ck_inf[k] = ck_out1[k] = ck_out2[k] = complex<su2double>(0.0,0.0);
+            }
 
-                /*--- find the node related to the vertex ---*/
-                iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
+            pitch = geometry->GetMaxAngularCoord(iMarker, iSpan) - geometry->GetMinAngularCoord(iMarker,iSpan);
 
-                geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(turboNormal);
-                /*--- Compute the internal state _i ---*/
+            GetFluidModel()->SetTDState_Prho(AveragePressure[iMarker][iSpan], AverageDensity[iMarker][iSpan]);
+            AverageSoundSpeed = GetFluidModel()->GetSoundSpeed();
 
-                Pressure_i = nodes->GetPressure(iPoint);
-                Density_i = nodes->GetDensity(iPoint);
-                for (iDim = 0; iDim < nDim; iDim++)
-                {
-                  Velocity_i[iDim] = nodes->GetVelocity(iPoint,iDim);
-                }
-                
-                ComputeTurboVelocity(Velocity_i, turboNormal, turboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
-
-                if(nDim ==2){
-                  deltaprim[0] = Density_i - AverageDensity[iMarker][iSpan];
-                  deltaprim[1] = turboVelocity[0] - AverageTurboVelocity[iMarker][iSpan][0];
-                  deltaprim[2] = turboVelocity[1] - AverageTurboVelocity[iMarker][iSpan][1];
-                  deltaprim[3] = Pressure_i - AveragePressure[iMarker][iSpan];
-                }
-                else{
-                  //Here 3d
-                  deltaprim[0] = Density_i - AverageDensity[iMarker][iSpan];
-                  deltaprim[1] = turboVelocity[0] - AverageTurboVelocity[iMarker][iSpan][0];
-                  deltaprim[2] = turboVelocity[1] - AverageTurboVelocity[iMarker][iSpan][1];
-                  deltaprim[3] = turboVelocity[2] - AverageTurboVelocity[iMarker][iSpan][2]; //New char
-                  deltaprim[4] = Pressure_i - AveragePressure[iMarker][iSpan];
-                }
+            SU2_OMP_FOR_DYN(roundUpDiv(geometry->GetnVertexSpan(iMarker,iSpan), 2*omp_get_max_threads()))
+            for (iVertex = 0; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
 
-                GetFluidModel()->SetTDState_Prho(AveragePressure[iMarker][iSpan], AverageDensity[iMarker][iSpan]);
-                AverageSoundSpeed = GetFluidModel()->GetSoundSpeed();
-                conv_numerics->GetCharJump(AverageSoundSpeed, AverageDensity[iMarker][iSpan], deltaprim, cj);
+              /*--- find the node related to the vertex ---*/
+              iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
 
-                /*-----this is only valid 2D ----*/
-                if(nDim ==2){
-                  cj_out1 = cj[1];
-                  cj_out2 = cj[2];
-                  cj_inf  = cj[3];
-                }
-                else{
-                  //Here 3D
-                  cj_out1 = cj[1];
-                  cj_out2 = cj[3];
-                  cj_inf  = cj[4];
-                }
-                pitch      = geometry->GetMaxAngularCoord(iMarker, iSpan) - geometry->GetMinAngularCoord(iMarker,iSpan);
-                theta      = geometry->turbovertex[iMarker][iSpan][iVertex]->GetRelAngularCoord();
-                deltaTheta = geometry->turbovertex[iMarker][iSpan][iVertex]->GetDeltaAngularCoord();
-                TwoPiThetaFreq_Pitch = 2*PI_NUMBER*freq*theta/pitch;
+              geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(turboNormal);
+              /*--- Compute the internal state _i ---*/
+
+              Pressure_i = nodes->GetPressure(iPoint);
+              Density_i = nodes->GetDensity(iPoint);
+              for (iDim = 0; iDim < nDim; iDim++)
+              {
+                Velocity_i[iDim] = nodes->GetVelocity(iPoint,iDim);
+              }
+
+              ComputeTurboVelocity(Velocity_i, turboNormal, turboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+
+              if(nDim ==2){
+                deltaprim[0] = Density_i - AverageDensity[iMarker][iSpan];
+                deltaprim[1] = turboVelocity[0] - AverageTurboVelocity[iMarker][iSpan][0];
+                deltaprim[2] = turboVelocity[1] - AverageTurboVelocity[iMarker][iSpan][1];
+                deltaprim[3] = Pressure_i - AveragePressure[iMarker][iSpan];
+              }
+              else{
+                //Here 3d
+                deltaprim[0] = Density_i - AverageDensity[iMarker][iSpan];
+                deltaprim[1] = turboVelocity[0] - AverageTurboVelocity[iMarker][iSpan][0];
+                deltaprim[2] = turboVelocity[1] - AverageTurboVelocity[iMarker][iSpan][1];
+                deltaprim[3] = turboVelocity[2] - AverageTurboVelocity[iMarker][iSpan][2]; //New char
+                deltaprim[4] = Pressure_i - AveragePressure[iMarker][iSpan];
+              }
 
-                expArg = complex<su2double>(cos(TwoPiThetaFreq_Pitch)) - I*complex<su2double>(sin(TwoPiThetaFreq_Pitch));
+              conv_numerics->GetCharJump(AverageSoundSpeed, AverageDensity[iMarker][iSpan], deltaprim, cj);
+
+              /*-----this is only valid 2D ----*/
+              if(nDim ==2){
+                cj_out1 = cj[1];
+                cj_out2 = cj[2];
+                cj_inf  = cj[3];
+              }
+              else{
+                //Here 3D
+                cj_out1 = cj[1];
+                cj_out2 = cj[3];
+                cj_inf  = cj[4];
+              }
+              theta      = geometry->turbovertex[iMarker][iSpan][iVertex]->GetRelAngularCoord();
+              deltaTheta = geometry->turbovertex[iMarker][iSpan][iVertex]->GetDeltaAngularCoord();
+              weight     = deltaTheta/pitch;
+
+              /*--- exp(-i*2*pi*freq*theta/pitch), starting from freq = -kend_max. ---*/
+              ThetaPitch = 2*PI_NUMBER*theta/pitch;
+              expStep = complex<su2double>(cos(ThetaPitch), -sin(ThetaPitch));
+              expArg  = complex<su2double>(cos(kend_max*ThetaPitch), sin(kend_max*ThetaPitch));
+
+              for(k=0; k < nFreq; k++){
+                freq = k - kend_max;
                 if (freq != 0){
-                  cktemp_out1_local +=  cj_out1*expArg*deltaTheta/pitch;
-                  cktemp_out2_local +=  cj_out2*expArg*deltaTheta/pitch;
-                  cktemp_inf_local  +=  cj_inf*expArg*deltaTheta/pitch;
-                }
-                else{
-                  cktemp_inf_local += complex<su2double>(0.0,0.0);
-                  cktemp_out1_local += complex<su2double>(0.0,0.0);
-                  cktemp_out2_local += complex<su2double>(0.0,0.0);
+                  ck_out1[k] += cj_out1*expArg*weight;
+                  ck_out2[k] += cj_out2*expArg*weight;
+                  ck_inf[k]  += cj_inf*expArg*weight;
                 }
+                expArg *= expStep;
               }
-              END_SU2_OMP_FOR
-              SU2_OMP_CRITICAL
-              {
-                cktemp_inf += cktemp_inf_local;
-                cktemp_out1 += cktemp_out1_local;
-                cktemp_out2 += cktemp_out2_local;
-              } END_SU2_OMP_CRITICAL
             }
+            END_SU2_OMP_FOR
+            SU2_OMP_CRITICAL
+            {
+              for (k = 0; k < nFreq; k++) {
+                su2double* coeff = localCoeff[iSpan*nFreq + k];
+                coeff[0] += ck_inf[k].real();  coeff[1] += ck_inf[k].imag();
+                coeff[2] += ck_out1[k].real(); coeff[3] += ck_out1[k].imag();
+                coeff[4] += ck_out2[k].real(); coeff[5] += ck_out2[k].imag();
+              }
+            } END_SU2_OMP_CRITICAL
           }
         }
       }
+    }
+  }
 
-      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
-      {
-#ifdef HAVE_MPI
-        su2double MyRe_inf = cktemp_inf.real(); su2double Re_inf = 0.0;
-        su2double MyIm_inf = cktemp_inf.imag(); su2double Im_inf = 0.0;
-        cktemp_inf = complex<su2double>(0.0,0.0);
-
-        su2double MyRe_out1 = cktemp_out1.real(); su2double Re_out1 = 0.0;
-        su2double MyIm_out1 = cktemp_out1.imag(); su2double Im_out1 = 0.0;
-        cktemp_out1 = complex<su2double>(0.0,0.0);
-
-        su2double MyRe_out2 = cktemp_out2.real(); su2double Re_out2 = 0.0;
-        su2double MyIm_out2 = cktemp_out2.imag(); su2double Im_out2 = 0.0;
-        cktemp_out2 = complex<su2double>(0.0,0.0);
-
-
-        SU2_MPI::Allreduce(&MyRe_inf, &Re_inf, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyIm_inf, &Im_inf, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyRe_out1, &Re_out1, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyIm_out1, &Im_out1, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyRe_out2, &Re_out2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        SU2_MPI::Allreduce(&MyIm_out2, &Im_out2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-        cktemp_inf = complex<su2double>(Re_inf,Im_inf);
-        cktemp_out1 = complex<su2double>(Re_out1,Im_out1);
-        cktemp_out2 = complex<su2double>(Re_out2,Im_out2);
-#endif
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    SU2_MPI::Allreduce(localCoeff.data(), totalCoeff.data(), localCoeff.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
-        for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-          for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-            if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-              if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+      for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
+            for (iSpan= 0; iSpan < nSpanWiseSections ; iSpan++){
+              for (k = 0; k < nFreq; k++) {
+                const su2double* coeff = totalCoeff[iSpan*nFreq + k];
                 /*-----this is only valid 2D ----*/
                 if (marker_flag == INFLOW){
-                  CkInflow[iMarker][iSpan][k]= cktemp_inf;
+                  CkInflow[iMarker][iSpan][k] = complex<su2double>(coeff[0], coeff[1]);
                 }else{
-                  CkOutflow1[iMarker][iSpan][k]=cktemp_out1;
-                  CkOutflow2[iMarker][iSpan][k]=cktemp_out2;
+                  CkOutflow1[iMarker][iSpan][k] = complex<su2double>(coeff[2], coeff[3]);
+                  CkOutflow2[iMarker][iSpan][k] = complex<su2double>(coeff[4], coeff[5]);
                 }
               }
             }
           }
         }
-      } END_SU2_OMP_SAFE_GLOBAL_ACCESS
+      }
     }
-  }
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
   delete [] turboVelocity;
   delete [] turboNormal;
@@ -5756,7 +6095,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   su2double relfacAvgCfg       = config->GetGiles_RelaxFactorAverage(Marker_Tag);
   su2double relfacFouCfg       = config->GetGiles_RelaxFactorFourier(Marker_Tag);
   su2double *Normal;
-  su2double TwoPiThetaFreq_Pitch, pitch,theta;
+  su2double ThetaPitch, pitch,theta;
   const su2double *SpanWiseValues = nullptr, *FlowDir;
   su2double spanPercent, extrarelfacAvg = 0.0, deltaSpan = 0.0, relfacAvg, relfacFou, coeffrelfacAvg = 0.0;
   unsigned short Turbo_Flag;
@@ -5801,7 +6140,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   }
 
 
-  complex<su2double> I, c2ks, c2js, c3ks, c3js, cOutks, cOutjs, Beta_inf;
+  complex<su2double> I, c2ks, c2js, c3ks, c3js, cOutks, cOutjs, Beta_inf, expArg, expStep;
   I = complex<su2double>(0.0,1.0);
 
   /*--- Compute coeff for under relaxation of Avg and Fourier Coefficient for hub and shroud---*/
@@ -6133,21 +6472,20 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
             Beta_inf= I*complex<su2double>(sqrt(1.0 - AvgMach));
             c2js = complex<su2double>(0.0,0.0);
             c3js = complex<su2double>(0.0,0.0);
+            /*--- exp(i*2*pi*freq*theta/pitch) by recurrence, starting from freq = -kend_max. ---*/
+            ThetaPitch = 2*PI_NUMBER*theta/pitch;
+            expStep = complex<su2double>(cos(ThetaPitch), sin(ThetaPitch));
+            expArg  = complex<su2double>(cos(kend_max*ThetaPitch), -sin(kend_max*ThetaPitch));
             for(k=0; k < 2*kend_max+1; k++){
               freq = k - kend_max;
               if(freq >= (long)(-kend) && freq <= (long)(kend) && AverageTurboMach[0] > config->GetAverageMachLimit()){
-                TwoPiThetaFreq_Pitch = 2*PI_NUMBER*freq*theta/pitch;
-
                 c2ks = -CkInflow[val_marker][iSpan][k]*complex<su2double>(Beta_inf + AverageTurboMach[1])/complex<su2double>( 1.0 + AverageTurboMach[0]);
                 c3ks =  CkInflow[val_marker][iSpan][k]*complex<su2double>(Beta_inf + AverageTurboMach[1])/complex<su2double>( 1.0 + AverageTurboMach[0]);
                 c3ks *= complex<su2double>(Beta_inf + AverageTurboMach[1])/complex<su2double>( 1.0 + AverageTurboMach[0]);
-                c2js += c2ks*(complex<su2double>(cos(TwoPiThetaFreq_Pitch))+I*complex<su2double>(sin(TwoPiThetaFreq_Pitch)));
-                c3js += c3ks*(complex<su2double>(cos(TwoPiThetaFreq_Pitch))+I*complex<su2double>(sin(TwoPiThetaFreq_Pitch)));
-              }
-              else{
-                c2js += complex<su2double>(0.0,0.0);
-                c3js += complex<su2double>(0.0,0.0);
+                c2js += c2ks*expArg;
+                c3js += c3ks*expArg;
               }
+              expArg *= expStep;
             }
             c2js_Re = c2js.real();
             c3js_Re = c3js.real();
@@ -6246,18 +6584,19 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
             /* --- subsonic Giles implementation ---*/
             Beta_inf= I*complex<su2double>(sqrt(1.0  - AvgMach));
             cOutjs  = complex<su2double>(0.0,0.0);
+            /*--- exp(i*2*pi*freq*theta/pitch) by recurrence, starting from freq = -kend_max. ---*/
+            ThetaPitch = 2*PI_NUMBER*theta/pitch;
+            expStep = complex<su2double>(cos(ThetaPitch), sin(ThetaPitch));
+            expArg  = complex<su2double>(cos(kend_max*ThetaPitch), -sin(kend_max*ThetaPitch));
             for(k=0; k < 2*kend_max+1; k++){
               freq = k - kend_max;
               if(freq >= (long)(-kend) && freq <= (long)(kend) && AverageTurboMach[0] > config->GetAverageMachLimit()){
-                TwoPiThetaFreq_Pitch = 2*PI_NUMBER*freq*theta/pitch;
                 cOutks  = complex<su2double>(2.0 * AverageTurboMach[0])/complex<su2double>(Beta_inf - AverageTurboMach[1])*CkOutflow1[val_marker][iSpan][k];
                 cOutks -= complex<su2double>(Beta_inf + AverageTurboMach[1])/complex<su2double>(Beta_inf - AverageTurboMach[1])*CkOutflow2[val_marker][iSpan][k];
 
-                cOutjs += cOutks*(complex<su2double>(cos(TwoPiThetaFreq_Pitch)) + I*complex<su2double>(sin(TwoPiThetaFreq_Pitch)));
-              }
-              else{
-                cOutjs +=complex<su2double>(0.0,0.0);
+                cOutjs += cOutks*expArg;
               }
+              expArg *= expStep;
             }
             cOutjs_Re = cOutjs.real();
 
@@ -8618,6 +8957,33 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
+  /*--- The sums over the vertices of each span are packed in one buffer (one row per span), such
+   *    that a single reduction is needed instead of one per quantity and span. ---*/
+
+  const unsigned long nSums = 15 + nVar + 3*nDim;
+  vector<su2double> SpanSums((nSpanWiseSections + 1) * nSums);
+
+  auto SyncSums = [&](su2double* sums, bool pack) {
+    unsigned long k = 0;
+    auto sync = [&](su2double& x) {
+      if (pack) sums[k] = x;
+      else x = sums[k];
+      ++k;
+    };
+    sync(TotalDensity);      sync(TotalPressure);
+    sync(TotalAreaDensity);  sync(TotalAreaPressure);
+    sync(TotalMassDensity);  sync(TotalMassPressure);
+    sync(TotalNu);           sync(TotalKine);         sync(TotalOmega);
+    sync(TotalAreaNu);       sync(TotalAreaKine);     sync(TotalAreaOmega);
+    sync(TotalMassNu);       sync(TotalMassKine);     sync(TotalMassOmega);
+    for (unsigned short i = 0; i < nVar; i++) sync(TotalFluxes[i]);
+    for (unsigned short i = 0; i < nDim; i++) {
+      sync(TotalVelocity[i]);
+      sync(TotalAreaVelocity[i]);
+      sync(TotalMassVelocity[i]);
+    }
+  };
+
   for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
     /*--- Forces initialization for contenitors ---*/
@@ -8811,49 +9177,21 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
       }
     }
 
-#ifdef HAVE_MPI
-
-    /*--- Add information using all the nodes ---*/
+    SyncSums(&SpanSums[iSpan*nSums], true);
+  }
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
+  /*--- Add information using all the nodes, for all spans at once. ---*/
 
-    TotalDensity = Allreduce(TotalDensity);
-    TotalPressure = Allreduce(TotalPressure);
-    TotalAreaDensity = Allreduce(TotalAreaDensity);
-    TotalAreaPressure = Allreduce(TotalAreaPressure);
-    TotalMassDensity = Allreduce(TotalMassDensity);
-    TotalMassPressure = Allreduce(TotalMassPressure);
-
-    TotalNu = Allreduce(TotalNu);
-    TotalKine = Allreduce(TotalKine);
-    TotalOmega = Allreduce(TotalOmega);
-    TotalAreaNu = Allreduce(TotalAreaNu);
-    TotalAreaKine = Allreduce(TotalAreaKine);
-    TotalAreaOmega = Allreduce(TotalAreaOmega);
-
-    TotalMassNu = Allreduce(TotalMassNu);
-    TotalMassKine = Allreduce(TotalMassKine);
-    TotalMassOmega = Allreduce(TotalMassOmega);
-
-    auto* buffer = new su2double[max(nVar,nDim)];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nVar, TotalFluxes);
-    Allreduce_inplace(nDim, TotalVelocity);
-    Allreduce_inplace(nDim, TotalAreaVelocity);
-    Allreduce_inplace(nDim, TotalMassVelocity);
+#ifdef HAVE_MPI
+  {
+    auto tmp = SpanSums;
+    SU2_MPI::Allreduce(tmp.data(), SpanSums.data(), SpanSums.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+#endif
 
-    delete [] buffer;
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
-#endif
+    SyncSums(&SpanSums[iSpan*nSums], false);
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
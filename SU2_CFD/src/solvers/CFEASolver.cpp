@@ -59,6 +59,7 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   element_based = false;
   topol_filter_applied = false;
   initial_calc = true;
+  modal = config->GetModal_Superposition();
 
   /*--- Here is where we assign the kind of each element ---*/
 
@@ -104,6 +105,12 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
 
   nVar = nDim;
 
+  if (config->GetRelaxation_Method_BGS() == BGS_RELAXATION::QUASI_NEWTON) {
+    /*--- Displacements, and velocities for dynamic problems. ---*/
+    QNRelaxation.resize(config->GetnQuasiNewtonSamples(), nPoint, (dynamic ? 2 : 1) * nDim, nPointDomain);
+    QNRelaxation.setFilterTolerance(SU2_TYPE::GetValue(config->GetQuasiNewtonFilterTol()));
+  }
+
   /*--- Define some auxiliary vectors related to the residual ---*/
 
   Residual_RMS.resize(nVar,0.0);
@@ -150,8 +157,11 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
 
   Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
-  if (dynamic) {
+  /*--- The modal superposition also needs the mass matrix to normalize the modes. ---*/
+  if (dynamic || modal) {
     MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
+  if (dynamic) {
     TimeRes_Aux.Initialize(nPoint, nPointDomain, nVar, 0.0);
     TimeRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   }
@@ -740,6 +750,9 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  tangent_updated = true;
+  tangent_age = 0;
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -1044,6 +1057,8 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  tangent_updated = false;
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -1781,6 +1796,26 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CConfig *config, CNumerics
     }
     END_SU2_OMP_PARALLEL
   }
+  else if (modal) {
+
+    /*--- The modal equations are solved exactly, monitor the change of the displacements instead. ---*/
+
+    SU2_OMP_PARALLEL {
+    su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+    unsigned long idxMax[MAXNVAR] = {0};
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        ResidualReductions_PerThread(iPoint, iVar, LinSysSol(iPoint, iVar), resRMS, resMax, idxMax);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    ResidualReductions_FromAllThreads(geometry, config, resRMS,resMax,idxMax);
+    }
+    END_SU2_OMP_PARALLEL
+  }
   else {
 
     /*--- If the problem is linear, the only check we do is the RMS of the residuals. ---*/
@@ -2100,11 +2135,9 @@ su2double CFEASolver::Compute_LoadCoefficient(su2double CurrentTime, su2double R
 
 void CFEASolver::ImplicitNewmark_Iteration(const CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
-  const bool first_iter = (config->GetInnerIter() == 0);
   const bool dynamic = (config->GetTime_Domain());
   const bool linear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::SMALL);
   const bool nonlinear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::LARGE);
-  const bool newton_raphson = (config->GetKind_SpaceIteScheme_FEA() == STRUCT_SPACE_ITE::NEWTON);
   const bool body_forces = config->GetDeadLoad();
 
   /*--- For simplicity, no incremental loading is handled with increment of 1. ---*/
@@ -2150,15 +2183,15 @@ void CFEASolver::ImplicitNewmark_Iteration(const CGeometry *geometry, CNumerics
       /*--- Add the mass matrix contribution to the Jacobian. ---*/
 
       /*
-       * If the problem is nonlinear, we need to add the Mass Matrix contribution to the Jacobian at the beginning
-       * of each time step. If the solution method is Newton Rapshon, we repeat this step at the beginning of each
-       * iteration, as the Jacobian is recomputed.
+       * If the problem is nonlinear, we need to add the Mass Matrix contribution to the Jacobian whenever the
+       * tangent is recomputed, i.e. every iteration for Newton Rapshon, and at the beginning of each time step
+       * (or less often, see RequiresTangentUpdate) for the modified methods.
        *
        * If the problem is linear, we add the Mass Matrix contribution to the Jacobian everytime because for
        * correct differentiation the Jacobian is recomputed every time step.
        *
        */
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if ((nonlinear_analysis && tangent_updated) || linear_analysis) {
         Jacobian.MatrixMatrixAddition(SU2_TYPE::GetValue(a_dt[0]), MassMatrix);
       }
 
@@ -2288,11 +2321,9 @@ void CFEASolver::ImplicitNewmark_Relaxation(const CGeometry *geometry, const CCo
 
 void CFEASolver::GeneralizedAlpha_Iteration(const CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
-  const bool first_iter = (config->GetInnerIter() == 0);
   const bool dynamic = (config->GetTime_Domain());
   const bool linear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::SMALL);
   const bool nonlinear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::LARGE);
-  const bool newton_raphson = (config->GetKind_SpaceIteScheme_FEA() == STRUCT_SPACE_ITE::NEWTON);
   const bool body_forces = config->GetDeadLoad();
 
   /*--- Blend between previous and current timestep. ---*/
@@ -2342,7 +2373,7 @@ void CFEASolver::GeneralizedAlpha_Iteration(const CGeometry *geometry, CNumerics
       /*--- Add the mass matrix contribution to the Jacobian. ---*/
 
       /*--- See notes on logic in ImplicitNewmark_Iteration(). ---*/
-      if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
+      if ((nonlinear_analysis && tangent_updated) || linear_analysis) {
         Jacobian.MatrixMatrixAddition(SU2_TYPE::GetValue(a_dt[0]), MassMatrix);
       }
 
@@ -2473,8 +2504,35 @@ void CFEASolver::GeneralizedAlpha_UpdateLoads(const CGeometry *geometry, const C
 
 }
 
+bool CFEASolver::RequiresTangentUpdate(const CConfig *config) const {
+
+  const bool first_iter = (config->GetInnerIter() == 0);
+
+  if (config->GetKind_SpaceIteScheme_FEA() == STRUCT_SPACE_ITE::NEWTON || tangent_age == 0) return true;
+
+  /*--- No monitoring for the discrete adjoint, update at the beginning of each time step. ---*/
+  if (config->GetDiscrete_Adjoint()) return first_iter;
+
+  /*--- By default the tangent is updated at the beginning of each time step, otherwise it may be kept for up
+   * to NONLINEAR_FEM_TANGENT_REUSE solves. Within a time step it is also updated when the residual stops
+   * decreasing fast enough, which is what limits the number of iterations of modified Newton methods. ---*/
+  const auto maxAge = config->GetFEA_Tangent_Reuse();
+
+  if (first_iter) return (maxAge == 0) || (tangent_age >= maxAge);
+
+  return (maxAge > 0 && tangent_age >= maxAge) || (res_ratio > config->GetFEA_Tangent_Refresh());
+}
+
 void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 
+  const bool first_iter = (config->GetInnerIter() == 0);
+  const bool nonlinear_analysis = (config->GetGeometricConditions() == STRUCT_DEFORMATION::LARGE);
+  const auto kindIte = config->GetKind_SpaceIteScheme_FEA();
+
+  /*--- Residual monitoring and BFGS updates for the methods that reuse the tangent. ---*/
+  const bool monitor = nonlinear_analysis && (kindIte != STRUCT_SPACE_ITE::NEWTON) && !config->GetDiscrete_Adjoint();
+  const bool bfgs = monitor && (kindIte == STRUCT_SPACE_ITE::BFGS);
+
   /*--- Enforce solution at some halo points possibly not covered by essential BC markers. ---*/
   CSysMatrixComms::Initiate(LinSysSol, geometry, config);
   CSysMatrixComms::Complete(LinSysSol, geometry, config);
@@ -2483,6 +2541,39 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
     Jacobian.EnforceSolutionAtNode(iPoint, LinSysSol.GetBlock(iPoint), LinSysRes);
   }
 
+  /*--- If the tangent was kept, so is the preconditioner (the mass matrix and BCs do not change it either). ---*/
+  System.SetMatrixUnchanged(monitor && !tangent_updated);
+  ++tangent_age;
+
+  /*--- The BFGS pairs are only valid for the current tangent and time step, the previous step and residual
+   * form a new pair, the oldest is discarded when the buffer is full. Storage is allocated as needed. ---*/
+  bool newPair = false;
+  unsigned long slot = 0;
+  if (bfgs) {
+    if (first_iter || tangent_updated) {
+      bfgs_nPairs = 0;
+      bfgs_head = 0;
+    }
+    else {
+      newPair = true;
+      if (bfgs_nPairs == MAX_BFGS_PAIRS) {
+        bfgs_head = (bfgs_head + 1) % MAX_BFGS_PAIRS;
+        --bfgs_nPairs;
+      }
+      slot = (bfgs_head + bfgs_nPairs) % MAX_BFGS_PAIRS;
+      if (slot == bfgs_s.size()) {
+        bfgs_s.emplace_back();
+        bfgs_y.emplace_back();
+        bfgs_s.back().Initialize(nPoint, nPointDomain, nVar, 0.0);
+        bfgs_y.back().Initialize(nPoint, nPointDomain, nVar, 0.0);
+      }
+    }
+    if (bfgs_res.GetLocSize() == 0) {
+      bfgs_res.Initialize(nPoint, nPointDomain, nVar, 0.0);
+      bfgs_step.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    }
+  }
+
   SU2_OMP_PARALLEL
   {
   /*--- This is required for the discrete adjoint. ---*/
@@ -2490,10 +2581,61 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
   for (auto i = nPointDomain*nVar; i < nPoint*nVar; ++i) LinSysRes[i] = 0.0;
   END_SU2_OMP_FOR
 
+  if (monitor) {
+    const su2double resNorm = LinSysRes.norm();
+    SU2_OMP_MASTER {
+      res_ratio = first_iter ? su2double(0.0) : resNorm / fmax(res_norm_prev, EPS);
+      res_norm_prev = resNorm;
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- First loop of the BFGS two-loop recursion, from the newest to the oldest pair, the linear solve
+   * with the tangent then acts as the initial inverse Hessian, and the second loop follows the solve.
+   * With s the step and y the reduction of the residual r, H_k = (I-rho.s.y^T) H_{k-1} (I-rho.y.s^T) + rho.s.s^T
+   * and the step is H_k r. Pairs with s.y <= 0 would make H_k indefinite and are skipped. ---*/
+  su2double alpha[MAX_BFGS_PAIRS] = {0.0};
+
+  if (bfgs) {
+    if (newPair) {
+      bfgs_s[slot] = bfgs_step;
+      bfgs_y[slot] = bfgs_res - LinSysRes;
+      const su2double sy = bfgs_s[slot].dot(bfgs_y[slot]);
+      SU2_OMP_MASTER
+      {
+        if (sy > 0.0) {
+          bfgs_rho[slot] = 1.0 / sy;
+          ++bfgs_nPairs;
+        }
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+    bfgs_res = LinSysRes;
+
+    for (auto j = bfgs_nPairs; j > 0; --j) {
+      const auto i = (bfgs_head + j - 1) % MAX_BFGS_PAIRS;
+      alpha[j-1] = bfgs_rho[i] * bfgs_s[i].dot(LinSysRes);
+      LinSysRes -= alpha[j-1] * bfgs_y[i];
+    }
+  }
+
   /*--- Solve or smooth the linear system. ---*/
 
   auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
+  if (bfgs) {
+    for (auto j = 0ul; j < bfgs_nPairs; ++j) {
+      const auto i = (bfgs_head + j) % MAX_BFGS_PAIRS;
+      const su2double beta = bfgs_rho[i] * bfgs_y[i].dot(LinSysSol);
+      LinSysSol += (alpha[j] - beta) * bfgs_s[i];
+    }
+    bfgs_step = LinSysSol;
+
+    /*--- Restore the residual for the convergence checks. ---*/
+    LinSysRes = bfgs_res;
+  }
+
   SU2_OMP_MASTER
   {
     SetIterLinSolver(iter);
@@ -2507,6 +2649,473 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 }
 
 
+/*--- Product of a matrix (of any precision) with a vector, the result is multiplied by a mask. ---*/
+template<class T>
+void maskedMatrixProduct(const CSysMatrix<T>& A, const CSysVector<su2double>& mask, const CSysVector<su2double>& x,
+                         CSysVector<su2double>& y, CGeometry *geometry, const CConfig *config) {
+  CSysVector<T> xtmp(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+  CSysVector<T> ytmp(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(x.GetLocSize(), omp_get_num_threads(), 1024))
+    for (auto i = 0ul; i < x.GetLocSize(); ++i) xtmp[i] = SU2_TYPE::GetValue(x[i]);
+    END_SU2_OMP_FOR
+
+    A.MatrixVectorProduct(xtmp, ytmp, geometry, config);
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(x.GetLocSize(), omp_get_num_threads(), 1024))
+    for (auto i = 0ul; i < x.GetLocSize(); ++i) y[i] = ytmp[i] * mask[i];
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+/*--- Dot product called from outside parallel regions. ---*/
+su2double parallelDot(const CSysVector<su2double>& a, const CSysVector<su2double>& b) {
+  su2double result = 0.0;
+  SU2_OMP_PARALLEL {
+    const su2double dot = a.dot(b);
+    SU2_OMP_MASTER
+    result = dot;
+    END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+  return result;
+}
+
+void CFEASolver::Modal_Iteration(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  const bool dynamic = config->GetTime_Domain();
+  const bool body_forces = config->GetDeadLoad();
+  const su2double zeta = config->GetModal_Damping();
+
+  /*--- For simplicity, no incremental loading is handled with increment of 1. ---*/
+  const su2double loadIncr = config->GetIncrementalLoad()? loadIncrement : su2double(1.0);
+
+  if (modeShapes.empty()) SetModes(geometry, numerics, config);
+  const auto nModes = modeShapes.size();
+
+  /*--- At the start (possibly from a restart) and at each new time step, the state at time n, which includes
+   * the relaxation of the FSI coupling, is projected on the modes. ---*/
+  const bool newTimeStep = dynamic && (!modalStateReady || config->GetTimeIter() != modalTimeIter);
+  modalStateReady = true;
+  modalTimeIter = config->GetTimeIter();
+
+  vector<su2double> modalForce(nModes, 0.0);
+
+  SU2_OMP_PARALLEL
+  {
+    if (newTimeStep) {
+      vector<su2double>* modalState[] = {&modalDisp_n, &modalVel_n, &modalAccel_n};
+
+      for (auto iState = 0u; iState < 3; ++iState) {
+        SU2_OMP_FOR_STAT(omp_chunk_size)
+        for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+          for (auto iVar = 0u; iVar < nVar; iVar++) {
+            switch (iState) {
+              case 0: LinSysSol(iPoint,iVar) = nodes->GetSolution_time_n(iPoint,iVar); break;
+              case 1: LinSysSol(iPoint,iVar) = nodes->GetSolution_Vel_time_n(iPoint,iVar); break;
+              case 2: LinSysSol(iPoint,iVar) = nodes->GetSolution_Accel_time_n(iPoint,iVar); break;
+            }
+          }
+        }
+        END_SU2_OMP_FOR
+
+        for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+          const su2double q = massModes[iMode].dot(LinSysSol);
+          SU2_OMP_MASTER
+          (*modalState[iState])[iMode] = q;
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+
+    /*--- Nodal loads, as in ImplicitNewmark_Iteration. ---*/
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        su2double load = nodes->Get_SurfaceLoad_Res(iPoint,iVar) + nodes->Get_FlowTraction(iPoint,iVar);
+        if (body_forces) load += nodes->Get_BodyForces_Res(iPoint,iVar);
+        LinSysRes(iPoint,iVar) = loadIncr * load;
+      }
+    }
+    END_SU2_OMP_FOR
+
+    for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+      const su2double f = modeShapes[iMode].dot(LinSysRes);
+      SU2_OMP_MASTER
+      modalForce[iMode] = f;
+      END_SU2_OMP_MASTER
+    }
+
+    /*--- Solve the modal equations, q'' + 2 zeta w q' + w^2 q = f, with the Newmark scheme (or statically). ---*/
+
+    SU2_OMP_MASTER
+    {
+      for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+        const su2double k = pow(modeOmega[iMode], 2);
+        const su2double c = 2 * zeta * modeOmega[iMode];
+
+        if (dynamic) {
+          const su2double q_n = modalDisp_n[iMode], v_n = modalVel_n[iMode], a_n = modalAccel_n[iMode];
+          const su2double rhs = modalForce[iMode] + (a_dt[0]*q_n + a_dt[2]*v_n + a_dt[3]*a_n) +
+                                c * (a_dt[1]*q_n + a_dt[4]*v_n + a_dt[5]*a_n);
+          modalDisp[iMode] = rhs / (k + a_dt[0] + a_dt[1]*c);
+          modalAccel[iMode] = a_dt[0]*(modalDisp[iMode] - q_n) - a_dt[2]*v_n - a_dt[3]*a_n;
+          modalVel[iMode] = v_n + a_dt[6]*a_n + a_dt[7]*modalAccel[iMode];
+        }
+        else {
+          /*--- Rigid body modes cannot balance static loads, they are ignored. ---*/
+          modalDisp[iMode] = (k > 0.0)? su2double(modalForce[iMode] / k) : su2double(0.0);
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- Superpose the modes, the increment is kept in LinSysSol for monitoring. ---*/
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        su2double disp = 0.0, vel = 0.0, accel = 0.0;
+        for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+          const su2double phi = modeShapes[iMode](iPoint,iVar);
+          disp += phi * modalDisp[iMode];
+          vel += phi * modalVel[iMode];
+          accel += phi * modalAccel[iMode];
+        }
+        LinSysSol(iPoint,iVar) = disp - nodes->GetSolution(iPoint,iVar);
+        nodes->SetSolution(iPoint, iVar, disp);
+        if (dynamic) {
+          nodes->SetSolution_Vel(iPoint, iVar, vel);
+          nodes->SetSolution_Accel(iPoint, iVar, accel);
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
+void CFEASolver::SetModes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  /*--- Already computed in Preprocessing for dynamic problems. ---*/
+  if (!config->GetTime_Domain()) Compute_MassMatrix(geometry, numerics, config);
+
+  if (!ReadModes(geometry, config)) {
+    ComputeModes(geometry, numerics, config);
+    WriteModes(geometry, config);
+  }
+  const auto nModes = modeShapes.size();
+
+  /*--- Normalize w.r.t. the mass matrix of this model (modes from other sources may use a different one),
+   * and keep M.phi to project the nodal state on the modes. No mask, the modes satisfy the BCs. ---*/
+
+  const CSysVector<su2double> noMask(nPoint, nPointDomain, nVar, 1.0);
+  massModes.assign(nModes, CSysVector<su2double>(nPoint, nPointDomain, nVar, 0.0));
+
+  for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+    maskedMatrixProduct(MassMatrix, noMask, modeShapes[iMode], massModes[iMode], geometry, config);
+    const su2double scale = 1.0 / sqrt(parallelDot(modeShapes[iMode], massModes[iMode]));
+    SU2_OMP_PARALLEL {
+      modeShapes[iMode] *= scale;
+      massModes[iMode] *= scale;
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  for (auto* state : {&modalDisp, &modalVel, &modalAccel, &modalDisp_n, &modalVel_n, &modalAccel_n})
+    state->assign(nModes, 0.0);
+
+  if (rank == MASTER_NODE) {
+    cout << "Structural modes, frequency (Hz):";
+    for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+      cout << ((iMode % 5 == 0)? "\n" : "  ") << setw(14) << modeOmega[iMode] / (2 * PI_NUMBER);
+    }
+    cout << endl;
+  }
+
+}
+
+void CFEASolver::ComputeModes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  const unsigned long nModes = config->GetnModes_FEA();
+  const unsigned long nVec = min(2 * nModes, nModes + 8);
+  const unsigned long maxIter = 100;
+  const passivedouble tolerance = 1e-6;
+
+  if (rank == MASTER_NODE)
+    cout << "Computing " << nModes << " structural modes by subspace iteration." << endl;
+
+  /*--- Stiffness matrix with the essential BCs, the constrained DOFs are found by setting the residual to 1 before
+   * applying the BCs with 0 solution, which sets it to 0 at those DOFs. Imposed displacements are clamped. ---*/
+
+  Compute_StiffMatrix(geometry, numerics, config);
+
+  SU2_OMP_PARALLEL {
+    LinSysRes = su2double(1.0);
+    LinSysSol.SetValZero();
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    switch (config->GetMarker_All_KindBC(iMarker)) {
+      case CLAMPED_BOUNDARY:
+      case DISP_DIR_BOUNDARY:
+        BC_Clamped(geometry, config, iMarker);
+        break;
+      case SYMMETRY_PLANE:
+        BC_Sym_Plane(geometry, config, iMarker);
+        break;
+    }
+  }
+  const su2double zeros[MAXNVAR] = {0.0};
+  for (auto iPoint : ExtraVerticesToEliminate) Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+
+  const CSysVector<su2double> mask(LinSysRes);
+
+  /*--- Starting subspace, uniform displacements and pseudo-random vectors (independent of the partitioning). ---*/
+
+  vector<CSysVector<su2double> > X(nVec, CSysVector<su2double>(nPoint, nPointDomain, nVar, 0.0)), MX(X), Y(X);
+
+  for (auto iVec = 0ul; iVec < nVec; ++iVec) {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto iGlobal = geometry->nodes->GetGlobalIndex(iPoint);
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        const passivedouble hash = sin(1.0 + 12.9898 * (iGlobal * nVar + iVar) + 78.233 * iVec);
+        X[iVec](iPoint,iVar) = mask(iPoint,iVar) * ((iVec == 0)? 1.0 : hash);
+      }
+    }
+  }
+
+  /*--- Subspace iteration (Bathe), solve K Y = M X, project K and M on Y, i.e. Kr = Y^T M X and Mr = Y^T M Y,
+   * solve the small generalized eigenproblem Kr Z = Mr Z L, and the new subspace is X = Y Z. The Ritz values
+   * converge to the lowest eigenvalues (w^2) and X to the M-orthonormal modes. ---*/
+
+  su2activematrix Kr(nVec,nVec), Mr(nVec,nVec), L(nVec,nVec), C(nVec,nVec), W(nVec,nVec), Z(nVec,nVec);
+  vector<su2double> lambda(nVec, 0.0), lambdaOld(nVec, 0.0), work(nVec, 0.0);
+
+  /*--- The matrix is the same for all solves. ---*/
+  System.SetMatrixUnchanged(false);
+
+  unsigned long iter = 0;
+  bool converged = false;
+
+  for (; iter < maxIter && !converged; ++iter) {
+
+    for (auto iVec = 0ul; iVec < nVec; ++iVec) {
+      maskedMatrixProduct(MassMatrix, mask, X[iVec], MX[iVec], geometry, config);
+      SU2_OMP_PARALLEL {
+        Y[iVec].SetValZero();
+        System.Solve(Jacobian, MX[iVec], Y[iVec], geometry, config);
+      }
+      END_SU2_OMP_PARALLEL
+      System.SetMatrixUnchanged(true);
+    }
+
+    for (auto i = 0ul; i < nVec; ++i)
+      for (auto j = 0ul; j < nVec; ++j) Kr(i,j) = parallelDot(Y[i], MX[j]);
+
+    for (auto iVec = 0ul; iVec < nVec; ++iVec)
+      maskedMatrixProduct(MassMatrix, mask, Y[iVec], MX[iVec], geometry, config);
+
+    for (auto i = 0ul; i < nVec; ++i)
+      for (auto j = 0ul; j <= i; ++j) Mr(i,j) = Mr(j,i) = parallelDot(Y[i], MX[j]);
+
+    /*--- Reduce to a standard eigenproblem with the Cholesky factor of Mr = L L^T, C = L^-1 Kr L^-T. ---*/
+
+    L = su2double(0.0);
+    for (auto j = 0ul; j < nVec; ++j) {
+      su2double diag = Mr(j,j);
+      for (auto k = 0ul; k < j; ++k) diag -= pow(L(j,k), 2);
+      if (diag <= 0.0) {
+        SU2_MPI::Error("The subspace of the structural modes is degenerate, reduce MODAL_NUMBER_MODES.",
+                       CURRENT_FUNCTION);
+      }
+      L(j,j) = sqrt(diag);
+      for (auto i = j+1; i < nVec; ++i) {
+        su2double sum = Mr(i,j);
+        for (auto k = 0ul; k < j; ++k) sum -= L(i,k) * L(j,k);
+        L(i,j) = sum / L(j,j);
+      }
+    }
+
+    /*--- W = L^-1 Kr (symmetrized), then C = L^-1 W^T. ---*/
+    for (auto iCol = 0ul; iCol < nVec; ++iCol) {
+      for (auto i = 0ul; i < nVec; ++i) {
+        su2double sum = 0.5 * (Kr(i,iCol) + Kr(iCol,i));
+        for (auto k = 0ul; k < i; ++k) sum -= L(i,k) * W(k,iCol);
+        W(i,iCol) = sum / L(i,i);
+      }
+    }
+    for (auto iCol = 0ul; iCol < nVec; ++iCol) {
+      for (auto i = 0ul; i < nVec; ++i) {
+        su2double sum = W(iCol,i);
+        for (auto k = 0ul; k < i; ++k) sum -= L(i,k) * C(k,iCol);
+        C(i,iCol) = sum / L(i,i);
+      }
+    }
+    for (auto i = 0ul; i < nVec; ++i)
+      for (auto j = 0ul; j < i; ++j) C(i,j) = C(j,i) = 0.5 * (C(i,j) + C(j,i));
+
+    CBlasStructure::EigenDecomposition(C, W, lambda, nVec, work);
+
+    /*--- Z = L^-T W, the columns are M-orthonormal. ---*/
+    for (auto iCol = 0ul; iCol < nVec; ++iCol) {
+      for (auto i = nVec; i-- > 0;) {
+        su2double sum = W(i,iCol);
+        for (auto k = i+1; k < nVec; ++k) sum -= L(k,i) * Z(k,iCol);
+        Z(i,iCol) = sum / L(i,i);
+      }
+    }
+
+    SU2_OMP_PARALLEL {
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto i = 0ul; i < nPoint*nVar; ++i) {
+        for (auto iVec = 0ul; iVec < nVec; ++iVec) {
+          su2double sum = 0.0;
+          for (auto k = 0ul; k < nVec; ++k) sum += Y[k][i] * Z(k,iVec);
+          X[iVec][i] = sum;
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+
+    converged = (iter > 0);
+    for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+      converged &= (fabs(lambda[iMode] - lambdaOld[iMode]) <= tolerance * fabs(lambda[iMode]));
+      lambdaOld[iMode] = lambda[iMode];
+    }
+  }
+  System.SetMatrixUnchanged(false);
+
+  if (rank == MASTER_NODE) {
+    if (converged) cout << "Structural modes converged in " << iter << " iterations." << endl;
+    else cout << "WARNING: The structural modes did not converge in " << maxIter << " iterations." << endl;
+  }
+
+  /*--- The halos are not updated by the linear combinations. ---*/
+  modeShapes.assign(X.begin(), X.begin() + nModes);
+  modeOmega.resize(nModes);
+
+  for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+    CSysMatrixComms::Initiate(modeShapes[iMode], geometry, config);
+    CSysMatrixComms::Complete(modeShapes[iMode], geometry, config);
+    modeOmega[iMode] = sqrt(fmax(lambda[iMode], 0.0));
+  }
+
+}
+
+bool CFEASolver::ReadModes(CGeometry *geometry, const CConfig *config) {
+
+  const auto& fileName = config->GetModal_FileName();
+  ifstream file(fileName);
+  if (!file.is_open()) return false;
+
+  if (rank == MASTER_NODE) cout << "Reading the structural modes from " << fileName << "." << endl;
+
+  const unsigned long nModes = config->GetnModes_FEA();
+  modeShapes.assign(nModes, CSysVector<su2double>(nPoint, nPointDomain, nVar, 0.0));
+  modeOmega.assign(nModes, 0.0);
+  vector<unsigned long> nPointRead(nModes, 0);
+
+  /*--- Format: "%" comments, NMODES= and NDIM= lines, then for each mode a line "MODE= i OMEGA= w"
+   * followed by lines "global_point_index displacement_components" for all points. ---*/
+
+  auto fileError = [&](const string& msg) {
+    SU2_MPI::Error("Structural modes file " + fileName + ": " + msg, CURRENT_FUNCTION);
+  };
+
+  unsigned long nModesFile = 0, iMode = 0;
+  bool inMode = false;
+  string line, key;
+
+  while (getline(file, line)) {
+    if (line.empty() || line[0] == '%') continue;
+    istringstream stream(line);
+
+    if (line.find('=') != string::npos) {
+      stream >> key;
+      if (key == "NMODES=") {
+        stream >> nModesFile;
+        if (nModesFile < nModes) fileError("it has less than MODAL_NUMBER_MODES modes.");
+      }
+      else if (key == "NDIM=") {
+        unsigned short nDimFile = 0;
+        stream >> nDimFile;
+        if (nDimFile != nDim) fileError("wrong number of dimensions.");
+      }
+      else if (key == "MODE=") {
+        passivedouble omega = 0.0;
+        stream >> iMode >> key >> omega;
+        if (iMode == 0 || key != "OMEGA=") fileError("wrong mode header \"" + line + "\".");
+        inMode = (--iMode < nModes);
+        if (inMode) modeOmega[iMode] = omega;
+      }
+      continue;
+    }
+    if (!inMode) continue;
+
+    unsigned long iPointGlobal = 0;
+    passivedouble phi[MAXNDIM] = {0.0};
+    stream >> iPointGlobal;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) stream >> phi[iDim];
+    if (stream.fail()) fileError("wrong line \"" + line + "\".");
+
+    const auto iPoint = geometry->GetGlobal_to_Local_Point(iPointGlobal);
+    if (iPoint < 0) continue;
+
+    for (auto iDim = 0u; iDim < nDim; ++iDim) modeShapes[iMode](iPoint, iDim) = phi[iDim];
+    ++nPointRead[iMode];
+  }
+
+  for (iMode = 0; iMode < nModes; ++iMode) {
+    if (nPointRead[iMode] != nPoint) fileError("the modes do not match the mesh.");
+  }
+  return true;
+}
+
+void CFEASolver::WriteModes(CGeometry *geometry, const CConfig *config) const {
+
+  const auto& fileName = config->GetModal_FileName();
+  const auto nModes = modeShapes.size();
+
+  if (rank == MASTER_NODE) {
+    cout << "Writing the structural modes to " << fileName << "." << endl;
+    ofstream file(fileName);
+    file << "% Structural modes (mass normalized), for each mode: global point index, displacements.\n";
+    file << "NMODES= " << nModes << "\nNDIM= " << nDim << "\n";
+  }
+
+  /*--- Each rank appends its points in turn. ---*/
+
+  for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+    if (rank == MASTER_NODE) {
+      ofstream file(fileName, ios::app);
+      file.precision(15);
+      file << "MODE= " << iMode+1 << " OMEGA= " << scientific << modeOmega[iMode] << "\n";
+    }
+    for (int iRank = 0; iRank < size; ++iRank) {
+      SU2_MPI::Barrier(SU2_MPI::GetComm());
+      if (rank != iRank) continue;
+
+      ofstream file(fileName, ios::app);
+      file.precision(15);
+      file << scientific;
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        file << geometry->nodes->GetGlobalIndex(iPoint);
+        for (auto iDim = 0u; iDim < nDim; ++iDim) file << "\t" << modeShapes[iMode](iPoint, iDim);
+        file << "\n";
+      }
+    }
+  }
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+}
+
 void CFEASolver::PredictStruct_Displacement(CGeometry *geometry, const CConfig *config) {
 
   const unsigned short predOrder = config->GetPredictorOrder();
@@ -2560,16 +3169,7 @@ void CFEASolver::PredictStruct_Displacement(CGeometry *geometry, const CConfig *
 
 void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *config, unsigned long iOuterIter) {
 
-  unsigned long iPoint, iDim;
-  su2double rbuf_numAitk = 0, sbuf_numAitk = 0;
-  su2double rbuf_denAitk = 0, sbuf_denAitk = 0;
-
-  const su2double *dispPred = nullptr;
-  const su2double *dispCalc = nullptr;
-  const su2double *dispPred_Old = nullptr;
-  const su2double *dispCalc_Old = nullptr;
-  su2double deltaU[MAXNVAR] = {0.0}, deltaU_p1[MAXNVAR] = {0.0};
-  su2double delta_deltaU[MAXNVAR] = {0.0};
+  su2double sbuf_Aitk[2] = {0.0}, rbuf_Aitk[2] = {0.0};
   su2double WAitkDyn_tn1, WAitkDyn_Max, WAitkDyn_Min, WAitkDyn;
 
   const auto RelaxMethod_FSI = config->GetRelaxation_Method_BGS();
@@ -2601,37 +3201,44 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *c
 
     }
     else {
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      SU2_OMP_PARALLEL {
+        su2double numAitk = 0.0, denAitk = 0.0;
 
-        dispPred     = nodes->GetSolution_Pred(iPoint);
-        dispPred_Old = nodes->GetSolution_Pred_Old(iPoint);
-        dispCalc     = nodes->GetSolution(iPoint);
-        dispCalc_Old = nodes->GetSolution_Old(iPoint);
+        SU2_OMP_FOR_STAT(omp_chunk_size)
+        for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-        for (iDim = 0; iDim < nDim; iDim++) {
+          const su2double* dispPred     = nodes->GetSolution_Pred(iPoint);
+          const su2double* dispPred_Old = nodes->GetSolution_Pred_Old(iPoint);
+          const su2double* dispCalc     = nodes->GetSolution(iPoint);
+          const su2double* dispCalc_Old = nodes->GetSolution_Old(iPoint);
 
-          /*--- Compute the deltaU and deltaU_n+1 ---*/
-          deltaU[iDim] = dispCalc_Old[iDim] - dispPred_Old[iDim];
-          deltaU_p1[iDim] = dispCalc[iDim] - dispPred[iDim];
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
 
-          /*--- Compute the difference ---*/
-          delta_deltaU[iDim] = deltaU_p1[iDim] - deltaU[iDim];
+            /*--- Compute the deltaU and deltaU_n+1 ---*/
+            const su2double deltaU = dispCalc_Old[iDim] - dispPred_Old[iDim];
+            const su2double deltaU_p1 = dispCalc[iDim] - dispPred[iDim];
 
-          /*--- Add numerator and denominator ---*/
-          sbuf_numAitk += deltaU[iDim] * delta_deltaU[iDim];
-          sbuf_denAitk += delta_deltaU[iDim] * delta_deltaU[iDim];
+            /*--- Compute the difference ---*/
+            const su2double delta_deltaU = deltaU_p1 - deltaU;
 
+            /*--- Add numerator and denominator ---*/
+            numAitk += deltaU * delta_deltaU;
+            denAitk += delta_deltaU * delta_deltaU;
+          }
         }
+        END_SU2_OMP_FOR
 
+        atomicAdd(numAitk, sbuf_Aitk[0]);
+        atomicAdd(denAitk, sbuf_Aitk[1]);
       }
+      END_SU2_OMP_PARALLEL
 
-      SU2_MPI::Allreduce(&sbuf_numAitk, &rbuf_numAitk, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      SU2_MPI::Allreduce(&sbuf_denAitk, &rbuf_denAitk, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+      SU2_MPI::Allreduce(sbuf_Aitk, rbuf_Aitk, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
       WAitkDyn = WAitken_Dyn;
 
-      if (rbuf_denAitk > EPS) {
-        WAitkDyn = - 1.0 * WAitkDyn * rbuf_numAitk / rbuf_denAitk ;
+      if (rbuf_Aitk[1] > EPS) {
+        WAitkDyn = - 1.0 * WAitkDyn * rbuf_Aitk[0] / rbuf_Aitk[1] ;
       }
 
       WAitkDyn = max(WAitkDyn, 0.1);
@@ -2641,6 +3248,12 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *c
 
     }
 
+  }
+  else if (RelaxMethod_FSI == BGS_RELAXATION::QUASI_NEWTON) {
+
+    /*--- The quasi-Newton update does not use a relaxation coefficient (see SetQuasiNewton_Relaxation). ---*/
+    WAitken_Dyn = 1.0;
+
   }
   else {
     if (rank == MASTER_NODE) cout << "No relaxation method used. " << endl;
@@ -2650,6 +3263,11 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *c
 
 void CFEASolver::SetAitken_Relaxation(CGeometry *geometry, const CConfig *config) {
 
+  if (config->GetRelaxation_Method_BGS() == BGS_RELAXATION::QUASI_NEWTON) {
+    SetQuasiNewton_Relaxation(config);
+    return;
+  }
+
   const su2double WAitken = WAitken_Dyn;
   const bool dynamic = config->GetTime_Domain();
 
@@ -2688,6 +3306,66 @@ void CFEASolver::SetAitken_Relaxation(CGeometry *geometry, const CConfig *config
 
 }
 
+void CFEASolver::SetQuasiNewton_Relaxation(const CConfig *config) {
+
+  const bool dynamic = config->GetTime_Domain();
+  const bool firstIter = (config->GetOuterIter() == 0);
+
+  /*--- Each coupling loop (e.g. time step) starts without history, from the current prediction. ---*/
+  if (firstIter) QNRelaxation.reset();
+
+  SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+  for (unsigned long iPoint=0; iPoint < nPoint; iPoint++) {
+
+    const su2double* dispPred = nodes->GetSolution_Pred(iPoint);
+    const su2double* dispCalc = nodes->GetSolution(iPoint);
+
+    /*--- The predictions are the input of the fixed-point (the structural response to the fluid loads). ---*/
+    for (unsigned short iDim=0; iDim < nDim; iDim++) {
+      if (firstIter) QNRelaxation(iPoint, iDim) = SU2_TYPE::GetValue(dispPred[iDim]);
+      QNRelaxation.FPresult(iPoint, iDim) = SU2_TYPE::GetValue(dispCalc[iDim]);
+    }
+    if (dynamic) {
+      const su2double* velPred = nodes->GetSolution_Vel_Pred(iPoint);
+      const su2double* velCalc = nodes->GetSolution_Vel(iPoint);
+      for (unsigned short iDim=0; iDim < nDim; iDim++) {
+        if (firstIter) QNRelaxation(iPoint, nDim+iDim) = SU2_TYPE::GetValue(velPred[iDim]);
+        QNRelaxation.FPresult(iPoint, nDim+iDim) = SU2_TYPE::GetValue(velCalc[iDim]);
+      }
+    }
+
+    /*--- As for Aitken, keep the old predicted and calculated solutions. ---*/
+    nodes->SetSolution_Pred_Old(iPoint, dispPred);
+    nodes->SetSolution_Old(iPoint, dispCalc);
+  }
+  END_SU2_OMP_PARALLEL
+
+  QNRelaxation.compute();
+
+  /*--- Without history the first update is a relaxation with the static parameter, the new prediction is
+   * stored in the quasi-Newton object as it is the next input of the fixed-point. ---*/
+  const passivedouble relax = SU2_TYPE::GetValue(config->GetAitkenStatRelax());
+  const unsigned short nQNVar = QNRelaxation.solution().cols();
+
+  SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+  for (unsigned long iPoint=0; iPoint < nPoint; iPoint++) {
+    su2double newPred[2*MAXNVAR] = {0.0};
+
+    for (unsigned short iVar=0; iVar < nQNVar; iVar++) {
+      if (firstIter) {
+        const auto pred = iVar < nDim ? nodes->GetSolution_Pred(iPoint)[iVar] :
+                                        nodes->GetSolution_Vel_Pred(iPoint)[iVar-nDim];
+        QNRelaxation(iPoint, iVar) = (1.0-relax)*SU2_TYPE::GetValue(pred) + relax*QNRelaxation(iPoint, iVar);
+      }
+      newPred[iVar] = QNRelaxation(iPoint, iVar);
+    }
+    nodes->SetSolution_Pred(iPoint, newPred);
+    if (dynamic) nodes->SetSolution_Vel_Pred(iPoint, &newPred[nDim]);
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
 void CFEASolver::OutputForwardModeGradient(const CConfig *config, bool newFile,
                                            su2double fun, su2double fun_avg,
                                            su2double der, su2double der_avg) const {
@@ -28,6 +28,9 @@
 
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
@@ -265,6 +268,13 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Add the work space of the sum factorization of tensor product elements,
+        which is located after the local arrays of the volume computations. ---*/
+  unsigned int sizeWorkTensorProduct = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i)
+    sizeWorkTensorProduct = max(sizeWorkTensorProduct, standardElementsSol[i].GetSizeWorkTensorProduct());
+  sizeWorkArray += nPadGemm*sizeWorkTensorProduct;
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -400,6 +410,19 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
   /*--- Allocate the memory to store the time steps, residuals, etc. ---*/
   VecDeltaTime.resize(nVolElemOwned);
+  VecSpectralRadius.resize(nVolElemOwned);
+
+  if(config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
+    VecDeltaTimeNm1.resize(nVolElemOwned);
+    VecTimeCoefImplicit.resize(nVolElemOwned);
+
+    ImplicitSolTimeN.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    ImplicitSolTimeNm1.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    ImplicitResBase.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    ImplicitRHS.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    ImplicitDeltaSol.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    ImplicitLinSolver.SetxIsZero(true);
+  }
 
   if(config->GetKind_TimeIntScheme_Flow() == ADER_DG)
     VecResDOFs.resize(nVar*nDOFsLocOwned);
@@ -726,6 +749,14 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
      the tasks to be done for one space time step. */
   SetUpTaskList(config);
 
+#ifdef HAVE_CUDA
+  /* Upload the data needed for the volume residual to the device. */
+  if( config->GetFEM_DG_GPU() ) InitializeGPUVolume();
+#endif
+
+  /* Determine the projection matrices of the coarse levels of the p-multigrid cycle. */
+  if(config->GetnPMGLevels_DG() > 0) InitializePMultigrid(config);
+
   /*--- Add the solver name. ---*/
   SolverName = "DG.FLOW";
 }
@@ -733,6 +764,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver() {
 
   delete FluidModel;
+  for (auto model : FluidModelThreads) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -1071,49 +1103,58 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
 
   delete FluidModel;
+  for (auto model : FluidModelThreads) delete model;
 
-  switch (config->GetKind_FluidModel()) {
+  auto newFluidModelND = [&]() {
+    CFluidModel *model = nullptr;
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        model = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        model = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case VW_GAS:
+        model = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                    config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
 
-    case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case PR_GAS:
+        model = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                  config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
 
-    case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-  }
+      case COOLPROP:
+        model = new CCoolProp(config->GetFluid_Name());
+        break;
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+      case DATADRIVEN_FLUID:
+        model = new CDataDrivenFluid(config);
+        break;
+    }
 
-  if (viscous) {
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
-    FluidModel->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
-  }
+    model->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+    if (viscous) {
+      model->SetLaminarViscosityModel(config);
+      model->SetThermalConductivityModel(config);
+      model->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+    }
+    return model;
+  };
+
+  /*--- One object per OpenMP thread, the tasks of ProcessTaskList_DG may be carried out concurrently.
+        GetFluidModel() returns the object of the calling thread. ---*/
+
+  FluidModel = newFluidModelND();
+  FluidModelThreads.resize(omp_get_max_threads()-1);
+  for (auto &model : FluidModelThreads) model = newFluidModelND();
+
+  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
@@ -3227,9 +3268,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3253,9 +3294,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3664,6 +3705,9 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
   /* Check whether or not a time stepping scheme is used. */
   const bool time_stepping = config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING;
 
+  /* The implicit scheme always needs the spectral radii of the elements. */
+  const bool implicit = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
+
   /* Initialize the minimum and maximum time step. */
   Min_Delta_Time = 1.e25; Max_Delta_Time = 0.0;
 
@@ -3677,7 +3721,7 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
         otherwise it computes the time step based on the provided unsteady CFL.
         Note that the regular CFL option in the config is always ignored with
         time stepping. ---*/
-  if (time_stepping && (config->GetUnst_CFL() == 0.0)) {
+  if (time_stepping && (config->GetUnst_CFL() == 0.0) && !implicit) {
 
     /*--- Loop over the owned volume elements and set the fixed dt. ---*/
     for(unsigned long i=0; i<nVolElemOwned; ++i)
@@ -3713,8 +3757,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3745,8 +3789,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3773,7 +3817,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
         const su2double lenScaleInv = nPoly/volElem[l].lenScale;
         const su2double dtInv       = lenScaleInv*sqrt(charVel2Max);
 
-        VecDeltaTime[l] = CFL/dtInv;
+        VecDeltaTime[l]      = CFL/dtInv;
+        VecSpectralRadius[l] = dtInv;
 
         const su2double dtEff = volElem[l].factTimeLevel*VecDeltaTime[l];
         Min_Delta_Time = min(Min_Delta_Time, dtEff);
@@ -3806,6 +3851,11 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
           the time step of the largest time level, a correction must be used
           for the time level when time accurate local time stepping is used. ---*/
     if (time_stepping) {
+
+      /* The implicit scheme with an imposed time step only needed the
+         spectral radii of the elements. */
+      if(config->GetUnst_CFL() == 0.0) Min_Delta_Time = config->GetDelta_UnstTimeND();
+
       for(unsigned long l=0; l<nVolElemOwned; ++l)
         VecDeltaTime[l] = Min_Delta_Time/volElem[l].factTimeLevel;
 
@@ -3854,314 +3904,367 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
+  /* Status of the tasks in the list. A task is being carried out when
+     one of the threads has taken it, but has not finished it yet. */
+  enum : char {TASK_WAITING = 0, TASK_RUNNING = 1, TASK_COMPLETED = 2};
+  vector<char> taskStatus(tasksList.size(), TASK_WAITING);
+  unsigned long lowestIndexInList = 0;
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
+  /* Lambda, which determines whether a task is the communication of data.
+     The MPI functions are only called by the master thread. */
+  auto commTask = [](const CTaskDefinition &task) {
+    return task.task == CTaskDefinition::INITIATE_MPI_COMMUNICATION         ||
+           task.task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION         ||
+           task.task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION ||
+           task.task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION;
+  };
+
+  /* Lambda, which determines whether all the tasks a task depends on
+     have been completed and the task itself has not been taken yet. */
+  auto taskCanBeCarriedOut = [&](unsigned long i) {
+    if(taskStatus[i] != TASK_WAITING) return false;
+    for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+      if(taskStatus[tasksList[i].indMustBeCompleted[ind]] != TASK_COMPLETED)
+        return false;
+    }
+    return true;
+  };
+
+  /* The tasks that do not depend on each other can be carried out concurrently
+     by the OpenMP threads, the list contains all the dependencies. Each thread
+     uses its own work array, numerics and fluid model. The master thread takes
+     the tasks in the same order as the sequential algorithm, including the
+     communication, the other threads only take computational tasks. The
+     discrete adjoint is recorded sequentially. */
+  SU2_OMP_PARALLEL_(if(!config->GetDiscrete_Adjoint()))
+  {
+    const bool masterThread = (omp_get_thread_num() == 0);
+    CNumerics **numericsThread = numerics + omp_get_thread_num()*MAX_TERMS;
+
+    /* Allocate the memory for the work array and initialize it to zero to avoid
+       warnings in debug mode  about uninitialized memory when padding is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    vector<unsigned long> candidates;
+
+    /* While loop to carry out all the tasks in tasksList. */
+    bool allTasksCompleted = false;
+    while( !allTasksCompleted ) {
+
+      /* Determine the tasks that can be carried out. The master thread
+         considers all of them, the other threads take the first
+         computational task. */
+      long taskTaken = -1;
+      candidates.clear();
+
+      SU2_OMP_CRITICAL
+      {
+        for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+          if(taskStatus[lowestIndexInList] != TASK_COMPLETED) break;
+        allTasksCompleted = (lowestIndexInList == tasksList.size());
+
+        for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+          if( !taskCanBeCarriedOut(i) ) continue;
+          if( masterThread ) {
+            candidates.push_back(i);
+          }
+          else if( !commTask(tasksList[i]) ) {
+            taskStatus[i] = TASK_RUNNING;
+            taskTaken = i;
+            break;
+          }
+        }
+      }
+      END_SU2_OMP_CRITICAL
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
+      if( !masterThread ) {
+        if(taskTaken >= 0) {
+          CarryOutTask_DG(tasksList[taskTaken], config, numericsThread, false, workArray);
+
+          SU2_OMP_CRITICAL
+          { taskStatus[taskTaken] = TASK_COMPLETED; }
+          END_SU2_OMP_CRITICAL
         }
+        continue;
+      }
 
-        if( taskCanBeCarriedOut ) {
+      /* Find the next task that can be carried out by the master thread. The outer
+         loop is there to make sure that a communication is completed in case there
+         are no other tasks. The only tasks that may fail are the completion of the
+         non-blocking communication. If that is the case the next task needs to be found. */
+      for(unsigned short j=0; j<2; ++j) {
+        bool taskCarriedOut = false;
+        for(const auto i : candidates) {
+
+          /* Take the task, unless another thread has taken it in the meantime. */
+          bool taskAvailable = false;
+          SU2_OMP_CRITICAL
+          {
+            taskAvailable = (taskStatus[i] == TASK_WAITING);
+            if( taskAvailable ) taskStatus[i] = TASK_RUNNING;
+          }
+          END_SU2_OMP_CRITICAL
+          if( !taskAvailable ) continue;
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+          taskCarriedOut = CarryOutTask_DG(tasksList[i], config, numericsThread, j==1, workArray);
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+          SU2_OMP_CRITICAL
+          { taskStatus[i] = taskCarriedOut ? TASK_COMPLETED : TASK_WAITING; }
+          END_SU2_OMP_CRITICAL
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+          /* Break the inner loop if a task has been carried out. */
+          if( taskCarriedOut ) break;
+        }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Break the outer loop if a task has been carried out. */
+        if( taskCarriedOut ) break;
+      }
+    }
+  }
+  END_SU2_OMP_PARALLEL
+}
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+bool CFEM_DG_EulerSolver::CarryOutTask_DG(const CTaskDefinition &task,
+                                          CConfig               *config,
+                                          CNumerics             **numerics,
+                                          const bool            waitForComm,
+                                          su2double             *workArray) {
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Easier storage of the number of time levels.. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+  /*--- Determine the actual task to be carried out and do so. ---*/
+  switch( task.task ) {
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must be communicated for this time level. */
+      const unsigned short level   = task.timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must not be communicated for this time level. */
+      const unsigned short level   = task.timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, task.timeLevel);
+      return true;
+    }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+      /* Attempt to complete the MPI communication of the solution data.
+         If waitForComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case another task
+         can be carried out. Otherwise the next tasks are waiting for this
+         communication to be completed and hence MPI_Waitall is used. */
+      return Complete_MPI_Communication(config, task.timeLevel, waitForComm);
+    }
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, task.timeLevel);
+      return true;
+    }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the residual data,
+         see COMPLETE_MPI_COMMUNICATION. */
+      return Complete_MPI_ReverseCommunication(config, task.timeLevel, waitForComm);
+    }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
+
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = task.timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = task.timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the volume portion of the residual. ---*/
+      const unsigned short level = task.timeLevel;
+      Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
+                      nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Compute the residual of the faces that only involve owned elements. */
+      const unsigned short level = task.timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = task.timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, false,
+                          workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(task.timeLevel, config, numerics, true,
+                          workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, true);
+      return true;
+    }
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(task.timeLevel, false);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, task.timeLevel,
+                                               task.intPointADER);
+      return true;
+    }
 
-            default: {
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, task.timeLevel,
+                                              task.intPointADER);
+      return true;
+    }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
-      }
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const unsigned short level = task.timeLevel;
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          workArray);
+      return true;
     }
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG. ---*/
+      const unsigned short level = task.timeLevel;
+      ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                        nVolElemOwnedPerTimeLevel[level+1]);
+      return true;
+    }
+
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
+    }
   }
+
+  return false;
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4178,6 +4281,428 @@ void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolve
   Postprocessing(geometry, solver_container, config, iMesh);
 }
 
+/*!
+ * \brief Matrix-free product with the Jacobian of the unsteady residual of the implicit
+ *        scheme, a0/dt*u + M^-1 dR/dU u, where the second term is a finite difference.
+ */
+class CFEM_DG_EulerSolver::CImplicitJacobianProduct final : public CMatrixVectorProduct<su2double> {
+ private:
+  CFEM_DG_EulerSolver *solver;
+  CGeometry *geometry;
+  CSolver **solver_container;
+  CNumerics **numerics;
+  CConfig *config;
+  const unsigned short iMesh;
+
+ public:
+  CImplicitJacobianProduct(CFEM_DG_EulerSolver *s, CGeometry *geo, CSolver **sc, CNumerics **num,
+                           CConfig *cfg, unsigned short mesh)
+    : solver(s), geometry(geo), solver_container(sc), numerics(num), config(cfg), iMesh(mesh) {}
+
+  void operator()(const CSysVector<su2double> &u, CSysVector<su2double> &v) const override {
+
+    const su2double normU = u.norm();
+    if(normU == 0.0) {
+      v = su2double(0.0);
+      return;
+    }
+    const su2double eps = solver->finDiffStepImplicit/normU;
+
+    /* Compute the residual of the perturbed solution of the owned DOFs, the
+       halo DOFs are communicated in the task list. */
+    su2double *solPert = solver->VecWorkSolDOFs[0].data();
+    for(unsigned long i=0; i<solver->VecSolDOFs.size(); ++i)
+      solPert[i] = solver->VecSolDOFs[i] + eps*u[i];
+
+    solver->ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+    /* Finite difference of the residuals and diagonal time derivative term. */
+    for(unsigned long l=0; l<solver->nVolElemOwned; ++l) {
+      const unsigned long offset     = solver->nVar*solver->volElem[l].offsetDOFsSolLocal;
+      const unsigned short nVarNDOFs = solver->nVar*solver->volElem[l].nDOFsSol;
+      const su2double coefTime       = solver->VecTimeCoefImplicit[l];
+
+      for(unsigned short j=0; j<nVarNDOFs; ++j) {
+        const unsigned long i = offset + j;
+        v[i] = (solver->VecResDOFs[i] - solver->ImplicitResBase[i])/eps + coefTime*u[i];
+      }
+    }
+  }
+};
+
+/*!
+ * \brief Element-block-Jacobi preconditioner of the implicit scheme. The diagonal
+ *        block of each element is approximated by (a0/dt + spectral radius) times
+ *        the identity, i.e. the mass matrix scaled spatial Jacobian is replaced by
+ *        the inverse of the time step for CFL = 1.
+ */
+class CFEM_DG_EulerSolver::CImplicitPreconditioner final : public CPreconditioner<su2double> {
+ private:
+  const CFEM_DG_EulerSolver *solver;
+
+ public:
+  CImplicitPreconditioner(const CFEM_DG_EulerSolver *s) : solver(s) {}
+
+  void operator()(const CSysVector<su2double> &u, CSysVector<su2double> &v) const override {
+
+    for(unsigned long l=0; l<solver->nVolElemOwned; ++l) {
+      const unsigned long offset     = solver->nVar*solver->volElem[l].offsetDOFsSolLocal;
+      const unsigned short nVarNDOFs = solver->nVar*solver->volElem[l].nDOFsSol;
+      const su2double diagInv        = 1.0/(solver->VecTimeCoefImplicit[l] + solver->VecSpectralRadius[l]);
+
+      for(unsigned short j=0; j<nVarNDOFs; ++j)
+        v[offset+j] = diagInv*u[offset+j];
+    }
+  }
+};
+
+void CFEM_DG_EulerSolver::Implicit_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
+                                                        CNumerics **numerics, CConfig *config,
+                                                        unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  /* Preprocessing. */
+  Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Coefficients of the BDF scheme, a0*U + a1*U^n + a2*U^(n-1),  ---*/
+  /*---         divided by the time step. The second order scheme accounts  ---*/
+  /*---         for a variable time step and it is only used when the       ---*/
+  /*---         solution of the previous time step is available. Steady     ---*/
+  /*---         problems use the first order scheme with local time steps.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const bool time_stepping = config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING;
+  const bool BDF2 = time_stepping && availableSolTimeNm1 && (config->GetnOrderBDF_DG() == 2);
+
+  vector<su2double> coefTimeN(nVolElemOwned), coefTimeNm1(nVolElemOwned, 0.0);
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const su2double dtInv = 1.0/VecDeltaTime[l];
+    if( BDF2 ) {
+      const su2double omega  = VecDeltaTime[l]/VecDeltaTimeNm1[l];
+      VecTimeCoefImplicit[l] =  dtInv*(1.0+2.0*omega)/(1.0+omega);
+      coefTimeN[l]           = -dtInv*(1.0+omega);
+      coefTimeNm1[l]         =  dtInv*omega*omega/(1.0+omega);
+    }
+    else {
+      VecTimeCoefImplicit[l] =  dtInv;
+      coefTimeN[l]           = -dtInv;
+    }
+  }
+
+  /* Store the solution of time level n, which is also the initial guess of the
+     Newton iterations, and determine the finite difference step from its norm. */
+  for(unsigned long i=0; i<VecSolDOFs.size(); ++i)
+    ImplicitSolTimeN[i] = VecSolDOFs[i];
+
+  const su2double finDiffStepND = config->GetNewtonKrylovDblParam()[3];
+  finDiffStepImplicit = finDiffStepND*max(su2double(1.0), ImplicitSolTimeN.norm()/sqrt(su2double(nDOFsGlobal)));
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Newton iterations, the linear systems are solved with       ---*/
+  /*---         FGMRES using matrix-free products with the Jacobian.        ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const CImplicitJacobianProduct product(this, geometry, solver_container, numerics, config, iMesh);
+  const CImplicitPreconditioner  precond(this);
+
+  const unsigned short nNewtonIter = config->GetnNewtonIter_DG();
+  const su2double      newtonTol   = config->GetNewtonTol_DG();
+  const su2double      linSolTol   = config->GetLinear_Solver_Error();
+  const unsigned long  linSolIter  = config->GetLinear_Solver_Iter();
+
+  su2double normRes0 = 0.0, linSolRes = 0.0;
+  unsigned long nLinIterTot = 0;
+
+  for(unsigned short iNewton=0; iNewton<nNewtonIter; ++iNewton) {
+
+    /* Compute the spatial residual, multiplied by the inverse of the mass matrix,
+       of the current solution and add the time derivative. */
+    Set_OldSolution();
+    ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+      const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+
+      for(unsigned short j=0; j<nVarNDOFs; ++j) {
+        const unsigned long i = offset + j;
+        ImplicitResBase[i] = VecResDOFs[i];
+        ImplicitRHS[i]     = -(VecResDOFs[i] + VecTimeCoefImplicit[l]*VecSolDOFs[i]
+                           +   coefTimeN[l]*ImplicitSolTimeN[i] + coefTimeNm1[l]*ImplicitSolTimeNm1[i]);
+      }
+    }
+
+    /* Check the convergence of the Newton iterations. */
+    const su2double normRes = ImplicitRHS.norm();
+    if(iNewton == 0) normRes0 = normRes;
+    if((normRes == 0.0) || ((iNewton > 0) && (normRes <= newtonTol*normRes0))) break;
+
+    /* Solve for the Newton update and update the solution. */
+    ImplicitDeltaSol = su2double(0.0);
+    nLinIterTot += ImplicitLinSolver.FGMRES_LinSolver(ImplicitRHS, ImplicitDeltaSol, product, precond,
+                                                      linSolTol, linSolIter, linSolRes, false, config);
+
+    for(unsigned long i=0; i<VecSolDOFs.size(); ++i)
+      VecSolDOFs[i] += ImplicitDeltaSol[i];
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Store the data of this time step for BDF2 and compute the   ---*/
+  /*---         norms of the unsteady residual of the last Newton iterate.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if( time_stepping ) {
+    ImplicitSolTimeNm1  = ImplicitSolTimeN;
+    VecDeltaTimeNm1     = VecDeltaTime;
+    availableSolTimeNm1 = true;
+  }
+
+  for(unsigned long i=0; i<VecSolDOFs.size(); ++i)
+    VecResDOFs[i] = -ImplicitRHS[i];
+
+  SetIterLinSolver(static_cast<unsigned short>(min(nLinIterTot, 65535ul)));
+  SetResLinSolver(linSolRes);
+
+  SetResidual_RMS_FEM(geometry, config);
+  ComputeVerificationError(geometry, config);
+
+  /* Postprocessing. */
+  Postprocessing(geometry, solver_container, config, iMesh);
+}
+
+void CFEM_DG_EulerSolver::InitializePMultigrid(CConfig *config) {
+
+  const unsigned short nLevels = config->GetnPMGLevels_DG();
+
+  PMGProjection.resize(nLevels);
+  PMGForcing.assign(nLevels, vector<su2double>(nVar*nDOFsLocOwned));
+  PMGSolSaved.assign(nLevels, vector<su2double>(nVar*nDOFsLocOwned));
+  PMGResLevel.resize(nVar*nDOFsLocOwned);
+
+  /*--- The polynomials of the coarse levels are a subspace of the polynomials of the
+        standard elements. The coarse solutions are stored as the values in the solution
+        DOFs of the standard elements, such that the prolongation is the identity and
+        the restriction is the L2 projection onto the coarse polynomials, which is
+        computed with the mass matrix of the standard element. ---*/
+  for(unsigned short iLevel=1; iLevel<=nLevels; ++iLevel) {
+    PMGProjection[iLevel-1].resize(nStandardElementsSol);
+
+    for(unsigned short i=0; i<nStandardElementsSol; ++i) {
+
+      /* Determine the polynomial degree of this level. No projection is
+         needed if the degree is the same as for the finest level. */
+      const unsigned short nPoly  = standardElementsSol[i].GetNPoly();
+      const unsigned short nPolyC = nPoly > iLevel ? nPoly - iLevel : 0;
+      if(nPolyC == nPoly) continue;
+
+      /* Easier storage of the data of the standard element. */
+      const unsigned short nDOFs = standardElementsSol[i].GetNDOFs();
+      const unsigned short nInt  = standardElementsSol[i].GetNIntegration();
+      const su2double *basisIntT = standardElementsSol[i].GetBasisFunctionsIntegrationTrans();
+      const su2double *weights   = standardElementsSol[i].GetWeightsIntegration();
+
+      const vector<su2double> *rDOFs = standardElementsSol[i].GetRDOFs();
+      const vector<su2double> *sDOFs = standardElementsSol[i].GetSDOFs();
+      const vector<su2double> *tDOFs = standardElementsSol[i].GetTDOFs();
+
+      /* Compute the values of the coarse basis functions in the solution DOFs. */
+      CFEMStandardElement coarseElem = CFEMStandardElement::Get(standardElementsSol[i].GetVTK_Type(),
+                                                                nPolyC, false, config);
+      const unsigned short nDOFsC = coarseElem.GetNDOFs();
+
+      vector<su2double> basisC(nDOFs*nDOFsC), lagBasis;
+      for(unsigned short j=0; j<nDOFs; ++j) {
+        su2double parCoor[] = {0.0, 0.0, 0.0};
+        if( rDOFs->size() ) parCoor[0] = (*rDOFs)[j];
+        if( sDOFs->size() ) parCoor[1] = (*sDOFs)[j];
+        if( tDOFs->size() ) parCoor[2] = (*tDOFs)[j];
+
+        coarseElem.BasisFunctionsInPoint(parCoor, lagBasis);
+        for(unsigned short k=0; k<nDOFsC; ++k)
+          basisC[j*nDOFsC+k] = lagBasis[k];
+      }
+
+      /* Mass matrix of the standard element. */
+      vector<su2double> massMat(nDOFs*nDOFs, 0.0);
+      for(unsigned short j=0; j<nDOFs; ++j)
+        for(unsigned short k=0; k<nDOFs; ++k)
+          for(unsigned short q=0; q<nInt; ++q)
+            massMat[j*nDOFs+k] += weights[q]*basisIntT[j*nInt+q]*basisIntT[k*nInt+q];
+
+      /* Compute M*V and the inverse of the coarse mass matrix V^T*M*V. As the
+         latter is symmetric, it does not matter that it is stored row major. */
+      vector<su2double> massBasisC(nDOFs*nDOFsC, 0.0), massMatC(nDOFsC*nDOFsC, 0.0);
+      for(unsigned short j=0; j<nDOFs; ++j)
+        for(unsigned short m=0; m<nDOFs; ++m)
+          for(unsigned short k=0; k<nDOFsC; ++k)
+            massBasisC[j*nDOFsC+k] += massMat[j*nDOFs+m]*basisC[m*nDOFsC+k];
+
+      for(unsigned short j=0; j<nDOFs; ++j)
+        for(unsigned short k=0; k<nDOFsC; ++k)
+          for(unsigned short m=0; m<nDOFsC; ++m)
+            massMatC[k*nDOFsC+m] += basisC[j*nDOFsC+k]*massBasisC[j*nDOFsC+m];
+
+      CFEMStandardElementBase::InverseMatrix(nDOFsC, massMatC);
+
+      /* The projection matrix is V*(V^T*M*V)^-1*(M*V)^T, stored row major. */
+      vector<su2double> tmp(nDOFs*nDOFsC, 0.0);
+      for(unsigned short j=0; j<nDOFs; ++j)
+        for(unsigned short k=0; k<nDOFsC; ++k)
+          for(unsigned short m=0; m<nDOFsC; ++m)
+            tmp[j*nDOFsC+m] += basisC[j*nDOFsC+k]*massMatC[k*nDOFsC+m];
+
+      vector<su2double> &proj = PMGProjection[iLevel-1][i];
+      proj.assign(nDOFs*nDOFs, 0.0);
+      for(unsigned short j=0; j<nDOFs; ++j)
+        for(unsigned short k=0; k<nDOFs; ++k)
+          for(unsigned short m=0; m<nDOFsC; ++m)
+            proj[j*nDOFs+k] += tmp[j*nDOFsC+m]*massBasisC[k*nDOFsC+m];
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::PMGProject(const unsigned short iLevel, const su2double *vecIn,
+                                     su2double *vecOut, const CConfig *config) {
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned short nDOFs     = volElem[l].nDOFsSol;
+    const unsigned short nVarNDOFs = nVar*nDOFs;
+
+    /* Copy the data if the element keeps its polynomial degree on this level. */
+    const vector<su2double> *proj = iLevel ? &PMGProjection[iLevel-1][volElem[l].indStandardElement] : nullptr;
+    if(!proj || proj->empty()) {
+      for(unsigned short j=0; j<nVarNDOFs; ++j)
+        vecOut[offset+j] = vecIn[offset+j];
+    }
+    else {
+      blasFunctions->gemm(nDOFs, nVar, nDOFs, proj->data(), vecIn+offset, vecOut+offset, config);
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::PMGResidual(const unsigned short iLevel, CGeometry *geometry,
+                                      CSolver **solver_container, CNumerics **numerics,
+                                      CConfig *config, const unsigned short iMesh) {
+
+  /* Residual of the finest level, multiplied by the inverse of the mass matrix. */
+  ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+  /* Project it onto the polynomials of this level and add the forcing term. */
+  PMGProject(iLevel, VecResDOFs.data(), PMGResLevel.data(), config);
+
+  if( iLevel ) {
+    const vector<su2double> &forcing = PMGForcing[iLevel-1];
+    for(unsigned long i=0; i<PMGResLevel.size(); ++i)
+      PMGResLevel[i] += forcing[i];
+  }
+}
+
+void CFEM_DG_EulerSolver::PMGSmooth(const unsigned short iLevel, const unsigned short nIter,
+                                    CGeometry *geometry, CSolver **solver_container,
+                                    CNumerics **numerics, CConfig *config, const unsigned short iMesh) {
+
+  const unsigned short nRKStages = config->GetnRKStep();
+
+  for(unsigned short iIter=0; iIter<nIter; ++iIter) {
+    for(unsigned short iRKStep=0; iRKStep<nRKStages; ++iRKStep) {
+
+      /* Compute the residual of the current stage. */
+      if(iRKStep == 0) Set_OldSolution();
+      PMGResidual(iLevel, geometry, solver_container, numerics, config, iMesh);
+
+      /* Update the solution as in ExplicitRK_Iteration. The time step of the
+         coarse levels is increased, because it scales with the inverse of
+         the polynomial degree. */
+      const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
+      su2double *solNew = (iRKStep == (nRKStages-1)) ? VecSolDOFs.data() : VecWorkSolDOFs[0].data();
+
+      for(unsigned long l=0; l<nVolElemOwned; ++l) {
+        const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+        const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+
+        const unsigned short nPoly  = standardElementsSol[volElem[l].indStandardElement].GetNPoly();
+        const unsigned short nPolyC = nPoly > iLevel ? nPoly - iLevel : 0;
+        const su2double factDt = su2double(max(nPoly, (unsigned short) 1))/max(nPolyC, (unsigned short) 1);
+
+        const su2double tmp = RK_AlphaCoeff*factDt*VecDeltaTime[l];
+        for(unsigned short j=0; j<nVarNDOFs; ++j)
+          solNew[offset+j] = VecSolDOFs[offset+j] - tmp*PMGResLevel[offset+j];
+      }
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::PMGCycleLevel(const unsigned short iLevel, CGeometry *geometry,
+                                        CSolver **solver_container, CNumerics **numerics,
+                                        CConfig *config, const unsigned short iMesh) {
+
+  const unsigned short nPreSmooth  = config->GetnPMGPreSmooth_DG();
+  const unsigned short nPostSmooth = config->GetnPMGPostSmooth_DG();
+
+  /* The coarsest level is only smoothed. */
+  if(iLevel == config->GetnPMGLevels_DG()) {
+    PMGSmooth(iLevel, nPreSmooth+nPostSmooth, geometry, solver_container, numerics, config, iMesh);
+    return;
+  }
+
+  /* Pre-smoothing and the residual of this level. The residual of the finest
+     level, before the coarse grid correction, is the monitored residual. */
+  PMGSmooth(iLevel, nPreSmooth, geometry, solver_container, numerics, config, iMesh);
+
+  Set_OldSolution();
+  PMGResidual(iLevel, geometry, solver_container, numerics, config, iMesh);
+  if(iLevel == 0) SetResidual_RMS_FEM(geometry, config);
+
+  /* Restrict the residual and the solution to the next level and compute the forcing
+     term, such that the residual of the next level for the restricted solution is the
+     restricted residual of this level (full approximation scheme). */
+  const unsigned short iLevelC = iLevel + 1;
+  vector<su2double> &forcing  = PMGForcing[iLevelC-1];
+  vector<su2double> &solSaved = PMGSolSaved[iLevel];
+
+  PMGProject(iLevelC, PMGResLevel.data(), forcing.data(), config);
+
+  for(unsigned long i=0; i<solSaved.size(); ++i)
+    solSaved[i] = VecSolDOFs[i];
+  PMGProject(iLevelC, solSaved.data(), VecSolDOFs.data(), config);
+
+  Set_OldSolution();
+  ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+  PMGProject(iLevelC, VecResDOFs.data(), PMGResLevel.data(), config);
+
+  for(unsigned long i=0; i<forcing.size(); ++i)
+    forcing[i] -= PMGResLevel[i];
+
+  /* Solve on the next level and correct the solution of this level with the
+     change of the coarse solution. As the polynomials are nested and the
+     coarse solution is stored in the DOFs of the finest level, the
+     prolongation is the identity. */
+  PMGCycleLevel(iLevelC, geometry, solver_container, numerics, config, iMesh);
+
+  PMGProject(iLevelC, solSaved.data(), PMGResLevel.data(), config);
+  for(unsigned long i=0; i<solSaved.size(); ++i)
+    VecSolDOFs[i] += solSaved[i] - PMGResLevel[i];
+
+  /* Post-smoothing. */
+  PMGSmooth(iLevel, nPostSmooth, geometry, solver_container, numerics, config, iMesh);
+}
+
+void CFEM_DG_EulerSolver::PMultigrid_Cycle(CGeometry *geometry,  CSolver **solver_container,
+                                           CNumerics **numerics, CConfig *config,
+                                           unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  /* Preprocessing. */
+  Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
+
+  /* Carry out the V-cycle, which also computes the residual norms. */
+  PMGCycleLevel(0, geometry, solver_container, numerics, config, iMesh);
+
+  /* For verification cases, compute the global error metrics. */
+  ComputeVerificationError(geometry, config);
+
+  /* Postprocessing. */
+  Postprocessing(geometry, solver_container, config, iMesh);
+}
+
 void CFEM_DG_EulerSolver::TolerancesADERPredictorStep() {
 
   /* Determine the maximum values of the conservative variables of the
@@ -4818,8 +5343,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5028,6 +5553,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   su2double *gradFluxYInt = gradFluxXInt + nDim*NPad*nInt;
   su2double *gradFluxZInt = gradFluxYInt + nDim*NPad*nInt;
   su2double *divFlux      = work;
+  su2double *workTensor   = gradFluxZInt + nDim*NPad*nInt;
 
   /* Determine the offset between the r-derivatives and s-derivatives, which is
      also the offset between s- and t-derivatives, of the fluxes. */
@@ -5067,8 +5593,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5182,7 +5708,10 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductSolAndGradInt(NPad, sol, solInt, workTensor, false);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5278,7 +5807,10 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductBasisTrans(NPad, divFlux, res, workTensor);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -5357,8 +5889,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5511,6 +6043,9 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
+  /* The work space of the sum factorization is located after solAndGradInt. */
+  su2double *workTensor = work + 4*NPad*nInt;
+
   /* Check if a body force is present and set it accordingly. */
   su2double bodyForceX = 0.0, bodyForceY = 0.0, bodyForceZ = 0.0;
   if( config->GetBody_Force() ) {
@@ -5534,7 +6069,10 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductSolAndGradInt(NPad, sol, solAndGradInt, workTensor, true);
+  else
+    blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5572,8 +6110,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5723,7 +6261,10 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductBasisTrans(NPad, divFlux, res, workTensor);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig             *config,
@@ -5831,11 +6372,85 @@ void CFEM_DG_EulerSolver::Shock_Capturing_DG(CConfig             *config,
   }
 }
 
+#ifdef HAVE_CUDA
+void CFEM_DG_EulerSolver::InitializeGPUVolume() {
+
+  /*--- Data of the standard elements. ---*/
+  const unsigned short nStd = nStandardElementsSol;
+  vector<unsigned short> stdNInt(nStd), stdNDOFs(nStd);
+  vector<const su2double*> stdBasis(nStd), stdDerBasisTrans(nStd), stdWeights(nStd);
+
+  for(unsigned short i=0; i<nStd; ++i) {
+    stdNInt[i]          = standardElementsSol[i].GetNIntegration();
+    stdNDOFs[i]         = standardElementsSol[i].GetNDOFs();
+    stdBasis[i]         = standardElementsSol[i].GetMatBasisFunctionsIntegration();
+    stdDerBasisTrans[i] = standardElementsSol[i].GetDerMatBasisFunctionsIntTrans();
+    stdWeights[i]       = standardElementsSol[i].GetWeightsIntegration();
+  }
+
+  /*--- Data of the owned volume elements, whose DOFs are stored contiguously. ---*/
+  vector<unsigned short> elemStd(nVolElemOwned);
+  vector<su2double> metricTerms, gridVelocities;
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    elemStd[l] = volElem[l].indStandardElement;
+    metricTerms.insert(metricTerms.end(), volElem[l].metricTerms.begin(), volElem[l].metricTerms.end());
+    gridVelocities.insert(gridVelocities.end(), volElem[l].gridVelocities.begin(),
+                          volElem[l].gridVelocities.end());
+  }
+
+  gpuVolume.reset(new CGPUDGVolumeWrapper);
+  gpuVolume->Initialize(stdNInt, stdNDOFs, stdBasis, stdDerBasisTrans, stdWeights,
+                        elemStd, metricTerms, gridVelocities, Gamma_Minus_One);
+
+  gpuSolDOFs.resize(nVar*nDOFsLocOwned);
+  gpuResDOFs.resize(nVar*nDOFsLocOwned);
+}
+
+void CFEM_DG_EulerSolver::Volume_Residual_GPU(const unsigned long elemBeg,
+                                              const unsigned long elemEnd) {
+
+  /* The device buffers are shared, hence only one thread may use them. A named
+     critical section is used to not block the scheduling of the other tasks. */
+  SU2_OMP(critical(fem_dg_gpu))
+  {
+    /* Gather the solution of the elements, which is stored per time level. */
+    const unsigned long offBeg = gpuVolume->GetOffsetDOFs(elemBeg);
+    for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+      const su2double *solDOFsElem = VecWorkSolDOFs[volElem[l].timeLevel].data()
+                                   + nVar*volElem[l].offsetDOFsSolThisTimeLevel;
+      su2double *sol = gpuSolDOFs.data() + nVar*(gpuVolume->GetOffsetDOFs(l) - offBeg);
+      for(unsigned short i=0; i<(volElem[l].nDOFsSol*nVar); ++i)
+        sol[i] = solDOFsElem[i];
+    }
+
+    gpuVolume->VolumeResidual(elemBeg, elemEnd, gpuSolDOFs.data(), gpuResDOFs.data());
+
+    /* Scatter the residuals to their locations in VecResDOFs. */
+    for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+      const su2double *resGPU = gpuResDOFs.data() + nVar*(gpuVolume->GetOffsetDOFs(l) - offBeg);
+      su2double *res = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+      for(unsigned short i=0; i<(volElem[l].nDOFsSol*nVar); ++i)
+        res[i] = resGPU[i];
+    }
+  }
+  END_SU2_OMP_CRITICAL
+}
+#endif
+
 void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemBeg,
                                           const unsigned long elemEnd,
                                           su2double           *workArray) {
 
+#ifdef HAVE_CUDA
+  /*--- The volume residual of the owned elements can be computed on the device. ---*/
+  if( gpuVolume ) {
+    Volume_Residual_GPU(elemBeg, elemEnd);
+    return;
+  }
+#endif
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : nullptr;
@@ -5884,6 +6499,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     su2double *sources = solDOFs + nDOFs*NPad;
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *workTensor = fluxes + nInt*nDim*NPad;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5907,8 +6523,12 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     }
 
     /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+       the solution in the integration points of the chunk of elements. For
+       tensor product elements sum factorization is used instead. */
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductSolAndGradInt(NPad, solDOFs, solInt, workTensor, false);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5959,8 +6579,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6054,8 +6674,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6175,14 +6795,20 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductDerBasisTrans(NPad, fluxes, solDOFs, workTensor);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      if( standardElementsSol[ind].TensorProductElement() )
+        standardElementsSol[ind].TensorProductBasisTrans(NPad, sources, solInt, workTensor);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6960,8 +7586,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7013,8 +7639,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7619,9 +8245,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7727,9 +8353,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7791,11 +8417,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
 
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7822,9 +8448,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7854,10 +8480,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7905,10 +8531,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -8002,7 +8628,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -8017,7 +8643,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8068,11 +8694,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8147,11 +8773,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8930,6 +9556,222 @@ void CFEM_DG_EulerSolver::LeftStatesIntegrationPointsBoundaryFace(
   blasFunctions->gemm(nInt, NPad, nDOFs, basisFace, solFace, solIntL, config);
 }
 
+namespace {
+
+/*--- SIMD type, whose lanes are the faces of a chunk of faces. ---*/
+using FaceDouble = simd::Array<su2double>;
+
+/*!
+ * \brief Roe flux for the lanes of FaceDouble, i.e. for several faces simultaneously.
+ */
+template<unsigned short NDIM>
+struct CRoeFluxLanes {
+  su2double gm1;    /*!< \brief Gamma minus one. */
+  su2double Delta;  /*!< \brief Coefficient of the entropy correction. */
+
+  FORCEINLINE void operator()(const FaceDouble *UL, const FaceDouble *UR, const FaceDouble *n,
+                              const FaceDouble &halfArea, const FaceDouble &gridVelNorm,
+                              FaceDouble *flux) const {
+    const unsigned short iE = NDIM+1;
+
+    /*--- Compute the primitive variables of the left and right state. ---*/
+    const FaceDouble ovrL = 1.0/UL[0], ovrR = 1.0/UR[0];
+    FaceDouble velL[NDIM], velR[NDIM];
+    FaceDouble kinL = 0.0, kinR = 0.0;
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+      velL[iDim] = ovrL*UL[iDim+1];
+      velR[iDim] = ovrR*UR[iDim+1];
+      kinL += velL[iDim]*UL[iDim+1];
+      kinR += velR[iDim]*UR[iDim+1];
+    }
+    const FaceDouble pL = gm1*(UL[iE] - 0.5*kinL);
+    const FaceDouble pR = gm1*(UR[iE] - 0.5*kinR);
+
+    /*--- Compute the difference of the conservative mean flow variables. ---*/
+    FaceDouble dU[NDIM+2];
+    for(unsigned short iVar=0; iVar<NDIM+2; ++iVar) dU[iVar] = UR[iVar] - UL[iVar];
+
+    /*--- Compute the Roe average state. ---*/
+    const FaceDouble zL = sqrt(UL[0]);
+    const FaceDouble zR = sqrt(UR[0]);
+    const FaceDouble tmp = 1.0/(zL + zR);
+
+    FaceDouble velAvg[NDIM];
+    FaceDouble alphaAvg = 0.0, vnAvg = 0.0;
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+      velAvg[iDim] = tmp*(zL*velL[iDim] + zR*velR[iDim]);
+      alphaAvg += velAvg[iDim]*velAvg[iDim];
+      vnAvg += velAvg[iDim]*n[iDim];
+    }
+    alphaAvg *= 0.5;
+    const FaceDouble HAvg = tmp*((UL[iE] + pL)/zL + (UR[iE] + pR)/zR);
+
+    /*--- Compute from the Roe average state some variables, which occur
+          quite often in the matrix vector product to be computed. ---*/
+    const FaceDouble a2Avg   = abs(gm1*(HAvg - alphaAvg));
+    const FaceDouble aAvg    = sqrt(a2Avg);
+    const FaceDouble unAvg   = vnAvg - gridVelNorm;
+    const FaceDouble ovaAvg  = 1.0/aAvg;
+    const FaceDouble ova2Avg = 1.0/a2Avg;
+
+    /*--- Compute the absolute values of the three eigenvalues and
+          apply the entropy correction. ---*/
+    FaceDouble lam1 = abs(unAvg + aAvg);
+    FaceDouble lam2 = abs(unAvg - aAvg);
+    FaceDouble lam3 = abs(unAvg);
+
+    const FaceDouble lamMin = Delta*fmax(lam1, lam2);
+    lam1 = fmax(lam1, lamMin);
+    lam2 = fmax(lam2, lamMin);
+    lam3 = fmax(lam3, lamMin);
+
+    /*--- Some abbreviations, which occur quite often in the dissipation terms. ---*/
+    const FaceDouble abv1 = 0.5*(lam1 + lam2);
+    const FaceDouble abv2 = 0.5*(lam1 - lam2);
+    const FaceDouble abv3 = abv1 - lam3;
+
+    FaceDouble abv4 = alphaAvg*dU[0] + dU[iE];
+    FaceDouble abv5 = -vnAvg*dU[0];
+    FaceDouble vnL = 0.0, vnR = 0.0;
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+      abv4 -= velAvg[iDim]*dU[iDim+1];
+      abv5 += n[iDim]*dU[iDim+1];
+      vnL += velL[iDim]*n[iDim];
+      vnR += velR[iDim]*n[iDim];
+    }
+    abv4 *= gm1;
+    const FaceDouble abv6 = abv3*abv4*ova2Avg + abv2*abv5*ovaAvg;
+    const FaceDouble abv7 = abv2*abv4*ovaAvg  + abv3*abv5;
+
+    /*--- Compute the Roe flux vector, which is 0.5*(FL + FR - |A|(UR-UL)). ---*/
+    const FaceDouble unL = vnL - gridVelNorm;
+    const FaceDouble unR = vnR - gridVelNorm;
+    const FaceDouble pa  = pL + pR;
+
+    flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - (lam3*dU[0] + abv6));
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim)
+      flux[iDim+1] = halfArea*(UL[iDim+1]*unL + UR[iDim+1]*unR + pa*n[iDim]
+                   -           (lam3*dU[iDim+1] + velAvg[iDim]*abv6 + n[iDim]*abv7));
+    flux[iE] = halfArea*(UL[iE]*unL + UR[iE]*unR + pL*vnL + pR*vnR
+             -           (lam3*dU[iE] + HAvg*abv6 + vnAvg*abv7));
+  }
+};
+
+/*!
+ * \brief Local Lax-Friedrich (Rusanov) flux for the lanes of FaceDouble.
+ */
+template<unsigned short NDIM>
+struct CLaxFriedrichFluxLanes {
+  su2double gm1;    /*!< \brief Gamma minus one. */
+  su2double gamma;  /*!< \brief Ratio of specific heats. */
+
+  FORCEINLINE void operator()(const FaceDouble *UL, const FaceDouble *UR, const FaceDouble *n,
+                              const FaceDouble &halfArea, const FaceDouble &gridVelNorm,
+                              FaceDouble *flux) const {
+    const unsigned short iE = NDIM+1;
+
+    /*--- Compute the primitive variables of the left and right state. ---*/
+    const FaceDouble ovrL = 1.0/UL[0], ovrR = 1.0/UR[0];
+    FaceDouble kinL = 0.0, kinR = 0.0, vnL = 0.0, vnR = 0.0;
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+      const FaceDouble velL = ovrL*UL[iDim+1];
+      const FaceDouble velR = ovrR*UR[iDim+1];
+      kinL += velL*UL[iDim+1];
+      kinR += velR*UR[iDim+1];
+      vnL += velL*n[iDim];
+      vnR += velR*n[iDim];
+    }
+    const FaceDouble pL  = gm1*(UL[iE] - 0.5*kinL);
+    const FaceDouble pR  = gm1*(UR[iE] - 0.5*kinR);
+    const FaceDouble a2L = gamma*pL*ovrL;
+    const FaceDouble a2R = gamma*pR*ovrR;
+
+    /*--- Compute the spectral radii of the left and right state
+          and take the maximum for the dissipation terms. ---*/
+    const FaceDouble unL = vnL - gridVelNorm;
+    const FaceDouble unR = vnR - gridVelNorm;
+
+    const FaceDouble radL = abs(unL) + sqrt(abs(a2L));
+    const FaceDouble radR = abs(unR) + sqrt(abs(a2R));
+    const FaceDouble rad  = fmax(radL, radR);
+
+    /*--- Compute the flux vector, which is 0.5*(FL + FR - rad(UR-UL)). ---*/
+    const FaceDouble pa = pL + pR;
+
+    flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - rad*(UR[0] - UL[0]));
+    for(unsigned short iDim=0; iDim<NDIM; ++iDim)
+      flux[iDim+1] = halfArea*(UL[iDim+1]*unL + UR[iDim+1]*unR + pa*n[iDim]
+                   -           rad*(UR[iDim+1] - UL[iDim+1]));
+    flux[iE] = halfArea*(UL[iE]*unL + UR[iE]*unR + pL*vnL + pR*vnR - rad*(UR[iE] - UL[iE]));
+  }
+};
+
+/*!
+ * \brief Computes the inviscid fluxes in the points of a chunk of faces with a flux function
+ *        for FaceDouble. The faces of the chunk are stored lane-wise in the padded arrays
+ *        (l*nVar + iVar), hence groups of FaceDouble::Size faces are gathered into the SIMD lanes,
+ *        which vectorizes the Riemann solver across faces instead of over the points of a face.
+ *        The lanes beyond the number of faces repeat the last face and are not stored.
+ */
+template<unsigned short NDIM, class FluxFunction>
+void InviscidFluxesFaceLanes(const unsigned short nFaceSimul,
+                             const unsigned short NPad,
+                             const unsigned long  nPoints,
+                             const unsigned short nVar,
+                             const su2double      *normalsFace[],
+                             const su2double      *gridVelsFace[],
+                             const su2double      *solL,
+                             const su2double      *solR,
+                             su2double            *fluxes,
+                             const FluxFunction   &fluxFunction) {
+
+  constexpr unsigned short nLanes = FaceDouble::Size;
+
+  for(unsigned short l0=0; l0<nFaceSimul; l0+=nLanes) {
+
+    /* Number of faces in this group and the offsets of the lanes. */
+    const unsigned short nValid = min<unsigned short>(nLanes, nFaceSimul-l0);
+    simd::Array<unsigned long, FaceDouble::Size> offsets;
+    for(unsigned short k=0; k<nLanes; ++k)
+      offsets[k] = min<unsigned short>(k, nValid-1)*nVar;
+
+    for(unsigned long i=0; i<nPoints; ++i) {
+
+      const unsigned long offPointer = i*NPad + l0*nVar;
+
+      /*--- Gather the left and right states, the normals and the grid velocities. ---*/
+      FaceDouble UL[NDIM+2], UR[NDIM+2], n[NDIM], halfArea, gridVelNorm;
+      for(unsigned short iVar=0; iVar<NDIM+2; ++iVar) {
+        UL[iVar].gather(solL + offPointer + iVar, offsets);
+        UR[iVar].gather(solR + offPointer + iVar, offsets);
+      }
+
+      for(unsigned short k=0; k<nLanes; ++k) {
+        const unsigned short l = l0 + min<unsigned short>(k, nValid-1);
+        const su2double *norm    = normalsFace[l]  + i*(NDIM+1);
+        const su2double *gridVel = gridVelsFace[l] + i*NDIM;
+
+        su2double gvn = 0.0;
+        for(unsigned short iDim=0; iDim<NDIM; ++iDim) {
+          n[iDim][k] = norm[iDim];
+          gvn += gridVel[iDim]*norm[iDim];
+        }
+        halfArea[k]    = 0.5*norm[NDIM];
+        gridVelNorm[k] = gvn;
+      }
+
+      /*--- Compute the fluxes and scatter the valid lanes. ---*/
+      FaceDouble flux[NDIM+2];
+      fluxFunction(UL, UR, n, halfArea, gridVelNorm, flux);
+
+      for(unsigned short k=0; k<nValid; ++k)
+        for(unsigned short iVar=0; iVar<NDIM+2; ++iVar)
+          fluxes[offPointer + k*nVar + iVar] = flux[iVar][k];
+    }
+  }
+}
+}  // namespace
+
 void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config,
                                                     const unsigned short nFaceSimul,
                                                     const unsigned short NPad,
@@ -8955,238 +9797,12 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
 
       /* Make a distinction between two and three space dimensions
          in order to have the most efficient code. */
-      switch( nDim ) {
-
-        case 2: {
-
-          /* Two dimensional simulation. Loop over the number of faces treated
-             simultaneously. */
-          for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-            /* Easier storage for some variables of this face. */
-            const su2double *normals   = normalsFace[l];
-            const su2double *gridVels  = gridVelsFace[l];
-            const unsigned short lNVar = l*nVar;
-
-            /* Loop over the number of points for this face. */
-            for(unsigned long i=0; i<nPoints; ++i) {
-
-              /* Easier storage of the left and right solution, the face normals,
-                 the grid velocities and the flux vector for this point. */
-              const unsigned long offPointer = i*NPad + lNVar;
-
-              const su2double *UL      = solL + offPointer;
-              const su2double *UR      = solR + offPointer;
-              const su2double *norm    = normals + i*(nDim+1);
-              const su2double *gridVel = gridVels + i*nDim;
-                    su2double *flux    = fluxes + offPointer;
-
-              const su2double nx = norm[0], ny = norm[1], halfArea = 0.5*norm[2];
-
-              /* Compute the normal grid velocity. */
-              const su2double gridVelNorm = gridVel[0]*nx + gridVel[1]*ny;
-
-              /*--- Compute the primitive variables of the left and right state. ---*/
-              su2double tmp       = 1.0/UL[0];
-              const su2double vxL = tmp*UL[1];
-              const su2double vyL = tmp*UL[2];
-              const su2double pL  = gm1*(UL[3] - 0.5*(vxL*UL[1] + vyL*UL[2]));
-
-              tmp                 = 1.0/UR[0];
-              const su2double vxR = tmp*UR[1];
-              const su2double vyR = tmp*UR[2];
-              const su2double pR  = gm1*(UR[3] - 0.5*(vxR*UR[1] + vyR*UR[2]));
-
-              /*--- Compute the difference of the conservative mean flow variables. ---*/
-              const su2double dr  = UR[0] - UL[0];
-              const su2double dru = UR[1] - UL[1];
-              const su2double drv = UR[2] - UL[2];
-              const su2double drE = UR[3] - UL[3];
-
-              /*--- Compute the Roe average state. ---*/
-              const su2double zL = sqrt(UL[0]);
-              const su2double zR = sqrt(UR[0]);
-              tmp                = 1.0/(zL + zR);
-
-              const su2double rHL = UL[3] + pL;
-              const su2double rHR = UR[3] + pR;
-
-              const su2double uAvg = tmp*(zL*vxL + zR*vxR);
-              const su2double vAvg = tmp*(zL*vyL + zR*vyR);
-              const su2double HAvg = tmp*(rHL/zL + rHR/zR);
-
-              /*--- Compute from the Roe average state some variables, which occur
-                    quite often in the matrix vector product to be computed. ---*/
-              const su2double alphaAvg = 0.5*(uAvg*uAvg + vAvg*vAvg);
-              tmp                      = gm1*(HAvg - alphaAvg);
-              const su2double a2Avg    = fabs(tmp);
-              const su2double aAvg     = sqrt(a2Avg);
-              const su2double vnAvg    = uAvg*nx + vAvg*ny;
-              const su2double unAvg    = vnAvg - gridVelNorm;
-              const su2double ovaAvg   = 1.0/aAvg;
-              const su2double ova2Avg  = 1.0/a2Avg;
-
-              /*--- Compute the absolute values of the three eigenvalues and
-                    apply the entropy correction. ---*/
-              su2double lam1 = fabs(unAvg + aAvg);
-              su2double lam2 = fabs(unAvg - aAvg);
-              su2double lam3 = fabs(unAvg);
-
-              tmp  = Delta*max(lam1, lam2);
-              lam1 = max(lam1, tmp);
-              lam2 = max(lam2, tmp);
-              lam3 = max(lam3, tmp);
-
-              /*--- Some abbreviations, which occur quite often in the dissipation terms. ---*/
-              const su2double abv1 = 0.5*(lam1 + lam2);
-              const su2double abv2 = 0.5*(lam1 - lam2);
-              const su2double abv3 = abv1 - lam3;
-
-              const su2double abv4 = gm1*(alphaAvg*dr - uAvg*dru - vAvg*drv + drE);
-              const su2double abv5 = nx*dru + ny*drv - vnAvg*dr;
-              const su2double abv6 = abv3*abv4*ova2Avg + abv2*abv5*ovaAvg;
-              const su2double abv7 = abv2*abv4*ovaAvg  + abv3*abv5;
-
-              /*--- Compute the Roe flux vector, which is 0.5*(FL + FR - |A|(UR-UL)). ---*/
-              const su2double vnL = vxL*nx + vyL*ny;
-              const su2double vnR = vxR*nx + vyR*ny;
-              const su2double unL = vnL - gridVelNorm;
-              const su2double unR = vnR - gridVelNorm;
-              const su2double pa  = pL + pR;
-
-              flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - (lam3*dr + abv6));
-              flux[1] = halfArea*(UL[1]*unL + UR[1]*unR + pa*nx
-                      -           (lam3*dru + uAvg*abv6 + nx*abv7));
-              flux[2] = halfArea*(UL[2]*unL + UR[2]*unR + pa*ny
-                      -           (lam3*drv + vAvg*abv6 + ny*abv7));
-              flux[3] = halfArea*(UL[3]*unL + UR[3]*unR + pL*vnL + pR*vnR
-                      -           (lam3*drE + HAvg*abv6 + vnAvg*abv7));
-            }
-          }
-
-          break;
-        }
-
-        /*--------------------------------------------------------------------*/
-
-        case 3: {
-
-          /* Three dimensional simulation. Loop over the number of faces treated
-             simultaneously. */
-          for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-            /* Easier storage for some variables of this face. */
-            const su2double *normals   = normalsFace[l];
-            const su2double *gridVels  = gridVelsFace[l];
-            const unsigned short lNVar = l*nVar;
-
-            /* Loop over the number of points for this face. */
-            for(unsigned long i=0; i<nPoints; ++i) {
-
-              /* Easier storage of the left and right solution, the face normals,
-                 the grid velocities and the flux vector for this point. */
-              const unsigned long offPointer = i*NPad + lNVar;
-
-              const su2double *UL      = solL + offPointer;
-              const su2double *UR      = solR + offPointer;
-              const su2double *norm    = normals + i*(nDim+1);
-              const su2double *gridVel = gridVels + i*nDim;
-                    su2double *flux    = fluxes + offPointer;
-
-              const su2double nx = norm[0], ny = norm[1], nz = norm[2];
-              const su2double halfArea = 0.5*norm[3];
-
-              /* Compute the normal grid velocity. */
-              const su2double gridVelNorm = gridVel[0]*nx + gridVel[1]*ny + gridVel[2]*nz;
-
-              /*--- Compute the primitive variables of the left and right state. ---*/
-              su2double tmp       = 1.0/UL[0];
-              const su2double vxL = tmp*UL[1];
-              const su2double vyL = tmp*UL[2];
-              const su2double vzL = tmp*UL[3];
-              const su2double pL  = gm1*(UL[4] - 0.5*(vxL*UL[1] + vyL*UL[2] + vzL*UL[3]));
-
-              tmp                 = 1.0/UR[0];
-              const su2double vxR = tmp*UR[1];
-              const su2double vyR = tmp*UR[2];
-              const su2double vzR = tmp*UR[3];
-              const su2double pR  = gm1*(UR[4] - 0.5*(vxR*UR[1] + vyR*UR[2] + vzR*UR[3]));
-
-              /*--- Compute the difference of the conservative mean flow variables. ---*/
-              const su2double dr  = UR[0] - UL[0];
-              const su2double dru = UR[1] - UL[1];
-              const su2double drv = UR[2] - UL[2];
-              const su2double drw = UR[3] - UL[3];
-              const su2double drE = UR[4] - UL[4];
-
-              /*--- Compute the Roe average state. ---*/
-              const su2double zL = sqrt(UL[0]);
-              const su2double zR = sqrt(UR[0]);
-              tmp                = 1.0/(zL + zR);
-
-              const su2double rHL = UL[4] + pL;
-              const su2double rHR = UR[4] + pR;
-
-              const su2double uAvg = tmp*(zL*vxL + zR*vxR);
-              const su2double vAvg = tmp*(zL*vyL + zR*vyR);
-              const su2double wAvg = tmp*(zL*vzL + zR*vzR);
-              const su2double HAvg = tmp*(rHL/zL + rHR/zR);
-
-              /*--- Compute from the Roe average state some variables, which occur
-                    quite often in the matrix vector product to be computed. ---*/
-              const su2double alphaAvg = 0.5*(uAvg*uAvg + vAvg*vAvg + wAvg*wAvg);
-              tmp                      = gm1*(HAvg - alphaAvg);
-              const su2double a2Avg    = fabs(tmp);
-              const su2double aAvg     = sqrt(a2Avg);
-              const su2double vnAvg    = uAvg*nx + vAvg*ny + wAvg*nz;
-              const su2double unAvg    = vnAvg - gridVelNorm;
-              const su2double ovaAvg   = 1.0/aAvg;
-              const su2double ova2Avg  = 1.0/a2Avg;
-
-              /*--- Compute the absolute values of the three eigenvalues and
-                    apply the entropy correction. ---*/
-              su2double lam1 = fabs(unAvg + aAvg);
-              su2double lam2 = fabs(unAvg - aAvg);
-              su2double lam3 = fabs(unAvg);
-
-              tmp  = Delta*max(lam1, lam2);
-              lam1 = max(lam1, tmp);
-              lam2 = max(lam2, tmp);
-              lam3 = max(lam3, tmp);
-
-              /*--- Some abbreviations, which occur quite often in the dissipation terms. ---*/
-              const su2double abv1 = 0.5*(lam1 + lam2);
-              const su2double abv2 = 0.5*(lam1 - lam2);
-              const su2double abv3 = abv1 - lam3;
-
-              const su2double abv4 = gm1*(alphaAvg*dr - uAvg*dru - vAvg*drv -wAvg*drw + drE);
-              const su2double abv5 = nx*dru + ny*drv + nz*drw - vnAvg*dr;
-              const su2double abv6 = abv3*abv4*ova2Avg + abv2*abv5*ovaAvg;
-              const su2double abv7 = abv2*abv4*ovaAvg  + abv3*abv5;
-
-              /*--- Compute the Roe flux vector, which is 0.5*(FL + FR - |A|(UR-UL)). ---*/
-              const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
-              const su2double vnR = vxR*nx + vyR*ny + vzR*nz;
-              const su2double unL = vnL - gridVelNorm;
-              const su2double unR = vnR - gridVelNorm;
-              const su2double pa  = pL + pR;
-
-              flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - (lam3*dr + abv6));
-              flux[1] = halfArea*(UL[1]*unL + UR[1]*unR + pa*nx
-                      -           (lam3*dru + uAvg*abv6 + nx*abv7));
-              flux[2] = halfArea*(UL[2]*unL + UR[2]*unR + pa*ny
-                      -           (lam3*drv + vAvg*abv6 + ny*abv7));
-              flux[3] = halfArea*(UL[3]*unL + UR[3]*unR + pa*nz
-                      -           (lam3*drw + wAvg*abv6 + nz*abv7));
-              flux[4] = halfArea*(UL[4]*unL + UR[4]*unR + pL*vnL + pR*vnR
-                      -           (lam3*drE + HAvg*abv6 + vnAvg*abv7));
-            }
-          }
-
-          break;
-        }
-      }
-
+      if(nDim == 2)
+        InviscidFluxesFaceLanes<2>(nFaceSimul, NPad, nPoints, nVar, normalsFace, gridVelsFace,
+                                   solL, solR, fluxes, CRoeFluxLanes<2>{gm1, Delta});
+      else
+        InviscidFluxesFaceLanes<3>(nFaceSimul, NPad, nPoints, nVar, normalsFace, gridVelsFace,
+                                   solL, solR, fluxes, CRoeFluxLanes<3>{gm1, Delta});
       break;
     }
 
@@ -9194,162 +9810,14 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
 
     case UPWIND::LAX_FRIEDRICH: {
 
-      /* Local Lax-Friedrich (Rusanov) flux Make a distinction between two and
+      /* Local Lax-Friedrich (Rusanov) flux. Make a distinction between two and
          three space dimensions in order to have the most efficient code. */
-      switch( nDim ) {
-
-        case 2: {
-
-          /* Two dimensional simulation. Loop over the number of faces treated
-             simultaneously. */
-          for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-            /* Easier storage for some variables of this face. */
-            const su2double *normals   = normalsFace[l];
-            const su2double *gridVels  = gridVelsFace[l];
-            const unsigned short lNVar = l*nVar;
-
-            /* Loop over the number of points for this face. */
-            for(unsigned long i=0; i<nPoints; ++i) {
-
-              /* Easier storage of the left and right solution, the face normals,
-                 the grid velocities and the flux vector for this point. */
-              const unsigned long offPointer = i*NPad + lNVar;
-
-              const su2double *UL      = solL + offPointer;
-              const su2double *UR      = solR + offPointer;
-              const su2double *norm    = normals + i*(nDim+1);
-              const su2double *gridVel = gridVels + i*nDim;
-                    su2double *flux    = fluxes + offPointer;
-
-              const su2double nx = norm[0], ny = norm[1], halfArea = 0.5*norm[2];
-
-              /* Compute the normal grid velocity. */
-              const su2double gridVelNorm = gridVel[0]*nx + gridVel[1]*ny;
-
-              /*--- Compute the primitive variables of the left and right state. ---*/
-              su2double tmp       = 1.0/UL[0];
-              const su2double vxL = tmp*UL[1];
-              const su2double vyL = tmp*UL[2];
-              const su2double pL  = gm1*(UL[3] - 0.5*(vxL*UL[1] + vyL*UL[2]));
-              const su2double a2L = Gamma*pL*tmp;
-
-              tmp                 = 1.0/UR[0];
-              const su2double vxR = tmp*UR[1];
-              const su2double vyR = tmp*UR[2];
-              const su2double pR  = gm1*(UR[3] - 0.5*(vxR*UR[1] + vyR*UR[2]));
-              const su2double a2R = Gamma*pR*tmp;
-
-              /*--- Compute the difference of the conservative mean flow variables. ---*/
-              const su2double dr  = UR[0] - UL[0];
-              const su2double dru = UR[1] - UL[1];
-              const su2double drv = UR[2] - UL[2];
-              const su2double drE = UR[3] - UL[3];
-
-              /*--- Compute the spectral radii of the left and right state
-                    and take the maximum for the dissipation terms. ---*/
-              const su2double vnL = vxL*nx + vyL*ny;
-              const su2double vnR = vxR*nx + vyR*ny;
-              const su2double unL = vnL - gridVelNorm;
-              const su2double unR = vnR - gridVelNorm;
-
-              const su2double radL = fabs(unL) + sqrt(fabs(a2L));
-              const su2double radR = fabs(unR) + sqrt(fabs(a2R));
-              const su2double rad  = max(radL, radR);
-
-              /*--- Compute the flux vector, which is 0.5*(FL + FR - rad(UR-UL)). ---*/
-              const su2double pa = pL + pR;
-
-              flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - rad*dr);
-              flux[1] = halfArea*(UL[1]*unL + UR[1]*unR + pa*nx - rad*dru);
-              flux[2] = halfArea*(UL[2]*unL + UR[2]*unR + pa*ny - rad*drv);
-              flux[3] = halfArea*(UL[3]*unL + UR[3]*unR + pL*vnL + pR*vnR - rad*drE);
-            }
-          }
-
-          break;
-        }
-
-        /*--------------------------------------------------------------------*/
-
-        case 3: {
-
-          /* Three dimensional simulation. Loop over the number of faces treated
-             simultaneously. */
-          for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-            /* Easier storage for some variables of this face. */
-            const su2double *normals   = normalsFace[l];
-            const su2double *gridVels  = gridVelsFace[l];
-            const unsigned short lNVar = l*nVar;
-
-            /* Loop over the number of points for this face. */
-            for(unsigned long i=0; i<nPoints; ++i) {
-
-              /* Easier storage of the left and right solution, the face normals,
-                 the grid velocities and the flux vector for this point. */
-              const unsigned long offPointer = i*NPad + lNVar;
-
-              const su2double *UL      = solL + offPointer;
-              const su2double *UR      = solR + offPointer;
-              const su2double *norm    = normals + i*(nDim+1);
-              const su2double *gridVel = gridVels + i*nDim;
-                    su2double *flux    = fluxes + offPointer;
-
-              const su2double nx = norm[0], ny = norm[1], nz = norm[2];
-              const su2double halfArea = 0.5*norm[3];
-
-              /* Compute the normal grid velocity. */
-              const su2double gridVelNorm = gridVel[0]*nx + gridVel[1]*ny + gridVel[2]*nz;
-
-              /*--- Compute the primitive variables of the left and right state. ---*/
-              su2double tmp       = 1.0/UL[0];
-              const su2double vxL = tmp*UL[1];
-              const su2double vyL = tmp*UL[2];
-              const su2double vzL = tmp*UL[3];
-              const su2double pL  = gm1*(UL[4] - 0.5*(vxL*UL[1] + vyL*UL[2] + vzL*UL[3]));
-              const su2double a2L = Gamma*pL*tmp;
-
-              tmp                 = 1.0/UR[0];
-              const su2double vxR = tmp*UR[1];
-              const su2double vyR = tmp*UR[2];
-              const su2double vzR = tmp*UR[3];
-              const su2double pR  = gm1*(UR[4] - 0.5*(vxR*UR[1] + vyR*UR[2] + vzR*UR[3]));
-              const su2double a2R = Gamma*pR*tmp;
-
-              /*--- Compute the difference of the conservative mean flow variables. ---*/
-              const su2double dr  = UR[0] - UL[0];
-              const su2double dru = UR[1] - UL[1];
-              const su2double drv = UR[2] - UL[2];
-              const su2double drw = UR[3] - UL[3];
-              const su2double drE = UR[4] - UL[4];
-
-              /*--- Compute the spectral radii of the left and right state
-                    and take the maximum for the dissipation terms. ---*/
-              const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
-              const su2double vnR = vxR*nx + vyR*ny + vzR*nz;
-              const su2double unL = vnL - gridVelNorm;
-              const su2double unR = vnR - gridVelNorm;
-
-              const su2double radL = fabs(unL) + sqrt(fabs(a2L));
-              const su2double radR = fabs(unR) + sqrt(fabs(a2R));
-              const su2double rad  = max(radL, radR);
-
-              /*--- Compute the flux vector, which is 0.5*(FL + FR - rad(UR-UL)). ---*/
-              const su2double pa = pL + pR;
-
-              flux[0] = halfArea*(UL[0]*unL + UR[0]*unR - rad*dr);
-              flux[1] = halfArea*(UL[1]*unL + UR[1]*unR + pa*nx - rad*dru);
-              flux[2] = halfArea*(UL[2]*unL + UR[2]*unR + pa*ny - rad*drv);
-              flux[3] = halfArea*(UL[3]*unL + UR[3]*unR + pa*nz - rad*drw);
-              flux[4] = halfArea*(UL[4]*unL + UR[4]*unR + pL*vnL + pR*vnR - rad*drE);
-            }
-          }
-
-          break;
-        }
-      }
-
+      if(nDim == 2)
+        InviscidFluxesFaceLanes<2>(nFaceSimul, NPad, nPoints, nVar, normalsFace, gridVelsFace,
+                                   solL, solR, fluxes, CLaxFriedrichFluxLanes<2>{gm1, Gamma});
+      else
+        InviscidFluxesFaceLanes<3>(nFaceSimul, NPad, nPoints, nVar, normalsFace, gridVelsFace,
+                                   solL, solR, fluxes, CLaxFriedrichFluxLanes<3>{gm1, Gamma});
       break;
     }
 
@@ -9543,9 +10011,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
@@ -344,10 +344,10 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                 su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
                 su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-                FluidModel->SetTDState_rhoe(solInt[0], eInt);
-                const su2double Pressure = FluidModel->GetPressure();
-                const su2double Temperature = FluidModel->GetTemperature();
-                const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+                GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+                const su2double Pressure = GetFluidModel()->GetPressure();
+                const su2double Temperature = GetFluidModel()->GetTemperature();
+                const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
                 /* Subtract the prescribed wall velocity, i.e. grid velocity
                    from the velocity in the exchange point. */
@@ -375,7 +375,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                                                                           LaminarViscosity, Pressure,
                                                                           Wall_HeatFlux, HeatFlux_Prescribed,
                                                                           Wall_Temperature, Temperature_Prescribed,
-                                                                          FluidModel, tauWall, qWall,
+                                                                          GetFluidModel(), tauWall, qWall,
                                                                           ViscosityWall, kOverCvWall);
 
                 /* Update the viscous forces and moments. Note that the force direction
@@ -546,8 +546,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -679,8 +679,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy + dwdz;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -897,6 +897,9 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
   /* Check whether or not a time stepping scheme is used. */
   const bool time_stepping = config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING;
 
+  /* The implicit scheme always needs the spectral radii of the elements. */
+  const bool implicit = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
+
   /* Allocate the memory for the work array and initialize it to zero to avoid
      warnings in debug mode  about uninitialized memory when padding is applied. */
   vector<su2double> workArrayVec(sizeWorkArray, 0.0);
@@ -944,7 +947,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
    it uses the defined unsteady time step, otherwise it computes the time
    step based on the provided unsteady CFL. Note that the regular CFL
    option in the config is always ignored with time stepping. ---*/
-  if (time_stepping && (config->GetUnst_CFL() == 0.0)) {
+  if (time_stepping && (config->GetUnst_CFL() == 0.0) && !implicit) {
 
     /*--- Loop over the owned volume elements and set the fixed dt. ---*/
     for(unsigned long l=0; l<nVolElemOwned; ++l)
@@ -1039,8 +1042,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1051,7 +1054,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1114,7 +1117,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
                     stepping into account for the minimum and maximum. ---*/
               const su2double dtInv = lenScaleInv*(sqrt(charVel2Max) + radViscMax*lenScaleInv);
 
-              VecDeltaTime[lInd] = CFL/dtInv;
+              VecDeltaTime[lInd]      = CFL/dtInv;
+              VecSpectralRadius[lInd] = dtInv;
 
               const su2double dtEff = volElem[lInd].factTimeLevel*VecDeltaTime[lInd];
               Min_Delta_Time = min(Min_Delta_Time, dtEff);
@@ -1156,8 +1160,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1169,7 +1173,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1253,7 +1257,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
                     stepping into account for the minimum and maximum. ---*/
               const su2double dtInv = lenScaleInv*(sqrt(charVel2Max) + radViscMax*lenScaleInv);
 
-              VecDeltaTime[lInd] = CFL/dtInv;
+              VecDeltaTime[lInd]      = CFL/dtInv;
+              VecSpectralRadius[lInd] = dtInv;
 
               const su2double dtEff = volElem[lInd].factTimeLevel*VecDeltaTime[lInd];
               Min_Delta_Time = min(Min_Delta_Time, dtEff);
@@ -1295,6 +1300,11 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
           the time step of the largest time level, a correction must be used
           for the time level when time accurate local time stepping is used. ---*/
     if (time_stepping) {
+
+      /* The implicit scheme with an imposed time step only needed the
+         spectral radii of the elements. */
+      if(config->GetUnst_CFL() == 0.0) Min_Delta_Time = config->GetDelta_UnstTimeND();
+
       for(unsigned long l=0; l<nVolElemOwned; ++l)
         VecDeltaTime[l] = Min_Delta_Time/volElem[l].factTimeLevel;
 
@@ -1413,9 +1423,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1667,6 +1677,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   su2double *gradFluxZInt = gradFluxYInt + nDim*NPad*nInt;
   su2double *gradSolDOFs  = gradFluxXInt;
   su2double *divFlux      = work;
+  su2double *workTensor   = gradFluxZInt + nDim*NPad*nInt;
 
   /* Determine the offset between the r-derivatives and s-derivatives of the
      fluxes in the integration points and the offset between the r-derivatives
@@ -1756,9 +1767,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1916,7 +1927,10 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductSolAndGradInt(NPad, sol, solInt, workTensor, false);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -2012,7 +2026,10 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductBasisTrans(NPad, divFlux, res, workTensor);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -2129,13 +2146,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2461,6 +2478,9 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
      after the first derivatives. */
   su2double *secDerSol = solAndGradInt + 4*NPad*nInt;  /*(nDim+1)*NPad*nInt. */
 
+  /* The work space of the sum factorization is located after secDerSol. */
+  su2double *workTensor = secDerSol + 6*NPad*nInt;
+
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
@@ -2478,7 +2498,10 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
 
   /* Compute the solution and the derivatives w.r.t. the parametric coordinates
      in the integration points. The first argument is nInt*(nDim+1). */
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductSolAndGradInt(NPad, sol, solAndGradInt, workTensor, true);
+  else
+    blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
 
   /* Compute the second derivatives w.r.t. the parametric coordinates
      in the integration points. */
@@ -2528,13 +2551,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2967,7 +2990,10 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  if( standardElementsSol[ind].TensorProductElement() )
+    standardElementsSol[ind].TensorProductBasisTrans(NPad, divFlux, res, workTensor);
+  else
+    blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
 }
 
 void CFEM_DG_NSSolver::Shock_Capturing_DG(CConfig             *config,
@@ -3070,8 +3096,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -3206,6 +3232,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     su2double *sources       = solDOFs       + nDOFs*NPad;
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
+    su2double *workTensor    = fluxes        + nInt *NPad*nDim;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
@@ -3232,7 +3259,10 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
        of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductSolAndGradInt(NPad, solDOFs, solAndGradInt, workTensor, true);
+    else
+      blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -3326,9 +3356,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3519,9 +3549,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3687,14 +3717,20 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    if( standardElementsSol[ind].TensorProductElement() )
+      standardElementsSol[ind].TensorProductDerBasisTrans(NPad, fluxes, solDOFs, workTensor);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      if( standardElementsSol[ind].TensorProductElement() )
+        standardElementsSol[ind].TensorProductBasisTrans(NPad, sources, solAndGradInt, workTensor);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -4344,8 +4380,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -4440,8 +4476,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -6322,10 +6358,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+        const su2double Pressure = GetFluidModel()->GetPressure();
+        const su2double Temperature = GetFluidModel()->GetTemperature();
+        const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6352,7 +6388,7 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
                                               Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              GetFluidModel(), tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
         /* Compute the wall velocity in tangential direction. */
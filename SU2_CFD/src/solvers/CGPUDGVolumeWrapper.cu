@@ -0,0 +1,255 @@
+/*!
+ * \file CGPUDGVolumeWrapper.cu
+ * \brief CUDA kernels and device memory management of CGPUDGVolumeWrapper.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HAVE_CUDA
+#define HAVE_CUDA
+#endif
+
+#include "../../include/solvers/CGPUDGVolumeWrapper.hpp"
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
+
+#include <cuda_runtime.h>
+#include <algorithm>
+#include <string>
+
+namespace {
+
+constexpr unsigned int BLOCK_SIZE = 256;
+constexpr unsigned short NVAR = 5;
+constexpr unsigned short NDIM = 3;
+constexpr unsigned short NMETRIC = NDIM * NDIM + 1;
+
+inline void checkCuda(cudaError_t err, const char* func) {
+  if (err != cudaSuccess) SU2_MPI::Error(std::string("CUDA error: ") + cudaGetErrorString(err), func);
+}
+
+inline unsigned int numBlocks(unsigned long n) { return static_cast<unsigned int>((n + BLOCK_SIZE - 1) / BLOCK_SIZE); }
+
+template <class T>
+void allocAndCopy(T*& dst, const T* src, unsigned long n, const char* func) {
+  checkCuda(cudaMalloc(reinterpret_cast<void**>(&dst), n * sizeof(T)), func);
+  if (src) checkCuda(cudaMemcpy(dst, src, n * sizeof(T), cudaMemcpyHostToDevice), func);
+}
+
+template <class T>
+void release(T*& ptr) {
+  if (ptr) cudaFree(ptr);
+  ptr = nullptr;
+}
+
+/*!
+ * \brief Interpolate the solution to an integration point and compute the parametric Euler fluxes,
+ *        multiplied by minus the integration weight, one thread per integration point.
+ */
+__global__ void volumeFluxKernel(unsigned long pointBeg, unsigned long pointEnd, unsigned long dofBeg, double gm1,
+                                 const unsigned long* pointElem, const unsigned short* elemStd,
+                                 const unsigned long* offsetDOFs, const unsigned long* offsetInt,
+                                 const unsigned short* stdNDOFs, const unsigned long* stdOffBasis,
+                                 const unsigned long* stdOffWeights, const double* basis, const double* weights,
+                                 const double* metric, const double* gridVel, const double* solDOFs, double* fluxes) {
+  const unsigned long p = pointBeg + blockIdx.x * static_cast<unsigned long>(blockDim.x) + threadIdx.x;
+  if (p >= pointEnd) return;
+
+  const auto iElem = pointElem[p];
+  const auto iStd = elemStd[iElem];
+  const auto i = p - offsetInt[iElem];
+  const unsigned short nDOFs = stdNDOFs[iStd];
+
+  /*--- Interpolate the solution, the DOFs are stored relative to the first DOF of the range. ---*/
+  const double* lagInt = basis + stdOffBasis[iStd] + i * nDOFs;
+  const double* sol = solDOFs + (offsetDOFs[iElem] - dofBeg) * NVAR;
+
+  double U[NVAR] = {0.0};
+  for (unsigned short j = 0; j < nDOFs; ++j)
+    for (unsigned short k = 0; k < NVAR; ++k) U[k] += lagInt[j] * sol[j * NVAR + k];
+
+  const double rhoInv = 1.0 / U[0];
+  const double vel[NDIM] = {U[1] * rhoInv, U[2] * rhoInv, U[3] * rhoInv};
+  const double P = gm1 * (U[4] - 0.5 * U[0] * (vel[0] * vel[0] + vel[1] * vel[1] + vel[2] * vel[2]));
+
+  const double w = weights[stdOffWeights[iStd] + i];
+  const double* m = metric + p * NMETRIC;
+  const double* gv = gridVel + p * NDIM;
+  const double velRel[NDIM] = {vel[0] - gv[0], vel[1] - gv[1], vel[2] - gv[2]};
+
+  double* flux = fluxes + (p - pointBeg) * NDIM * NVAR;
+  for (unsigned short d = 0; d < NDIM; ++d) {
+    const double wDx = -w * m[1 + d * NDIM];
+    const double wDy = -w * m[2 + d * NDIM];
+    const double wDz = -w * m[3 + d * NDIM];
+    const double Un = velRel[0] * wDx + velRel[1] * wDy + velRel[2] * wDz;
+
+    double* f = flux + d * NVAR;
+    f[0] = U[0] * Un;
+    f[1] = U[1] * Un + P * wDx;
+    f[2] = U[2] * Un + P * wDy;
+    f[3] = U[3] * Un + P * wDz;
+    f[4] = U[4] * Un + P * (vel[0] * wDx + vel[1] * wDy + vel[2] * wDz);
+  }
+}
+
+/*!
+ * \brief Residual of a DOF from the fluxes of the integration points of its element, one thread per DOF.
+ */
+__global__ void volumeResidualKernel(unsigned long dofBeg, unsigned long dofEnd, unsigned long pointBeg,
+                                     const unsigned long* dofElem, const unsigned short* elemStd,
+                                     const unsigned long* offsetDOFs, const unsigned long* offsetInt,
+                                     const unsigned short* stdNInt, const unsigned long* stdOffBasis,
+                                     const double* derBasisTrans, const double* fluxes, double* res) {
+  const unsigned long q = dofBeg + blockIdx.x * static_cast<unsigned long>(blockDim.x) + threadIdx.x;
+  if (q >= dofEnd) return;
+
+  const auto iElem = dofElem[q];
+  const auto iStd = elemStd[iElem];
+  const auto j = q - offsetDOFs[iElem];
+  const unsigned short nInt = stdNInt[iStd];
+
+  const double* derLag = derBasisTrans + stdOffBasis[iStd] * NDIM + j * nInt * NDIM;
+  const double* flux = fluxes + (offsetInt[iElem] - pointBeg) * NDIM * NVAR;
+
+  double R[NVAR] = {0.0};
+  for (unsigned long id = 0; id < nInt * NDIM; ++id)
+    for (unsigned short k = 0; k < NVAR; ++k) R[k] += derLag[id] * flux[id * NVAR + k];
+
+  for (unsigned short k = 0; k < NVAR; ++k) res[(q - dofBeg) * NVAR + k] = R[k];
+}
+
+}  // namespace
+
+void CGPUDGVolumeWrapper::Clean() {
+  release(d_stdNInt);
+  release(d_stdNDOFs);
+  release(d_stdOffBasis);
+  release(d_stdOffWeights);
+  release(d_basis);
+  release(d_derBasisTrans);
+  release(d_weights);
+  release(d_elemStd);
+  release(d_offsetDOFs);
+  release(d_offsetInt);
+  release(d_pointElem);
+  release(d_dofElem);
+  release(d_metric);
+  release(d_gridVel);
+  release(d_sol);
+  release(d_flux);
+  release(d_res);
+}
+
+void CGPUDGVolumeWrapper::Initialize(const std::vector<unsigned short>& stdNInt,
+                                     const std::vector<unsigned short>& stdNDOFs,
+                                     const std::vector<const double*>& stdBasis,
+                                     const std::vector<const double*>& stdDerBasisTrans,
+                                     const std::vector<const double*>& stdWeights,
+                                     const std::vector<unsigned short>& elemStd,
+                                     const std::vector<double>& metricTerms,
+                                     const std::vector<double>& gridVelocities, double gammaMinusOne) {
+  Clean();
+
+  gm1 = gammaMinusOne;
+  nElem = elemStd.size();
+
+  /*--- Concatenate the data of the standard elements, the derivatives have NDIM times
+   *    the size of the basis functions, so both use the same offsets. ---*/
+  const auto nStd = stdNInt.size();
+  std::vector<unsigned long> stdOffBasis(nStd + 1, 0), stdOffWeights(nStd + 1, 0);
+  for (size_t s = 0; s < nStd; ++s) {
+    stdOffBasis[s + 1] = stdOffBasis[s] + stdNInt[s] * stdNDOFs[s];
+    stdOffWeights[s + 1] = stdOffWeights[s] + stdNInt[s];
+  }
+  std::vector<double> basis(stdOffBasis[nStd]), derBasisTrans(NDIM * stdOffBasis[nStd]), weights(stdOffWeights[nStd]);
+  for (size_t s = 0; s < nStd; ++s) {
+    const auto size = stdNInt[s] * stdNDOFs[s];
+    std::copy(stdBasis[s], stdBasis[s] + size, basis.begin() + stdOffBasis[s]);
+    std::copy(stdDerBasisTrans[s], stdDerBasisTrans[s] + NDIM * size, derBasisTrans.begin() + NDIM * stdOffBasis[s]);
+    std::copy(stdWeights[s], stdWeights[s] + stdNInt[s], weights.begin() + stdOffWeights[s]);
+  }
+
+  /*--- Element offsets and the reverse maps from points and DOFs to elements. ---*/
+  offsetDOFs.assign(nElem + 1, 0);
+  offsetInt.assign(nElem + 1, 0);
+  for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
+    offsetDOFs[iElem + 1] = offsetDOFs[iElem] + stdNDOFs[elemStd[iElem]];
+    offsetInt[iElem + 1] = offsetInt[iElem] + stdNInt[elemStd[iElem]];
+  }
+  nDOFsTot = offsetDOFs[nElem];
+  nIntTot = offsetInt[nElem];
+
+  if (metricTerms.size() != NMETRIC * nIntTot || gridVelocities.size() != NDIM * nIntTot)
+    SU2_MPI::Error("Inconsistent size of the element data.", CURRENT_FUNCTION);
+
+  std::vector<unsigned long> pointElem(nIntTot), dofElem(nDOFsTot);
+  for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
+    for (auto p = offsetInt[iElem]; p < offsetInt[iElem + 1]; ++p) pointElem[p] = iElem;
+    for (auto q = offsetDOFs[iElem]; q < offsetDOFs[iElem + 1]; ++q) dofElem[q] = iElem;
+  }
+
+  allocAndCopy(d_stdNInt, stdNInt.data(), nStd, CURRENT_FUNCTION);
+  allocAndCopy(d_stdNDOFs, stdNDOFs.data(), nStd, CURRENT_FUNCTION);
+  allocAndCopy(d_stdOffBasis, stdOffBasis.data(), nStd, CURRENT_FUNCTION);
+  allocAndCopy(d_stdOffWeights, stdOffWeights.data(), nStd, CURRENT_FUNCTION);
+  allocAndCopy(d_basis, basis.data(), basis.size(), CURRENT_FUNCTION);
+  allocAndCopy(d_derBasisTrans, derBasisTrans.data(), derBasisTrans.size(), CURRENT_FUNCTION);
+  allocAndCopy(d_weights, weights.data(), weights.size(), CURRENT_FUNCTION);
+
+  allocAndCopy(d_elemStd, elemStd.data(), nElem, CURRENT_FUNCTION);
+  allocAndCopy(d_offsetDOFs, offsetDOFs.data(), nElem + 1, CURRENT_FUNCTION);
+  allocAndCopy(d_offsetInt, offsetInt.data(), nElem + 1, CURRENT_FUNCTION);
+  allocAndCopy(d_pointElem, pointElem.data(), nIntTot, CURRENT_FUNCTION);
+  allocAndCopy(d_dofElem, dofElem.data(), nDOFsTot, CURRENT_FUNCTION);
+  allocAndCopy(d_metric, metricTerms.data(), metricTerms.size(), CURRENT_FUNCTION);
+  allocAndCopy(d_gridVel, gridVelocities.data(), gridVelocities.size(), CURRENT_FUNCTION);
+
+  allocAndCopy(d_sol, static_cast<const double*>(nullptr), nDOFsTot * NVAR, CURRENT_FUNCTION);
+  allocAndCopy(d_flux, static_cast<const double*>(nullptr), nIntTot * NDIM * NVAR, CURRENT_FUNCTION);
+  allocAndCopy(d_res, static_cast<const double*>(nullptr), nDOFsTot * NVAR, CURRENT_FUNCTION);
+}
+
+void CGPUDGVolumeWrapper::VolumeResidual(unsigned long elemBeg, unsigned long elemEnd, const double* sol,
+                                         double* res) {
+  if (elemEnd <= elemBeg) return;
+
+  const auto dofBeg = offsetDOFs[elemBeg], dofEnd = offsetDOFs[elemEnd];
+  const auto pointBeg = offsetInt[elemBeg], pointEnd = offsetInt[elemEnd];
+
+  checkCuda(cudaMemcpy(d_sol, sol, (dofEnd - dofBeg) * NVAR * sizeof(double), cudaMemcpyHostToDevice),
+            CURRENT_FUNCTION);
+
+  volumeFluxKernel<<<numBlocks(pointEnd - pointBeg), BLOCK_SIZE>>>(
+      pointBeg, pointEnd, dofBeg, gm1, d_pointElem, d_elemStd, d_offsetDOFs, d_offsetInt, d_stdNDOFs, d_stdOffBasis,
+      d_stdOffWeights, d_basis, d_weights, d_metric, d_gridVel, d_sol, d_flux);
+  checkCuda(cudaGetLastError(), CURRENT_FUNCTION);
+
+  volumeResidualKernel<<<numBlocks(dofEnd - dofBeg), BLOCK_SIZE>>>(dofBeg, dofEnd, pointBeg, d_dofElem, d_elemStd,
+                                                                  d_offsetDOFs, d_offsetInt, d_stdNInt,
+                                                                  d_stdOffBasis, d_derBasisTrans, d_flux, d_res);
+  checkCuda(cudaGetLastError(), CURRENT_FUNCTION);
+
+  checkCuda(cudaMemcpy(res, d_res, (dofEnd - dofBeg) * NVAR * sizeof(double), cudaMemcpyDeviceToHost),
+            CURRENT_FUNCTION);
+}
@@ -174,13 +174,21 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
   /*--- current dimension if we run consecutive on each dimension ---*/
   unsigned int iDim = 0;
 
-  /*--- Set vector and sparse matrix to 0 ---*/
+  /*--- Set vectors to 0 ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
-  Jacobian.SetValZero();
 
-  /*--- Compute the stiffness matrix for the smoothing operator. ---*/
-  Compute_StiffMatrix(geometry, numerics, config);
+  /*--- The smoothing operator only depends on the geometry. It is assembled once, the boundary conditions
+   * applied to it again below do not change it, and the preconditioner built for the first right hand side
+   * is kept for all the others (the other dimensions and the next calls). ---*/
+  const bool assemble = !volumeOperatorReady;
+
+  if (assemble) {
+    Jacobian.SetValZero();
+    SetCurrentDim(0);
+    Compute_StiffMatrix(geometry, numerics, config);
+  }
+  volumeOperatorReady = true;
 
   /*--- Impose boundary conditions to the RHS and solve the system. ---*/
   if (config->GetSmoothSepDim()) {
@@ -192,6 +200,8 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
 
       Impose_BC(geometry, config);
 
+      System.SetMatrixUnchanged(!assemble || iDim > 0);
+
       Solve_Linear_System(geometry, config);
 
       WriteSensitivity(geometry, config);
@@ -205,6 +215,8 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
 
     Impose_BC(geometry, config);
 
+    System.SetMatrixUnchanged(!assemble);
+
     Solve_Linear_System(geometry, config);
 
     WriteSensitivity(geometry, config);
@@ -217,6 +229,8 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingSurface(CGeometry* geometry
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
   Jacobian.SetValZero();
+  volumeOperatorReady = false;
+  System.SetMatrixUnchanged(false);
   std::fill(visited.begin(), visited.end(), false);
 
   /*--- Loop over all DV markers to compute the stiffness matrix for the smoothing operator. ---*/
@@ -256,6 +270,7 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingDV(CGeometry* geometry, CNu
 
   /*--- Reset the Jacobian to 0 ---*/
   Jacobian.SetValZero();
+  volumeOperatorReady = false;
 
   /*--- Record the parameterization on the AD tape. ---*/
   if (rank == MASTER_NODE)  cout << " calculate the original gradient" << endl;
@@ -139,12 +139,8 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   SetBaseClassPointerToNodes();
 
   /*--- Communicate and store volume and the number of neighbors for any dual CVs that lie on on periodic markers. ---*/
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_VOLUME);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_VOLUME);
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
-  }
+  PeriodicComms(geometry, config, PERIODIC_VOLUME);
+  PeriodicComms(geometry, config, PERIODIC_NEIGHBORS);
   /*--- Store if implicit scheme is used. This has implications on the Residual and Jacobian handling for periodic
    * boundaries  ---*/
   const bool euler_implicit = (config->GetKind_TimeIntScheme_Heat() == EULER_IMPLICIT);
@@ -280,10 +276,30 @@ void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
   CScalarSolver<CHeatVariable>::Upwind_Residual(geometry, solver_container, numerics_container, config, iMesh);
 }
 
+void CHeatSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+  if (flow) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    edgeNumerics = CNumericsSIMD::CreateHeatNumerics(*config, nDim);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   /*--- For fluid problems the viscous residual is included in the convective residual. ---*/
   if (flow) return;
+
+  /*--- Use the vectorized numerics if possible. ---*/
+  if (config->GetUseVectorization()) {
+    if (!edgeNumerics) InstantiateEdgeNumerics(solver_container, config);
+    if (edgeNumerics) {
+      EdgeFluxResidual(geometry, config);
+      return;
+    }
+  }
+
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num() * MAX_TERMS];
 
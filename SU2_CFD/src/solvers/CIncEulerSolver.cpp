@@ -27,11 +27,13 @@
 
 #include "../../include/solvers/CIncEulerSolver.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
 #include "../../include/fluid/CConstantDensity.hpp"
 #include "../../include/fluid/CIncIdealGas.hpp"
 #include "../../include/fluid/CIncIdealGasPolynomial.hpp"
 #include "../../include/variables/CIncNSVariable.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/fluid/CFluidScalar.hpp"
 #include "../../include/fluid/CFluidFlamelet.hpp"
@@ -161,7 +163,7 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::FLOW, ReducerStrategy);
   }
   else {
     if (rank == MASTER_NODE)
@@ -236,6 +238,23 @@ CIncEulerSolver::~CIncEulerSolver() {
   for(auto& model : FluidModel) delete model;
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes());
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme in use does not support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
   su2double Temperature_FreeStream = 0.0,  ModVel_FreeStream = 0.0,Energy_FreeStream = 0.0,
@@ -1013,26 +1032,34 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    /*--- Gradient and limiter computation in one pass if possible. ---*/
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    if (limiter && !van_albada && CanFuseGradientLimiter(config)) {
+      SetPrimitive_Gradient_Limiter(geometry, config);
     }
+    else {
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
+
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
 
-    /*--- Limiter computation ---*/
+      /*--- Limiter computation ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+      if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    }
   }
 }
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
   unsigned long iPoint, nonPhysicalPoints = 0;
+  SU2_KERNEL_COUNTER(PRIMITIVES);
 
   AD::StartNoSharedReading();
 
@@ -1206,6 +1233,14 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Use vectorization on request, the bounded scalar discretization needs the mass flux of each edge,
+   * which the vectorized numerics do not store. ---*/
+  if (config->GetUseVectorization() && (config->GetKind_Upwind_Flow() == UPWIND::FDS) &&
+      !config->GetBounded_Scalar()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
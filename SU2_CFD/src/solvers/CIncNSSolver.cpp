@@ -74,9 +74,15 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- The reconstruction gradient (which may be the primitive gradient) and the limiters can be computed
+   *    in one pass (see CNSSolver::Preprocessing). ---*/
+
+  const bool reconGradient = config->GetReconstructionGradientRequired();
+  const bool fuseLimiter = muscl && !center && limiter && !van_albada && !Output && CanFuseGradientLimiter(config);
+
   /*--- Compute gradient for MUSCL reconstruction ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  if (reconGradient && muscl && !center && !fuseLimiter) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -89,16 +95,21 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  if (reconGradient || !fuseLimiter) {
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
   }
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (fuseLimiter) {
+    SetPrimitive_Gradient_Limiter(geometry, config);
+  }
+  else if (muscl && !center && limiter && !van_albada && !Output) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -288,6 +299,7 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, c
   const SPECIES_MODEL species_model = config->GetKind_Species_Model();
 
   bool tkeNeeded = (turb_model == TURB_MODEL::SST);
+  SU2_KERNEL_COUNTER(PRIMITIVES);
 
   AD::StartNoSharedReading();
 
@@ -631,6 +643,8 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
 
   const su2double kappa = config->GetwallModel_Kappa();
   const su2double B = config->GetwallModel_B();
+  const su2double expKappaB = exp(-kappa * B);
+  const su2double minYPlus = config->GetwallModel_MinYPlus();
 
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -718,13 +732,13 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
       su2double diff = 1.0;
       su2double U_Tau = max(1.0e-6,sqrt(WallShearStress/Density_Wall));
       /*--- Use minimum y+ as defined in the config, in case the routine below for computing y+ does not converge ---*/
-      su2double Y_Plus = 0.99*config->GetwallModel_MinYPlus();
+      su2double Y_Plus = 0.99*minYPlus;
 
       const su2double Y_Plus_Start = Density_Wall * U_Tau * WallDistMod / Lam_Visc_Wall;
 
       /*--- Automatic switch off when y+ < "limit" according to Nichols & Nelson (2004) ---*/
 
-      if (Y_Plus_Start < config->GetwallModel_MinYPlus()) {
+      if (Y_Plus_Start < minYPlus) {
         smallYPlusCounter++;
         continue;
       }
@@ -740,16 +754,17 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
         /*--- Y+ defined by White & Christoph ---*/
 
         const su2double kUp = kappa * U_Plus;
+        const su2double expKUp = exp(kUp);
 
         // incompressible adiabatic result
-        const su2double Y_Plus_White = exp(kUp) * exp(-kappa * B);
+        const su2double Y_Plus_White = expKUp * expKappaB;
 
         /*--- Spalding's universal form for the BL velocity with the
          *    outer velocity form of White & Christoph above. ---*/
-        Y_Plus = U_Plus + Y_Plus_White + (exp(-kappa * B)* (1.0 - kUp - 0.5 * kUp * kUp - kUp * kUp * kUp / 6.0));
+        Y_Plus = U_Plus + Y_Plus_White + (expKappaB* (1.0 - kUp - 0.5 * kUp * kUp - kUp * kUp * kUp / 6.0));
 
         /*--- incompressible formulation ---*/
-        Eddy_Visc_Wall = Lam_Visc_Wall * kappa*exp(-kappa*B) * (exp(kUp) -1.0 - kUp - kUp * kUp / 2.0);
+        Eddy_Visc_Wall = Lam_Visc_Wall * kappa*expKappaB * (expKUp -1.0 - kUp - kUp * kUp / 2.0);
 
         Eddy_Visc_Wall = max(1.0e-6, Eddy_Visc_Wall);
 
@@ -759,7 +774,7 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
 
         /* --- Gradient of function defined above wrt U_Tau --- */
 
-        const su2double dyp_dup = 1.0 + exp(-kappa * B) * (kappa * exp(kUp) - kappa - kUp - 0.5 * kUp * kUp);
+        const su2double dyp_dup = 1.0 + expKappaB * (kappa * expKUp - kappa - kUp - 0.5 * kUp * kUp);
         const su2double dup_dutau = - U_Plus / U_Tau;
         const su2double grad_diff = Density_Wall * WallDistMod / Lam_Visc_Wall - dyp_dup * dup_dutau;
 
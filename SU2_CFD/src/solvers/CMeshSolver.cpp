@@ -757,8 +757,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
 
 void CMeshSolver::SetDualTime_Mesh(){
 
-  nodes->Set_Solution_time_n1();
-  nodes->Set_Solution_time_n();
+  nodes->Shift_Solution_time_n();
 }
 
 void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
@@ -32,6 +32,7 @@
 #include "../../include/fluid/CMutationTCLib.hpp"
 #include "../../include/fluid/CSU2TCLib.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
                            unsigned short iMesh, const bool navier_stokes) :
@@ -133,12 +134,17 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::FLOW, false);
   }
   else {
     if (rank == MASTER_NODE)  cout<< "Explicit Scheme. No Jacobian structure (" << description << "). MG level: " << iMesh <<"."<<endl;
   }
 
+  /*--- Storage of the source Jacobians for point-implicit explicit schemes. ---*/
+  if (config->GetPointImplicit_Sources() && (config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT)) {
+    SourceJacobian.resize(nPointDomain, nVar*nVar) = su2double(0.0);
+  }
+
   /*--- Read farfield conditions from the config file ---*/
   Mach_Inf            = config->GetMach();
   Density_Inf         = config->GetDensity_FreeStreamND();
@@ -459,6 +465,20 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
   }
 }
 
+void CNEMOEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+
+  edgeNumerics = CNumericsSIMD::CreateNEMONumerics(*config, nDim, nSpecies, *FluidModel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme or the gas model in use does not support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                        CConfig *config, unsigned short iMesh) {
 
@@ -474,6 +494,27 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   ErrorCounter = 0;
   END_SU2_OMP_MASTER
 
+  /*--- Use vectorization on request, only for first order since the secondary variables of the
+   * MUSCL-reconstructed states are computed by the fluid model. The edges are visited in packs of
+   * SIMD length, the lanes are applied one after the other, so no coloring is needed. ---*/
+  if (config->GetUseVectorization() && !muscl) {
+    if (!edgeNumerics) InstantiateEdgeNumerics(solver_container, config);
+
+    const auto nEdge = geometry->GetnEdge();
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge += Double::Size) {
+      Int edges;
+      Double mask;
+      for (auto k = 0ul; k < Double::Size; ++k) {
+        bool in = (iEdge+k < nEdge);
+        mask[k] = in;
+        edges[k] = iEdge + k*in;
+      }
+      edgeNumerics->ComputeFlux(edges, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian,
+                                nullptr, 0);
+    }
+    return;
+  }
+
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM];
 
@@ -753,9 +794,17 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   const bool axisymm    = config->GetAxisymmetric();
   const bool viscous    = config->GetViscous();
   const bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
+  const bool point_implicit = !implicit && (SourceJacobian.rows() == nPointDomain);
 
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
 
+  /*--- Accumulate the Jacobian of the chemistry and relaxation sources of a point. ---*/
+  auto AddSourceJacobian = [&](unsigned long iPoint, const CNumerics::ResidualType<>& residual) {
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        SourceJacobian(iPoint, iVar*nVar+jVar) += residual.jacobian_i[iVar][jVar];
+  };
+
   /*--- Initialize the error counter ---*/
   unsigned long eAxi_local = 0;
   unsigned long eChm_local = 0;
@@ -790,6 +839,10 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
     numerics->SetCoord(geometry->nodes->GetCoord(iPoint), nullptr);
 
+    if (point_implicit) {
+      for (auto iVar = 0ul; iVar < nVar*nVar; iVar++) SourceJacobian(iPoint, iVar) = 0.0;
+    }
+
     /*--- Compute finite rate chemistry ---*/
 
     if(!monoatomic){
@@ -798,13 +851,15 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
         auto residual = numerics->ComputeChemistry(config);
 
         /*--- Check for errors before applying source to the linear system ---*/
-        err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+        err = CNumerics::CheckResidualNaNs(implicit || point_implicit, nVar, residual);
 
         /*--- Apply the chemical sources to the linear system ---*/
         if (!err) {
           LinSysRes.SubtractBlock(iPoint, residual);
           if (implicit)
             Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+          if (point_implicit)
+            AddSourceJacobian(iPoint, residual);
         } else
           eChm_local++;
       }
@@ -817,13 +872,15 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
       auto residual = numerics->ComputeVibRelaxation(config);
 
       /*--- Check for errors before applying source to the linear system ---*/
-      err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+      err = CNumerics::CheckResidualNaNs(implicit || point_implicit, nVar, residual);
 
       /*--- Apply the vibrational relaxation terms to the linear system ---*/
       if (!err) {
         LinSysRes.SubtractBlock(iPoint, residual);
         if (implicit)
           Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+        if (point_implicit)
+          AddSourceJacobian(iPoint, residual);
       } else
         eVib_local++;
     }
@@ -896,6 +953,56 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+template<ENUM_TIME_INT IntegrationType>
+FORCEINLINE void CNEMOEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                                      CConfig *config, unsigned short iRKStep) {
+
+  if (SourceJacobian.rows() != nPointDomain) {
+    CFVMFlowSolverBase::Explicit_Iteration<IntegrationType>(geometry, solver_container, config, iRKStep);
+    return;
+  }
+
+  /*--- Point-implicit treatment of the sources, the update of each point is the solution of
+   *    (I - dt/Vol * dS/dU) dU = -dt/Vol * R, which has the same fixed point as the explicit update
+   *    but is not limited by the time scales of the chemistry and of the relaxation. ---*/
+
+  struct Precond {
+    const CNEMOEulerSolver* solver;
+    const CGeometry* geometry;
+    const unsigned short nVar;
+    su2activematrix matrix;
+    su2double* rows[MAXNVAR];
+    su2double update[MAXNVAR];
+
+    Precond(const CNEMOEulerSolver* s, const CGeometry* g, unsigned short n) : solver(s), geometry(g), nVar(n) {
+      matrix.resize(nVar,nVar);
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) rows[iVar] = matrix[iVar];
+    }
+
+    FORCEINLINE void compute(const CConfig*, unsigned long iPoint) {
+      const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+      const su2double Delta = solver->nodes->GetDelta_Time(iPoint) / Vol;
+
+      const su2double* res = solver->LinSysRes.GetBlock(iPoint);
+      const su2double* resTrunc = solver->nodes->GetResTruncError(iPoint);
+
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+        for (unsigned short jVar = 0; jVar < nVar; ++jVar)
+          matrix(iVar,jVar) = -Delta * solver->SourceJacobian(iPoint, iVar*nVar+jVar);
+        matrix(iVar,iVar) += 1.0;
+        update[iVar] = res[iVar] + resTrunc[iVar];
+      }
+      CSolver::Gauss_Elimination(rows, update, nVar);
+    }
+
+    FORCEINLINE su2double apply(unsigned short iVar, const su2double*, const su2double*) const {
+      return update[iVar];
+    }
+  } precond(this, geometry, nVar);
+
+  Explicit_Iteration_impl<IntegrationType>(precond, geometry, solver_container, config, iRKStep);
+}
+
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                             CConfig *config, unsigned short iRKStep) {
 
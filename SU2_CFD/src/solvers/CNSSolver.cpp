@@ -29,6 +29,8 @@
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CTapeStatistics.hpp"
+#include "../../../Common/include/toolboxes/CKernelCounters.hpp"
 #include "../../include/solvers/CFVMFlowSolverBase.inl"
 
 /*--- Explicit instantiation of the parent class of CEulerSolver,
@@ -88,7 +90,14 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  /*--- The reconstruction gradient and the limiters can be computed in one pass, if the former is
+   *    the primitive gradient its exchange cannot be deferred as other terms need it at halo points. ---*/
+
+  const bool reconGradient = config->GetReconstructionGradientRequired();
+  const bool fuseLimiter = muscl && !center && limiter && !van_albada && !Output &&
+                           CanFuseGradientLimiter(config) && (reconGradient || !CommOverlap);
+
+  if (reconGradient && muscl && !center && !fuseLimiter) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -101,18 +110,25 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  if (reconGradient || !fuseLimiter) {
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
   }
 
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, nPrimVarGrad_bak);
 
-  /*--- Compute the limiters ---*/
+  /*--- Compute the limiters, the halo exchange can complete during the edge loop (see Upwind_Residual). ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (fuseLimiter) {
+    if (CommOverlap) DeferComms(PRIMITIVE_RECONSTRUCTION);
+    SetPrimitive_Gradient_Limiter(geometry, config);
+  }
+  else if (muscl && !center && limiter && !van_albada && !Output) {
+    if (CommOverlap) DeferComms(PRIMITIVE_LIMITER);
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -126,7 +142,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
 }
 
-unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
+unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config, bool zeroResidual) {
 
   /*--- Number of non-physical points, local to the thread, needs
    *    further reduction if function is called in parallel ---*/
@@ -134,6 +150,9 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == TURB_MODEL::SST);
+  const bool preacc = ClosedFormFluidModel(config);
+  SU2_TAPE_PROBE(PRIMITIVES);
+  SU2_KERNEL_COUNTER(PRIMITIVES);
 
   AD::StartNoSharedReading();
 
@@ -156,13 +175,26 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
+    if (preacc) {
+      AD::StartPreacc();
+      nodes->SetPrimVarPreaccIn(iPoint);
+      AD::SetPreaccIn(eddy_visc, turb_ke);
+    }
+
     bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(iPoint, eddy_visc, turb_ke, GetFluidModel());
     nodes->SetSecondaryVar(iPoint, GetFluidModel());
 
+    if (preacc) {
+      nodes->SetPrimVarPreaccOut(iPoint, physical);
+      AD::EndPreacc();
+    }
+
     /*--- Check for non-realizable states for reporting. ---*/
 
     nonPhysicalPoints += !physical;
 
+    if (zeroResidual) LinSysRes.SetBlock_Zero(iPoint);
+
   }
   END_SU2_OMP_FOR
 
@@ -808,6 +840,8 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
 
   const su2double kappa = config->GetwallModel_Kappa();
   const su2double B = config->GetwallModel_B();
+  const su2double expKappaB = exp(-1.0*kappa*B);
+  const su2double minYPlus = config->GetwallModel_MinYPlus();
 
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -822,6 +856,16 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
     if (config->GetWallFunction_Treatment(Marker_Tag) != WALL_FUNCTIONS::STANDARD_FUNCTION)
       continue;
 
+    /*--- If a wall heat flux was given, it is used directly in the wall model (the lookup by
+     *    name is done once per marker), isothermal walls keep their temperature. ---*/
+
+    const bool isothermal = (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL);
+    su2double q_w = 0.0;
+
+    if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
+      q_w = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
+    }
+
     /*--- Loop over all of the vertices on this boundary marker ---*/
 
     SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
@@ -877,14 +921,6 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
       su2double T_Wall = nodes->GetTemperature(iPoint);
       const su2double Conductivity_Wall = nodes->GetThermalConductivity(iPoint);
 
-      /*--- If a wall temperature was given, we compute the local heat flux using k*dT/dn ---*/
-
-      su2double q_w = 0.0;
-
-      if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
-        q_w = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
-      }
-
       /*--- Extrapolate the pressure from the interior & compute the
        wall density using the equation of state ---*/
 
@@ -919,13 +955,13 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
       su2double diff = 1.0;
       su2double U_Tau = max(1.0e-6,sqrt(WallShearStress/Density_Wall));
       /*--- Use minimum y+ as defined in the config, in case the routine below for computing y+ does not converge ---*/
-      su2double Y_Plus = 0.99*config->GetwallModel_MinYPlus(); // use clipping value as minimum
+      su2double Y_Plus = 0.99*minYPlus; // use clipping value as minimum
 
       const su2double Y_Plus_Start = Density_Wall * U_Tau * WallDistMod / Lam_Visc_Wall;
 
       /*--- Automatic switch off when y+ < "limit" according to Nichols & Nelson (2004) ---*/
 
-      if (Y_Plus_Start < config->GetwallModel_MinYPlus()) {
+      if (Y_Plus_Start < minYPlus) {
         smallYPlusCounter++;
         continue;
       }
@@ -948,7 +984,7 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
         /*--- Crocco-Busemann equation for wall temperature (eq. 11 of Nichols and Nelson) ---*/
         /*--- update T_Wall due to aerodynamic heating, unless the wall is isothermal      ---*/
 
-        if (config->GetMarker_All_KindBC(iMarker) != ISOTHERMAL) {
+        if (!isothermal) {
           const su2double denum = (1.0 + Beta*U_Plus - Gam*U_Plus*U_Plus);
           if (denum > EPS){
             T_Wall = T_Normal / denum;
@@ -968,16 +1004,16 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Y+ defined by White & Christoph (compressibility and heat transfer) negative value for (2.0*Gam*U_Plus - Beta)/Q ---*/
 
-        const su2double Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
+        const su2double Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*expKappaB;
 
         /*--- Spalding's universal form for the BL velocity with the
          *    outer velocity form of White & Christoph above. ---*/
         const su2double kUp = kappa*U_Plus;
-        Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)* (1.0 + kUp + 0.5*kUp*kUp + kUp*kUp*kUp/6.0));
+        Y_Plus = U_Plus + Y_Plus_White - (expKappaB* (1.0 + kUp + 0.5*kUp*kUp + kUp*kUp*kUp/6.0));
 
         const su2double dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
 
-        Eddy_Visc_Wall = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
+        Eddy_Visc_Wall = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*expKappaB*
                                          (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0)
                                          - Lam_Visc_Normal/Lam_Visc_Wall);
         Eddy_Visc_Wall = max(1.0e-6, Eddy_Visc_Wall);
@@ -990,7 +1026,7 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
 
         const su2double grad_diff = Density_Wall * WallDistMod / Lam_Visc_Wall + VelTangMod / (U_Tau * U_Tau) +
                   kappa /(U_Tau * sqrt(Gam)) * asin(U_Plus * sqrt(Gam)) * Y_Plus_White -
-                  exp(-1.0 * B * kappa) * (0.5 * pow(VelTangMod * kappa / U_Tau, 3) +
+                  expKappaB * (0.5 * pow(VelTangMod * kappa / U_Tau, 3) +
                   pow(VelTangMod * kappa / U_Tau, 2) + VelTangMod * kappa / U_Tau) / U_Tau;
 
         /* --- Newton Step --- */
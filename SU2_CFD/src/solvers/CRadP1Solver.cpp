@@ -537,15 +537,31 @@ void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     }
   }
 
-  /*--- Solve or smooth the linear system ---*/
-
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
+  /*--- Solve or smooth the linear system. The rest of the solver is not hybrid parallel, but the
+   linear solver is (it is usually the most expensive part of the radiation iteration). ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    const auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+    SU2_OMP_MASTER
+    IterLinSol = iter;
+    END_SU2_OMP_MASTER
+
+    SU2_OMP_FOR_STAT(computeStaticChunkSize(nPointDomain, omp_get_num_threads(), 512))
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
+      }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+
+  /*--- For fixed absorption and scattering coefficients the P1 operator is linear, and the pseudo time
+   step only depends on the geometry, therefore the matrix is the same in every iteration and its
+   preconditioner (e.g. the ILU factors) is built only once, unless the grid moves. ---*/
+
+  System.SetMatrixUnchanged(!config->GetDynamic_Grid());
 
   /*--- The the number of iterations of the linear solver ---*/
 
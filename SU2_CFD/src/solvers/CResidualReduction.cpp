@@ -0,0 +1,99 @@
+/*!
+ * \file CResidualReduction.cpp
+ * \brief Packed (single collective) reduction of the residuals of the solvers of a zone.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/solvers/CResidualReduction.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+void CResidualReduction::Register(CSolver* solver, unsigned long nPointGlobal) {
+
+  /*--- The local values of a solver cannot change while they are being reduced. ---*/
+  for (const auto& entry : inFlight) {
+    if (entry.solver == solver) {
+      SU2_MPI::Error("The residuals of a solver were updated before their reduction was completed.",
+                     CURRENT_FUNCTION);
+    }
+  }
+  for (auto& entry : pending) {
+    if (entry.solver == solver) {
+      entry.nPointGlobal = nPointGlobal;
+      return;
+    }
+  }
+  pending.push_back({solver, nPointGlobal});
+}
+
+void CResidualReduction::Start() {
+
+  if (pending.empty()) return;
+  Finish();
+
+  /*--- The same solvers register on all ranks, in the same order. ---*/
+
+  unsigned long count = 0;
+  for (const auto& entry : pending) count += entry.solver->GetResidualPackSize();
+
+  sendBuf.resize(count);
+  recvBuf.resize(count * SU2_MPI::GetSize());
+
+  count = 0;
+  for (const auto& entry : pending) {
+    entry.solver->PackResiduals(&sendBuf[count]);
+    count += entry.solver->GetResidualPackSize();
+  }
+
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Iallgather(sendBuf.data(), count, MPI_DOUBLE, recvBuf.data(), count, MPI_DOUBLE,
+                      SU2_MPI::GetComm(), &request);
+#else
+  SU2_MPI::Allgather(sendBuf.data(), count, MPI_DOUBLE, recvBuf.data(), count, MPI_DOUBLE, SU2_MPI::GetComm());
+#endif
+
+  inFlight.swap(pending);
+  pending.clear();
+}
+
+void CResidualReduction::Complete() {
+  Start();
+  Finish();
+}
+
+void CResidualReduction::Finish() {
+
+  if (inFlight.empty()) return;
+
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  SU2_MPI::Wait(&request, MPI_STATUS_IGNORE);
+#endif
+
+  const auto stride = sendBuf.size();
+  unsigned long offset = 0;
+  for (const auto& entry : inFlight) {
+    entry.solver->UnpackResiduals(&recvBuf[offset], stride, SU2_MPI::GetSize(), entry.nPointGlobal);
+    offset += entry.solver->GetResidualPackSize();
+  }
+  inFlight.clear();
+}
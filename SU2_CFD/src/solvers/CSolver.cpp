@@ -46,7 +46,17 @@
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
-#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include "../../../Common/include/toolboxes/CDistributedNearestNeighbor.hpp"
+#include "../../../Common/include/toolboxes/CSymmetricMatrix.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimers.hpp"
+#include "../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -189,6 +199,116 @@ CSolver::~CSolver() {
   delete VerificationSolution;
 }
 
+void CSolver::InitializeJacobian(CGeometry *geometry, const CConfig *config, LINEAR_SYSTEM system, bool needTranspPtr,
+                                 bool segregated) {
+
+  singlePrecSystem = config->GetLinear_Solver_Single_Prec(system);
+  segregatedSystem = segregated;
+
+  const unsigned short nVarJac = segregated ? 1 : nVar;
+
+  if (segregated) {
+    LinSysSolVar.Initialize(nPoint, nPointDomain, 1, 0.0);
+    LinSysResVar.Initialize(nPoint, nPointDomain, 1, 0.0);
+  }
+
+  /*--- If the system is solved in single precision the working precision matrix is only used for assembly. ---*/
+
+  Jacobian.Initialize(nPoint, nPointDomain, nVarJac, nVarJac, true, geometry, config, needTranspPtr, false,
+                      singlePrecSystem);
+
+  /*--- The later stages of Rosenbrock methods solve with the matrix of the first stage. ---*/
+  if (system == LINEAR_SYSTEM::FLOW && config->GetKind_Rosenbrock() != ROSENBROCK_SCHEME::NONE) {
+    JacobianStage.Initialize(nPoint, nPointDomain, nVarJac, nVarJac, true, geometry, config, false, false, true);
+    LinSysSolStage.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
+  /*--- The edge Jacobian of the flow is only lagged on the finest grid. ---*/
+  if (system == LINEAR_SYSTEM::FLOW && config->GetJacobian_Lag() > 1 && geometry->GetMGLevel() == MESH_0) {
+    JacobianLagged.Initialize(nPoint, nPointDomain, nVarJac, nVarJac, true, geometry, config, false, false, true);
+  }
+
+  /*--- The POD basis is only used on the finest grid. ---*/
+  if (system == LINEAR_SYSTEM::FLOW && config->GetKind_ROM_Online() != ROM_ONLINE::NONE &&
+      geometry->GetMGLevel() == MESH_0) {
+    ReadlibROMBasis(geometry, config);
+  }
+
+  /*--- The products of the matrix that is used to solve the system are offloaded. ---*/
+  const bool gpuSystem = config->GetLinear_Solver_GPU(system);
+
+  if (gpuSystem && !singlePrecSystem) Jacobian.EnableGPU();
+
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+  if (singlePrecSystem) {
+    if (rank == MASTER_NODE) cout << "Linear system solved in single precision." << endl;
+    JacobianSP.Initialize(nPoint, nPointDomain, nVarJac, nVarJac, true, geometry, config);
+    if (gpuSystem) JacobianSP.EnableGPU();
+  }
+#endif
+}
+
+void CSolver::SolveLinearSystem(CGeometry *geometry, const CConfig *config) {
+
+  unsigned long iter = 0;
+  su2double residual = 0.0;
+
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+  if (singlePrecSystem) {
+    /*--- The barrier at the end of CopyValues makes the flag visible to all threads. ---*/
+    SU2_OMP_MASTER
+    SystemSP.SetxIsZero(System.GetxIsZero());
+    END_SU2_OMP_MASTER
+
+    JacobianSP.CopyValues(Jacobian);
+  }
+#endif
+
+  auto Solve = [&](const CSysVector<su2double>& res, CSysVector<su2double>& sol) {
+    if (!singlePrecSystem) {
+      iter = max(iter, System.Solve(Jacobian, res, sol, geometry, config));
+      residual = max(residual, su2double(System.GetResidual()));
+    }
+#ifdef USE_SINGLE_PRECISION_SYSTEMS
+    else {
+      iter = max(iter, SystemSP.Solve(JacobianSP, res, sol, geometry, config));
+      residual = max(residual, su2double(SystemSP.GetResidual()));
+    }
+#endif
+  };
+
+  if (!segregatedSystem) {
+    Solve(LinSysRes, LinSysSol);
+  } else {
+    /*--- One scalar system per variable, the matrix is the same for all of them. ---*/
+#ifdef HAVE_OMP
+    const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), 512);
+#endif
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        LinSysResVar(iPoint, 0) = LinSysRes(iPoint, iVar);
+        LinSysSolVar(iPoint, 0) = LinSysSol(iPoint, iVar);
+      }
+      END_SU2_OMP_FOR
+
+      Solve(LinSysResVar, LinSysSolVar);
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        LinSysSol(iPoint, iVar) = LinSysSolVar(iPoint, 0);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SetIterLinSolver(iter);
+    SetResLinSolver(residual);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CSolver::GetPeriodicCommCountAndType(const CConfig* config,
                                           unsigned short commType,
                                           unsigned short &COUNT_PER_POINT,
@@ -1085,13 +1205,17 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
         iPeriodic = geometry->Local_Marker_PeriodicRecv[msg_offset + iRecv];
 
         /*--- While all periodic face data was accumulated, we only store
-         the values for the current pair of periodic faces. This is slightly
-         inefficient when we have multiple pairs of periodic faces, but
-         it simplifies the communications. ---*/
+         the values for the current pair of periodic faces (or for all of
+         them if the pairs are disjoint, see PeriodicComms). ---*/
 
-        if ((iPeriodic == val_periodic_index) ||
+        if ((val_periodic_index == 0) ||
+            (iPeriodic == val_periodic_index) ||
             (iPeriodic == val_periodic_index + nPeriodic/2)) {
 
+          /*--- Whether the point is on the passive face of its pair. ---*/
+
+          const bool passive = (iPeriodic > nPeriodic/2);
+
           /*--- Compute the offset in the recv buffer for this point. ---*/
 
           buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
@@ -1155,7 +1279,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
                 Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
 
-                if (iPeriodic == val_periodic_index + nPeriodic/2) {
+                if (passive) {
                   for (iVar = 0; iVar < nVar; iVar++) {
                     LinSysRes(iPoint, iVar) = 0.0;
                     total_index = iPoint*nVar+iVar;
@@ -1176,8 +1300,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
                we are updating the solution at the passive nodes
                using the new solution from the master. ---*/
 
-              if ((implicit_periodic) &&
-                  (iPeriodic == val_periodic_index + nPeriodic/2)) {
+              if (implicit_periodic && passive) {
 
                 /*--- Directly set the solution on the passive periodic
                  face that is provided from the master. ---*/
@@ -1322,36 +1445,84 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
 }
 
+void CSolver::PeriodicComms(CGeometry *geometry,
+                            const CConfig *config,
+                            unsigned short commType) {
+
+  const unsigned short nPeriodicPair = config->GetnMarker_Periodic()/2;
+
+  /*--- The data of all the pairs is sent in every exchange, when no point
+   lies on more than one pair a single exchange updates all of them. ---*/
+
+  if (geometry->disjointPeriodicPairs && (nPeriodicPair > 1)) {
+    InitiatePeriodicComms(geometry, config, 0, commType);
+    CompletePeriodicComms(geometry, config, 0, commType);
+    return;
+  }
+
+  for (unsigned short iPeriodic = 1; iPeriodic <= nPeriodicPair; iPeriodic++) {
+    InitiatePeriodicComms(geometry, config, iPeriodic, commType);
+    CompletePeriodicComms(geometry, config, iPeriodic, commType);
+  }
+}
+
 void CSolver::GetCommCountAndType(const CConfig* config,
                                   unsigned short commType,
                                   unsigned short &COUNT_PER_POINT,
                                   unsigned short &MPI_TYPE) const {
+
+  /*--- The quantities that are only used by the reconstruction (gradients, limiters, sensors) can be
+   sent in single precision, which halves the volume of the messages (not with AD types). ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  const unsigned short REC_TYPE = COMM_TYPE_DOUBLE;
+#else
+  const unsigned short REC_TYPE = config->GetHalo_Single_Precision() ? COMM_TYPE_FLOAT : COMM_TYPE_DOUBLE;
+#endif
+
   switch (commType) {
     case SOLUTION:
     case SOLUTION_OLD:
     case UNDIVIDED_LAPLACIAN:
-    case SOLUTION_LIMITER:
       COUNT_PER_POINT  = nVar;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case SOLUTION_LIMITER:
+      COUNT_PER_POINT  = nVar;
+      MPI_TYPE         = REC_TYPE;
+      break;
     case MAX_EIGENVALUE:
-    case SENSOR:
+    case TIME_STEP:
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case SENSOR:
+      COUNT_PER_POINT  = 1;
+      MPI_TYPE         = REC_TYPE;
+      break;
     case SOLUTION_GRADIENT:
-    case SOLUTION_GRAD_REC:
       COUNT_PER_POINT  = nVar*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case SOLUTION_GRAD_REC:
+      COUNT_PER_POINT  = nVar*nDim;
+      MPI_TYPE         = REC_TYPE;
+      break;
     case PRIMITIVE_GRADIENT:
-    case PRIMITIVE_GRAD_REC:
       COUNT_PER_POINT  = nPrimVarGrad*nDim;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case PRIMITIVE_GRAD_REC:
+      COUNT_PER_POINT  = nPrimVarGrad*nDim;
+      MPI_TYPE         = REC_TYPE;
+      break;
     case PRIMITIVE_LIMITER:
       COUNT_PER_POINT  = nPrimVarGrad;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = REC_TYPE;
+      break;
+    case PRIMITIVE_RECONSTRUCTION:
+      COUNT_PER_POINT  = nPrimVarGrad*(nDim+1);
+      MPI_TYPE         = REC_TYPE;
       break;
     case SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
@@ -1393,13 +1564,14 @@ namespace CommHelpers {
       case SOLUTION_GRAD_REC: return nodes->GetGradient_Reconstruction();
       case PRIMITIVE_GRADIENT: return nodes->GetGradient_Primitive();
       case PRIMITIVE_GRAD_REC: return nodes->GetGradient_Reconstruction();
+      case PRIMITIVE_RECONSTRUCTION: return nodes->GetGradient_Reconstruction();
       case AUXVAR_GRADIENT: return nodes->GetAuxVarGradient();
       default: return nodes->GetGradient();
     }
   }
 
   su2activematrix& selectLimiter(CVariable* nodes, unsigned short commType) {
-    if (commType == PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
+    if (commType == PRIMITIVE_LIMITER || commType == PRIMITIVE_RECONSTRUCTION) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
 }
@@ -1408,6 +1580,12 @@ void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PHASE_TIMER(HALO_COMMS);
+
+  /*--- The communication buffers are about to be reused. ---*/
+
+  CompleteDeferredComms(geometry, config);
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1432,6 +1610,15 @@ void CSolver::InitiateComms(CGeometry *geometry,
   /*--- Set some local pointers to make access simpler. ---*/
 
   su2double *bufDSend = geometry->bufD_P2PSend;
+  float *bufFSend = geometry->bufF_P2PSend;
+
+  /*--- Reconstruction quantities may go in the single precision buffer. ---*/
+
+  const bool singlePrec = (MPI_TYPE == COMM_TYPE_FLOAT);
+  auto packRec = [&](unsigned long pos, const su2double& val) {
+    if (singlePrec) bufFSend[pos] = static_cast<float>(SU2_TYPE::GetValue(val));
+    else bufDSend[pos] = val;
+  };
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1491,13 +1678,16 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case SOLUTION_LIMITER:
           case PRIMITIVE_LIMITER:
             for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
+              packRec(buf_offset+iVar, limiter(iPoint, iVar));
             break;
           case MAX_EIGENVALUE:
             bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
             break;
+          case TIME_STEP:
+            bufDSend[buf_offset] = base_nodes->GetDelta_Time(iPoint);
+            break;
           case SENSOR:
-            bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
+            packRec(buf_offset, base_nodes->GetSensor(iPoint));
             break;
           case SOLUTION_GRADIENT:
           case PRIMITIVE_GRADIENT:
@@ -1506,7 +1696,14 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case AUXVAR_GRADIENT:
             for (iVar = 0; iVar < nVarGrad; iVar++)
               for (iDim = 0; iDim < nDim; iDim++)
-                bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+                packRec(buf_offset+iVar*nDim+iDim, gradient(iPoint, iVar, iDim));
+            break;
+          case PRIMITIVE_RECONSTRUCTION:
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              for (iDim = 0; iDim < nDim; iDim++)
+                packRec(buf_offset+iVar*nDim+iDim, gradient(iPoint, iVar, iDim));
+              packRec(buf_offset+nPrimVarGrad*nDim+iVar, limiter(iPoint, iVar));
+            }
             break;
           case SOLUTION_FEA:
             for (iVar = 0; iVar < nVar; iVar++) {
@@ -1550,38 +1747,37 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
-  /*--- Local variables ---*/
+  SU2_PHASE_TIMER(HALO_COMMS);
 
-  unsigned short iDim, iVar;
-  unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
-  unsigned short COUNT_PER_POINT = 0;
-  unsigned short MPI_TYPE = 0;
+  /*--- Local variables ---*/
 
   int ind, source, iMessage, jRecv;
 
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
-  /*--- Set the size of the data packet and type depending on quantity. ---*/
-
-  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
-
-  /*--- Set some local pointers to make access simpler. ---*/
+  /*--- The completion of this exchange was deferred, see DeferComms. ---*/
 
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
-
-  /*--- Handle the different types of gradient and limiter. ---*/
-
-  const auto nVarGrad = COUNT_PER_POINT / nDim;
-  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
-  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+  if (DeferNextComms && (commType == DeferredCommType)) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      DeferNextComms = false;
+      CommsInFlight = true;
+      if (CommProgressThread) StartCommProgress(geometry, config);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
 
   if (geometry->nP2PRecv > 0) {
 
-    for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
+    /*--- Skip the messages of a deferred exchange that the progress thread already unpacked. ---*/
+
+    for (iMessage = nRecvUnpacked; iMessage < geometry->nP2PRecv; iMessage++) {
 
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
@@ -1596,105 +1792,208 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
       jRecv = geometry->P2PRecv2Neighbor[source];
 
-      /*--- Get the offset in the buffer for the start of this message. ---*/
+      UnpackP2PMessage(geometry, config, commType, jRecv);
+    }
 
-      msg_offset = geometry->nPoint_P2PRecv[jRecv];
+    /*--- Verify that all non-blocking point-to-point sends have finished.
+     Note that this should be satisfied, as we have received all of the
+     data in the loop above at this point. ---*/
 
-      /*--- Get the number of packets to be received in this message. ---*/
+#ifdef HAVE_MPI
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
+                               nRecvUnpacked = 0;)
+#endif
+  }
 
-      nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
-               geometry->nPoint_P2PRecv[jRecv]);
+}
 
-      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
-      for (iRecv = 0; iRecv < nRecv; iRecv++) {
+void CSolver::UnpackP2PMessage(CGeometry *geometry,
+                               const CConfig *config,
+                               unsigned short commType,
+                               int jRecv) {
 
-        /*--- Get the local index for this communicated data. ---*/
+  /*--- Local variables ---*/
 
-        iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
+  unsigned short iDim, iVar;
+  unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
+  unsigned short COUNT_PER_POINT = 0;
+  unsigned short MPI_TYPE = 0;
 
-        /*--- Compute the offset in the recv buffer for this point. ---*/
+  /*--- Set the size of the data packet and type depending on quantity. ---*/
 
-        buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
+  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
-        /*--- Store the data correctly depending on the quantity. ---*/
+  /*--- Set some local pointers to make access simpler. ---*/
 
-        switch (commType) {
-          case SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
-            break;
-          case UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_LIMITER:
-          case PRIMITIVE_LIMITER:
-            for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
-            break;
-          case MAX_EIGENVALUE:
-            base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
-            break;
-          case SENSOR:
-            base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
-            break;
-          case SOLUTION_GRADIENT:
-          case PRIMITIVE_GRADIENT:
-          case SOLUTION_GRAD_REC:
-          case PRIMITIVE_GRAD_REC:
-          case AUXVAR_GRADIENT:
-            for (iVar = 0; iVar < nVarGrad; iVar++)
-              for (iDim = 0; iDim < nDim; iDim++)
-                gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
-            break;
-          case SOLUTION_FEA:
-            for (iVar = 0; iVar < nVar; iVar++) {
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-              if (config->GetTime_Domain()) {
-                base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
-                base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
-              }
-            }
-            break;
-          case MESH_DISPLACEMENTS:
-            for (iDim = 0; iDim < nDim; iDim++)
-              base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
-            break;
-          case SOLUTION_TIME_N:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case SOLUTION_TIME_N1:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          default:
-            SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                           CURRENT_FUNCTION);
-            break;
+  const su2double *bufDRecv = geometry->bufD_P2PRecv;
+  const float *bufFRecv = geometry->bufF_P2PRecv;
+
+  /*--- Reconstruction quantities may come in the single precision buffer. ---*/
+
+  const bool singlePrec = (MPI_TYPE == COMM_TYPE_FLOAT);
+  auto unpackRec = [&](unsigned long pos) -> su2double {
+    return singlePrec ? su2double(bufFRecv[pos]) : bufDRecv[pos];
+  };
+
+  /*--- Handle the different types of gradient and limiter. ---*/
+
+  const auto nVarGrad = COUNT_PER_POINT / nDim;
+  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
+  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+
+  /*--- Get the offset in the buffer for the start of this message. ---*/
+
+  msg_offset = geometry->nPoint_P2PRecv[jRecv];
+
+  /*--- Get the number of packets to be received in this message. ---*/
+
+  nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
+           geometry->nPoint_P2PRecv[jRecv]);
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+
+    /*--- Get the local index for this communicated data. ---*/
+
+    iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
+
+    /*--- Compute the offset in the recv buffer for this point. ---*/
+
+    buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
+
+    /*--- Store the data correctly depending on the quantity. ---*/
+
+    switch (commType) {
+      case SOLUTION:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_OLD:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_EDDY:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
+        break;
+      case UNDIVIDED_LAPLACIAN:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_LIMITER:
+      case PRIMITIVE_LIMITER:
+        for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
+          limiter(iPoint,iVar) = unpackRec(buf_offset+iVar);
+        break;
+      case MAX_EIGENVALUE:
+        base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
+        break;
+      case TIME_STEP:
+        base_nodes->SetDelta_Time(iPoint,bufDRecv[buf_offset]);
+        break;
+      case SENSOR:
+        base_nodes->SetSensor(iPoint,unpackRec(buf_offset));
+        break;
+      case SOLUTION_GRADIENT:
+      case PRIMITIVE_GRADIENT:
+      case SOLUTION_GRAD_REC:
+      case PRIMITIVE_GRAD_REC:
+      case AUXVAR_GRADIENT:
+        for (iVar = 0; iVar < nVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            gradient(iPoint,iVar,iDim) = unpackRec(buf_offset+iVar*nDim+iDim);
+        break;
+      case PRIMITIVE_RECONSTRUCTION:
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          for (iDim = 0; iDim < nDim; iDim++)
+            gradient(iPoint,iVar,iDim) = unpackRec(buf_offset+iVar*nDim+iDim);
+          limiter(iPoint,iVar) = unpackRec(buf_offset+nPrimVarGrad*nDim+iVar);
         }
-      }
-      END_SU2_OMP_FOR
+        break;
+      case SOLUTION_FEA:
+        for (iVar = 0; iVar < nVar; iVar++) {
+          base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+          if (config->GetTime_Domain()) {
+            base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
+            base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
+          }
+        }
+        break;
+      case MESH_DISPLACEMENTS:
+        for (iDim = 0; iDim < nDim; iDim++)
+          base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
+        break;
+      case SOLUTION_TIME_N:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      case SOLUTION_TIME_N1:
+        for (iVar = 0; iVar < nVar; iVar++)
+          base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+        break;
+      default:
+        SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
+                       CURRENT_FUNCTION);
+        break;
     }
+  }
+  END_SU2_OMP_FOR
 
-    /*--- Verify that all non-blocking point-to-point sends have finished.
-     Note that this should be satisfied, as we have received all of the
-     data in the loop above at this point. ---*/
+}
 
-#ifdef HAVE_MPI
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
+void CSolver::StartCommProgress(CGeometry *geometry,
+                                const CConfig *config) {
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+
+  /*--- The thread tests the receives and unpacks each message as it arrives. This does not race with
+   the compute threads as long as they do not read the halo data of the deferred quantity, which is
+   the point of deferring it. The remaining messages are unpacked by CompleteComms. ---*/
+
+  const auto commType = DeferredCommType;
+  nRecvUnpacked = 0;
+
+  CommProgress.Start([this, geometry, config, commType]() {
+    int ind = 0, flag = 0;
+    SU2_MPI::Status recvStatus;
+    SU2_MPI::Testany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &flag, &recvStatus);
+
+    if (flag && (ind != MPI_UNDEFINED)) {
+      UnpackP2PMessage(geometry, config, commType, geometry->P2PRecv2Neighbor[recvStatus.MPI_SOURCE]);
+      ++nRecvUnpacked;
+    }
+    return nRecvUnpacked == geometry->nP2PRecv;
+  });
 #endif
+}
+
+void CSolver::DeferComms(unsigned short commType) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    DeferNextComms = true;
+    DeferredCommType = commType;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CSolver::CompleteDeferredComms(CGeometry *geometry,
+                                    const CConfig *config) {
+
+  if (!CommsInFlight) return;
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    CommsInFlight = false;
+    /*--- After this the progress thread no longer accesses MPI or the data. ---*/
+    CommProgress.Stop();
   }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
 
+  CompleteComms(geometry, config, DeferredCommType);
 }
 
 void CSolver::ResetCFLAdapt() {
@@ -1930,6 +2229,13 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
 
   if (geometry->GetMGLevel() != MESH_0) return;
 
+  /*--- Defer the reductions, to complete them with those of the other solvers of the zone. ---*/
+
+  if (ResidualReduction && config->GetComm_Level() == COMM_FULL) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(ResidualReduction->Register(this, geometry->GetGlobal_nPointDomain());)
+    return;
+  }
+
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
 
   /*--- Set the L2 Norm residual in all the processors. ---*/
@@ -1949,18 +2255,7 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
     Global_nPointDomain = geometry->GetnPointDomain();
   }
 
-  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-
-    if (std::isnan(SU2_TYPE::GetValue(rbuf_res[iVar]))) {
-      SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
-    }
-
-    Residual_RMS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
-
-    if (log10(GetRes_RMS(iVar)) > 20.0) {
-      SU2_MPI::Error("SU2 has diverged (Residual > 10^20 detected).", CURRENT_FUNCTION);
-    }
-  }
+  FinalizeResidual_RMS(rbuf_res.data(), Global_nPointDomain);
 
   /*--- Set the Maximum residual in all the processors. ---*/
 
@@ -1987,6 +2282,52 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+void CSolver::FinalizeResidual_RMS(const su2double* sumRes, unsigned long nPointGlobal) {
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+
+    if (std::isnan(SU2_TYPE::GetValue(sumRes[iVar]))) {
+      SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
+    }
+
+    Residual_RMS[iVar] = max(EPS*EPS, sqrt(sumRes[iVar]/nPointGlobal));
+
+    if (log10(GetRes_RMS(iVar)) > 20.0) {
+      SU2_MPI::Error("SU2 has diverged (Residual > 10^20 detected).", CURRENT_FUNCTION);
+    }
+  }
+}
+
+void CSolver::PackResiduals(su2double* buf) const {
+
+  /*--- Layout: sums of squares, max residuals, global index of the max, coordinates of the max. ---*/
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    buf[iVar] = Residual_RMS[iVar];
+    buf[nVar + iVar] = Residual_Max[iVar];
+    buf[2*nVar + iVar] = static_cast<passivedouble>(Point_Max[iVar]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      buf[3*nVar + iVar*nDim + iDim] = Point_Max_Coord(iVar,iDim);
+  }
+}
+
+void CSolver::UnpackResiduals(const su2double* buf, unsigned long stride, int nProc, unsigned long nPointGlobal) {
+
+  vector<su2double> rbuf_res(nVar, 0.0);
+
+  for (int iProcessor = 0; iProcessor < nProc; iProcessor++) {
+    const su2double* procBuf = buf + iProcessor*stride;
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      rbuf_res[iVar] += procBuf[iVar];
+      const auto point = static_cast<unsigned long>(SU2_TYPE::GetValue(procBuf[2*nVar + iVar]));
+      AddRes_Max(iVar, procBuf[nVar + iVar], point, &procBuf[3*nVar + iVar*nDim]);
+    }
+  }
+
+  FinalizeResidual_RMS(rbuf_res.data(), nPointGlobal);
+}
+
 void CSolver::SetResidual_BGS(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetMGLevel() != MESH_0) return;
@@ -2177,10 +2518,7 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
 
   /*--- Correct the Laplacian across any periodic boundaries. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-  }
+  PeriodicComms(geometry, config, PERIODIC_LAPLACIAN);
 
   /*--- MPI parallelization ---*/
 
@@ -2892,8 +3230,27 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
 
 }
 
+namespace RestartHelpers {
+  /*--- Global indices of the domain points of the rank, in the order of the data of restart files. ---*/
+  vector<unsigned long> GetSortedGlobalDomainPoints(const CGeometry* geometry) {
+    vector<unsigned long> points(geometry->GetnPointDomain());
+    for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) points[iPoint] = geometry->nodes->GetGlobalIndex(iPoint);
+    sort(points.begin(), points.end());
+    return points;
+  }
+}
+
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
 
+  /*--- Like the writer, restarts without a time iteration (e.g. the time statistics) are not in the series. ---*/
+
+  string series;
+  unsigned long step = 0;
+  if (config->GetRestart_Time_Series() && CSU2TimeSeriesFileWriter::SplitStepName(val_filename, series, step)) {
+    Read_SU2_Restart_TimeSeries(geometry, config, val_filename);
+    return;
+  }
+
   char str_buf[CGNS_STRING_SIZE], fname[100];
   val_filename += ".dat";
   strcpy(fname, val_filename.c_str());
@@ -2901,6 +3258,16 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   Restart_Vars = new int[nRestart_Vars];
   fields.clear();
 
+  if (config->GetRead_Restart_MMap()) {
+    Read_SU2_Restart_Binary_MMap(geometry, config, val_filename);
+
+    if (static_cast<unsigned long>(Restart_Vars[2]) != geometry->GetGlobal_nPointDomain() &&
+        config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+      InterpolateRestartData(geometry, config);
+    }
+    return;
+  }
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -3051,17 +3418,18 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+  /*--- Each rank reads a contiguous block of the file (its linear partition), and the points are then sent
+   to the ranks that own them. Except for SU2_SOL with a different number of points, where each rank reads
+   the indices it needs with a derived datatype for this rank's set of non-contiguous data. ---*/
+
+  const bool sameMesh = (nPointFile == geometry->GetGlobal_nPointDomain());
+  const auto partitioner = CLinearPartitioner(nPointFile,0);
 
   int nBlock;
   int *blocklen = nullptr;
   MPI_Aint *displace = nullptr;
 
-  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
-      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
-    /*--- No interpolation, each rank reads the indices it needs. ---*/
+  if (!sameMesh && config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
     nBlock = geometry->GetnPointDomain();
 
     blocklen = new int[nBlock];
@@ -3076,16 +3444,13 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     }
   }
   else {
-    /*--- Interpolation required, read large blocks of data. ---*/
     nBlock = 1;
 
     blocklen = new int[nBlock];
     displace = new MPI_Aint[nBlock];
 
-    const auto partitioner = CLinearPartitioner(nPointFile,0);
-
     blocklen[0] = nFields*partitioner.GetSizeOnRank(rank);
-    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);;
+    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);
   }
 
   MPI_Type_create_hindexed(nBlock, blocklen, displace, MPI_DOUBLE, &filetype);
@@ -3116,189 +3481,202 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   delete [] blocklen;
   delete [] displace;
 
-#endif
+  if (sameMesh) {
 
-  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
-      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
-    InterpolateRestartData(geometry, config);
-  }
-}
+    /*--- Request the local points (sorted by global index) from the ranks that read them. Since the
+     partition is linear, the replies arrive in the order of the global indices, as expected by the
+     loaders of the restart data. ---*/
 
-void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
+    const auto request = RestartHelpers::GetSortedGlobalDomainPoints(geometry);
 
-  if (geometry->GetGlobal_nPointDomain() == 0) return;
+    vector<int> nRequest(size, 0), nReply(size), requestDisp(size, 0), replyDisp(size, 0);
+    for (const auto iPoint_Global : request) nRequest[partitioner.GetRankContainingIndex(iPoint_Global)]++;
 
-  if (size != SINGLE_NODE && size % 2)
-    SU2_MPI::Error("Number of ranks must be multiple of 2.", CURRENT_FUNCTION);
+    SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nReply.data(), 1, MPI_INT, SU2_MPI::GetComm());
 
-  if (config->GetFEMSolver())
-    SU2_MPI::Error("Cannot interpolate the restart file for FEM problems.", CURRENT_FUNCTION);
+    for (int iRank = 1; iRank < size; ++iRank) {
+      requestDisp[iRank] = requestDisp[iRank-1] + nRequest[iRank-1];
+      replyDisp[iRank] = replyDisp[iRank-1] + nReply[iRank-1];
+    }
+    vector<unsigned long> replyIdx(replyDisp[size-1] + nReply[size-1]);
 
-  /* Challenges:
-   *  - Do not use too much memory by gathering the restart data in all ranks.
-   *  - Do not repeat too many computations in all ranks.
-   * Solution?:
-   *  - Build a local ADT for the domain points (not the restart points).
-   *  - Find the closest target point for each donor, which does not match all targets.
-   *  - "Diffuse" the data to neighbor points.
-   *  Complexity is approx. Nlt + (Nlt + Nd) log(Nlt) where Nlt is the LOCAL number
-   *  of target points and Nd the TOTAL number of donors. */
+    SU2_MPI::Alltoallv(request.data(), nRequest.data(), requestDisp.data(), MPI_UNSIGNED_LONG,
+                       replyIdx.data(), nReply.data(), replyDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-  const unsigned long nFields = Restart_Vars[1];
-  const unsigned long nPointFile = Restart_Vars[2];
-  const auto t0 = SU2_MPI::Wtime();
-  auto nRecurse = 0;
+    vector<passivedouble> replyData(replyIdx.size()*nFields);
+    const auto firstIndex = partitioner.GetFirstIndexOnRank(rank);
+    for (auto iReply = 0ul; iReply < replyIdx.size(); ++iReply) {
+      const auto* src = &Restart_Data[(replyIdx[iReply] - firstIndex)*nFields];
+      std::copy(src, src + nFields, &replyData[iReply*nFields]);
+    }
 
-  if (rank == MASTER_NODE) {
-    cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
-            "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n"
-            "A recursive nearest neighbor interpolation will be performed." << endl;
-  }
+    /*--- Now in terms of values. ---*/
 
-  su2activematrix localVars(nPointDomain, nFields);
-  localVars = su2double(0.0);
-  {
-  su2vector<uint8_t> isMapped(nPoint);
-  isMapped = false;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      nRequest[iRank] *= nFields; requestDisp[iRank] *= nFields;
+      nReply[iRank] *= nFields; replyDisp[iRank] *= nFields;
+    }
+    delete [] Restart_Data;
+    Restart_Data = new passivedouble[request.size()*nFields];
 
-  /*--- ADT of local target points. ---*/
-  {
-  const auto& coord = geometry->nodes->GetCoord();
-  vector<unsigned long> index(nPointDomain);
-  iota(index.begin(), index.end(), 0ul);
+    CBaseMPIWrapper::Alltoallv(replyData.data(), nReply.data(), replyDisp.data(), MPI_DOUBLE,
+                               Restart_Data, nRequest.data(), requestDisp.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  }
 
-  CADTPointsOnlyClass adt(nDim, nPointDomain, coord.data(), index.data(), false);
-  vector<unsigned long>().swap(index);
+#endif
 
-  /*--- Copy local donor restart data, which will circulate over all ranks. ---*/
+  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
+      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+    InterpolateRestartData(geometry, config);
+  }
+}
 
-  const auto partitioner = CLinearPartitioner(nPointFile,0);
+void CSolver::Read_SU2_Restart_Binary_MMap(CGeometry *geometry, const CConfig *config, const string& val_filename) {
 
-  unsigned long nPointDonorMax = 0;
-  for (int i=0; i<size; ++i)
-    nPointDonorMax = max(nPointDonorMax, partitioner.GetSizeOnRank(i));
+#if defined(__unix__) || defined(__APPLE__)
 
-  su2activematrix sendBuf(nPointDonorMax, nFields);
+  /*--- Each rank maps the file and copies its points, the pages that are not touched are never read. ---*/
 
-  for (auto iPoint = 0ul; iPoint < nPointDonorMax; ++iPoint) {
-    const auto iPointDonor = min(iPoint,partitioner.GetSizeOnRank(rank)-1ul);
-    for (auto iVar = 0ul; iVar < nFields; ++iVar)
-      sendBuf(iPoint,iVar) = Restart_Data[iPointDonor*nFields+iVar];
-  }
+  const int fd = open(val_filename.c_str(), O_RDONLY);
+  if (fd < 0) SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
 
-  delete [] Restart_Data;
-  Restart_Data = nullptr;
+  struct stat fileStat;
+  const auto fileSize = (fstat(fd, &fileStat) == 0) ? static_cast<size_t>(fileStat.st_size) : 0ul;
 
-  /*--- Make room to receive donor data from other ranks, and to map it to target points. ---*/
+  void* map = (fileSize > 0) ? mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  close(fd);
+  if (map == MAP_FAILED) SU2_MPI::Error(string("Unable to map SU2 restart file ") + val_filename, CURRENT_FUNCTION);
 
-  su2activematrix donorVars(nPointDonorMax, nFields);
-  vector<su2double> donorDist(nPointDomain, 1e12);
+  const auto* bytes = static_cast<const char*>(map);
 
-  /*--- Circle over all ranks. ---*/
+  /*--- Same checks as for the other binary readers. ---*/
 
-  const int dst = (rank+1) % size; // send to next
-  const int src = (rank-1+size) % size; // receive from prev.
-  const int count = sendBuf.size();
+  const int nRestart_Vars = 5;
+  if (fileSize >= nRestart_Vars*sizeof(int)) memcpy(Restart_Vars, bytes, nRestart_Vars*sizeof(int));
 
-  for (int iStep = 0; iStep < size; ++iStep) {
+  if (fileSize < nRestart_Vars*sizeof(int) || Restart_Vars[0] != 535532) {
+    SU2_MPI::Error(string("File ") + val_filename + string(" is not a binary SU2 restart file.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the READ_BINARY_RESTART option."), CURRENT_FUNCTION);
+  }
 
-    swap(sendBuf, donorVars);
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const size_t headerSize = nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE;
 
-    if (iStep) {
-      /*--- Odd ranks send and then receive, and vice versa. ---*/
-      if (rank%2) SU2_MPI::Send(sendBuf.data(), count, MPI_DOUBLE, dst, 0, SU2_MPI::GetComm());
-      else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+  if (fileSize < headerSize + nPointFile*nFields*sizeof(passivedouble)) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
 
-      if (rank%2==0) SU2_MPI::Send(sendBuf.data(), count, MPI_DOUBLE, dst, 0, SU2_MPI::GetComm());
-      else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-    }
+  fields.emplace_back("Point_ID");
+  for (auto iVar = 0ul; iVar < nFields; iVar++) {
+    char str_buf[CGNS_STRING_SIZE];
+    memcpy(str_buf, &bytes[nRestart_Vars*sizeof(int) + iVar*CGNS_STRING_SIZE], CGNS_STRING_SIZE);
+    str_buf[CGNS_STRING_SIZE-1] = '\0';
+#ifdef HAVE_MPI
+    fields.emplace_back(string("\"") + str_buf + "\"");
+#else
+    fields.emplace_back(str_buf);
+#endif
+  }
 
-    /*--- Find the closest target for each donor. ---*/
+  /*--- The same layout of the data as the MPI reader, local points or a linear partition for interpolation. ---*/
 
-    vector<su2double> targetDist(donorVars.rows());
-    vector<unsigned long> iTarget(donorVars.rows());
+  const auto* data = reinterpret_cast<const passivedouble*>(bytes + headerSize);
 
-    SU2_OMP_PARALLEL_(for schedule(dynamic,4*OMP_MIN_SIZE))
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
-      int r=0;
-      adt.DetermineNearestNode(donorVars[iDonor], targetDist[iDonor], iTarget[iDonor], r);
+  if (nPointFile == geometry->GetGlobal_nPointDomain() || config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
+    const auto points = RestartHelpers::GetSortedGlobalDomainPoints(geometry);
+    Restart_Data = new passivedouble[points.size()*nFields];
+    for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) {
+      memcpy(&Restart_Data[iPoint*nFields], &data[points[iPoint]*nFields], nFields*sizeof(passivedouble));
     }
-    END_SU2_OMP_PARALLEL
+  } else {
+    const auto partitioner = CLinearPartitioner(nPointFile,0);
+    const auto nPointRank = partitioner.GetSizeOnRank(rank);
+    Restart_Data = new passivedouble[nPointRank*nFields];
+    memcpy(Restart_Data, &data[partitioner.GetFirstIndexOnRank(rank)*nFields], nPointRank*nFields*sizeof(passivedouble));
+  }
 
-    /*--- Keep the closest donor for each target (this is separate for OpenMP). ---*/
+  munmap(map, fileSize);
 
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
-      const auto iPoint = iTarget[iDonor];
-      const auto dist = targetDist[iDonor];
+#else
+  SU2_MPI::Error("Memory-mapped restart files (READ_RESTART_MMAP= YES) are not available on this platform.",
+                 CURRENT_FUNCTION);
+#endif
+}
 
-      if (dist < donorDist[iPoint]) {
-        donorDist[iPoint] = dist;
-        isMapped[iPoint] = true;
-        for (auto iVar = 0ul; iVar < donorVars.cols(); ++iVar)
-          localVars(iPoint,iVar) = donorVars(iDonor,iVar);
-      }
-    }
-  }
-  } // everything goes out of scope except "localVars" and "isMapped"
+void CSolver::Read_SU2_Restart_TimeSeries(CGeometry *geometry, const CConfig *config, const string& val_filename) {
 
-  /*--- Recursively diffuse the nearest neighbor data. ---*/
+  string series;
+  unsigned long step = 0;
+  if (!CSU2TimeSeriesFileWriter::SplitStepName(val_filename, series, step)) {
+    SU2_MPI::Error("The restart " + val_filename + " has no time iteration, it cannot be read from a time series.",
+                   CURRENT_FUNCTION);
+  }
+  const string fname = series + CSU2TimeSeriesFileWriter::fileExt;
 
-  auto nDonor = isMapped;
-  bool done = false;
+  vector<string> fieldNames;
+  unsigned long nPointFile = 0;
+  CSU2TimeSeriesFileWriter::ReadHeader(fname, nPointFile, fieldNames);
 
-  SU2_OMP_PARALLEL
-  while (!done) {
-    SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain,2*omp_get_num_threads()))
-    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
-      /*--- Do not change points that are already interpolated. ---*/
-      if (isMapped[iPoint]) continue;
+  if (nPointFile != geometry->GetGlobal_nPointDomain() && config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+    SU2_MPI::Error("The restarts of a time series cannot be interpolated to a different mesh.", CURRENT_FUNCTION);
+  }
 
-      /*--- Boundaries to boundaries and domain to domain. ---*/
-      const bool boundary_i = geometry->nodes->GetSolidBoundary(iPoint);
+  /*--- Same layout of the data as for binary restarts, the local points in the order of their global index. ---*/
 
-      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-        if (!isMapped[jPoint]) continue;
-        if (boundary_i != geometry->nodes->GetSolidBoundary(jPoint)) continue;
+  const auto points = RestartHelpers::GetSortedGlobalDomainPoints(geometry);
 
-        nDonor[iPoint]++;
+  unsigned long nFields = 0;
+  vector<passivedouble> data;
+  CSU2TimeSeriesFileWriter::ReadStep(fname, step, points, nFields, data);
 
-        for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
-          localVars(iPoint,iVar) += localVars(jPoint,iVar);
-      }
+  Restart_Vars = new int[5]{535532, int(nFields), int(nPointFile), 0, 0};
+  Restart_Data = new passivedouble[data.size()];
+  std::copy(data.begin(), data.end(), Restart_Data);
 
-      if (nDonor[iPoint] > 0) {
-        for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
-          localVars(iPoint,iVar) /= nDonor[iPoint];
-        nDonor[iPoint] = true;
-      }
-    }
-    END_SU2_OMP_FOR
+  fields.clear();
+  fields.emplace_back("Point_ID");
+  for (const auto& name : fieldNames) {
+#ifdef HAVE_MPI
+    fields.emplace_back("\"" + name + "\"");
+#else
+    fields.emplace_back(name);
+#endif
+  }
+}
 
-    /*--- Repeat while all points are not mapped. ---*/
+void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
-    SU2_OMP_MASTER {
-      done = true;
-      ++nRecurse;
-    }
-    END_SU2_OMP_MASTER
+  if (geometry->GetGlobal_nPointDomain() == 0) return;
 
-    bool myDone = true;
+  if (config->GetFEMSolver())
+    SU2_MPI::Error("Cannot interpolate the restart file for FEM problems.", CURRENT_FUNCTION);
 
-    SU2_OMP_FOR_STAT(16*OMP_MIN_SIZE)
-    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
-      isMapped[iPoint] = nDonor[iPoint];
-      myDone &= nDonor[iPoint];
-    }
-    END_SU2_OMP_FOR
+  /*--- The restart points stay distributed as they were read (linear partitions), they are sent only to the
+   * ranks whose domain points may be closest to them, see CDistributedNearestNeighbor. Memory and work are
+   * therefore proportional to the local number of points, and any number of ranks can be used. ---*/
 
-    SU2_OMP_ATOMIC
-    done &= myDone;
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const auto t0 = SU2_MPI::Wtime();
 
-    SU2_OMP_BARRIER
+  if (rank == MASTER_NODE) {
+    cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
+            "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n"
+            "A nearest neighbor interpolation will be performed." << endl;
   }
-  END_SU2_OMP_PARALLEL
 
-  } // everything goes out of scope except "localVars"
+  const auto partitioner = CLinearPartitioner(nPointFile,0);
+
+  su2passivematrix localVars;
+  vector<passivedouble> dist;
+  {
+    const CDistributedNearestNeighbor search(nDim, nPointDomain, geometry->nodes->GetCoord().data());
+    search.Search(partitioner.GetSizeOnRank(rank), nFields, Restart_Data, localVars, dist);
+  }
+  delete [] Restart_Data;
 
   /*--- Move to Restart_Data in ascending order of global index, which is how a matching restart would have been read. ---*/
 
@@ -3310,13 +3688,18 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
     const auto iPoint = geometry->GetGlobal_to_Local_Point(iPoint_Global);
     if (iPoint >= 0) {
       for (auto iVar = 0ul; iVar < nFields; ++iVar)
-        Restart_Data[counter*nFields+iVar] = SU2_TYPE::GetValue(localVars(iPoint,iVar));
+        Restart_Data[counter*nFields+iVar] = localVars(iPoint,iVar);
       counter++;
     }
   }
 
+  passivedouble maxDist = 0.0, globalMaxDist = 0.0;
+  for (const auto d : dist) maxDist = max(maxDist, d);
+  SelectMPIWrapper<passivedouble>::W::Allreduce(&maxDist, &globalMaxDist, 1, MPI_DOUBLE, MPI_MAX,
+                                                 SU2_MPI::GetComm());
+
   if (rank == MASTER_NODE) {
-    cout << "Number of recursions: " << nRecurse << ".\n"
+    cout << "Maximum distance to the nearest restart point: " << globalMaxDist << ".\n"
             "Elapsed time: " << SU2_MPI::Wtime()-t0 << "s.\n" << endl;
   }
 }
@@ -3677,9 +4060,13 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
   }
 
 
-  /*--- Read the profile data from an ASCII file. ---*/
+  /*--- Read the profile data from an ASCII file. Without spanwise interpolation the profiles are matched to the
+   vertices with a distributed nearest neighbor search, so each rank only needs to store part of the rows. ---*/
+
+  const bool distributed = config->GetKindInletInterpolationFunction() == INLET_SPANWISE_INTERP::NONE;
 
-  CMarkerProfileReaderFVM profileReader(geometry[MESH_0], config, profile_filename, KIND_MARKER, nCol_InletFile, columnNames,columnValues);
+  CMarkerProfileReaderFVM profileReader(geometry[MESH_0], config, profile_filename, KIND_MARKER, nCol_InletFile,
+                                        columnNames, columnValues, distributed);
 
   /*--- Load data from the restart into correct containers. ---*/
 
@@ -3786,6 +4173,24 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
         cout<<"No Inlet Interpolation being used"<<endl;
       }
 
+      /*--- Find the closest point in our inlet profile data for each vertex (this is collective). ---*/
+
+      su2passivematrix Nearest_Data;
+      vector<passivedouble> Nearest_Dist;
+
+      if (!Interpolate) {
+        const auto nVertex = geometry[MESH_0]->nVertex[iMarker];
+        vector<su2double> Vertex_Coord(nVertex*nDim);
+
+        for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+          const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            Vertex_Coord[iVertex*nDim+iDim] = geometry[MESH_0]->nodes->GetCoord(iPoint, iDim);
+        }
+        const CDistributedNearestNeighbor search(nDim, nVertex, Vertex_Coord.data());
+        search.Search(nRows, nColumns, Inlet_Data.data(), Nearest_Data, Nearest_Dist);
+      }
+
       /*--- Loop through the nodes on this marker. ---*/
 
       for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
@@ -3795,27 +4200,10 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
         if (!Interpolate) {
 
-          su2double min_dist = 1e16;
-
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
-
-          for (auto iRow = 0ul; iRow < nRows; iRow++) {
+          const su2double min_dist = Nearest_Dist[iVertex];
 
-            /*--- Get the coords for this data point. ---*/
-
-            const auto index = iRow*nColumns;
-
-            const auto dist = GeometryToolbox::Distance(nDim, Coord, &Inlet_Data[index]);
-
-            /*--- Check is this is the closest point and store data if so. ---*/
-
-            if (dist < min_dist) {
-              min_dist = dist;
-              for (auto iVar = 0ul; iVar < nColumns; iVar++)
-                Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
-
-          }
+          for (auto iVar = 0ul; iVar < nColumns; iVar++)
+            Inlet_Values[iVar] = Nearest_Data(iVertex, iVar);
 
           /*--- If the diff is less than the tolerance, match the two.
           We could modify this to simply use the nearest neighbor, or
@@ -3895,7 +4283,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
     } // end jMarker loop
 
-    if (local_failure > 0) break;
+    /*--- Do not stop at the first failure, the nearest neighbor search of the next markers is collective. ---*/
 
   } // end iMarker loop
 
@@ -4171,6 +4559,39 @@ void CSolver::ComputeResidual_Multizone(const CGeometry *geometry, const CConfig
   END_SU2_OMP_PARALLEL
 }
 
+void CSolver::Read_SU2_Restart_Fields(CGeometry *geometry, const CConfig *config, const string& filename,
+                                      vector<string>& names, su2passivematrix& data) {
+
+  /*--- Read the file as a binary restart, without replacing the fields of the solution. ---*/
+
+  auto solutionFields = std::move(fields);
+  Read_SU2_Restart_Binary(geometry, config, filename);
+  names.assign(fields.begin() + 1, fields.end());
+  fields = std::move(solutionFields);
+
+  const unsigned long nFields = Restart_Vars[1];
+  data.resize(nPointDomain, nFields) = 0.0;
+
+  unsigned long iPoint_Global_Local = 0;
+
+  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+    const auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    if (iPoint_Local > -1) {
+      for (auto iField = 0ul; iField < nFields; iField++) {
+        data(iPoint_Local, iField) = Restart_Data[iPoint_Global_Local*nFields + iField];
+      }
+      iPoint_Global_Local++;
+    }
+  }
+
+  delete [] Restart_Vars;  Restart_Vars = nullptr;
+  delete [] Restart_Data;  Restart_Data = nullptr;
+
+  if (iPoint_Global_Local != nPointDomain) {
+    SU2_MPI::Error(string("The file ") + filename + string(" doesn't match with the mesh file!"), CURRENT_FUNCTION);
+  }
+}
+
 void CSolver::BasicLoadRestart(CGeometry *geometry, const CConfig *config, const string& filename, unsigned long skipVars) {
 
   /*--- Read and store the restart metadata. ---*/
@@ -4314,3 +4735,108 @@ void CSolver::SavelibROM(CGeometry *geometry, CConfig *config, bool converged) {
 #endif
 
 }
+
+void CSolver::ReadlibROMBasis(CGeometry *geometry, const CConfig *config) {
+
+#if defined(HAVE_LIBROM) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+  CAROM::BasisReader reader(config->GetlibROMbase_FileName());
+  std::unique_ptr<const CAROM::Matrix> basis(reader.getSpatialBasis(0.0));
+
+  /*--- The rows of the basis are distributed like the solution when it was saved. ---*/
+  int dim = int(nPointDomain * nVar);
+  int nBasisLocal = (basis->numRows() == dim) ? basis->numColumns() : -1, nBasis = 0;
+  SU2_MPI::Allreduce(&nBasisLocal, &nBasis, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (nBasis <= 0) {
+    SU2_MPI::Error(string("The libROM basis ") + config->GetlibROMbase_FileName() +
+                   string(" does not match the mesh partitioning, use the same number of ranks that saved it."),
+                   CURRENT_FUNCTION);
+  }
+
+  PODBasis.resize(nBasis);
+  PODBasisJac.resize(nBasis);
+
+  for (int iBasis = 0; iBasis < nBasis; ++iBasis) {
+    PODBasis[iBasis].Initialize(nPoint, nPointDomain, nVar, 0.0);
+    PODBasisJac[iBasis].Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+    for (int i = 0; i < dim; ++i) PODBasis[iBasis][i] = basis->item(i, iBasis);
+
+    /*--- The halo values are needed by the products with the Jacobian. ---*/
+    CSysMatrixComms::Initiate(PODBasis[iBasis], geometry, config);
+    CSysMatrixComms::Complete(PODBasis[iBasis], geometry, config);
+  }
+
+  if (rank == MASTER_NODE) cout << "Read libROM basis of dimension " << nBasis << "." << endl;
+#else
+  SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
+#endif
+
+}
+
+void CSolver::SolveReducedSystem(CGeometry *geometry, const CConfig *config) {
+
+#if defined(HAVE_LIBROM) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+  const auto nBasis = PODBasis.size();
+  const auto nElmDomain = nPointDomain * nVar;
+
+  for (auto iBasis = 0ul; iBasis < nBasis; ++iBasis) {
+    Jacobian.MatrixVectorProduct(PODBasis[iBasis], PODBasisJac[iBasis], geometry, config);
+  }
+
+  /*--- Thread and rank local sums of the normal matrix (lower triangle, row by row), of the projected
+   * residual, and of the squared norm of the residual, followed by a single global reduction. ---*/
+
+  const auto nMat = nBasis * (nBasis + 1) / 2;
+  vector<su2double> sums(nMat + nBasis + 1, 0.0);
+
+  SU2_OMP_FOR_(schedule(static, OMP_MIN_SIZE) SU2_NOWAIT)
+  for (auto i = 0ul; i < nElmDomain; ++i) {
+    const su2double res = LinSysRes[i];
+    auto* mat = sums.data();
+    for (auto iBasis = 0ul; iBasis < nBasis; ++iBasis) {
+      const su2double jv = PODBasisJac[iBasis][i];
+      for (auto jBasis = 0ul; jBasis <= iBasis; ++jBasis) *(mat++) += jv * PODBasisJac[jBasis][i];
+      sums[nMat + iBasis] += jv * res;
+    }
+    sums[nMat + nBasis] += res * res;
+  }
+  END_SU2_OMP_FOR
+
+  CSysVector<su2double>::reduceSums(sums.size(), sums.data());
+
+  /*--- The reduced system is small, all threads solve it instead of sharing the result. ---*/
+
+  CSymmetricMatrix normalMat;
+  normalMat.Initialize(nBasis);
+  for (auto iBasis = 0ul, k = 0ul; iBasis < nBasis; ++iBasis)
+    for (auto jBasis = 0ul; jBasis <= iBasis; ++jBasis) normalMat.Set(iBasis, jBasis, sums[k++]);
+  normalMat.Invert(true);
+
+  vector<su2double> coeff(nBasis);
+  normalMat.MatVecMult(sums.begin() + nMat, coeff.begin());
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nPoint * nVar; ++i) {
+    su2double sol = 0.0;
+    for (auto iBasis = 0ul; iBasis < nBasis; ++iBasis) sol += coeff[iBasis] * PODBasis[iBasis][i];
+    LinSysSol[i] = sol;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Relative residual of the projection, |r - JVq|^2 = |r|^2 - q.(JV)^T r, reported as that of the linear solver. ---*/
+
+  const su2double resNorm2 = sums[nMat + nBasis];
+  su2double projected = 0.0;
+  for (auto iBasis = 0ul; iBasis < nBasis; ++iBasis) projected += coeff[iBasis] * sums[nMat + iBasis];
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SetIterLinSolver(nBasis);
+    SetResLinSolver(resNorm2 > 0.0 ? sqrt(fmax(resNorm2 - projected, 0.0) / resNorm2) : 0.0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#else
+  SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
+#endif
+
+}
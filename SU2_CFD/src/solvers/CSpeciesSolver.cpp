@@ -131,7 +131,8 @@ if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (species transport model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::SPECIES, ReducerStrategy,
+                       config->GetSpecies_Segregated_Solve());
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
@@ -354,9 +355,13 @@ void CSpeciesSolver::BC_Inlet(CGeometry* geometry, CSolver** solver_container, C
       LinSysRes.SetBlock_Zero(iPoint);
 
       /*--- Includes 1 in the diagonal ---*/
-      for (auto iVar = 0u; iVar < nVar; iVar++) {
-        auto total_index = iPoint * nVar + iVar;
-        Jacobian.DeleteValsRowi(total_index);
+      if (segregatedSystem) {
+        Jacobian.DeleteValsRowi(iPoint);
+      } else {
+        for (auto iVar = 0u; iVar < nVar; iVar++) {
+          auto total_index = iPoint * nVar + iVar;
+          Jacobian.DeleteValsRowi(total_index);
+        }
       }
     } else {  // weak BC
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
@@ -512,9 +517,13 @@ void CSpeciesSolver::BC_Outlet(CGeometry* geometry, CSolver** solver_container,
       LinSysRes.SetBlock_Zero(iPoint);
 
       /*--- Includes 1 on the diagonal ---*/
-      for (auto iVar = 0u; iVar < nVar; iVar++) {
-        auto total_index = iPoint * nVar + iVar;
-        Jacobian.DeleteValsRowi(total_index);
+      if (segregatedSystem) {
+        Jacobian.DeleteValsRowi(iPoint);
+      } else {
+        for (auto iVar = 0u; iVar < nVar; iVar++) {
+          auto total_index = iPoint * nVar + iVar;
+          Jacobian.DeleteValsRowi(total_index);
+        }
       }
     } else {  // weak BC
 
@@ -28,6 +28,7 @@
 #include "../../include/solvers/CTurbSASolver.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -68,7 +69,7 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SA model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::TURBULENCE, ReducerStrategy);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
@@ -291,6 +292,15 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
   AD::EndNoSharedReading();
 }
 
+void CTurbSASolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    edgeNumerics = CNumericsSIMD::CreateTurbNumerics(*config, nDim, solver_container[FLOW_SOL]->GetNodes());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CTurbSASolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                      CNumerics* numerics, CConfig* config) {
 
@@ -311,8 +321,11 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool harmonic_balance = (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
   const bool transition_BC = config->GetSAParsedOptions().bc;
+  const bool transition = (config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE);
+  const bool hybrid_RANS_LES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
+  const auto* transNodes = transition ? solver_container[TRANS_SOL]->GetNodes() : nullptr;
 
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
@@ -349,7 +362,7 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
 
-    if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
+    if (!hybrid_RANS_LES) {
 
     /*--- For the SA model, wall roughness is accounted by modifying the computed wall distance
        *                              d_new = d + 0.03 k_s
@@ -378,9 +391,9 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Effective Intermittency ---*/
 
-    if (config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) {
-      numerics->SetIntermittencyEff(solver_container[TRANS_SOL]->GetNodes()->GetIntermittencyEff(iPoint));
-      numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetSolution(iPoint, 0));
+    if (transition) {
+      numerics->SetIntermittencyEff(transNodes->GetIntermittencyEff(iPoint));
+      numerics->SetIntermittency(transNodes->GetSolution(iPoint, 0));
     }
 
     /*--- Compute the source term ---*/
@@ -389,7 +402,7 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Store the intermittency ---*/
 
-    if (transition_BC || config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) {
+    if (transition_BC || transition) {
       nodes->SetIntermittency(iPoint,numerics->GetIntermittencyEff());
     }
 
@@ -1333,54 +1346,89 @@ void CTurbSASolver::SetTurbVars_WF(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
+void CTurbSASolver::SetDES_Geometry(const CGeometry *geometry, const CConfig *config) {
+
+  const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    DES_NeighborPtr.resize(nPointDomain+1);
+    DES_NeighborPtr[0] = 0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      DES_NeighborPtr[iPoint+1] = DES_NeighborPtr[iPoint] + geometry->nodes->GetnPoint(iPoint);
+
+    if (kindHybridRANSLES == SA_EDDES) DES_NeighborDelta.resize(DES_NeighborPtr[nPointDomain], MAXNDIM) = su2double(0.0);
+    if (kindHybridRANSLES == SA_ZDES) DES_MaxDelta.resize(nPointDomain, MAXNDIM) = su2double(0.0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  if (kindHybridRANSLES != SA_EDDES && kindHybridRANSLES != SA_ZDES) return;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto coord_i = geometry->nodes->GetCoord(iPoint);
+    su2double maxDelta[MAXNDIM] = {0.0};
+    auto iNeigh = DES_NeighborPtr[iPoint];
+
+    for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      const auto coord_j = geometry->nodes->GetCoord(jPoint);
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const su2double delta = fabs(coord_j[iDim] - coord_i[iDim]);
+        maxDelta[iDim] = max(maxDelta[iDim], delta);
+        if (kindHybridRANSLES == SA_EDDES) DES_NeighborDelta(iNeigh, iDim) = delta;
+      }
+      ++iNeigh;
+    }
+    if (kindHybridRANSLES == SA_ZDES) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) DES_MaxDelta(iPoint, iDim) = maxDelta[iDim];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config){
 
   const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
 
+  /*--- The geometric quantities only need to be updated when the mesh moves, or in
+   the discrete adjoint where they need to be part of the recording. ---*/
+
+  if (DES_NeighborPtr.empty() || config->GetDynamic_Grid() || config->GetDiscrete_Adjoint()) {
+    SetDES_Geometry(geometry, config);
+  }
+
   const su2double constDES = config->GetConst_DES();
 
-  const su2double fw_star = 0.424, cv1_3 = pow(7.1, 3), k2 = pow(0.41, 2);
-  const su2double cb1   = 0.1355, ct3 = 1.2, ct4 = 0.5;
-  const su2double sigma = 2./3., cb2 = 0.622, f_max = 1.0, f_min = 0.1, a1 = 0.15, a2 = 0.3;
+  const su2double k2 = pow(0.41, 2);
+  const su2double f_max = 1.0, f_min = 0.1, a1 = 0.15, a2 = 0.3;
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver[FLOW_SOL]->GetNodes());
 
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++){
 
-    const auto coord_i       = geometry->nodes->GetCoord(iPoint);
-    const auto nNeigh        = geometry->nodes->GetnPoint(iPoint);
-    const auto wallDistance  = geometry->nodes->GetWall_Distance(iPoint);
-    const auto velocityGrad  = flowNodes->GetVelocityGradient(iPoint);
-    const auto vorticity     = flowNodes->GetVorticity(iPoint);
-    const auto density       = flowNodes->GetDensity(iPoint);
-    const auto laminarViscosity = flowNodes->GetLaminarViscosity(iPoint);
-    const auto eddyViscosity    = nodes->GetmuT(iPoint);
-    const su2double kinematicViscosity     = laminarViscosity/density;
-    const su2double kinematicViscosityTurb = eddyViscosity/density;
-
-    su2double uijuij = 0.0;
-    for(auto iDim = 0u; iDim < nDim; iDim++){
-      for(auto jDim = 0u; jDim < nDim; jDim++){
-        uijuij += pow(velocityGrad[iDim][jDim], 2);
-      }
-    }
-    uijuij = sqrt(fabs(uijuij));
-    uijuij = max(uijuij,1e-10);
+    const auto wallDistance = geometry->nodes->GetWall_Distance(iPoint);
+    const auto vorticity    = flowNodes->GetVorticity(iPoint);
 
-    /*--- Low Reynolds number correction term ---*/
+    /*--- Shielding function of DDES and its variants. ---*/
 
-    const su2double nu_hat = nodes->GetSolution(iPoint,0);
-    const su2double Ji   = nu_hat/kinematicViscosity;
-    const su2double Ji_2 = Ji * Ji;
-    const su2double Ji_3 = Ji*Ji*Ji;
-    const su2double fv1  = Ji_3/(Ji_3+cv1_3);
-    const su2double fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    const su2double ft2 = ct3*exp(-ct4*Ji_2);
-    const su2double cw1 = cb1/k2+(1.0+cb2)/sigma;
+    auto shieldingFunction = [&]() {
+      const auto velocityGrad = flowNodes->GetVelocityGradient(iPoint);
+      const auto density = flowNodes->GetDensity(iPoint);
+      const su2double kinematicViscosity = flowNodes->GetLaminarViscosity(iPoint)/density;
+      const su2double kinematicViscosityTurb = nodes->GetmuT(iPoint)/density;
 
-    su2double psi_2 = (1.0 - (cb1/(cw1*k2*fw_star))*(ft2 + (1.0 - ft2)*fv2))/(fv1 * max(1.0e-10,1.0-ft2));
-    psi_2 = min(100.0,psi_2);
+      su2double uijuij = 0.0;
+      for(auto iDim = 0u; iDim < nDim; iDim++){
+        for(auto jDim = 0u; jDim < nDim; jDim++){
+          uijuij += pow(velocityGrad[iDim][jDim], 2);
+        }
+      }
+      uijuij = sqrt(fabs(uijuij));
+      uijuij = max(uijuij,1e-10);
+
+      const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
+      return 1.0-tanh(pow(8.0*r_d,3.0));
+    };
 
     su2double lengthScale = 0.0;
 
@@ -1405,8 +1453,7 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
 
         const su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
 
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+        const su2double f_d = shieldingFunction();
 
         const su2double distDES = constDES * maxDelta;
         lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
@@ -1419,33 +1466,23 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
          Theoretical and Computational Fluid Dynamics - 2012
          ---*/
 
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
-
-        su2double delta[MAXNDIM] = {}, ratioOmega[MAXNDIM] = {};
+        const su2double f_d = shieldingFunction();
 
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            const su2double deltaAux = abs(coord_j[iDim] - coord_i[iDim]);
-            delta[iDim] = max(delta[iDim], deltaAux);
-          }
-        }
+        su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
 
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
+        if (f_d >= 0.99) {
+          const su2double* delta = DES_MaxDelta[iPoint];
 
-        for (auto iDim = 0u; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
+          const su2double omega = GeometryToolbox::Norm(3, vorticity);
 
-        su2double maxDelta = sqrt(pow(ratioOmega[0], 2)*delta[1]*delta[2] +
-                                  pow(ratioOmega[1], 2)*delta[0]*delta[2] +
-                                  pow(ratioOmega[2], 2)*delta[0]*delta[1]);
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+          su2double ratioOmega[MAXNDIM] = {};
+          for (auto iDim = 0u; iDim < 3; iDim++){
+            ratioOmega[iDim] = vorticity[iDim]/omega;
+          }
 
-        if (f_d < 0.99){
-          maxDelta = deltaDDES;
+          maxDelta = sqrt(pow(ratioOmega[0], 2)*delta[1]*delta[2] +
+                          pow(ratioOmega[1], 2)*delta[0]*delta[2] +
+                          pow(ratioOmega[2], 2)*delta[0]*delta[1]);
         }
 
         const su2double distDES = constDES * maxDelta;
@@ -1459,45 +1496,39 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
          Flow Turbulence Combust - 2015
          ---*/
 
-        su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
+        const su2double f_d = shieldingFunction();
 
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
+        su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
 
-        su2double ratioOmega[MAXNDIM] = {};
+        if (f_d >= 0.999) {
+          const su2double omega = GeometryToolbox::Norm(3, vorticity);
 
-        for (auto iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
-
-        su2double ln_max = 0.0;
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          su2double delta[MAXNDIM] = {};
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);
+          su2double ratioOmega[MAXNDIM] = {};
+          for (auto iDim = 0; iDim < 3; iDim++){
+            ratioOmega[iDim] = vorticity[iDim]/omega;
           }
-          su2double ln[3];
-          ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
-          ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
-          ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
-          const su2double aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
-          ln_max = max(ln_max, aux_ln);
-          vortexTiltingMeasure += nodes->GetVortex_Tilting(jPoint);
-        }
-        vortexTiltingMeasure /= (nNeigh + 1);
 
-        const su2double f_kh = max(f_min,
-                                   min(f_max,
-                                       f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
+          su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
+          su2double ln_max = 0.0;
+          auto iNeigh = DES_NeighborPtr[iPoint];
+
+          for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+            const su2double* delta = DES_NeighborDelta[iNeigh++];
+            su2double ln[3];
+            ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
+            ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
+            ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
+            const su2double aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
+            ln_max = max(ln_max, aux_ln);
+            vortexTiltingMeasure += nodes->GetVortex_Tilting(jPoint);
+          }
+          vortexTiltingMeasure /= (geometry->nodes->GetnPoint(iPoint) + 1);
 
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+          const su2double f_kh = max(f_min,
+                                     min(f_max,
+                                         f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
 
-        su2double maxDelta = (ln_max/sqrt(3.0)) * f_kh;
-        if (f_d < 0.999){
-          maxDelta = deltaDDES;
+          maxDelta = (ln_max/sqrt(3.0)) * f_kh;
         }
 
         const su2double distDES = constDES * maxDelta;
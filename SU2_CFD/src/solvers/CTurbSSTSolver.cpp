@@ -28,6 +28,7 @@
 #include "../../include/solvers/CTurbSSTSolver.hpp"
 #include "../../include/variables/CTurbSSTVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -70,7 +71,7 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SST model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    InitializeJacobian(geometry, config, LINEAR_SYSTEM::TURBULENCE, ReducerStrategy);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
@@ -276,6 +277,15 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
   AD::EndNoSharedReading();
 }
 
+void CTurbSSTSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    edgeNumerics = CNumericsSIMD::CreateTurbNumerics(*config, nDim, solver_container[FLOW_SOL]->GetNodes(), constants);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CTurbSSTSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                      CNumerics* numerics, CConfig* config) {
 
@@ -296,8 +306,11 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
   bool axisymmetric = config->GetAxisymmetric();
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool transition = (config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE);
+  const bool transition_LM = (config->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM);
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
+  const auto* transNodes = transition_LM ? solver_container[TRANS_SOL]->GetNodes() : nullptr;
 
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
@@ -349,8 +362,8 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
     numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint));
 
     /*--- Effective Intermittency ---*/
-    if (config->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
-      numerics->SetIntermittencyEff(solver_container[TRANS_SOL]->GetNodes()->GetIntermittencyEff(iPoint));
+    if (transition_LM) {
+      numerics->SetIntermittencyEff(transNodes->GetIntermittencyEff(iPoint));
     }
 
     if (axisymmetric){
@@ -364,7 +377,7 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
     /*--- Store the intermittency ---*/
 
-    if (config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) {
+    if (transition) {
       nodes->SetIntermittency(iPoint, numerics->GetIntermittencyEff());
     }
 
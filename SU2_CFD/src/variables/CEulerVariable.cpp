@@ -62,6 +62,17 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
 
   Secondary.resize(nPoint,nSecondaryVar) = su2double(0.0);
 
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  /*--- Single precision copy of the reconstruction data, read by the vectorized edge loop
+   * (only the compressible solver has one). ---*/
+
+  if (config->GetMUSCL_Flow_Single_Prec() && config->GetMUSCL_Flow() &&
+      config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) {
+    Gradient_ReconstructionSP.resize(nPoint, nPrimVarGrad, nDim, 0.0f);
+    Limiter_PrimitiveSP.resize(nPoint, Limiter_Primitive.cols()) = 0.0f;
+  }
+#endif
+
   if (config->GetAxisymmetric()){
     nAuxVar = 3;
     Grad_AuxVar.resize(nPoint,nAuxVar,nDim,0.0);
@@ -148,3 +159,8 @@ void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidMod
    SetdPde_rho(iPoint, FluidModel->GetdPde_rho());
 
 }
+
+size_t CEulerVariable::GetMemoryUsage() const {
+  return CFlowVariable::GetMemoryUsage() + MemoryOf(Secondary, WindGust, DatasetExtrapolation, NIterNewtonsolver,
+                                                    FluidEntropy);
+}
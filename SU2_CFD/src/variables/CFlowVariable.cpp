@@ -36,10 +36,12 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
 
   /*--- Allocate residual structures for multigrid. ---*/
 
-  Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  if (config->GetnMGLevels() > 0) {
+    Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  }
 
   for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
-    if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+    if (config->GetMG_CorrecSmooth(iMesh) > 0 || config->GetResidual_Smoothing_Iter() > 0) {
       Residual_Sum.resize(nPoint, nVar);
       Residual_Old.resize(nPoint, nVar);
       break;
@@ -99,7 +101,29 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
   }
 }
 
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+void CFlowVariable::CopyReconstructionSinglePrec(unsigned long pointBegin, unsigned long pointEnd) {
+  const auto gradSize = Gradient_ReconstructionSP.rows() * Gradient_ReconstructionSP.cols();
+  parallelCopy((pointEnd - pointBegin) * gradSize, Gradient_Reconstruction.data() + pointBegin * gradSize,
+               Gradient_ReconstructionSP.data() + pointBegin * gradSize);
+
+  const auto limSize = Limiter_PrimitiveSP.cols();
+  parallelCopy((pointEnd - pointBegin) * limSize, Limiter_Primitive.data() + pointBegin * limSize,
+               Limiter_PrimitiveSP.data() + pointBegin * limSize);
+}
+#endif
+
 void CFlowVariable::SetSolution_New() {
   assert(Solution_New.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_New.data());
 }
+
+size_t CFlowVariable::GetMemoryUsage() const {
+  size_t bytes = CVariable::GetMemoryUsage() + MemoryOf(Primitive, Gradient_Primitive, Gradient_Aux, Limiter_Primitive,
+                                                        Velocity2, Solution_New, HB_Source, Vorticity, StrainMag,
+                                                        NonPhysicalEdgeCounter);
+#ifdef USE_SINGLE_PRECISION_RECONSTRUCTION
+  bytes += MemoryOf(Gradient_ReconstructionSP, Limiter_PrimitiveSP);
+#endif
+  return bytes;
+}
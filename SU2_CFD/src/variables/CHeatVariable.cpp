@@ -38,9 +38,13 @@ CHeatVariable::CHeatVariable(su2double heat, unsigned long npoint, unsigned long
   Solution = heat;
   Solution_Old = heat;
 
-  /*--- Allocate residual structures ---*/
+  AllocateLimiter(config->GetKind_SlopeLimit_Heat());
 
-  Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  /*--- Allocate residual structures (multigrid) ---*/
+
+  if (config->GetnMGLevels() > 0) {
+    Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  }
 
   /*--- Only for residual smoothing (multigrid) ---*/
 
@@ -43,6 +43,11 @@ CNSVariable::CNSVariable(su2double density, const su2double *velocity, su2double
   Vortex_Tilting.resize(nPoint) = su2double(0.0);
   Max_Lambda_Visc.resize(nPoint) = su2double(0.0);
 
+  TransportTol = config->GetTransport_Properties_Tol();
+  if (TransportTol > 0.0) {
+    TransportState.resize(nPoint,2) = su2double(0.0);
+    TransportReused.resize(nPoint) = false;
+  }
 }
 
 void CNSVariable::SetRoe_Dissipation_NTS(unsigned long iPoint,
@@ -182,9 +187,25 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   SetEnthalpy(iPoint); // Requires pressure computation.
 
+  /*--- The transport properties only depend on the thermodynamic state, they are reused if the temperature
+   *    and density changed less than the tolerance since they were last evaluated for this point. ---*/
+
+  bool reuse = false;
+  if (TransportTol > 0.0) {
+    const su2double temperature = GetTemperature(iPoint);
+    density = GetDensity(iPoint);
+    reuse = (fabs(temperature - TransportState(iPoint,0)) <= TransportTol * TransportState(iPoint,0)) &&
+            (fabs(density - TransportState(iPoint,1)) <= TransportTol * TransportState(iPoint,1));
+    TransportReused[iPoint] = reuse;
+    if (!reuse) {
+      TransportState(iPoint,0) = temperature;
+      TransportState(iPoint,1) = density;
+    }
+  }
+
   /*--- Set laminar viscosity ---*/
 
-  SetLaminarViscosity(iPoint, FluidModel->GetLaminarViscosity());
+  if (!reuse) SetLaminarViscosity(iPoint, FluidModel->GetLaminarViscosity());
 
   /*--- Set eddy viscosity ---*/
 
@@ -192,7 +213,7 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   /*--- Set thermal conductivity ---*/
 
-  SetThermalConductivity(iPoint, FluidModel->GetThermalConductivity());
+  if (!reuse) SetThermalConductivity(iPoint, FluidModel->GetThermalConductivity());
 
   /*--- Set specific heat ---*/
 
@@ -217,7 +238,10 @@ void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel)
     SetdTdrho_e( iPoint, FluidModel->GetdTdrho_e() );
     SetdTde_rho( iPoint, FluidModel->GetdTde_rho() );
 
-    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
+    /*--- Compute secondary thermo-physical properties (partial derivatives...), those of the
+     *    fluid model are not for this point if its transport properties were reused. ---*/
+
+    if (TransportTol > 0.0 && TransportReused[iPoint]) return;
 
     Setdmudrho_T( iPoint, FluidModel->Getdmudrho_T() );
     SetdmudT_rho( iPoint, FluidModel->GetdmudT_rho() );
@@ -226,3 +250,8 @@ void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel)
     SetdktdT_rho( iPoint, FluidModel->GetdktdT_rho() );
 
 }
+
+size_t CNSVariable::GetMemoryUsage() const {
+  return CEulerVariable::GetMemoryUsage() + MemoryOf(Tau_Wall, DES_LengthScale, Roe_Dissipation, Vortex_Tilting,
+                                                     TransportState, TransportReused);
+}
@@ -42,12 +42,7 @@ CScalarVariable::CScalarVariable(unsigned long npoint, unsigned long ndim, unsig
     Rmatrix.resize(nPoint, nDim, nDim, 0.0);
   }
 
-  /*--- Always allocate the slope limiter, and the auxiliary
-   variables (check the logic - JST with 2nd order Turb model) ---*/
-
-  Limiter.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Max.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+  /*--- The slope limiter is allocated by the derived classes, which know their limiter (see AllocateLimiter). ---*/
 
   Delta_Time.resize(nPoint) = su2double(0.0);
 
@@ -60,3 +55,14 @@ CScalarVariable::CScalarVariable(unsigned long npoint, unsigned long ndim, unsig
     HB_Source.resize(nPoint, nVar) = su2double(0.0);
   }
 }
+
+void CScalarVariable::AllocateLimiter(LIMITER kindLimiter) {
+  if (kindLimiter == LIMITER::NONE) return;
+  Limiter.resize(nPoint, nVar) = su2double(0.0);
+  Solution_Max.resize(nPoint, nVar) = su2double(0.0);
+  Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+}
+
+size_t CScalarVariable::GetMemoryUsage() const {
+  return CVariable::GetMemoryUsage() + MemoryOf(HB_Source, Gradient_Aux);
+}
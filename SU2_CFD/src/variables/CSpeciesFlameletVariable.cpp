@@ -44,10 +44,6 @@ CSpeciesFlameletVariable::CSpeciesFlameletVariable(const su2double* species_inf,
     Solution_time_n1 = Solution;
   }
 
-  /*--- Allocate residual structures ---*/
-
-  Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
-
   /* Allocate space for the source and scalars for visualization */
 
   source_scalar.resize(nPoint, config->GetNScalars()) = su2double(0.0);
@@ -33,6 +33,8 @@ CSpeciesVariable::CSpeciesVariable(const su2double* species_inf, unsigned long n
   /*--- Allocate space for the mass diffusivity. ---*/
   Diffusivity.resize(nPoint, nVar + 1) = su2double(0.0);
 
+  AllocateLimiter(config->GetKind_SlopeLimit_Species());
+
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
     for (unsigned long iVar = 0; iVar < nVar; iVar++)
       Solution(iPoint, iVar) = species_inf[iVar];
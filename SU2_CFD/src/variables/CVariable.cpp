@@ -52,6 +52,9 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
   nDim = ndim;
   nVar = nvar;
 
+  /*--- Zeros used as truncation error when there is no multigrid (see derived classes). ---*/
+  NoTruncError.resize(nVar) = su2double(0.0);
+
   /*--- Allocate fields common to all problems. Do not allocate fields
    that are specific to one solver, i.e. not common, in this class. ---*/
   Solution.resize(nPoint,nVar) = su2double(0.0);
@@ -78,6 +81,14 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
     Solution_BGS_k.resize(nPoint,nVar) = su2double(0.0);
 }
 
+size_t CVariable::GetMemoryUsage() const {
+  return MemoryOf(Solution, Solution_Old, External, Non_Physical, Non_Physical_Counter, UnderRelaxation, LocalCFL,
+                  Solution_time_n, Solution_time_n1, Delta_Time, Gradient, Rmatrix, Limiter, Solution_Max,
+                  Solution_Min, AuxVar, Grad_AuxVar, Max_Lambda_Inv, Max_Lambda_Visc, Lambda, Sensor,
+                  Undivided_Laplacian, Res_TruncError, Residual_Old, Residual_Sum, Solution_BGS_k, AD_InputIndex,
+                  AD_OutputIndex, SolutionExtra, ExternalExtra, SolutionExtra_BGS_k);
+}
+
 void CVariable::Set_OldSolution() {
   assert(Solution_Old.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_Old.data());
@@ -98,6 +109,12 @@ void CVariable::Set_Solution_time_n1() {
   parallelCopy(Solution_time_n.size(), Solution_time_n.data(), Solution_time_n1.data());
 }
 
+void CVariable::Shift_Solution_time_n() {
+  assert(Solution_time_n1.size() == Solution_time_n.size());
+  SU2_OMP_SAFE_GLOBAL_ACCESS(std::swap(Solution_time_n, Solution_time_n1);)
+  Set_Solution_time_n();
+}
+
 void CVariable::Set_BGSSolution_k() {
   assert(Solution_BGS_k.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_BGS_k.data());
@@ -33,6 +33,7 @@ import os, copy
 from .. import io as su2io
 from . import func as su2func
 from . import grad as su2grad
+from . import concurrent_gradients
 from ..io import redirect_folder, save_data
 
 # todo:
@@ -362,6 +363,7 @@ def obj_df(dvs, config, state=None):
                 scale[i_obj] *= obj_dp(config, state, this_obj, def_objs)
 
         config["OBJECTIVE_WEIGHT"] = ",".join(map(str, scale))
+        prefetch_gradients(config, state, [obj_list], [config])
         grad = su2grad(obj_list, grad_method, config, state)
         # scaling : obj scale  and sign are accounted for in combo gradient, dv scale now applied
         global_factor = float(config["OPT_GRADIENT_FACTOR"])
@@ -375,6 +377,17 @@ def obj_df(dvs, config, state=None):
     else:
         # Evaluate objectives one-by-one
         marker_monitored = config["MARKER_MONITORING"]
+
+        # Objective (and constraint) gradients that can run concurrently
+        if n_obj > 1:
+            obj_configs = []
+            for i_obj in range(n_obj):
+                konfig = copy.deepcopy(config)
+                konfig["MARKER_MONITORING"] = marker_monitored[i_obj]
+                obj_configs.append(konfig)
+        else:
+            obj_configs = [config]
+        prefetch_gradients(config, state, list(objectives), obj_configs)
         for i_obj, this_obj in enumerate(objectives):
             # For multiple objectives are evaluated one-by-one rather than combined
             # MARKER_MONITORING should be updated to only include the marker for i_obj
@@ -411,6 +424,38 @@ def obj_df(dvs, config, state=None):
 #: def obj_df()
 
 
+def prefetch_gradients(config, state, func_names, configs):
+    """SU2.eval.design.prefetch_gradients(config,state,func_names,configs)
+
+    With OPT_CONCURRENT_JOBS > 1, evaluates the adjoint gradients of the
+    given objectives together with those of the constraints (which the
+    optimizers request for the same design) concurrently, see
+    SU2.eval.concurrent_gradients(). The constraints are evaluated
+    with the config as it is after the objectives.
+    """
+
+    if int(config.get("OPT_CONCURRENT_JOBS", 1)) < 2:
+        return
+
+    grad_method = config.get("GRADIENT_METHOD", "CONTINUOUS_ADJOINT")
+    constraints = list(config["OPT_CONSTRAINT"]["EQUALITY"].keys()) + list(
+        config["OPT_CONSTRAINT"]["INEQUALITY"].keys()
+    )
+    all_names = list(func_names) + constraints
+    all_configs = list(configs) + [configs[-1]] * len(constraints)
+
+    concurrent_gradients(all_names, grad_method, all_configs, state)
+
+    # side effects of the evaluations on the config
+    if all_configs[-1] is not config:
+        for key in ["OBJECTIVE_FUNCTION", "RESTART_SOL", "OUTPUT_FILES"]:
+            if key in all_configs[-1]:
+                config[key] = all_configs[-1][key]
+
+
+#: def prefetch_gradients()
+
+
 def con_ceq(dvs, config, state=None):
     """vals = SU2.eval.con_ceq(dvs,config,state=None)
 
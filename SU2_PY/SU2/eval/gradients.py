@@ -357,6 +357,115 @@ def adjoint(func_name, config, state=None):
 #: def adjoint()
 
 
+# ----------------------------------------------------------------------
+#  Concurrent Adjoint Gradients
+# ----------------------------------------------------------------------
+
+
+def concurrent_gradients(func_names, method, configs, state=None):
+    """SU2.eval.concurrent_gradients(func_names,method,configs,state=None)
+
+    Evaluates the adjoint gradients of several functions concurrently,
+    with up to OPT_CONCURRENT_JOBS simultaneous adjoint runs (each
+    followed by its gradient projection), each using NUMBER_PART
+    processes. The direct solution, which they share, is computed
+    first. Functions that are not adjoint coefficients, and those
+    whose gradient is already in the state, are left to the serial
+    path (SU2.eval.grad()), which then finds the computed gradients
+    in the state.
+
+    The jobs run in separate processes since they change the working
+    folder and the output redirection. Each one runs in its own
+    ADJOINT_* folder, linking the mesh and direct solution files.
+    Use SU2_MPI_COMMAND to place the runs in sub-allocations, e.g.
+    "srun --exclusive -n %i %s".
+
+    Assumptions:
+        Same as SU2.eval.adjoint().
+        Updates the configs and state by reference, as the serial
+        evaluation of the gradients in the same order would.
+
+    Inputs:
+        func_names - list of SU2 objective function names (or lists
+                     of names for combined objectives)
+        method     - 'CONTINUOUS_ADJOINT' or 'DISCRETE_ADJOINT'
+        configs    - an SU2 config, or a list with one per function
+        state      - optional, an SU2 state
+    """
+
+    state = su2io.State(state)
+    if not isinstance(configs, list):
+        configs = [configs] * len(func_names)
+
+    n_jobs = int(configs[0].get("OPT_CONCURRENT_JOBS", 1))
+    if n_jobs < 2 or not method in ["CONTINUOUS_ADJOINT", "DISCRETE_ADJOINT"]:
+        return
+
+    def is_coefficient(name):
+        return (
+            name in su2io.historyOutFields
+            and su2io.historyOutFields[name]["TYPE"] == "COEFFICIENT"
+        )
+
+    todo = []
+    for func_name, config in zip(func_names, configs):
+        names = func_name if type(func_name) == list else [func_name]
+        func_output = "COMBO" if type(func_name) == list else func_name
+        if func_output in state["GRADIENTS"] or not all(map(is_coefficient, names)):
+            continue
+        if any([func_output == output for output, _, _ in todo]):
+            continue
+        todo.append((func_output, func_name, config))
+
+    if len(todo) < 2:
+        return
+
+    # the direct solution is shared (includes redundancy checks)
+    for _, func_name, config in todo:
+        function(func_name, config, state)
+
+    from concurrent.futures import ProcessPoolExecutor
+
+    with ProcessPoolExecutor(max_workers=min(n_jobs, len(todo))) as pool:
+        jobs = [
+            pool.submit(
+                _gradient_job,
+                func_name,
+                method,
+                copy.deepcopy(config),
+                copy.deepcopy(state),
+            )
+            for _, func_name, config in todo
+        ]
+        results = [job.result() for job in jobs]
+
+    # merge in the original order
+    for (_, _, config), (konfig, ztate) in zip(todo, results):
+        state.update(ztate)
+        for key in [
+            "OPT_COMBINE_OBJECTIVE",
+            "OBJECTIVE_WEIGHT",
+            "OBJECTIVE_FUNCTION",
+            "RESTART_SOL",
+            "OUTPUT_FILES",
+        ]:
+            if key in konfig:
+                config[key] = konfig[key]
+
+    return
+
+
+def _gradient_job(func_name, method, config, state):
+    """Runs SU2.eval.grad() in a worker process of concurrent_gradients(),
+    returns the updated config and state."""
+
+    gradient(func_name, method, config, state)
+    return config, state
+
+
+#: def concurrent_gradients()
+
+
 # ----------------------------------------------------------------------
 #  Stability Functions
 # ----------------------------------------------------------------------
@@ -478,6 +478,7 @@ def read_config(filename):
             # int parameters
             if (
                 case("NUMBER_PART")
+                or case("OPT_CONCURRENT_JOBS")
                 or case("AVAILABLE_PROC")
                 or case("ITER")
                 or case("TIME_INSTANCES")
@@ -4,4 +4,5 @@ from .project import Project
 from .scipy_tools import scipy_slsqp as SLSQP
 from .scipy_tools import scipy_cg as CG
 from .scipy_tools import scipy_bfgs as BFGS
+from .scipy_tools import scipy_newton_cg as NEWTON_CG
 from .scipy_tools import scipy_powell as POWELL
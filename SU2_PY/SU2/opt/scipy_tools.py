@@ -32,7 +32,7 @@
 import sys
 
 from .. import eval as su2eval
-from numpy import array, zeros
+from numpy import array, sqrt, zeros
 
 
 # -------------------------------------------------------------------
@@ -330,6 +330,87 @@ def scipy_bfgs(project, x0=None, xb=None, its=100, accu=1e-10, grads=True):
     return outputs
 
 
+# -------------------------------------------------------------------
+#  Scipy Newton-CG
+# -------------------------------------------------------------------
+
+
+def scipy_newton_cg(project, x0=None, xb=None, its=100, accu=1e-10, grads=True):
+    """result = scipy_newton_cg(project,x0=[],xb=[],its=100,accu=1e-10)
+
+    Runs the Scipy implementation of the truncated Newton (Newton-CG)
+    method with an SU2 project. The Hessian-vector products are
+    directional derivatives of the adjoint gradients, see obj_ddf_p.
+
+    Inputs:
+        project - an SU2 project
+        x0      - optional, initial guess
+        xb      - optional, design variable bounds (not used)
+        its     - max outer iterations, default 100
+        accu    - accuracy, default 1e-10
+
+    Outputs:
+       result - the outputs from scipy.fmin_ncg
+    """
+
+    # import scipy optimizer
+    from scipy.optimize import fmin_ncg
+
+    # handle input cases
+    if x0 is None:
+        x0 = []
+    if xb is None:
+        xb = []
+
+    if project.config.get("GRADIENT_METHOD", "NONE") == "NONE":
+        raise Exception("Newton-CG requires gradients (GRADIENT_METHOD).")
+
+    # number of design variables
+    n_dv = len(project.config["DEFINITION_DV"]["KIND"])
+    project.n_dv = n_dv
+
+    # Initial guess
+    if not x0:
+        x0 = [0.0] * n_dv
+
+    # prescale x0
+    dv_scales = project.config["DEFINITION_DV"]["SCALE"]
+    x0 = [x0[i] / dv_scl for i, dv_scl in enumerate(dv_scales)]
+
+    # scale accuracy
+    obj = project.config["OPT_OBJECTIVE"]
+    obj_scale = obj[list(obj.keys())[0]]["SCALE"]
+    accu = accu * obj_scale
+
+    # optimizer summary
+    sys.stdout.write("Truncated Newton (Newton-CG) parameters:\n")
+    sys.stdout.write("Number of design variables: " + str(n_dv) + "\n")
+    sys.stdout.write("Objective function scaling factor: " + str(obj_scale) + "\n")
+    sys.stdout.write("Maximum number of iterations: " + str(its) + "\n")
+    sys.stdout.write("Requested accuracy: " + str(accu) + "\n")
+    sys.stdout.write("Initial guess for the independent variable(s): " + str(x0) + "\n\n")
+
+    # Evaluate the objective function (only 1st iteration)
+    obj_f(x0, project)
+
+    # Run Optimizer
+    outputs = fmin_ncg(
+        f=obj_f,
+        x0=x0,
+        fprime=obj_df,
+        fhess_p=obj_ddf_p,
+        args=(project,),
+        avextol=accu,
+        maxiter=its,
+        full_output=True,
+        disp=True,
+        retall=True,
+    )
+
+    # Done
+    return outputs
+
+
 def scipy_powell(project, x0=None, xb=None, its=100, accu=1e-10, grads=False):
     """result = scipy_powell(project,x0=[],xb=[],its=100,accu=1e-10)
 
@@ -444,6 +525,30 @@ def obj_df(x, project):
     return dobj
 
 
+def obj_ddf_p(x, p, project, eps=1.0e-04):
+    """ddobj_p = obj_ddf_p(x,p,project,eps=1e-4)
+
+    Objective Function Hessian-vector product
+    SU2 Project interface to scipy.fmin_ncg
+
+    Directional derivative of the gradient, (df(x+h*p) - df(x)) / h,
+    with h such that the design changes by eps (in scaled design
+    variables). The gradient at x is reused from the project, i.e. each
+    product costs one direct and one adjoint evaluation.
+    """
+
+    p = array(p, dtype=float)
+    norm_p = sqrt(p.dot(p))
+    if norm_p == 0.0:
+        return zeros(len(p))
+
+    step = eps / norm_p
+    x = array(x, dtype=float)
+    ddobj_p = (obj_df(x + step * p, project) - obj_df(x, project)) / step
+
+    return ddobj_p
+
+
 def con_ceq(x, project):
     """cons = con_ceq(x,project)
 
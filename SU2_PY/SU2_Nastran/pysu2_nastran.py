@@ -1099,6 +1099,33 @@ class Solver:
         histFile.write(line)
         histFile.close()
 
+    def writeSU2Modes(self, fileName):
+        """
+        This method writes the modes in the format read by the structural solver of SU2
+        (MODAL_SUPERPOSITION= YES, MODAL_FILENAME). The points are numbered in the order of
+        the GRID cards, the SU2 structural mesh must number its points in the same way.
+        """
+
+        with open(fileName, "w") as modesFile:
+            modesFile.write(
+                "% Structural modes exported from the Nastran punch file "
+                + self.Punch_file
+                + ".\n"
+            )
+            modesFile.write("NMODES= {}\nNDIM= 3\n".format(self.nDof))
+            for imode in range(self.nDof):
+                omega = sqrt(max(self.K[imode][imode], 0.0))
+                modesFile.write("MODE= {} OMEGA= {:.15e}\n".format(imode + 1, omega))
+                for iPoint in range(self.nPoint):
+                    modesFile.write(
+                        "{}\t{:.15e}\t{:.15e}\t{:.15e}\n".format(
+                            iPoint,
+                            float(self.Ux[iPoint][imode]),
+                            float(self.Uy[iPoint][imode]),
+                            float(self.Uz[iPoint][imode]),
+                        )
+                    )
+
     def updateSolution(self):
         """
         This method updates the solution.
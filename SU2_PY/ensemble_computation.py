@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+
+## \file ensemble_computation.py
+#  \brief Python script to run an ensemble of small steady cases (e.g. a polar) in one MPI job.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+from __future__ import division, print_function, absolute_import
+from optparse import OptionParser
+from mpi4py import MPI
+import pysu2
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option(
+        "-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE"
+    )
+    parser.add_option(
+        "-g",
+        "--groups",
+        dest="groups",
+        default=1,
+        help="Number of process GROUPS, each group runs a share of the samples",
+        metavar="GROUPS",
+    )
+    parser.add_option(
+        "-s",
+        "--samples",
+        dest="samples",
+        default=None,
+        help="FILE with one sample per line: AoA [AoS]",
+        metavar="FILE",
+    )
+    parser.add_option(
+        "--aoa",
+        dest="aoa",
+        default=None,
+        help="Comma separated list of angles of attack (alternative to --samples)",
+        metavar="LIST",
+    )
+    parser.add_option(
+        "-v",
+        "--values",
+        dest="values",
+        default="LIFT,DRAG,MOMENT_Z",
+        help="Comma separated list of history outputs to collect",
+        metavar="LIST",
+    )
+    parser.add_option(
+        "-o",
+        "--output",
+        dest="output",
+        default="ensemble.csv",
+        help="Results FILE",
+        metavar="FILE",
+    )
+
+    (options, args) = parser.parse_args()
+
+    if options.filename == None:
+        raise Exception("No config file provided. Use -f flag")
+
+    world = MPI.COMM_WORLD
+    rank = world.Get_rank()
+    size = world.Get_size()
+
+    n_groups = max(1, min(int(options.groups), size))
+    samples = ReadSamples(options)
+    values = [v.strip() for v in options.values.split(",") if v.strip()]
+
+    # Contiguous ranks form a group (keeps groups within nodes), each group
+    # gets a contiguous chunk of the sorted samples so that every sample is
+    # warm-started from the converged solution of its neighbour.
+    group = rank * n_groups // size
+    comm = world.Split(group, rank)
+
+    first = group * len(samples) // n_groups
+    last = (group + 1) * len(samples) // n_groups
+
+    # The mesh is read and preprocessed once per group, the driver is then
+    # reused for all the samples of the group.
+    driver = pysu2.CSinglezoneDriver(options.filename, 1, comm)
+
+    results = []
+    for index in range(first, last):
+        aoa, aos = samples[index]
+        driver.SetFarFieldAoA(aoa)
+        driver.SetFarFieldAoS(aos)
+        driver.StartSolver()
+        results.append((index, aoa, aos, [driver.GetOutputValue(v) for v in values]))
+
+    driver.Finalize()
+    del driver
+
+    # Only the first rank of each group contributes, the others hold the same values.
+    all_results = world.gather(results if comm.Get_rank() == 0 else [], root=0)
+
+    if rank == 0:
+        rows = sorted([row for part in all_results for row in part])
+        with open(options.output, "w") as f:
+            f.write(",".join(["SAMPLE", "AOA", "SIDESLIP_ANGLE"] + values) + "\n")
+            for index, aoa, aos, vals in rows:
+                f.write(",".join([str(index), repr(aoa), repr(aos)] + [repr(v) for v in vals]) + "\n")
+        print("Wrote %d samples to %s" % (len(rows), options.output))
+
+    comm.Free()
+
+
+def ReadSamples(options):
+    """Returns the list of (AoA, AoS) samples sorted such that neighbours are close."""
+    samples = []
+    if options.samples != None:
+        with open(options.samples) as f:
+            for line in f:
+                line = line.split("#")[0].replace(",", " ").split()
+                if not line:
+                    continue
+                aoa = float(line[0])
+                aos = float(line[1]) if len(line) > 1 else 0.0
+                samples.append((aoa, aos))
+    elif options.aoa != None:
+        samples = [(float(a), 0.0) for a in options.aoa.split(",") if a.strip()]
+    else:
+        raise Exception("No samples provided. Use --samples or --aoa")
+
+    return sorted(samples)
+
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == "__main__":
+    main()
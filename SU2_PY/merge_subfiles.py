@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+
+## \file merge_subfiles.py
+#  \brief Python script to reassemble a file written in subfiles (MPIIO_SUBFILES).
+#  \author SU2 Contributors
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import os
+from optparse import OptionParser
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+
+def main():
+
+    parser = OptionParser(usage="usage: %prog [options] FILE.idx")
+    parser.add_option(
+        "-o", "--output", dest="output", default="", help="merged FILE (default: the index without .idx)",
+        metavar="FILE"
+    )
+    parser.add_option(
+        "-r", "--remove", dest="remove", action="store_true", default=False,
+        help="remove the subfiles and the index after merging"
+    )
+
+    (options, args) = parser.parse_args()
+    if len(args) != 1:
+        parser.error("the index of the subfiles is required")
+
+    merge_subfiles(args[0], options.output, options.remove)
+
+
+# -------------------------------------------------------------------
+#  MERGE SUBFILES
+# -------------------------------------------------------------------
+
+
+def merge_subfiles(index_name, output="", remove=False):
+    """Copies the blocks listed in the index to their offsets in the merged file."""
+
+    folder = os.path.dirname(index_name)
+    if not output:
+        output = index_name[:-4] if index_name.endswith(".idx") else index_name + ".merged"
+
+    with open(index_name) as index:
+        header = index.readline().split()
+        if len(header) != 3 or header[0] != "SU2_SUBFILES":
+            raise RuntimeError("%s is not an index of subfiles" % index_name)
+        file_size = int(header[2])
+        blocks = [line.split() for line in index if line.strip()]
+
+    subfiles = {}
+    try:
+        with open(output, "wb") as merged:
+            merged.truncate(file_size)
+            for name, offset, size, sub_offset in blocks:
+                if name not in subfiles:
+                    subfiles[name] = open(os.path.join(folder, name), "rb")
+                sub = subfiles[name]
+                sub.seek(int(sub_offset))
+                data = sub.read(int(size))
+                if len(data) != int(size):
+                    raise RuntimeError("subfile %s is truncated" % name)
+                merged.seek(int(offset))
+                merged.write(data)
+    finally:
+        for sub in subfiles.values():
+            sub.close()
+
+    if remove:
+        for name in subfiles:
+            os.remove(os.path.join(folder, name))
+        os.remove(index_name)
+
+    return output
+
+
+#: def merge_subfiles()
+
+if __name__ == "__main__":
+    main()
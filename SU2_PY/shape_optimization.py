@@ -71,7 +71,7 @@ def main():
         "--optimization",
         dest="optimization",
         default="SLSQP",
-        help="OPTIMIZATION techique (SLSQP, CG, BFGS, POWELL)",
+        help="OPTIMIZATION techique (SLSQP, CG, BFGS, NEWTON_CG, POWELL)",
         metavar="OPTIMIZATION",
     )
     parser.add_option(
@@ -284,6 +284,8 @@ def shape_optimization(
         SU2.opt.CG(project, x0, xb, its, accu)
     if optimization == "BFGS":
         SU2.opt.BFGS(project, x0, xb, its, accu)
+    if optimization == "NEWTON_CG":
+        SU2.opt.NEWTON_CG(project, x0, xb, its, accu)
     if optimization == "POWELL":
         SU2.opt.POWELL(project, x0, xb, its, accu)
 
@@ -39,4 +39,6 @@
 void WriteFiles(CConfig* config, CGeometry* geometry, CSolver** solver_container, COutput* output,
                 unsigned long TimeIter);
 
+void PrefetchFile(const CConfig* config, std::string filename);
+
 using namespace std;
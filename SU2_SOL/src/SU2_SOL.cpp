@@ -27,6 +27,11 @@
 
 #include "../include/SU2_SOL.hpp"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 
 int main(int argc, char* argv[]) {
@@ -659,6 +664,47 @@ int main(int argc, char* argv[]) {
 
     }
 
+    else if (config_container[ZONE_0]->GetnSol_Batch_Files() > 0) {
+      /*--- Batch of steady solutions (e.g. the snapshots of an unsteady simulation): the geometry,
+       solver, and output structures are set up once and the files are then converted in turn.
+       While the outputs of one file are written, the OS is already reading the next one. ---*/
+
+      auto* zoneConfig = config_container[ZONE_0];
+      const auto nFiles = zoneConfig->GetnSol_Batch_Files();
+      const auto volumeName = zoneConfig->GetVolume_FileName();
+      const auto surfaceName = zoneConfig->GetSurfCoeff_FileName();
+
+      zoneConfig->SetiInst(INST_0);
+      zoneConfig->SetSolution_FileName(zoneConfig->GetSol_Batch_FileName(0));
+      PrefetchFile(zoneConfig, zoneConfig->GetSol_Batch_FileName(0));
+
+      solver_container[ZONE_0][INST_0] = new CBaselineSolver(geometry_container[ZONE_0][INST_0], zoneConfig);
+      output[ZONE_0] = new CBaselineOutput(zoneConfig, geometry_container[ZONE_0][INST_0]->GetnDim(),
+                                           solver_container[ZONE_0][INST_0]);
+      output[ZONE_0]->PreprocessVolumeOutput(zoneConfig);
+      output[ZONE_0]->PreprocessHistoryOutput(zoneConfig, false);
+
+      for (unsigned short iFile = 0; iFile < nFiles; iFile++) {
+        const auto& fileName = zoneConfig->GetSol_Batch_FileName(iFile);
+        zoneConfig->SetSolution_FileName(fileName);
+        solver_container[ZONE_0][INST_0]->LoadRestart(geometry_container[ZONE_0], &solver_container[ZONE_0],
+                                                      zoneConfig, 0, true);
+
+        if (iFile + 1 < nFiles) PrefetchFile(zoneConfig, zoneConfig->GetSol_Batch_FileName(iFile + 1));
+
+        /*--- The outputs are named after the solution file, without directory and extension. ---*/
+        auto stem = fileName.substr(fileName.find_last_of("/\\") + 1);
+        stem = stem.substr(0, stem.find_last_of('.'));
+        zoneConfig->SetVolume_FileName(volumeName + "_" + stem);
+        zoneConfig->SetSurfCoeff_FileName(surfaceName + "_" + stem);
+
+        if (rank == MASTER_NODE) cout << "Writing the solution " << iFile + 1 << "/" << nFiles << "." << endl;
+
+        WriteFiles(zoneConfig, geometry_container[ZONE_0][INST_0], &solver_container[ZONE_0][INST_0],
+                   output[ZONE_0], 0);
+      }
+    }
+
     else {
       /*--- Steady simulation: merge the single solution file. ---*/
 
@@ -783,3 +829,17 @@ void WriteFiles(CConfig* config, CGeometry* geometry, CSolver** solver_container
       output->WriteToFile(config, geometry, FileFormat[iFile]);
   }
 }
+
+void PrefetchFile(const CConfig* config, string filename) {
+#if defined(__unix__) && defined(POSIX_FADV_WILLNEED)
+  /*--- Same naming as the restart readers, the extension of the list entry is replaced. ---*/
+  filename = filename.substr(0, filename.find_last_of('.'));
+  filename += config->GetRead_Binary_Restart() ? ".dat" : ".csv";
+
+  /*--- The advice only queues the read-ahead, it does not wait for the data. ---*/
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+  posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+  close(fd);
+#endif
+}
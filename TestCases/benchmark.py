@@ -0,0 +1,188 @@
+#!/usr/bin/env python
+
+## \file benchmark.py
+#  \brief Python script to measure the performance of SU2 on scaled mesh cases.
+#  \author SU2 Contributors
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function
+
+import argparse
+import csv
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# The cases use the built-in box mesh, the number of cells is size^3. The options must not
+# change unless the reference results are regenerated, otherwise commits cannot be compared.
+base_options = """
+MESH_BOX_LENGTH= 1,1,1
+MESH_BOX_OFFSET= 0,0,0
+MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)
+MACH_NUMBER= 0.5
+REYNOLDS_NUMBER= 1000
+CFL_NUMBER= 10
+LINEAR_SOLVER= FGMRES
+LINEAR_SOLVER_PREC= ILU
+LINEAR_SOLVER_ITER= 10
+CONV_RESIDUAL_MINVAL= -20
+SCREEN_OUTPUT= (INNER_ITER, WALL_TIME, RMS_DENSITY)
+HISTORY_OUTPUT= (ITER, WALL_TIME, RMS_RES)
+OUTPUT_FILES= RESTART
+OUTPUT_WRT_FREQ= 1000000
+"""
+
+cases = {
+  "euler_roe": "SOLVER= EULER\nMARKER_EULER= (y_minus, y_plus)\nCONV_NUM_METHOD_FLOW= ROE\nMUSCL_FLOW= YES\nSLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n",
+  "navierstokes_roe": "SOLVER= NAVIER_STOKES\nMARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\nCONV_NUM_METHOD_FLOW= ROE\nMUSCL_FLOW= YES\n",
+  "rans_sa": "SOLVER= RANS\nMARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\nKIND_TURB_MODEL= SA\nCONV_NUM_METHOD_FLOW= ROE\nMUSCL_FLOW= YES\n",
+}
+
+# Mesh options, BOX is the reference, the others are generated by each rank (SYNTHETIC format)
+# such that large meshes can be used for weak-scaling studies.
+meshes = {
+  "BOX": "MESH_FORMAT= BOX\n",
+  "HEXAHEDRA": "MESH_FORMAT= SYNTHETIC\nSYNTHETIC_MESH_ELEMENTS= HEXAHEDRA\n",
+  "TETRAHEDRA": "MESH_FORMAT= SYNTHETIC\nSYNTHETIC_MESH_ELEMENTS= TETRAHEDRA\n",
+  "HYBRID": "MESH_FORMAT= SYNTHETIC\nSYNTHETIC_MESH_ELEMENTS= HYBRID\nSYNTHETIC_MESH_GROWTH= 1.1\n",
+}
+
+def mesh_size(args, size, ranks):
+  ''' Points along each side, for weak scaling the number of points per rank is that of size^3. '''
+  if not args.weak_scaling: return size
+  return int(round(size * ranks**(1.0 / 3.0)))
+
+def git_commit():
+  ''' Hash of the checked out commit of the SU2 sources, to label the results. '''
+  try:
+    source_dir = os.path.dirname(os.path.abspath(__file__))
+    return subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=source_dir).decode().strip()
+  except (OSError, subprocess.CalledProcessError):
+    return "unknown"
+
+def run_case(args, name, size, ranks):
+  ''' Runs one case and returns the wall time per iteration and the peak memory (MB) of a rank. '''
+  work_dir = tempfile.mkdtemp(prefix="su2_benchmark_")
+  try:
+    with open(os.path.join(work_dir, "benchmark.cfg"), "w") as cfg:
+      cfg.write(base_options + meshes[args.mesh] + cases[name])
+      cfg.write("MESH_BOX_SIZE= %d,%d,%d\n" % (size, size, size))
+      if args.mesh == "HYBRID": cfg.write("SYNTHETIC_MESH_LAYERS= %d\n" % max(1, size // 4))
+      cfg.write("ITER= %d\n" % args.iter)
+
+    command = [args.exe, "benchmark.cfg"]
+    if ranks > 1 or args.mpi_always:
+      command = args.mpirun.split() + ["-n", str(ranks)] + command
+
+    # The peak memory of the children is measured in a separate interpreter, otherwise
+    # it would be the maximum over all the runs of this script.
+    monitor = ("import resource, subprocess, sys\n"
+               "status = subprocess.call(sys.argv[1:], stdout=open('benchmark.log', 'w'), stderr=subprocess.STDOUT)\n"
+               "print(resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)\n"
+               "sys.exit(status)\n")
+    output = subprocess.check_output([sys.executable, "-c", monitor] + command, cwd=work_dir)
+    peak_memory = int(output.decode().split()[-1])
+    if sys.platform != "darwin": peak_memory *= 1024
+
+    with open(os.path.join(work_dir, "history.csv")) as history:
+      rows = [{key.strip().strip('"'): value for key, value in row.items()} for row in csv.DictReader(history)]
+    return float(rows[-1]["Time(sec)"]), peak_memory / 2.0**20
+
+  except subprocess.CalledProcessError:
+    print("Case %s (size %d, %d ranks) failed, log in %s" % (name, size, ranks, work_dir))
+    raise
+  finally:
+    if not args.keep: shutil.rmtree(work_dir, ignore_errors=True)
+
+def compare(results, baseline, tolerance):
+  ''' Reports the cases that became slower or use more memory than the baseline, returns their number. '''
+  index = lambda r: (r["case"], r.get("mesh", "BOX"), r["size"], r["ranks"])
+  reference = {index(r): r for r in baseline["results"]}
+  regressions = 0
+  for r in results:
+    ref = reference.get(index(r))
+    if ref is None: continue
+    for key in ("time_per_iter", "peak_memory_mb"):
+      ratio = r[key] / ref[key]
+      status = "REGRESSION" if ratio > 1 + tolerance else "ok"
+      regressions += status != "ok"
+      print("%-18s size %4d ranks %3d %-15s %10.4g -> %10.4g (%+6.1f%%) %s" %
+            (r["case"], r["size"], r["ranks"], key, ref[key], r[key], 100 * (ratio - 1), status))
+  return regressions
+
+def main():
+  '''Runs SU2 on box meshes of increasing size and number of ranks, and reports the wall time per
+     iteration, the peak memory, and the parallel efficiency. The results are saved in JSON with the
+     commit, to compare them with those of another commit. '''
+
+  parser = argparse.ArgumentParser(description=main.__doc__)
+  parser.add_argument("--cases", nargs="+", default=sorted(cases), choices=sorted(cases))
+  parser.add_argument("--sizes", nargs="+", type=int, default=[32], help="cells along each side of the box")
+  parser.add_argument("--ranks", nargs="+", type=int, default=[1], help="numbers of MPI ranks")
+  parser.add_argument("--mesh", default="BOX", choices=sorted(meshes), help="mesh format and elements")
+  parser.add_argument("--weak-scaling", action="store_true", help="scale the mesh with the number of ranks")
+  parser.add_argument("--iter", type=int, default=20, help="iterations of each run")
+  parser.add_argument("--repeat", type=int, default=3, help="runs of each case, the fastest is kept")
+  parser.add_argument("--exe", default="SU2_CFD")
+  parser.add_argument("--mpirun", default="mpirun")
+  parser.add_argument("--mpi-always", action="store_true", help="use mpirun also for one rank")
+  parser.add_argument("--output", default="benchmark.json")
+  parser.add_argument("--compare", help="results of a previous commit")
+  parser.add_argument("--tolerance", type=float, default=0.05, help="relative increase reported as a regression")
+  parser.add_argument("--keep", action="store_true", help="keep the run directories")
+  args = parser.parse_args()
+
+  results = []
+  for name in args.cases:
+    for size in args.sizes:
+      serial_time = None
+      for ranks in sorted(args.ranks):
+        runs = [run_case(args, name, mesh_size(args, size, ranks), ranks) for _ in range(args.repeat)]
+        time_per_iter = min(run[0] for run in runs)
+        peak_memory = max(run[1] for run in runs)
+
+        # Strong (or weak) scaling efficiency relative to the smallest number of ranks.
+        if serial_time is None: serial_time = (ranks, time_per_iter)
+        if args.weak_scaling:
+          efficiency = serial_time[1] / time_per_iter
+        else:
+          efficiency = serial_time[0] * serial_time[1] / (ranks * time_per_iter)
+
+        results.append({"case": name, "mesh": args.mesh, "size": size, "ranks": ranks, "time_per_iter": time_per_iter,
+                        "peak_memory_mb": peak_memory, "efficiency": efficiency})
+        print("%-18s size %4d ranks %3d  %10.4g s/iter  %8.1f MB  efficiency %5.2f" %
+              (name, size, ranks, time_per_iter, peak_memory, efficiency))
+
+  with open(args.output, "w") as output:
+    json.dump({"commit": git_commit(), "iter": args.iter, "results": results}, output, indent=2)
+
+  if args.compare:
+    with open(args.compare) as baseline:
+      regressions = compare(results, json.load(baseline), args.tolerance)
+    if regressions: sys.exit(1)
+
+if __name__ == "__main__":
+  main()
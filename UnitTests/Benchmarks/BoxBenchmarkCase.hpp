@@ -0,0 +1,116 @@
+/*!
+ * \file BoxBenchmarkCase.hpp
+ * \brief Box mesh, config, and solver of the benchmarks.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+
+#include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#include "../../SU2_CFD/include/solvers/CNSSolver.hpp"
+
+/*!
+ * \brief Cube of N^3 hexahedra (N+1)^3 points with a laminar flow, N is SU2_BENCHMARK_BOX_SIZE (default 40).
+ * \note The benchmarks must be comparable across commits, change the options only with the reference results.
+ */
+struct BoxBenchmarkCase {
+  std::string configOptions =
+      "SOLVER= NAVIER_STOKES\n"
+      "MESH_FORMAT= BOX\n"
+      "INIT_OPTION= TD_CONDITIONS\n"
+      "MACH_NUMBER= 0.5\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "MUSCL_FLOW= YES\n"
+      "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSolver** solver{nullptr};
+
+  /*!
+   * \brief Number of cells along each side of the box.
+   */
+  static int BoxSize() {
+    const char* size = std::getenv("SU2_BENCHMARK_BOX_SIZE");
+    return size ? std::atoi(size) : 40;
+  }
+
+  /*!
+   * \brief Create the config and the geometry (the solver is optional).
+   * \param[in] extraOptions - Options added to the base options.
+   */
+  explicit BoxBenchmarkCase(const std::string& extraOptions = "") {
+    const auto n = std::to_string(BoxSize());
+    configOptions += "MESH_BOX_SIZE= " + n + "," + n + "," + n + "\n" + extraOptions;
+
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss(configOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Create the flow solver and compute its primitive variables.
+   */
+  void InitSolver() {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    solver = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config.get(), geometry.get(), 0);
+    solver[FLOW_SOL]->Preprocessing(geometry.get(), solver, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    cout.rdbuf(origBuf);
+  }
+
+  ~BoxBenchmarkCase() {
+    if (solver != nullptr) delete solver[FLOW_SOL];
+    delete[] solver;
+  }
+};
@@ -0,0 +1,79 @@
+/*!
+ * \file file_writers.cpp
+ * \brief Benchmarks of the sorting and writing of the volume output.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "BoxBenchmarkCase.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CParaviewXMLFileWriter.hpp"
+
+TEST_CASE("File writers", "[benchmark]") {
+  BoxBenchmarkCase box;
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+
+  /*--- Coordinates and the five conservative variables of a restart file. ---*/
+
+  const vector<string> names = {"x", "y", "z", "Density", "Momentum_x", "Momentum_y", "Momentum_z", "Energy"};
+  CFVMDataSorter sorter(config, geometry, names);
+
+  auto SetData = [&]() {
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      for (auto iField = 0u; iField < names.size(); ++iField) {
+        const auto value = iField < 3 ? geometry->nodes->GetCoord(iPoint, iField) : su2double(iField + iPoint % 7);
+        sorter.SetUnsortedData(iPoint, iField, value);
+      }
+    }
+  };
+
+  BENCHMARK("Sort volume data") {
+    SetData();
+    sorter.SortOutputData();
+    return sorter.GetnPoints();
+  };
+
+  BENCHMARK("SU2 binary restart") {
+    CSU2BinaryFileWriter(&sorter).WriteData("benchmark_restart");
+    return 0;
+  };
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  sorter.SortConnectivity(config, geometry, true);
+  cout.rdbuf(origBuf);
+
+  BENCHMARK("Paraview XML") {
+    CParaviewXMLFileWriter(&sorter).WriteData("benchmark_volume");
+    return 0;
+  };
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    std::remove(("benchmark_restart" + CSU2BinaryFileWriter::fileExt).c_str());
+    std::remove(("benchmark_volume" + CParaviewXMLFileWriter::fileExt).c_str());
+  }
+}
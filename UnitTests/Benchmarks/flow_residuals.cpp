@@ -0,0 +1,82 @@
+/*!
+ * \file flow_residuals.cpp
+ * \brief Benchmarks of the convective fluxes, gradients, and limiters of the flow solver.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "BoxBenchmarkCase.hpp"
+
+TEST_CASE("Flow residuals", "[benchmark]") {
+  BoxBenchmarkCase box;
+  box.InitSolver();
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  auto* flowSolver = box.solver[FLOW_SOL];
+
+  /*--- Roe is always vectorized, the numerics container is not used. ---*/
+
+  BENCHMARK("Roe SIMD fluxes") {
+    SU2_OMP_PARALLEL { flowSolver->Upwind_Residual(geometry, box.solver, nullptr, config, MESH_0); }
+    END_SU2_OMP_PARALLEL
+    return flowSolver->LinSysRes[0];
+  };
+
+  BENCHMARK("Gradients GG") {
+    SU2_OMP_PARALLEL { flowSolver->SetPrimitive_Gradient_GG(geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return 0;
+  };
+
+  BENCHMARK("Gradients LS") {
+    SU2_OMP_PARALLEL { flowSolver->SetPrimitive_Gradient_LS(geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return 0;
+  };
+
+  BENCHMARK("Venkatakrishnan limiter") {
+    SU2_OMP_PARALLEL { flowSolver->SetPrimitive_Limiter(geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return 0;
+  };
+}
+
+TEST_CASE("Flow residuals, master thread placement", "[benchmark]") {
+  /*--- All the pages of the solver and geometry data are placed by the master thread, i.e. without
+   * first touch, compare with "Roe SIMD fluxes" to see the effect on multi-socket machines. ---*/
+  omp_set_first_touch(false);
+  BoxBenchmarkCase box;
+  box.InitSolver();
+  omp_set_first_touch(true);
+
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  auto* flowSolver = box.solver[FLOW_SOL];
+
+  BENCHMARK("Roe SIMD fluxes, master thread placement") {
+    SU2_OMP_PARALLEL { flowSolver->Upwind_Residual(geometry, box.solver, nullptr, config, MESH_0); }
+    END_SU2_OMP_PARALLEL
+    return flowSolver->LinSysRes[0];
+  };
+}
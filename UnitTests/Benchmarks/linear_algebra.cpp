@@ -0,0 +1,106 @@
+/*!
+ * \file linear_algebra.cpp
+ * \brief Benchmarks of the sparse matrix products, ILU preconditioner, and halo exchange.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "BoxBenchmarkCase.hpp"
+#include "../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../Common/include/linear_algebra/CSysVector.hpp"
+
+TEST_CASE("Sparse linear algebra", "[benchmark]") {
+  using T = su2mixedfloat;
+  const unsigned short nVar = 5;
+
+  BoxBenchmarkCase box;
+  auto& geometry = *box.geometry;
+  const auto config = box.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nPointDomain = geometry.GetnPointDomain();
+
+  /*--- Block matrix with the pattern of the flow Jacobian, diagonally dominant for the ILU. ---*/
+
+  auto setMatrix = [&](CSysMatrix<T>& matrix) {
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, &geometry, config);
+
+    T block[nVar * nVar];
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+        for (auto k = 0u; k < nVar * nVar; ++k) block[k] = -T(0.1) * (1 + (iPoint + jPoint + k) % 5);
+        matrix.SetBlock(iPoint, jPoint, block);
+      }
+      for (auto k = 0u; k < nVar * nVar; ++k) block[k] = (k % (nVar + 1) == 0) ? 20 : T(0.1);
+      matrix.SetBlock(iPoint, iPoint, block);
+    }
+  };
+
+  CSysMatrix<T> matrix;
+  setMatrix(matrix);
+  CSysVector<T> vec(nPoint, nPointDomain, nVar, 1.0), prod(nPoint, nPointDomain, nVar, 0.0);
+
+  /*--- The same data with all its pages placed by the master thread, i.e. without first touch. ---*/
+  omp_set_first_touch(false);
+  CSysMatrix<T> matrixMaster;
+  setMatrix(matrixMaster);
+  CSysVector<T> vecMaster(nPoint, nPointDomain, nVar, 1.0), prodMaster(nPoint, nPointDomain, nVar, 0.0);
+  omp_set_first_touch(true);
+
+  /*--- The kernels are called in parallel regions, as in the linear solvers. ---*/
+
+  BENCHMARK("SpMV") {
+    SU2_OMP_PARALLEL { matrix.MatrixVectorProduct(vec, prod, &geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return prod[0];
+  };
+
+  BENCHMARK("SpMV, master thread placement") {
+    SU2_OMP_PARALLEL { matrixMaster.MatrixVectorProduct(vecMaster, prodMaster, &geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return prodMaster[0];
+  };
+
+  BENCHMARK("ILU build") {
+    SU2_OMP_PARALLEL { matrix.BuildILUPreconditioner(); }
+    END_SU2_OMP_PARALLEL
+    return 0;
+  };
+
+  BENCHMARK("ILU apply") {
+    SU2_OMP_PARALLEL { matrix.ComputeILUPreconditioner(vec, prod, &geometry, config); }
+    END_SU2_OMP_PARALLEL
+    return prod[0];
+  };
+
+  /*--- Only exchanges data when run with several ranks. ---*/
+
+  BENCHMARK("Halo exchange") {
+    SU2_OMP_PARALLEL {
+      CSysMatrixComms::Initiate(vec, &geometry, config);
+      CSysMatrixComms::Complete(vec, &geometry, config);
+    }
+    END_SU2_OMP_PARALLEL
+    return vec[0];
+  };
+}
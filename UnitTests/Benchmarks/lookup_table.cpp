@@ -0,0 +1,56 @@
+/*!
+ * \file lookup_table.cpp
+ * \brief Benchmarks of the lookup table interpolation.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../Common/include/containers/CLookUpTable.hpp"
+
+TEST_CASE("Lookup table", "[benchmark]") {
+  CLookUpTable table("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable", "EnthalpyTot");
+
+  /*--- Fixed scattered queries inside the table limits, so the results are comparable across commits. ---*/
+
+  const unsigned long nQuery = 10000;
+  std::vector<su2double> prog(nQuery), enth(nQuery), rho(nQuery);
+  for (auto i = 0ul; i < nQuery; ++i) {
+    prog[i] = ((i * 7919) % nQuery) / su2double(nQuery);
+    enth[i] = 2 * ((i * 104729) % nQuery) / su2double(nQuery) - 1;
+  }
+
+  BENCHMARK("LookUp_XY") {
+    for (auto i = 0ul; i < nQuery; ++i) table.LookUp_XY("Density", &rho[i], prog[i], enth[i]);
+    return rho[0];
+  };
+
+  const std::vector<std::string> names = {"Density", "Viscosity"};
+  std::vector<su2double> values(names.size());
+
+  BENCHMARK("LookUp_XY several variables") {
+    for (auto i = 0ul; i < nQuery; ++i) table.LookUp_XY(names, values, prog[i], enth[i]);
+    return values[0];
+  };
+}
@@ -0,0 +1,88 @@
+/*!
+ * \file CADTPointsOnlyClass_tests.cpp
+ * \brief Unit tests for the nearest node searches of the points ADT.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <vector>
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+
+TEST_CASE("ADT k nearest nodes", "[ADT]") {
+  constexpr unsigned short nDim = 3;
+  constexpr unsigned long nPoint = 500, nNodes = 7;
+
+  /*--- Pseudo-random cloud of points. ---*/
+  std::vector<su2double> coord(nDim * nPoint);
+  std::vector<unsigned long> pointID(nPoint);
+  unsigned long seed = 12345;
+  auto random = [&seed]() {
+    seed = (1103515245 * seed + 12345) % 2147483648;
+    return su2double(seed) / 2147483648.0;
+  };
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    pointID[iPoint] = 10 * iPoint;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iPoint * nDim + iDim] = random();
+  }
+
+  CADTPointsOnlyClass adt(nDim, nPoint, coord.data(), pointID.data(), false);
+
+  std::vector<su2double> dist;
+  std::vector<unsigned long> found;
+  std::vector<int> ranks;
+
+  for (int iTest = 0; iTest < 20; ++iTest) {
+    const su2double target[nDim] = {1.2 * random() - 0.1, 1.2 * random() - 0.1, 1.2 * random() - 0.1};
+
+    /*--- Brute force reference. ---*/
+    std::vector<std::pair<su2double, unsigned long> > ref(nPoint);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      su2double d2 = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) d2 += pow(target[iDim] - coord[iPoint * nDim + iDim], 2);
+      ref[iPoint] = {sqrt(d2), pointID[iPoint]};
+    }
+    std::sort(ref.begin(), ref.end());
+
+    adt.DetermineNearestNodes(target, nNodes, dist, found, ranks);
+
+    REQUIRE(found.size() == nNodes);
+    for (auto i = 0ul; i < nNodes; ++i) {
+      CHECK(found[i] == ref[i].second);
+      CHECK(SU2_TYPE::GetValue(dist[i]) == Approx(SU2_TYPE::GetValue(ref[i].first)));
+    }
+
+    /*--- Consistent with the single node search. ---*/
+    su2double dist1;
+    unsigned long found1;
+    int rank1;
+    adt.DetermineNearestNode(target, dist1, found1, rank1);
+    CHECK(found1 == found[0]);
+  }
+
+  /*--- Fewer points than requested. ---*/
+  CADTPointsOnlyClass small(nDim, 1, coord.data(), pointID.data(), false);
+  small.DetermineNearestNodes(coord.data(), nNodes, dist, found, ranks);
+  REQUIRE(found.size() == 1);
+  CHECK(found[0] == pointID[0]);
+}
@@ -130,3 +130,46 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(look_up_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_binary", "[tabulated chemistry]") {
+  /*--- write the 3D table in binary format, read it back, and compare lookups ---*/
+
+  const string file_name = "src/SU2/UnitTests/Common/containers/lookuptable_3D.drg";
+  const string binary_name = "lookuptable_3D_test.drg.bin";
+
+  auto ascii_table = CLookUpTable::GetShared(file_name, "ProgressVariable", "EnthalpyTot");
+  CHECK(ascii_table == CLookUpTable::GetShared(file_name, "ProgressVariable", "EnthalpyTot"));
+
+  ascii_table->WriteBinaryLUT(binary_name);
+  CLookUpTable binary_table(binary_name, "ProgressVariable", "EnthalpyTot");
+  remove(binary_name.c_str());
+
+  const su2double prog[] = {0.55, 0.6, 1.1}, enth[] = {-0.5, 0.9, 1.1}, mfrac[] = {0.5, 0.8, 2.0};
+  for (int i = 0; i < 3; i++) {
+    for (const string look_up_tag : {"Density", "Viscosity"}) {
+      su2double val_ascii, val_binary;
+      ascii_table->LookUp_XYZ(look_up_tag, &val_ascii, prog[i], enth[i], mfrac[i]);
+      binary_table.LookUp_XYZ(look_up_tag, &val_binary, prog[i], enth[i], mfrac[i]);
+      CHECK(SU2_TYPE::GetValue(val_binary) == Approx(SU2_TYPE::GetValue(val_ascii)));
+    }
+  }
+}
+
+TEST_CASE("LUTreader_hints", "[tabulated chemistry]") {
+  /*--- lookups that start from the last triangle found must match the trapezoidal map search ---*/
+
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                             "EnthalpyTot");
+
+  vector<unsigned long> hints(look_up_table.GetNLevels(), numeric_limits<unsigned long>::max());
+
+  const string look_up_tag = "Density";
+  for (int i = 0; i <= 20; i++) {
+    /*--- walk along a diagonal through the table and back out of bounds ---*/
+    const su2double prog = 0.05 * i, enth = -1.0 + 0.1 * i, mfrac = 0.05 * i;
+    su2double val_search, val_hint;
+    look_up_table.LookUp_XYZ(look_up_tag, &val_search, prog, enth, mfrac);
+    look_up_table.LookUp_XYZ(look_up_tag, &val_hint, prog, enth, mfrac, hints.data());
+    CHECK(SU2_TYPE::GetValue(val_hint) == Approx(SU2_TYPE::GetValue(val_search)));
+  }
+}
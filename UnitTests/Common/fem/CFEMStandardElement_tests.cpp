@@ -0,0 +1,65 @@
+/*!
+ * \file CFEMStandardElement_tests.cpp
+ * \brief Unit tests for the sum factorization of the FEM standard hexahedron.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+TEST_CASE("Sum factorization of the standard hexahedron", "[FEM]") {
+  const unsigned short NPad = 8;
+  CBlasStructure blas;
+
+  for (unsigned short nPoly = 1; nPoly <= 4; ++nPoly) {
+    const CFEMStandardElement elem(HEXAHEDRON, nPoly, false, nullptr, 3 * nPoly);
+    REQUIRE(elem.TensorProductElement());
+
+    const unsigned short nDOFs = elem.GetNDOFs();
+    const unsigned short nInt = elem.GetNIntegration();
+
+    std::vector<su2double> sol(nDOFs * NPad), fluxes(3 * nInt * NPad);
+    for (size_t i = 0; i < sol.size(); ++i) sol[i] = std::sin(0.3 * i);
+    for (size_t i = 0; i < fluxes.size(); ++i) fluxes[i] = std::cos(0.7 * i);
+
+    std::vector<su2double> work(elem.GetSizeWorkTensorProduct() * NPad);
+    std::vector<su2double> ref(4 * nInt * NPad), val(4 * nInt * NPad);
+
+    /*--- Solution and gradients in the integration points. ---*/
+    blas.gemm(4 * nInt, NPad, nDOFs, elem.GetMatBasisFunctionsIntegration(), sol.data(), ref.data(), nullptr);
+    elem.TensorProductSolAndGradInt(NPad, sol.data(), val.data(), work.data(), true);
+    for (size_t i = 0; i < ref.size(); ++i) CHECK(val[i] == Approx(ref[i]).margin(1e-12));
+
+    /*--- Volume residual from the parametric fluxes. ---*/
+    blas.gemm(nDOFs, NPad, 3 * nInt, elem.GetDerMatBasisFunctionsIntTrans(), fluxes.data(), ref.data(), nullptr);
+    elem.TensorProductDerBasisTrans(NPad, fluxes.data(), val.data(), work.data());
+    for (size_t i = 0; i < nDOFs * NPad; ++i) CHECK(val[i] == Approx(ref[i]).margin(1e-12));
+
+    /*--- Residual of data in the integration points (source terms). ---*/
+    blas.gemm(nDOFs, NPad, nInt, elem.GetBasisFunctionsIntegrationTrans(), fluxes.data(), ref.data(), nullptr);
+    elem.TensorProductBasisTrans(NPad, fluxes.data(), val.data(), work.data());
+    for (size_t i = 0; i < nDOFs * NPad; ++i) CHECK(val[i] == Approx(ref[i]).margin(1e-12));
+  }
+}
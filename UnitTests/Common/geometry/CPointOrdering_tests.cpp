@@ -0,0 +1,80 @@
+/*!
+ * \file CPointOrdering_tests.cpp
+ * \brief Unit tests for the renumbering of the points (POINT_ORDERING).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+
+#include <algorithm>
+
+namespace {
+/*!
+ * \brief Renumber the points of the unit box and check that the numbering is a permutation that
+ *        preserves the coordinates and connectivity of each (global) point.
+ */
+void CheckPointOrdering(const std::string& ordering) {
+  UnitQuadTestCase TestCase;
+  TestCase.AddOption("POINT_ORDERING= " + ordering);
+  TestCase.InitConfig();
+
+  cout.rdbuf(nullptr);
+  auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(TestCase.config.get(), 0, 1));
+  auto geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), TestCase.config.get()));
+  geometry->SetSendReceive(TestCase.config.get());
+  geometry->SetBoundaries(TestCase.config.get());
+  geometry->SetPoint_Connectivity();
+
+  const auto nPoint = geometry->GetnPoint();
+  su2activematrix coord(nPoint, 3);
+  vector<unsigned short> nNeighbor(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto iGlobal = geometry->nodes->GetGlobalIndex(iPoint);
+    for (auto iDim = 0u; iDim < 3; ++iDim) coord(iGlobal, iDim) = geometry->nodes->GetCoord(iPoint, iDim);
+    nNeighbor[iGlobal] = geometry->nodes->GetnPoint(iPoint);
+  }
+
+  geometry->SetPoint_Ordering(TestCase.config.get());
+  geometry->SetPoint_Connectivity();
+  cout.rdbuf(TestCase.orig_buf);
+
+  REQUIRE(geometry->GetnPoint() == nPoint);
+
+  vector<unsigned long> count(nPoint, 0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto iGlobal = geometry->nodes->GetGlobalIndex(iPoint);
+    REQUIRE(iGlobal < nPoint);
+    ++count[iGlobal];
+    for (auto iDim = 0u; iDim < 3; ++iDim) CHECK(geometry->nodes->GetCoord(iPoint, iDim) == coord(iGlobal, iDim));
+    CHECK(geometry->nodes->GetnPoint(iPoint) == nNeighbor[iGlobal]);
+  }
+  CHECK(std::all_of(count.begin(), count.end(), [](unsigned long c) { return c == 1; }));
+}
+}  // namespace
+
+TEST_CASE("RCM point ordering", "[Geometry]") { CheckPointOrdering("RCM"); }
+
+TEST_CASE("Hilbert point ordering", "[Geometry]") { CheckPointOrdering("HILBERT"); }
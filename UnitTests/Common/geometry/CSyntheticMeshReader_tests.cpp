@@ -0,0 +1,82 @@
+/*!
+ * \file CSyntheticMeshReader_tests.cpp
+ * \brief Unit tests for the meshes generated by CSyntheticMeshReaderFVM.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+namespace {
+/*!
+ * \brief Generate a synthetic box and check that the dual grid covers it, i.e. that the elements are
+ *        conforming, and that the boundary faces cover the sides.
+ */
+void CheckSyntheticBox(const std::string& elements) {
+  UnitQuadTestCase TestCase;
+  auto& options = TestCase.config_options;
+  options.replace(options.find("MESH_FORMAT= BOX"), 16, "MESH_FORMAT= SYNTHETIC");
+  options.replace(options.find("MESH_BOX_SIZE=5,5,5"), 19, "MESH_BOX_SIZE=5,6,4");
+  options.replace(options.find("MESH_BOX_LENGTH=1,1,1"), 21, "MESH_BOX_LENGTH=1,2,3");
+  TestCase.AddOption("SYNTHETIC_MESH_ELEMENTS= " + elements);
+  TestCase.AddOption("SYNTHETIC_MESH_LAYERS= 2");
+  TestCase.AddOption("SYNTHETIC_MESH_GROWTH= 1.3");
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto geometry = TestCase.geometry.get();
+  auto config = TestCase.config.get();
+
+  REQUIRE(geometry->GetGlobal_nPointDomain() == 5 * 6 * 4);
+
+  su2double volume = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) volume += geometry->nodes->GetVolume(iPoint);
+  CHECK(volume == Approx(6.0));
+
+  const su2double sideArea[] = {6.0, 3.0, 2.0};
+
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); iMarker++) {
+    const auto& tag = config->GetMarker_All_TagBound(iMarker);
+    const int iDir = tag[0] - 'x';
+    const su2double sign = (tag.substr(2) == "plus") ? 1.0 : -1.0;
+
+    su2double normal[3] = {0.0}, area = 0.0;
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      geometry->vertex[iMarker][iVertex]->GetNormal(normal);
+      area += GeometryToolbox::Norm(3, normal);
+      /*--- The normals of the vertices point into the domain. ---*/
+      CHECK(sign * normal[iDir] < 0.0);
+    }
+    CHECK(area == Approx(sideArea[iDir]));
+  }
+}
+}  // namespace
+
+TEST_CASE("Synthetic mesh of hexahedra", "[Geometry]") { CheckSyntheticBox("HEXAHEDRA"); }
+
+TEST_CASE("Synthetic mesh of tetrahedra", "[Geometry]") { CheckSyntheticBox("TETRAHEDRA"); }
+
+TEST_CASE("Synthetic mesh of prisms and tetrahedra", "[Geometry]") { CheckSyntheticBox("HYBRID"); }
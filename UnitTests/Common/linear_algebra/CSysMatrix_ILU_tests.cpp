@@ -0,0 +1,122 @@
+/*!
+ * \file CSysMatrix_ILU_tests.cpp
+ * \brief Unit tests for the level-scheduled ILU of CSysMatrix.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+namespace {
+/*!
+ * \brief Apply the ILU of a block matrix with the FVM pattern of the unit box, computed with
+ *        the given options, to a vector.
+ * \param[out] residual - Optionally, the (global) norm of vec - A * ILU^-1 * vec.
+ */
+std::vector<su2mixedfloat> ApplyILU(const std::string& options, su2double* residual = nullptr) {
+  using T = su2mixedfloat;
+  const unsigned short nVar = 2;
+
+  UnitQuadTestCase TestCase;
+  TestCase.AddOption(options);
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto& geometry = *TestCase.geometry;
+  const auto config = TestCase.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nPointDomain = geometry.GetnPointDomain();
+
+  CSysMatrix<T> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, &geometry, config);
+
+  /*--- Diagonally dominant, non-symmetric, blocks. ---*/
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      const T a = -1 - T(0.1) * ((iPoint + 2 * jPoint) % 7);
+      const T block[] = {a, T(0.1) * a, T(0.2) * a, a};
+      matrix.SetBlock(iPoint, jPoint, block);
+    }
+    const T d = 20 + iPoint % 3;
+    const T block[] = {d, 1, -1, d};
+    matrix.SetBlock(iPoint, iPoint, block);
+  }
+
+  CSysVector<T> vec(nPoint, nPointDomain, nVar, 0.0), prod(nPoint, nPointDomain, nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) vec(iPoint, iVar) = 1 + T(0.5) * ((iPoint + iVar) % 5);
+
+  CSysVector<T> res(nPoint, nPointDomain, nVar, 0.0);
+
+  SU2_OMP_PARALLEL {
+    matrix.BuildILUPreconditioner();
+    matrix.ComputeILUPreconditioner(vec, prod, &geometry, config);
+
+    if (residual) {
+      matrix.MatrixVectorProduct(prod, res, &geometry, config);
+      res -= vec;
+      const su2double norm = res.norm();
+      SU2_OMP_MASTER
+      *residual = norm;
+      END_SU2_OMP_MASTER
+    }
+  }
+  END_SU2_OMP_PARALLEL
+
+  std::vector<T> result(nPointDomain * nVar);
+  for (auto i = 0ul; i < result.size(); ++i) result[i] = prod[i];
+  return result;
+}
+}  // namespace
+
+TEST_CASE("Level-scheduled ILU", "[LinearAlgebra]") {
+  for (const std::string fill : {"0", "1"}) {
+    const std::string common = "LINEAR_SOLVER_ILU_FILL_IN= " + fill + "\n";
+
+    /*--- One partition is the reference, then the levels must give the same result on any number of threads. ---*/
+    const auto ref = ApplyILU(common + "LINEAR_SOLVER_PREC_THREADS= 1");
+    const auto levels = ApplyILU(common + "LINEAR_SOLVER_ILU_LEVEL_SCHEDULING= YES");
+
+    REQUIRE(ref.size() == levels.size());
+    for (auto i = 0ul; i < ref.size(); ++i) CHECK(levels[i] == ref[i]);
+  }
+}
+
+TEST_CASE("Restricted additive Schwarz ILU", "[LinearAlgebra][MPI]") {
+  const std::string common = "LINEAR_SOLVER_PREC_THREADS= 1\nLINEAR_SOLVER_SCHWARZ_COARSE= NO\n";
+
+  /*--- Without overlap the ILU of each rank is the same as without Schwarz. ---*/
+  su2double resRef = 0, resOverlap = 0;
+  const auto ref = ApplyILU("LINEAR_SOLVER_PREC_THREADS= 1", &resRef);
+  const auto noOverlap = ApplyILU(common + "LINEAR_SOLVER_SCHWARZ_OVERLAP= 0");
+
+  REQUIRE(ref.size() == noOverlap.size());
+  for (auto i = 0ul; i < ref.size(); ++i) CHECK(noOverlap[i] == ref[i]);
+
+  /*--- With several ranks the overlap must improve the approximation of the inverse. ---*/
+  ApplyILU(common + "LINEAR_SOLVER_SCHWARZ_OVERLAP= 1", &resOverlap);
+  if (SU2_MPI::GetSize() > 1) CHECK(resOverlap < resRef);
+  else CHECK(resOverlap == resRef);
+}
@@ -0,0 +1,166 @@
+/*!
+ * \file CSysMatrix_formats_tests.cpp
+ * \brief Unit tests for the storage formats of CSysMatrix, compared with block-CSR.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <functional>
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+namespace {
+using T = su2mixedfloat;
+using Operation = std::function<void(CSysMatrix<T>&, const CSysVector<T>&, CSysVector<T>&, CGeometry*,
+                                     const CConfig*)>;
+
+/*!
+ * \brief Assemble a block matrix with the FVM pattern of the unit box, using the given options (storage format,
+ *        preconditioner, etc.), and apply an operation (product or preconditioner) to a vector.
+ * \param[in] symmetric - Symmetric values, except for some rows that only have the diagonal (Dirichlet rows).
+ * \return The domain values of the result.
+ */
+std::vector<T> Apply(const std::string& options, const Operation& op, bool symmetric = false) {
+  const unsigned short nVar = 2;
+
+  UnitQuadTestCase TestCase;
+  TestCase.AddOption(options);
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto& geometry = *TestCase.geometry;
+  const auto config = TestCase.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nPointDomain = geometry.GetnPointDomain();
+
+  CSysMatrix<T> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, &geometry, config);
+
+  /*--- Diagonally dominant blocks. ---*/
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      if (symmetric) {
+        const T a = -1 - T(0.1) * ((iPoint + jPoint) % 7);
+        const T block[] = {a, T(0.1) * a, T(0.1) * a, a};
+        matrix.SetBlock(iPoint, jPoint, block);
+      } else {
+        const T a = -1 - T(0.1) * ((iPoint + 2 * jPoint) % 7);
+        const T block[] = {a, T(0.1) * a, T(0.2) * a, a};
+        matrix.SetBlock(iPoint, jPoint, block);
+      }
+    }
+    const T d = 20 + iPoint % 3;
+    const T block[] = {d, 1, T(symmetric ? 1 : -1), d};
+    matrix.SetBlock(iPoint, iPoint, block);
+  }
+  if (symmetric) {
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint += 11) matrix.DeleteValsRowi(iPoint * nVar);
+  }
+
+  CSysVector<T> vec(nPoint, nPointDomain, nVar, 0.0), prod(nPoint, nPointDomain, nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) vec(iPoint, iVar) = 1 + T(0.5) * ((iPoint + iVar) % 5);
+
+  SU2_OMP_PARALLEL {
+    matrix.FinalizeStorage();
+    op(matrix, vec, prod, &geometry, config);
+  }
+  END_SU2_OMP_PARALLEL
+
+  std::vector<T> result(nPointDomain * nVar);
+  for (auto i = 0ul; i < result.size(); ++i) result[i] = prod[i];
+  return result;
+}
+
+/*!
+ * \brief The formats change the order of the operations, the results are compared with a tolerance.
+ */
+void CheckEqual(const std::vector<T>& ref, const std::vector<T>& val) {
+  REQUIRE(ref.size() == val.size());
+  for (auto i = 0ul; i < ref.size(); ++i) CHECK(double(val[i]) == Approx(double(ref[i])));
+}
+
+const Operation ProductOp = [](CSysMatrix<T>& A, const CSysVector<T>& x, CSysVector<T>& y, CGeometry* geometry,
+                               const CConfig* config) { A.MatrixVectorProduct(x, y, geometry, config); };
+
+const Operation JacobiOp = [](CSysMatrix<T>& A, const CSysVector<T>& x, CSysVector<T>& y, CGeometry* geometry,
+                              const CConfig* config) {
+  A.BuildJacobiPreconditioner();
+  A.ComputeJacobiPreconditioner(x, y, geometry, config);
+};
+
+const Operation LU_SGSOp = [](CSysMatrix<T>& A, const CSysVector<T>& x, CSysVector<T>& y, CGeometry* geometry,
+                              const CConfig* config) { A.ComputeLU_SGSPreconditioner(x, y, geometry, config); };
+
+const Operation ICOp = [](CSysMatrix<T>& A, const CSysVector<T>& x, CSysVector<T>& y, CGeometry* geometry,
+                          const CConfig* config) {
+  A.BuildICPreconditioner();
+  A.ComputeICPreconditioner(x, y, geometry, config);
+};
+}  // namespace
+
+TEST_CASE("SELL-C-sigma matrix format", "[LinearAlgebra]") {
+  const std::string common = "LINEAR_SOLVER_PREC= JACOBI\n";
+
+  for (const auto& op : {ProductOp, JacobiOp}) {
+    const auto ref = Apply(common + "LINEAR_SOLVER_MATRIX_FORMAT= BCSR", op);
+    const auto sell = Apply(common + "LINEAR_SOLVER_MATRIX_FORMAT= SELL", op);
+    CheckEqual(ref, sell);
+  }
+}
+
+TEST_CASE("Edge-based matrix format", "[LinearAlgebra]") {
+  /*--- Several threads (and partitions), to cover the edges between partitions. ---*/
+  const auto nThread = omp_get_max_threads();
+  omp_set_num_threads(4);
+  const std::string common = "LINEAR_SOLVER_PREC= LU_SGS\nLINEAR_SOLVER_PREC_THREADS= 4\n";
+
+  for (const auto& op : {ProductOp, LU_SGSOp}) {
+    const auto ref = Apply(common + "LINEAR_SOLVER_MATRIX_FORMAT= BCSR", op);
+    const auto edge = Apply(common + "LINEAR_SOLVER_MATRIX_FORMAT= EDGE", op);
+    CheckEqual(ref, edge);
+  }
+  omp_set_num_threads(nThread);
+}
+
+TEST_CASE("Symmetric matrix format", "[LinearAlgebra]") {
+  const auto nThread = omp_get_max_threads();
+  omp_set_num_threads(4);
+  const std::string common = "LINEAR_SOLVER= CONJUGATE_GRADIENT\nLINEAR_SOLVER_PREC_THREADS= 4\n";
+
+  /*--- Product of a symmetric matrix with Dirichlet rows. ---*/
+  const std::string format = "LINEAR_SOLVER_PREC= LU_SGS\nLINEAR_SOLVER_MATRIX_FORMAT= ";
+  const auto ref = Apply(common + format + "BCSR", ProductOp, true);
+  const auto sym = Apply(common + format + "SYMMETRIC", ProductOp, true);
+  CheckEqual(ref, sym);
+
+  /*--- With a non-symmetric matrix the IC preconditioner falls back to LU_SGS. ---*/
+  const auto lusgs = Apply(common + "LINEAR_SOLVER_PREC= LU_SGS", LU_SGSOp);
+  const auto ic = Apply(common + "LINEAR_SOLVER_PREC= IC", ICOp);
+  CheckEqual(lusgs, ic);
+
+  omp_set_num_threads(nThread);
+}
@@ -0,0 +1,104 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the Krylov solvers of CSysSolve.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+namespace {
+/*!
+ * \brief Solve a sequence of systems, whose matrix changes between solves, with the same CSysSolve object.
+ * \param[in] solver - Value of LINEAR_SOLVER.
+ * \return The number of iterations of each solve.
+ */
+std::vector<unsigned long> SolveSequence(const std::string& solver) {
+  using T = su2mixedfloat;
+  const unsigned short nVar = 2;
+  const unsigned long nSolve = 5;
+  const su2double tol = 1e-8;
+
+  UnitQuadTestCase TestCase;
+  TestCase.AddOption("LINEAR_SOLVER= " + solver);
+  TestCase.AddOption("LINEAR_SOLVER_PREC= JACOBI");
+  TestCase.AddOption("LINEAR_SOLVER_ERROR= 1e-8");
+  TestCase.AddOption("LINEAR_SOLVER_ITER= 200");
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto& geometry = *TestCase.geometry;
+  const auto config = TestCase.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nPointDomain = geometry.GetnPointDomain();
+
+  CSysMatrix<T> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, &geometry, config);
+
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) rhs(iPoint, iVar) = 1 + 0.5 * ((iPoint + iVar) % 5);
+
+  CSysSolve<T> system;
+  std::vector<unsigned long> iterations;
+
+  for (auto iSolve = 0ul; iSolve < nSolve; ++iSolve) {
+    /*--- Weakly diagonally dominant, non-symmetric, blocks, the diagonal grows with each solve. ---*/
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+        const T a = -1 - T(0.1) * ((iPoint + 2 * jPoint) % 7);
+        const T block[] = {a, T(0.1) * a, T(0.2) * a, a};
+        matrix.SetBlock(iPoint, jPoint, block);
+      }
+      const T d = 8 + T(0.5) * iSolve + iPoint % 3;
+      const T block[] = {d, 1, -1, d};
+      matrix.SetBlock(iPoint, iPoint, block);
+    }
+
+    sol.SetValZero();
+    system.SetxIsZero(true);
+
+    SU2_OMP_PARALLEL {
+      system.Solve(matrix, rhs, sol, &geometry, config);
+    }
+    END_SU2_OMP_PARALLEL
+
+    CHECK(system.GetResidual() < tol);
+    iterations.push_back(system.GetIterations());
+  }
+  return iterations;
+}
+}  // namespace
+
+TEST_CASE("Recycled FGMRES", "[LinearAlgebra]") {
+  const auto ref = SolveSequence("FGMRES");
+  const auto recycled = SolveSequence("RECYCLED_FGMRES");
+
+  /*--- Nothing to recycle in the first solve, then the corrections of the previous solves reduce the iterations. ---*/
+  REQUIRE(ref.size() == recycled.size());
+  CHECK(recycled[0] == ref[0]);
+  for (auto i = 1ul; i < ref.size(); ++i) CHECK(recycled[i] < ref[i]);
+}
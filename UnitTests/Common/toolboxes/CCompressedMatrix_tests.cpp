@@ -0,0 +1,91 @@
+/*!
+ * \file CCompressedMatrix_tests.cpp
+ * \brief Unit tests of the compact (lossy) storage of matrices.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
+#include "../../../Common/include/toolboxes/CCompressedMatrix.hpp"
+
+#include <cmath>
+
+namespace {
+su2passivematrix SmoothField(unsigned long nRows, unsigned long nCols) {
+  su2passivematrix mat(nRows, nCols);
+  for (auto i = 0ul; i < nRows; ++i) {
+    for (auto j = 0ul; j < nCols; ++j) mat(i, j) = (j + 1) * 100.0 + std::sin(0.01 * i * (j + 1)) + (j == 1 ? -1e-3 * i : 0);
+  }
+  return mat;
+}
+}  // namespace
+
+TEST_CASE("Lossless compressed matrix", "[Toolboxes]") {
+  const auto mat = SmoothField(1000, 5);
+  CCompressedMatrix compressed;
+  compressed.Compress(mat, 0.0);
+
+  su2passivematrix result(mat.rows(), mat.cols());
+  compressed.Decompress(result);
+
+  for (auto i = 0ul; i < mat.rows(); ++i)
+    for (auto j = 0ul; j < mat.cols(); ++j) REQUIRE(result(i, j) == mat(i, j));
+}
+
+TEST_CASE("Lossy compressed matrix", "[Toolboxes]") {
+  const auto mat = SmoothField(10000, 5);
+
+  for (const passivedouble relTol : {1e-3, 1e-6, 1e-10}) {
+    CCompressedMatrix compressed;
+    compressed.Compress(mat, relTol);
+    CHECK(compressed.GetMemory() < mat.size() * sizeof(passivedouble));
+
+    su2passivematrix result(mat.rows(), mat.cols());
+    compressed.Decompress(result);
+
+    for (auto j = 0ul; j < mat.cols(); ++j) {
+      passivedouble minVal = mat(0, j), maxVal = mat(0, j), maxErr = 0;
+      for (auto i = 0ul; i < mat.rows(); ++i) {
+        minVal = std::min(minVal, mat(i, j));
+        maxVal = std::max(maxVal, mat(i, j));
+        maxErr = std::max(maxErr, std::abs(result(i, j) - mat(i, j)));
+      }
+      /*--- Allow for the round-off of the reconstruction. ---*/
+      REQUIRE(maxErr <= relTol * (maxVal - minVal) * (1 + 1e-9) + 1e-12 * maxVal);
+    }
+  }
+}
+
+TEST_CASE("Lossy compressed constant matrix", "[Toolboxes]") {
+  su2passivematrix mat(100, 3);
+  mat = 42.0;
+  CCompressedMatrix compressed;
+  compressed.Compress(mat, 1e-6);
+
+  su2passivematrix result(mat.rows(), mat.cols());
+  compressed.Decompress(result);
+  for (auto i = 0ul; i < mat.rows(); ++i)
+    for (auto j = 0ul; j < mat.cols(); ++j) REQUIRE(result(i, j) == 42.0);
+  CHECK(compressed.GetMemory() < 400);
+}
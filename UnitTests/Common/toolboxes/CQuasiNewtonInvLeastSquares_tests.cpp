@@ -70,3 +70,19 @@ TEST_CASE("QN-ILS", "[Toolboxes]") {
 
   for (int i = 0; i < Problem::N; ++i) CHECK(qnils(i, 0) == Approx(1.0));
 }
+
+TEST_CASE("QN-ILS filtered", "[Toolboxes]") {
+  Problem p;
+  CQuasiNewtonInvLeastSquares<passivedouble> qnils(Problem::N + 1, Problem::N, 1);
+  qnils.setFilterTolerance(1e-6);
+
+  /*--- Filtering independent samples does not change the convergence. ---*/
+  for (int i = 0; i <= Problem::N; ++i) iterate(p, qnils);
+
+  for (int i = 0; i < Problem::N; ++i) CHECK(qnils(i, 0) == Approx(1.0));
+
+  /*--- Once converged the samples become linearly dependent, they must be discarded. ---*/
+  for (int i = 0; i <= Problem::N; ++i) iterate(p, qnils);
+
+  for (int i = 0; i < Problem::N; ++i) CHECK(qnils(i, 0) == Approx(1.0));
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file HilbertIndex_tests.cpp
+ * \brief Unit tests of the Hilbert curve index (geometric partitioning).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+namespace {
+/*!
+ * \brief Check that the curve visits all the points of a lattice, in steps of one lattice spacing.
+ */
+void CheckLattice(int nDim, unsigned bits) {
+  const uint32_t n = uint32_t(1) << bits;
+  const uint64_t nPoint = uint64_t(1) << (nDim * bits);
+
+  std::vector<std::vector<uint32_t> > pointOfIndex(nPoint);
+
+  for (uint64_t iPoint = 0; iPoint < nPoint; ++iPoint) {
+    std::vector<uint32_t> point(nDim), lattice(nDim);
+    for (int iDim = 0; iDim < nDim; ++iDim) point[iDim] = (iPoint >> (iDim * bits)) % n;
+    lattice = point;
+    const auto index = GeometryToolbox::HilbertIndex(nDim, lattice.data(), bits);
+    REQUIRE(index < nPoint);
+    REQUIRE(pointOfIndex[index].empty());
+    pointOfIndex[index] = point;
+  }
+
+  for (uint64_t index = 1; index < nPoint; ++index) {
+    int distance = 0;
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      distance += std::abs(int(pointOfIndex[index][iDim]) - int(pointOfIndex[index - 1][iDim]));
+    }
+    CHECK(distance == 1);
+  }
+}
+}  // namespace
+
+TEST_CASE("Hilbert curve 2D", "[Toolboxes]") { CheckLattice(2, 4); }
+
+TEST_CASE("Hilbert curve 3D", "[Toolboxes]") { CheckLattice(3, 3); }
@@ -83,3 +83,45 @@ TEST_CASE("SIMD DOUBLE", "[Vectorization]") {
     CHECK(t[k] == 7);
   }
 }
+
+TEST_CASE("SIMD GATHER SCATTER", "[Vectorization]") {
+  /*--- Indexed access, explicitly vectorized on some architectures (e.g. SVE). ---*/
+  using Double = simd::Array<double>;
+  using Int = simd::Array<unsigned long, Double::Size>;
+
+  vector<double> data(4 * Double::Size);
+  for (size_t i = 0; i < data.size(); ++i) data[i] = i;
+
+  /*--- Reverse order with a stride of 3. ---*/
+  Int idx;
+  for (size_t k = 0; k < Int::Size; ++k) idx[k] = 3 * (Int::Size - 1 - k);
+
+  Double x(data.data(), idx);
+  for (size_t k = 0; k < Double::Size; ++k) {
+    CHECK(x[k] == data[idx[k]]);
+  }
+
+  vector<double> out(data.size(), -1.0);
+  (2 * x).scatter(out.data(), idx);
+  for (size_t i = 0; i < out.size(); ++i) {
+    CHECK(out[i] == (i % 3 == 0 && i / 3 < Double::Size ? 2.0 * i : -1.0));
+  }
+}
+
+TEST_CASE("SIMD MASKS", "[Vectorization]") {
+  /*--- Comparisons produce 0 or 1 per lane, which are used to blend values. ---*/
+  using Double = simd::Array<double>;
+
+  const Double x(-1.0, 1.0), zero = 0.0;
+  const Double pos = x > zero, neg = x < zero, nz = x != zero;
+  const Double blend = pos * sqrt(abs(x)) + (1 - pos) * x;
+
+  for (size_t k = 0; k < Double::Size; ++k) {
+    const double xk = -1.0 + k;
+    CHECK(pos[k] == (xk > 0));
+    CHECK(neg[k] == (xk < 0));
+    CHECK(nz[k] == (xk != 0));
+    CHECK(sign(x)[k] == (xk < 0 ? -1 : 1));
+    CHECK(blend[k] == (xk > 0 ? sqrt(xk) : xk));
+  }
+}
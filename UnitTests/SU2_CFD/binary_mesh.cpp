@@ -0,0 +1,122 @@
+/*!
+ * \file binary_mesh.cpp
+ * \brief Round-trip unit test of the SU2 binary mesh format (writer and reader).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "../UnitQuadTestCase.hpp"
+#include "../../Common/include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CSU2MeshFileWriter.hpp"
+
+namespace {
+/*!
+ * \brief Config that only reads the given mesh.
+ */
+std::unique_ptr<CConfig> MeshConfig(const std::string& format, const std::string& filename) {
+  UnitQuadTestCase TestCase;
+  auto& options = TestCase.config_options;
+  options.replace(options.find("MESH_FORMAT= BOX"), 16, "MESH_FORMAT= " + format);
+  TestCase.AddOption("MESH_FILENAME= " + filename);
+  TestCase.InitConfig();
+  return std::move(TestCase.config);
+}
+}  // namespace
+
+TEST_CASE("SU2 binary mesh round-trip", "[MeshIO]") {
+  UnitQuadTestCase TestCase;
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto geometry = TestCase.geometry.get();
+  auto config = TestCase.config.get();
+  const auto nDim = geometry->GetnDim();
+
+  /*--- Boundary information, as written by SU2_DEF (single rank, local = global indices). ---*/
+  {
+    ofstream boundary_file("boundary.dat");
+    boundary_file << "NMARK= " << geometry->GetnMarker() << "\n";
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); iMarker++) {
+      boundary_file << "MARKER_TAG= " << config->GetMarker_All_TagBound(iMarker) << "\n";
+      boundary_file << "MARKER_ELEMS= " << geometry->GetnElem_Bound(iMarker) << "\n";
+      boundary_file << "SEND_TO= " << config->GetMarker_All_SendRecv(iMarker) << "\n";
+      for (auto iElem = 0ul; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+        const auto elem = geometry->bound[iMarker][iElem];
+        boundary_file << elem->GetVTK_Type() << "\t";
+        for (auto iNode = 0u; iNode < elem->GetnNodes(); iNode++) boundary_file << elem->GetNode(iNode) << "\t";
+        boundary_file << iElem << "\n";
+      }
+    }
+  }
+
+  /*--- Write the mesh in both formats. ---*/
+
+  vector<string> fieldNames = {"x", "y", "z"};
+  fieldNames.resize(nDim);
+  CFVMDataSorter sorter(config, geometry, fieldNames);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++) sorter.SetUnsortedData(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+  sorter.SortOutputData();
+  sorter.SortConnectivity(config, geometry, true);
+
+  const string filename = "binary_mesh_test";
+  CSU2MeshFileWriter(&sorter, 0, 1, false).WriteData(filename);
+  CSU2MeshFileWriter(&sorter, 0, 1, true).WriteData(filename);
+
+  /*--- Read both and compare. ---*/
+
+  auto asciiConfig = MeshConfig("SU2", filename + CSU2MeshFileWriter::fileExt);
+  auto binaryConfig = MeshConfig("SU2_BINARY", filename + CSU2MeshFileWriter::fileExtBinary);
+
+  CSU2ASCIIMeshReaderFVM ascii(asciiConfig.get(), 0, 1);
+  CSU2BinaryMeshReaderFVM binary(binaryConfig.get(), 0, 1);
+
+  REQUIRE(binary.GetDimension() == ascii.GetDimension());
+  REQUIRE(binary.GetNumberOfGlobalPoints() == ascii.GetNumberOfGlobalPoints());
+  REQUIRE(binary.GetNumberOfLocalPoints() == ascii.GetNumberOfLocalPoints());
+  REQUIRE(binary.GetNumberOfGlobalElements() == ascii.GetNumberOfGlobalElements());
+  REQUIRE(binary.GetNumberOfLocalElements() == ascii.GetNumberOfLocalElements());
+  REQUIRE(binary.GetNumberOfMarkers() == ascii.GetNumberOfMarkers());
+
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    const auto& x0 = ascii.GetLocalPointCoordinates()[iDim];
+    const auto& x1 = binary.GetLocalPointCoordinates()[iDim];
+    for (auto iPoint = 0ul; iPoint < x0.size(); iPoint++) CHECK(x1[iPoint] == Approx(x0[iPoint]));
+  }
+
+  CHECK(binary.GetLocalVolumeElementConnectivity() == ascii.GetLocalVolumeElementConnectivity());
+
+  for (auto iMarker = 0ul; iMarker < ascii.GetNumberOfMarkers(); iMarker++) {
+    CHECK(binary.GetMarkerNames()[iMarker] == ascii.GetMarkerNames()[iMarker]);
+    CHECK(binary.GetSurfaceElementConnectivityForMarker(iMarker) ==
+          ascii.GetSurfaceElementConnectivityForMarker(iMarker));
+  }
+
+  std::remove("boundary.dat");
+  std::remove((filename + CSU2MeshFileWriter::fileExt).c_str());
+  std::remove((filename + CSU2MeshFileWriter::fileExtBinary).c_str());
+}
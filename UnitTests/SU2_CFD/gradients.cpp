@@ -31,6 +31,7 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsAndLimiters.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -116,6 +117,19 @@ struct LinearFunction : public GradientTestBase {
   su2double grad(unsigned long, unsigned long, unsigned long iDim) const { return slope[iDim]; }
 };
 
+struct NonlinearFunction : public GradientTestBase {
+  const unsigned long nVar = 2;
+
+  /*!
+   * \brief Return manufactured value, with a steep front to activate the limiters.
+   */
+  su2double operator()(unsigned long iPoint, unsigned long iVar) const {
+    const auto coord = geometry->nodes->GetCoord(iPoint);
+    if (iVar == 0) return sin(4 * coord[0]) * cos(3 * coord[1]) + pow(coord[2], 2);
+    return tanh(10 * (coord[0] + coord[1] - 1));
+  }
+};
+
 template <class T, class U>
 void check(const T& ref, const U& calc, su2double tol = 1e-9) {
   su2double err = 0.0;
@@ -154,3 +168,83 @@ TEST_CASE("GG", "[Gradients]") { testGreenGauss<LinearFunction>(); }
 TEST_CASE("LS", "[Gradients]") { testLeastSquares<LinearFunction>(false); }
 
 TEST_CASE("WLS", "[Gradients]") { testLeastSquares<LinearFunction>(true); }
+
+TEST_CASE("WLS after grid update", "[Gradients]") {
+  /*--- The precomputed least-squares weights must be refreshed when the dual grid is updated. ---*/
+  LinearFunction field;
+  auto& geometry = *field.geometry.get();
+  const auto nDim = geometry.GetnDim();
+  C3DDoubleMatrix R(geometry.GetnPoint(), nDim, nDim);
+  C3DDoubleMatrix gradient(geometry.GetnPoint(), field.nVar, nDim);
+
+  computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, *field.config.get(), true, field, 0,
+                               field.nVar, gradient, R);
+  check(field, gradient);
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const auto x = geometry.nodes->GetCoord(iPoint, 0);
+    geometry.nodes->AddCoord(iPoint, 1, 0.02 * sin(PI_NUMBER * x));
+  }
+  geometry.SetControlVolume(field.config.get(), UPDATE);
+
+  computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, *field.config.get(), true, field, 0,
+                               field.nVar, gradient, R);
+  check(field, gradient);
+}
+
+template <class TestField>
+void testFusedGradientsAndLimiters(unsigned short kindGradient, LIMITER kindLimiter) {
+  TestField func;
+  auto& geometry = *func.geometry.get();
+  auto& config = *func.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+  su2activematrix field(nPoint, func.nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < func.nVar; ++iVar) field(iPoint, iVar) = func(iPoint, iVar);
+
+  C3DDoubleMatrix R(nPoint, nDim, nDim);
+  C3DDoubleMatrix gradRef(nPoint, func.nVar, nDim), grad(nPoint, func.nVar, nDim);
+  su2activematrix minRef(nPoint, func.nVar), maxRef(nPoint, func.nVar), limRef(nPoint, func.nVar);
+  su2activematrix min(nPoint, func.nVar), max(nPoint, func.nVar), lim(nPoint, func.nVar);
+
+  /*--- Separate passes. ---*/
+
+  if (kindGradient == GREEN_GAUSS) {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, field, 0, func.nVar, gradRef);
+  } else {
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, weighted, field, 0, func.nVar,
+                                 gradRef, R);
+  }
+  computeLimiters(kindLimiter, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE, geometry, config, 0,
+                  func.nVar, field, gradRef, minRef, maxRef, limRef);
+
+  /*--- Fused pass, the results must be identical. ---*/
+
+  computeGradientsAndLimiters(nullptr, SOLUTION_LIMITER, geometry, config, kindGradient, kindLimiter, field, 0,
+                              func.nVar, grad, R, min, max, lim);
+
+  su2double err = 0.0, minLim = 1.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < func.nVar; ++iVar) {
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        err = std::max(err, abs(grad(iPoint, iVar, iDim) - gradRef(iPoint, iVar, iDim)));
+      err = std::max(err, abs(min(iPoint, iVar) - minRef(iPoint, iVar)));
+      err = std::max(err, abs(max(iPoint, iVar) - maxRef(iPoint, iVar)));
+      err = std::max(err, abs(lim(iPoint, iVar) - limRef(iPoint, iVar)));
+      minLim = std::min(minLim, limRef(iPoint, iVar));
+    }
+  }
+  CHECK(err == 0.0);
+  CHECK(minLim < 1.0);
+}
+
+TEST_CASE("Fused GG and limiters", "[Gradients]") {
+  testFusedGradientsAndLimiters<NonlinearFunction>(GREEN_GAUSS, LIMITER::BARTH_JESPERSEN);
+}
+
+TEST_CASE("Fused WLS and limiters", "[Gradients]") {
+  testFusedGradientsAndLimiters<NonlinearFunction>(WEIGHTED_LEAST_SQUARES, LIMITER::VENKATAKRISHNAN);
+}
@@ -0,0 +1,70 @@
+/*!
+ * \file jacobian_lag.cpp
+ * \brief Unit tests for the decision of when the lagged edge Jacobian is assembled.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../SU2_CFD/include/solvers/CJacobianLag.hpp"
+
+TEST_CASE("Jacobian lag, steady", "[JacobianLag]") {
+  CJacobianLag lag;
+  const unsigned long nLag = 3;
+  const su2double factor = 2.0, cfl = 10.0;
+
+  /*--- Decreasing residual at constant CFL, assembled every nLag iterations. ---*/
+  su2double res = 1.0;
+  for (unsigned long iter = 0; iter < 10; ++iter) {
+    CHECK(lag.Lag(0, iter, nLag, factor, cfl, res) == (iter % nLag != 0));
+    res *= 0.5;
+  }
+  /*--- Last assembly at 9. ---*/
+  CHECK(lag.Lag(0, 10, nLag, factor, cfl, res * 2));
+  CHECK_FALSE(lag.Lag(0, 11, nLag, factor, cfl, res * 4));      // residual increased
+  CHECK(lag.Lag(0, 12, nLag, factor, 1.5 * cfl, res));          // within the CFL factor
+  CHECK_FALSE(lag.Lag(0, 13, nLag, factor, 2.5 * cfl, res));    // CFL increased
+  CHECK_FALSE(lag.Lag(0, 14, nLag, factor, 1.2 * cfl / factor, res));  // CFL decreased
+}
+
+TEST_CASE("Jacobian lag, unsteady", "[JacobianLag]") {
+  CJacobianLag lag;
+  /*--- More lagged iterations than inner iterations, the assembly is only triggered by new time steps. ---*/
+  const unsigned long nLag = 10, nInner = 3;
+  const su2double factor = 2.0, cfl = 10.0;
+
+  su2double res = 1.0;
+  for (unsigned long timeIter = 0; timeIter < 4; ++timeIter) {
+    for (unsigned long iter = 0; iter < nInner; ++iter) {
+      CHECK(lag.Lag(timeIter, iter, nLag, factor, cfl, res) == (iter != 0));
+      res *= 0.5;
+    }
+  }
+
+  /*--- Single inner iteration per time step, the last assembly is always at inner iteration 0. ---*/
+  for (unsigned long timeIter = 4; timeIter < 8; ++timeIter) {
+    CHECK_FALSE(lag.Lag(timeIter, 0, nLag, factor, cfl, res));
+    res *= 0.5;
+  }
+}
@@ -0,0 +1,146 @@
+/*!
+ * \file CJSTAdjointKernel_tests.cpp
+ * \brief Unit tests for the hand-differentiated JST flux.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/flow/convection/centered_adjoint.hpp"
+
+namespace {
+using Kernel = CJSTAdjointKernel<3>;
+
+/*!
+ * \brief Pointers to the inputs of an edge, to perturb them one at a time.
+ */
+template<class T>
+std::vector<T*> AllInputs(Kernel::Data<T>& d) {
+  std::vector<T*> ptrs;
+  for (int k = 0; k < 2; ++k) {
+    for (auto& x : d.V[k]) ptrs.push_back(&x);
+    for (auto& x : d.lapl[k]) ptrs.push_back(&x);
+    ptrs.push_back(&d.sensor[k]);
+    ptrs.push_back(&d.lambda[k]);
+  }
+  for (auto& x : d.normal) ptrs.push_back(&x);
+  return ptrs;
+}
+
+/*!
+ * \brief A physically reasonable edge state, varied with "seed".
+ */
+Kernel::Data<double> EdgeState(double seed) {
+  Kernel::Data<double> d;
+  for (int k = 0; k < 2; ++k) {
+    const double s = seed + 0.3 * k;
+    const double rho = 1.1 + 0.1 * s, p = 1e5 * (1 + 0.05 * s), u[] = {60 + 5 * s, -20 + 3 * s, 10 - 2 * s};
+    const double c = std::sqrt(1.4 * p / rho), h = c * c / 0.4 + 0.5 * (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    d.V[k][0] = p / (287 * rho);
+    for (int iDim = 0; iDim < 3; ++iDim) d.V[k][1 + iDim] = u[iDim];
+    d.V[k][4] = p;
+    d.V[k][5] = rho;
+    d.V[k][6] = h;
+    d.V[k][7] = c;
+    for (size_t iVar = 0; iVar < Kernel::nVar; ++iVar) d.lapl[k][iVar] = (0.01 + 0.02 * iVar - 0.015 * k) * (1 + s);
+    d.sensor[k] = 0.02 + 0.01 * s * (1 + k);
+    d.lambda[k] = (1.2 + 0.1 * k + 0.05 * s) * 500;
+  }
+  d.normal[0] = 0.3 + 0.1 * seed;
+  d.normal[1] = -0.2;
+  d.normal[2] = 0.15 - 0.05 * seed;
+  return d;
+}
+
+const Kernel::Coefficients coefs{0.5, 0.02, 0.3};
+const double nNeighbor[] = {6, 7};
+const double flux_b[] = {0.7, -0.3, 0.2, 1.1, -0.5};
+
+double Objective(const Kernel::Data<double>& d) {
+  double flux[Kernel::nVar];
+  Kernel::Flux(coefs, d, nNeighbor, flux);
+  double obj = 0;
+  for (size_t iVar = 0; iVar < Kernel::nVar; ++iVar) obj += flux_b[iVar] * flux[iVar];
+  return obj;
+}
+}  // namespace
+
+TEST_CASE("JST adjoint kernel matches finite differences", "[Adjoint numerics]") {
+  for (const double seed : {0.0, 1.0, -1.5}) {
+    auto state = EdgeState(seed);
+
+    Kernel::Data<double> state_b;
+    for (auto* x : AllInputs(state_b)) *x = 0.0;
+    Kernel::Reverse(coefs, state, nNeighbor, flux_b, state_b);
+
+    const auto inputs = AllInputs(state);
+    const auto adjoints = AllInputs(state_b);
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      const double x0 = *inputs[i];
+      const double h = 1e-4 * std::max(1.0, std::abs(x0));
+      *inputs[i] = x0 + h;
+      const double fp = Objective(state);
+      *inputs[i] = x0 - h;
+      const double fm = Objective(state);
+      *inputs[i] = x0;
+
+      const double fd = (fp - fm) / (2 * h);
+      CHECK(*adjoints[i] == Approx(fd).epsilon(1e-5).margin(1e-5));
+    }
+  }
+}
+
+TEST_CASE("JST adjoint kernel with SIMD types", "[Adjoint numerics]") {
+  using Dbl = simd::Array<double>;
+  constexpr size_t N = Dbl::Size;
+
+  /*--- Lane k gets the state of seed k, the results must match the scalar ones. ---*/
+
+  Kernel::Data<Dbl> state, state_b;
+  for (auto* x : AllInputs(state_b)) *x = 0.0;
+  for (size_t k = 0; k < N; ++k) {
+    auto lane = EdgeState(k);
+    const auto src = AllInputs(lane);
+    const auto dst = AllInputs(state);
+    for (size_t i = 0; i < src.size(); ++i) (*dst[i])[k] = *src[i];
+  }
+  Dbl nNeighborSIMD[] = {nNeighbor[0], nNeighbor[1]};
+  Dbl flux_bSIMD[Kernel::nVar];
+  for (size_t iVar = 0; iVar < Kernel::nVar; ++iVar) flux_bSIMD[iVar] = flux_b[iVar];
+
+  Kernel::Reverse(coefs, state, nNeighborSIMD, flux_bSIMD, state_b);
+
+  for (size_t k = 0; k < N; ++k) {
+    auto lane = EdgeState(k);
+    Kernel::Data<double> lane_b;
+    for (auto* x : AllInputs(lane_b)) *x = 0.0;
+    Kernel::Reverse(coefs, lane, nNeighbor, flux_b, lane_b);
+
+    const auto ref = AllInputs(lane_b);
+    const auto res = AllInputs(state_b);
+    for (size_t i = 0; i < ref.size(); ++i) CHECK((*res[i])[k] == Approx(*ref[i]));
+  }
+}
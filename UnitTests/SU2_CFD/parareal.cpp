@@ -0,0 +1,89 @@
+/*!
+ * \file parareal.cpp
+ * \brief Unit tests of the Parareal iteration with a model problem.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../SU2_CFD/include/drivers/CParareal.hpp"
+
+namespace {
+/*!
+ * \brief Backward Euler steps of a damped oscillator, y' = A y.
+ */
+CParareal::Propagator Propagator(unsigned long nSteps, passivedouble dt) {
+  return [=](CParareal::State& y) {
+    const passivedouble a = -0.5, b = 4.0;  // A = [a b; -b a]
+    for (auto iStep = 0ul; iStep < nSteps; ++iStep) {
+      /*--- (I - dt A) y_new = y ---*/
+      const passivedouble d = 1 - dt * a, det = d * d + dt * dt * b * b;
+      const passivedouble y0 = (d * y[0] + dt * b * y[1]) / det;
+      const passivedouble y1 = (d * y[1] - dt * b * y[0]) / det;
+      y[0] = y0;
+      y[1] = y1;
+    }
+  };
+}
+
+#ifdef HAVE_MPI
+const SU2_Comm selfComm = MPI_COMM_SELF;
+#else
+const SU2_Comm selfComm = 0;
+#endif
+}  // namespace
+
+TEST_CASE("Parareal iteration", "[Parareal][MPI]") {
+  /*--- Each rank is a slice of 40 fine steps, the coarse propagator takes 4 steps. ---*/
+  const auto fine = Propagator(40, 0.01);
+  const auto coarse = Propagator(4, 0.1);
+  const CParareal::State initial = {1.0, 0.0};
+
+  SECTION("Without tolerance the serial fine solution is recovered") {
+    CParareal parareal(selfComm, SU2_MPI::GetComm(), 100, 0.0);
+    const auto iSlice = parareal.GetSlice();
+
+    auto start = initial;
+    const auto nIter = parareal.Solve(start, coarse, fine);
+    CHECK(nIter == static_cast<unsigned long>(parareal.GetnSlices() - 1));
+
+    auto reference = initial;
+    for (int i = 0; i < iSlice; ++i) fine(reference);
+    CHECK(start[0] == Approx(reference[0]).margin(1e-12));
+    CHECK(start[1] == Approx(reference[1]).margin(1e-12));
+  }
+
+  SECTION("The iteration stops at the tolerance") {
+    CParareal parareal(selfComm, SU2_MPI::GetComm(), 100, 1e-3);
+    auto start = initial;
+    const auto nIter = parareal.Solve(start, coarse, fine);
+    CHECK(nIter <= static_cast<unsigned long>(parareal.GetnSlices() - 1));
+    if (nIter < static_cast<unsigned long>(parareal.GetnSlices() - 1)) CHECK(parareal.GetChange() < 1e-3);
+
+    /*--- The coarse propagator is a good approximation, the start states are close to the fine solution. ---*/
+    auto reference = initial;
+    for (int i = 0; i < parareal.GetSlice(); ++i) fine(reference);
+    CHECK(start[0] == Approx(reference[0]).margin(0.05));
+    CHECK(start[1] == Approx(reference[1]).margin(0.05));
+  }
+}
@@ -0,0 +1,142 @@
+/*!
+ * \file time_series.cpp
+ * \brief Round-trip unit tests of the SU2 restart time series (delta-encoded steps).
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
+
+namespace {
+/*!
+ * \brief Bit for bit comparison of values.
+ */
+bool SameBits(const passivedouble* a, const passivedouble* b, unsigned long n) {
+  return memcmp(a, b, n * sizeof(passivedouble)) == 0;
+}
+}  // namespace
+
+TEST_CASE("Time series block encoding", "[TimeSeries]") {
+  using limits = std::numeric_limits<passivedouble>;
+  const vector<passivedouble> ref = {1.0, -2.5, 0.0, 3.0e-300, 1.0e10, -0.0, 7.0, 0.1, 0.2};
+  const vector<passivedouble> data = {1.0, -2.5000001, -0.0, limits::denorm_min(), limits::infinity(),
+                                      limits::quiet_NaN(), 7.0 + 1e-15, 0.3, -limits::max()};
+  const auto nVal = data.size();
+
+  /*--- Full frame (no reference) and delta (with reference). ---*/
+  for (const auto* r : {static_cast<const passivedouble*>(nullptr), ref.data()}) {
+    vector<uint8_t> block;
+    CSU2TimeSeriesFileWriter::EncodeBlock(data.data(), r, nVal, block);
+
+    vector<passivedouble> decoded(nVal, 0.0);
+    if (r) decoded = ref;
+    REQUIRE(CSU2TimeSeriesFileWriter::DecodeBlock(block.data(), block.size(), nVal, decoded.data()));
+    CHECK(SameBits(decoded.data(), data.data(), nVal));
+
+    /*--- Truncated blocks are detected. ---*/
+    CHECK_FALSE(CSU2TimeSeriesFileWriter::DecodeBlock(block.data(), block.size() - 1, nVal, decoded.data()));
+  }
+
+  /*--- Values equal to the reference take only the nibble of their size. ---*/
+  vector<uint8_t> block;
+  CSU2TimeSeriesFileWriter::EncodeBlock(ref.data(), ref.data(), nVal, block);
+  CHECK(block.size() == (nVal + 1) / 2);
+}
+
+TEST_CASE("Time series restart round-trip", "[TimeSeries]") {
+  UnitQuadTestCase TestCase;
+  TestCase.InitConfig();
+  TestCase.InitGeometry();
+
+  auto geometry = TestCase.geometry.get();
+  auto config = TestCase.config.get();
+
+  const vector<string> fieldNames = {"x", "Density", "Energy"};
+  const unsigned long nFields = fieldNames.size();
+  CFVMDataSorter sorter(config, geometry, fieldNames);
+
+  /*--- Sorts the values of a step (the offset distinguishes rewritten steps), returns a copy. ---*/
+  auto SetStep = [&](unsigned long step, passivedouble offset) {
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      sorter.SetUnsortedData(iPoint, 0, geometry->nodes->GetCoord(iPoint, 0));
+      sorter.SetUnsortedData(iPoint, 1, 1.2 + offset + 0.01 * step * (iPoint % 5));
+      sorter.SetUnsortedData(iPoint, 2, std::sin(0.1 * step + iPoint) + offset);
+    }
+    sorter.SortOutputData();
+    return vector<passivedouble>(sorter.GetData(), sorter.GetData() + sorter.GetnPoints() * nFields);
+  };
+
+  const string series = "unit_time_series";
+  const string fileName = series + CSU2TimeSeriesFileWriter::fileExt;
+  auto StepName = [&](unsigned long step) { return series + "_" + std::to_string(step); };
+
+  /*--- Steps 0 to 6 with a full frame every 3 steps (0, 3, 6). ---*/
+  const unsigned long nSteps = 7, keyFrames = 3;
+  vector<vector<passivedouble> > expected(nSteps);
+  {
+    CSU2TimeSeriesFileWriter writer(&sorter, keyFrames);
+    for (auto step = 0ul; step < nSteps; ++step) {
+      expected[step] = SetStep(step, 0);
+      writer.WriteData(StepName(step));
+    }
+  }
+
+  /*--- Restart from step 4, rewriting steps 4 and 5 with other values, the newest records are read. ---*/
+  {
+    CSU2TimeSeriesFileWriter writer(&sorter, keyFrames);
+    for (auto step = 4ul; step < 6; ++step) {
+      expected[step] = SetStep(step, 0.5);
+      writer.WriteData(StepName(step));
+    }
+  }
+
+  unsigned long nPointFile = 0;
+  vector<string> names;
+  CSU2TimeSeriesFileWriter::ReadHeader(fileName, nPointFile, names);
+  CHECK(nPointFile == sorter.GetnPointsGlobal());
+  CHECK(names == fieldNames);
+
+  /*--- Each rank reads its sorted points. ---*/
+  const auto firstPoint = sorter.GetnPointCumulative(SU2_MPI::GetRank());
+  vector<unsigned long> points(sorter.GetnPoints());
+  for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) points[iPoint] = firstPoint + iPoint;
+
+  for (auto step = 0ul; step < nSteps; ++step) {
+    unsigned long nFieldsFile = 0;
+    vector<passivedouble> data;
+    CSU2TimeSeriesFileWriter::ReadStep(fileName, step, points, nFieldsFile, data);
+    REQUIRE(nFieldsFile == nFields);
+    REQUIRE(data.size() == expected[step].size());
+    CHECK(SameBits(data.data(), expected[step].data(), data.size()));
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) std::remove(fileName.c_str());
+}
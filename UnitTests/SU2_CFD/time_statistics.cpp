@@ -0,0 +1,117 @@
+/*!
+ * \file time_statistics.cpp
+ * \brief Unit tests for the streaming time statistics.
+ * \author SU2 Contributors
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../SU2_CFD/include/output/tools/CTimeStatistics.hpp"
+
+namespace {
+/*--- Two points, quantities a = sin(w t) + 1 and b = 2 cos(w t) at point 0, and their negatives at point 1. ---*/
+constexpr unsigned long nStep = 64, period = 16;
+const passivedouble pi = std::acos(-1.0), dt = 0.01, freq = 1 / (period * dt);
+
+void Signal(unsigned long iter, passivedouble* values) {
+  const passivedouble arg = 2 * pi * freq * iter * dt;
+  values[0] = std::sin(arg) + 1;
+  values[1] = 2 * std::cos(arg);
+  values[2] = -values[0];
+  values[3] = -values[1];
+}
+
+void Advance(CTimeStatistics& stats, unsigned long first, unsigned long last) {
+  passivedouble values[4];
+  for (auto iter = first; iter < last; ++iter) {
+    if (!stats.BeginStep(iter, iter * dt)) continue;
+    Signal(iter, values);
+    stats.Update(0, values);
+    stats.Update(1, values + 2);
+  }
+}
+
+void Initialize(CTimeStatistics& stats) {
+  stats.Initialize(2, {"a", "b"}, {{0, 1}}, 4, period, {freq, 2 * freq});
+}
+}  // namespace
+
+TEST_CASE("Time statistics", "[Output]") {
+  CTimeStatistics stats;
+  Initialize(stats);
+  Advance(stats, 0, nStep);
+
+  /*--- Repeated time iterations are ignored. ---*/
+  CHECK_FALSE(stats.BeginStep(nStep - 1, 0.0));
+  CHECK(stats.GetnSample() == nStep);
+
+  /*--- Over whole periods: means, variances (half of the squared amplitudes), no covariance. ---*/
+  for (unsigned long iPoint = 0; iPoint < 2; ++iPoint) {
+    const passivedouble sign = iPoint == 0 ? 1 : -1;
+    CHECK(stats.GetMean(0, iPoint) == Approx(sign));
+    CHECK(stats.GetMean(1, iPoint) == Approx(0).margin(1e-12));
+    CHECK(stats.GetVariance(0, iPoint) == Approx(0.5));
+    CHECK(stats.GetVariance(1, iPoint) == Approx(2.0));
+    CHECK(stats.GetCovariance(0, iPoint) == Approx(0).margin(1e-12));
+
+    /*--- Amplitudes at the frequency of the signal, and none at its harmonic. ---*/
+    CHECK(stats.GetAmplitude(0, 0, iPoint) == Approx(1.0));
+    CHECK(stats.GetAmplitude(0, 1, iPoint) == Approx(2.0));
+    CHECK(stats.GetAmplitude(1, 0, iPoint) == Approx(0).margin(1e-12));
+  }
+
+  /*--- Phase averages are the means over the iterations of each quarter of the period. ---*/
+  for (unsigned long p = 0; p < 4; ++p) {
+    passivedouble mean = 0, values[4];
+    for (unsigned long i = 0; i < period / 4; ++i) {
+      Signal(p * period / 4 + i, values);
+      mean += values[0] / (period / 4);
+    }
+    CHECK(stats.GetPhaseMean(p, 0, 0) == Approx(mean));
+  }
+}
+
+TEST_CASE("Time statistics restart", "[Output]") {
+  CTimeStatistics reference, first, second;
+  Initialize(reference);
+  Initialize(first);
+  Initialize(second);
+
+  /*--- Continuing from a saved state gives the same statistics as one run. ---*/
+  Advance(reference, 0, nStep);
+  Advance(first, 0, nStep / 2 + 3);
+
+  const auto names = first.GetStateNames();
+  for (unsigned long iField = 0; iField < names.size(); ++iField) {
+    for (unsigned long iPoint = 0; iPoint < 2; ++iPoint) {
+      second.SetState(iField, iPoint, first.GetState(iField, iPoint));
+    }
+  }
+  CHECK(second.GetLastIter() == nStep / 2 + 2);
+  Advance(second, nStep / 2 + 3, nStep);
+
+  for (unsigned long iField = 0; iField < names.size(); ++iField) {
+    CHECK(second.GetState(iField, 1) == Approx(reference.GetState(iField, 1)).margin(1e-12));
+  }
+}
@@ -87,6 +87,9 @@ struct UnitQuadTestCase {
     cout.rdbuf(nullptr);
     {
       auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      /*--- Linear partitioning, each rank keeps the points it has read. ---*/
+      for (auto iPoint = 0ul; iPoint < aux_geometry->GetnPoint(); ++iPoint)
+        aux_geometry->nodes->SetColor(iPoint, SU2_MPI::GetRank());
       geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
     }
     geometry->SetSendReceive(config.get());